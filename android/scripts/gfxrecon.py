@@ -70,7 +70,7 @@ def CreateReplayParser():
     parser.add_argument('--paused', action='store_true', default=False, help='Pause after replaying the first frame (same as "--pause-frame 1"; forwarded to replay tool)')
     parser.add_argument('--screenshot-all', action='store_true', default=False, help='Generate screenshots for all frames.  When this option is specified, --screenshots is ignored (forwarded to replay tool)')
     parser.add_argument('--screenshots', metavar='RANGES', help='Generate screenshots for the specified frames.  Target frames are specified as a comma separated list of frame ranges.  A frame range can be specified as a single value, to specify a single frame, or as two hyphenated values, to specify the first and last frames to process.  Frame ranges should be specified in ascending order and cannot overlap.  Note that frame numbering is 1-based (i.e. the first frame is frame 1).  Example: 200,301-305 will generate six screenshots (forwarded to replay tool)')
-    parser.add_argument('--screenshot-format', metavar='FORMAT', choices=['bmp'], help='Image file format to use for screenshot generation.  Available formats are: bmp (forwarded to replay tool)')
+    parser.add_argument('--screenshot-format', metavar='FORMAT', choices=['bmp', 'png', 'qoi'], help='Image file format to use for screenshot generation.  Available formats are: bmp, png, qoi (forwarded to replay tool)')
     parser.add_argument('--screenshot-dir', metavar='DIR', help='Directory to write screenshots. Default is "/sdcard" (forwarded to replay tool)')
     parser.add_argument('--screenshot-prefix', metavar='PREFIX', help='Prefix to apply to the screenshot file name.  Default is "screenshot" (forwarded to replay tool)')
     parser.add_argument('--sfa', '--skip-failed-allocations', action='store_true', default=False, help='Skip vkAllocateMemory, vkAllocateCommandBuffers, and vkAllocateDescriptorSets calls that failed during capture (forwarded to replay tool)')
@@ -78,6 +78,10 @@ def CreateReplayParser():
     parser.add_argument('--surface-index', metavar='N', help='Restrict rendering to the Nth surface object created.  Used with captures that include multiple surfaces.  Default is -1 (render to all surfaces; forwarded to replay tool)')
     parser.add_argument('--sync', action='store_true', default=False, help='Synchronize after each queue submission with vkQueueWaitIdle (forwarded to replay tool)')
     parser.add_argument('--remove-unsupported', action='store_true', default=False, help='Remove unsupported extensions and features from instance and device creation parameters (forwarded to replay tool)')
+    parser.add_argument('--threaded-recording', action='store_true', default=False, help='Replay command buffer recording calls on worker threads, with one worker for each thread that recorded command buffers during capture (forwarded to replay tool)')
+    parser.add_argument('--async-pipeline-creation', action='store_true', default=False, help='Create graphics and compute pipelines on worker threads. Replay waits for a pipeline to be created when the pipeline is first used (forwarded to replay tool)')
+    parser.add_argument('--pipeline-cache-dir', metavar='DIR', help='Store a pipeline cache for each capture file and replay device in the specified directory. The cache is used for all pipeline creation and is updated when replay completes (forwarded to replay tool)')
+    parser.add_argument('--precreate-pipelines', action='store_true', default=False, help='Create all shader modules and pipelines from the capture file in parallel before replay starts, to populate the pipeline cache specified with --pipeline-cache-dir (forwarded to replay tool)')
     parser.add_argument('-m', '--memory-translation', metavar='MODE', choices=['none', 'remap', 'realign', 'rebind'], help='Enable memory translation for replay on GPUs with memory types that are not compatible with the capture GPU\'s memory types.  Available modes are: none, remap, realign, rebind (forwarded to replay tool)')
     parser.add_argument('file', nargs='?', help='File on device to play (forwarded to replay tool)')
     return parser
@@ -129,6 +133,19 @@ def MakeExtrasString(args):
     if args.remove_unsupported:
         arg_list.append('--remove-unsupported')
 
+    if args.threaded_recording:
+        arg_list.append('--threaded-recording')
+
+    if args.async_pipeline_creation:
+        arg_list.append('--async-pipeline-creation')
+
+    if args.pipeline_cache_dir:
+        arg_list.append('--pipeline-cache-dir')
+        arg_list.append('{}'.format(args.pipeline_cache_dir))
+
+    if args.precreate_pipelines:
+        arg_list.append('--precreate-pipelines')
+
     if args.memory_translation:
         arg_list.append('-m')
         arg_list.append('{}'.format(args.memory_translation))
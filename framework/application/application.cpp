@@ -23,6 +23,7 @@
 
 #include "application/application.h"
 
+#include "util/date_time.h"
 #include "util/logging.h"
 
 #include <algorithm>
@@ -32,7 +33,8 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(application)
 
 Application::Application(const std::string& name) :
-    file_processor_(nullptr), running_(false), paused_(false), name_(name)
+    file_processor_(nullptr), running_(false), paused_(false), name_(name), pause_frame_(0), quit_frame_(0),
+    frame_stats_(nullptr)
 {}
 
 Application::~Application()
@@ -91,11 +93,26 @@ bool Application::PlaySingleFrame()
 
     if (file_processor_)
     {
+        int64_t start_time = util::datetime::GetTimestamp();
+
         success = file_processor_->ProcessNextFrame();
 
         if (success)
         {
-            if (file_processor_->GetCurrentFrameNumber() == pause_frame_)
+            uint32_t frame_number = file_processor_->GetCurrentFrameNumber();
+
+            if (frame_stats_ != nullptr)
+            {
+                frame_stats_->AddFrameTime(
+                    frame_number, util::datetime::DiffTimestamps(start_time, util::datetime::GetTimestamp()));
+            }
+
+            if (frame_number == quit_frame_)
+            {
+                running_ = false;
+            }
+
+            if (frame_number == pause_frame_)
             {
                 paused_ = true;
             }
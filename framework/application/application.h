@@ -25,6 +25,7 @@
 #define GFXRECON_APPLICATION_APPLICATION_H
 
 #include "decode/file_processor.h"
+#include "decode/frame_timing_stats.h"
 #include "decode/window.h"
 #include "util/defines.h"
 
@@ -55,6 +56,12 @@ class Application
 
     void SetPauseFrame(uint32_t pause_frame) { pause_frame_ = pause_frame; }
 
+    // Replay stops after the specified frame has been processed.  A value of 0 replays all frames.
+    void SetQuitFrame(uint32_t quit_frame) { quit_frame_ = quit_frame; }
+
+    // Records the time spent processing each frame to the specified stats object.
+    void SetFrameTimingStats(decode::FrameTimingStats* frame_stats) { frame_stats_ = frame_stats; }
+
     bool PlaySingleFrame();
 
     bool RegisterWindow(decode::Window* window);
@@ -80,6 +87,8 @@ class Application
                                                     ///< system events.
     std::string                  name_;             ///< Application name to display in window title bar.
     uint32_t                     pause_frame_;      ///< The number for a frame that replay should pause after.
+    uint32_t                     quit_frame_;       ///< The number for a frame that replay should stop after.
+    decode::FrameTimingStats*    frame_stats_;      ///< Optional statistics to record frame processing times to.
     // clang-format on
 };
 
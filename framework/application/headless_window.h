@@ -0,0 +1,100 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_APPLICATION_HEADLESS_WINDOW_H
+#define GFXRECON_APPLICATION_HEADLESS_WINDOW_H
+
+#include "application/headless_application.h"
+#include "decode/window.h"
+#include "util/defines.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(application)
+
+// Window without a native window system object.  Surface creation produces a VK_NULL_HANDLE surface, which causes the
+// replay consumer to back the swapchains created for the surface with plain images that are never presented.
+class HeadlessWindow : public decode::Window
+{
+  public:
+    HeadlessWindow(HeadlessApplication* application);
+
+    virtual ~HeadlessWindow() override;
+
+    virtual bool Create(const std::string& title,
+                        const int32_t      x,
+                        const int32_t      y,
+                        const uint32_t     width,
+                        const uint32_t     height) override;
+
+    virtual bool Destroy() override;
+
+    virtual void SetTitle(const std::string& title) override;
+
+    virtual void SetPosition(const int32_t x, const int32_t y) override;
+
+    virtual void SetSize(const uint32_t width, const uint32_t height) override;
+
+    virtual void
+    SetSizePreTransform(const uint32_t width, const uint32_t height, const uint32_t pre_transform) override;
+
+    virtual void SetVisibility(bool show) override;
+
+    virtual void SetForeground() override;
+
+    virtual bool GetNativeHandle(HandleType type, void** handle) override;
+
+    virtual VkResult CreateSurface(const encode::InstanceTable* table,
+                                   VkInstance                   instance,
+                                   VkFlags                      flags,
+                                   VkSurfaceKHR*                pSurface) override;
+
+    virtual void DestroySurface(const encode::InstanceTable* table, VkInstance instance, VkSurfaceKHR surface) override;
+
+  private:
+    HeadlessApplication* headless_application_;
+};
+
+class HeadlessWindowFactory : public decode::WindowFactory
+{
+  public:
+    HeadlessWindowFactory(HeadlessApplication* application);
+
+    // Headless replay does not require a platform surface extension.
+    virtual const char* GetSurfaceExtensionName() const override { return nullptr; }
+
+    virtual decode::Window*
+    Create(const int32_t x, const int32_t y, const uint32_t width, const uint32_t height) override;
+
+    void Destroy(decode::Window* window) override;
+
+    virtual VkBool32 GetPhysicalDevicePresentationSupport(const encode::InstanceTable* table,
+                                                          VkPhysicalDevice             physical_device,
+                                                          uint32_t                     queue_family_index) override;
+
+  private:
+    HeadlessApplication* headless_application_;
+};
+
+GFXRECON_END_NAMESPACE(application)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_APPLICATION_HEADLESS_WINDOW_H
@@ -45,8 +45,12 @@ class ApiDecoder
   public:
     virtual ~ApiDecoder() {}
 
+    // The file processor queries these before reading a block's data, and skips the data for blocks that are not
+    // supported by any decoder without reading or decompressing it.
     virtual bool SupportsApiCall(format::ApiCallId id) = 0;
 
+    virtual bool SupportsMetaDataType(format::MetaDataType type) = 0;
+
     virtual void DecodeFunctionCall(format::ApiCallId  id,
                                     const ApiCallInfo& call_info,
                                     const uint8_t*     buffer,
@@ -61,6 +65,10 @@ class ApiDecoder
     virtual void DispatchFillMemoryCommand(
         format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) = 0;
 
+    // Returns a pointer to the replay memory that a fill memory command targets, for the file processor to write the
+    // fill data to directly in place of a call to DispatchFillMemoryCommand, or nullptr if the data must be dispatched.
+    virtual uint8_t* GetFillMemoryDestination(format::ThreadId thread_id, uint64_t memory_id, uint64_t offset) = 0;
+
     virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
                                              format::HandleId surface_id,
                                              uint32_t         width,
@@ -0,0 +1,209 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/custom_vulkan_struct_to_json.h"
+
+#include "decode/vulkan_json_util.h"
+#include "generated/generated_vulkan_struct_to_json.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Only the active member of a union is known to the struct that contains it, so union wrappers are written with the
+// raw union value, or with the decoded member for unions that were decoded based on a type field.
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearColorValue& data)
+{
+    const VkClearColorValue& value = *data.decoded_value;
+
+    writer.BeginObject();
+    writer.Key("float32");
+    ArrayToJson(writer, value.float32, 4);
+    writer.Key("int32");
+    ArrayToJson(writer, value.int32, 4);
+    FieldToJson(writer, "uint32", data.uint32);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearValue& data)
+{
+    const VkClearValue& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "color", data.color);
+    writer.Key("depthStencil");
+    writer.BeginObject();
+    FieldToJson(writer, "depth", value.depthStencil.depth);
+    FieldToJson(writer, "stencil", value.depthStencil.stencil);
+    writer.EndObject();
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableStatisticValueKHR& data)
+{
+    const VkPipelineExecutableStatisticValueKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "b32", value.b32);
+    FieldToJson(writer, "i64", value.i64);
+    FieldToJson(writer, "u64", value.u64);
+    FieldToJson(writer, "f64", value.f64);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceOrHostAddressKHR& data)
+{
+    const VkDeviceOrHostAddressKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "deviceAddress", value.deviceAddress);
+    FieldToJson(writer, "hostAddress", data.hostAddress);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceOrHostAddressConstKHR& data)
+{
+    const VkDeviceOrHostAddressConstKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "deviceAddress", value.deviceAddress);
+    FieldToJson(writer, "hostAddress", data.hostAddress);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryDataKHR& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "triangles", data.triangles);
+    FieldToJson(writer, "aabbs", data.aabbs);
+    FieldToJson(writer, "instances", data.instances);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceValueDataINTEL& data)
+{
+    writer.BeginObject();
+    if (data.valueString.GetPointer() != nullptr)
+    {
+        FieldToJson(writer, "valueString", data.valueString);
+    }
+    else
+    {
+        FieldToJson(writer, "value64", data.decoded_value->value64);
+    }
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorImageInfo& data)
+{
+    const VkDescriptorImageInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sampler", data.sampler);
+    FieldToJson(writer, "imageView", data.imageView);
+    FieldToJson(writer, "imageLayout", value.imageLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSet& data)
+{
+    const VkWriteDescriptorSet& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "dstSet", data.dstSet);
+    FieldToJson(writer, "dstBinding", value.dstBinding);
+    FieldToJson(writer, "dstArrayElement", value.dstArrayElement);
+    FieldToJson(writer, "descriptorCount", value.descriptorCount);
+    FieldToJson(writer, "descriptorType", value.descriptorType);
+    FieldToJson(writer, "pImageInfo", data.pImageInfo);
+    FieldToJson(writer, "pBufferInfo", data.pBufferInfo);
+    FieldToJson(writer, "pTexelBufferView", data.pTexelBufferView);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceValueINTEL& data)
+{
+    const VkPerformanceValueINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "data", data.data);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryKHR& data)
+{
+    const VkAccelerationStructureGeometryKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "geometryType", value.geometryType);
+    FieldToJson(writer, "geometry", data.geometry);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_ACL& data)
+{
+    const ACL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "AclRevision", value.AclRevision);
+    FieldToJson(writer, "Sbz1", value.Sbz1);
+    FieldToJson(writer, "AclSize", value.AclSize);
+    FieldToJson(writer, "AceCount", value.AceCount);
+    FieldToJson(writer, "Sbz2", value.Sbz2);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_SECURITY_DESCRIPTOR& data)
+{
+    const SECURITY_DESCRIPTOR& value = *data.decoded_value;
+
+    // The variable length SID structures are written in their packed form.
+    writer.BeginObject();
+    FieldToJson(writer, "Revision", value.Revision);
+    FieldToJson(writer, "Sbz1", value.Sbz1);
+    FieldToJson(writer, "Control", value.Control);
+    FieldToJson(writer, "Owner", data.PackedOwner);
+    FieldToJson(writer, "Group", data.PackedGroup);
+    FieldToJson(writer, "Sacl", data.Sacl);
+    FieldToJson(writer, "Dacl", data.Dacl);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_SECURITY_ATTRIBUTES& data)
+{
+    const SECURITY_ATTRIBUTES& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "nLength", value.nLength);
+    FieldToJson(writer, "lpSecurityDescriptor", data.lpSecurityDescriptor);
+    FieldToJson(writer, "bInheritHandle", value.bInheritHandle);
+    writer.EndObject();
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
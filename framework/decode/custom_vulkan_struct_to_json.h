@@ -0,0 +1,56 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_CUSTOM_VULKAN_STRUCT_TO_JSON_H
+#define GFXRECON_DECODE_CUSTOM_VULKAN_STRUCT_TO_JSON_H
+
+#include "decode/custom_vulkan_struct_decoders.h"
+#include "util/defines.h"
+#include "util/json_writer.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decoded union wrappers.
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearColorValue& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearValue& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableStatisticValueKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceOrHostAddressKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceOrHostAddressConstKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryDataKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceValueDataINTEL& data);
+
+// Decoded struct wrappers for Vulkan structures that require special processing.
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorImageInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSet& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceValueINTEL& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryKHR& data);
+
+// Decoded struct wrappers for SECURITY_ATTRIBUTES and related WIN32 structures.
+void StructToJson(util::JsonWriter& writer, const Decoded_ACL& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_SECURITY_DESCRIPTOR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_SECURITY_ATTRIBUTES& data);
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_CUSTOM_VULKAN_STRUCT_TO_JSON_H
@@ -26,7 +26,8 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-DecodeAllocator* DecodeAllocator::instance_{ nullptr };
+const size_t                  DecodeAllocator::kAllocatorBlockSize;
+thread_local DecodeAllocator* DecodeAllocator::instance_{ nullptr };
 
 void DecodeAllocator::Begin()
 {
@@ -41,14 +42,24 @@ void DecodeAllocator::Begin()
 void DecodeAllocator::End()
 {
     assert((instance_ != nullptr) && instance_->can_allocate_);
-    instance_->allocator_.Clear(false);
+    instance_->allocator_->Clear(false);
     instance_->can_allocate_ = false;
 }
 
+std::unique_ptr<util::MonotonicAllocator> DecodeAllocator::TakeAllocations()
+{
+    assert((instance_ != nullptr) && instance_->can_allocate_);
+
+    std::unique_ptr<util::MonotonicAllocator> allocations = std::move(instance_->allocator_);
+    instance_->allocator_ = std::make_unique<util::MonotonicAllocator>(kAllocatorBlockSize);
+
+    return allocations;
+}
+
 void DecodeAllocator::FreeSystemMemory()
 {
     assert((instance_ != nullptr) && !instance_->can_allocate_);
-    instance_->allocator_.Clear(true);
+    instance_->allocator_->Clear(true);
 }
 
 void DecodeAllocator::DestroyInstance()
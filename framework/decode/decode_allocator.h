@@ -27,9 +27,12 @@
 #include "util/defines.h"
 #include "util/monotonic_allocator.h"
 
+#include <memory>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// The allocator instance is thread local, allowing calls to be decoded concurrently from multiple threads.
 class DecodeAllocator
 {
   public:
@@ -41,28 +44,34 @@ class DecodeAllocator
     static T* Allocate(size_t count = 1, bool initialize = true)
     {
         assert((instance_ != nullptr) && instance_->can_allocate_);
-        return instance_->can_allocate_ ? instance_->allocator_.Allocate<T>(count, initialize) : nullptr;
+        return instance_->can_allocate_ ? instance_->allocator_->Allocate<T>(count, initialize) : nullptr;
     }
 
     // End must be called to release any allocations made since last call to Begin. Currently allocated system memory
     // is re-used for future allocations.
     static void End();
 
+    // Transfers ownership of the memory allocated since the last call to Begin to the caller, for decoded data that
+    // must remain valid after End is called (e.g. data that is processed asynchronously). Allocations made after the
+    // transfer are made from new system memory blocks.
+    static std::unique_ptr<util::MonotonicAllocator> TakeAllocations();
+
     // Free system memory blocks. Must not be called between Begin and End
     static void FreeSystemMemory();
 
-    // Destroy the allocator instance. This will also frees all allocated memory.
+    // Destroy the allocator instance for the current thread. This will also frees all allocated memory.
     static void DestroyInstance();
 
   private:
-    DecodeAllocator() : allocator_(kAllocatorBlockSize), can_allocate_(false) {}
+    DecodeAllocator() : allocator_(std::make_unique<util::MonotonicAllocator>(kAllocatorBlockSize)), can_allocate_(false)
+    {}
 
   private:
-    static const size_t     kAllocatorBlockSize{ 64 * 1024 };
-    static DecodeAllocator* instance_;
+    static const size_t                  kAllocatorBlockSize{ 64 * 1024 };
+    static thread_local DecodeAllocator* instance_;
 
-    util::MonotonicAllocator allocator_;
-    bool                     can_allocate_;
+    std::unique_ptr<util::MonotonicAllocator> allocator_;
+    bool                                      can_allocate_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -26,17 +26,21 @@
 #include "decode/decode_allocator.h"
 #include "format/format_util.h"
 #include "util/compressor.h"
+#include "util/local_socket.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
 #include <cassert>
+#include <cinttypes>
+#include <limits>
 #include <numeric>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 FileProcessor::FileProcessor() :
-    file_header_{}, file_descriptor_(nullptr), current_frame_number_(0), bytes_read_(0),
+    file_header_{}, file_descriptor_(nullptr), seekable_(false), current_frame_number_(0), bytes_read_(0),
+    block_offset_(0), block_end_offset_(std::numeric_limits<uint64_t>::max()),
     error_state_(kErrorInvalidFileDescriptor), compressor_(nullptr)
 {}
 
@@ -58,12 +62,24 @@ FileProcessor::~FileProcessor()
 
 bool FileProcessor::Initialize(const std::string& filename)
 {
-    bool success = false;
+    bool    success = false;
+    int32_t result  = 0;
 
-    int32_t result = util::platform::FileOpen(&file_descriptor_, filename.c_str(), "rb");
+    if (util::localsocket::IsSocketPath(filename))
+    {
+        // Listen for the capture layer to connect and stream the capture file.
+        file_descriptor_ = util::localsocket::AcceptStream(util::localsocket::GetSocketPath(filename));
+    }
+    else
+    {
+        result = util::platform::FileOpen(&file_descriptor_, filename.c_str(), "rb");
+    }
 
     if ((result == 0) && (file_descriptor_ != nullptr))
     {
+        // Sockets and named pipes can only be read sequentially.
+        seekable_ = util::platform::FileSeek(file_descriptor_, 0, util::platform::FileSeekCurrent);
+
         success = ProcessFileHeader();
 
         if (success)
@@ -122,6 +138,131 @@ bool FileProcessor::ProcessAllFrames()
     return (error_state_ == kErrorNone);
 }
 
+bool FileProcessor::Rewind()
+{
+    bool success = false;
+
+    if (!seekable_)
+    {
+        GFXRECON_LOG_ERROR("Cannot rewind %s, which is a stream that can only be read once", filename_.c_str());
+    }
+    else if (file_descriptor_ != nullptr)
+    {
+        // Blocks start immediately after the file header and its options.
+        uint64_t first_block_offset = sizeof(file_header_) + (file_options_.size() * sizeof(format::FileOptionPair));
+
+        clearerr(file_descriptor_);
+
+        success = util::platform::FileSeek(
+            file_descriptor_, static_cast<int64_t>(first_block_offset), util::platform::FileSeekSet);
+
+        if (success)
+        {
+            current_frame_number_ = 0;
+            bytes_read_           = first_block_offset;
+            block_offset_         = first_block_offset;
+            error_state_          = kErrorNone;
+        }
+        else
+        {
+            GFXRECON_LOG_ERROR("Failed to seek to the start of file %s", filename_.c_str());
+            error_state_ = kErrorReadingFile;
+        }
+    }
+
+    return success;
+}
+
+bool FileProcessor::ScanBlocks(uint64_t chunk_size, std::vector<uint64_t>* chunk_offsets)
+{
+    assert(chunk_offsets != nullptr);
+
+    format::BlockHeader block_header;
+    uint64_t            next_chunk_offset = bytes_read_;
+    bool                success           = IsFileValid();
+
+    while (success)
+    {
+        uint64_t block_offset = bytes_read_;
+
+        success = ReadBlockHeader(&block_header);
+
+        if (success)
+        {
+            if (block_offset >= next_chunk_offset)
+            {
+                chunk_offsets->push_back(block_offset);
+                next_chunk_offset = block_offset + chunk_size;
+            }
+
+            GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+            size_t data_size = static_cast<size_t>(block_header.size);
+
+            if (format::RemoveCompressedBlockBit(block_header.type) == format::BlockType::kFunctionCallBlock)
+            {
+                format::ApiCallId api_call_id = format::ApiCallId::ApiCall_Unknown;
+
+                success = ReadBytes(&api_call_id, sizeof(api_call_id));
+
+                if (success)
+                {
+                    data_size -= sizeof(api_call_id);
+
+                    if (IsFrameDelimiter(api_call_id))
+                    {
+                        ++current_frame_number_;
+                    }
+                }
+            }
+
+            success = success && SkipBytes(data_size);
+
+            if (!success)
+            {
+                HandleBlockReadError(kErrorReadingBlockData, "Failed to scan block data");
+            }
+        }
+        else if (!feof(file_descriptor_))
+        {
+            GFXRECON_LOG_ERROR("Failed to read block header");
+            error_state_ = kErrorReadingBlockHeader;
+        }
+    }
+
+    return (error_state_ == kErrorNone);
+}
+
+bool FileProcessor::ProcessBlockRange(uint64_t start_offset, uint64_t end_offset)
+{
+    bool success = IsFileValid() && seekable_;
+
+    if (success)
+    {
+        success = util::platform::FileSeek(
+            file_descriptor_, static_cast<int64_t>(start_offset), util::platform::FileSeekSet);
+    }
+
+    if (success)
+    {
+        bytes_read_       = start_offset;
+        block_end_offset_ = end_offset;
+
+        while (success && (bytes_read_ < end_offset))
+        {
+            success = ProcessNextFrame();
+        }
+
+        block_end_offset_ = std::numeric_limits<uint64_t>::max();
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to seek to block at file offset %" PRIu64, start_offset);
+        error_state_ = kErrorReadingFile;
+    }
+
+    return (error_state_ == kErrorNone);
+}
+
 bool FileProcessor::ProcessFileHeader()
 {
     bool success = false;
@@ -185,9 +326,11 @@ bool FileProcessor::ProcessBlocks()
     format::BlockHeader block_header;
     bool                success = true;
 
-    while (success)
+    // The end offset limits processing to a range of blocks for ProcessBlockRange().
+    while (success && (bytes_read_ < block_end_offset_))
     {
-        success = ReadBlockHeader(&block_header);
+        block_offset_ = bytes_read_;
+        success       = ReadBlockHeader(&block_header);
 
         if (success)
         {
@@ -199,7 +342,21 @@ bool FileProcessor::ProcessBlocks()
 
                 if (success)
                 {
-                    success = ProcessFunctionCall(block_header, api_call_id);
+                    if (IsApiCallSupported(api_call_id))
+                    {
+                        success = ProcessFunctionCall(block_header, api_call_id);
+                    }
+                    else
+                    {
+                        // No decoder processes the call, so its data is skipped without being read or decompressed.
+                        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+                        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(api_call_id));
+
+                        if (!success)
+                        {
+                            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip function call block data");
+                        }
+                    }
 
                     // Break from loop on frame delimiter.
                     if (IsFrameDelimiter(api_call_id))
@@ -222,7 +379,21 @@ bool FileProcessor::ProcessBlocks()
 
                 if (success)
                 {
-                    success = ProcessMetaData(block_header, meta_type);
+                    if (IsMetaDataSupported(meta_type))
+                    {
+                        success = ProcessMetaData(block_header, meta_type);
+                    }
+                    else
+                    {
+                        // No decoder processes the command, so its data is skipped without being read or decompressed.
+                        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+                        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_type));
+
+                        if (!success)
+                        {
+                            HandleBlockReadError(kErrorReadingBlockData, "Failed to skip meta-data block data");
+                        }
+                    }
                 }
                 else
                 {
@@ -333,12 +504,29 @@ bool FileProcessor::ReadBytes(void* buffer, size_t buffer_size)
 
 bool FileProcessor::SkipBytes(size_t skip_size)
 {
-    bool success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+    bool success = true;
 
-    if (success)
+    if (seekable_)
     {
-        // These technically count as bytes read/processed.
-        bytes_read_ += skip_size;
+        success = util::platform::FileSeek(file_descriptor_, skip_size, util::platform::FileSeekCurrent);
+
+        if (success)
+        {
+            // These technically count as bytes read/processed.
+            bytes_read_ += skip_size;
+        }
+    }
+    else
+    {
+        // Streams cannot seek, so skipped data is read and discarded.
+        uint8_t discard[4096];
+
+        while (success && (skip_size > 0))
+        {
+            size_t read_size = std::min(skip_size, sizeof(discard));
+            success          = ReadBytes(discard, read_size);
+            skip_size -= read_size;
+        }
     }
 
     return success;
@@ -438,6 +626,7 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
     if (meta_type == format::MetaDataType::kFillMemoryCommand)
     {
         format::FillMemoryCommandHeader header;
+        bool                            filled = false;
 
         success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
         success = success && ReadBytes(&header.memory_id, sizeof(header.memory_id));
@@ -460,18 +649,41 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             }
             else
             {
-                success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+                uint8_t* destination = nullptr;
+
+                // Uncompressed data is read directly into the replay memory when there is only one decoder to process
+                // the command, avoiding a copy through the parameter buffer.  Compressed data is still decompressed
+                // to the parameter buffer, because decompression reads back the output it has written, which is slow
+                // for the uncached memory that is typically mapped for uploads.
+                if (decoders_.size() == 1)
+                {
+                    destination = decoders_[0]->GetFillMemoryDestination(
+                        header.thread_id, header.memory_id, header.memory_offset);
+                }
+
+                if (destination != nullptr)
+                {
+                    success = ReadBytes(destination, static_cast<size_t>(header.memory_size));
+                    filled  = true;
+                }
+                else
+                {
+                    success = ReadParameterBuffer(static_cast<size_t>(header.memory_size));
+                }
             }
 
             if (success)
             {
-                for (auto decoder : decoders_)
+                if (!filled)
                 {
-                    decoder->DispatchFillMemoryCommand(header.thread_id,
-                                                       header.memory_id,
-                                                       header.memory_offset,
-                                                       header.memory_size,
-                                                       parameter_buffer_.data());
+                    for (auto decoder : decoders_)
+                    {
+                        decoder->DispatchFillMemoryCommand(header.thread_id,
+                                                           header.memory_id,
+                                                           header.memory_offset,
+                                                           header.memory_size,
+                                                           parameter_buffer_.data());
+                    }
                 }
             }
             else
@@ -1029,6 +1241,13 @@ bool FileProcessor::ProcessMetaData(const format::BlockHeader& block_header, for
             }
         }
     }
+    else if (meta_type == format::MetaDataType::kCaptureProfileCommand)
+    {
+        // Capture layer overhead statistics are informational and are not processed by decoders.
+        GFXRECON_CHECK_CONVERSION_DATA_LOSS(size_t, block_header.size);
+
+        success = SkipBytes(static_cast<size_t>(block_header.size) - sizeof(meta_type));
+    }
     else
     {
         // Unrecognized metadata type.
@@ -1072,6 +1291,32 @@ bool FileProcessor::ProcessStateMarker(const format::BlockHeader& block_header,
     return success;
 }
 
+bool FileProcessor::IsApiCallSupported(format::ApiCallId call_id) const
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsApiCall(call_id))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FileProcessor::IsMetaDataSupported(format::MetaDataType meta_type) const
+{
+    for (auto decoder : decoders_)
+    {
+        if (decoder->SupportsMetaDataType(meta_type))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 bool FileProcessor::IsFrameDelimiter(format::ApiCallId call_id) const
 {
     // TODO: IDs of API calls that were treated as frame delimiters by the GFXReconstruct layer should be in the capture
@@ -77,6 +77,20 @@ class FileProcessor
     // Returns false if processing failed.  Use GetErrorState() to determine error condition for failure case.
     bool ProcessAllFrames();
 
+    // Returns to the first block of the file, so that the file can be processed again.  The frame number is reset to 0.
+    // Fails for streamed captures, which are not seekable.
+    bool Rewind();
+
+    // Reads the header of each remaining block in the file, skipping the block data, to split the file into chunks of
+    // approximately chunk_size bytes at block boundaries.  The file offset of the first block of each chunk is written
+    // to chunk_offsets.  Frame delimiters are counted as they are encountered, so GetCurrentFrameNumber() reports the
+    // number of frames in the file after the scan.  Returns false if the scan failed.
+    bool ScanBlocks(uint64_t chunk_size, std::vector<uint64_t>* chunk_offsets);
+
+    // Processes the blocks from start_offset up to end_offset, which must be block boundaries such as the offsets
+    // produced by ScanBlocks().  Returns false if processing failed, or if the capture is not seekable.
+    bool ProcessBlockRange(uint64_t start_offset, uint64_t end_offset);
+
     const format::FileHeader& GetFileHeader() const { return file_header_; }
 
     const std::vector<format::FileOptionPair>& GetFileOptions() const { return file_options_; }
@@ -85,8 +99,14 @@ class FileProcessor
 
     uint64_t GetNumBytesRead() const { return bytes_read_; }
 
+    // Returns the file offset of the block that is currently being processed, for use by consumers that index blocks.
+    uint64_t GetCurrentBlockOffset() const { return block_offset_; }
+
     Error GetErrorState() const { return error_state_; }
 
+    // Returns false when the capture is read from a socket or named pipe, which only support sequential processing.
+    bool IsSeekable() const { return seekable_; }
+
   private:
     bool ProcessFileHeader();
 
@@ -112,6 +132,10 @@ class FileProcessor
 
     bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type);
 
+    bool IsApiCallSupported(format::ApiCallId call_id) const;
+
+    bool IsMetaDataSupported(format::MetaDataType meta_type) const;
+
     bool IsFrameDelimiter(format::ApiCallId call_id) const;
 
     bool IsFileHeaderValid() const { return (file_header_.fourcc == GFXRECON_FOURCC); }
@@ -120,12 +144,15 @@ class FileProcessor
 
   private:
     FILE*                               file_descriptor_;
+    bool                                seekable_;
     std::string                         filename_;
     format::FileHeader                  file_header_;
     std::vector<format::FileOptionPair> file_options_;
     format::EnabledOptions              enabled_options_;
     uint32_t                            current_frame_number_;
     uint64_t                            bytes_read_;
+    uint64_t                            block_offset_;
+    uint64_t                            block_end_offset_;
     Error                               error_state_;
     std::vector<ApiDecoder*>            decoders_;
     std::vector<uint8_t>                parameter_buffer_;
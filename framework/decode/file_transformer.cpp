@@ -32,7 +32,7 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
 FileTransformer::FileTransformer() :
-    file_header_{}, input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0),
+    file_header_{}, input_file_(nullptr), output_file_(nullptr), bytes_read_(0), bytes_written_(0), block_offset_(0),
     error_state_(kErrorInvalidFileDescriptor), loading_state_(false)
 {}
 
@@ -187,7 +187,8 @@ bool FileTransformer::ProcessNextBlock()
     format::BlockHeader block_header;
     bool                success = true;
 
-    success = ReadBlockHeader(&block_header);
+    block_offset_ = bytes_read_;
+    success       = ReadBlockHeader(&block_header);
 
     if (success)
     {
@@ -80,6 +80,9 @@ class FileTransformer
 
     uint64_t GetNumBytesWritten() const { return bytes_written_; }
 
+    // Returns the file offset of the block that is currently being processed.
+    uint64_t GetCurrentBlockOffset() const { return block_offset_; }
+
     Error GetErrorState() const { return error_state_; }
 
   protected:
@@ -148,6 +151,7 @@ class FileTransformer
     format::EnabledOptions              enabled_options_;
     uint64_t                            bytes_read_;
     uint64_t                            bytes_written_;
+    uint64_t                            block_offset_;
     Error                               error_state_;
     bool                                loading_state_;
     std::vector<uint8_t>                parameter_buffer_;
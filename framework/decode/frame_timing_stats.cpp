@@ -0,0 +1,368 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/frame_timing_stats.h"
+
+#include "util/date_time.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <cmath>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+const char kCsvExtension[] = ".csv";
+
+static double GetPercentile(const std::vector<int64_t>& sorted_times, double percentile)
+{
+    assert(!sorted_times.empty());
+
+    // Nearest-rank percentile.
+    size_t rank = static_cast<size_t>(std::ceil((percentile / 100.0) * sorted_times.size()));
+    rank        = std::max(rank, static_cast<size_t>(1));
+
+    return util::datetime::ConvertTimestampToMilliseconds(sorted_times[rank - 1]);
+}
+
+static bool HasCsvExtension(const std::string& filename)
+{
+    const size_t extension_length = sizeof(kCsvExtension) - 1;
+
+    if (filename.length() < extension_length)
+    {
+        return false;
+    }
+
+    return (util::platform::StringCompareNoCase(filename.c_str() + (filename.length() - extension_length),
+                                                kCsvExtension) == 0);
+}
+
+FrameTimingStats::FrameTimingStats(uint32_t start_frame, uint32_t end_frame) :
+    start_frame_(std::max(start_frame, 1u)), end_frame_(end_frame)
+{}
+
+void FrameTimingStats::BeginLoop()
+{
+    loops_.emplace_back();
+
+    if (end_frame_ != 0)
+    {
+        loops_.back().reserve((end_frame_ - start_frame_) + 1);
+    }
+}
+
+FrameTimingStats::FrameTimes* FrameTimingStats::GetFrameTimes(uint32_t frame_number)
+{
+    if (!IsMeasuredFrame(frame_number))
+    {
+        return nullptr;
+    }
+
+    if (loops_.empty())
+    {
+        BeginLoop();
+    }
+
+    LoopTimes& loop  = loops_.back();
+    size_t     index = frame_number - start_frame_;
+
+    if (index >= loop.size())
+    {
+        loop.resize(index + 1);
+    }
+
+    return &loop[index];
+}
+
+void FrameTimingStats::AddFrameTime(uint32_t frame_number, int64_t duration)
+{
+    FrameTimes* times = GetFrameTimes(frame_number);
+    if (times != nullptr)
+    {
+        times->frame_time = duration;
+    }
+}
+
+void FrameTimingStats::AddGpuFrameTime(uint32_t frame_number, int64_t duration)
+{
+    FrameTimes* times = GetFrameTimes(frame_number);
+    if (times != nullptr)
+    {
+        times->gpu_time = duration;
+    }
+}
+
+uint32_t FrameTimingStats::GetMeasuredFrameCount() const
+{
+    uint32_t count = 0;
+
+    for (const auto& loop : loops_)
+    {
+        for (const auto& times : loop)
+        {
+            if (times.frame_time != kNoTime)
+            {
+                ++count;
+            }
+        }
+    }
+
+    return count;
+}
+
+uint32_t FrameTimingStats::GetLastMeasuredFrame() const
+{
+    if (!loops_.empty())
+    {
+        const LoopTimes& loop = loops_.back();
+
+        for (size_t i = loop.size(); i > 0; --i)
+        {
+            if (loop[i - 1].frame_time != kNoTime)
+            {
+                return start_frame_ + static_cast<uint32_t>(i - 1);
+            }
+        }
+    }
+
+    return 0;
+}
+
+int64_t FrameTimingStats::GetTotalFrameTime() const
+{
+    int64_t total = 0;
+
+    for (const auto& loop : loops_)
+    {
+        for (const auto& times : loop)
+        {
+            if (times.frame_time != kNoTime)
+            {
+                total += times.frame_time;
+            }
+        }
+    }
+
+    return total;
+}
+
+FrameTimingStats::Summary FrameTimingStats::Summarize(int64_t FrameTimes::*member) const
+{
+    Summary              summary;
+    std::vector<int64_t> sorted_times;
+    int64_t              total = 0;
+
+    for (const auto& loop : loops_)
+    {
+        for (const auto& times : loop)
+        {
+            int64_t time = times.*member;
+            if (time != kNoTime)
+            {
+                sorted_times.push_back(time);
+                total += time;
+            }
+        }
+    }
+
+    if (!sorted_times.empty())
+    {
+        std::sort(sorted_times.begin(), sorted_times.end());
+
+        summary.count = static_cast<uint32_t>(sorted_times.size());
+        summary.min   = util::datetime::ConvertTimestampToMilliseconds(sorted_times.front());
+        summary.max   = util::datetime::ConvertTimestampToMilliseconds(sorted_times.back());
+        summary.avg   = util::datetime::ConvertTimestampToMilliseconds(total) / sorted_times.size();
+        summary.p50   = GetPercentile(sorted_times, 50.0);
+        summary.p90   = GetPercentile(sorted_times, 90.0);
+        summary.p95   = GetPercentile(sorted_times, 95.0);
+        summary.p99   = GetPercentile(sorted_times, 99.0);
+    }
+
+    return summary;
+}
+
+void FrameTimingStats::PrintSummary() const
+{
+    Summary frame_summary = GetFrameTimeSummary();
+    Summary gpu_summary   = GetGpuTimeSummary();
+
+    if (frame_summary.count > 0)
+    {
+        GFXRECON_WRITE_CONSOLE("Frame time (ms): min %.3f, avg %.3f, max %.3f, p50 %.3f, p90 %.3f, p95 %.3f, p99 %.3f",
+                               frame_summary.min,
+                               frame_summary.avg,
+                               frame_summary.max,
+                               frame_summary.p50,
+                               frame_summary.p90,
+                               frame_summary.p95,
+                               frame_summary.p99);
+    }
+
+    if (gpu_summary.count > 0)
+    {
+        GFXRECON_WRITE_CONSOLE("GPU time (ms): min %.3f, avg %.3f, max %.3f, p50 %.3f, p90 %.3f, p95 %.3f, p99 %.3f",
+                               gpu_summary.min,
+                               gpu_summary.avg,
+                               gpu_summary.max,
+                               gpu_summary.p50,
+                               gpu_summary.p90,
+                               gpu_summary.p95,
+                               gpu_summary.p99);
+    }
+}
+
+bool FrameTimingStats::WriteReport(const std::string& filename) const
+{
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open frame timing report file %s", filename.c_str());
+        return false;
+    }
+
+    bool success = HasCsvExtension(filename) ? WriteCsvReport(file) : WriteJsonReport(file);
+
+    util::platform::FileClose(file);
+
+    if (success)
+    {
+        GFXRECON_LOG_INFO("Wrote frame timing report to %s", filename.c_str());
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to write frame timing report file %s", filename.c_str());
+    }
+
+    return success;
+}
+
+bool FrameTimingStats::WriteCsvReport(FILE* file) const
+{
+    assert(file != nullptr);
+
+    fprintf(file, "loop,frame,frame_ms,gpu_ms\n");
+
+    for (size_t loop_index = 0; loop_index < loops_.size(); ++loop_index)
+    {
+        const LoopTimes& loop = loops_[loop_index];
+
+        for (size_t i = 0; i < loop.size(); ++i)
+        {
+            const FrameTimes& times = loop[i];
+
+            if (times.frame_time != kNoTime)
+            {
+                fprintf(file,
+                        "%" PRIu64 ",%" PRIu64 ",%.3f,",
+                        static_cast<uint64_t>(loop_index),
+                        static_cast<uint64_t>(start_frame_ + i),
+                        util::datetime::ConvertTimestampToMilliseconds(times.frame_time));
+
+                if (times.gpu_time != kNoTime)
+                {
+                    fprintf(file, "%.3f", util::datetime::ConvertTimestampToMilliseconds(times.gpu_time));
+                }
+
+                fprintf(file, "\n");
+            }
+        }
+    }
+
+    return (ferror(file) == 0);
+}
+
+static void WriteJsonSummary(FILE* file, const char* name, const FrameTimingStats::Summary& summary, bool last)
+{
+    fprintf(file,
+            "    \"%s\": { \"count\": %u, \"min\": %.3f, \"avg\": %.3f, \"max\": %.3f, \"p50\": %.3f, \"p90\": %.3f, "
+            "\"p95\": %.3f, \"p99\": %.3f }%s\n",
+            name,
+            summary.count,
+            summary.min,
+            summary.avg,
+            summary.max,
+            summary.p50,
+            summary.p90,
+            summary.p95,
+            summary.p99,
+            last ? "" : ",");
+}
+
+bool FrameTimingStats::WriteJsonReport(FILE* file) const
+{
+    assert(file != nullptr);
+
+    fprintf(file, "{\n");
+    fprintf(file, "  \"start_frame\": %u,\n", start_frame_);
+    fprintf(file, "  \"end_frame\": %u,\n", (end_frame_ != 0) ? end_frame_ : GetLastMeasuredFrame());
+    fprintf(file, "  \"loops\": %u,\n", GetLoopCount());
+    fprintf(file, "  \"summary\": {\n");
+    WriteJsonSummary(file, "frame_ms", GetFrameTimeSummary(), false);
+    WriteJsonSummary(file, "gpu_ms", GetGpuTimeSummary(), true);
+    fprintf(file, "  },\n");
+    fprintf(file, "  \"frames\": [");
+
+    bool first = true;
+
+    for (size_t loop_index = 0; loop_index < loops_.size(); ++loop_index)
+    {
+        const LoopTimes& loop = loops_[loop_index];
+
+        for (size_t i = 0; i < loop.size(); ++i)
+        {
+            const FrameTimes& times = loop[i];
+
+            if (times.frame_time != kNoTime)
+            {
+                fprintf(file,
+                        "%s\n    { \"loop\": %" PRIu64 ", \"frame\": %" PRIu64 ", \"frame_ms\": %.3f",
+                        first ? "" : ",",
+                        static_cast<uint64_t>(loop_index),
+                        static_cast<uint64_t>(start_frame_ + i),
+                        util::datetime::ConvertTimestampToMilliseconds(times.frame_time));
+
+                if (times.gpu_time != kNoTime)
+                {
+                    fprintf(file, ", \"gpu_ms\": %.3f", util::datetime::ConvertTimestampToMilliseconds(times.gpu_time));
+                }
+
+                fprintf(file, " }");
+                first = false;
+            }
+        }
+    }
+
+    fprintf(file, "\n  ]\n");
+    fprintf(file, "}\n");
+
+    return (ferror(file) == 0);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,126 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_FRAME_TIMING_STATS_H
+#define GFXRECON_DECODE_FRAME_TIMING_STATS_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Collects per-frame replay timings for a range of frames, which may be replayed multiple times.  Frame times are the
+// wall-clock time spent replaying each frame, measured between frame delimiters.  GPU times are reported separately,
+// after the GPU has finished the frame's work.
+class FrameTimingStats
+{
+  public:
+    static const int64_t kNoTime = -1;
+
+    struct Summary
+    {
+        uint32_t count{ 0 };
+        double   min{ 0.0 }; // Milliseconds.
+        double   avg{ 0.0 };
+        double   max{ 0.0 };
+        double   p50{ 0.0 };
+        double   p90{ 0.0 };
+        double   p95{ 0.0 };
+        double   p99{ 0.0 };
+    };
+
+  public:
+    // Frames are numbered from 1.  An end frame of 0 measures all frames through the end of the capture file.
+    FrameTimingStats(uint32_t start_frame, uint32_t end_frame);
+
+    uint32_t GetStartFrame() const { return start_frame_; }
+
+    uint32_t GetEndFrame() const { return end_frame_; }
+
+    bool IsMeasuredFrame(uint32_t frame_number) const
+    {
+        return (frame_number >= start_frame_) && ((end_frame_ == 0) || (frame_number <= end_frame_));
+    }
+
+    // Starts recording a new replay of the measured frame range.
+    void BeginLoop();
+
+    uint32_t GetLoopCount() const { return static_cast<uint32_t>(loops_.size()); }
+
+    // Durations are in nanoseconds.
+    void AddFrameTime(uint32_t frame_number, int64_t duration);
+
+    void AddGpuFrameTime(uint32_t frame_number, int64_t duration);
+
+    // Total number of frames measured across all loops.
+    uint32_t GetMeasuredFrameCount() const;
+
+    // Last frame measured by the most recent loop, or 0 if no frames were measured.
+    uint32_t GetLastMeasuredFrame() const;
+
+    // Sum of the frame times of all measured frames, in nanoseconds.
+    int64_t GetTotalFrameTime() const;
+
+    Summary GetFrameTimeSummary() const { return Summarize(&FrameTimes::frame_time); }
+
+    Summary GetGpuTimeSummary() const { return Summarize(&FrameTimes::gpu_time); }
+
+    void PrintSummary() const;
+
+    // Writes the per-frame timings and summary to the specified file.  Files with a .csv extension are written as
+    // comma-separated values, with one row per frame; all other files are written as JSON.
+    bool WriteReport(const std::string& filename) const;
+
+  private:
+    struct FrameTimes
+    {
+        int64_t frame_time{ kNoTime };
+        int64_t gpu_time{ kNoTime };
+    };
+
+    // Per-frame times for one loop, indexed by frame number relative to the start frame.
+    typedef std::vector<FrameTimes> LoopTimes;
+
+  private:
+    FrameTimes* GetFrameTimes(uint32_t frame_number);
+
+    Summary Summarize(int64_t FrameTimes::*member) const;
+
+    bool WriteCsvReport(FILE* file) const;
+
+    bool WriteJsonReport(FILE* file) const;
+
+  private:
+    uint32_t               start_frame_;
+    uint32_t               end_frame_;
+    std::vector<LoopTimes> loops_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_FRAME_TIMING_STATS_H
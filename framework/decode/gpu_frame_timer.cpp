@@ -0,0 +1,407 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/gpu_frame_timer.h"
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+GpuFrameTimer::GpuFrameTimer(FrameTimingStats* stats) : stats_(stats), current_frame_number_(1)
+{
+    assert(stats != nullptr);
+}
+
+GpuFrameTimer::~GpuFrameTimer()
+{
+    if (!queue_resources_.empty())
+    {
+        GFXRECON_LOG_WARNING("GPU frame timer resources were not destroyed before their devices were destroyed");
+    }
+}
+
+void GpuFrameTimer::BeginFrameWork(const encode::DeviceTable* device_table, VkQueue queue)
+{
+    auto entry = queue_resources_.find(queue);
+
+    if ((entry != queue_resources_.end()) && entry->second.supported &&
+        (entry->second.begin_frame_number != current_frame_number_))
+    {
+        QueueResources* resources = &entry->second;
+        Slot*           slot      = AcquireSlot(device_table, resources);
+
+        if (SubmitCommandBuffer(device_table, queue, slot->begin_command_buffer, VK_NULL_HANDLE) == VK_SUCCESS)
+        {
+            resources->begin_frame_number = current_frame_number_;
+        }
+    }
+}
+
+void GpuFrameTimer::EndFrame(const encode::InstanceTable* instance_table,
+                             const encode::DeviceTable*   device_table,
+                             const DeviceInfo*            device_info,
+                             VkQueue                      queue)
+{
+    assert(device_info != nullptr);
+
+    auto entry = queue_resources_.find(queue);
+
+    if (entry == queue_resources_.end())
+    {
+        QueueResources resources;
+        CreateQueueResources(instance_table, device_table, device_info, queue, &resources);
+        entry = queue_resources_.emplace(queue, resources).first;
+    }
+
+    QueueResources* resources = &entry->second;
+
+    if (resources->supported)
+    {
+        Slot* slot                = AcquireSlot(device_table, resources);
+        slot->frame_number        = current_frame_number_;
+        slot->has_begin_timestamp = (resources->begin_frame_number == current_frame_number_);
+
+        if (SubmitCommandBuffer(device_table, queue, slot->end_command_buffer, slot->fence) == VK_SUCCESS)
+        {
+            slot->pending           = true;
+            resources->current_slot = (resources->current_slot + 1) % kSlotCount;
+        }
+    }
+
+    ++current_frame_number_;
+}
+
+void GpuFrameTimer::DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table)
+{
+    for (auto entry = queue_resources_.begin(); entry != queue_resources_.end();)
+    {
+        QueueResources* resources = &entry->second;
+
+        if (resources->device == device)
+        {
+            // Report pending results in submission order, starting with the oldest slot.
+            for (uint32_t i = 0; i < kSlotCount; ++i)
+            {
+                Slot* slot = &resources->slots[(resources->current_slot + i) % kSlotCount];
+                if (slot->pending)
+                {
+                    CollectSlot(device_table, resources, slot);
+                }
+            }
+
+            DestroyQueueResources(device_table, resources);
+            entry = queue_resources_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+void GpuFrameTimer::CreateQueueResources(const encode::InstanceTable* instance_table,
+                                         const encode::DeviceTable*   device_table,
+                                         const DeviceInfo*            device_info,
+                                         VkQueue                      queue,
+                                         QueueResources*              resources) const
+{
+    assert((instance_table != nullptr) && (device_table != nullptr) && (device_info != nullptr) &&
+           (resources != nullptr));
+
+    VkDevice device    = device_info->handle;
+    resources->device  = device;
+    uint32_t family    = 0;
+    uint32_t bit_count = 0;
+
+    auto family_entry = device_info->queue_family_indices.find(queue);
+    if (family_entry != device_info->queue_family_indices.end())
+    {
+        family = family_entry->second;
+
+        uint32_t family_count = 0;
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(device_info->parent, &family_count, nullptr);
+
+        std::vector<VkQueueFamilyProperties> family_properties(family_count);
+        instance_table->GetPhysicalDeviceQueueFamilyProperties(
+            device_info->parent, &family_count, family_properties.data());
+
+        if (family < family_count)
+        {
+            bit_count = family_properties[family].timestampValidBits;
+        }
+    }
+
+    if (bit_count == 0)
+    {
+        GFXRECON_LOG_WARNING("GPU frame times will not be reported for a present queue that does not support "
+                             "timestamp queries");
+        return;
+    }
+
+    VkPhysicalDeviceProperties properties;
+    instance_table->GetPhysicalDeviceProperties(device_info->parent, &properties);
+
+    resources->timestamp_period = properties.limits.timestampPeriod;
+    resources->timestamp_mask =
+        (bit_count >= 64) ? std::numeric_limits<uint64_t>::max() : ((UINT64_C(1) << bit_count) - 1);
+
+    VkCommandPoolCreateInfo pool_create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    pool_create_info.pNext                   = nullptr;
+    pool_create_info.flags                   = 0;
+    pool_create_info.queueFamilyIndex        = family;
+
+    VkResult result = device_table->CreateCommandPool(device, &pool_create_info, nullptr, &resources->command_pool);
+
+    if (result == VK_SUCCESS)
+    {
+        VkQueryPoolCreateInfo query_create_info = { VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO };
+        query_create_info.pNext                 = nullptr;
+        query_create_info.flags                 = 0;
+        query_create_info.queryType             = VK_QUERY_TYPE_TIMESTAMP;
+        query_create_info.queryCount            = kSlotCount * 2;
+        query_create_info.pipelineStatistics    = 0;
+
+        result = device_table->CreateQueryPool(device, &query_create_info, nullptr, &resources->query_pool);
+    }
+
+    VkCommandBuffer command_buffers[kSlotCount * 2] = {};
+
+    if (result == VK_SUCCESS)
+    {
+        VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        allocate_info.pNext                       = nullptr;
+        allocate_info.commandPool                 = resources->command_pool;
+        allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocate_info.commandBufferCount          = kSlotCount * 2;
+
+        result = device_table->AllocateCommandBuffers(device, &allocate_info, command_buffers);
+    }
+
+    // Each slot has a pair of queries, written by command buffers that are recorded once and submitted each time the
+    // slot is used.  The queries are reset by the command buffers that write them.  A begin command buffer may be
+    // resubmitted before its previous submission completes when the present queue changes, so simultaneous use is
+    // allowed.
+    for (uint32_t i = 0; (i < kSlotCount) && (result == VK_SUCCESS); ++i)
+    {
+        Slot* slot                 = &resources->slots[i];
+        slot->begin_command_buffer = command_buffers[i * 2];
+        slot->end_command_buffer   = command_buffers[(i * 2) + 1];
+
+        VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+        fence_create_info.pNext             = nullptr;
+        fence_create_info.flags             = 0;
+
+        result = device_table->CreateFence(device, &fence_create_info, nullptr, &slot->fence);
+
+        VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+        begin_info.pNext                    = nullptr;
+        begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_SIMULTANEOUS_USE_BIT;
+        begin_info.pInheritanceInfo         = nullptr;
+
+        uint32_t query = i * 2;
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table->BeginCommandBuffer(slot->begin_command_buffer, &begin_info);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            device_table->CmdResetQueryPool(slot->begin_command_buffer, resources->query_pool, query, 1);
+            device_table->CmdWriteTimestamp(
+                slot->begin_command_buffer, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, resources->query_pool, query);
+            result = device_table->EndCommandBuffer(slot->begin_command_buffer);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            result = device_table->BeginCommandBuffer(slot->end_command_buffer, &begin_info);
+        }
+
+        if (result == VK_SUCCESS)
+        {
+            device_table->CmdResetQueryPool(slot->end_command_buffer, resources->query_pool, query + 1, 1);
+            device_table->CmdWriteTimestamp(
+                slot->end_command_buffer, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, resources->query_pool, query + 1);
+            result = device_table->EndCommandBuffer(slot->end_command_buffer);
+        }
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        resources->supported = true;
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to create GPU frame timer resources; GPU frame times will not be reported");
+        DestroyQueueResources(device_table, resources);
+    }
+}
+
+void GpuFrameTimer::DestroyQueueResources(const encode::DeviceTable* device_table, QueueResources* resources) const
+{
+    assert((device_table != nullptr) && (resources != nullptr));
+
+    VkDevice device = resources->device;
+
+    for (uint32_t i = 0; i < kSlotCount; ++i)
+    {
+        if (resources->slots[i].fence != VK_NULL_HANDLE)
+        {
+            device_table->DestroyFence(device, resources->slots[i].fence, nullptr);
+        }
+    }
+
+    if (resources->query_pool != VK_NULL_HANDLE)
+    {
+        device_table->DestroyQueryPool(device, resources->query_pool, nullptr);
+    }
+
+    if (resources->command_pool != VK_NULL_HANDLE)
+    {
+        // Destroying the pool frees its command buffers.
+        device_table->DestroyCommandPool(device, resources->command_pool, nullptr);
+    }
+
+    resources->supported    = false;
+    resources->query_pool   = VK_NULL_HANDLE;
+    resources->command_pool = VK_NULL_HANDLE;
+}
+
+void GpuFrameTimer::CollectSlot(const encode::DeviceTable* device_table, QueueResources* resources, Slot* slot) const
+{
+    assert((device_table != nullptr) && (resources != nullptr) && (slot != nullptr) && slot->pending);
+
+    VkDevice device = resources->device;
+    slot->pending   = false;
+
+    VkResult result =
+        device_table->WaitForFences(device, 1, &slot->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table->ResetFences(device, 1, &slot->fence);
+    }
+
+    // Only retrieve the begin query when it was written for the frame.
+    uint64_t timestamps[2] = { 0, 0 };
+    uint32_t first_query   = static_cast<uint32_t>(slot - resources->slots) * 2;
+    uint32_t query_count   = 2;
+    uint64_t end_timestamp = 0;
+
+    if (!slot->has_begin_timestamp)
+    {
+        first_query += 1;
+        query_count = 1;
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table->GetQueryPoolResults(device,
+                                                   resources->query_pool,
+                                                   first_query,
+                                                   query_count,
+                                                   sizeof(timestamps[0]) * query_count,
+                                                   timestamps,
+                                                   sizeof(timestamps[0]),
+                                                   VK_QUERY_RESULT_64_BIT);
+
+        end_timestamp = timestamps[query_count - 1] & resources->timestamp_mask;
+    }
+
+    if (result == VK_SUCCESS)
+    {
+        uint64_t begin_timestamp = end_timestamp;
+        bool     has_begin       = false;
+
+        if (slot->has_begin_timestamp)
+        {
+            begin_timestamp = timestamps[0] & resources->timestamp_mask;
+            has_begin       = true;
+        }
+
+        // GPU work for the frame cannot start before the work for the previous frame has completed.
+        if (resources->has_previous_end_timestamp &&
+            (!has_begin || (resources->previous_end_timestamp > begin_timestamp)))
+        {
+            begin_timestamp = resources->previous_end_timestamp;
+            has_begin       = true;
+        }
+
+        if (has_begin && (end_timestamp >= begin_timestamp))
+        {
+            double duration = static_cast<double>(end_timestamp - begin_timestamp) * resources->timestamp_period;
+            stats_->AddGpuFrameTime(slot->frame_number, static_cast<int64_t>(duration));
+        }
+
+        resources->previous_end_timestamp     = end_timestamp;
+        resources->has_previous_end_timestamp = true;
+    }
+    else
+    {
+        resources->has_previous_end_timestamp = false;
+    }
+}
+
+GpuFrameTimer::Slot* GpuFrameTimer::AcquireSlot(const encode::DeviceTable* device_table,
+                                                QueueResources*            resources) const
+{
+    assert(resources != nullptr);
+
+    Slot* slot = &resources->slots[resources->current_slot];
+
+    if (slot->pending)
+    {
+        CollectSlot(device_table, resources, slot);
+    }
+
+    return slot;
+}
+
+VkResult GpuFrameTimer::SubmitCommandBuffer(const encode::DeviceTable* device_table,
+                                            VkQueue                    queue,
+                                            VkCommandBuffer            command_buffer,
+                                            VkFence                    fence) const
+{
+    assert(device_table != nullptr);
+
+    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit_info.pNext                = nullptr;
+    submit_info.waitSemaphoreCount   = 0;
+    submit_info.pWaitSemaphores      = nullptr;
+    submit_info.pWaitDstStageMask    = nullptr;
+    submit_info.commandBufferCount   = 1;
+    submit_info.pCommandBuffers      = &command_buffer;
+    submit_info.signalSemaphoreCount = 0;
+    submit_info.pSignalSemaphores    = nullptr;
+
+    return device_table->QueueSubmit(queue, 1, &submit_info, fence);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
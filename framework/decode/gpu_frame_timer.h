@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_GPU_FRAME_TIMER_H
+#define GFXRECON_DECODE_GPU_FRAME_TIMER_H
+
+#include "decode/frame_timing_stats.h"
+#include "decode/vulkan_object_info.h"
+#include "generated/generated_vulkan_dispatch_table.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <unordered_map>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Measures the GPU time of each replayed frame with timestamp queries, which are written by small command buffers that
+// are submitted to the present queue before the first submission of a frame and before each present.  A frame's GPU
+// time is the time between its end timestamp and the later of its start timestamp and the end timestamp of the
+// previous frame.  Query results are retrieved several frames later, to avoid stalling replay, and reported to the
+// FrameTimingStats object.
+class GpuFrameTimer
+{
+  public:
+    GpuFrameTimer(FrameTimingStats* stats);
+
+    ~GpuFrameTimer();
+
+    // Called before work is submitted to a queue, to record the start of the current frame's GPU work.  Only queues
+    // that have previously been used for presentation are timed.
+    void BeginFrameWork(const encode::DeviceTable* device_table, VkQueue queue);
+
+    // Called before a frame is presented, to record the end of the frame's GPU work on the present queue.
+    void EndFrame(const encode::InstanceTable* instance_table,
+                  const encode::DeviceTable*   device_table,
+                  const DeviceInfo*            device_info,
+                  VkQueue                      queue);
+
+    // Reports the results of all pending queries for the device's queues and destroys the device's timer resources.
+    void DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table);
+
+  private:
+    static const uint32_t kSlotCount = 8;
+
+    struct Slot
+    {
+        VkCommandBuffer begin_command_buffer{ VK_NULL_HANDLE };
+        VkCommandBuffer end_command_buffer{ VK_NULL_HANDLE };
+        VkFence         fence{ VK_NULL_HANDLE };
+        uint32_t        frame_number{ 0 };
+        bool            has_begin_timestamp{ false };
+        bool            pending{ false };
+    };
+
+    struct QueueResources
+    {
+        VkDevice      device{ VK_NULL_HANDLE };
+        bool          supported{ false };
+        VkCommandPool command_pool{ VK_NULL_HANDLE };
+        VkQueryPool   query_pool{ VK_NULL_HANDLE };
+        uint64_t      timestamp_mask{ 0 };
+        double        timestamp_period{ 0.0 }; // Nanoseconds per timestamp tick.
+        uint64_t      previous_end_timestamp{ 0 };
+        bool          has_previous_end_timestamp{ false };
+        uint32_t      begin_frame_number{ 0 }; // Frame with a begin timestamp in the current slot.
+        uint32_t      current_slot{ 0 };
+        Slot          slots[kSlotCount];
+    };
+
+  private:
+    void CreateQueueResources(const encode::InstanceTable* instance_table,
+                              const encode::DeviceTable*   device_table,
+                              const DeviceInfo*            device_info,
+                              VkQueue                      queue,
+                              QueueResources*              resources) const;
+
+    void DestroyQueueResources(const encode::DeviceTable* device_table, QueueResources* resources) const;
+
+    // Waits for the slot's timestamps to be written and reports the frame's GPU time.
+    void CollectSlot(const encode::DeviceTable* device_table, QueueResources* resources, Slot* slot) const;
+
+    // Returns the current slot, after retrieving the results of a previous frame that used the slot.
+    Slot* AcquireSlot(const encode::DeviceTable* device_table, QueueResources* resources) const;
+
+    VkResult SubmitCommandBuffer(const encode::DeviceTable* device_table,
+                                 VkQueue                    queue,
+                                 VkCommandBuffer            command_buffer,
+                                 VkFence                    fence) const;
+
+  private:
+    FrameTimingStats*                           stats_;
+    std::unordered_map<VkQueue, QueueResources> queue_resources_;
+    uint32_t                                    current_frame_number_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_GPU_FRAME_TIMER_H
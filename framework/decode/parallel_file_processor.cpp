@@ -0,0 +1,164 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/parallel_file_processor.h"
+
+#include "util/logging.h"
+#include "util/platform.h"
+#include "util/thread_pool.h"
+
+#include <algorithm>
+#include <cassert>
+#include <future>
+#include <thread>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+static uint64_t GetFileSize(const std::string& filename)
+{
+    uint64_t size = 0;
+    FILE*    file = nullptr;
+
+    if ((util::platform::FileOpen(&file, filename.c_str(), "rb") == 0) && (file != nullptr))
+    {
+        if (util::platform::FileSeek(file, 0, util::platform::FileSeekEnd))
+        {
+            int64_t position = util::platform::FileTell(file);
+            if (position > 0)
+            {
+                size = static_cast<uint64_t>(position);
+            }
+        }
+
+        util::platform::FileClose(file);
+    }
+
+    return size;
+}
+
+ParallelFileProcessor::ParallelFileProcessor() :
+    thread_count_(0), end_offset_(0), error_state_(FileProcessor::kErrorInvalidFileDescriptor)
+{}
+
+bool ParallelFileProcessor::Initialize(const std::string& filename, size_t thread_count)
+{
+    if (thread_count == 0)
+    {
+        // hardware_concurrency() may return 0 when the value is not computable.
+        thread_count = std::max<size_t>(static_cast<size_t>(std::thread::hardware_concurrency()), 1);
+    }
+
+    filename_     = filename;
+    thread_count_ = thread_count;
+
+    bool success = scan_processor_.Initialize(filename);
+
+    if (success && !scan_processor_.IsSeekable())
+    {
+        // A streamed capture can only be read once, so it is processed sequentially as a single chunk by the scan
+        // processor.
+        chunk_offsets_.push_back(scan_processor_.GetNumBytesRead());
+    }
+    else if (success)
+    {
+        uint64_t chunk_size = GetFileSize(filename) / (thread_count * kChunksPerThread);
+        if (chunk_size < kMinChunkSize)
+        {
+            chunk_size = kMinChunkSize;
+        }
+
+        success = scan_processor_.ScanBlocks(chunk_size, &chunk_offsets_);
+
+        end_offset_ = scan_processor_.GetNumBytesRead();
+    }
+
+    error_state_ = scan_processor_.GetErrorState();
+
+    return success;
+}
+
+bool ParallelFileProcessor::ProcessChunks(const std::vector<ApiDecoder*>& decoders)
+{
+    assert(decoders.size() == chunk_offsets_.size());
+
+    if (error_state_ != FileProcessor::kErrorNone)
+    {
+        return false;
+    }
+
+    if (!scan_processor_.IsSeekable())
+    {
+        scan_processor_.AddDecoder(decoders[0]);
+        scan_processor_.ProcessAllFrames();
+        scan_processor_.RemoveDecoder(decoders[0]);
+
+        error_state_ = scan_processor_.GetErrorState();
+
+        return (error_state_ == FileProcessor::kErrorNone);
+    }
+
+    std::vector<std::future<FileProcessor::Error>> results;
+    results.reserve(chunk_offsets_.size());
+
+    {
+        util::ThreadPool thread_pool(std::min(thread_count_, chunk_offsets_.size()));
+
+        for (size_t i = 0; i < chunk_offsets_.size(); ++i)
+        {
+            ApiDecoder* decoder      = decoders[i];
+            uint64_t    start_offset = chunk_offsets_[i];
+            uint64_t    end_offset   = ((i + 1) < chunk_offsets_.size()) ? chunk_offsets_[i + 1] : end_offset_;
+
+            auto task = [this, decoder, start_offset, end_offset]() {
+                // The file processor is created and destroyed by the worker thread, so that the thread's decode
+                // allocator instance is released when the chunk is complete.
+                FileProcessor file_processor;
+
+                if (file_processor.Initialize(filename_))
+                {
+                    file_processor.AddDecoder(decoder);
+                    file_processor.ProcessBlockRange(start_offset, end_offset);
+                }
+
+                return file_processor.GetErrorState();
+            };
+
+            results.emplace_back(thread_pool.Submit(task));
+        }
+    }
+
+    for (auto& result : results)
+    {
+        FileProcessor::Error chunk_error = result.get();
+
+        if ((chunk_error != FileProcessor::kErrorNone) && (error_state_ == FileProcessor::kErrorNone))
+        {
+            error_state_ = chunk_error;
+        }
+    }
+
+    return (error_state_ == FileProcessor::kErrorNone);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
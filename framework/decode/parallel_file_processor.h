@@ -0,0 +1,87 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_PARALLEL_FILE_PROCESSOR_H
+#define GFXRECON_DECODE_PARALLEL_FILE_PROCESSOR_H
+
+#include "decode/api_decoder.h"
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Processes a capture file with multiple threads, for read-only analysis tools that gather statistics which can be
+// computed independently for different sections of the file and then combined.  Initialization scans the file's block
+// headers to split the file into chunks at block boundaries.  Each chunk is then read, decompressed, and decoded by a
+// worker thread with its own file processor and decoder.  Blocks are only dispatched to the decoder for the chunk that
+// contains them, so decoders must not depend on state from blocks in other chunks.  Streamed captures, which cannot be
+// seeked, are processed sequentially as a single chunk.
+class ParallelFileProcessor
+{
+  public:
+    ParallelFileProcessor();
+
+    // A thread count of zero creates one worker thread for each hardware thread.
+    bool Initialize(const std::string& filename, size_t thread_count = 0);
+
+    size_t GetChunkCount() const { return chunk_offsets_.size(); }
+
+    size_t GetThreadCount() const { return thread_count_; }
+
+    const format::FileHeader& GetFileHeader() const { return scan_processor_.GetFileHeader(); }
+
+    const std::vector<format::FileOptionPair>& GetFileOptions() const { return scan_processor_.GetFileOptions(); }
+
+    uint32_t GetFrameCount() const { return scan_processor_.GetCurrentFrameNumber(); }
+
+    FileProcessor::Error GetErrorState() const { return error_state_; }
+
+    // Processes each chunk with the decoder at the same index in the decoders vector, which must contain one decoder
+    // for each chunk.  Each decoder is only accessed by the worker thread that processes its chunk.  Returns false if
+    // processing failed for any chunk.
+    bool ProcessChunks(const std::vector<ApiDecoder*>& decoders);
+
+  private:
+    // Chunks are created for multiple chunks per thread, to balance the load for chunks that are slower to process,
+    // with a minimum size that keeps the per-chunk file open and seek costs small relative to processing.
+    static const size_t   kChunksPerThread{ 4 };
+    static const uint64_t kMinChunkSize{ 16 * 1024 * 1024 };
+
+  private:
+    std::string           filename_;
+    size_t                thread_count_;
+    FileProcessor         scan_processor_;
+    std::vector<uint64_t> chunk_offsets_;
+    uint64_t              end_offset_;
+    FileProcessor::Error  error_state_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_PARALLEL_FILE_PROCESSOR_H
@@ -22,38 +22,101 @@
 
 #include "decode/screenshot_handler.h"
 
+#include "util/hash.h"
 #include "util/image_writer.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cinttypes>
 #include <limits>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
-const uint32_t kDefaultQueueFamilyIndex = 0;
-const uint32_t kDefaultQueueIndex       = 0;
-
 const size_t kUnormIndex = 0;
 const size_t kSrgbIndex  = 1;
 
+const uint32_t kImageBpp = 4; // Copy buffers contain 32-bit BGRA data.
+
+// The image writers for all formats expect BGRA data, and convert it to the file's pixel format on the CPU.
 const VkFormat kImageFormats[][2] = {
     // Vulkan image formats for ScreenshotFormat::kBmp
+    { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB },
+    // Vulkan image formats for ScreenshotFormat::kPng
+    { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB },
+    // Vulkan image formats for ScreenshotFormat::kQoi
     { VK_FORMAT_B8G8R8A8_UNORM, VK_FORMAT_B8G8R8A8_SRGB }
 };
 
+const char* kImageFileExtensions[] = { ".bmp", ".png", ".qoi" };
+
+typedef bool (*WriteImageFunc)(const std::string&, uint32_t, uint32_t, uint64_t, const void*);
+
+const WriteImageFunc kImageWriters[] = { util::imagewriter::WriteBmpImage,
+                                         util::imagewriter::WritePngImage,
+                                         util::imagewriter::WriteQoiImage };
+
 ScreenshotHandler::ScreenshotHandler(ScreenshotFormat                    screenshot_format,
                                      const std::vector<ScreenshotRange>& screenshot_ranges) :
     current_frame_number_(1),
-    screenshot_format_(screenshot_format), screenshot_ranges_(screenshot_ranges), current_range_index_(0)
+    screenshot_format_(screenshot_format), screenshot_ranges_(screenshot_ranges), current_range_index_(0),
+    hash_file_(nullptr), hash_tile_size_(0), hash_loop_index_(0),
+    write_pool_(std::make_unique<util::ThreadPool>(kCopySlotCount))
 {}
 
 ScreenshotHandler::ScreenshotHandler(ScreenshotFormat               screenshot_format,
                                      std::vector<ScreenshotRange>&& screenshot_ranges) :
     current_frame_number_(1),
-    screenshot_format_(screenshot_format), screenshot_ranges_(std::move(screenshot_ranges)), current_range_index_(0)
+    screenshot_format_(screenshot_format), screenshot_ranges_(std::move(screenshot_ranges)), current_range_index_(0),
+    hash_file_(nullptr), hash_tile_size_(0), hash_loop_index_(0),
+    write_pool_(std::make_unique<util::ThreadPool>(kCopySlotCount))
 {}
 
+ScreenshotHandler::~ScreenshotHandler()
+{
+    if (!queue_resources_.empty())
+    {
+        GFXRECON_LOG_WARNING("Screenshot resources were not destroyed before their devices were destroyed");
+    }
+
+    if (hash_file_ != nullptr)
+    {
+        WriteHashResults(true);
+        util::platform::FileClose(hash_file_);
+    }
+}
+
+bool ScreenshotHandler::EnableHashing(const std::string& filename, uint32_t tile_size, uint32_t loop_index)
+{
+    int32_t result = util::platform::FileOpen(&hash_file_, filename.c_str(), (loop_index == 0) ? "w" : "a");
+
+    if ((result != 0) || (hash_file_ == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open screenshot hash file %s", filename.c_str());
+        hash_file_ = nullptr;
+        return false;
+    }
+
+    hash_tile_size_  = tile_size;
+    hash_loop_index_ = loop_index;
+
+    // Later loops append to the file written by the first loop, which already has the header.
+    if (loop_index == 0)
+    {
+        fprintf(hash_file_, "# loop frame swapchain width height image_hash");
+        if (tile_size > 0)
+        {
+            fprintf(hash_file_, " tile_hashes(tile_size=%u,row_major)", tile_size);
+        }
+        fprintf(hash_file_, "\n");
+    }
+
+    return true;
+}
+
 void ScreenshotHandler::EndFrame()
 {
     if (current_range_index_ < screenshot_ranges_.size())
@@ -65,6 +128,19 @@ void ScreenshotHandler::EndFrame()
         }
     }
 
+    // Start writing the screenshots from earlier frames that have finished copying, in submission order.
+    for (auto& entry : queue_resources_)
+    {
+        QueueResources* resources = &entry.second;
+
+        for (uint32_t i = 0; i < kCopySlotCount; ++i)
+        {
+            StartWrite(resources, &resources->slots[(resources->current_slot + i) % kCopySlotCount], false);
+        }
+    }
+
+    WriteHashResults(false);
+
     ++current_frame_number_;
 }
 
@@ -83,10 +159,14 @@ bool ScreenshotHandler::IsScreenshotFrame() const
 }
 
 void ScreenshotHandler::WriteImage(const std::string&                      filename_prefix,
+                                   uint32_t                                swapchain_index,
                                    VkDevice                                device,
                                    const encode::DeviceTable*              device_table,
                                    const VkPhysicalDeviceMemoryProperties& memory_properties,
                                    VulkanResourceAllocator*                allocator,
+                                   VkQueue                                 queue,
+                                   uint32_t                                queue_family_index,
+                                   const std::vector<VkSemaphore>&         wait_semaphores,
                                    VkImage                                 image,
                                    VkFormat                                format,
                                    uint32_t                                width,
@@ -98,40 +178,13 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
         return;
     }
 
-    VkResult result = VK_SUCCESS;
-
-    // TODO: Improved queue selection; ensure queue supports transfer operations.
-
-    // Get a command pool for the device.
-    auto copy_resource_entry = copy_resources_.find(device);
-    if (copy_resource_entry == copy_resources_.end())
-    {
-        VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
-        create_info.pNext                   = nullptr;
-        create_info.flags                   = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT;
-        create_info.queueFamilyIndex        = kDefaultQueueFamilyIndex;
-
-        VkCommandPool command_pool = VK_NULL_HANDLE;
-        result                     = device_table->CreateCommandPool(device, &create_info, nullptr, &command_pool);
+    VkResult        result    = VK_SUCCESS;
+    QueueResources* resources = GetQueueResources(device, device_table, allocator, queue, queue_family_index);
 
-        if (result == VK_SUCCESS)
-        {
-            CopyResource copy_resource = {};
-            copy_resource.command_pool = command_pool;
-            copy_resource.allocator    = allocator;
-
-            auto pair           = copy_resources_.emplace(device, std::move(copy_resource));
-            copy_resource_entry = pair.first;
-        }
-    }
-
-    if (result == VK_SUCCESS)
+    if (resources != nullptr)
     {
-        auto&   copy_resource = copy_resource_entry->second;
-        VkQueue queue         = VK_NULL_HANDLE;
-
-        // Get a queue.
-        device_table->GetDeviceQueue(device, kDefaultQueueFamilyIndex, kDefaultQueueIndex, &queue);
+        CopySlot* slot          = AcquireCopySlot(resources);
+        auto&     copy_resource = slot->resource;
 
         // Get a buffer size.
         VkDeviceSize buffer_size     = copy_resource.buffer_size;
@@ -169,32 +222,24 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
         if (result == VK_SUCCESS)
         {
-            // Get a command buffer.
-            VkCommandBuffer command_buffer = VK_NULL_HANDLE;
-
-            VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
-            allocate_info.pNext                       = nullptr;
-            allocate_info.commandPool                 = copy_resource.command_pool;
-            allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
-            allocate_info.commandBufferCount          = 1;
+            // The slot's command buffer was allocated from a pool that allows individual command buffers to be reset,
+            // and is implicitly reset when it is begun.
+            VkCommandBuffer command_buffer = slot->command_buffer;
 
-            result = device_table->AllocateCommandBuffers(device, &allocate_info, &command_buffer);
-            if (result == VK_SUCCESS)
-            {
-                VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
-                begin_info.pNext                    = nullptr;
-                begin_info.flags                    = 0;
-                begin_info.pInheritanceInfo         = nullptr;
+            VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
+            begin_info.pNext                    = nullptr;
+            begin_info.flags                    = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT;
+            begin_info.pInheritanceInfo         = nullptr;
 
-                result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
-            }
+            result = device_table->BeginCommandBuffer(command_buffer, &begin_info);
 
             if (result == VK_SUCCESS)
             {
-                // Transition source image to target to the TRANSFER_DST layout.
+                // Transition source image to target to the TRANSFER_SRC layout, after all previously submitted
+                // writes to the image have completed.
                 VkImageMemoryBarrier image_barrier            = { VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER };
                 image_barrier.pNext                           = nullptr;
-                image_barrier.srcAccessMask                   = 0;
+                image_barrier.srcAccessMask                   = VK_ACCESS_MEMORY_WRITE_BIT;
                 image_barrier.dstAccessMask                   = VK_ACCESS_TRANSFER_READ_BIT;
                 image_barrier.oldLayout                       = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
                 image_barrier.newLayout                       = VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL;
@@ -208,7 +253,7 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                 image_barrier.subresourceRange.levelCount     = 1;
 
                 device_table->CmdPipelineBarrier(command_buffer,
-                                                 VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT,
+                                                 VK_PIPELINE_STAGE_ALL_COMMANDS_BIT,
                                                  VK_PIPELINE_STAGE_TRANSFER_BIT,
                                                  0,
                                                  0,
@@ -217,7 +262,6 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
                                                  nullptr,
                                                  1,
                                                  &image_barrier);
-
                 // The 'copy_image' is the image to be used with the image to buffer copy.
                 VkImage copy_image = image;
                 if (copy_resource.convert_image != VK_NULL_HANDLE)
@@ -341,68 +385,37 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
                 device_table->EndCommandBuffer(command_buffer);
 
-                // Make sure any pending work is finished, as we are not waiting on any semaphores from previous
-                // submissions.
-                result = device_table->DeviceWaitIdle(device);
-
-                if (result == VK_SUCCESS)
-                {
-                    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
-                    submit_info.waitSemaphoreCount   = 0;
-                    submit_info.pWaitSemaphores      = nullptr;
-                    submit_info.pWaitDstStageMask    = nullptr;
-                    submit_info.commandBufferCount   = 1;
-                    submit_info.pCommandBuffers      = &command_buffer;
-                    submit_info.signalSemaphoreCount = 0;
-                    submit_info.pSignalSemaphores    = nullptr;
-
-                    result = device_table->QueueSubmit(queue, 1, &submit_info, VK_NULL_HANDLE);
-                }
-
-                if (result == VK_SUCCESS)
-                {
-                    result = device_table->QueueWaitIdle(queue);
-                }
+                // Wait on the present's semaphores and signal them again when the copy completes, so that the copy is
+                // ordered after the work that rendered the image, including work from other queues, and the present
+                // remains ordered after the copy.
+                std::vector<VkPipelineStageFlags> wait_stages(wait_semaphores.size(),
+                                                              VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+                VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+                submit_info.waitSemaphoreCount   = static_cast<uint32_t>(wait_semaphores.size());
+                submit_info.pWaitSemaphores      = wait_semaphores.data();
+                submit_info.pWaitDstStageMask    = wait_stages.data();
+                submit_info.commandBufferCount   = 1;
+                submit_info.pCommandBuffers      = &command_buffer;
+                submit_info.signalSemaphoreCount = static_cast<uint32_t>(wait_semaphores.size());
+                submit_info.pSignalSemaphores    = wait_semaphores.data();
+
+                result = device_table->QueueSubmit(queue, 1, &submit_info, slot->fence);
+            }
 
-                if (result == VK_SUCCESS)
-                {
-                    void* data = nullptr;
-                    result     = allocator->MapResourceMemoryDirect(
-                        copy_resource.buffer_size, 0, &data, copy_resource.buffer_data);
-
-                    if (result == VK_SUCCESS)
-                    {
-                        if ((copy_resource.memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
-                            VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
-                        {
-                            VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
-                            invalidate_range.pNext               = nullptr;
-                            invalidate_range.memory              = copy_resource.buffer_memory;
-                            invalidate_range.offset              = 0;
-                            invalidate_range.size                = copy_resource.buffer_size;
-
-                            allocator->InvalidateMappedMemoryRangesDirect(
-                                1, &invalidate_range, &copy_resource.buffer_memory_data);
-                        }
-
-                        std::string filename = filename_prefix;
-                        filename += ".bmp";
-
-                        if (!util::imagewriter::WriteBmpImage(filename, width, height, copy_resource.buffer_size, data))
-                        {
-                            GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write file %s",
-                                               filename.c_str());
-                        }
-
-                        allocator->UnmapResourceMemoryDirect(copy_resource.buffer_data);
-                    }
-                }
-                else
-                {
-                    GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
-                }
+            if (result == VK_SUCCESS)
+            {
+                slot->filename = filename_prefix;
+                slot->filename += kImageFileExtensions[static_cast<size_t>(screenshot_format_)];
+                slot->frame_number    = current_frame_number_;
+                slot->swapchain_index = swapchain_index;
+                slot->pending_copy    = true;
 
-                device_table->FreeCommandBuffers(device, copy_resource.command_pool, 1, &command_buffer);
+                resources->current_slot = (resources->current_slot + 1) % kCopySlotCount;
+            }
+            else
+            {
+                GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
             }
         }
         else
@@ -414,19 +427,309 @@ void ScreenshotHandler::WriteImage(const std::string&                      filen
 
 void ScreenshotHandler::DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table)
 {
-    auto entry = copy_resources_.find(device);
-    if (entry != copy_resources_.end())
+    GFXRECON_UNREFERENCED_PARAMETER(device_table);
+
+    for (auto entry = queue_resources_.begin(); entry != queue_resources_.end();)
+    {
+        if (entry->second.device == device)
+        {
+            DestroyQueueResources(&entry->second);
+            entry = queue_resources_.erase(entry);
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+
+    WriteHashResults(true);
+}
+
+ScreenshotHandler::QueueResources* ScreenshotHandler::GetQueueResources(VkDevice                   device,
+                                                                        const encode::DeviceTable* device_table,
+                                                                        VulkanResourceAllocator*   allocator,
+                                                                        VkQueue                    queue,
+                                                                        uint32_t                   queue_family_index)
+{
+    auto entry = queue_resources_.find(queue);
+    if (entry != queue_resources_.end())
+    {
+        return &entry->second;
+    }
+
+    QueueResources* resources = &queue_resources_[queue];
+    resources->device         = device;
+    resources->device_table   = device_table;
+
+    VkCommandPoolCreateInfo create_info = { VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO };
+    create_info.pNext                   = nullptr;
+    create_info.flags                   = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
+    create_info.queueFamilyIndex        = queue_family_index;
+
+    VkResult result = device_table->CreateCommandPool(device, &create_info, nullptr, &resources->command_pool);
+
+    for (uint32_t i = 0; (i < kCopySlotCount) && (result == VK_SUCCESS); ++i)
+    {
+        CopySlot* slot           = &resources->slots[i];
+        slot->resource.allocator = allocator;
+
+        VkCommandBufferAllocateInfo allocate_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO };
+        allocate_info.pNext                       = nullptr;
+        allocate_info.commandPool                 = resources->command_pool;
+        allocate_info.level                       = VK_COMMAND_BUFFER_LEVEL_PRIMARY;
+        allocate_info.commandBufferCount          = 1;
+
+        result = device_table->AllocateCommandBuffers(device, &allocate_info, &slot->command_buffer);
+
+        if (result == VK_SUCCESS)
+        {
+            VkFenceCreateInfo fence_create_info = { VK_STRUCTURE_TYPE_FENCE_CREATE_INFO };
+            fence_create_info.pNext             = nullptr;
+            fence_create_info.flags             = 0;
+
+            result = device_table->CreateFence(device, &fence_create_info, nullptr, &slot->fence);
+        }
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Screenshot could not be created: failed to create a command pool");
+        DestroyQueueResources(resources);
+        queue_resources_.erase(queue);
+        return nullptr;
+    }
+
+    return resources;
+}
+
+void ScreenshotHandler::DestroyQueueResources(QueueResources* resources)
+{
+    assert(resources != nullptr);
+
+    VkDevice                   device       = resources->device;
+    const encode::DeviceTable* device_table = resources->device_table;
+
+    // Start the pending writes in submission order, starting with the oldest slot.
+    for (uint32_t i = 0; i < kCopySlotCount; ++i)
+    {
+        StartWrite(resources, &resources->slots[(resources->current_slot + i) % kCopySlotCount], true);
+    }
+
+    for (uint32_t i = 0; i < kCopySlotCount; ++i)
+    {
+        CopySlot* slot = &resources->slots[i];
+
+        if (slot->write_result.valid())
+        {
+            slot->write_result.wait();
+        }
+
+        if (slot->fence != VK_NULL_HANDLE)
+        {
+            device_table->DestroyFence(device, slot->fence, nullptr);
+            slot->fence = VK_NULL_HANDLE;
+        }
+
+        DestroyCopyResource(device, &slot->resource);
+    }
+
+    if (resources->command_pool != VK_NULL_HANDLE)
+    {
+        // Destroying the pool frees its command buffers.
+        device_table->DestroyCommandPool(device, resources->command_pool, nullptr);
+        resources->command_pool = VK_NULL_HANDLE;
+    }
+}
+
+ScreenshotHandler::CopySlot* ScreenshotHandler::AcquireCopySlot(QueueResources* resources)
+{
+    assert(resources != nullptr);
+
+    CopySlot* slot = &resources->slots[resources->current_slot];
+
+    // The slot's buffer cannot be reused until the previous screenshot has been copied and written to its file.
+    StartWrite(resources, slot, true);
+
+    if (slot->write_result.valid())
+    {
+        slot->write_result.wait();
+    }
+
+    return slot;
+}
+
+void ScreenshotHandler::StartWrite(QueueResources* resources, CopySlot* slot, bool wait)
+{
+    assert((resources != nullptr) && (slot != nullptr));
+
+    if (!slot->pending_copy)
+    {
+        return;
+    }
+
+    VkDevice                   device       = resources->device;
+    const encode::DeviceTable* device_table = resources->device_table;
+    VkResult                   result       = VK_SUCCESS;
+
+    if (wait)
+    {
+        result = device_table->WaitForFences(device, 1, &slot->fence, VK_TRUE, std::numeric_limits<uint64_t>::max());
+    }
+    else
+    {
+        result = device_table->GetFenceStatus(device, slot->fence);
+
+        if (result == VK_NOT_READY)
+        {
+            return;
+        }
+    }
+
+    slot->pending_copy = false;
+
+    if (result == VK_SUCCESS)
+    {
+        result = device_table->ResetFences(device, 1, &slot->fence);
+    }
+
+    if (result != VK_SUCCESS)
+    {
+        GFXRECON_LOG_ERROR("Screenshot could not be created: failed to execute image transfer");
+        return;
+    }
+
+    auto& copy_resource = slot->resource;
+
+    if ((copy_resource.memory_property_flags & VK_MEMORY_PROPERTY_HOST_COHERENT_BIT) !=
+        VK_MEMORY_PROPERTY_HOST_COHERENT_BIT)
+    {
+        VkMappedMemoryRange invalidate_range = { VK_STRUCTURE_TYPE_MAPPED_MEMORY_RANGE };
+        invalidate_range.pNext               = nullptr;
+        invalidate_range.memory              = copy_resource.buffer_memory;
+        invalidate_range.offset              = 0;
+        invalidate_range.size                = copy_resource.buffer_size;
+
+        copy_resource.allocator->InvalidateMappedMemoryRangesDirect(
+            1, &invalidate_range, &copy_resource.buffer_memory_data);
+    }
+
+    // The worker only reads from the mapped buffer, which is not reused or destroyed until the write completes.
+    WriteImageFunc write_func  = kImageWriters[static_cast<size_t>(screenshot_format_)];
+    std::string    filename    = slot->filename;
+    uint32_t       width       = copy_resource.width;
+    uint32_t       height      = copy_resource.height;
+    VkDeviceSize   buffer_size = copy_resource.buffer_size;
+    const void*    data        = copy_resource.buffer_mapped_data;
+
+    if (hash_file_ != nullptr)
+    {
+        uint32_t frame_number    = slot->frame_number;
+        uint32_t swapchain_index = slot->swapchain_index;
+        uint32_t tile_size       = hash_tile_size_;
+
+        slot->write_result = write_pool_
+                                 ->Submit([frame_number, swapchain_index, width, height, tile_size, data]() {
+                                     return HashImage(frame_number,
+                                                      swapchain_index,
+                                                      width,
+                                                      height,
+                                                      tile_size,
+                                                      reinterpret_cast<const uint8_t*>(data));
+                                 })
+                                 .share();
+
+        hash_results_.push_back(slot->write_result);
+    }
+    else
+    {
+        slot->write_result = write_pool_
+                                 ->Submit([write_func, filename, width, height, buffer_size, data]() {
+                                     if (!write_func(filename, width, height, buffer_size, data))
+                                     {
+                                         GFXRECON_LOG_ERROR("Screenshot could not be created: failed to write file %s",
+                                                            filename.c_str());
+                                     }
+
+                                     return std::string();
+                                 })
+                                 .share();
+    }
+}
+
+std::string ScreenshotHandler::HashImage(uint32_t       frame_number,
+                                         uint32_t       swapchain_index,
+                                         uint32_t       width,
+                                         uint32_t       height,
+                                         uint32_t       tile_size,
+                                         const uint8_t* data)
+{
+    // The copy buffer is tightly packed, so the image hash covers the image rows without padding.
+    size_t row_pitch  = static_cast<size_t>(width) * kImageBpp;
+    char   buffer[64] = {};
+
+    snprintf(buffer,
+             sizeof(buffer),
+             "%u %u %u %u %016" PRIx64,
+             frame_number,
+             swapchain_index,
+             width,
+             height,
+             util::hash::Hash64(data, row_pitch * height));
+
+    std::string line = buffer;
+
+    if (tile_size > 0)
     {
-        auto& copy_resource = entry->second;
+        // Each tile hash chains the hashes of the tile's row segments.
+        for (uint32_t tile_y = 0; tile_y < height; tile_y += tile_size)
+        {
+            uint32_t tile_height = std::min(tile_size, height - tile_y);
+
+            for (uint32_t tile_x = 0; tile_x < width; tile_x += tile_size)
+            {
+                size_t   segment_size = static_cast<size_t>(std::min(tile_size, width - tile_x)) * kImageBpp;
+                uint64_t tile_hash    = 0;
 
-        if (device_table != nullptr)
+                for (uint32_t y = tile_y; y < (tile_y + tile_height); ++y)
+                {
+                    tile_hash =
+                        util::hash::Hash64(data + (y * row_pitch) + (tile_x * kImageBpp), segment_size, tile_hash);
+                }
+
+                snprintf(buffer, sizeof(buffer), " %016" PRIx64, tile_hash);
+                line += buffer;
+            }
+        }
+    }
+
+    return line;
+}
+
+void ScreenshotHandler::WriteHashResults(bool wait)
+{
+    if (hash_file_ == nullptr)
+    {
+        return;
+    }
+
+    // Results are written in the order that the hashes were started, which matches the order of the screenshots for
+    // each queue.
+    while (!hash_results_.empty())
+    {
+        auto& result = hash_results_.front();
+
+        if (!wait && (result.wait_for(std::chrono::seconds(0)) != std::future_status::ready))
         {
-            device_table->DestroyCommandPool(entry->first, copy_resource.command_pool, nullptr);
+            break;
         }
 
-        DestroyCopyResource(device, &copy_resource);
+        fprintf(hash_file_, "%u %s\n", hash_loop_index_, result.get().c_str());
+        hash_results_.pop_front();
+    }
 
-        copy_resources_.erase(entry);
+    if (wait)
+    {
+        fflush(hash_file_);
     }
 }
 
@@ -602,6 +905,14 @@ VkResult ScreenshotHandler::CreateCopyResource(VkDevice
                                                    &copy_resource->memory_property_flags);
     }
 
+    if (result == VK_SUCCESS)
+    {
+        // The buffer remains mapped for the lifetime of the copy resource, so that screenshot files can be written by
+        // worker threads without accessing the allocator.
+        result = allocator->MapResourceMemoryDirect(
+            buffer_size, 0, &copy_resource->buffer_mapped_data, copy_resource->buffer_data);
+    }
+
     if ((result == VK_SUCCESS) && (image_format != screenshot_format))
     {
         // The source image format does not match the image file format and requires a format conversion.  Create an
@@ -671,6 +982,12 @@ void ScreenshotHandler::DestroyCopyResource(VkDevice device, CopyResource* copy_
 {
     if (copy_resource != nullptr)
     {
+        if (copy_resource->buffer_mapped_data != nullptr)
+        {
+            copy_resource->allocator->UnmapResourceMemoryDirect(copy_resource->buffer_data);
+            copy_resource->buffer_mapped_data = nullptr;
+        }
+
         if (copy_resource->buffer != VK_NULL_HANDLE)
         {
             copy_resource->allocator->DestroyBufferDirect(copy_resource->buffer, nullptr, copy_resource->buffer_data);
@@ -27,9 +27,14 @@
 #include "decode/vulkan_resource_allocator.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/defines.h"
+#include "util/thread_pool.h"
 
 #include "vulkan/vulkan.h"
 
+#include <cstdio>
+#include <deque>
+#include <future>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -37,6 +42,9 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Writes screenshots without stalling replay.  The image copy for each screenshot is submitted to the present queue
+// with a fence, using a small ring of copy buffers so that the copies for one frame overlap the rendering of the
+// following frames.  When a copy completes, the image file is encoded and written by a worker thread.
 class ScreenshotHandler
 {
   public:
@@ -44,34 +52,53 @@ class ScreenshotHandler
 
     ScreenshotHandler(ScreenshotFormat screenshot_format, std::vector<ScreenshotRange>&& screenshot_ranges);
 
+    ~ScreenshotHandler();
+
+    // Replaces image file output with image hashes, which are written to the specified text file with one line per
+    // screenshot.  When tile_size is not zero, a hash is also written for each tile_size x tile_size region of the
+    // image, in row-major order, to help locate the differences between two replays.  Each line starts with the
+    // replay loop index, which is non-zero when the file is replayed repeatedly with a new handler for each loop.  The
+    // file is created for loop 0 and appended to for later loops, so that the hashes of every loop are kept.
+    bool EnableHashing(const std::string& filename, uint32_t tile_size, uint32_t loop_index = 0);
+
     uint32_t GetCurrentFrame() const { return current_frame_number_; }
 
     void EndFrame();
 
     bool IsScreenshotFrame() const;
 
+    // Submits a copy of the image to the specified queue.  The copy waits on and then re-signals the specified
+    // semaphores, which are the wait semaphores of the present that follows, so that it executes after the image has
+    // been rendered and before the image is presented.
     void WriteImage(const std::string&                      filename_prefix,
+                    uint32_t                                swapchain_index,
                     VkDevice                                device,
                     const encode::DeviceTable*              device_table,
                     const VkPhysicalDeviceMemoryProperties& memory_properties,
                     VulkanResourceAllocator*                allocator,
+                    VkQueue                                 queue,
+                    uint32_t                                queue_family_index,
+                    const std::vector<VkSemaphore>&         wait_semaphores,
                     VkImage                                 image,
                     VkFormat                                format,
                     uint32_t                                width,
                     uint32_t                                height);
 
+    // Waits for the device's pending screenshots to be written before destroying the device's copy resources.
     void DestroyDeviceResources(VkDevice device, const encode::DeviceTable* device_table);
 
   private:
+    static const uint32_t kCopySlotCount = 3;
+
     struct CopyResource
     {
-        VkCommandPool                         command_pool{ VK_NULL_HANDLE };
         VulkanResourceAllocator*              allocator{ nullptr };
         VkDeviceSize                          buffer_size{ 0 };
         VkDeviceMemory                        buffer_memory{ VK_NULL_HANDLE };
         VkBuffer                              buffer{ VK_NULL_HANDLE };
         VulkanResourceAllocator::MemoryData   buffer_memory_data{ 0 };
         VulkanResourceAllocator::ResourceData buffer_data{ 0 };
+        void*                                 buffer_mapped_data{ nullptr }; // Persistently mapped.
         VkDeviceMemory                        convert_image_memory{ VK_NULL_HANDLE };
         VkImage                               convert_image{ VK_NULL_HANDLE };
         VulkanResourceAllocator::MemoryData   convert_image_memory_data{ 0 };
@@ -82,7 +109,28 @@ class ScreenshotHandler
         VkMemoryPropertyFlags                 memory_property_flags{ 0 };
     };
 
-    typedef std::unordered_map<VkDevice, CopyResource> CommandPools;
+    struct CopySlot
+    {
+        CopyResource                    resource;
+        VkCommandBuffer                 command_buffer{ VK_NULL_HANDLE };
+        VkFence                         fence{ VK_NULL_HANDLE };
+        std::string                     filename;
+        uint32_t                        frame_number{ 0 };
+        uint32_t                        swapchain_index{ 0 };
+        bool                            pending_copy{ false }; // Copy was submitted, but the write has not started.
+        std::shared_future<std::string> write_result;          // Valid while the copy is being written or hashed.
+    };
+
+    struct QueueResources
+    {
+        VkDevice                   device{ VK_NULL_HANDLE };
+        const encode::DeviceTable* device_table{ nullptr };
+        VkCommandPool              command_pool{ VK_NULL_HANDLE };
+        uint32_t                   current_slot{ 0 };
+        CopySlot                   slots[kCopySlotCount];
+    };
+
+    typedef std::unordered_map<VkQueue, QueueResources> QueueResourcesMap;
 
   private:
     bool IsSrgbFormat(VkFormat image_format) const;
@@ -99,6 +147,33 @@ class ScreenshotHandler
                                 uint32_t                                type_bits,
                                 VkMemoryPropertyFlags                   property_flags) const;
 
+    QueueResources* GetQueueResources(VkDevice                   device,
+                                      const encode::DeviceTable* device_table,
+                                      VulkanResourceAllocator*   allocator,
+                                      VkQueue                    queue,
+                                      uint32_t                   queue_family_index);
+
+    void DestroyQueueResources(QueueResources* resources);
+
+    // Returns the current slot, after waiting for the screenshot that previously used the slot to be written.
+    CopySlot* AcquireCopySlot(QueueResources* resources);
+
+    // Starts writing the file for a slot with a submitted copy.  When wait is false, the write is only started if the
+    // copy has completed.
+    void StartWrite(QueueResources* resources, CopySlot* slot, bool wait);
+
+    // Returns a hash file line for the image: "frame swapchain width height hash [tile hashes]".
+    static std::string HashImage(uint32_t       frame_number,
+                                 uint32_t       swapchain_index,
+                                 uint32_t       width,
+                                 uint32_t       height,
+                                 uint32_t       tile_size,
+                                 const uint8_t* data);
+
+    // Writes completed hash results to the hash file, in the order that they were started.  When wait is true, all
+    // pending results are written.
+    void WriteHashResults(bool wait);
+
     VkResult CreateCopyResource(VkDevice                                device,
                                 const encode::DeviceTable*              device_table,
                                 const VkPhysicalDeviceMemoryProperties& memory_properties,
@@ -111,11 +186,16 @@ class ScreenshotHandler
     void DestroyCopyResource(VkDevice device, CopyResource* copy_resource) const;
 
   private:
-    uint32_t                     current_frame_number_;
-    CommandPools                 copy_resources_;
-    ScreenshotFormat             screenshot_format_;
-    std::vector<ScreenshotRange> screenshot_ranges_;
-    size_t                       current_range_index_;
+    uint32_t                                    current_frame_number_;
+    QueueResourcesMap                           queue_resources_;
+    ScreenshotFormat                            screenshot_format_;
+    std::vector<ScreenshotRange>                screenshot_ranges_;
+    size_t                                      current_range_index_;
+    FILE*                                       hash_file_;
+    uint32_t                                    hash_tile_size_;
+    uint32_t                                    hash_loop_index_;
+    std::deque<std::shared_future<std::string>> hash_results_;
+    std::unique_ptr<util::ThreadPool>           write_pool_;
 };
 
 GFXRECON_END_NAMESPACE(decode)
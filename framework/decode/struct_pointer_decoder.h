@@ -169,15 +169,18 @@ template <typename T>
 class StructPointerDecoder<T*> : public PointerDecoderBase
 {
   public:
-    StructPointerDecoder() : decoded_structs_(nullptr), struct_memory_(nullptr) {}
+    StructPointerDecoder() : decoded_structs_(nullptr), struct_memory_(nullptr), inner_lengths_(nullptr) {}
 
     T** GetMetaStructPointer() { return decoded_structs_; }
 
-    const T** GetMetaStructPointer() const { return decoded_structs_; }
+    const T* const* GetMetaStructPointer() const { return decoded_structs_; }
 
     typename T::struct_type** GetPointer() { return struct_memory_; }
 
-    const typename T::struct_type** GetPointer() const { return struct_memory_; }
+    const typename T::struct_type* const* GetPointer() const { return struct_memory_; }
+
+    // Returns the length of the array pointed to by the specified element of the outer array.
+    size_t GetInnerLength(size_t index) const { return inner_lengths_[index]; }
 
     size_t Decode(const uint8_t* buffer, size_t buffer_size)
     {
@@ -194,6 +197,7 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
             size_t len       = GetLength();
             struct_memory_   = DecodeAllocator::Allocate<typename T::struct_type*>(len, false);
             decoded_structs_ = DecodeAllocator::Allocate<T*>(len, false);
+            inner_lengths_   = DecodeAllocator::Allocate<size_t>(len);
 
             for (size_t i = 0; i < len; ++i)
             {
@@ -232,6 +236,7 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
 
                     struct_memory_[i]   = inner_struct_memory;
                     decoded_structs_[i] = inner_decoded_structs;
+                    inner_lengths_[i]   = inner_len;
                 }
                 else
                 {
@@ -247,6 +252,7 @@ class StructPointerDecoder<T*> : public PointerDecoderBase
   private:
     T**                       decoded_structs_; ///< Memory to hold decoded data.
     typename T::struct_type** struct_memory_;   ///< Decoded Vulkan structures.
+    size_t*                   inner_lengths_;   ///< Lengths of the arrays pointed to by #decoded_structs_.
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -23,11 +23,56 @@
 
 #include "decode/vulkan_ascii_consumer_base.h"
 
+#include "decode/descriptor_update_template_decoder.h"
+#include "generated/generated_vulkan_struct_to_json.h"
 #include "util/platform.h"
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Descriptor update template data is written as the arrays of descriptor info structures and handles that were
+// extracted from the template data by the decoder.
+static void DescriptorUpdateTemplateToJson(util::JsonWriter& writer, const DescriptorUpdateTemplateDecoder* decoder)
+{
+    if (decoder == nullptr)
+    {
+        writer.Null();
+    }
+    else
+    {
+        const Decoded_VkDescriptorImageInfo*  image_info  = decoder->GetImageInfoMetaStructPointer();
+        const Decoded_VkDescriptorBufferInfo* buffer_info = decoder->GetBufferInfoMetaStructPointer();
+
+        writer.BeginObject();
+
+        writer.Key("imageInfo");
+        writer.BeginArray();
+        for (size_t i = 0; i < decoder->GetImageInfoCount(); ++i)
+        {
+            StructToJson(writer, image_info[i]);
+        }
+        writer.EndArray();
+
+        writer.Key("bufferInfo");
+        writer.BeginArray();
+        for (size_t i = 0; i < decoder->GetBufferInfoCount(); ++i)
+        {
+            StructToJson(writer, buffer_info[i]);
+        }
+        writer.EndArray();
+
+        writer.Key("texelBufferView");
+        ArrayToJson(writer, decoder->GetTexelBufferViewHandleIdsPointer(), decoder->GetTexelBufferViewCount());
+
+        writer.Key("accelerationStructure");
+        ArrayToJson(writer,
+                    decoder->GetAccelerationStructureKHRHandleIdsPointer(),
+                    decoder->GetAccelerationStructureKHRCount());
+
+        writer.EndObject();
+    }
+}
+
 VulkanAsciiConsumerBase::VulkanAsciiConsumerBase() : m_file(nullptr) {}
 
 VulkanAsciiConsumerBase::~VulkanAsciiConsumerBase()
@@ -46,6 +91,7 @@ bool VulkanAsciiConsumerBase::Initialize(const std::string& filename)
         {
             success    = true;
             m_filename = filename;
+            m_writer.SetFile(m_file);
         }
     }
 
@@ -56,20 +102,43 @@ void VulkanAsciiConsumerBase::Destroy()
 {
     if (m_file != nullptr)
     {
+        m_writer.Flush();
+        m_writer.SetFile(nullptr);
+
         util::platform::FileClose(m_file);
+        m_file = nullptr;
     }
 }
 
+util::JsonWriter& VulkanAsciiConsumerBase::WriteApiCallStart(const char* name)
+{
+    m_writer.BeginObject();
+    m_writer.Key("function");
+    m_writer.String(name);
+    m_writer.Key("args");
+    m_writer.BeginObject();
+    return m_writer;
+}
+
+void VulkanAsciiConsumerBase::WriteApiCallEnd()
+{
+    m_writer.EndObject();
+    m_writer.EndObject();
+    m_writer.EndLine();
+}
+
 void VulkanAsciiConsumerBase::Process_vkUpdateDescriptorSetWithTemplate(format::HandleId device,
                                                                         format::HandleId descriptorSet,
                                                                         format::HandleId descriptorUpdateTemplate,
                                                                         DescriptorUpdateTemplateDecoder* pData)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(device);
-    GFXRECON_UNREFERENCED_PARAMETER(descriptorSet);
-    GFXRECON_UNREFERENCED_PARAMETER(descriptorUpdateTemplate);
-    GFXRECON_UNREFERENCED_PARAMETER(pData);
-    fprintf(m_file, "%s\n", "vkUpdateDescriptorSetWithTemplate");
+    util::JsonWriter& writer = WriteApiCallStart("vkUpdateDescriptorSetWithTemplate");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorSet", descriptorSet);
+    FieldToJson(writer, "descriptorUpdateTemplate", descriptorUpdateTemplate);
+    writer.Key("pData");
+    DescriptorUpdateTemplateToJson(writer, pData);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(format::HandleId commandBuffer,
@@ -78,12 +147,14 @@ void VulkanAsciiConsumerBase::Process_vkCmdPushDescriptorSetWithTemplateKHR(form
                                                                             uint32_t         set,
                                                                             DescriptorUpdateTemplateDecoder* pData)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(commandBuffer);
-    GFXRECON_UNREFERENCED_PARAMETER(descriptorUpdateTemplate);
-    GFXRECON_UNREFERENCED_PARAMETER(layout);
-    GFXRECON_UNREFERENCED_PARAMETER(set);
-    GFXRECON_UNREFERENCED_PARAMETER(pData);
-    fprintf(m_file, "%s\n", "vkCmdPushDescriptorSetWithTemplateKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdPushDescriptorSetWithTemplateKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "descriptorUpdateTemplate", descriptorUpdateTemplate);
+    FieldToJson(writer, "layout", layout);
+    FieldToJson(writer, "set", set);
+    writer.Key("pData");
+    DescriptorUpdateTemplateToJson(writer, pData);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(format::HandleId device,
@@ -91,11 +162,13 @@ void VulkanAsciiConsumerBase::Process_vkUpdateDescriptorSetWithTemplateKHR(forma
                                                                            format::HandleId descriptorUpdateTemplate,
                                                                            DescriptorUpdateTemplateDecoder* pData)
 {
-    GFXRECON_UNREFERENCED_PARAMETER(device);
-    GFXRECON_UNREFERENCED_PARAMETER(descriptorSet);
-    GFXRECON_UNREFERENCED_PARAMETER(descriptorUpdateTemplate);
-    GFXRECON_UNREFERENCED_PARAMETER(pData);
-    fprintf(m_file, "%s\n", "vkUpdateDescriptorSetWithTemplateKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkUpdateDescriptorSetWithTemplateKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorSet", descriptorSet);
+    FieldToJson(writer, "descriptorUpdateTemplate", descriptorUpdateTemplate);
+    writer.Key("pData");
+    DescriptorUpdateTemplateToJson(writer, pData);
+    WriteApiCallEnd();
 }
 
 GFXRECON_END_NAMESPACE(decode)
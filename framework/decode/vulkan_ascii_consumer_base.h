@@ -24,9 +24,11 @@
 #ifndef GFXRECON_DECODE_VULKAN_ASCII_CONSUMER_BASE_H
 #define GFXRECON_DECODE_VULKAN_ASCII_CONSUMER_BASE_H
 
+#include "decode/vulkan_json_util.h"
 #include "format/platform_types.h"
 #include "generated/generated_vulkan_consumer.h"
 #include "util/defines.h"
+#include "util/json_writer.h"
 
 #include "vulkan/vulkan.h"
 
@@ -36,6 +38,8 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+// Writes each API call as a single line JSON object, with the function name, the decoded parameters, and the return
+// value, if there is one.  Output is formatted to a buffer that is written to the file when full.
 class VulkanAsciiConsumerBase : public VulkanConsumer
 {
   public:
@@ -49,6 +53,9 @@ class VulkanAsciiConsumerBase : public VulkanConsumer
 
     bool IsValid() const { return (m_file != nullptr); }
 
+    // Returns true if any output has been lost because a write to the file failed.
+    bool HasWriteError() const { return m_writer.HasWriteError(); }
+
     const std::string& GetFilename() const { return m_filename; }
 
     virtual void Process_vkUpdateDescriptorSetWithTemplate(format::HandleId                 device,
@@ -70,9 +77,24 @@ class VulkanAsciiConsumerBase : public VulkanConsumer
   protected:
     FILE* GetFile() const { return m_file; }
 
+    // Writes the start of the JSON object for an API call and returns the writer to use for the call's parameters.
+    util::JsonWriter& WriteApiCallStart(const char* name);
+
+    void WriteApiCallEnd();
+
+    template <typename T>
+    void WriteApiCallEnd(const T& return_value)
+    {
+        m_writer.EndObject();
+        FieldToJson(m_writer, "return", return_value);
+        m_writer.EndObject();
+        m_writer.EndLine();
+    }
+
   private:
-    FILE*       m_file;
-    std::string m_filename;
+    FILE*            m_file;
+    std::string      m_filename;
+    util::JsonWriter m_writer;
 };
 
 GFXRECON_END_NAMESPACE(decode)
@@ -24,6 +24,8 @@
 #ifndef GFXRECON_DECODE_VULKAN_CONSUMER_BASE_H
 #define GFXRECON_DECODE_VULKAN_CONSUMER_BASE_H
 
+#include "format/api_call_id.h"
+#include "format/format.h"
 #include "format/platform_types.h"
 #include "decode/custom_vulkan_struct_decoders.h"
 #include "decode/descriptor_update_template_decoder.h"
@@ -46,6 +48,13 @@ class VulkanConsumerBase
 
     virtual ~VulkanConsumerBase() {}
 
+    // Consumers that only process a subset of the API calls and meta-data commands from a capture file should override
+    // these to report the calls and commands that they process.  The data for blocks that are not of interest to any
+    // consumer is skipped by the file processor without being read or decompressed.
+    virtual bool IsApiCallOfInterest(format::ApiCallId call_id) const { return true; }
+
+    virtual bool IsMetaDataOfInterest(format::MetaDataType meta_type) const { return true; }
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) {}
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) {}
@@ -54,6 +63,10 @@ class VulkanConsumerBase
 
     virtual void ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) {}
 
+    // Returns a pointer that fill memory command data can be written to in place of a ProcessFillMemoryCommand call,
+    // or nullptr if the consumer must process the command.
+    virtual uint8_t* GetFillMemoryDestination(uint64_t memory_id, uint64_t offset) { return nullptr; }
+
     virtual void ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height) {}
 
     virtual void
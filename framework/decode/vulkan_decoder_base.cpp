@@ -30,6 +30,35 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(decode)
 
+bool VulkanDecoderBase::SupportsApiCall(format::ApiCallId call_id)
+{
+    if ((call_id >= format::ApiCallId::ApiCall_vkCreateInstance) && (call_id < format::ApiCallId::ApiCall_VulkanLast))
+    {
+        for (auto consumer : consumers_)
+        {
+            if (consumer->IsApiCallOfInterest(call_id))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool VulkanDecoderBase::SupportsMetaDataType(format::MetaDataType meta_type)
+{
+    for (auto consumer : consumers_)
+    {
+        if (consumer->IsMetaDataOfInterest(meta_type))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void VulkanDecoderBase::DispatchStateBeginMarker(uint64_t frame_number)
 {
     for (auto consumer : consumers_)
@@ -67,6 +96,20 @@ void VulkanDecoderBase::DispatchFillMemoryCommand(
     }
 }
 
+uint8_t* VulkanDecoderBase::GetFillMemoryDestination(format::ThreadId thread_id, uint64_t memory_id, uint64_t offset)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(thread_id);
+
+    // Data written directly to replay memory is not seen by other consumers, so it is only an option for a single
+    // consumer.
+    if (consumers_.size() == 1)
+    {
+        return consumers_[0]->GetFillMemoryDestination(memory_id, offset);
+    }
+
+    return nullptr;
+}
+
 void VulkanDecoderBase::DispatchResizeWindowCommand(format::ThreadId thread_id,
                                                     format::HandleId surface_id,
                                                     uint32_t         width,
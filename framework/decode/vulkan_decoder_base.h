@@ -53,11 +53,10 @@ class VulkanDecoderBase : public ApiDecoder
         consumers_.erase(std::remove(consumers_.begin(), consumers_.end(), consumer));
     }
 
-    virtual bool SupportsApiCall(format::ApiCallId call_id) override
-    {
-        return ((call_id >= format::ApiCallId::ApiCall_vkCreateInstance) &&
-                (call_id < format::ApiCallId::ApiCall_VulkanLast));
-    }
+    // Vulkan API calls and meta-data commands are supported when they are of interest to at least one consumer.
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override;
+
+    virtual bool SupportsMetaDataType(format::MetaDataType meta_type) override;
 
     virtual void DecodeFunctionCall(format::ApiCallId  call_id,
                                     const ApiCallInfo& call_options,
@@ -73,6 +72,8 @@ class VulkanDecoderBase : public ApiDecoder
     virtual void DispatchFillMemoryCommand(
         format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetFillMemoryDestination(format::ThreadId thread_id, uint64_t memory_id, uint64_t offset) override;
+
     virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
                                              format::HandleId surface_id,
                                              uint32_t         width,
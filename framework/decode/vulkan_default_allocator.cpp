@@ -25,6 +25,7 @@
 #include "decode/custom_vulkan_struct_decoders.h"
 #include "decode/vulkan_object_info.h"
 #include "generated/generated_vulkan_struct_decoders.h"
+#include "util/memory_copy.h"
 #include "util/platform.h"
 
 #include <cassert>
@@ -418,7 +419,16 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
 
             size_t copy_size = static_cast<size_t>(size);
 
-            util::platform::MemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
+            if ((memory_alloc_info->property_flags & VK_MEMORY_PROPERTY_HOST_CACHED_BIT) == 0)
+            {
+                // Uncached host visible memory is typically write-combined, and is written most efficiently with
+                // streaming stores.
+                util::memorycopy::NonTemporalCopy(memory_alloc_info->mapped_pointer + offset, data, copy_size);
+            }
+            else
+            {
+                util::platform::MemoryCopy(memory_alloc_info->mapped_pointer + offset, copy_size, data, copy_size);
+            }
 
             result = VK_SUCCESS;
         }
@@ -431,6 +441,23 @@ VkResult VulkanDefaultAllocator::WriteMappedMemoryRange(MemoryData     allocator
     return result;
 }
 
+uint8_t* VulkanDefaultAllocator::GetMappedMemoryRangePointer(MemoryData allocator_data, uint64_t offset)
+{
+    uint8_t* mapped_pointer = nullptr;
+
+    if (allocator_data != 0)
+    {
+        auto memory_alloc_info = reinterpret_cast<MemoryAllocInfo*>(allocator_data);
+
+        if (memory_alloc_info->mapped_pointer != nullptr)
+        {
+            mapped_pointer = memory_alloc_info->mapped_pointer + offset;
+        }
+    }
+
+    return mapped_pointer;
+}
+
 void VulkanDefaultAllocator::ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info)
 {
     if ((allocate_info != nullptr) && (allocate_info->memoryTypeIndex >= memory_properties_.memoryTypeCount))
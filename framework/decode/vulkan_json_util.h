@@ -0,0 +1,311 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_JSON_UTIL_H
+#define GFXRECON_DECODE_VULKAN_JSON_UTIL_H
+
+#include "decode/handle_pointer_decoder.h"
+#include "decode/pnext_node.h"
+#include "decode/pointer_decoder.h"
+#include "decode/string_array_decoder.h"
+#include "decode/string_decoder.h"
+#include "decode/struct_pointer_decoder.h"
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/json_writer.h"
+
+#include <cstdint>
+#include <type_traits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Overloads for writing decoded API call parameters and struct members as JSON values.  Scalars, enums, and flags are
+// written as numbers, handles as their capture IDs, and pointers as null, a single value, or an array, according to how
+// they were encoded.  Structs are written by the StructToJson functions declared in
+// generated_vulkan_struct_to_json.h, which are found through argument dependent lookup.
+
+// Writes the struct at the head of a pNext chain, or null.  Defined in generated_vulkan_struct_to_json.cpp.
+void PNextToJson(util::JsonWriter& writer, const PNextNode* data);
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value>::type
+ValueToJson(util::JsonWriter& writer, T value)
+{
+    writer.Int(static_cast<int64_t>(value));
+}
+
+template <typename T>
+typename std::enable_if<std::is_integral<T>::value && !std::is_signed<T>::value>::type
+ValueToJson(util::JsonWriter& writer, T value)
+{
+    writer.UInt(static_cast<uint64_t>(value));
+}
+
+template <typename T>
+typename std::enable_if<std::is_enum<T>::value>::type ValueToJson(util::JsonWriter& writer, T value)
+{
+    writer.Int(static_cast<int64_t>(value));
+}
+
+inline void ValueToJson(util::JsonWriter& writer, float value)
+{
+    writer.Float(value);
+}
+
+inline void ValueToJson(util::JsonWriter& writer, double value)
+{
+    writer.Double(value);
+}
+
+inline void ValueToJson(util::JsonWriter& writer, const PNextNode* data)
+{
+    PNextToJson(writer, data);
+}
+
+// Decoded struct wrappers.
+template <typename T>
+void ValueToJson(util::JsonWriter& writer, const T* data)
+{
+    if (data != nullptr)
+    {
+        StructToJson(writer, *data);
+    }
+    else
+    {
+        writer.Null();
+    }
+}
+
+template <typename T>
+void ArrayToJson(util::JsonWriter& writer, const T* data, size_t length)
+{
+    writer.BeginArray();
+    for (size_t i = 0; i < length; ++i)
+    {
+        ValueToJson(writer, data[i]);
+    }
+    writer.EndArray();
+}
+
+inline void ArrayToJson(util::JsonWriter& writer, const uint8_t* data, size_t length)
+{
+    writer.HexString(data, length);
+}
+
+// Writes a pointer to a single value as the value, and a pointer to an array as an array.
+template <typename T>
+void PointerToJson(util::JsonWriter& writer, uint32_t attributes, const T* data, size_t length)
+{
+    if ((data == nullptr) || ((attributes & format::PointerAttributes::kHasData) == 0))
+    {
+        writer.Null();
+    }
+    else if ((attributes & format::PointerAttributes::kIsSingle) == format::PointerAttributes::kIsSingle)
+    {
+        ValueToJson(writer, data[0]);
+    }
+    else
+    {
+        ArrayToJson(writer, data, length);
+    }
+}
+
+template <typename T, typename OutputT>
+void ValueToJson(util::JsonWriter& writer, const PointerDecoder<T, OutputT>& data)
+{
+    PointerToJson(writer, data.GetAttributeMask(), data.GetPointer(), data.GetLength());
+}
+
+template <typename T>
+void ValueToJson(util::JsonWriter& writer, const PointerDecoder<T*>& data)
+{
+    const T* const* pointers = data.GetPointer();
+
+    if ((pointers == nullptr) || !data.HasData())
+    {
+        writer.Null();
+    }
+    else
+    {
+        writer.BeginArray();
+        for (size_t i = 0; i < data.GetLength(); ++i)
+        {
+            if (pointers[i] != nullptr)
+            {
+                ArrayToJson(writer, pointers[i], data.GetInnerLength(i));
+            }
+            else
+            {
+                writer.Null();
+            }
+        }
+        writer.EndArray();
+    }
+}
+
+template <typename T>
+void ValueToJson(util::JsonWriter& writer, const StructPointerDecoder<T>& data)
+{
+    const T* structs = data.GetMetaStructPointer();
+
+    if ((structs == nullptr) || !data.HasData())
+    {
+        writer.Null();
+    }
+    else if ((data.GetAttributeMask() & format::PointerAttributes::kIsSingle) == format::PointerAttributes::kIsSingle)
+    {
+        StructToJson(writer, structs[0]);
+    }
+    else
+    {
+        writer.BeginArray();
+        for (size_t i = 0; i < data.GetLength(); ++i)
+        {
+            StructToJson(writer, structs[i]);
+        }
+        writer.EndArray();
+    }
+}
+
+template <typename T>
+void ValueToJson(util::JsonWriter& writer, const StructPointerDecoder<T*>& data)
+{
+    const T* const* structs = data.GetMetaStructPointer();
+
+    if ((structs == nullptr) || !data.HasData())
+    {
+        writer.Null();
+    }
+    else
+    {
+        writer.BeginArray();
+        for (size_t i = 0; i < data.GetLength(); ++i)
+        {
+            if (structs[i] != nullptr)
+            {
+                writer.BeginArray();
+                for (size_t j = 0; j < data.GetInnerLength(i); ++j)
+                {
+                    StructToJson(writer, structs[i][j]);
+                }
+                writer.EndArray();
+            }
+            else
+            {
+                writer.Null();
+            }
+        }
+        writer.EndArray();
+    }
+}
+
+template <typename T>
+void ValueToJson(util::JsonWriter& writer, const HandlePointerDecoder<T>& data)
+{
+    PointerToJson(writer, data.GetAttributeMask(), data.GetPointer(), data.GetLength());
+}
+
+template <typename CharT, typename EncodeT, format::PointerAttributes DecodeAttrib>
+void ValueToJson(util::JsonWriter& writer, const BasicStringDecoder<CharT, EncodeT, DecodeAttrib>& data)
+{
+    const CharT* value = data.GetPointer();
+
+    if (value != nullptr)
+    {
+        writer.String(value);
+    }
+    else
+    {
+        writer.Null();
+    }
+}
+
+template <typename CharT, format::PointerAttributes DecodeAttrib>
+void ValueToJson(util::JsonWriter& writer, const BasicStringArrayDecoder<CharT, DecodeAttrib>& data)
+{
+    const CharT* const* values = data.GetPointer();
+
+    if ((values == nullptr) || !data.HasData())
+    {
+        writer.Null();
+    }
+    else
+    {
+        writer.BeginArray();
+        for (size_t i = 0; i < data.GetLength(); ++i)
+        {
+            if (values[i] != nullptr)
+            {
+                writer.String(values[i]);
+            }
+            else
+            {
+                writer.Null();
+            }
+        }
+        writer.EndArray();
+    }
+}
+
+// API call parameters are decoder pointers.
+template <typename T, typename OutputT>
+void ValueToJson(util::JsonWriter& writer, const PointerDecoder<T, OutputT>* data)
+{
+    (data != nullptr) ? ValueToJson(writer, *data) : writer.Null();
+}
+
+template <typename T>
+void ValueToJson(util::JsonWriter& writer, const StructPointerDecoder<T>* data)
+{
+    (data != nullptr) ? ValueToJson(writer, *data) : writer.Null();
+}
+
+template <typename T>
+void ValueToJson(util::JsonWriter& writer, const HandlePointerDecoder<T>* data)
+{
+    (data != nullptr) ? ValueToJson(writer, *data) : writer.Null();
+}
+
+template <typename CharT, typename EncodeT, format::PointerAttributes DecodeAttrib>
+void ValueToJson(util::JsonWriter& writer, const BasicStringDecoder<CharT, EncodeT, DecodeAttrib>* data)
+{
+    (data != nullptr) ? ValueToJson(writer, *data) : writer.Null();
+}
+
+template <typename CharT, format::PointerAttributes DecodeAttrib>
+void ValueToJson(util::JsonWriter& writer, const BasicStringArrayDecoder<CharT, DecodeAttrib>* data)
+{
+    (data != nullptr) ? ValueToJson(writer, *data) : writer.Null();
+}
+
+template <typename T>
+void FieldToJson(util::JsonWriter& writer, const char* name, const T& value)
+{
+    writer.Key(name);
+    ValueToJson(writer, value);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_JSON_UTIL_H
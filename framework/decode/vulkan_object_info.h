@@ -29,9 +29,11 @@
 #include "format/format.h"
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/defines.h"
+#include "util/monotonic_allocator.h"
 
 #include "vulkan/vulkan.h"
 
+#include <future>
 #include <memory>
 #include <string>
 #include <unordered_map>
@@ -250,6 +252,13 @@ struct DeviceInfo : public VulkanObjectInfo<VkDevice>
     // Feature state at device creation
     VkBool32 feature_bufferDeviceAddressCaptureReplay{ VK_FALSE };
     VkBool32 feature_accelerationStructureCaptureReplay{ VK_FALSE };
+
+    // Pipeline cache that is loaded from and written to the replay pipeline cache directory.
+    VkPipelineCache replay_pipeline_cache{ VK_NULL_HANDLE };
+    std::string     replay_pipeline_cache_file;
+
+    // Queue family index of each queue created with the device, excluding queues created with non-zero flags.
+    std::unordered_map<VkQueue, uint32_t> queue_family_indices;
 };
 
 struct QueueInfo : public VulkanObjectInfo<VkQueue>
@@ -324,9 +333,23 @@ struct PipelineCacheInfo : public VulkanObjectInfo<VkPipelineCache>
     std::unordered_map<uint32_t, size_t> array_counts;
 };
 
+// Shared state for a vkCreate*Pipelines call that is processed asynchronously.  The pipeline handles are written by the
+// creation task, and are valid once the result is ready.
+struct AsyncPipelineCreation
+{
+    std::shared_future<VkResult>              result;
+    std::vector<VkPipeline>                   handles;
+    std::unique_ptr<util::MonotonicAllocator> create_info_memory; // Decoded create info data used by the creation task.
+};
+
 struct PipelineInfo : public VulkanObjectInfo<VkPipeline>
 {
     std::unordered_map<uint32_t, size_t> array_counts;
+
+    // Set for a pipeline that is being created asynchronously, in which case the handle is not valid until the creation
+    // has been resolved by VulkanObjectInfoTable::GetPipelineInfo.
+    std::shared_ptr<AsyncPipelineCreation> async_creation;
+    size_t                                 async_index{ 0 };
 };
 
 struct DescriptorPoolInfo : public VulkanPoolInfo<VkDescriptorPool>
@@ -30,8 +30,10 @@
 
 #include "vulkan/vulkan.h"
 
+#include <atomic>
 #include <cassert>
 #include <functional>
+#include <mutex>
 #include <unordered_map>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -59,7 +61,7 @@ class VulkanObjectInfoTable
     void AddPipelineCacheInfo(PipelineCacheInfo&& info)                                 { AddObjectInfo(std::move(info), &pipeline_cache_map_); }
     void AddPipelineLayoutInfo(PipelineLayoutInfo&& info)                               { AddObjectInfo(std::move(info), &pipeline_layout_map_); }
     void AddRenderPassInfo(RenderPassInfo&& info)                                       { AddObjectInfo(std::move(info), &render_pass_map_); }
-    void AddPipelineInfo(PipelineInfo&& info)                                           { AddObjectInfo(std::move(info), &pipeline_map_); }
+    void AddPipelineInfo(PipelineInfo&& info)                                           { if (info.async_creation) { AddAsyncPipelineInfo(std::move(info)); } else { AddObjectInfo(std::move(info), &pipeline_map_); } }
     void AddDescriptorSetLayoutInfo(DescriptorSetLayoutInfo&& info)                     { AddObjectInfo(std::move(info), &descriptor_set_layout_map_); }
     void AddSamplerInfo(SamplerInfo&& info)                                             { AddObjectInfo(std::move(info), &sampler_map_); }
     void AddDescriptorPoolInfo(DescriptorPoolInfo&& info)                               { AddObjectInfo(std::move(info), &descriptor_pool_map_); }
@@ -141,7 +143,7 @@ class VulkanObjectInfoTable
     const PipelineCacheInfo*                 GetPipelineCacheInfo(format::HandleId id) const                  { return GetObjectInfo<PipelineCacheInfo>(id, &pipeline_cache_map_); }
     const PipelineLayoutInfo*                GetPipelineLayoutInfo(format::HandleId id) const                 { return GetObjectInfo<PipelineLayoutInfo>(id, &pipeline_layout_map_); }
     const RenderPassInfo*                    GetRenderPassInfo(format::HandleId id) const                     { return GetObjectInfo<RenderPassInfo>(id, &render_pass_map_); }
-    const PipelineInfo*                      GetPipelineInfo(format::HandleId id) const                       { return GetObjectInfo<PipelineInfo>(id, &pipeline_map_); }
+    const PipelineInfo*                      GetPipelineInfo(format::HandleId id) const                       { return GetResolvedPipelineInfo(id); }
     const DescriptorSetLayoutInfo*           GetDescriptorSetLayoutInfo(format::HandleId id) const            { return GetObjectInfo<DescriptorSetLayoutInfo>(id, &descriptor_set_layout_map_); }
     const SamplerInfo*                       GetSamplerInfo(format::HandleId id) const                        { return GetObjectInfo<SamplerInfo>(id, &sampler_map_); }
     const DescriptorPoolInfo*                GetDescriptorPoolInfo(format::HandleId id) const                 { return GetObjectInfo<DescriptorPoolInfo>(id, &descriptor_pool_map_); }
@@ -182,7 +184,7 @@ class VulkanObjectInfoTable
     PipelineCacheInfo*                 GetPipelineCacheInfo(format::HandleId id)                  { return GetObjectInfo<PipelineCacheInfo>(id, &pipeline_cache_map_); }
     PipelineLayoutInfo*                GetPipelineLayoutInfo(format::HandleId id)                 { return GetObjectInfo<PipelineLayoutInfo>(id, &pipeline_layout_map_); }
     RenderPassInfo*                    GetRenderPassInfo(format::HandleId id)                     { return GetObjectInfo<RenderPassInfo>(id, &render_pass_map_); }
-    PipelineInfo*                      GetPipelineInfo(format::HandleId id)                       { return GetObjectInfo<PipelineInfo>(id, &pipeline_map_); }
+    PipelineInfo*                      GetPipelineInfo(format::HandleId id)                       { return GetResolvedPipelineInfo(id); }
     DescriptorSetLayoutInfo*           GetDescriptorSetLayoutInfo(format::HandleId id)            { return GetObjectInfo<DescriptorSetLayoutInfo>(id, &descriptor_set_layout_map_); }
     SamplerInfo*                       GetSamplerInfo(format::HandleId id)                        { return GetObjectInfo<SamplerInfo>(id, &sampler_map_); }
     DescriptorPoolInfo*                GetDescriptorPoolInfo(format::HandleId id)                 { return GetObjectInfo<DescriptorPoolInfo>(id, &descriptor_pool_map_); }
@@ -223,7 +225,7 @@ class VulkanObjectInfoTable
     void VisitPipelineCacheInfo(std::function<void(const PipelineCacheInfo*)> visitor) const                                 { for (const auto& entry : pipeline_cache_map_) { visitor(&entry.second); } }
     void VisitPipelineLayoutInfo(std::function<void(const PipelineLayoutInfo*)> visitor) const                               { for (const auto& entry : pipeline_layout_map_) { visitor(&entry.second); } }
     void VisitRenderPassInfo(std::function<void(const RenderPassInfo*)> visitor) const                                       { for (const auto& entry : render_pass_map_) { visitor(&entry.second); } }
-    void VisitPipelineInfo(std::function<void(const PipelineInfo*)> visitor) const                                           { for (const auto& entry : pipeline_map_) { visitor(&entry.second); } }
+    void VisitPipelineInfo(std::function<void(const PipelineInfo*)> visitor) const                                           { for (const auto& entry : pipeline_map_) { visitor(GetResolvedPipelineInfo(entry.first)); } }
     void VisitDescriptorSetLayoutInfo(std::function<void(const DescriptorSetLayoutInfo*)> visitor) const                     { for (const auto& entry : descriptor_set_layout_map_) { visitor(&entry.second); } }
     void VisitSamplerInfo(std::function<void(const SamplerInfo*)> visitor) const                                             { for (const auto& entry : sampler_map_) { visitor(&entry.second); } }
     void VisitDescriptorPoolInfo(std::function<void(const DescriptorPoolInfo*)> visitor) const                               { for (const auto& entry : descriptor_pool_map_) { visitor(&entry.second); } }
@@ -340,6 +342,52 @@ class VulkanObjectInfoTable
         return object_info;
     }
 
+    void AddAsyncPipelineInfo(PipelineInfo&& info)
+    {
+        // The handle for a pipeline that is being created asynchronously is not valid until the creation is resolved.
+        if (info.capture_id != 0)
+        {
+            ++pending_pipeline_count_;
+            pipeline_map_[info.capture_id] = std::move(info);
+        }
+    }
+
+    // Retrieves pipeline info, waiting for the pipeline's asynchronous creation to complete when it is still pending.
+    // Pending pipelines may be resolved by multiple threads when command buffer recording is replayed on worker threads.
+    PipelineInfo* GetResolvedPipelineInfo(format::HandleId id) const
+    {
+        PipelineInfo* object_info = nullptr;
+
+        if (id != 0)
+        {
+            auto entry = pipeline_map_.find(id);
+
+            if (entry != pipeline_map_.end())
+            {
+                object_info = &entry->second;
+
+                if (pending_pipeline_count_ > 0)
+                {
+                    std::lock_guard<std::mutex> lock(pipeline_lock_);
+
+                    if (object_info->async_creation != nullptr)
+                    {
+                        std::shared_ptr<AsyncPipelineCreation> creation = std::move(object_info->async_creation);
+                        object_info->async_creation                     = nullptr;
+                        --pending_pipeline_count_;
+
+                        // Rethrows any exception raised by the creation task, such as from a fatal replay error.
+                        creation->result.get();
+
+                        object_info->handle = creation->handles[object_info->async_index];
+                    }
+                }
+            }
+        }
+
+        return object_info;
+    }
+
   private:
     std::unordered_map<format::HandleId, InstanceInfo>                      instance_map_;
     std::unordered_map<format::HandleId, PhysicalDeviceInfo>                physical_device_map_;
@@ -359,7 +407,6 @@ class VulkanObjectInfoTable
     std::unordered_map<format::HandleId, PipelineCacheInfo>                 pipeline_cache_map_;
     std::unordered_map<format::HandleId, PipelineLayoutInfo>                pipeline_layout_map_;
     std::unordered_map<format::HandleId, RenderPassInfo>                    render_pass_map_;
-    std::unordered_map<format::HandleId, PipelineInfo>                      pipeline_map_;
     std::unordered_map<format::HandleId, DescriptorSetLayoutInfo>           descriptor_set_layout_map_;
     std::unordered_map<format::HandleId, SamplerInfo>                       sampler_map_;
     std::unordered_map<format::HandleId, DescriptorPoolInfo>                descriptor_pool_map_;
@@ -381,6 +428,11 @@ class VulkanObjectInfoTable
     std::unordered_map<format::HandleId, PerformanceConfigurationINTELInfo> performance_configuration_intel_map_;
     std::unordered_map<format::HandleId, DeferredOperationKHRInfo>          deferred_operation_khr_map_;
     std::unordered_map<format::HandleId, PrivateDataSlotEXTInfo>            private_data_slot_ext_map_;
+
+    // Pipeline info is mutable to allow asynchronous pipeline creation to be resolved on retrieval.
+    mutable std::unordered_map<format::HandleId, PipelineInfo> pipeline_map_;
+    mutable std::mutex                                         pipeline_lock_;
+    mutable std::atomic<size_t>                                pending_pipeline_count_{ 0 };
 };
 
 GFXRECON_END_NAMESPACE(decode)
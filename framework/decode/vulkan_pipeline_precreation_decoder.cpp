@@ -0,0 +1,129 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_pipeline_precreation_decoder.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanPipelinePrecreationDecoder::VulkanPipelinePrecreationDecoder(ApiDecoder* decoder) : decoder_(decoder)
+{
+    assert(decoder_ != nullptr);
+}
+
+bool VulkanPipelinePrecreationDecoder::IsPrecreationCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkCreateInstance:
+        case format::ApiCallId::ApiCall_vkDestroyInstance:
+        case format::ApiCallId::ApiCall_vkEnumeratePhysicalDevices:
+        case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroups:
+        case format::ApiCallId::ApiCall_vkEnumeratePhysicalDeviceGroupsKHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2:
+        case format::ApiCallId::ApiCall_vkGetPhysicalDeviceMemoryProperties2KHR:
+        case format::ApiCallId::ApiCall_vkCreateDevice:
+        case format::ApiCallId::ApiCall_vkDestroyDevice:
+        case format::ApiCallId::ApiCall_vkCreateShaderModule:
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+        case format::ApiCallId::ApiCall_vkCreateSampler:
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversion:
+        case format::ApiCallId::ApiCall_vkDestroySamplerYcbcrConversionKHR:
+        case format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkDestroyDescriptorSetLayout:
+        case format::ApiCallId::ApiCall_vkCreatePipelineLayout:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineLayout:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2:
+        case format::ApiCallId::ApiCall_vkCreateRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkDestroyRenderPass:
+        case format::ApiCallId::ApiCall_vkCreatePipelineCache:
+        case format::ApiCallId::ApiCall_vkDestroyPipelineCache:
+        case format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+        case format::ApiCallId::ApiCall_vkCreateComputePipelines:
+        case format::ApiCallId::ApiCall_vkDestroyPipeline:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void VulkanPipelinePrecreationDecoder::DecodeFunctionCall(format::ApiCallId  id,
+                                                          const ApiCallInfo& call_info,
+                                                          const uint8_t*     buffer,
+                                                          size_t             buffer_size)
+{
+    decoder_->DecodeFunctionCall(id, call_info, buffer, buffer_size);
+}
+
+void VulkanPipelinePrecreationDecoder::DispatchStateBeginMarker(uint64_t frame_number)
+{
+    decoder_->DispatchStateBeginMarker(frame_number);
+}
+
+void VulkanPipelinePrecreationDecoder::DispatchStateEndMarker(uint64_t frame_number)
+{
+    decoder_->DispatchStateEndMarker(frame_number);
+}
+
+void VulkanPipelinePrecreationDecoder::DispatchSetDevicePropertiesCommand(
+    format::ThreadId   thread_id,
+    format::HandleId   physical_device_id,
+    uint32_t           api_version,
+    uint32_t           driver_version,
+    uint32_t           vendor_id,
+    uint32_t           device_id,
+    uint32_t           device_type,
+    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+    const std::string& device_name)
+{
+    decoder_->DispatchSetDevicePropertiesCommand(thread_id,
+                                                 physical_device_id,
+                                                 api_version,
+                                                 driver_version,
+                                                 vendor_id,
+                                                 device_id,
+                                                 device_type,
+                                                 pipeline_cache_uuid,
+                                                 device_name);
+}
+
+void VulkanPipelinePrecreationDecoder::DispatchSetDeviceMemoryPropertiesCommand(
+    format::ThreadId                             thread_id,
+    format::HandleId                             physical_device_id,
+    const std::vector<format::DeviceMemoryType>& memory_types,
+    const std::vector<format::DeviceMemoryHeap>& memory_heaps)
+{
+    decoder_->DispatchSetDeviceMemoryPropertiesCommand(thread_id, physical_device_id, memory_types, memory_heaps);
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
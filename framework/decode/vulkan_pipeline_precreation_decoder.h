@@ -0,0 +1,148 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_PIPELINE_PRECREATION_DECODER_H
+#define GFXRECON_DECODE_VULKAN_PIPELINE_PRECREATION_DECODER_H
+
+#include "decode/api_decoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decoder wrapper that only forwards the API calls required to create the shader modules and pipelines from a capture
+// file: instance and device creation, physical device queries, and the creation and destruction of shader modules,
+// samplers, layouts, render passes, pipeline caches, and pipelines.  Used for a pipeline pre-creation pass that
+// processes the capture file before replay.
+class VulkanPipelinePrecreationDecoder : public ApiDecoder
+{
+  public:
+    VulkanPipelinePrecreationDecoder(ApiDecoder* decoder);
+
+    virtual ~VulkanPipelinePrecreationDecoder() override {}
+
+    static bool IsPrecreationCall(format::ApiCallId call_id);
+
+    virtual bool SupportsApiCall(format::ApiCallId id) override
+    {
+        return IsPrecreationCall(id) && decoder_->SupportsApiCall(id);
+    }
+
+    virtual bool SupportsMetaDataType(format::MetaDataType type) override
+    {
+        return ((type == format::MetaDataType::kSetDevicePropertiesCommand) ||
+                (type == format::MetaDataType::kSetDeviceMemoryPropertiesCommand)) &&
+               decoder_->SupportsMetaDataType(type);
+    }
+
+    virtual void DecodeFunctionCall(format::ApiCallId  id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     buffer,
+                                    size_t             buffer_size) override;
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override;
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override;
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId, const std::string&) override {}
+
+    virtual void DispatchFillMemoryCommand(format::ThreadId, uint64_t, uint64_t, uint64_t, const uint8_t*) override {}
+
+    virtual uint8_t* GetFillMemoryDestination(format::ThreadId, uint64_t, uint64_t) override { return nullptr; }
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId, format::HandleId, uint32_t, uint32_t) override {}
+
+    virtual void DispatchResizeWindowCommand2(format::ThreadId, format::HandleId, uint32_t, uint32_t, uint32_t) override
+    {}
+
+    virtual void DispatchCreateHardwareBufferCommand(format::ThreadId,
+                                                     format::HandleId,
+                                                     uint64_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     uint32_t,
+                                                     const std::vector<format::HardwareBufferPlaneInfo>&) override
+    {}
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId, uint64_t) override {}
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override;
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override;
+
+    virtual void
+    DispatchSetOpaqueAddressCommand(format::ThreadId, format::HandleId, format::HandleId, uint64_t) override
+    {}
+
+    virtual void DispatchSetSwapchainImageStateCommand(format::ThreadId,
+                                                       format::HandleId,
+                                                       format::HandleId,
+                                                       uint32_t,
+                                                       const std::vector<format::SwapchainImageStateInfo>&) override
+    {}
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId, format::HandleId, uint64_t, uint64_t) override {}
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId, format::HandleId) override {}
+
+    virtual void
+    DispatchInitBufferCommand(format::ThreadId, format::HandleId, format::HandleId, uint64_t, const uint8_t*) override
+    {}
+
+    virtual void DispatchInitImageCommand(format::ThreadId,
+                                          format::HandleId,
+                                          format::HandleId,
+                                          uint64_t,
+                                          uint32_t,
+                                          uint32_t,
+                                          const std::vector<uint64_t>&,
+                                          const uint8_t*) override
+    {}
+
+  private:
+    ApiDecoder* decoder_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_PIPELINE_PRECREATION_DECODER_H
@@ -280,6 +280,15 @@ VkResult VulkanRealignAllocator::WriteMappedMemoryRange(MemoryData     allocator
     return result;
 }
 
+uint8_t* VulkanRealignAllocator::GetMappedMemoryRangePointer(MemoryData allocator_data, uint64_t offset)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(allocator_data);
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+
+    // Data is relocated to the realigned resource offsets, so it cannot be written directly to the mapped memory.
+    return nullptr;
+}
+
 // Util function to find the matching offset with the resources offsets.
 VkDeviceSize VulkanRealignAllocator::FindMatchingResourceOffset(const TrackedDeviceMemoryInfo* tracked_memory_info,
                                                                 VkDeviceSize                   offset) const
@@ -93,6 +93,8 @@ class VulkanRealignAllocator : public VulkanDefaultAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetMappedMemoryRangePointer(MemoryData allocator_data, uint64_t offset) override;
+
   private:
     // Util function to find the matching offset with the resources offsets.
     VkDeviceSize FindMatchingResourceOffset(const TrackedDeviceMemoryInfo* tracked_memory_info,
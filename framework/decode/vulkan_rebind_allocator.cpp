@@ -819,6 +819,16 @@ VkResult VulkanRebindAllocator::WriteMappedMemoryRange(MemoryData     allocator_
     return result;
 }
 
+uint8_t* VulkanRebindAllocator::GetMappedMemoryRangePointer(MemoryData allocator_data, uint64_t offset)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(allocator_data);
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+
+    // Data is written to the reconstructed memory and copied to each bound resource, so it cannot be written directly
+    // to a single mapped range.
+    return nullptr;
+}
+
 void VulkanRebindAllocator::ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info)
 {
     // The rebind allocator defers allocation until bind and always returns success from vkAllocateMemory, so has no
@@ -142,6 +142,8 @@ class VulkanRebindAllocator : public VulkanResourceAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetMappedMemoryRangePointer(MemoryData allocator_data, uint64_t offset) override;
+
     virtual void ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info) override;
 
     virtual void ReportBindBufferIncompatibility(VkBuffer     buffer,
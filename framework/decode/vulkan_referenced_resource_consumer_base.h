@@ -48,6 +48,9 @@ class VulkanReferencedResourceConsumerBase : public VulkanConsumer
         table_.GetReferencedResourceIds(referenced_ids, unreferenced_ids);
     }
 
+    // Resource references are determined from API calls alone, so the resource data from meta-data commands is skipped.
+    virtual bool IsMetaDataOfInterest(format::MetaDataType) const override { return false; }
+
     virtual void ProcessStateBeginMarker(uint64_t) override { loading_state_ = true; }
 
     virtual void ProcessStateEndMarker(uint64_t) override
@@ -24,6 +24,7 @@
 #include "decode/vulkan_replay_consumer_base.h"
 
 #include "decode/custom_vulkan_struct_handle_mappers.h"
+#include "decode/decode_allocator.h"
 #include "decode/descriptor_update_template_decoder.h"
 #include "decode/resource_util.h"
 #include "decode/vulkan_enum_util.h"
@@ -36,8 +37,13 @@
 #include "util/hash.h"
 #include "util/platform.h"
 
+#include <algorithm>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
+#include <iomanip>
 #include <limits>
+#include <sstream>
 #include <unordered_set>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -111,6 +117,158 @@ static VKAPI_ATTR VkBool32 VKAPI_CALL DebugUtilsCallback(VkDebugUtilsMessageSeve
     return VK_FALSE;
 }
 
+// Surface query replacements for headless replay, where surfaces are VK_NULL_HANDLE and swapchains are backed by plain
+// images.  The reported capabilities accept any swapchain configuration that the captured application may request.
+const VkSurfaceFormatKHR kHeadlessSurfaceFormats[] = { { VK_FORMAT_B8G8R8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR },
+                                                       { VK_FORMAT_B8G8R8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR },
+                                                       { VK_FORMAT_R8G8B8A8_UNORM, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR },
+                                                       { VK_FORMAT_R8G8B8A8_SRGB, VK_COLOR_SPACE_SRGB_NONLINEAR_KHR } };
+
+const VkPresentModeKHR kHeadlessPresentModes[] = { VK_PRESENT_MODE_FIFO_KHR,
+                                                   VK_PRESENT_MODE_IMMEDIATE_KHR,
+                                                   VK_PRESENT_MODE_MAILBOX_KHR };
+
+template <typename T, typename U, size_t N, typename Copy>
+static VkResult EnumerateHeadlessValues(const U (&values)[N], uint32_t* count, T* output, Copy copy)
+{
+    assert(count != nullptr);
+
+    VkResult result = VK_SUCCESS;
+
+    if (output == nullptr)
+    {
+        (*count) = static_cast<uint32_t>(N);
+    }
+    else
+    {
+        uint32_t copy_count = std::min((*count), static_cast<uint32_t>(N));
+        for (uint32_t i = 0; i < copy_count; ++i)
+        {
+            copy(values[i], &output[i]);
+        }
+
+        result   = (copy_count < N) ? VK_INCOMPLETE : VK_SUCCESS;
+        (*count) = copy_count;
+    }
+
+    return result;
+}
+
+static void GetHeadlessSurfaceCapabilities(VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+    assert(pSurfaceCapabilities != nullptr);
+
+    pSurfaceCapabilities->minImageCount       = 1;
+    pSurfaceCapabilities->maxImageCount       = 0;
+    pSurfaceCapabilities->currentExtent       = { 0xFFFFFFFF, 0xFFFFFFFF };
+    pSurfaceCapabilities->minImageExtent      = { 1, 1 };
+    pSurfaceCapabilities->maxImageExtent      = { 16384, 16384 };
+    pSurfaceCapabilities->maxImageArrayLayers = 1;
+    pSurfaceCapabilities->supportedTransforms = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    pSurfaceCapabilities->currentTransform    = VK_SURFACE_TRANSFORM_IDENTITY_BIT_KHR;
+    pSurfaceCapabilities->supportedCompositeAlpha =
+        VK_COMPOSITE_ALPHA_OPAQUE_BIT_KHR | VK_COMPOSITE_ALPHA_INHERIT_BIT_KHR;
+    pSurfaceCapabilities->supportedUsageFlags =
+        VK_IMAGE_USAGE_TRANSFER_SRC_BIT | VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_SAMPLED_BIT |
+        VK_IMAGE_USAGE_STORAGE_BIT | VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_INPUT_ATTACHMENT_BIT;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetHeadlessSurfaceSupport(VkPhysicalDevice physicalDevice,
+                                                                uint32_t         queueFamilyIndex,
+                                                                VkSurfaceKHR     surface,
+                                                                VkBool32*        pSupported)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(physicalDevice);
+    GFXRECON_UNREFERENCED_PARAMETER(queueFamilyIndex);
+    GFXRECON_UNREFERENCED_PARAMETER(surface);
+
+    assert(pSupported != nullptr);
+    (*pSupported) = VK_TRUE;
+
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetHeadlessSurfaceCapabilities(VkPhysicalDevice          physicalDevice,
+                                                                     VkSurfaceKHR              surface,
+                                                                     VkSurfaceCapabilitiesKHR* pSurfaceCapabilities)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(physicalDevice);
+    GFXRECON_UNREFERENCED_PARAMETER(surface);
+
+    GetHeadlessSurfaceCapabilities(pSurfaceCapabilities);
+
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+GetHeadlessSurfaceCapabilities2(VkPhysicalDevice                       physicalDevice,
+                                const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
+                                VkSurfaceCapabilities2KHR*             pSurfaceCapabilities)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(physicalDevice);
+    GFXRECON_UNREFERENCED_PARAMETER(pSurfaceInfo);
+
+    assert(pSurfaceCapabilities != nullptr);
+    GetHeadlessSurfaceCapabilities(&pSurfaceCapabilities->surfaceCapabilities);
+
+    return VK_SUCCESS;
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetHeadlessSurfaceFormats(VkPhysicalDevice    physicalDevice,
+                                                                VkSurfaceKHR        surface,
+                                                                uint32_t*           pSurfaceFormatCount,
+                                                                VkSurfaceFormatKHR* pSurfaceFormats)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(physicalDevice);
+    GFXRECON_UNREFERENCED_PARAMETER(surface);
+
+    return EnumerateHeadlessValues<VkSurfaceFormatKHR>(
+        kHeadlessSurfaceFormats,
+        pSurfaceFormatCount,
+        pSurfaceFormats,
+        [](const VkSurfaceFormatKHR& value, VkSurfaceFormatKHR* output) { (*output) = value; });
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL
+GetHeadlessSurfaceFormats2(VkPhysicalDevice                       physicalDevice,
+                           const VkPhysicalDeviceSurfaceInfo2KHR* pSurfaceInfo,
+                           uint32_t*                              pSurfaceFormatCount,
+                           VkSurfaceFormat2KHR*                   pSurfaceFormats)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(physicalDevice);
+    GFXRECON_UNREFERENCED_PARAMETER(pSurfaceInfo);
+
+    return EnumerateHeadlessValues<VkSurfaceFormat2KHR>(
+        kHeadlessSurfaceFormats,
+        pSurfaceFormatCount,
+        pSurfaceFormats,
+        [](const VkSurfaceFormatKHR& value, VkSurfaceFormat2KHR* output) { output->surfaceFormat = value; });
+}
+
+static VKAPI_ATTR VkResult VKAPI_CALL GetHeadlessSurfacePresentModes(VkPhysicalDevice  physicalDevice,
+                                                                     VkSurfaceKHR      surface,
+                                                                     uint32_t*         pPresentModeCount,
+                                                                     VkPresentModeKHR* pPresentModes)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(physicalDevice);
+    GFXRECON_UNREFERENCED_PARAMETER(surface);
+
+    return EnumerateHeadlessValues<VkPresentModeKHR>(
+        kHeadlessPresentModes,
+        pPresentModeCount,
+        pPresentModes,
+        [](const VkPresentModeKHR& value, VkPresentModeKHR* output) { (*output) = value; });
+}
+
+static VKAPI_ATTR void VKAPI_CALL DestroyHeadlessSurface(VkInstance                   instance,
+                                                        VkSurfaceKHR                 surface,
+                                                        const VkAllocationCallbacks* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(instance);
+    GFXRECON_UNREFERENCED_PARAMETER(surface);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+}
+
 #if defined(VK_USE_PLATFORM_ANDROID_KHR)
 static uint32_t GetHardwareBufferFormatBpp(uint32_t format)
 {
@@ -145,7 +303,7 @@ static uint32_t GetHardwareBufferFormatBpp(uint32_t format)
 VulkanReplayConsumerBase::VulkanReplayConsumerBase(WindowFactory* window_factory, const ReplayOptions& options) :
     loader_handle_(nullptr), get_instance_proc_addr_(nullptr), create_instance_proc_(nullptr),
     window_factory_(window_factory), options_(options), loading_trim_state_(false), have_imported_semaphores_(false),
-    create_surface_count_(0)
+    create_surface_count_(0), pipeline_creation_sequence_(0)
 {
     assert(window_factory != nullptr);
     assert(options.create_resource_allocator != nullptr);
@@ -154,6 +312,13 @@ VulkanReplayConsumerBase::VulkanReplayConsumerBase(WindowFactory* window_factory
     {
         InitializeScreenshotHandler();
     }
+
+    if (options.async_pipeline_creation)
+    {
+        pipeline_thread_pool_ = std::make_unique<util::ThreadPool>();
+        GFXRECON_LOG_INFO("Pipelines will be created asynchronously with %u thread(s)",
+                          static_cast<uint32_t>(pipeline_thread_pool_->GetThreadCount()));
+    }
 }
 
 VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
@@ -166,6 +331,9 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
                              create_surface_count_);
     }
 
+    // Complete pipeline creation and any destroy calls that were deferred while pipeline creation was pending.
+    WaitForPendingPipelineCreations();
+
     // Idle all devices before destroying other resources, and cleanup screenshot resources before destroying device.
     object_info_table_.VisitDeviceInfo([this](const DeviceInfo* info) {
         assert(info != nullptr);
@@ -176,10 +344,17 @@ VulkanReplayConsumerBase::~VulkanReplayConsumerBase()
 
         device_table->DeviceWaitIdle(device);
 
+        WriteReplayPipelineCache(info);
+
         if (screenshot_handler_ != nullptr)
         {
             screenshot_handler_->DestroyDeviceResources(device, device_table);
         }
+
+        if (gpu_frame_timer_ != nullptr)
+        {
+            gpu_frame_timer_->DestroyDeviceResources(device, device_table);
+        }
     });
 
     object_cleanup::FreeAllLiveObjects(
@@ -318,6 +493,21 @@ void VulkanReplayConsumerBase::ProcessFillMemoryCommand(uint64_t       memory_id
     }
 }
 
+uint8_t* VulkanReplayConsumerBase::GetFillMemoryDestination(uint64_t memory_id, uint64_t offset)
+{
+    uint8_t*                destination = nullptr;
+    const DeviceMemoryInfo* memory_info = object_info_table_.GetDeviceMemoryInfo(memory_id);
+
+    // Memory that is not mapped, or that the allocator needs to process the data for, falls back to
+    // ProcessFillMemoryCommand, which also reports fills for unrecognized memory objects.
+    if ((memory_info != nullptr) && (memory_info->allocator != nullptr))
+    {
+        destination = memory_info->allocator->GetMappedMemoryRangePointer(memory_info->allocator_data, offset);
+    }
+
+    return destination;
+}
+
 void VulkanReplayConsumerBase::ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height)
 {
     // We need to find the surface associated with this ID, and then lookup its window.
@@ -625,6 +815,12 @@ void VulkanReplayConsumerBase::ProcessSetSwapchainImageStateCommand(
     const DeviceInfo*       device_info    = object_info_table_.GetDeviceInfo(device_id);
     const SwapchainKHRInfo* swapchain_info = object_info_table_.GetSwapchainKHRInfo(swapchain_id);
 
+    if ((swapchain_info != nullptr) && (swapchain_info->surface == VK_NULL_HANDLE))
+    {
+        // Dummy swapchains, which are not backed by a surface, have no presentation engine state to restore.
+        return;
+    }
+
     if ((device_info != nullptr) && (swapchain_info != nullptr))
     {
         assert((device_info->handle != VK_NULL_HANDLE) && (swapchain_info->handle != VK_NULL_HANDLE));
@@ -1500,6 +1696,18 @@ void VulkanReplayConsumerBase::AddInstanceTable(VkInstance instance)
 
     encode::InstanceTable& table = instance_tables_[dispatch_key];
     encode::LoadInstanceTable(get_instance_proc_addr_, instance, &table);
+
+    if (options_.headless)
+    {
+        // Surfaces are never created for headless replay, so surface queries are answered by replay.
+        table.GetPhysicalDeviceSurfaceSupportKHR       = GetHeadlessSurfaceSupport;
+        table.GetPhysicalDeviceSurfaceCapabilitiesKHR  = GetHeadlessSurfaceCapabilities;
+        table.GetPhysicalDeviceSurfaceCapabilities2KHR = GetHeadlessSurfaceCapabilities2;
+        table.GetPhysicalDeviceSurfaceFormatsKHR       = GetHeadlessSurfaceFormats;
+        table.GetPhysicalDeviceSurfaceFormats2KHR      = GetHeadlessSurfaceFormats2;
+        table.GetPhysicalDeviceSurfacePresentModesKHR  = GetHeadlessSurfacePresentModes;
+        table.DestroySurfaceKHR                        = DestroyHeadlessSurface;
+    }
 }
 
 void VulkanReplayConsumerBase::AddDeviceTable(VkDevice device, PFN_vkGetDeviceProcAddr gpa)
@@ -2278,15 +2486,43 @@ void VulkanReplayConsumerBase::InitializeScreenshotHandler()
     }
 
     screenshot_handler_ = std::make_unique<ScreenshotHandler>(options_.screenshot_format, options_.screenshot_ranges);
+
+    if (!options_.screenshot_hash_file.empty() &&
+        !screenshot_handler_->EnableHashing(
+            options_.screenshot_hash_file, options_.screenshot_hash_tile_size, options_.screenshot_hash_loop_index))
+    {
+        // Do not fall back to writing image files, which could be generated for every frame.
+        screenshot_handler_.reset();
+    }
 }
 
-void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const
+void VulkanReplayConsumerBase::WriteScreenshots(const QueueInfo*                queue_info,
+                                                const Decoded_VkPresentInfoKHR* meta_info) const
 {
-    if ((meta_info != nullptr) && (meta_info->decoded_value != nullptr) && !meta_info->pSwapchains.IsNull())
+    if ((queue_info != nullptr) && (meta_info != nullptr) && (meta_info->decoded_value != nullptr) &&
+        !meta_info->pSwapchains.IsNull())
     {
         auto present_info  = meta_info->decoded_value;
         auto swapchain_ids = meta_info->pSwapchains.GetPointer();
 
+        // The screenshot copies wait on the semaphores that the present waits on, excluding imported and shadow
+        // semaphores, which are never signaled during replay.
+        std::vector<VkSemaphore> wait_semaphores;
+        const format::HandleId*  semaphore_ids = meta_info->pWaitSemaphores.GetPointer();
+
+        if (semaphore_ids != nullptr)
+        {
+            size_t count = meta_info->pWaitSemaphores.GetLength();
+            for (size_t i = 0; i < count; ++i)
+            {
+                const SemaphoreInfo* semaphore_info = object_info_table_.GetSemaphoreInfo(semaphore_ids[i]);
+                if ((semaphore_info != nullptr) && !semaphore_info->is_external && !semaphore_info->shadow_signaled)
+                {
+                    wait_semaphores.push_back(semaphore_info->handle);
+                }
+            }
+        }
+
         for (uint32_t i = 0; i < present_info->swapchainCount; ++i)
         {
             auto swapchain_info = object_info_table_.GetSwapchainKHRInfo(swapchain_ids[i]);
@@ -2295,6 +2531,13 @@ void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR*
                 auto     device_info = swapchain_info->device_info;
                 uint32_t image_index = present_info->pImageIndices[i];
 
+                auto family_entry = device_info->queue_family_indices.find(queue_info->handle);
+                if (family_entry == device_info->queue_family_indices.end())
+                {
+                    GFXRECON_LOG_ERROR("Screenshot could not be created: unrecognized present queue");
+                    continue;
+                }
+
                 auto instance_table = GetInstanceTable(device_info->parent);
                 assert(instance_table != nullptr);
 
@@ -2314,10 +2557,14 @@ void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR*
                 filename_prefix += std::to_string(screenshot_handler_->GetCurrentFrame());
 
                 screenshot_handler_->WriteImage(filename_prefix,
+                                                i,
                                                 device_info->handle,
                                                 GetDeviceTable(device_info->handle),
                                                 memory_properties,
                                                 device_info->allocator.get(),
+                                                queue_info->handle,
+                                                family_entry->second,
+                                                wait_semaphores,
                                                 swapchain_info->images[image_index],
                                                 swapchain_info->format,
                                                 swapchain_info->width,
@@ -2327,6 +2574,281 @@ void VulkanReplayConsumerBase::WriteScreenshots(const Decoded_VkPresentInfoKHR*
     }
 }
 
+void VulkanReplayConsumerBase::CreateReplayPipelineCache(PhysicalDeviceInfo* physical_device_info,
+                                                         DeviceInfo*         device_info)
+{
+    assert((physical_device_info != nullptr) && (device_info != nullptr));
+
+    auto replay_device_info = physical_device_info->replay_device_info;
+    assert(replay_device_info != nullptr);
+
+    if (replay_device_info->properties == nullptr)
+    {
+        auto table = GetInstanceTable(physical_device_info->handle);
+        assert(table != nullptr);
+
+        replay_device_info->properties = std::make_unique<VkPhysicalDeviceProperties>();
+        table->GetPhysicalDeviceProperties(physical_device_info->handle, replay_device_info->properties.get());
+    }
+
+    // The cache file is specific to the capture file, and to the replay device and driver that produced the cache data.
+    const VkPhysicalDeviceProperties* properties = replay_device_info->properties.get();
+    std::stringstream                 file_name;
+
+    file_name << "pipeline_cache_" << options_.capture_file_id << "_" << std::hex << properties->vendorID << "_"
+              << properties->deviceID << "_" << properties->driverVersion << "_";
+
+    for (uint32_t i = 0; i < VK_UUID_SIZE; ++i)
+    {
+        file_name << std::setw(2) << std::setfill('0') << static_cast<uint32_t>(properties->pipelineCacheUUID[i]);
+    }
+
+    file_name << ".bin";
+
+    std::string          file_path = util::filepath::Join(options_.pipeline_cache_dir, file_name.str());
+    std::vector<uint8_t> initial_data;
+    FILE*                file   = nullptr;
+    int32_t              result = util::platform::FileOpen(&file, file_path.c_str(), "rb");
+
+    if ((result == 0) && (file != nullptr))
+    {
+        util::platform::FileSeek(file, 0, util::platform::FileSeekEnd);
+        int64_t file_size = util::platform::FileTell(file);
+        util::platform::FileSeek(file, 0, util::platform::FileSeekSet);
+
+        if (file_size > 0)
+        {
+            initial_data.resize(static_cast<size_t>(file_size));
+
+            if (util::platform::FileRead(initial_data.data(), 1, initial_data.size(), file) != initial_data.size())
+            {
+                GFXRECON_LOG_WARNING("Failed to read pipeline cache data from %s", file_path.c_str());
+                initial_data.clear();
+            }
+        }
+
+        util::platform::FileClose(file);
+    }
+
+    VkPipelineCacheCreateInfo create_info = { VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO };
+    create_info.initialDataSize           = initial_data.size();
+    create_info.pInitialData              = initial_data.empty() ? nullptr : initial_data.data();
+
+    VkDevice        device         = device_info->handle;
+    VkPipelineCache pipeline_cache = VK_NULL_HANDLE;
+
+    if (GetDeviceTable(device)->CreatePipelineCache(device, &create_info, nullptr, &pipeline_cache) == VK_SUCCESS)
+    {
+        device_info->replay_pipeline_cache      = pipeline_cache;
+        device_info->replay_pipeline_cache_file = file_path;
+
+        GFXRECON_LOG_INFO("Using replay pipeline cache %s with %" PRIu64 " bytes of initial data",
+                          file_path.c_str(),
+                          static_cast<uint64_t>(initial_data.size()));
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to create replay pipeline cache; pipelines will be created without a cache");
+    }
+}
+
+void VulkanReplayConsumerBase::WriteReplayPipelineCache(const DeviceInfo* device_info)
+{
+    assert(device_info != nullptr);
+
+    VkDevice        device         = device_info->handle;
+    VkPipelineCache pipeline_cache = device_info->replay_pipeline_cache;
+
+    if (pipeline_cache != VK_NULL_HANDLE)
+    {
+        auto device_table = GetDeviceTable(device);
+        assert(device_table != nullptr);
+
+        // The cache was initialized with the data from the cache file, so the retrieved data contains the stored data
+        // merged with the data for the pipelines created by this replay.
+        size_t   data_size = 0;
+        VkResult result    = device_table->GetPipelineCacheData(device, pipeline_cache, &data_size, nullptr);
+
+        std::vector<uint8_t> data(data_size);
+        if ((result == VK_SUCCESS) && (data_size > 0))
+        {
+            result = device_table->GetPipelineCacheData(device, pipeline_cache, &data_size, data.data());
+        }
+
+        if ((result == VK_SUCCESS) && (data_size > 0))
+        {
+            // Write to a temporary file that replaces the cache file when complete, to avoid leaving a partially
+            // written cache file.
+            const std::string& file_path   = device_info->replay_pipeline_cache_file;
+            std::string        temp_path   = file_path + ".tmp";
+            FILE*              file        = nullptr;
+            int32_t            open_result = util::platform::FileOpen(&file, temp_path.c_str(), "wb");
+
+            if ((open_result == 0) && (file != nullptr))
+            {
+                bool success = (util::platform::FileWrite(data.data(), 1, data_size, file) == data_size);
+                util::platform::FileClose(file);
+
+                if (success)
+                {
+                    std::remove(file_path.c_str());
+                    success = (std::rename(temp_path.c_str(), file_path.c_str()) == 0);
+                }
+
+                if (success)
+                {
+                    GFXRECON_LOG_INFO("Wrote %" PRIu64 " bytes of pipeline cache data to %s",
+                                      static_cast<uint64_t>(data_size),
+                                      file_path.c_str());
+                }
+                else
+                {
+                    GFXRECON_LOG_WARNING("Failed to write pipeline cache data to %s", file_path.c_str());
+                    std::remove(temp_path.c_str());
+                }
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Failed to open pipeline cache file %s for writing", temp_path.c_str());
+            }
+        }
+
+        device_table->DestroyPipelineCache(device, pipeline_cache, nullptr);
+    }
+}
+
+template <typename CreateInfoType, typename CreatePipelinesFunc>
+VkResult VulkanReplayConsumerBase::CreatePipelines(const char*                       func_name,
+                                                   CreatePipelinesFunc               func,
+                                                   VkResult                          original_result,
+                                                   const DeviceInfo*                 device_info,
+                                                   const PipelineCacheInfo*          pipeline_cache_info,
+                                                   uint32_t                          create_info_count,
+                                                   const CreateInfoType*             create_infos,
+                                                   const VkAllocationCallbacks*      allocator,
+                                                   HandlePointerDecoder<VkPipeline>* pPipelines)
+{
+    assert((device_info != nullptr) && (pPipelines != nullptr));
+
+    VkDevice        device         = device_info->handle;
+    VkPipelineCache pipeline_cache = (pipeline_cache_info != nullptr) ? pipeline_cache_info->handle : VK_NULL_HANDLE;
+    VkPipeline*     pipelines      = pPipelines->GetHandlePointer();
+
+    // The replay pipeline cache replaces the application's pipeline cache, so that it receives all pipeline data.
+    if (device_info->replay_pipeline_cache != VK_NULL_HANDLE)
+    {
+        pipeline_cache = device_info->replay_pipeline_cache;
+    }
+
+    // Pipelines are only created asynchronously when all pipelines were successfully created during capture, so that
+    // the capture result can be returned before the replay result is available.
+    if ((pipeline_thread_pool_ == nullptr) || (original_result != VK_SUCCESS) || (pipelines == nullptr) ||
+        (create_info_count == 0))
+    {
+        return func(device, pipeline_cache, create_info_count, create_infos, allocator, pipelines);
+    }
+
+    ProcessPendingPipelineCreations();
+
+    // The decoded create info data is released when the current API call has been processed, so ownership of the data
+    // is transferred to the pipeline creation task.
+    auto creation = std::make_shared<AsyncPipelineCreation>();
+    creation->handles.resize(create_info_count, VK_NULL_HANDLE);
+    creation->create_info_memory = DecodeAllocator::TakeAllocations();
+
+    // The task does not reference the creation state, which holds the task's future.
+    VkPipeline* replay_pipelines = creation->handles.data();
+
+    auto task = [this,
+                 func_name,
+                 func,
+                 original_result,
+                 device,
+                 pipeline_cache,
+                 create_info_count,
+                 create_infos,
+                 allocator,
+                 replay_pipelines]() {
+        VkResult replay_result =
+            func(device, pipeline_cache, create_info_count, create_infos, allocator, replay_pipelines);
+
+        // A fatal error raised here is stored by the task's future, and will be raised again when one of the pipelines
+        // is retrieved from the object info table.
+        CheckResult(func_name, original_result, replay_result);
+
+        return replay_result;
+    };
+
+    creation->result = pipeline_thread_pool_->Submit(std::move(task)).share();
+
+    pending_pipeline_creations_.emplace_back(PendingPipelineCreation{ ++pipeline_creation_sequence_, creation });
+
+    for (uint32_t i = 0; i < create_info_count; ++i)
+    {
+        auto pipeline_info = reinterpret_cast<PipelineInfo*>(pPipelines->GetConsumerData(i));
+        assert(pipeline_info != nullptr);
+
+        pipeline_info->async_creation = creation;
+        pipeline_info->async_index    = i;
+    }
+
+    return original_result;
+}
+
+template <typename HandleType, typename DestroyFunc>
+void VulkanReplayConsumerBase::DestroyPipelineDependency(DestroyFunc                  func,
+                                                         VkDevice                     device,
+                                                         HandleType                   handle,
+                                                         const VkAllocationCallbacks* allocator)
+{
+    if (pipeline_thread_pool_ != nullptr)
+    {
+        ProcessPendingPipelineCreations();
+
+        if (!pending_pipeline_creations_.empty())
+        {
+            auto destroy = [func, device, handle, allocator]() { func(device, handle, allocator); };
+            deferred_pipeline_destroys_.emplace_back(
+                DeferredPipelineDependencyDestroy{ pipeline_creation_sequence_, std::move(destroy) });
+            return;
+        }
+    }
+
+    func(device, handle, allocator);
+}
+
+void VulkanReplayConsumerBase::ProcessPendingPipelineCreations()
+{
+    // Tasks are retired in submission order, so a pending entry may be retained for a short time after its task has
+    // completed when an earlier task is still running.
+    while (!pending_pipeline_creations_.empty() &&
+           (pending_pipeline_creations_.front().creation->result.wait_for(std::chrono::seconds(0)) ==
+            std::future_status::ready))
+    {
+        pending_pipeline_creations_.front().creation->create_info_memory.reset();
+        pending_pipeline_creations_.pop_front();
+    }
+
+    uint64_t completed_sequence = pending_pipeline_creations_.empty()
+                                      ? pipeline_creation_sequence_
+                                      : pending_pipeline_creations_.front().sequence - 1;
+
+    while (!deferred_pipeline_destroys_.empty() && (deferred_pipeline_destroys_.front().sequence <= completed_sequence))
+    {
+        deferred_pipeline_destroys_.front().destroy();
+        deferred_pipeline_destroys_.pop_front();
+    }
+}
+
+void VulkanReplayConsumerBase::WaitForPendingPipelineCreations()
+{
+    if (pipeline_thread_pool_ != nullptr)
+    {
+        pipeline_thread_pool_->WaitIdle();
+        ProcessPendingPipelineCreations();
+    }
+}
+
 VkResult
 VulkanReplayConsumerBase::OverrideCreateInstance(VkResult original_result,
                                                  const StructPointerDecoder<Decoded_VkInstanceCreateInfo>*  pCreateInfo,
@@ -2364,7 +2886,13 @@ VulkanReplayConsumerBase::OverrideCreateInstance(VkResult original_result,
                 const char* current_extension = replay_create_info->ppEnabledExtensionNames[i];
                 if (kSurfaceExtensions.find(current_extension) != kSurfaceExtensions.end())
                 {
-                    filtered_extensions.push_back(window_factory_->GetSurfaceExtensionName());
+                    // Window factories that do not create platform surfaces, such as headless replay, do not report a
+                    // surface extension.
+                    const char* surface_extension = window_factory_->GetSurfaceExtensionName();
+                    if (surface_extension != nullptr)
+                    {
+                        filtered_extensions.push_back(surface_extension);
+                    }
                 }
                 else
                 {
@@ -2528,6 +3056,29 @@ VulkanReplayConsumerBase::OverrideCreateDevice(VkResult            original_resu
             device_info->extensions = std::move(extensions);
             device_info->parent     = physical_device;
 
+            if (modified_create_info.pQueueCreateInfos != nullptr)
+            {
+                // Queue handles do not identify their queue family, so record the family of each queue that was
+                // requested at device creation.
+                auto device_table = GetDeviceTable(*replay_device);
+                assert(device_table != nullptr);
+
+                for (uint32_t i = 0; i < modified_create_info.queueCreateInfoCount; ++i)
+                {
+                    const VkDeviceQueueCreateInfo& queue_create_info = modified_create_info.pQueueCreateInfos[i];
+                    if (queue_create_info.flags == 0)
+                    {
+                        for (uint32_t j = 0; j < queue_create_info.queueCount; ++j)
+                        {
+                            VkQueue queue = VK_NULL_HANDLE;
+                            device_table->GetDeviceQueue(
+                                *replay_device, queue_create_info.queueFamilyIndex, j, &queue);
+                            device_info->queue_family_indices[queue] = queue_create_info.queueFamilyIndex;
+                        }
+                    }
+                }
+            }
+
             // Create the memory allocator for the selected physical device.
             auto replay_device_info = physical_device_info->replay_device_info;
             assert(replay_device_info != nullptr);
@@ -2562,6 +3113,11 @@ VulkanReplayConsumerBase::OverrideCreateDevice(VkResult            original_resu
                 device_info->feature_accelerationStructureCaptureReplay =
                     (*modified_features.accelerationStructureCaptureReplay_ptr);
             }
+
+            if (!options_.pipeline_cache_dir.empty() && !options_.capture_file_id.empty())
+            {
+                CreateReplayPipelineCache(physical_device_info, device_info);
+            }
         }
 
         // Restore modified features to the original application values
@@ -2582,11 +3138,19 @@ void VulkanReplayConsumerBase::OverrideDestroyDevice(
     {
         device = device_info->handle;
 
+        WaitForPendingPipelineCreations();
+        WriteReplayPipelineCache(device_info);
+
         if (screenshot_handler_ != nullptr)
         {
             screenshot_handler_->DestroyDeviceResources(device, GetDeviceTable(device));
         }
 
+        if (gpu_frame_timer_ != nullptr)
+        {
+            gpu_frame_timer_->DestroyDeviceResources(device, GetDeviceTable(device));
+        }
+
         device_info->allocator->Destroy();
     }
 
@@ -3018,10 +3582,15 @@ VkResult VulkanReplayConsumerBase::OverrideQueueSubmit(PFN_vkQueueSubmit func,
         fence = fence_info->handle;
     }
 
+    if (gpu_frame_timer_ != nullptr)
+    {
+        gpu_frame_timer_->BeginFrameWork(GetDeviceTable(queue_info->handle), queue_info->handle);
+    }
+
     // Only attempt to filter imported semaphores if we know at least one has been imported.
-    // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
-    // tracked.
-    if ((!have_imported_semaphores_) && (options_.surface_index == -1))
+    // If dummy swapchains are in use, because rendering is restricted to a specific surface or replay is headless,
+    // shadow semaphore and forward progress state will need to be tracked.
+    if ((!have_imported_semaphores_) && !UseDummySwapchains())
     {
         result = func(queue_info->handle, submitCount, submit_infos, fence);
     }
@@ -3145,9 +3714,9 @@ VulkanReplayConsumerBase::OverrideQueueBindSparse(PFN_vkQueueBindSparse
     }
 
     // Only attempt to filter imported semaphores if we know at least one has been imported.
-    // If rendering is restricted to a specific surface, shadow semaphore and forward progress state will need to be
-    // tracked.
-    if ((!have_imported_semaphores_) && (options_.surface_index == -1))
+    // If dummy swapchains are in use, because rendering is restricted to a specific surface or replay is headless,
+    // shadow semaphore and forward progress state will need to be tracked.
+    if ((!have_imported_semaphores_) && !UseDummySwapchains())
     {
         result = func(queue_info->handle, bindInfoCount, bind_infos, fence);
     }
@@ -4323,6 +4892,19 @@ VkResult VulkanReplayConsumerBase::OverrideCreateShaderModule(
         device_info->handle, &override_info, GetAllocationCallbacks(pAllocator), pShaderModule->GetHandlePointer());
 }
 
+void VulkanReplayConsumerBase::OverrideDestroyShaderModule(
+    PFN_vkDestroyShaderModule                                  func,
+    const DeviceInfo*                                          device_info,
+    const ShaderModuleInfo*                                    shader_module_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkShaderModule shader_module = (shader_module_info != nullptr) ? shader_module_info->handle : VK_NULL_HANDLE;
+
+    DestroyPipelineDependency(func, device_info->handle, shader_module, GetAllocationCallbacks(pAllocator));
+}
+
 VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelineCacheData func,
                                                                 VkResult                   original_result,
                                                                 const DeviceInfo*          device_info,
@@ -4336,6 +4918,9 @@ VkResult VulkanReplayConsumerBase::OverrideGetPipelineCacheData(PFN_vkGetPipelin
     }
     else
     {
+        // Cache data is expected to include the pipelines that were created before the call was captured.
+        WaitForPendingPipelineCreations();
+
         return func(
             device_info->handle, pipeline_cache_info->handle, pDataSize->GetOutputPointer(), pData->GetOutputPointer());
     }
@@ -4377,6 +4962,92 @@ VkResult VulkanReplayConsumerBase::OverrideCreatePipelineCache(
     }
 }
 
+void VulkanReplayConsumerBase::OverrideDestroyPipelineCache(
+    PFN_vkDestroyPipelineCache                                 func,
+    const DeviceInfo*                                          device_info,
+    const PipelineCacheInfo*                                   pipeline_cache_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkPipelineCache pipeline_cache = (pipeline_cache_info != nullptr) ? pipeline_cache_info->handle : VK_NULL_HANDLE;
+
+    DestroyPipelineDependency(func, device_info->handle, pipeline_cache, GetAllocationCallbacks(pAllocator));
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateGraphicsPipelines(
+    PFN_vkCreateGraphicsPipelines                                     func,
+    VkResult                                                          original_result,
+    const DeviceInfo*                                                 device_info,
+    const PipelineCacheInfo*                                          pipeline_cache_info,
+    uint32_t                                                          createInfoCount,
+    const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                 pPipelines)
+{
+    assert(pCreateInfos != nullptr);
+
+    return CreatePipelines("vkCreateGraphicsPipelines",
+                           func,
+                           original_result,
+                           device_info,
+                           pipeline_cache_info,
+                           createInfoCount,
+                           pCreateInfos->GetPointer(),
+                           GetAllocationCallbacks(pAllocator),
+                           pPipelines);
+}
+
+VkResult VulkanReplayConsumerBase::OverrideCreateComputePipelines(
+    PFN_vkCreateComputePipelines                                     func,
+    VkResult                                                         original_result,
+    const DeviceInfo*                                                device_info,
+    const PipelineCacheInfo*                                         pipeline_cache_info,
+    uint32_t                                                         createInfoCount,
+    const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+    HandlePointerDecoder<VkPipeline>*                                pPipelines)
+{
+    assert(pCreateInfos != nullptr);
+
+    return CreatePipelines("vkCreateComputePipelines",
+                           func,
+                           original_result,
+                           device_info,
+                           pipeline_cache_info,
+                           createInfoCount,
+                           pCreateInfos->GetPointer(),
+                           GetAllocationCallbacks(pAllocator),
+                           pPipelines);
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyPipelineLayout(
+    PFN_vkDestroyPipelineLayout                                func,
+    const DeviceInfo*                                          device_info,
+    const PipelineLayoutInfo*                                  pipeline_layout_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkPipelineLayout pipeline_layout =
+        (pipeline_layout_info != nullptr) ? pipeline_layout_info->handle : VK_NULL_HANDLE;
+
+    DestroyPipelineDependency(func, device_info->handle, pipeline_layout, GetAllocationCallbacks(pAllocator));
+}
+
+void VulkanReplayConsumerBase::OverrideDestroyRenderPass(
+    PFN_vkDestroyRenderPass                                    func,
+    const DeviceInfo*                                          device_info,
+    const RenderPassInfo*                                      render_pass_info,
+    const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    assert(device_info != nullptr);
+
+    VkRenderPass render_pass = (render_pass_info != nullptr) ? render_pass_info->handle : VK_NULL_HANDLE;
+
+    DestroyPipelineDependency(func, device_info->handle, render_pass, GetAllocationCallbacks(pAllocator));
+}
+
 VkResult VulkanReplayConsumerBase::OverrideResetDescriptorPool(PFN_vkResetDescriptorPool  func,
                                                                VkResult                   original_result,
                                                                const DeviceInfo*          device_info,
@@ -4522,6 +5193,12 @@ VkResult VulkanReplayConsumerBase::OverrideCreateSwapchainKHR(
         swapchain_info->image_array_layers = replay_create_info->imageArrayLayers;
         swapchain_info->image_usage        = replay_create_info->imageUsage;
         swapchain_info->image_sharing_mode = replay_create_info->imageSharingMode;
+
+        if (screenshot_handler_ != nullptr)
+        {
+            // Screenshots are active, so ensure that the backing images can be used as a transfer source.
+            swapchain_info->image_usage |= VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        }
     }
 
     if ((result == VK_SUCCESS) && (replay_create_info != nullptr) && ((*replay_swapchain) != VK_NULL_HANDLE))
@@ -4658,6 +5335,12 @@ VkResult VulkanReplayConsumerBase::OverrideGetSwapchainImagesKHR(PFN_vkGetSwapch
 
                 // Create a copy of the image info to use for image cleanup when the swapchain is destroyed.
                 swapchain_info->image_infos.push_back(*image_info);
+
+                // Store image handles for screenshot generation.
+                if (screenshot_handler_ != nullptr)
+                {
+                    swapchain_info->images.push_back(*replay_image);
+                }
             }
         }
     }
@@ -4921,16 +5604,30 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
     std::vector<const SemaphoreInfo*> removed_semaphores;
     std::unordered_set<uint32_t>      removed_swapchain_indices;
 
+    if (gpu_frame_timer_ != nullptr)
+    {
+        // Record the end of the frame's GPU work before any screenshot copies are submitted.
+        auto device_info = object_info_table_.GetDeviceInfo(queue_info->parent_id);
+        if (device_info != nullptr)
+        {
+            gpu_frame_timer_->EndFrame(GetInstanceTable(device_info->parent),
+                                       GetDeviceTable(device_info->handle),
+                                       device_info,
+                                       queue_info->handle);
+        }
+    }
+
     if ((screenshot_handler_ != nullptr) && (screenshot_handler_->IsScreenshotFrame()))
     {
         auto meta_info = pPresentInfo->GetMetaStructPointer();
         assert((meta_info != nullptr) && !meta_info->pSwapchains.IsNull());
 
-        WriteScreenshots(meta_info);
+        WriteScreenshots(queue_info, meta_info);
     }
 
-    // If rendering is restricted to a specific surface, need to check for dummy swapchains at present.
-    if (options_.surface_index != -1)
+    // If rendering is restricted to a specific surface or replay is headless, need to check for dummy swapchains at
+    // present.
+    if (UseDummySwapchains())
     {
         const auto swapchain_ids = present_info_data->pSwapchains.GetPointer();
         for (uint32_t i = 0; i < present_info->swapchainCount; ++i)
@@ -5118,8 +5815,8 @@ VulkanReplayConsumerBase::OverrideQueuePresentKHR(PFN_vkQueuePresentKHR
         }
     }
 
-    // If running with surface-index on, need to track forward progress of semaphore that have been submitted
-    if (options_.surface_index != -1)
+    // If running with dummy swapchains, need to track forward progress of semaphore that have been submitted
+    if (UseDummySwapchains())
     {
         if (dispatched_command)
         {
@@ -24,6 +24,8 @@
 #ifndef GFXRECON_DECODE_VULKAN_REPLAY_CONSUMER_BASE_H
 #define GFXRECON_DECODE_VULKAN_REPLAY_CONSUMER_BASE_H
 
+#include "decode/frame_timing_stats.h"
+#include "decode/gpu_frame_timer.h"
 #include "decode/handle_pointer_decoder.h"
 #include "decode/pointer_decoder.h"
 #include "decode/screenshot_handler.h"
@@ -42,11 +44,13 @@
 #include "generated/generated_vulkan_consumer.h"
 #include "util/defines.h"
 #include "util/logging.h"
+#include "util/thread_pool.h"
 
 #include "vulkan/vulkan.h"
 
 #include <algorithm>
 #include <cassert>
+#include <deque>
 #include <functional>
 #include <memory>
 #include <string>
@@ -71,6 +75,12 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void SetFatalErrorHandler(std::function<void(const char*)> handler) { fatal_error_handler_ = handler; }
 
+    // Enables GPU frame timing, which reports per-frame GPU times to the specified stats object.  Must be called before
+    // replay begins.
+    void EnableGpuFrameTiming(FrameTimingStats* stats) { gpu_frame_timer_ = std::make_unique<GpuFrameTimer>(stats); }
+
+    const VulkanObjectInfoTable* GetReplayObjectInfoTable() const { return &object_info_table_; }
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
 
     virtual void ProcessStateEndMarker(uint64_t frame_number) override;
@@ -80,6 +90,8 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     virtual void
     ProcessFillMemoryCommand(uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
 
+    virtual uint8_t* GetFillMemoryDestination(uint64_t memory_id, uint64_t offset) override;
+
     virtual void ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height) override;
 
     virtual void ProcessResizeWindowCommand2(format::HandleId surface_id,
@@ -622,6 +634,11 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                         const StructPointerDecoder<Decoded_VkAllocationCallbacks>*    pAllocator,
                                         HandlePointerDecoder<VkShaderModule>*                         pShaderModule);
 
+    void OverrideDestroyShaderModule(PFN_vkDestroyShaderModule                                  func,
+                                     const DeviceInfo*                                          device_info,
+                                     const ShaderModuleInfo*                                    shader_module_info,
+                                     const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
     VkResult OverrideGetPipelineCacheData(PFN_vkGetPipelineCacheData func,
                                           VkResult                   original_result,
                                           const DeviceInfo*          device_info,
@@ -636,6 +653,41 @@ class VulkanReplayConsumerBase : public VulkanConsumer
                                          const StructPointerDecoder<Decoded_VkAllocationCallbacks>*     pAllocator,
                                          HandlePointerDecoder<VkPipelineCache>*                         pPipelineCache);
 
+    void OverrideDestroyPipelineCache(PFN_vkDestroyPipelineCache                                 func,
+                                      const DeviceInfo*                                          device_info,
+                                      const PipelineCacheInfo*                                   pipeline_cache_info,
+                                      const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    VkResult OverrideCreateGraphicsPipelines(
+        PFN_vkCreateGraphicsPipelines                                     func,
+        VkResult                                                          original_result,
+        const DeviceInfo*                                                 device_info,
+        const PipelineCacheInfo*                                          pipeline_cache_info,
+        uint32_t                                                          createInfoCount,
+        const StructPointerDecoder<Decoded_VkGraphicsPipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*        pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                 pPipelines);
+
+    VkResult OverrideCreateComputePipelines(
+        PFN_vkCreateComputePipelines                                     func,
+        VkResult                                                         original_result,
+        const DeviceInfo*                                                device_info,
+        const PipelineCacheInfo*                                         pipeline_cache_info,
+        uint32_t                                                         createInfoCount,
+        const StructPointerDecoder<Decoded_VkComputePipelineCreateInfo>* pCreateInfos,
+        const StructPointerDecoder<Decoded_VkAllocationCallbacks>*       pAllocator,
+        HandlePointerDecoder<VkPipeline>*                                pPipelines);
+
+    void OverrideDestroyPipelineLayout(PFN_vkDestroyPipelineLayout                                func,
+                                       const DeviceInfo*                                          device_info,
+                                       const PipelineLayoutInfo*                                  pipeline_layout_info,
+                                       const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
+    void OverrideDestroyRenderPass(PFN_vkDestroyRenderPass                                    func,
+                                   const DeviceInfo*                                          device_info,
+                                   const RenderPassInfo*                                      render_pass_info,
+                                   const StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator);
+
     VkResult OverrideResetDescriptorPool(PFN_vkResetDescriptorPool  func,
                                          VkResult                   original_result,
                                          const DeviceInfo*          device_info,
@@ -895,7 +947,43 @@ class VulkanReplayConsumerBase : public VulkanConsumer
 
     void InitializeScreenshotHandler();
 
-    void WriteScreenshots(const Decoded_VkPresentInfoKHR* meta_info) const;
+    // Creates a pipeline cache for the device from the data stored in the replay pipeline cache directory.
+    void CreateReplayPipelineCache(PhysicalDeviceInfo* physical_device_info, DeviceInfo* device_info);
+
+    // Writes the content of the device's replay pipeline cache to the pipeline cache directory and destroys the cache.
+    void WriteReplayPipelineCache(const DeviceInfo* device_info);
+
+    void WriteScreenshots(const QueueInfo* queue_info, const Decoded_VkPresentInfoKHR* meta_info) const;
+
+    // Swapchains are backed by images that are never presented when rendering is restricted to a specific surface or
+    // when replay is headless.
+    bool UseDummySwapchains() const { return (options_.surface_index != -1) || options_.headless; }
+
+    // Creates pipelines with a task on the pipeline thread pool when asynchronous pipeline creation is enabled.  The
+    // pipeline handles are resolved when the pipelines are first retrieved from the object info table.
+    template <typename CreateInfoType, typename CreatePipelinesFunc>
+    VkResult CreatePipelines(const char*                       func_name,
+                             CreatePipelinesFunc               func,
+                             VkResult                          original_result,
+                             const DeviceInfo*                 device_info,
+                             const PipelineCacheInfo*          pipeline_cache_info,
+                             uint32_t                          create_info_count,
+                             const CreateInfoType*             create_infos,
+                             const VkAllocationCallbacks*      allocator,
+                             HandlePointerDecoder<VkPipeline>* pPipelines);
+
+    // Objects that are referenced by pipeline create info cannot be destroyed while a pipeline creation task that was
+    // submitted before the destroy call is pending.  The destroy call is deferred until the tasks have completed.
+    template <typename HandleType, typename DestroyFunc>
+    void DestroyPipelineDependency(DestroyFunc                  func,
+                                   VkDevice                     device,
+                                   HandleType                   handle,
+                                   const VkAllocationCallbacks* allocator);
+
+    // Releases the resources of completed pipeline creation tasks and performs deferred destroy calls.
+    void ProcessPendingPipelineCreations();
+
+    void WaitForPendingPipelineCreations();
 
   private:
     typedef std::unordered_set<Window*> ActiveWindows;
@@ -922,6 +1010,18 @@ class VulkanReplayConsumerBase : public VulkanConsumer
         std::vector<HardwareBufferPlaneInfo> plane_info;
     };
 
+    struct PendingPipelineCreation
+    {
+        uint64_t                               sequence;
+        std::shared_ptr<AsyncPipelineCreation> creation;
+    };
+
+    struct DeferredPipelineDependencyDestroy
+    {
+        uint64_t              sequence; // Sequence number of the last pipeline creation submitted before the destroy.
+        std::function<void()> destroy;
+    };
+
     typedef std::unordered_map<uint64_t, HardwareBufferInfo>               HardwareBufferMap;
     typedef std::unordered_map<format::HandleId, HardwareBufferMemoryInfo> HardwareBufferMemoryMap;
 
@@ -944,8 +1044,13 @@ class VulkanReplayConsumerBase : public VulkanConsumer
     HardwareBufferMap                                                hardware_buffers_;
     HardwareBufferMemoryMap                                          hardware_buffer_memory_info_;
     std::unique_ptr<ScreenshotHandler>                               screenshot_handler_;
+    std::unique_ptr<GpuFrameTimer>                                   gpu_frame_timer_;
     std::string                                                      screenshot_file_prefix_;
     int32_t                                                          create_surface_count_;
+    std::unique_ptr<util::ThreadPool>                                pipeline_thread_pool_;
+    std::deque<PendingPipelineCreation>                              pending_pipeline_creations_;
+    std::deque<DeferredPipelineDependencyDestroy>                    deferred_pipeline_destroys_;
+    uint64_t                                                         pipeline_creation_sequence_;
 
     // Used to track if any shadow sync objects are active to avoid checking if not needed
     std::unordered_set<VkSemaphore> shadow_semaphores_;
@@ -43,7 +43,9 @@ const char kDefaultScreenshotFilePrefix[] = "screenshot";
 
 enum class ScreenshotFormat : uint32_t
 {
-    kBmp = 0
+    kBmp = 0,
+    kPng = 1,
+    kQoi = 2
 };
 
 struct ScreenshotRange
@@ -58,6 +60,8 @@ struct ReplayOptions
     bool                         skip_failed_allocations{ false };
     bool                         omit_pipeline_cache_data{ false };
     bool                         remove_unsupported_features{ false };
+    bool                         async_pipeline_creation{ false };
+    bool                         headless{ false }; // Replay without a window system, using virtual swapchains.
     int32_t                      override_gpu_index{ -1 };
     int32_t                      surface_index{ -1 };
     CreateResourceAllocator      create_resource_allocator;
@@ -65,7 +69,12 @@ struct ReplayOptions
     std::vector<ScreenshotRange> screenshot_ranges;
     std::string                  screenshot_dir;
     std::string                  screenshot_file_prefix{ kDefaultScreenshotFilePrefix };
+    std::string                  screenshot_hash_file; // Write image hashes to this file instead of image files.
+    uint32_t                     screenshot_hash_tile_size{ 0 };
+    uint32_t                     screenshot_hash_loop_index{ 0 }; // Measurement loop that the replay belongs to.
     std::string                  replace_dir;
+    std::string                  pipeline_cache_dir;
+    std::string                  capture_file_id; // Identifies the capture file for the replay pipeline cache.
 };
 
 GFXRECON_END_NAMESPACE(decode)
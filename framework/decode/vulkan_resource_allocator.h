@@ -174,6 +174,11 @@ class VulkanResourceAllocator
     virtual VkResult
     WriteMappedMemoryRange(MemoryData allocator_data, uint64_t offset, uint64_t size, const uint8_t* data) = 0;
 
+    // Returns a pointer to the mapped memory at the specified offset, which replay data can be written to directly in
+    // place of a call to WriteMappedMemoryRange, or nullptr if the allocator must process the data with
+    // WriteMappedMemoryRange.  Offset is relative to the start of the pointer returned by vkMapMemory.
+    virtual uint8_t* GetMappedMemoryRangePointer(MemoryData allocator_data, uint64_t offset) = 0;
+
     virtual void ReportAllocateMemoryIncompatibility(const VkMemoryAllocateInfo* allocate_info) = 0;
 
     virtual void ReportBindBufferIncompatibility(VkBuffer     buffer,
@@ -0,0 +1,558 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "decode/vulkan_threaded_recording_decoder.h"
+
+#include "decode/decode_allocator.h"
+#include "decode/value_decoder.h"
+#include "util/logging.h"
+
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+VulkanThreadedRecordingDecoder::VulkanThreadedRecordingDecoder(ApiDecoder*                  decoder,
+                                                               const VulkanObjectInfoTable* object_info_table) :
+    decoder_(decoder), object_info_table_(object_info_table), workers_active_(false)
+{
+    assert((decoder_ != nullptr) && (object_info_table_ != nullptr));
+}
+
+VulkanThreadedRecordingDecoder::~VulkanThreadedRecordingDecoder()
+{
+    StopWorkers();
+}
+
+void VulkanThreadedRecordingDecoder::Synchronize()
+{
+    if (workers_active_)
+    {
+        std::exception_ptr error;
+
+        for (auto& entry : workers_)
+        {
+            Worker*                      worker = entry.second.get();
+            std::unique_lock<std::mutex> lock(worker->lock);
+
+            worker->idle_condition.wait(lock, [worker]() { return worker->queue.empty() && !worker->busy; });
+
+            if (worker->error && !error)
+            {
+                error = worker->error;
+            }
+
+            worker->error = nullptr;
+        }
+
+        workers_active_ = false;
+
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void VulkanThreadedRecordingDecoder::DecodeFunctionCall(format::ApiCallId  call_id,
+                                                        const ApiCallInfo& call_info,
+                                                        const uint8_t*     buffer,
+                                                        size_t             buffer_size)
+{
+    if (IsRecordingCall(call_id))
+    {
+        // The first parameter of every recording call is the command buffer.
+        format::HandleId command_buffer_id = format::kNullHandleId;
+        ValueDecoder::DecodeHandleIdValue(buffer, buffer_size, &command_buffer_id);
+
+        const CommandBufferInfo* command_buffer_info = object_info_table_->GetCommandBufferInfo(command_buffer_id);
+
+        if (command_buffer_info != nullptr)
+        {
+            auto pool_entry = pool_threads_.find(command_buffer_info->pool_id);
+
+            if (pool_entry == pool_threads_.end())
+            {
+                pool_threads_.emplace(command_buffer_info->pool_id, call_info.thread_id);
+            }
+            else if (pool_entry->second != call_info.thread_id)
+            {
+                // The pool was previously used by a different thread, which must finish before this thread can use
+                // the pool.
+                Synchronize();
+                pool_entry->second = call_info.thread_id;
+            }
+
+            QueueCall(call_id, call_info, buffer, buffer_size);
+            return;
+        }
+    }
+
+    Synchronize();
+    decoder_->DecodeFunctionCall(call_id, call_info, buffer, buffer_size);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchStateBeginMarker(uint64_t frame_number)
+{
+    Synchronize();
+    decoder_->DispatchStateBeginMarker(frame_number);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchStateEndMarker(uint64_t frame_number)
+{
+    Synchronize();
+    decoder_->DispatchStateEndMarker(frame_number);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchDisplayMessageCommand(format::ThreadId   thread_id,
+                                                                   const std::string& message)
+{
+    Synchronize();
+    decoder_->DispatchDisplayMessageCommand(thread_id, message);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchFillMemoryCommand(
+    format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data)
+{
+    Synchronize();
+    decoder_->DispatchFillMemoryCommand(thread_id, memory_id, offset, size, data);
+}
+
+uint8_t* VulkanThreadedRecordingDecoder::GetFillMemoryDestination(format::ThreadId thread_id,
+                                                                  uint64_t         memory_id,
+                                                                  uint64_t         offset)
+{
+    // The memory may be written by recorded commands that have not been replayed yet.
+    Synchronize();
+    return decoder_->GetFillMemoryDestination(thread_id, memory_id, offset);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                                                 format::HandleId surface_id,
+                                                                 uint32_t         width,
+                                                                 uint32_t         height)
+{
+    Synchronize();
+    decoder_->DispatchResizeWindowCommand(thread_id, surface_id, width, height);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchResizeWindowCommand2(format::ThreadId thread_id,
+                                                                  format::HandleId surface_id,
+                                                                  uint32_t         width,
+                                                                  uint32_t         height,
+                                                                  uint32_t         pre_transform)
+{
+    Synchronize();
+    decoder_->DispatchResizeWindowCommand2(thread_id, surface_id, width, height, pre_transform);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchCreateHardwareBufferCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    memory_id,
+    uint64_t                                            buffer_id,
+    uint32_t                                            format,
+    uint32_t                                            width,
+    uint32_t                                            height,
+    uint32_t                                            stride,
+    uint32_t                                            usage,
+    uint32_t                                            layers,
+    const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
+{
+    Synchronize();
+    decoder_->DispatchCreateHardwareBufferCommand(
+        thread_id, memory_id, buffer_id, format, width, height, stride, usage, layers, plane_info);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id,
+                                                                          uint64_t         buffer_id)
+{
+    Synchronize();
+    decoder_->DispatchDestroyHardwareBufferCommand(thread_id, buffer_id);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchSetDevicePropertiesCommand(
+    format::ThreadId   thread_id,
+    format::HandleId   physical_device_id,
+    uint32_t           api_version,
+    uint32_t           driver_version,
+    uint32_t           vendor_id,
+    uint32_t           device_id,
+    uint32_t           device_type,
+    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+    const std::string& device_name)
+{
+    Synchronize();
+    decoder_->DispatchSetDevicePropertiesCommand(thread_id,
+                                                 physical_device_id,
+                                                 api_version,
+                                                 driver_version,
+                                                 vendor_id,
+                                                 device_id,
+                                                 device_type,
+                                                 pipeline_cache_uuid,
+                                                 device_name);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchSetDeviceMemoryPropertiesCommand(
+    format::ThreadId                             thread_id,
+    format::HandleId                             physical_device_id,
+    const std::vector<format::DeviceMemoryType>& memory_types,
+    const std::vector<format::DeviceMemoryHeap>& memory_heaps)
+{
+    Synchronize();
+    decoder_->DispatchSetDeviceMemoryPropertiesCommand(thread_id, physical_device_id, memory_types, memory_heaps);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
+                                                                     format::HandleId device_id,
+                                                                     format::HandleId buffer_id,
+                                                                     uint64_t         address)
+{
+    Synchronize();
+    decoder_->DispatchSetOpaqueAddressCommand(thread_id, device_id, buffer_id, address);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchSetSwapchainImageStateCommand(
+    format::ThreadId                                    thread_id,
+    format::HandleId                                    device_id,
+    format::HandleId                                    swapchain_id,
+    uint32_t                                            last_presented_image,
+    const std::vector<format::SwapchainImageStateInfo>& image_state)
+{
+    Synchronize();
+    decoder_->DispatchSetSwapchainImageStateCommand(
+        thread_id, device_id, swapchain_id, last_presented_image, image_state);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                                      format::HandleId device_id,
+                                                                      uint64_t         max_resource_size,
+                                                                      uint64_t         max_copy_size)
+{
+    Synchronize();
+    decoder_->DispatchBeginResourceInitCommand(thread_id, device_id, max_resource_size, max_copy_size);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchEndResourceInitCommand(format::ThreadId thread_id,
+                                                                    format::HandleId device_id)
+{
+    Synchronize();
+    decoder_->DispatchEndResourceInitCommand(thread_id, device_id);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchInitBufferCommand(format::ThreadId thread_id,
+                                                               format::HandleId device_id,
+                                                               format::HandleId buffer_id,
+                                                               uint64_t         data_size,
+                                                               const uint8_t*   data)
+{
+    Synchronize();
+    decoder_->DispatchInitBufferCommand(thread_id, device_id, buffer_id, data_size, data);
+}
+
+void VulkanThreadedRecordingDecoder::DispatchInitImageCommand(format::ThreadId             thread_id,
+                                                              format::HandleId             device_id,
+                                                              format::HandleId             image_id,
+                                                              uint64_t                     data_size,
+                                                              uint32_t                     aspect,
+                                                              uint32_t                     layout,
+                                                              const std::vector<uint64_t>& level_sizes,
+                                                              const uint8_t*               data)
+{
+    Synchronize();
+    decoder_->DispatchInitImageCommand(thread_id, device_id, image_id, data_size, aspect, layout, level_sizes, data);
+}
+
+bool VulkanThreadedRecordingDecoder::IsRecordingCall(format::ApiCallId call_id)
+{
+    // vkCmdExecuteCommands is excluded, as it requires the recording of its secondary command buffers to be complete,
+    // which may have been performed by a different thread.
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+        case format::ApiCallId::ApiCall_vkEndCommandBuffer:
+        case format::ApiCallId::ApiCall_vkResetCommandBuffer:
+        case format::ApiCallId::ApiCall_vkCmdBindPipeline:
+        case format::ApiCallId::ApiCall_vkCmdSetViewport:
+        case format::ApiCallId::ApiCall_vkCmdSetScissor:
+        case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
+        case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+        case format::ApiCallId::ApiCall_vkCmdDraw:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDispatch:
+        case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+        case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
+        case format::ApiCallId::ApiCall_vkCmdFillBuffer:
+        case format::ApiCallId::ApiCall_vkCmdClearColorImage:
+        case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+        case format::ApiCallId::ApiCall_vkCmdClearAttachments:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage:
+        case format::ApiCallId::ApiCall_vkCmdSetEvent:
+        case format::ApiCallId::ApiCall_vkCmdResetEvent:
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents:
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
+        case format::ApiCallId::ApiCall_vkCmdBeginQuery:
+        case format::ApiCallId::ApiCall_vkCmdEndQuery:
+        case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
+        case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
+        case format::ApiCallId::ApiCall_vkCmdPushConstants:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBase:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplateKHR:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdProcessCommandsNVX:
+        case format::ApiCallId::ApiCall_vkCmdReserveSpaceForCommandsNVX:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
+        case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
+        case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+        case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
+        case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
+        case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void VulkanThreadedRecordingDecoder::ProcessCalls(ApiDecoder* decoder, Worker* worker)
+{
+    assert((decoder != nullptr) && (worker != nullptr));
+
+    std::unique_lock<std::mutex> lock(worker->lock);
+
+    for (;;)
+    {
+        worker->work_condition.wait(lock, [worker]() { return !worker->queue.empty() || worker->exit; });
+
+        if (worker->queue.empty())
+        {
+            // Exit was requested and all queued calls have been processed.
+            break;
+        }
+
+        QueuedCall call = std::move(worker->queue.front());
+        worker->queue.pop_front();
+        worker->busy = true;
+
+        lock.unlock();
+
+        try
+        {
+            DecodeAllocator::Begin();
+            decoder->DecodeFunctionCall(
+                call.call_id, call.call_info, call.parameter_buffer.data(), call.parameter_buffer.size());
+            DecodeAllocator::End();
+        }
+        catch (...)
+        {
+            DecodeAllocator::End();
+
+            lock.lock();
+            if (!worker->error)
+            {
+                worker->error = std::current_exception();
+            }
+            lock.unlock();
+        }
+
+        lock.lock();
+        worker->busy = false;
+
+        if (worker->queue.empty())
+        {
+            worker->idle_condition.notify_all();
+        }
+    }
+
+    lock.unlock();
+
+    DecodeAllocator::DestroyInstance();
+}
+
+VulkanThreadedRecordingDecoder::Worker* VulkanThreadedRecordingDecoder::GetWorker(format::ThreadId thread_id)
+{
+    auto entry = workers_.find(thread_id);
+
+    if (entry != workers_.end())
+    {
+        return entry->second.get();
+    }
+
+    GFXRECON_LOG_DEBUG("Creating command buffer recording worker for capture thread %" PRIu64, thread_id);
+
+    auto    new_worker = std::make_unique<Worker>();
+    Worker* worker     = new_worker.get();
+
+    worker->thread = std::thread(ProcessCalls, decoder_, worker);
+    workers_.emplace(thread_id, std::move(new_worker));
+
+    return worker;
+}
+
+void VulkanThreadedRecordingDecoder::QueueCall(format::ApiCallId  call_id,
+                                               const ApiCallInfo& call_info,
+                                               const uint8_t*     buffer,
+                                               size_t             buffer_size)
+{
+    Worker* worker = GetWorker(call_info.thread_id);
+
+    {
+        std::lock_guard<std::mutex> lock(worker->lock);
+
+        worker->queue.emplace_back();
+
+        QueuedCall& call = worker->queue.back();
+        call.call_id     = call_id;
+        call.call_info   = call_info;
+        call.parameter_buffer.assign(buffer, buffer + buffer_size);
+    }
+
+    worker->work_condition.notify_one();
+    workers_active_ = true;
+}
+
+void VulkanThreadedRecordingDecoder::StopWorkers()
+{
+    for (auto& entry : workers_)
+    {
+        Worker* worker = entry.second.get();
+
+        {
+            std::lock_guard<std::mutex> lock(worker->lock);
+            worker->exit = true;
+        }
+
+        worker->work_condition.notify_one();
+    }
+
+    for (auto& entry : workers_)
+    {
+        entry.second->thread.join();
+
+        if (entry.second->error)
+        {
+            GFXRECON_LOG_ERROR("Command buffer recording worker for capture thread %" PRIu64
+                               " encountered an error that was not reported before replay ended",
+                               entry.first);
+        }
+    }
+
+    workers_.clear();
+    workers_active_ = false;
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,205 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_DECODE_VULKAN_THREADED_RECORDING_DECODER_H
+#define GFXRECON_DECODE_VULKAN_THREADED_RECORDING_DECODER_H
+
+#include "decode/api_decoder.h"
+#include "decode/vulkan_object_info_table.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+// Decoder wrapper that replays command buffer recording calls on worker threads.  Each thread ID from the capture
+// file is assigned a worker thread, and vkBeginCommandBuffer, vkCmd*, and vkEndCommandBuffer calls are queued to the
+// worker for the thread that recorded them, preserving the per-thread call order.  All other calls, including queue
+// submission and object creation/destruction, are synchronization points: the wrapper waits for all workers to finish
+// their queued calls before forwarding the call to the wrapped decoder on the calling thread.
+//
+// Workers are also synchronized before a command pool is used from a different capture thread than the previous
+// recording call, as the application must have externally synchronized that access.
+class VulkanThreadedRecordingDecoder : public ApiDecoder
+{
+  public:
+    // The object info table is used to determine the command pool for command buffer recording calls, and is only
+    // accessed while workers are idle or while they are only reading from the table.
+    VulkanThreadedRecordingDecoder(ApiDecoder* decoder, const VulkanObjectInfoTable* object_info_table);
+
+    virtual ~VulkanThreadedRecordingDecoder() override;
+
+    // Waits for all workers to finish their queued calls.  Rethrows any exception that was raised by a worker.
+    void Synchronize();
+
+    virtual bool SupportsApiCall(format::ApiCallId id) override { return decoder_->SupportsApiCall(id); }
+
+    virtual bool SupportsMetaDataType(format::MetaDataType type) override
+    {
+        return decoder_->SupportsMetaDataType(type);
+    }
+
+    virtual void DecodeFunctionCall(format::ApiCallId  id,
+                                    const ApiCallInfo& call_info,
+                                    const uint8_t*     buffer,
+                                    size_t             buffer_size) override;
+
+    virtual void DispatchStateBeginMarker(uint64_t frame_number) override;
+
+    virtual void DispatchStateEndMarker(uint64_t frame_number) override;
+
+    virtual void DispatchDisplayMessageCommand(format::ThreadId thread_id, const std::string& message) override;
+
+    virtual void DispatchFillMemoryCommand(
+        format::ThreadId thread_id, uint64_t memory_id, uint64_t offset, uint64_t size, const uint8_t* data) override;
+
+    virtual uint8_t* GetFillMemoryDestination(format::ThreadId thread_id, uint64_t memory_id, uint64_t offset) override;
+
+    virtual void DispatchResizeWindowCommand(format::ThreadId thread_id,
+                                             format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height) override;
+
+    virtual void DispatchResizeWindowCommand2(format::ThreadId thread_id,
+                                              format::HandleId surface_id,
+                                              uint32_t         width,
+                                              uint32_t         height,
+                                              uint32_t         pre_transform) override;
+
+    virtual void
+    DispatchCreateHardwareBufferCommand(format::ThreadId                                    thread_id,
+                                        format::HandleId                                    memory_id,
+                                        uint64_t                                            buffer_id,
+                                        uint32_t                                            format,
+                                        uint32_t                                            width,
+                                        uint32_t                                            height,
+                                        uint32_t                                            stride,
+                                        uint32_t                                            usage,
+                                        uint32_t                                            layers,
+                                        const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override;
+
+    virtual void DispatchDestroyHardwareBufferCommand(format::ThreadId thread_id, uint64_t buffer_id) override;
+
+    virtual void DispatchSetDevicePropertiesCommand(format::ThreadId   thread_id,
+                                                    format::HandleId   physical_device_id,
+                                                    uint32_t           api_version,
+                                                    uint32_t           driver_version,
+                                                    uint32_t           vendor_id,
+                                                    uint32_t           device_id,
+                                                    uint32_t           device_type,
+                                                    const uint8_t      pipeline_cache_uuid[format::kUuidSize],
+                                                    const std::string& device_name) override;
+
+    virtual void
+    DispatchSetDeviceMemoryPropertiesCommand(format::ThreadId                             thread_id,
+                                             format::HandleId                             physical_device_id,
+                                             const std::vector<format::DeviceMemoryType>& memory_types,
+                                             const std::vector<format::DeviceMemoryHeap>& memory_heaps) override;
+
+    virtual void DispatchSetOpaqueAddressCommand(format::ThreadId thread_id,
+                                                 format::HandleId device_id,
+                                                 format::HandleId buffer_id,
+                                                 uint64_t         address) override;
+
+    virtual void
+    DispatchSetSwapchainImageStateCommand(format::ThreadId                                    thread_id,
+                                          format::HandleId                                    device_id,
+                                          format::HandleId                                    swapchain_id,
+                                          uint32_t                                            last_presented_image,
+                                          const std::vector<format::SwapchainImageStateInfo>& image_state) override;
+
+    virtual void DispatchBeginResourceInitCommand(format::ThreadId thread_id,
+                                                  format::HandleId device_id,
+                                                  uint64_t         max_resource_size,
+                                                  uint64_t         max_copy_size) override;
+
+    virtual void DispatchEndResourceInitCommand(format::ThreadId thread_id, format::HandleId device_id) override;
+
+    virtual void DispatchInitBufferCommand(format::ThreadId thread_id,
+                                           format::HandleId device_id,
+                                           format::HandleId buffer_id,
+                                           uint64_t         data_size,
+                                           const uint8_t*   data) override;
+
+    virtual void DispatchInitImageCommand(format::ThreadId             thread_id,
+                                          format::HandleId             device_id,
+                                          format::HandleId             image_id,
+                                          uint64_t                     data_size,
+                                          uint32_t                     aspect,
+                                          uint32_t                     layout,
+                                          const std::vector<uint64_t>& level_sizes,
+                                          const uint8_t*               data) override;
+
+  private:
+    struct QueuedCall
+    {
+        format::ApiCallId    call_id;
+        ApiCallInfo          call_info;
+        std::vector<uint8_t> parameter_buffer;
+    };
+
+    struct Worker
+    {
+        std::thread             thread;
+        std::mutex              lock;
+        std::condition_variable work_condition;
+        std::condition_variable idle_condition;
+        std::deque<QueuedCall>  queue;
+        bool                    busy{ false };
+        bool                    exit{ false };
+        std::exception_ptr      error;
+    };
+
+  private:
+    static bool IsRecordingCall(format::ApiCallId call_id);
+
+    static void ProcessCalls(ApiDecoder* decoder, Worker* worker);
+
+    Worker* GetWorker(format::ThreadId thread_id);
+
+    void QueueCall(format::ApiCallId call_id, const ApiCallInfo& call_info, const uint8_t* buffer, size_t buffer_size);
+
+    void StopWorkers();
+
+  private:
+    ApiDecoder*                                                   decoder_;
+    const VulkanObjectInfoTable*                                  object_info_table_;
+    std::unordered_map<format::ThreadId, std::unique_ptr<Worker>> workers_;
+    std::unordered_map<format::HandleId, format::ThreadId>        pool_threads_;
+    bool                                                          workers_active_;
+};
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_DECODE_VULKAN_THREADED_RECORDING_DECODER_H
@@ -0,0 +1,182 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+// Micro-benchmark for the parameter encoding performed by the generated API call encoders.  Each benchmark repeats the
+// encoder calls from the generated vkCmdDraw, vkCmdBindDescriptorSets, and vkQueueSubmit wrappers, writing to a
+// MemoryOutputStream that is reset after each call as the TraceManager does, and reports the average time per call.
+// The capture layer's TraceManager is not involved, so the results measure encoding overhead only.
+
+#include "encode/parameter_encoder.h"
+#include "encode/struct_pointer_encoder.h"
+#include "encode/vulkan_handle_wrappers.h"
+#include "format/format.h"
+#include "format/format_util.h"
+#include "generated/generated_vulkan_struct_encoders.h"
+#include "util/logging.h"
+#include "util/memory_output_stream.h"
+
+#include "vulkan/vulkan.h"
+
+#include <chrono>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdlib>
+
+const uint32_t kDefaultIterations        = 1000000;
+const uint32_t kDescriptorSetCount       = 4;
+const uint32_t kDynamicOffsetCount       = 2;
+const uint32_t kSubmitCommandBufferCount = 4;
+
+// Handle wrappers with the layout the capture layer assigns to application handles, so that the handle encoders
+// retrieve the handle IDs in the same way as during capture.
+struct BenchmarkHandles
+{
+    gfxrecon::encode::QueueWrapper          queue;
+    gfxrecon::encode::FenceWrapper          fence;
+    gfxrecon::encode::SemaphoreWrapper      wait_semaphore;
+    gfxrecon::encode::SemaphoreWrapper      signal_semaphore;
+    gfxrecon::encode::CommandBufferWrapper  command_buffers[kSubmitCommandBufferCount];
+    gfxrecon::encode::PipelineLayoutWrapper pipeline_layout;
+    gfxrecon::encode::DescriptorSetWrapper  descriptor_sets[kDescriptorSetCount];
+};
+
+template <typename Wrapper>
+static typename Wrapper::HandleType WrapHandle(Wrapper* wrapper, gfxrecon::format::HandleId* next_id)
+{
+    wrapper->handle_id = (*next_id)++;
+    return gfxrecon::format::FromHandleId<typename Wrapper::HandleType>(reinterpret_cast<uintptr_t>(wrapper));
+}
+
+template <typename EncodeFunc>
+static void RunBenchmark(const char* name, uint32_t iterations, EncodeFunc encode_func)
+{
+    gfxrecon::util::MemoryOutputStream parameter_stream;
+    gfxrecon::encode::ParameterEncoder encoder(&parameter_stream);
+
+    // Warm up the parameter buffer, which is reused across calls during capture.
+    encode_func(&encoder);
+    parameter_stream.Reset();
+
+    uint64_t total_bytes = 0;
+    auto     start       = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        encode_func(&encoder);
+        total_bytes += parameter_stream.GetDataSize();
+        parameter_stream.Reset();
+    }
+
+    auto   end         = std::chrono::steady_clock::now();
+    double elapsed_ns  = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+    double ns_per_call = elapsed_ns / iterations;
+
+    GFXRECON_WRITE_CONSOLE("%-24s %10.2f ns/call  (%" PRIu64 " bytes/call)",
+                           name,
+                           ns_per_call,
+                           total_bytes / iterations);
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    uint32_t iterations = kDefaultIterations;
+
+    if (argc > 1)
+    {
+        iterations = static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10));
+
+        if (iterations == 0)
+        {
+            GFXRECON_WRITE_CONSOLE("Usage: %s [iterations]", argv[0]);
+            gfxrecon::util::Log::Release();
+            return -1;
+        }
+    }
+
+    BenchmarkHandles           wrappers;
+    gfxrecon::format::HandleId next_id = 1;
+
+    VkQueue          queue            = WrapHandle(&wrappers.queue, &next_id);
+    VkFence          fence            = WrapHandle(&wrappers.fence, &next_id);
+    VkSemaphore      wait_semaphore   = WrapHandle(&wrappers.wait_semaphore, &next_id);
+    VkSemaphore      signal_semaphore = WrapHandle(&wrappers.signal_semaphore, &next_id);
+    VkPipelineLayout pipeline_layout  = WrapHandle(&wrappers.pipeline_layout, &next_id);
+
+    VkCommandBuffer command_buffers[kSubmitCommandBufferCount];
+    for (uint32_t i = 0; i < kSubmitCommandBufferCount; ++i)
+    {
+        command_buffers[i] = WrapHandle(&wrappers.command_buffers[i], &next_id);
+    }
+
+    VkDescriptorSet descriptor_sets[kDescriptorSetCount];
+    for (uint32_t i = 0; i < kDescriptorSetCount; ++i)
+    {
+        descriptor_sets[i] = WrapHandle(&wrappers.descriptor_sets[i], &next_id);
+    }
+
+    const uint32_t             dynamic_offsets[kDynamicOffsetCount] = { 0, 256 };
+    const VkPipelineStageFlags wait_stage_mask                      = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+    VkSubmitInfo submit_info         = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    submit_info.waitSemaphoreCount   = 1;
+    submit_info.pWaitSemaphores      = &wait_semaphore;
+    submit_info.pWaitDstStageMask    = &wait_stage_mask;
+    submit_info.commandBufferCount   = kSubmitCommandBufferCount;
+    submit_info.pCommandBuffers      = command_buffers;
+    submit_info.signalSemaphoreCount = 1;
+    submit_info.pSignalSemaphores    = &signal_semaphore;
+
+    GFXRECON_WRITE_CONSOLE("Encoding %u calls per benchmark.", iterations);
+
+    RunBenchmark("vkCmdDraw", iterations, [&](gfxrecon::encode::ParameterEncoder* encoder) {
+        encoder->EncodeHandleValue(command_buffers[0]);
+        encoder->EncodeUInt32Value(3);
+        encoder->EncodeUInt32Value(1);
+        encoder->EncodeUInt32Value(0);
+        encoder->EncodeUInt32Value(0);
+    });
+
+    RunBenchmark("vkCmdBindDescriptorSets", iterations, [&](gfxrecon::encode::ParameterEncoder* encoder) {
+        encoder->EncodeHandleValue(command_buffers[0]);
+        encoder->EncodeEnumValue(VK_PIPELINE_BIND_POINT_GRAPHICS);
+        encoder->EncodeHandleValue(pipeline_layout);
+        encoder->EncodeUInt32Value(0);
+        encoder->EncodeUInt32Value(kDescriptorSetCount);
+        encoder->EncodeHandleArray(descriptor_sets, kDescriptorSetCount);
+        encoder->EncodeUInt32Value(kDynamicOffsetCount);
+        encoder->EncodeUInt32Array(dynamic_offsets, kDynamicOffsetCount);
+    });
+
+    RunBenchmark("vkQueueSubmit", iterations, [&](gfxrecon::encode::ParameterEncoder* encoder) {
+        encoder->Reserve(gfxrecon::encode::ComputeStructArrayEncodedSize(&submit_info, 1));
+        encoder->EncodeHandleValue(queue);
+        encoder->EncodeUInt32Value(1);
+        gfxrecon::encode::EncodeStructArray(encoder, &submit_info, 1);
+        encoder->EncodeHandleValue(fence);
+        encoder->EncodeEnumValue(VK_SUCCESS);
+    });
+
+    gfxrecon::util::Log::Release();
+    return 0;
+}
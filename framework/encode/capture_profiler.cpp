@@ -0,0 +1,211 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/capture_profiler.h"
+
+#include "format/format_util.h"
+#include "util/date_time.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+static int64_t GetTotalTime(const CaptureProfiler::CallTimes& times)
+{
+    int64_t total = 0;
+    for (uint32_t i = 0; i < CaptureProfiler::kPhaseCount; ++i)
+    {
+        total += times.phase_times[i];
+    }
+    return total;
+}
+
+std::atomic<uint64_t> CaptureProfiler::id_counter_{ 0 };
+
+void CaptureProfiler::ThreadCounters::MergeInto(CallTimesMap* totals)
+{
+    assert(totals != nullptr);
+
+    std::lock_guard<std::mutex> lock(lock_);
+
+    for (const auto& entry : call_times_)
+    {
+        CallTimes& total = (*totals)[entry.first];
+        total.call_count += entry.second.call_count;
+
+        for (uint32_t i = 0; i < kPhaseCount; ++i)
+        {
+            total.phase_times[i] += entry.second.phase_times[i];
+        }
+    }
+
+    call_times_.clear();
+}
+
+CaptureProfiler::CaptureProfiler() : id_(++id_counter_), frame_count_(0) {}
+
+std::shared_ptr<CaptureProfiler::ThreadCounters> CaptureProfiler::RegisterThread()
+{
+    auto counters = std::make_shared<ThreadCounters>(id_);
+
+    std::lock_guard<std::mutex> lock(lock_);
+    thread_counters_.push_back(counters);
+
+    return counters;
+}
+
+void CaptureProfiler::EndFrame()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    MergeThreadCounters();
+    ++frame_count_;
+}
+
+void CaptureProfiler::MergeThreadCounters()
+{
+    for (const auto& counters : thread_counters_)
+    {
+        counters->MergeInto(&totals_);
+    }
+}
+
+bool CaptureProfiler::WriteSummaryFile(const std::string& filename)
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    MergeThreadCounters();
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open capture profile file %s", filename.c_str());
+        return false;
+    }
+
+    // Sort calls by total overhead, so that the most expensive calls are listed first.
+    std::vector<std::pair<uint32_t, CallTimes>> sorted(totals_.begin(), totals_.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+        return GetTotalTime(lhs.second) > GetTotalTime(rhs.second);
+    });
+
+    int64_t phase_totals[kPhaseCount] = {};
+    for (const auto& entry : sorted)
+    {
+        for (uint32_t i = 0; i < kPhaseCount; ++i)
+        {
+            phase_totals[i] += entry.second.phase_times[i];
+        }
+    }
+
+    fprintf(file, "Frames: %u\n", frame_count_);
+    fprintf(file,
+            "Capture overhead (ms): encode %.3f, state tracking %.3f, compression %.3f, file lock wait %.3f, "
+            "file write %.3f, memory tracking %.3f\n\n",
+            util::datetime::ConvertTimestampToMilliseconds(phase_totals[kPhaseEncode]),
+            util::datetime::ConvertTimestampToMilliseconds(phase_totals[kPhaseStateTracking]),
+            util::datetime::ConvertTimestampToMilliseconds(phase_totals[kPhaseCompression]),
+            util::datetime::ConvertTimestampToMilliseconds(phase_totals[kPhaseFileLockWait]),
+            util::datetime::ConvertTimestampToMilliseconds(phase_totals[kPhaseFileWrite]),
+            util::datetime::ConvertTimestampToMilliseconds(phase_totals[kPhaseMemoryTracking]));
+
+    fprintf(file,
+            "api_call_id,call_count,total_ms,encode_ms,state_tracking_ms,compression_ms,file_lock_wait_ms,"
+            "file_write_ms,memory_tracking_ms\n");
+
+    for (const auto& entry : sorted)
+    {
+        const CallTimes& times = entry.second;
+        fprintf(file,
+                "0x%08x,%" PRIu64 ",%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f\n",
+                entry.first,
+                times.call_count,
+                util::datetime::ConvertTimestampToMilliseconds(GetTotalTime(times)),
+                util::datetime::ConvertTimestampToMilliseconds(times.phase_times[kPhaseEncode]),
+                util::datetime::ConvertTimestampToMilliseconds(times.phase_times[kPhaseStateTracking]),
+                util::datetime::ConvertTimestampToMilliseconds(times.phase_times[kPhaseCompression]),
+                util::datetime::ConvertTimestampToMilliseconds(times.phase_times[kPhaseFileLockWait]),
+                util::datetime::ConvertTimestampToMilliseconds(times.phase_times[kPhaseFileWrite]),
+                util::datetime::ConvertTimestampToMilliseconds(times.phase_times[kPhaseMemoryTracking]));
+    }
+
+    util::platform::FileClose(file);
+
+    GFXRECON_LOG_INFO("Wrote capture profile to %s", filename.c_str());
+
+    return true;
+}
+
+void CaptureProfiler::WriteMetaDataBlock(util::OutputStream* stream, format::ThreadId thread_id)
+{
+    assert(stream != nullptr);
+
+    std::vector<format::CaptureProfileEntry> entries;
+    uint32_t                                 frame_count = 0;
+
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        MergeThreadCounters();
+
+        frame_count = frame_count_;
+        entries.reserve(totals_.size());
+
+        for (const auto& entry : totals_)
+        {
+            format::CaptureProfileEntry profile_entry;
+            profile_entry.api_call_id          = static_cast<format::ApiCallId>(entry.first);
+            profile_entry.call_count           = entry.second.call_count;
+            profile_entry.encode_time          = entry.second.phase_times[kPhaseEncode];
+            profile_entry.state_tracking_time  = entry.second.phase_times[kPhaseStateTracking];
+            profile_entry.compression_time     = entry.second.phase_times[kPhaseCompression];
+            profile_entry.file_lock_wait_time  = entry.second.phase_times[kPhaseFileLockWait];
+            profile_entry.file_write_time      = entry.second.phase_times[kPhaseFileWrite];
+            profile_entry.memory_tracking_time = entry.second.phase_times[kPhaseMemoryTracking];
+            entries.push_back(profile_entry);
+        }
+    }
+
+    size_t entries_size = entries.size() * sizeof(format::CaptureProfileEntry);
+
+    format::CaptureProfileCommandHeader profile_cmd;
+    profile_cmd.meta_header.block_header.type = format::BlockType::kMetaDataBlock;
+    profile_cmd.meta_header.block_header.size = format::GetMetaDataBlockBaseSize(profile_cmd) + entries_size;
+    profile_cmd.meta_header.meta_data_type    = format::MetaDataType::kCaptureProfileCommand;
+    profile_cmd.thread_id                     = thread_id;
+    profile_cmd.frame_count                   = frame_count;
+    profile_cmd.entry_count                   = static_cast<uint32_t>(entries.size());
+
+    stream->Write(&profile_cmd, sizeof(profile_cmd));
+
+    if (entries_size > 0)
+    {
+        stream->Write(entries.data(), entries_size);
+    }
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
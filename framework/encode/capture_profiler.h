@@ -0,0 +1,126 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_CAPTURE_PROFILER_H
+#define GFXRECON_ENCODE_CAPTURE_PROFILER_H
+
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Accumulates the time spent by the capture layer processing each API call, split into the individual stages of
+// capture.  Timings are recorded to per-thread counters, which are merged into the profiler totals at frame
+// boundaries, so that the only synchronization on the API call path is an uncontended per-thread lock.
+class CaptureProfiler
+{
+  public:
+    enum Phase : uint32_t
+    {
+        kPhaseEncode         = 0, // Parameter encoding.
+        kPhaseStateTracking  = 1, // State tracking for trimming.
+        kPhaseCompression    = 2, // Compression of the encoded parameter buffer.
+        kPhaseFileLockWait   = 3, // Time spent waiting to acquire the capture file lock.
+        kPhaseFileWrite      = 4, // Writing the block to the capture file.
+        kPhaseMemoryTracking = 5, // Page guard processing of modified mapped memory, including the resulting writes.
+        kPhaseCount
+    };
+
+    struct CallTimes
+    {
+        uint64_t call_count{ 0 };
+        int64_t  phase_times[kPhaseCount]{}; // Nanoseconds.
+    };
+
+    typedef std::unordered_map<uint32_t, CallTimes> CallTimesMap;
+
+    class ThreadCounters
+    {
+      public:
+        ThreadCounters(uint64_t profiler_id) : profiler_id_(profiler_id) {}
+
+        uint64_t GetProfilerId() const { return profiler_id_; }
+
+        void AddCall(format::ApiCallId call_id)
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            ++call_times_[call_id].call_count;
+        }
+
+        void AddTime(format::ApiCallId call_id, Phase phase, int64_t duration)
+        {
+            std::lock_guard<std::mutex> lock(lock_);
+            call_times_[call_id].phase_times[phase] += duration;
+        }
+
+        // Adds the thread's counters to the specified totals and resets the thread's counters.
+        void MergeInto(CallTimesMap* totals);
+
+      private:
+        const uint64_t profiler_id_;
+        std::mutex     lock_;
+        CallTimesMap   call_times_;
+    };
+
+  public:
+    CaptureProfiler();
+
+    uint64_t GetId() const { return id_; }
+
+    // Creates counters for a new thread.  The profiler retains a reference to the counters for merging.
+    std::shared_ptr<ThreadCounters> RegisterThread();
+
+    // Merges all per-thread counters into the profiler totals.
+    void EndFrame();
+
+    bool WriteSummaryFile(const std::string& filename);
+
+    // Writes the current profiler totals to a capture file as a kCaptureProfileCommand meta-data block.
+    void WriteMetaDataBlock(util::OutputStream* stream, format::ThreadId thread_id);
+
+  private:
+    void MergeThreadCounters();
+
+  private:
+    static std::atomic<uint64_t>                 id_counter_;
+    const uint64_t                               id_;
+    std::mutex                                   lock_;
+    std::vector<std::shared_ptr<ThreadCounters>> thread_counters_;
+    CallTimesMap                                 totals_;
+    uint32_t                                     frame_count_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_CAPTURE_PROFILER_H
@@ -48,6 +48,20 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define CAPTURE_FILE_USE_TIMESTAMP_UPPER    "CAPTURE_FILE_TIMESTAMP"
 #define CAPTURE_FILE_FLUSH_LOWER            "capture_file_flush"
 #define CAPTURE_FILE_FLUSH_UPPER            "CAPTURE_FILE_FLUSH"
+#define CAPTURE_FILE_DIRECT_IO_LOWER        "capture_file_direct_io"
+#define CAPTURE_FILE_DIRECT_IO_UPPER        "CAPTURE_FILE_DIRECT_IO"
+#define CAPTURE_FILE_SEGMENT_FRAMES_LOWER   "capture_file_segment_frames"
+#define CAPTURE_FILE_SEGMENT_FRAMES_UPPER   "CAPTURE_FILE_SEGMENT_FRAMES"
+#define CAPTURE_FILE_SEGMENT_SIZE_LOWER     "capture_file_segment_size"
+#define CAPTURE_FILE_SEGMENT_SIZE_UPPER     "CAPTURE_FILE_SEGMENT_SIZE"
+#define FLIGHT_RECORDER_FRAMES_LOWER        "capture_flight_recorder_frames"
+#define FLIGHT_RECORDER_FRAMES_UPPER        "CAPTURE_FLIGHT_RECORDER_FRAMES"
+#define FLIGHT_RECORDER_FRAME_TIME_LOWER    "capture_flight_recorder_frame_time"
+#define FLIGHT_RECORDER_FRAME_TIME_UPPER    "CAPTURE_FLIGHT_RECORDER_FRAME_TIME"
+#define CAPTURE_PROFILE_FILE_LOWER          "capture_profile_file"
+#define CAPTURE_PROFILE_FILE_UPPER          "CAPTURE_PROFILE_FILE"
+#define CAPTURE_PROFILE_METADATA_LOWER      "capture_profile_metadata"
+#define CAPTURE_PROFILE_METADATA_UPPER      "CAPTURE_PROFILE_METADATA"
 #define LOG_ALLOW_INDENTS_LOWER             "log_allow_indents"
 #define LOG_ALLOW_INDENTS_UPPER             "LOG_ALLOW_INDENTS"
 #define LOG_BREAK_ON_ERROR_LOWER            "log_break_on_error"
@@ -76,6 +90,8 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 #define CAPTURE_FRAMES_UPPER                "CAPTURE_FRAMES"
 #define CAPTURE_TRIGGER_LOWER               "capture_trigger"
 #define CAPTURE_TRIGGER_UPPER               "CAPTURE_TRIGGER"
+#define CAPTURE_RESOURCE_CACHE_LOWER        "capture_resource_cache"
+#define CAPTURE_RESOURCE_CACHE_UPPER        "CAPTURE_RESOURCE_CACHE"
 #define PAGE_GUARD_COPY_ON_MAP_LOWER        "page_guard_copy_on_map"
 #define PAGE_GUARD_COPY_ON_MAP_UPPER        "PAGE_GUARD_COPY_ON_MAP"
 #define PAGE_GUARD_SEPARATE_READ_LOWER      "page_guard_separate_read"
@@ -98,8 +114,15 @@ const char CaptureSettings::kDefaultCaptureFileName[] = "/sdcard/gfxrecon_captur
 
 const char kCaptureCompressionTypeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_LOWER;
 const char kCaptureFileFlushEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_LOWER;
+const char kCaptureFileDirectIoEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_DIRECT_IO_LOWER;
+const char kCaptureFileSegmentFramesEnvVar[]  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_FRAMES_LOWER;
+const char kCaptureFileSegmentSizeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_SIZE_LOWER;
+const char kFlightRecorderFramesEnvVar[]      = GFXRECON_ENV_VAR_PREFIX FLIGHT_RECORDER_FRAMES_LOWER;
+const char kFlightRecorderFrameTimeEnvVar[]   = GFXRECON_ENV_VAR_PREFIX FLIGHT_RECORDER_FRAME_TIME_LOWER;
 const char kCaptureFileNameEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_LOWER;
 const char kCaptureFileUseTimestampEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_LOWER;
+const char kCaptureProfileFileEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_PROFILE_FILE_LOWER;
+const char kCaptureProfileMetaDataEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_PROFILE_METADATA_LOWER;
 const char kLogAllowIndentsEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_LOWER;
 const char kLogBreakOnErrorEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_BREAK_ON_ERROR_LOWER;
 const char kLogDetailedEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_DETAILED_LOWER;
@@ -114,6 +137,7 @@ const char kLogOutputToOsDebugStringEnvVar[]  = GFXRECON_ENV_VAR_PREFIX LOG_OUTP
 const char kMemoryTrackingModeEnvVar[]        = GFXRECON_ENV_VAR_PREFIX MEMORY_TRACKING_MODE_LOWER;
 const char kCaptureFramesEnvVar[]             = GFXRECON_ENV_VAR_PREFIX CAPTURE_FRAMES_LOWER;
 const char kCaptureTriggerEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_LOWER;
+const char kCaptureResourceCacheEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_RESOURCE_CACHE_LOWER;
 const char kPageGuardCopyOnMapEnvVar[]        = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_COPY_ON_MAP_LOWER;
 const char kPageGuardSeparateReadEnvVar[]     = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_SEPARATE_READ_LOWER;
 const char kPageGuardPersistentMemoryEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_PERSISTENT_MEMORY_LOWER;
@@ -129,8 +153,15 @@ const char CaptureSettings::kDefaultCaptureFileName[] = "gfxrecon_capture" GFXRE
 
 const char kCaptureCompressionTypeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_COMPRESSION_TYPE_UPPER;
 const char kCaptureFileFlushEnvVar[]          = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_FLUSH_UPPER;
+const char kCaptureFileDirectIoEnvVar[]       = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_DIRECT_IO_UPPER;
+const char kCaptureFileSegmentFramesEnvVar[]  = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_FRAMES_UPPER;
+const char kCaptureFileSegmentSizeEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_SEGMENT_SIZE_UPPER;
+const char kFlightRecorderFramesEnvVar[]      = GFXRECON_ENV_VAR_PREFIX FLIGHT_RECORDER_FRAMES_UPPER;
+const char kFlightRecorderFrameTimeEnvVar[]   = GFXRECON_ENV_VAR_PREFIX FLIGHT_RECORDER_FRAME_TIME_UPPER;
 const char kCaptureFileNameEnvVar[]           = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_NAME_UPPER;
 const char kCaptureFileUseTimestampEnvVar[]   = GFXRECON_ENV_VAR_PREFIX CAPTURE_FILE_USE_TIMESTAMP_UPPER;
+const char kCaptureProfileFileEnvVar[]        = GFXRECON_ENV_VAR_PREFIX CAPTURE_PROFILE_FILE_UPPER;
+const char kCaptureProfileMetaDataEnvVar[]    = GFXRECON_ENV_VAR_PREFIX CAPTURE_PROFILE_METADATA_UPPER;
 const char kLogAllowIndentsEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_ALLOW_INDENTS_UPPER;
 const char kLogBreakOnErrorEnvVar[]           = GFXRECON_ENV_VAR_PREFIX LOG_BREAK_ON_ERROR_UPPER;
 const char kLogDetailedEnvVar[]               = GFXRECON_ENV_VAR_PREFIX LOG_DETAILED_UPPER;
@@ -151,6 +182,7 @@ const char kPageGuardAlignBufferSizesEnvVar[] = GFXRECON_ENV_VAR_PREFIX PAGE_GUA
 const char kPageGuardTrackAhbMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_TRACK_AHB_MEMORY_UPPER;
 const char kPageGuardExternalMemoryEnvVar[]   = GFXRECON_ENV_VAR_PREFIX PAGE_GUARD_EXTERNAL_MEMORY_UPPER;
 const char kCaptureTriggerEnvVar[]            = GFXRECON_ENV_VAR_PREFIX CAPTURE_TRIGGER_UPPER;
+const char kCaptureResourceCacheEnvVar[]      = GFXRECON_ENV_VAR_PREFIX CAPTURE_RESOURCE_CACHE_UPPER;
 #endif
 
 // Capture options for settings file.
@@ -160,7 +192,14 @@ const char kSettingsFilter[] = "lunarg_gfxreconstruct.";
 const std::string kOptionKeyCaptureCompressionType    = std::string(kSettingsFilter) + std::string(CAPTURE_COMPRESSION_TYPE_LOWER);
 const std::string kOptionKeyCaptureFile               = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_NAME_LOWER);
 const std::string kOptionKeyCaptureFileForceFlush     = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_FLUSH_LOWER);
+const std::string kOptionKeyCaptureFileDirectIo       = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_DIRECT_IO_LOWER);
+const std::string kOptionKeyCaptureFileSegmentFrames  = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_SEGMENT_FRAMES_LOWER);
+const std::string kOptionKeyCaptureFileSegmentSize    = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_SEGMENT_SIZE_LOWER);
+const std::string kOptionKeyFlightRecorderFrames      = std::string(kSettingsFilter) + std::string(FLIGHT_RECORDER_FRAMES_LOWER);
+const std::string kOptionKeyFlightRecorderFrameTime   = std::string(kSettingsFilter) + std::string(FLIGHT_RECORDER_FRAME_TIME_LOWER);
 const std::string kOptionKeyCaptureFileUseTimestamp   = std::string(kSettingsFilter) + std::string(CAPTURE_FILE_USE_TIMESTAMP_LOWER);
+const std::string kOptionKeyCaptureProfileFile        = std::string(kSettingsFilter) + std::string(CAPTURE_PROFILE_FILE_LOWER);
+const std::string kOptionKeyCaptureProfileMetaData    = std::string(kSettingsFilter) + std::string(CAPTURE_PROFILE_METADATA_LOWER);
 const std::string kOptionKeyLogAllowIndents           = std::string(kSettingsFilter) + std::string(LOG_ALLOW_INDENTS_LOWER);
 const std::string kOptionKeyLogBreakOnError           = std::string(kSettingsFilter) + std::string(LOG_BREAK_ON_ERROR_LOWER);
 const std::string kOptionKeyLogDetailed               = std::string(kSettingsFilter) + std::string(LOG_DETAILED_LOWER);
@@ -175,6 +214,7 @@ const std::string kOptionKeyLogOutputToOsDebugString  = std::string(kSettingsFil
 const std::string kOptionKeyMemoryTrackingMode        = std::string(kSettingsFilter) + std::string(MEMORY_TRACKING_MODE_LOWER);
 const std::string kOptionKeyCaptureFrames             = std::string(kSettingsFilter) + std::string(CAPTURE_FRAMES_LOWER);
 const std::string kOptionKeyCaptureTrigger            = std::string(kSettingsFilter) + std::string(CAPTURE_TRIGGER_LOWER);
+const std::string kOptionKeyCaptureResourceCache      = std::string(kSettingsFilter) + std::string(CAPTURE_RESOURCE_CACHE_LOWER);
 const std::string kOptionKeyPageGuardCopyOnMap        = std::string(kSettingsFilter) + std::string(PAGE_GUARD_COPY_ON_MAP_LOWER);
 const std::string kOptionKeyPageGuardSeparateRead     = std::string(kSettingsFilter) + std::string(PAGE_GUARD_SEPARATE_READ_LOWER);
 const std::string kOptionKeyPageGuardPersistentMemory = std::string(kSettingsFilter) + std::string(PAGE_GUARD_PERSISTENT_MEMORY_LOWER);
@@ -240,6 +280,13 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     LoadSingleOptionEnvVar(options, kCaptureFileUseTimestampEnvVar, kOptionKeyCaptureFileUseTimestamp);
     LoadSingleOptionEnvVar(options, kCaptureCompressionTypeEnvVar, kOptionKeyCaptureCompressionType);
     LoadSingleOptionEnvVar(options, kCaptureFileFlushEnvVar, kOptionKeyCaptureFileForceFlush);
+    LoadSingleOptionEnvVar(options, kCaptureFileDirectIoEnvVar, kOptionKeyCaptureFileDirectIo);
+    LoadSingleOptionEnvVar(options, kCaptureFileSegmentFramesEnvVar, kOptionKeyCaptureFileSegmentFrames);
+    LoadSingleOptionEnvVar(options, kCaptureFileSegmentSizeEnvVar, kOptionKeyCaptureFileSegmentSize);
+    LoadSingleOptionEnvVar(options, kFlightRecorderFramesEnvVar, kOptionKeyFlightRecorderFrames);
+    LoadSingleOptionEnvVar(options, kFlightRecorderFrameTimeEnvVar, kOptionKeyFlightRecorderFrameTime);
+    LoadSingleOptionEnvVar(options, kCaptureProfileFileEnvVar, kOptionKeyCaptureProfileFile);
+    LoadSingleOptionEnvVar(options, kCaptureProfileMetaDataEnvVar, kOptionKeyCaptureProfileMetaData);
 
     // Logging environment variables
     LoadSingleOptionEnvVar(options, kLogAllowIndentsEnvVar, kOptionKeyLogAllowIndents);
@@ -260,6 +307,7 @@ void CaptureSettings::LoadOptionsEnvVar(OptionsMap* options)
     // Trimming environment variables
     LoadSingleOptionEnvVar(options, kCaptureFramesEnvVar, kOptionKeyCaptureFrames);
     LoadSingleOptionEnvVar(options, kCaptureTriggerEnvVar, kOptionKeyCaptureTrigger);
+    LoadSingleOptionEnvVar(options, kCaptureResourceCacheEnvVar, kOptionKeyCaptureResourceCache);
 
     // Page guard environment variables
     LoadSingleOptionEnvVar(options, kPageGuardCopyOnMapEnvVar, kOptionKeyPageGuardCopyOnMap);
@@ -306,6 +354,24 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
                                                                 settings->trace_settings_.time_stamp_file);
     settings->trace_settings_.force_flush =
         ParseBoolString(FindOption(options, kOptionKeyCaptureFileForceFlush), settings->trace_settings_.force_flush);
+    settings->trace_settings_.direct_io =
+        ParseBoolString(FindOption(options, kOptionKeyCaptureFileDirectIo), settings->trace_settings_.direct_io);
+    settings->trace_settings_.segment_frames = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureFileSegmentFrames), settings->trace_settings_.segment_frames);
+    settings->trace_settings_.segment_size = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyCaptureFileSegmentSize), settings->trace_settings_.segment_size);
+
+    // Flight recorder options
+    settings->trace_settings_.flight_recorder_frames = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyFlightRecorderFrames), settings->trace_settings_.flight_recorder_frames);
+    settings->trace_settings_.flight_recorder_frame_time = ParseUnsignedIntegerString(
+        FindOption(options, kOptionKeyFlightRecorderFrameTime), settings->trace_settings_.flight_recorder_frame_time);
+
+    // Capture profiling options
+    settings->trace_settings_.capture_profile_file =
+        FindOption(options, kOptionKeyCaptureProfileFile, settings->trace_settings_.capture_profile_file);
+    settings->trace_settings_.capture_profile_metadata = ParseBoolString(
+        FindOption(options, kOptionKeyCaptureProfileMetaData), settings->trace_settings_.capture_profile_metadata);
 
     // Memory tracking options
     settings->trace_settings_.memory_tracking_mode = ParseMemoryTrackingModeString(
@@ -328,6 +394,8 @@ void CaptureSettings::ProcessOptions(OptionsMap* options, CaptureSettings* setti
             GFXRECON_LOG_WARNING("Settings Loader: Ignore trim key setting as trim ranges has been specified.");
         }
     }
+    settings->trace_settings_.resource_cache = ParseBoolString(FindOption(options, kOptionKeyCaptureResourceCache),
+                                                               settings->trace_settings_.resource_cache);
 
     // Page guard environment variables
     settings->trace_settings_.page_guard_copy_on_map = ParseBoolString(
@@ -414,6 +482,26 @@ bool CaptureSettings::ParseBoolString(const std::string& value_string, bool defa
     return result;
 }
 
+uint32_t CaptureSettings::ParseUnsignedIntegerString(const std::string& value_string, uint32_t default_value)
+{
+    uint32_t result = default_value;
+
+    if (!value_string.empty())
+    {
+        if ((value_string.length() <= 9) && (value_string.find_first_not_of("0123456789") == std::string::npos))
+        {
+            result = static_cast<uint32_t>(std::stoul(value_string));
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Settings Loader: Ignoring unrecognized unsigned integer option value \"%s\"",
+                                 value_string.c_str());
+        }
+    }
+
+    return result;
+}
+
 CaptureSettings::MemoryTrackingMode
 CaptureSettings::ParseMemoryTrackingModeString(const std::string&                  value_string,
                                                CaptureSettings::MemoryTrackingMode default_value)
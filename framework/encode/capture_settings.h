@@ -67,14 +67,22 @@ class CaptureSettings
         format::EnabledOptions capture_file_options;
         bool                   time_stamp_file{ true };
         bool                   force_flush{ false };
+        bool                   direct_io{ false };
+        uint32_t               segment_frames{ 0 };             // Frames per capture file segment; zero disables.
+        uint32_t               segment_size{ 0 };               // Capture file segment size in MiB; zero disables.
+        uint32_t               flight_recorder_frames{ 0 };     // Flight recorder checkpoint interval; zero disables.
+        uint32_t               flight_recorder_frame_time{ 0 }; // Frame time in milliseconds that triggers a dump.
         MemoryTrackingMode     memory_tracking_mode{ kPageGuard };
         std::vector<TrimRange> trim_ranges;
         std::string            trim_key;
+        bool                   resource_cache{ false }; // Reuse unmodified resource data across state snapshots.
         bool                   page_guard_copy_on_map{ util::PageGuardManager::kDefaultEnableCopyOnMap };
         bool                   page_guard_separate_read{ util::PageGuardManager::kDefaultEnableSeparateRead };
         bool                   page_guard_persistent_memory{ false };
         bool                   page_guard_align_buffer_sizes{ false };
         bool                   page_guard_track_ahb_memory{ false };
+        std::string            capture_profile_file;
+        bool                   capture_profile_metadata{ false };
 
         // An optimization for the page_guard memory tracking mode that eliminates the need for shadow memory by
         // overriding vkAllocateMemory so that all host visible allocations use the external memory extension with a
@@ -111,6 +119,8 @@ class CaptureSettings
 
     static bool ParseBoolString(const std::string& value_string, bool default_value);
 
+    static uint32_t ParseUnsignedIntegerString(const std::string& value_string, uint32_t default_value);
+
     static MemoryTrackingMode ParseMemoryTrackingModeString(const std::string& value_string,
                                                             MemoryTrackingMode default_value);
 
@@ -90,39 +90,33 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceOrHostAddressConstKHR
     encoder->EncodeVkDeviceAddressValue(value.deviceAddress);
 }
 
-// Encodes both VkWriteDescriptorSet and VkDescriptorImageInfo based on descriptor type.
-void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSet& value)
+// Determines which of the VkWriteDescriptorSet descriptor arrays are ignored for the descriptor type.  Returns false
+// if the descriptor type is not recognized.
+static bool GetWriteDescriptorSetOmitFlags(VkDescriptorType type,
+                                           bool*            omit_image_data,
+                                           bool*            omit_buffer_data,
+                                           bool*            omit_texel_buffer_data)
 {
-    encoder->EncodeEnumValue(value.sType);
-    EncodePNextStruct(encoder, value.pNext);
-    encoder->EncodeHandleValue(value.dstSet);
-    encoder->EncodeUInt32Value(value.dstBinding);
-    encoder->EncodeUInt32Value(value.dstArrayElement);
-    encoder->EncodeUInt32Value(value.descriptorCount);
-    encoder->EncodeEnumValue(value.descriptorType);
-
-    bool omit_image_data        = true;
-    bool omit_buffer_data       = true;
-    bool omit_texel_buffer_data = true;
+    assert((omit_image_data != nullptr) && (omit_buffer_data != nullptr) && (omit_texel_buffer_data != nullptr));
 
-    switch (value.descriptorType)
+    switch (type)
     {
         case VK_DESCRIPTOR_TYPE_SAMPLER:
         case VK_DESCRIPTOR_TYPE_COMBINED_IMAGE_SAMPLER:
         case VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE:
         case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
         case VK_DESCRIPTOR_TYPE_INPUT_ATTACHMENT:
-            omit_image_data = false;
+            (*omit_image_data) = false;
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
         case VK_DESCRIPTOR_TYPE_UNIFORM_BUFFER_DYNAMIC:
         case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
-            omit_buffer_data = false;
+            (*omit_buffer_data) = false;
             break;
         case VK_DESCRIPTOR_TYPE_UNIFORM_TEXEL_BUFFER:
         case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
-            omit_texel_buffer_data = false;
+            (*omit_texel_buffer_data) = false;
             break;
         case VK_DESCRIPTOR_TYPE_INLINE_UNIFORM_BLOCK_EXT:
             // TODO
@@ -134,8 +128,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSet& value)
             // Handles are encoded in the VkWriteDescriptorSetAccelerationStructureKHR structure in the pNext chain
             break;
         default:
-            GFXRECON_LOG_WARNING("Attempting to track descriptor state for unrecognized descriptor type");
-            break;
+            return false;
+    }
+
+    return true;
+}
+
+// Encodes both VkWriteDescriptorSet and VkDescriptorImageInfo based on descriptor type.
+void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSet& value)
+{
+    encoder->EncodeEnumValue(value.sType);
+    EncodePNextStruct(encoder, value.pNext);
+    encoder->EncodeHandleValue(value.dstSet);
+    encoder->EncodeUInt32Value(value.dstBinding);
+    encoder->EncodeUInt32Value(value.dstArrayElement);
+    encoder->EncodeUInt32Value(value.descriptorCount);
+    encoder->EncodeEnumValue(value.descriptorType);
+
+    bool omit_image_data        = true;
+    bool omit_buffer_data       = true;
+    bool omit_texel_buffer_data = true;
+
+    if (!GetWriteDescriptorSetOmitFlags(
+            value.descriptorType, &omit_image_data, &omit_buffer_data, &omit_texel_buffer_data))
+    {
+        GFXRECON_LOG_WARNING("Attempting to track descriptor state for unrecognized descriptor type");
     }
 
     encoder->EncodeStructArrayPreamble(value.pImageInfo, value.descriptorCount, omit_image_data);
@@ -258,5 +275,169 @@ void EncodeStruct(ParameterEncoder* encoder, const SECURITY_ATTRIBUTES& value)
     encoder->EncodeInt32Value(value.bInheritHandle);
 }
 
+size_t ComputeEncodedSize(const VkClearColorValue& value)
+{
+    return ParameterEncodedSize::UInt32Array(value.uint32, 4);
+}
+
+size_t ComputeEncodedSize(const VkClearValue& value)
+{
+    return ComputeEncodedSize(value.color);
+}
+
+size_t ComputeEncodedSize(const VkPipelineExecutableStatisticValueKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+    return ParameterEncodedSize::UInt64Value();
+}
+
+size_t ComputeEncodedSize(const VkDeviceOrHostAddressKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+    return ParameterEncodedSize::VkDeviceAddressValue();
+}
+
+size_t ComputeEncodedSize(const VkDeviceOrHostAddressConstKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+    return ParameterEncodedSize::VkDeviceAddressValue();
+}
+
+size_t ComputeEncodedSize(VkDescriptorType type, const VkDescriptorImageInfo& value)
+{
+    // The sampler and image view are always encoded, as either a handle ID or a handle value.
+    GFXRECON_UNREFERENCED_PARAMETER(type);
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+    return ParameterEncodedSize::HandleValue() + ParameterEncodedSize::HandleValue() +
+           ParameterEncodedSize::EnumValue();
+}
+
+size_t ComputeEncodedSize(const VkWriteDescriptorSet& value)
+{
+    size_t size = ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+
+    bool omit_image_data        = true;
+    bool omit_buffer_data       = true;
+    bool omit_texel_buffer_data = true;
+
+    GetWriteDescriptorSetOmitFlags(value.descriptorType, &omit_image_data, &omit_buffer_data, &omit_texel_buffer_data);
+
+    size += ParameterEncodedSize::StructArrayPreamble(value.pImageInfo, value.descriptorCount, omit_image_data);
+    if (!omit_image_data && (value.pImageInfo != nullptr) && (value.descriptorCount > 0))
+    {
+        for (size_t i = 0; i < value.descriptorCount; ++i)
+        {
+            size += ComputeEncodedSize(value.descriptorType, value.pImageInfo[i]);
+        }
+    }
+
+    size += ComputeStructArrayEncodedSize(value.pBufferInfo, value.descriptorCount, omit_buffer_data);
+    size += ParameterEncodedSize::HandleArray(value.pTexelBufferView, value.descriptorCount, omit_texel_buffer_data);
+
+    return size;
+}
+
+size_t ComputeEncodedSize(const VkPerformanceValueINTEL& value)
+{
+    size_t size = ParameterEncodedSize::EnumValue();
+
+    if (value.type == VK_PERFORMANCE_VALUE_TYPE_STRING_INTEL)
+    {
+        size += ParameterEncodedSize::String(value.data.valueString);
+    }
+    else
+    {
+        size += ParameterEncodedSize::UInt64Value();
+    }
+
+    return size;
+}
+
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryKHR& value)
+{
+    size_t size = ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    switch (value.geometryType)
+    {
+        case VK_GEOMETRY_TYPE_TRIANGLES_KHR:
+            size += ComputeEncodedSize(value.geometry.triangles);
+            break;
+        case VK_GEOMETRY_TYPE_AABBS_KHR:
+            size += ComputeEncodedSize(value.geometry.aabbs);
+            break;
+        case VK_GEOMETRY_TYPE_INSTANCES_KHR:
+            size += ComputeEncodedSize(value.geometry.instances);
+            break;
+        default:
+            break;
+    }
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
+// Size of a SID structure packed by pack_sid_struct.
+static size_t GetPackedSidSize(const SID* sid)
+{
+    assert(sid != nullptr);
+    return 2 + sizeof(sid->IdentifierAuthority.Value) + (sid->SubAuthorityCount * sizeof(uint32_t));
+}
+
+size_t ComputeEncodedSize(const ACL& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+    return ParameterEncodedSize::UInt8Value() + ParameterEncodedSize::UInt8Value() +
+           ParameterEncodedSize::UInt16Value() + ParameterEncodedSize::UInt16Value() +
+           ParameterEncodedSize::UInt16Value();
+}
+
+size_t ComputeEncodedSize(const SECURITY_DESCRIPTOR& value)
+{
+    size_t size = ParameterEncodedSize::UInt8Value() + ParameterEncodedSize::UInt8Value() +
+                  ParameterEncodedSize::UInt16Value();
+
+    // Owner and Group are encoded as arrays of bytes containing packed SID structures.
+    if (value.Owner != nullptr)
+    {
+        const SID* sid = reinterpret_cast<const SID*>(value.Owner);
+        size += ParameterEncodedSize::UInt8Array(sid, GetPackedSidSize(sid));
+    }
+    else
+    {
+        size += ParameterEncodedSize::UInt8Array(nullptr, 0);
+    }
+
+    if (value.Group != nullptr)
+    {
+        const SID* sid = reinterpret_cast<const SID*>(value.Group);
+        size += ParameterEncodedSize::UInt8Array(sid, GetPackedSidSize(sid));
+    }
+    else
+    {
+        size += ParameterEncodedSize::UInt8Array(nullptr, 0);
+    }
+
+    size += ComputeStructPtrEncodedSize(value.Sacl);
+    size += ComputeStructPtrEncodedSize(value.Dacl);
+
+    return size;
+}
+
+size_t ComputeEncodedSize(const SECURITY_ATTRIBUTES& value)
+{
+    size_t size = ParameterEncodedSize::UInt32Value();
+    size += ComputeStructPtrEncodedSize(reinterpret_cast<SECURITY_DESCRIPTOR*>(value.lpSecurityDescriptor));
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -51,6 +51,20 @@ void EncodeStruct(ParameterEncoder* encoder, const ACL& value);
 void EncodeStruct(ParameterEncoder* encoder, const SECURITY_DESCRIPTOR& value);
 void EncodeStruct(ParameterEncoder* encoder, const SECURITY_ATTRIBUTES& value);
 
+// Encoded sizes for the custom encoders.
+size_t ComputeEncodedSize(const VkClearColorValue& value);
+size_t ComputeEncodedSize(const VkClearValue& value);
+size_t ComputeEncodedSize(const VkPipelineExecutableStatisticValueKHR& value);
+size_t ComputeEncodedSize(const VkDeviceOrHostAddressKHR& value);
+size_t ComputeEncodedSize(const VkDeviceOrHostAddressConstKHR& value);
+size_t ComputeEncodedSize(VkDescriptorType type, const VkDescriptorImageInfo& value);
+size_t ComputeEncodedSize(const VkWriteDescriptorSet& value);
+size_t ComputeEncodedSize(const VkPerformanceValueINTEL& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryKHR& value);
+size_t ComputeEncodedSize(const ACL& value);
+size_t ComputeEncodedSize(const SECURITY_DESCRIPTOR& value);
+size_t ComputeEncodedSize(const SECURITY_ATTRIBUTES& value);
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -0,0 +1,120 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "encode/flight_recorder.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+FlightRecorder::FlightRecorder(uint32_t first_frame) : current_stream_(nullptr)
+{
+    // The state is empty when capture starts, so the first epoch does not require a checkpoint.
+    Epoch epoch;
+    epoch.first_frame = first_frame;
+    epoch.checkpoint  = AcquireStream();
+    epoch.calls       = AcquireStream();
+    current_stream_   = epoch.calls.get();
+
+    epochs_.emplace_back(std::move(epoch));
+}
+
+uint64_t FlightRecorder::GetBytesWritten()
+{
+    uint64_t size = 0;
+
+    for (const auto& epoch : epochs_)
+    {
+        size += epoch.checkpoint->GetDataSize() + epoch.calls->GetDataSize();
+    }
+
+    return size;
+}
+
+void FlightRecorder::BeginCheckpoint(uint32_t frame)
+{
+    while (epochs_.size() > 1)
+    {
+        ReleaseStream(std::move(epochs_.front().checkpoint));
+        ReleaseStream(std::move(epochs_.front().calls));
+        epochs_.pop_front();
+    }
+
+    Epoch epoch;
+    epoch.first_frame = frame;
+    epoch.checkpoint  = AcquireStream();
+    epoch.calls       = AcquireStream();
+    current_stream_   = epoch.checkpoint.get();
+
+    epochs_.emplace_back(std::move(epoch));
+}
+
+void FlightRecorder::EndCheckpoint()
+{
+    assert(!epochs_.empty());
+    current_stream_ = epochs_.back().calls.get();
+}
+
+void FlightRecorder::WriteTo(util::OutputStream* output_stream) const
+{
+    assert((output_stream != nullptr) && !epochs_.empty());
+
+    // Only the oldest checkpoint is written.  The API calls from the oldest epoch transition the state from its
+    // checkpoint to the state captured by the newer checkpoints, which are redundant.
+    const util::MemoryOutputStream* checkpoint = epochs_.front().checkpoint.get();
+    if (checkpoint->GetDataSize() > 0)
+    {
+        output_stream->Write(checkpoint->GetData(), checkpoint->GetDataSize());
+    }
+
+    for (const auto& epoch : epochs_)
+    {
+        if (epoch.calls->GetDataSize() > 0)
+        {
+            output_stream->Write(epoch.calls->GetData(), epoch.calls->GetDataSize());
+        }
+    }
+}
+
+std::unique_ptr<util::MemoryOutputStream> FlightRecorder::AcquireStream()
+{
+    if (free_streams_.empty())
+    {
+        return std::make_unique<util::MemoryOutputStream>();
+    }
+
+    auto stream = std::move(free_streams_.back());
+    free_streams_.pop_back();
+
+    return stream;
+}
+
+void FlightRecorder::ReleaseStream(std::unique_ptr<util::MemoryOutputStream> stream)
+{
+    // The buffer's capacity is retained, so that steady state recording does not allocate memory.
+    stream->Reset();
+    free_streams_.emplace_back(std::move(stream));
+}
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,94 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_ENCODE_FLIGHT_RECORDER_H
+#define GFXRECON_ENCODE_FLIGHT_RECORDER_H
+
+#include "util/defines.h"
+#include "util/memory_output_stream.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Output stream that retains the most recent capture data in memory, for writing to a capture file on demand.  Data is
+// grouped into epochs, each starting with a checkpoint containing a snapshot of the capture state, followed by the API
+// call data that was written after the checkpoint.  Starting a new checkpoint releases all but the most recent epoch,
+// so the recorder retains between one and two checkpoint intervals of API calls, and the oldest retained checkpoint
+// always provides the state required to replay them.
+class FlightRecorder : public util::OutputStream
+{
+  public:
+    FlightRecorder(uint32_t first_frame);
+
+    virtual ~FlightRecorder() override {}
+
+    virtual bool IsValid() override { return true; }
+
+    virtual size_t Write(const void* data, size_t len) override { return current_stream_->Write(data, len); }
+
+    // Total size of the retained data.
+    virtual uint64_t GetBytesWritten() override;
+
+    // Starts a new epoch for the specified frame, releasing the oldest epoch so that only the previous epoch is
+    // retained.  Data written until the call to EndCheckpoint() is stored as the checkpoint for the new epoch.
+    void BeginCheckpoint(uint32_t frame);
+
+    void EndCheckpoint();
+
+    // First frame of the API call data that will be written by WriteTo().
+    uint32_t GetFirstFrame() const { return epochs_.front().first_frame; }
+
+    // Frame of the most recent checkpoint.
+    uint32_t GetCheckpointFrame() const { return epochs_.back().first_frame; }
+
+    // Writes the checkpoint of the oldest retained epoch, followed by the API call data of all retained epochs.
+    void WriteTo(util::OutputStream* output_stream) const;
+
+  private:
+    struct Epoch
+    {
+        uint32_t                                  first_frame{ 0 };
+        std::unique_ptr<util::MemoryOutputStream> checkpoint;
+        std::unique_ptr<util::MemoryOutputStream> calls;
+    };
+
+  private:
+    std::unique_ptr<util::MemoryOutputStream> AcquireStream();
+
+    void ReleaseStream(std::unique_ptr<util::MemoryOutputStream> stream);
+
+  private:
+    std::deque<Epoch>                                      epochs_;
+    std::vector<std::unique_ptr<util::MemoryOutputStream>> free_streams_; // Buffers retained for reuse by new epochs.
+    util::MemoryOutputStream*                              current_stream_;
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_FLIGHT_RECORDER_H
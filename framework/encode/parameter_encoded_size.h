@@ -0,0 +1,231 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+
+#ifndef GFXRECON_ENCODE_PARAMETER_ENCODED_SIZE_H
+#define GFXRECON_ENCODE_PARAMETER_ENCODED_SIZE_H
+
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/platform.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(encode)
+
+// Computes the number of bytes that the corresponding ParameterEncoder methods write for a value, so that the encoded
+// size of an API call's parameters can be computed before encoding and the parameter buffer sized with a single
+// allocation.  Each method has the name of the ParameterEncoder method without the "Encode" prefix, and must be kept
+// consistent with the encoding performed by that method.
+class ParameterEncodedSize
+{
+  public:
+    // clang-format off
+
+    // Values
+    static constexpr size_t UInt8Value()                                                                              { return sizeof(uint8_t); }
+    static constexpr size_t UInt16Value()                                                                             { return sizeof(uint16_t); }
+    static constexpr size_t Int32Value()                                                                              { return sizeof(int32_t); }
+    static constexpr size_t UInt32Value()                                                                             { return sizeof(uint32_t); }
+    static constexpr size_t Int64Value()                                                                              { return sizeof(int64_t); }
+    static constexpr size_t UInt64Value()                                                                             { return sizeof(uint64_t); }
+    static constexpr size_t FloatValue()                                                                              { return sizeof(float); }
+    static constexpr size_t VkBool32Value()                                                                           { return sizeof(VkBool32); }
+    static constexpr size_t VkSampleMaskValue()                                                                       { return sizeof(format::SampleMaskEncodeType); }
+    static constexpr size_t VkDeviceSizeValue()                                                                       { return sizeof(format::DeviceSizeEncodeType); }
+    static constexpr size_t VkDeviceAddressValue()                                                                    { return sizeof(format::DeviceSizeEncodeType); }
+    static constexpr size_t SizeTValue()                                                                              { return sizeof(format::SizeTEncodeType); }
+    static constexpr size_t HandleIdValue()                                                                           { return sizeof(format::HandleEncodeType); }
+    static constexpr size_t Address()                                                                                 { return sizeof(format::AddressEncodeType); }
+    static constexpr size_t VoidPtr()                                                                                 { return sizeof(format::AddressEncodeType); }
+    static constexpr size_t FunctionPtr()                                                                             { return sizeof(format::AddressEncodeType); }
+    static constexpr size_t HandleValue()                                                                             { return sizeof(format::HandleEncodeType); }
+    static constexpr size_t EnumValue()                                                                               { return sizeof(format::EnumEncodeType); }
+    static constexpr size_t FlagsValue()                                                                              { return sizeof(format::FlagsEncodeType); }
+
+    // Pointers
+    static size_t Int32Ptr(const int32_t* ptr, bool omit_data = false, bool omit_addr = false)                        { return Pointer<int32_t>(ptr, omit_data, omit_addr); }
+    static size_t UInt32Ptr(const uint32_t* ptr, bool omit_data = false, bool omit_addr = false)                      { return Pointer<uint32_t>(ptr, omit_data, omit_addr); }
+    static size_t Int64Ptr(const int64_t* ptr, bool omit_data = false, bool omit_addr = false)                        { return Pointer<int64_t>(ptr, omit_data, omit_addr); }
+    static size_t UInt64Ptr(const uint64_t* ptr, bool omit_data = false, bool omit_addr = false)                      { return Pointer<uint64_t>(ptr, omit_data, omit_addr); }
+    static size_t FloatPtr(const float* ptr, bool omit_data = false, bool omit_addr = false)                          { return Pointer<float>(ptr, omit_data, omit_addr); }
+    static size_t VkBool32Ptr(const VkBool32* ptr, bool omit_data = false, bool omit_addr = false)                    { return Pointer<VkBool32>(ptr, omit_data, omit_addr); }
+    static size_t VkSampleMaskPtr(const VkSampleMask* ptr, bool omit_data = false, bool omit_addr = false)            { return Pointer<format::SampleMaskEncodeType>(ptr, omit_data, omit_addr); }
+    static size_t VkDeviceSizePtr(const VkDeviceSize* ptr, bool omit_data = false, bool omit_addr = false)            { return Pointer<format::DeviceSizeEncodeType>(ptr, omit_data, omit_addr); }
+    static size_t SizeTPtr(const size_t* ptr, bool omit_data = false, bool omit_addr = false)                         { return Pointer<format::SizeTEncodeType>(ptr, omit_data, omit_addr); }
+    static size_t HandleIdPtr(const format::HandleId* ptr, bool omit_data = false, bool omit_addr = false)            { return Pointer<format::HandleEncodeType>(ptr, omit_data, omit_addr); }
+    template<typename T>
+    static size_t VoidPtrPtr(const T* const* ptr, bool omit_data = false, bool omit_addr = false)                     { return Pointer<format::AddressEncodeType>(ptr, omit_data, omit_addr); }
+    template<typename T>
+    static size_t HandlePtr(const T* ptr, bool omit_data = false, bool omit_addr = false)                             { return Pointer<format::HandleEncodeType>(ptr, omit_data, omit_addr); }
+    template<typename T>
+    static size_t EnumPtr(const T* ptr, bool omit_data = false, bool omit_addr = false)                               { return Pointer<format::EnumEncodeType>(ptr, omit_data, omit_addr); }
+    template<typename T>
+    static size_t FlagsPtr(const T* ptr, bool omit_data = false, bool omit_addr = false)                              { return Pointer<format::FlagsEncodeType>(ptr, omit_data, omit_addr); }
+
+    // Arrays
+    static size_t Int32Array(const int32_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)          { return Array<int32_t>(arr, len, omit_data, omit_addr); }
+    static size_t UInt32Array(const uint32_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)        { return Array<uint32_t>(arr, len, omit_data, omit_addr); }
+    static size_t Int64Array(const int64_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)          { return Array<int64_t>(arr, len, omit_data, omit_addr); }
+    static size_t UInt64Array(const uint64_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)        { return Array<uint64_t>(arr, len, omit_data, omit_addr); }
+    static size_t FloatArray(const float* arr, size_t len, bool omit_data = false, bool omit_addr = false)            { return Array<float>(arr, len, omit_data, omit_addr); }
+    static size_t VkBool32Array(const VkBool32* arr, size_t len, bool omit_data = false, bool omit_addr = false)      { return Array<VkBool32>(arr, len, omit_data, omit_addr); }
+    static size_t VkSampleMaskArray(const VkSampleMask* arr, size_t len, bool omit_data = false, bool omit_addr = false) { return Array<format::SampleMaskEncodeType>(arr, len, omit_data, omit_addr); }
+    static size_t VkDeviceSizeArray(const VkDeviceSize* arr, size_t len, bool omit_data = false, bool omit_addr = false) { return Array<format::DeviceSizeEncodeType>(arr, len, omit_data, omit_addr); }
+    static size_t VkDeviceAddressArray(const VkDeviceAddress* arr, size_t len, bool omit_data = false, bool omit_addr = false) { return Array<format::DeviceAddressEncodeType>(arr, len, omit_data, omit_addr); }
+    static size_t SizeTArray(const size_t* arr, size_t len, bool omit_data = false, bool omit_addr = false)           { return Array<format::SizeTEncodeType>(arr, len, omit_data, omit_addr); }
+    static size_t HandleIdArray(const format::HandleId* arr, size_t len, bool omit_data = false, bool omit_addr = false) { return Array<format::HandleEncodeType>(arr, len, omit_data, omit_addr); }
+    static size_t UInt8Array(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)             { return Array<uint8_t>(arr, len, omit_data, omit_addr); }
+    static size_t VoidArray(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)              { return Array<uint8_t>(arr, len, omit_data, omit_addr); }
+    template<typename T>
+    static size_t HandleArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)               { return Array<format::HandleEncodeType>(arr, len, omit_data, omit_addr); }
+    template<typename T>
+    static size_t EnumArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                 { return Array<format::EnumEncodeType>(arr, len, omit_data, omit_addr); }
+    template<typename T>
+    static size_t FlagsArray(const T* arr, size_t len, bool omit_data = false, bool omit_addr = false)                { return Array<format::FlagsEncodeType>(arr, len, omit_data, omit_addr); }
+
+    static size_t String(const char* str, bool omit_data = false, bool omit_addr = false)                             { return BasicString<format::CharEncodeType>(str, omit_data, omit_addr); }
+    static size_t WString(const wchar_t* str, bool omit_data = false, bool omit_addr = false)                         { return BasicString<format::WCharEncodeType>(str, omit_data, omit_addr); }
+    static size_t StringArray(const char* const* str, size_t len, bool omit_data = false, bool omit_addr = false)     { return BasicStringArray<format::CharEncodeType>(str, len, omit_data, omit_addr); }
+    static size_t WStringArray(const wchar_t* const* str, size_t len, bool omit_data = false, bool omit_addr = false) { return BasicStringArray<format::WCharEncodeType>(str, len, omit_data, omit_addr); }
+
+    // 2D Arrays
+    template<typename SizeT>
+    static size_t UInt32Array2D(const uint32_t* const* arr, SizeT size_2d, bool omit_data = false, bool omit_addr = false) { return Array2D(arr, size_2d, omit_data, omit_addr); }
+
+    template <size_t N, size_t M>
+    static size_t Float2DMatrix(const float (&arr)[N][M], size_t n, size_t m, bool omit_data = false, bool omit_addr = false) { assert((N == n) && (M == m)); return Array<float>(arr, n * m, omit_data, omit_addr); }
+
+    // clang-format on
+
+    static size_t StructPtrPreamble(const void* ptr, bool omit_data = false, bool omit_addr = false)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(omit_data);
+        return PointerPreamble(ptr, omit_addr);
+    }
+
+    static size_t StructArrayPreamble(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(len);
+        GFXRECON_UNREFERENCED_PARAMETER(omit_data);
+        return ArrayPreamble(arr, omit_addr);
+    }
+
+    static size_t StructArray2DPreamble(const void* arr, size_t len, bool omit_data = false, bool omit_addr = false)
+    {
+        GFXRECON_UNREFERENCED_PARAMETER(len);
+        GFXRECON_UNREFERENCED_PARAMETER(omit_data);
+        return ArrayPreamble(arr, omit_addr);
+    }
+
+  private:
+    // Pointer attributes, followed by the address when the pointer is not null and the address is not omitted.
+    static size_t PointerPreamble(const void* ptr, bool omit_addr)
+    {
+        return sizeof(uint32_t) + (((ptr != nullptr) && !omit_addr) ? sizeof(format::AddressEncodeType) : 0);
+    }
+
+    // Pointer preamble, followed by the array length when the pointer is not null.
+    static size_t ArrayPreamble(const void* arr, bool omit_addr)
+    {
+        return PointerPreamble(arr, omit_addr) + ((arr != nullptr) ? sizeof(format::SizeTEncodeType) : 0);
+    }
+
+    template <typename EncodeT>
+    static size_t Pointer(const void* ptr, bool omit_data, bool omit_addr)
+    {
+        return PointerPreamble(ptr, omit_addr) + (((ptr != nullptr) && !omit_data) ? sizeof(EncodeT) : 0);
+    }
+
+    template <typename EncodeT>
+    static size_t Array(const void* arr, size_t len, bool omit_data, bool omit_addr)
+    {
+        return ArrayPreamble(arr, omit_addr) + (((arr != nullptr) && !omit_data) ? (len * sizeof(EncodeT)) : 0);
+    }
+
+    template <typename SizeT>
+    static size_t Array2D(const uint32_t* const* arr, SizeT size_2d, bool omit_data, bool omit_addr)
+    {
+        size_t size = ArrayPreamble(arr, omit_addr);
+
+        if ((arr != nullptr) && !omit_data)
+        {
+            for (size_t i = 0; i < size_2d.size(); ++i)
+            {
+                // The inner array length is written for both null and non-null inner arrays.
+                size += PointerPreamble(arr[i], omit_addr) + sizeof(format::SizeTEncodeType);
+
+                if (arr[i] != nullptr)
+                {
+                    size += size_2d[i] * sizeof(uint32_t);
+                }
+            }
+        }
+
+        return size;
+    }
+
+    template <typename EncodeT, typename CharT>
+    static size_t BasicString(const CharT* str, bool omit_data, bool omit_addr)
+    {
+        size_t size = PointerPreamble(str, omit_addr);
+
+        if (str != nullptr)
+        {
+            // The string length is always written.
+            size += sizeof(format::SizeTEncodeType);
+
+            if (!omit_data)
+            {
+                size += util::platform::StringLength(str) * sizeof(EncodeT);
+            }
+        }
+
+        return size;
+    }
+
+    template <typename EncodeT, typename CharT>
+    static size_t BasicStringArray(const CharT* const* str, size_t len, bool omit_data, bool omit_addr)
+    {
+        size_t size = ArrayPreamble(str, omit_addr);
+
+        if ((str != nullptr) && !omit_data)
+        {
+            for (size_t i = 0; i < len; ++i)
+            {
+                size += BasicString<EncodeT>(str[i], omit_data, omit_addr);
+            }
+        }
+
+        return size;
+    }
+};
+
+GFXRECON_END_NAMESPACE(encode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_ENCODE_PARAMETER_ENCODED_SIZE_H
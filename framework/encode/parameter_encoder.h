@@ -27,7 +27,7 @@
 #include "encode/vulkan_handle_wrapper_util.h"
 #include "format/format.h"
 #include "util/defines.h"
-#include "util/output_stream.h"
+#include "util/memory_output_stream.h"
 #include "util/platform.h"
 
 #include "vulkan/vulkan.h"
@@ -40,15 +40,20 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
+// Encodes API call parameters to a MemoryOutputStream.  The encoder writes through the concrete stream type, so that
+// each encoded value is an inlined copy to the stream's buffer instead of a virtual call.
 class ParameterEncoder
 {
   public:
-    ParameterEncoder(util::OutputStream* stream) : output_stream_(stream) {}
+    ParameterEncoder(util::MemoryOutputStream* stream) : output_stream_(stream) {}
 
     ~ParameterEncoder() {}
 
     void Reset() { output_stream_->Reset(); }
 
+    // Reserves buffer space for size bytes of additional parameter data.
+    void Reserve(size_t size) { output_stream_->Reserve(size); }
+
     // clang-format off
 
     // Values
@@ -522,7 +527,7 @@ class ParameterEncoder
     }
 
   private:
-    util::OutputStream* output_stream_;
+    util::MemoryOutputStream* output_stream_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
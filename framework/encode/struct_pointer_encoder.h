@@ -25,6 +25,7 @@
 #define GFXRECON_ENCODE_STRUCT_POINTER_ENCODER_H
 
 #include "encode/custom_vulkan_struct_encoders.h"
+#include "encode/parameter_encoded_size.h"
 #include "encode/parameter_encoder.h"
 #include "format/platform_types.h"
 #include "generated/generated_vulkan_struct_encoders.h"
@@ -106,6 +107,81 @@ typename std::enable_if<!std::is_integral<SizeT>::value>::type EncodeStructArray
     }
 }
 
+// The following functions compute the number of bytes written by the corresponding struct pointer encoding functions.
+
+template <typename T>
+size_t ComputeStructPtrEncodedSize(const T* value, bool omit_data = false, bool omit_addr = false)
+{
+    size_t size = ParameterEncodedSize::StructPtrPreamble(value, omit_data, omit_addr);
+
+    if ((value != nullptr) && !omit_data)
+    {
+        size += ComputeEncodedSize(*value);
+    }
+
+    return size;
+}
+
+template <typename T>
+size_t ComputeStructArrayEncodedSize(const T* value, size_t len, bool omit_data = false, bool omit_addr = false)
+{
+    size_t size = ParameterEncodedSize::StructArrayPreamble(value, len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (len > 0) && !omit_data)
+    {
+        for (size_t i = 0; i < len; ++i)
+        {
+            size += ComputeEncodedSize(value[i]);
+        }
+    }
+
+    return size;
+}
+
+template <typename T>
+size_t ComputeStructArray2DEncodedSize(
+    const T* const* value, size_t m, size_t n, bool omit_data = false, bool omit_addr = false)
+{
+    size_t size = ParameterEncodedSize::StructArray2DPreamble(value, m, omit_data, omit_addr);
+
+    if ((value != nullptr) && (m > 0) && !omit_data)
+    {
+        for (size_t i = 0; i < m; ++i)
+        {
+            size += ParameterEncodedSize::StructArrayPreamble(value[i], n, omit_data, omit_addr);
+            for (size_t j = 0; j < n; ++j)
+            {
+                size += ComputeEncodedSize(value[i][j]);
+            }
+        }
+    }
+
+    return size;
+}
+
+template <typename T, typename SizeT>
+typename std::enable_if<!std::is_integral<SizeT>::value, size_t>::type ComputeStructArray2DEncodedSize(
+    const T* const* value, const SizeT& size_2d, bool omit_data = false, bool omit_addr = false)
+{
+    const size_t outer_len = size_2d.size();
+    size_t       size      = ParameterEncodedSize::StructArray2DPreamble(value, outer_len, omit_data, omit_addr);
+
+    if ((value != nullptr) && (outer_len > 0))
+    {
+        for (size_t i = 0; i < outer_len; ++i)
+        {
+            const size_t inner_len = size_2d[i];
+            size += ParameterEncodedSize::StructArrayPreamble(value[i], inner_len, omit_data, omit_addr);
+            for (size_t j = 0; j < inner_len; ++j)
+            {
+                size += ComputeEncodedSize(value[i][j]);
+            }
+        }
+    }
+
+    return size;
+}
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
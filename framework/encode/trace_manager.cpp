@@ -32,12 +32,16 @@
 #include "generated/generated_vulkan_struct_handle_wrappers.h"
 #include "graphics/vulkan_util.h"
 #include "util/compressor.h"
+#include "util/direct_file_output_stream.h"
 #include "util/file_path.h"
+#include "util/local_socket.h"
 #include "util/logging.h"
 #include "util/page_guard_manager.h"
 #include "util/platform.h"
+#include "util/socket_output_stream.h"
 
 #include <cassert>
+#include <cinttypes>
 #include <unordered_set>
 
 #if defined(__linux__) && !defined(__ANDROID__)
@@ -71,7 +75,8 @@ LayerTable                                             TraceManager::layer_table
 
 std::atomic<format::HandleId> TraceManager::unique_id_counter_{ format::kNullHandleId };
 
-TraceManager::ThreadData::ThreadData() : thread_id_(GetThreadId()), call_id_(format::ApiCallId::ApiCall_Unknown)
+TraceManager::ThreadData::ThreadData() :
+    thread_id_(GetThreadId()), call_id_(format::ApiCallId::ApiCall_Unknown), profile_timestamp_(0)
 {
     parameter_buffer_  = std::make_unique<util::MemoryOutputStream>();
     parameter_encoder_ = std::make_unique<ParameterEncoder>(parameter_buffer_.get());
@@ -99,14 +104,32 @@ format::ThreadId TraceManager::ThreadData::GetThreadId()
 }
 
 TraceManager::TraceManager() :
-    force_file_flush_(false), timestamp_filename_(true),
+    force_file_flush_(false), direct_file_io_(false), timestamp_filename_(true),
     memory_tracking_mode_(CaptureSettings::MemoryTrackingMode::kPageGuard), page_guard_align_buffer_sizes_(false),
     page_guard_track_ahb_memory_(false), page_guard_memory_mode_(kMemoryModeShadowInternal), trim_enabled_(false),
-    trim_current_range_(0), current_frame_(kFirstFrame), capture_mode_(kModeWrite), previous_hotkey_state_(false)
+    trim_current_range_(0), current_frame_(kFirstFrame), capture_mode_(kModeWrite), previous_hotkey_state_(false),
+    capture_profile_metadata_(false), segment_enabled_(false), segment_frame_limit_(0), segment_size_limit_(0),
+    flight_recorder_(nullptr), flight_recorder_interval_(0), flight_recorder_frame_time_(0),
+    flight_recorder_next_trigger_frame_(0), frame_start_time_(0)
 {}
 
 TraceManager::~TraceManager()
 {
+    if (profiler_ != nullptr)
+    {
+        WriteCaptureProfileCmd();
+
+        if (!capture_profile_file_.empty())
+        {
+            profiler_->WriteSummaryFile(capture_profile_file_);
+        }
+    }
+
+    if (segment_enabled_ && (file_stream_ != nullptr))
+    {
+        FinishCaptureFileSegment();
+    }
+
     if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kPageGuard)
     {
         util::PageGuardManager::Destroy();
@@ -230,6 +253,14 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
     timestamp_filename_   = trace_settings.time_stamp_file;
     memory_tracking_mode_ = trace_settings.memory_tracking_mode;
     force_file_flush_     = trace_settings.force_flush;
+    direct_file_io_       = trace_settings.direct_io;
+
+    if (!trace_settings.capture_profile_file.empty() || trace_settings.capture_profile_metadata)
+    {
+        profiler_                 = std::make_unique<CaptureProfiler>();
+        capture_profile_file_     = trace_settings.capture_profile_file;
+        capture_profile_metadata_ = trace_settings.capture_profile_metadata;
+    }
 
     if (memory_tracking_mode_ == CaptureSettings::kPageGuard)
     {
@@ -268,13 +299,98 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
         page_guard_memory_mode_        = kMemoryModeDisabled;
     }
 
-    if (trace_settings.trim_ranges.empty() && trace_settings.trim_key.empty())
+    bool use_segments        = (trace_settings.segment_frames > 0) || (trace_settings.segment_size > 0);
+    bool use_flight_recorder = (trace_settings.flight_recorder_frames > 0);
+    bool use_trimming        = !trace_settings.trim_ranges.empty() || !trace_settings.trim_key.empty();
+
+    if (util::localsocket::IsSocketPath(base_filename_) || util::filepath::IsNamedPipe(base_filename_))
+    {
+        // A stream has a single reader that consumes the capture as it is written, so all output must go to the one
+        // stream, which must receive the capture from the first API call.
+        if (use_segments || use_flight_recorder || use_trimming)
+        {
+            GFXRECON_LOG_WARNING("Capture file segments, the flight recorder, and capture frame ranges are not "
+                                 "supported when streaming the capture to %s; ignoring these settings",
+                                 base_filename_.c_str());
+            use_segments        = false;
+            use_flight_recorder = false;
+            use_trimming        = false;
+        }
+
+        timestamp_filename_ = false;
+        direct_file_io_     = false;
+    }
+
+    if (use_flight_recorder && trace_settings.trim_ranges.empty())
+    {
+        if (use_segments)
+        {
+            GFXRECON_LOG_WARNING(
+                "Capture file segments are not supported with the flight recorder; ignoring segment settings");
+        }
+
+        // API calls are recorded to memory with periodic state checkpoints, which require state tracking.  Nothing is
+        // written to disk until the capture trigger hotkey is pressed or the frame time threshold is exceeded.
+        flight_recorder_interval_           = trace_settings.flight_recorder_frames;
+        flight_recorder_frame_time_         = static_cast<int64_t>(trace_settings.flight_recorder_frame_time) * 1000000;
+        flight_recorder_next_trigger_frame_ = current_frame_;
+        trim_key_                           = trace_settings.trim_key;
+        capture_mode_                       = kModeWriteAndTrack;
+
+        auto flight_recorder = std::make_unique<FlightRecorder>(current_frame_);
+        flight_recorder_     = flight_recorder.get();
+        file_stream_         = std::move(flight_recorder);
+
+        if (trim_key_.empty() && (flight_recorder_frame_time_ == 0))
+        {
+            GFXRECON_LOG_WARNING("The flight recorder is enabled without a capture trigger hotkey or frame time "
+                                 "threshold; no capture file will be written");
+        }
+        else
+        {
+            GFXRECON_LOG_INFO("Recording the last %u to %u frames of graphics API calls to memory",
+                              flight_recorder_interval_,
+                              flight_recorder_interval_ * 2);
+        }
+    }
+    else if (!use_trimming)
     {
-        // Use default kModeWrite capture mode.
-        success = CreateCaptureFile(base_filename_);
+        if (use_segments)
+        {
+            // Each segment after the first starts with a snapshot of the current state, which requires state tracking.
+            segment_enabled_     = true;
+            segment_frame_limit_ = trace_settings.segment_frames;
+            segment_size_limit_  = static_cast<uint64_t>(trace_settings.segment_size) * 1024 * 1024;
+            capture_mode_        = kModeWriteAndTrack;
+
+            // Apply the timestamp once, so that all segments and the manifest share the same base filename.
+            if (timestamp_filename_)
+            {
+                base_filename_      = util::filepath::GenerateTimestampedFilename(base_filename_);
+                timestamp_filename_ = false;
+            }
+
+            success = CreateCaptureFileSegment();
+        }
+        else
+        {
+            // Use default kModeWrite capture mode.
+            success = CreateCaptureFile(base_filename_);
+        }
     }
     else
     {
+        if (use_segments)
+        {
+            GFXRECON_LOG_WARNING("Capture file segments are not supported with trimming; ignoring segment settings");
+        }
+
+        if (use_flight_recorder)
+        {
+            GFXRECON_LOG_WARNING("The flight recorder is not supported with capture frame ranges; ignoring flight "
+                                 "recorder settings");
+        }
+
         // Override default kModeWrite capture mode.
         trim_enabled_ = true;
         trim_ranges_  = trace_settings.trim_ranges;
@@ -342,7 +458,7 @@ bool TraceManager::Initialize(std::string base_filename, const CaptureSettings::
 
         if ((capture_mode_ & kModeTrack) == kModeTrack)
         {
-            state_tracker_ = std::make_unique<VulkanStateTracker>();
+            state_tracker_ = std::make_unique<VulkanStateTracker>(trace_settings.resource_cache);
         }
     }
     else
@@ -357,11 +473,25 @@ ParameterEncoder* TraceManager::InitApiCallTrace(format::ApiCallId call_id)
 {
     auto thread_data      = GetThreadData();
     thread_data->call_id_ = call_id;
+
+    if (profiler_ != nullptr)
+    {
+        thread_data->profile_timestamp_ = static_cast<int64_t>(util::datetime::GetTimestamp());
+    }
+
     return thread_data->parameter_encoder_.get();
 }
 
 void TraceManager::EndApiCallTrace(ParameterEncoder* encoder)
 {
+    if (profiler_ != nullptr)
+    {
+        MarkProfilePhase(CaptureProfiler::kPhaseEncode);
+
+        auto thread_data = GetThreadData();
+        GetProfileCounters(thread_data)->AddCall(thread_data->call_id_);
+    }
+
     if ((capture_mode_ & kModeWrite) == kModeWrite)
     {
         assert(encoder != nullptr);
@@ -406,6 +536,8 @@ void TraceManager::EndApiCallTrace(ParameterEncoder* encoder)
                 compressed_header.block_header.size = packet_size;
                 not_compressed                      = false;
             }
+
+            MarkProfilePhase(CaptureProfiler::kPhaseCompression);
         }
 
         if (not_compressed)
@@ -428,6 +560,8 @@ void TraceManager::EndApiCallTrace(ParameterEncoder* encoder)
         {
             std::lock_guard<std::mutex> lock(file_lock_);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseFileLockWait);
+
             // Write appropriate function call block header.
             file_stream_->Write(header_pointer, header_size);
 
@@ -438,6 +572,8 @@ void TraceManager::EndApiCallTrace(ParameterEncoder* encoder)
             {
                 file_stream_->Flush();
             }
+
+            MarkProfilePhase(CaptureProfiler::kPhaseFileWrite);
         }
 
         encoder->Reset();
@@ -465,6 +601,7 @@ void TraceManager::CheckContinueCaptureForWriteMode()
         if (trim_ranges_[trim_current_range_].total == 0)
         {
             // Stop recording and close file.
+            WriteCaptureProfileCmd();
             capture_mode_ &= ~kModeWrite;
             file_stream_ = nullptr;
             GFXRECON_LOG_INFO("Finished recording graphics API capture");
@@ -501,6 +638,7 @@ void TraceManager::CheckContinueCaptureForWriteMode()
     else if (IsTrimHotkeyPressed())
     {
         // Stop recording and close file.
+        WriteCaptureProfileCmd();
         capture_mode_ &= ~kModeWrite;
         file_stream_ = nullptr;
         GFXRECON_LOG_INFO("Finished recording graphics API capture");
@@ -545,6 +683,11 @@ void TraceManager::CheckStartCaptureForTrackMode()
 
 void TraceManager::EndFrame()
 {
+    if (profiler_ != nullptr)
+    {
+        profiler_->EndFrame();
+    }
+
     if (trim_enabled_)
     {
         ++current_frame_;
@@ -562,6 +705,65 @@ void TraceManager::EndFrame()
             CheckStartCaptureForTrackMode();
         }
     }
+    else if (flight_recorder_ != nullptr)
+    {
+        ++current_frame_;
+
+        CheckFlightRecorderTriggers();
+    }
+    else if (segment_enabled_)
+    {
+        ++current_frame_;
+
+        CheckCaptureFileSegmentLimits();
+    }
+}
+
+void TraceManager::CheckFlightRecorderTriggers()
+{
+    assert(flight_recorder_ != nullptr);
+
+    int64_t timestamp  = static_cast<int64_t>(util::datetime::GetTimestamp());
+    int64_t frame_time = (frame_start_time_ > 0) ? (timestamp - frame_start_time_) : 0;
+    frame_start_time_  = timestamp;
+
+    bool triggered = !trim_key_.empty() && IsTrimHotkeyPressed();
+
+    // Frame time triggers are limited to one per checkpoint interval, so that a sequence of slow frames produces one
+    // capture file.  The first frame is never measured, as its time includes application initialization.
+    if ((flight_recorder_frame_time_ > 0) && (frame_time > flight_recorder_frame_time_) &&
+        (current_frame_ >= flight_recorder_next_trigger_frame_))
+    {
+        GFXRECON_LOG_INFO("Frame %u exceeded the flight recorder frame time threshold (%.3f ms)",
+                          current_frame_ - 1,
+                          util::datetime::ConvertTimestampToMilliseconds(frame_time));
+        triggered = true;
+    }
+
+    if (triggered)
+    {
+        WriteFlightRecorderCapture();
+    }
+
+    if ((current_frame_ - flight_recorder_->GetCheckpointFrame()) >= flight_recorder_interval_)
+    {
+        WriteFlightRecorderCheckpoint();
+    }
+}
+
+void TraceManager::CheckCaptureFileSegmentLimits()
+{
+    assert(!segments_.empty() && (file_stream_ != nullptr));
+
+    // Limits are checked at frame boundaries, so segments always contain complete frames and may exceed the size limit
+    // by up to one frame of data.
+    uint32_t segment_frames = current_frame_ - segments_.back().first_frame;
+
+    if (((segment_frame_limit_ > 0) && (segment_frames >= segment_frame_limit_)) ||
+        ((segment_size_limit_ > 0) && (file_stream_->GetBytesWritten() >= segment_size_limit_)))
+    {
+        StartNextCaptureFileSegment();
+    }
 }
 
 std::string TraceManager::CreateTrimFilename(const std::string&                base_filename,
@@ -597,12 +799,44 @@ bool TraceManager::CreateCaptureFile(const std::string& base_filename)
         capture_filename = util::filepath::GenerateTimestampedFilename(capture_filename);
     }
 
-    file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename);
+    if (direct_file_io_)
+    {
+#if defined(__linux__)
+        file_stream_ = std::make_unique<util::DirectFileOutputStream>(capture_filename);
+
+        if (!file_stream_->IsValid())
+        {
+            GFXRECON_LOG_WARNING("Direct I/O is not supported for %s, falling back to buffered file output",
+                                 capture_filename.c_str());
+            file_stream_ = nullptr;
+        }
+#else
+        GFXRECON_LOG_WARNING("Direct I/O for the capture file is not supported on this platform");
+#endif
+    }
+
+    if (util::localsocket::IsSocketPath(capture_filename))
+    {
+        file_stream_ = std::make_unique<util::SocketOutputStream>(util::localsocket::GetSocketPath(capture_filename));
+    }
+#if !defined(WIN32)
+    else if (util::filepath::IsNamedPipe(capture_filename))
+    {
+        // Named pipes are written with the socket stream, which stops streaming when the reader closes the pipe,
+        // instead of the file stream, which would raise SIGPIPE and terminate the application.
+        file_stream_ = std::make_unique<util::SocketOutputStream>(capture_filename, true);
+    }
+#endif
+    else if (file_stream_ == nullptr)
+    {
+        // Named pipes on Windows are written with the regular file stream, which blocks while the pipe is full.
+        file_stream_ = std::make_unique<util::FileOutputStream>(capture_filename);
+    }
 
     if (file_stream_->IsValid())
     {
         GFXRECON_LOG_INFO("Recording graphics API capture to %s", capture_filename.c_str());
-        WriteFileHeader();
+        WriteFileHeader(file_stream_.get());
     }
     else
     {
@@ -626,7 +860,164 @@ void TraceManager::ActivateTrimming()
     state_tracker_->WriteState(&state_writer, current_frame_);
 }
 
-void TraceManager::WriteFileHeader()
+bool TraceManager::CreateCaptureFileSegment()
+{
+    std::string index_string = std::to_string(segments_.size() + 1);
+    if (index_string.length() < 4)
+    {
+        index_string.insert(0, 4 - index_string.length(), '0');
+    }
+
+    CaptureFileSegment segment;
+    segment.filename    = util::filepath::InsertFilenamePostfix(base_filename_, "_segment_" + index_string);
+    segment.first_frame = current_frame_;
+
+    bool success = CreateCaptureFile(segment.filename);
+    if (success)
+    {
+        segments_.push_back(segment);
+    }
+
+    return success;
+}
+
+void TraceManager::StartNextCaptureFileSegment()
+{
+    WriteCaptureProfileCmd();
+
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    std::lock_guard<std::mutex> lock(file_lock_);
+
+    FinishCaptureFileSegment();
+
+    if (CreateCaptureFileSegment())
+    {
+        // Start the segment with a snapshot of the current state, so that it can be replayed independently of the
+        // previous segments.
+        VulkanStateWriter state_writer(file_stream_.get(), compressor_.get(), thread_data->thread_id_);
+        state_tracker_->WriteState(&state_writer, current_frame_);
+    }
+    else
+    {
+        GFXRECON_LOG_FATAL("Failed to create capture file segment; capture has been disabled");
+        segment_enabled_ = false;
+        capture_mode_    = kModeDisabled;
+    }
+}
+
+void TraceManager::FinishCaptureFileSegment()
+{
+    assert(!segments_.empty() && (file_stream_ != nullptr));
+
+    CaptureFileSegment& segment = segments_.back();
+    segment.frame_count         = current_frame_ - segment.first_frame;
+    segment.size                = file_stream_->GetBytesWritten();
+
+    file_stream_ = nullptr;
+
+    // The manifest is rewritten as each segment is finished, so that it remains valid if the application terminates
+    // without shutting down the capture layer.
+    WriteCaptureFileManifest();
+}
+
+void TraceManager::WriteCaptureFileManifest()
+{
+    std::string manifest_filename = base_filename_;
+    size_t      ext_index         = manifest_filename.rfind('.');
+    if (ext_index != std::string::npos)
+    {
+        manifest_filename.erase(ext_index);
+    }
+    manifest_filename += "_manifest.json";
+
+    FILE*   file   = nullptr;
+    int32_t result = util::platform::FileOpen(&file, manifest_filename.c_str(), "w");
+
+    if ((result != 0) || (file == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open capture file manifest %s", manifest_filename.c_str());
+        return;
+    }
+
+    fprintf(file, "{\n  \"segments\": [\n");
+
+    for (size_t i = 0; i < segments_.size(); ++i)
+    {
+        // Segments are written to the same directory as the manifest, and are listed without a path.
+        const CaptureFileSegment& segment  = segments_[i];
+        std::string               filename = segment.filename;
+        size_t                    sep      = filename.find_last_of("/\\");
+        if (sep != std::string::npos)
+        {
+            filename.erase(0, sep + 1);
+        }
+
+        fprintf(file,
+                "    { \"file\": \"%s\", \"first_frame\": %u, \"frame_count\": %u, \"size\": %" PRIu64 " }%s\n",
+                filename.c_str(),
+                segment.first_frame,
+                segment.frame_count,
+                segment.size,
+                ((i + 1) < segments_.size()) ? "," : "");
+    }
+
+    fprintf(file, "  ]\n}\n");
+
+    util::platform::FileClose(file);
+}
+
+void TraceManager::WriteFlightRecorderCheckpoint()
+{
+    auto thread_data = GetThreadData();
+    assert(thread_data != nullptr);
+
+    std::lock_guard<std::mutex> lock(file_lock_);
+
+    // The state snapshot is written to the flight recorder through file_stream_, which owns the recorder.
+    flight_recorder_->BeginCheckpoint(current_frame_);
+
+    VulkanStateWriter state_writer(file_stream_.get(), compressor_.get(), thread_data->thread_id_);
+    state_tracker_->WriteState(&state_writer, current_frame_);
+
+    flight_recorder_->EndCheckpoint();
+}
+
+void TraceManager::WriteFlightRecorderCapture()
+{
+    uint32_t    last_frame = current_frame_ - 1;
+    std::string filename =
+        util::filepath::InsertFilenamePostfix(base_filename_, "_flight_recorder_frame_" + std::to_string(last_frame));
+
+    if (timestamp_filename_)
+    {
+        filename = util::filepath::GenerateTimestampedFilename(filename);
+    }
+
+    std::lock_guard<std::mutex> lock(file_lock_);
+
+    util::FileOutputStream output_stream(filename);
+
+    if (output_stream.IsValid())
+    {
+        WriteFileHeader(&output_stream);
+        flight_recorder_->WriteTo(&output_stream);
+
+        GFXRECON_LOG_INFO("Wrote flight recorder capture of frames %u through %u to %s",
+                          flight_recorder_->GetFirstFrame(),
+                          last_frame,
+                          filename.c_str());
+    }
+    else
+    {
+        GFXRECON_LOG_ERROR("Failed to create flight recorder capture file %s", filename.c_str());
+    }
+
+    flight_recorder_next_trigger_frame_ = current_frame_ + flight_recorder_interval_;
+}
+
+void TraceManager::WriteFileHeader(util::OutputStream* output_stream)
 {
     std::vector<format::FileOptionPair> option_list;
 
@@ -638,12 +1029,14 @@ void TraceManager::WriteFileHeader()
     file_header.minor_version = 0;
     file_header.num_options   = static_cast<uint32_t>(option_list.size());
 
-    file_stream_->Write(&file_header, sizeof(file_header));
-    file_stream_->Write(option_list.data(), option_list.size() * sizeof(format::FileOptionPair));
+    assert(output_stream != nullptr);
+
+    output_stream->Write(&file_header, sizeof(file_header));
+    output_stream->Write(option_list.data(), option_list.size() * sizeof(format::FileOptionPair));
 
     if (force_file_flush_)
     {
-        file_stream_->Flush();
+        output_stream->Flush();
     }
 }
 
@@ -1043,6 +1436,26 @@ void TraceManager::WriteSetOpaqueAddressCommand(format::HandleId device_id,
     }
 }
 
+void TraceManager::WriteCaptureProfileCmd()
+{
+    if (((capture_mode_ & kModeWrite) == kModeWrite) && (profiler_ != nullptr) && capture_profile_metadata_)
+    {
+        auto thread_data = GetThreadData();
+        assert(thread_data != nullptr);
+
+        {
+            std::lock_guard<std::mutex> lock(file_lock_);
+
+            profiler_->WriteMetaDataBlock(file_stream_.get(), thread_data->thread_id_);
+
+            if (force_file_flush_)
+            {
+                file_stream_->Flush();
+            }
+        }
+    }
+}
+
 void TraceManager::SetDescriptorUpdateTemplateInfo(VkDescriptorUpdateTemplate                  update_template,
                                                    const VkDescriptorUpdateTemplateCreateInfo* create_info)
 {
@@ -2209,11 +2622,18 @@ void TraceManager::PreProcess_vkFlushMappedMemoryRanges(VkDevice
 
                     if ((current_memory_wrapper != nullptr) && (current_memory_wrapper->mapped_data != nullptr))
                     {
+                        int64_t start_time =
+                            (profiler_ != nullptr) ? static_cast<int64_t>(util::datetime::GetTimestamp()) : 0;
+
                         manager->ProcessMemoryEntry(
                             current_memory_wrapper->handle_id,
                             [this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
                                 WriteFillMemoryCmd(memory_id, offset, size, start_address);
                             });
+
+                        AddProfileTime(format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges,
+                                       CaptureProfiler::kPhaseMemoryTracking,
+                                       start_time);
                     }
                     else
                     {
@@ -2265,12 +2685,18 @@ void TraceManager::PreProcess_vkUnmapMemory(VkDevice device, VkDeviceMemory memo
             util::PageGuardManager* manager = util::PageGuardManager::Get();
             assert(manager != nullptr);
 
+            int64_t start_time =
+                (profiler_ != nullptr) ? static_cast<int64_t>(util::datetime::GetTimestamp()) : 0;
+
             manager->ProcessMemoryEntry(wrapper->handle_id,
                                         [this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
                                             WriteFillMemoryCmd(memory_id, offset, size, start_address);
                                         });
 
             manager->RemoveTrackedMemory(wrapper->handle_id);
+
+            AddProfileTime(
+                format::ApiCallId::ApiCall_vkUnmapMemory, CaptureProfiler::kPhaseMemoryTracking, start_time);
         }
         else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
         {
@@ -2388,9 +2814,13 @@ void TraceManager::PreProcess_vkQueueSubmit(VkQueue             queue,
         util::PageGuardManager* manager = util::PageGuardManager::Get();
         assert(manager != nullptr);
 
+        int64_t start_time = (profiler_ != nullptr) ? static_cast<int64_t>(util::datetime::GetTimestamp()) : 0;
+
         manager->ProcessMemoryEntries([this](uint64_t memory_id, void* start_address, size_t offset, size_t size) {
             WriteFillMemoryCmd(memory_id, offset, size, start_address);
         });
+
+        AddProfileTime(format::ApiCallId::ApiCall_vkQueueSubmit, CaptureProfiler::kPhaseMemoryTracking, start_time);
     }
     else if (memory_tracking_mode_ == CaptureSettings::MemoryTrackingMode::kUnassisted)
     {
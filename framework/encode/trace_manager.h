@@ -25,8 +25,10 @@
 #ifndef GFXRECON_ENCODE_TRACE_MANAGER_H
 #define GFXRECON_ENCODE_TRACE_MANAGER_H
 
+#include "encode/capture_profiler.h"
 #include "encode/capture_settings.h"
 #include "encode/descriptor_update_template_info.h"
+#include "encode/flight_recorder.h"
 #include "encode/parameter_encoder.h"
 #include "encode/vulkan_handle_wrapper_util.h"
 #include "encode/vulkan_handle_wrappers.h"
@@ -37,8 +39,10 @@
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "generated/generated_vulkan_command_buffer_util.h"
 #include "util/compressor.h"
+#include "util/date_time.h"
 #include "util/defines.h"
 #include "util/file_output_stream.h"
+#include "util/output_stream.h"
 #include "util/keyboard.h"
 #include "util/memory_output_stream.h"
 
@@ -131,8 +135,12 @@ class TraceManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
+
             state_tracker_->AddEntry<ParentHandle, Wrapper, CreateInfo>(
                 parent_handle, handle, create_info, thread_data->call_id_, thread_data->parameter_buffer_.get());
+
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -154,8 +162,12 @@ class TraceManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
+
             state_tracker_->AddPoolEntry<ParentHandle, Wrapper, AllocateInfo>(
                 parent_handle, count, handles, alloc_info, thread_data->call_id_, thread_data->parameter_buffer_.get());
+
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -179,6 +191,8 @@ class TraceManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
+
             state_tracker_->AddGroupEntry<ParentHandle, SecondaryHandle, Wrapper, CreateInfo>(
                 parent_handle,
                 secondary_handle,
@@ -187,6 +201,8 @@ class TraceManager
                 create_infos,
                 thread_data->call_id_,
                 thread_data->parameter_buffer_.get());
+
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -209,12 +225,16 @@ class TraceManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
+
             state_tracker_->AddStructGroupEntry(parent_handle,
                                                 count,
                                                 handle_structs,
                                                 unwrap_struct_handle,
                                                 thread_data->call_id_,
                                                 thread_data->parameter_buffer_.get());
+
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -227,7 +247,10 @@ class TraceManager
         if ((capture_mode_ & kModeTrack) == kModeTrack)
         {
             assert(state_tracker_ != nullptr);
+
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
             state_tracker_->RemoveEntry<Wrapper>(handle);
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -241,10 +264,14 @@ class TraceManager
         {
             assert(state_tracker_ != nullptr);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
+
             for (uint32_t i = 0; i < count; ++i)
             {
                 state_tracker_->RemoveEntry<Wrapper>(handles[i]);
             }
+
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -259,7 +286,9 @@ class TraceManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
             state_tracker_->TrackCommand(command_buffer, thread_data->call_id_, thread_data->parameter_buffer_.get());
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -278,8 +307,12 @@ class TraceManager
             auto thread_data = GetThreadData();
             assert(thread_data != nullptr);
 
+            MarkProfilePhase(CaptureProfiler::kPhaseEncode);
+
             state_tracker_->TrackCommand(
                 command_buffer, thread_data->call_id_, thread_data->parameter_buffer_.get(), func, args...);
+
+            MarkProfilePhase(CaptureProfiler::kPhaseStateTracking);
         }
 
         EndApiCallTrace(encoder);
@@ -293,6 +326,10 @@ class TraceManager
 
     void CheckStartCaptureForTrackMode();
 
+    void CheckCaptureFileSegmentLimits();
+
+    void CheckFlightRecorderTriggers();
+
     bool IsTrimHotkeyPressed();
 
     void WriteDisplayMessageCmd(const char* message);
@@ -927,12 +964,14 @@ class TraceManager
         ~ThreadData() {}
 
       public:
-        const format::ThreadId                    thread_id_;
-        format::ApiCallId                         call_id_;
-        std::unique_ptr<util::MemoryOutputStream> parameter_buffer_;
-        std::unique_ptr<ParameterEncoder>         parameter_encoder_;
-        std::vector<uint8_t>                      compressed_buffer_;
-        HandleUnwrapMemory                        handle_unwrap_memory_;
+        const format::ThreadId                           thread_id_;
+        format::ApiCallId                                call_id_;
+        std::unique_ptr<util::MemoryOutputStream>        parameter_buffer_;
+        std::unique_ptr<ParameterEncoder>                parameter_encoder_;
+        std::vector<uint8_t>                             compressed_buffer_;
+        HandleUnwrapMemory                               handle_unwrap_memory_;
+        std::shared_ptr<CaptureProfiler::ThreadCounters> profile_counters_;
+        int64_t                                          profile_timestamp_;
 
       private:
         static format::ThreadId GetThreadId();
@@ -951,6 +990,14 @@ class TraceManager
 
     typedef std::unordered_map<AHardwareBuffer*, HardwareBufferInfo> HardwareBufferMap;
 
+    struct CaptureFileSegment
+    {
+        std::string filename;
+        uint32_t    first_frame{ 0 };
+        uint32_t    frame_count{ 0 }; // Set when the segment is finished.
+        uint64_t    size{ 0 };        // Set when the segment is finished.
+    };
+
   private:
     ThreadData* GetThreadData()
     {
@@ -961,11 +1008,57 @@ class TraceManager
         return thread_data_.get();
     }
 
+    CaptureProfiler::ThreadCounters* GetProfileCounters(ThreadData* thread_data)
+    {
+        assert(profiler_ != nullptr);
+
+        // Thread data can outlive the profiler when the trace manager is destroyed and recreated, so the counters are
+        // replaced when they were not created by the current profiler.
+        if ((thread_data->profile_counters_ == nullptr) ||
+            (thread_data->profile_counters_->GetProfilerId() != profiler_->GetId()))
+        {
+            thread_data->profile_counters_ = profiler_->RegisterThread();
+        }
+
+        return thread_data->profile_counters_.get();
+    }
+
+    // Attribute the time elapsed since the previous mark to the specified phase of the current API call.
+    void MarkProfilePhase(CaptureProfiler::Phase phase)
+    {
+        if (profiler_ != nullptr)
+        {
+            auto    thread_data = GetThreadData();
+            int64_t timestamp   = static_cast<int64_t>(util::datetime::GetTimestamp());
+
+            GetProfileCounters(thread_data)
+                ->AddTime(thread_data->call_id_, phase, timestamp - thread_data->profile_timestamp_);
+            thread_data->profile_timestamp_ = timestamp;
+        }
+    }
+
+    // Attribute the time elapsed since the specified start time to the specified phase of an API call that has not
+    // been started with InitApiCallTrace, such as the memory tracking performed by a pre-call handler.
+    void AddProfileTime(format::ApiCallId call_id, CaptureProfiler::Phase phase, int64_t start_time)
+    {
+        if (profiler_ != nullptr)
+        {
+            int64_t timestamp = static_cast<int64_t>(util::datetime::GetTimestamp());
+            GetProfileCounters(GetThreadData())->AddTime(call_id, phase, timestamp - start_time);
+        }
+    }
+
     std::string CreateTrimFilename(const std::string& base_filename, const CaptureSettings::TrimRange& trim_range);
     bool        CreateCaptureFile(const std::string& base_filename);
     void        ActivateTrimming();
-
-    void WriteFileHeader();
+    bool        CreateCaptureFileSegment();
+    void        StartNextCaptureFileSegment();
+    void        FinishCaptureFileSegment();
+    void        WriteCaptureFileManifest();
+    void        WriteFlightRecorderCheckpoint();
+    void        WriteFlightRecorderCapture();
+
+    void WriteFileHeader(util::OutputStream* output_stream);
     void BuildOptionList(const format::EnabledOptions&        enabled_options,
                          std::vector<format::FileOptionPair>* option_list);
 
@@ -986,6 +1079,7 @@ class TraceManager
     void WriteSetDeviceMemoryPropertiesCommand(format::HandleId                        physical_device_id,
                                                const VkPhysicalDeviceMemoryProperties& memory_properties);
     void WriteSetOpaqueAddressCommand(format::HandleId device_id, format::HandleId object_id, uint64_t address);
+    void WriteCaptureProfileCmd();
 
     void SetDescriptorUpdateTemplateInfo(VkDescriptorUpdateTemplate                  update_template,
                                          const VkDescriptorUpdateTemplateCreateInfo* create_info);
@@ -1013,11 +1107,12 @@ class TraceManager
     static LayerTable                               layer_table_;
     static std::atomic<format::HandleId>            unique_id_counter_;
     format::EnabledOptions                          file_options_;
-    std::unique_ptr<util::FileOutputStream>         file_stream_;
+    std::unique_ptr<util::OutputStream>             file_stream_;
     std::string                                     base_filename_;
     std::mutex                                      file_lock_;
     bool                                            timestamp_filename_;
     bool                                            force_file_flush_;
+    bool                                            direct_file_io_;
     std::unique_ptr<util::Compressor>               compressor_;
     CaptureSettings::MemoryTrackingMode             memory_tracking_mode_;
     bool                                            page_guard_align_buffer_sizes_;
@@ -1035,6 +1130,18 @@ class TraceManager
     HardwareBufferMap                               hardware_buffers_;
     util::Keyboard                                  keyboard_;
     bool                                            previous_hotkey_state_;
+    std::unique_ptr<CaptureProfiler>                profiler_;
+    std::string                                     capture_profile_file_;
+    bool                                            capture_profile_metadata_;
+    bool                                            segment_enabled_;
+    uint32_t                                        segment_frame_limit_;
+    uint64_t                                        segment_size_limit_;
+    std::vector<CaptureFileSegment>                 segments_;
+    FlightRecorder*                                 flight_recorder_; // Owned by file_stream_ when enabled.
+    uint32_t                                        flight_recorder_interval_;
+    int64_t                                         flight_recorder_frame_time_; // Nanoseconds.
+    uint32_t                                        flight_recorder_next_trigger_frame_;
+    int64_t                                         frame_start_time_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
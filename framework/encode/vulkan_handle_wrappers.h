@@ -170,19 +170,27 @@ struct DeviceMemoryWrapper : public HandleWrapper<VkDeviceMemory>
     // State tracking info for memory with device addresses.
     format::HandleId device_id{ format::kNullHandleId };
     VkDeviceAddress  address{ 0 };
+
+    // Write sequence number from the most recent memory map or unmap.
+    uint64_t write_sequence{ 0 };
 };
 
 struct BufferWrapper : public HandleWrapper<VkBuffer>
 {
-    DeviceWrapper*   bind_device{ nullptr };
-    format::HandleId bind_memory_id{ format::kNullHandleId };
-    VkDeviceSize     bind_offset{ 0 };
-    uint32_t         queue_family_index{ 0 };
-    VkDeviceSize     created_size{ 0 };
+    DeviceWrapper*     bind_device{ nullptr };
+    format::HandleId   bind_memory_id{ format::kNullHandleId };
+    VkDeviceSize       bind_offset{ 0 };
+    uint32_t           queue_family_index{ 0 };
+    VkDeviceSize       created_size{ 0 };
+    VkBufferUsageFlags usage{ 0 };
 
     // State tracking info for buffers with device addresses.
     format::HandleId device_id{ format::kNullHandleId };
     VkDeviceAddress  address{ 0 };
+
+    // Write sequence number from the most recent command buffer submission that may have modified the buffer, which
+    // is compared with the sequence number of a cached state snapshot to determine if the cached data is still valid.
+    uint64_t write_sequence{ 0 };
 };
 
 struct ImageWrapper : public HandleWrapper<VkImage>
@@ -198,7 +206,11 @@ struct ImageWrapper : public HandleWrapper<VkImage>
     uint32_t              array_layers{ 0 };
     VkSampleCountFlagBits samples{};
     VkImageTiling         tiling{};
+    VkImageUsageFlags     usage{ 0 };
     VkImageLayout         current_layout{ VK_IMAGE_LAYOUT_UNDEFINED };
+
+    // Write sequence number from the most recent command buffer submission that may have modified the image.
+    uint64_t write_sequence{ 0 };
 };
 
 struct BufferViewWrapper : public HandleWrapper<VkBufferView>
@@ -30,7 +30,9 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
-VulkanStateTracker::VulkanStateTracker() {}
+VulkanStateTracker::VulkanStateTracker(bool cache_resource_data) :
+    cache_resource_data_(cache_resource_data), write_sequence_(0)
+{}
 
 VulkanStateTracker::~VulkanStateTracker() {}
 
@@ -273,6 +275,10 @@ void VulkanStateTracker::TrackMappedMemory(VkDevice         device,
     wrapper->mapped_offset = mapped_offset;
     wrapper->mapped_size   = mapped_size;
     wrapper->mapped_flags  = mapped_flags;
+
+    // Resources bound to mapped memory are always read back by state snapshots.  Recording the map and unmap
+    // sequence also invalidates cached data for host writes made while the memory was mapped.
+    wrapper->write_sequence = write_sequence_;
 }
 
 void VulkanStateTracker::TrackBeginRenderPass(VkCommandBuffer command_buffer, const VkRenderPassBeginInfo* begin_info)
@@ -389,6 +395,11 @@ void VulkanStateTracker::TrackCommandBufferSubmissions(uint32_t submit_count, co
                 auto command_wrapper = reinterpret_cast<CommandBufferWrapper*>(command_buffers[cmd]);
                 assert(command_wrapper != nullptr);
 
+                if (cache_resource_data_)
+                {
+                    TrackResourceWrites(command_wrapper);
+                }
+
                 // Apply pending image layouts.
                 for (const auto& layout_entry : command_wrapper->pending_layouts)
                 {
@@ -1157,5 +1168,166 @@ void VulkanStateTracker::DestroyState(SwapchainKHRWrapper* wrapper)
     }
 }
 
+void VulkanStateTracker::TrackResourceWrites(const CommandBufferWrapper* command_wrapper)
+{
+    assert(command_wrapper != nullptr);
+
+    // The handles recorded to the command buffer do not specify how the resource is accessed, so every buffer and image
+    // referenced by the command buffer is treated as written, unless its usage flags exclude device writes.
+    for (auto buffer_id : command_wrapper->command_handles[CommandHandleType::BufferHandle])
+    {
+        TrackBufferWrite(state_table_.GetBufferWrapper(buffer_id));
+    }
+
+    for (auto view_id : command_wrapper->command_handles[CommandHandleType::BufferViewHandle])
+    {
+        auto view_wrapper = state_table_.GetBufferViewWrapper(view_id);
+        if (view_wrapper != nullptr)
+        {
+            TrackBufferWrite(state_table_.GetBufferWrapper(view_wrapper->buffer_id));
+        }
+    }
+
+    for (auto image_id : command_wrapper->command_handles[CommandHandleType::ImageHandle])
+    {
+        TrackImageWrite(state_table_.GetImageWrapper(image_id));
+    }
+
+    // Image views include attachments provided at render pass begin for imageless framebuffers.
+    for (auto view_id : command_wrapper->command_handles[CommandHandleType::ImageViewHandle])
+    {
+        auto view_wrapper = state_table_.GetImageViewWrapper(view_id);
+        if (view_wrapper != nullptr)
+        {
+            TrackImageWrite(state_table_.GetImageWrapper(view_wrapper->image_id));
+        }
+    }
+
+    for (auto framebuffer_id : command_wrapper->command_handles[CommandHandleType::FramebufferHandle])
+    {
+        auto framebuffer_wrapper = state_table_.GetFramebufferWrapper(framebuffer_id);
+        if (framebuffer_wrapper != nullptr)
+        {
+            for (auto image_wrapper : framebuffer_wrapper->attachments)
+            {
+                TrackImageWrite(image_wrapper);
+            }
+        }
+    }
+
+    // Descriptor set content is checked at submission, as the descriptors may have been updated after the set was
+    // bound.  Only storage descriptors can be written by shaders.
+    for (auto set_id : command_wrapper->command_handles[CommandHandleType::DescriptorSetHandle])
+    {
+        auto set_wrapper = state_table_.GetDescriptorSetWrapper(set_id);
+        if (set_wrapper == nullptr)
+        {
+            continue;
+        }
+
+        for (const auto& binding_entry : set_wrapper->bindings)
+        {
+            const DescriptorInfo& binding = binding_entry.second;
+
+            for (uint32_t i = 0; i < binding.count; ++i)
+            {
+                if (!binding.written[i])
+                {
+                    continue;
+                }
+
+                switch (binding.type)
+                {
+                    case VK_DESCRIPTOR_TYPE_STORAGE_IMAGE:
+                    {
+                        auto view_wrapper = state_table_.GetImageViewWrapper(binding.handle_ids[i]);
+                        if (view_wrapper != nullptr)
+                        {
+                            TrackImageWrite(state_table_.GetImageWrapper(view_wrapper->image_id));
+                        }
+                        break;
+                    }
+                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER:
+                    case VK_DESCRIPTOR_TYPE_STORAGE_BUFFER_DYNAMIC:
+                        TrackBufferWrite(state_table_.GetBufferWrapper(binding.handle_ids[i]));
+                        break;
+                    case VK_DESCRIPTOR_TYPE_STORAGE_TEXEL_BUFFER:
+                    {
+                        auto view_wrapper = state_table_.GetBufferViewWrapper(binding.handle_ids[i]);
+                        if (view_wrapper != nullptr)
+                        {
+                            TrackBufferWrite(state_table_.GetBufferWrapper(view_wrapper->buffer_id));
+                        }
+                        break;
+                    }
+                    default:
+                        break;
+                }
+            }
+        }
+    }
+
+    // Secondary command buffers executed by the command buffer.
+    for (auto secondary_id : command_wrapper->command_handles[CommandHandleType::CommandBufferHandle])
+    {
+        auto secondary_wrapper = state_table_.GetCommandBufferWrapper(secondary_id);
+        if ((secondary_wrapper != nullptr) && (secondary_wrapper != command_wrapper))
+        {
+            TrackResourceWrites(secondary_wrapper);
+        }
+    }
+}
+
+void VulkanStateTracker::TrackBufferWrite(BufferWrapper* wrapper)
+{
+    const VkBufferUsageFlags kWritableUsage =
+        VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT |
+        VK_BUFFER_USAGE_STORAGE_TEXEL_BUFFER_BIT | VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_BUFFER_BIT_EXT |
+        VK_BUFFER_USAGE_TRANSFORM_FEEDBACK_COUNTER_BUFFER_BIT_EXT;
+
+    if ((wrapper != nullptr) && ((wrapper->usage & kWritableUsage) != 0))
+    {
+        if (wrapper->write_sequence != write_sequence_)
+        {
+            TrackMemoryWrite(wrapper->bind_memory_id, wrapper->bind_offset, wrapper->created_size);
+        }
+
+        wrapper->write_sequence = write_sequence_;
+    }
+}
+
+void VulkanStateTracker::TrackImageWrite(ImageWrapper* wrapper)
+{
+    const VkImageUsageFlags kWritableUsage = VK_IMAGE_USAGE_TRANSFER_DST_BIT | VK_IMAGE_USAGE_STORAGE_BIT |
+                                             VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT |
+                                             VK_IMAGE_USAGE_DEPTH_STENCIL_ATTACHMENT_BIT;
+
+    if ((wrapper != nullptr) && ((wrapper->usage & kWritableUsage) != 0))
+    {
+        if (wrapper->write_sequence != write_sequence_)
+        {
+            // The size of the image's memory binding is not tracked, so the write is assumed to extend to the end of
+            // the memory object.
+            TrackMemoryWrite(wrapper->bind_memory_id, wrapper->bind_offset, VK_WHOLE_SIZE);
+        }
+
+        wrapper->write_sequence = write_sequence_;
+    }
+}
+
+void VulkanStateTracker::TrackMemoryWrite(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size)
+{
+    // Resources may alias the memory bound to other resources, so the memory range is recorded to invalidate cached
+    // data for every resource that overlaps it.  Each resource records its range once per snapshot.
+    if (memory_id != format::kNullHandleId)
+    {
+        VulkanStateWriter::MemoryRange range;
+        range.offset = offset;
+        range.size   = size;
+
+        resource_data_cache_.written_memory_ranges[memory_id].push_back(range);
+    }
+}
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
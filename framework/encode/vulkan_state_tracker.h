@@ -48,7 +48,7 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateTracker
 {
   public:
-    VulkanStateTracker();
+    VulkanStateTracker(bool cache_resource_data = false);
 
     ~VulkanStateTracker();
 
@@ -57,6 +57,15 @@ class VulkanStateTracker
         if (writer != nullptr)
         {
             std::unique_lock<std::mutex> lock(mutex_);
+
+            if (cache_resource_data_)
+            {
+                writer->SetResourceDataCache(&resource_data_cache_, write_sequence_);
+
+                // Resource writes tracked after this point are not included in the snapshot.
+                ++write_sequence_;
+            }
+
             writer->WriteState(state_table_, frame_number);
         }
     }
@@ -425,9 +434,20 @@ class VulkanStateTracker
 
     void DestroyState(SwapchainKHRWrapper* wrapper);
 
+    void TrackResourceWrites(const CommandBufferWrapper* command_wrapper);
+
+    void TrackBufferWrite(BufferWrapper* wrapper);
+
+    void TrackImageWrite(ImageWrapper* wrapper);
+
+    void TrackMemoryWrite(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size);
+
   private:
-    std::mutex       mutex_;
-    VulkanStateTable state_table_;
+    std::mutex                           mutex_;
+    VulkanStateTable                     state_table_;
+    bool                                 cache_resource_data_;
+    uint64_t                             write_sequence_;
+    VulkanStateWriter::ResourceDataCache resource_data_cache_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
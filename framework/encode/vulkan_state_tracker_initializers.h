@@ -519,6 +519,7 @@ inline void InitializeState<VkDevice, BufferWrapper, VkBufferCreateInfo>(VkDevic
     wrapper->create_parameters = std::move(create_parameters);
 
     wrapper->created_size = create_info->size;
+    wrapper->usage        = create_info->usage;
 
     // TODO: Do we need to track the queue family that the buffer is actually used with?
     if ((create_info->queueFamilyIndexCount > 0) && (create_info->pQueueFamilyIndices != nullptr))
@@ -551,6 +552,7 @@ inline void InitializeState<VkDevice, ImageWrapper, VkImageCreateInfo>(VkDevice
     wrapper->array_layers = create_info->arrayLayers;
     wrapper->samples      = create_info->samples;
     wrapper->tiling       = create_info->tiling;
+    wrapper->usage        = create_info->usage;
 
     // TODO: Do we need to track the queue family that the image is actually used with?
     if ((create_info->queueFamilyIndexCount > 0) && (create_info->pQueueFamilyIndices != nullptr))
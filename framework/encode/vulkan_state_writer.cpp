@@ -29,6 +29,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cstring>
 #include <limits>
 #include <unordered_map>
 
@@ -80,11 +81,23 @@ static bool IsImageReadable(VkMemoryPropertyFlags      property_flags,
                                                    (memory_wrapper->mapped_size == VK_WHOLE_SIZE)))));
 }
 
-VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
-                                     util::Compressor*       compressor,
-                                     format::ThreadId        thread_id) :
+static bool IsCachedDataValid(const VulkanStateWriter::ResourceDataCacheEntry& entry,
+                              uint64_t                                         resource_write_sequence,
+                              const DeviceMemoryWrapper*                       memory_wrapper)
+{
+    // Mapped memory and memory shared with external allocations may be written by the host at any time, so resources
+    // bound to that memory are always read back.
+    return (resource_write_sequence <= entry.write_sequence) &&
+           (memory_wrapper->write_sequence <= entry.write_sequence) && (memory_wrapper->mapped_data == nullptr) &&
+           (memory_wrapper->external_allocation == nullptr) && (memory_wrapper->hardware_buffer == nullptr);
+}
+
+VulkanStateWriter::VulkanStateWriter(util::OutputStream* output_stream,
+                                     util::Compressor*   compressor,
+                                     format::ThreadId    thread_id) :
     output_stream_(output_stream),
-    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_)
+    compressor_(compressor), thread_id_(thread_id), encoder_(&parameter_stream_), resource_data_cache_(nullptr),
+    write_sequence_(0)
 {
     assert(output_stream != nullptr);
     assert(compressor != nullptr);
@@ -92,6 +105,12 @@ VulkanStateWriter::VulkanStateWriter(util::FileOutputStream* output_stream,
 
 VulkanStateWriter::~VulkanStateWriter() {}
 
+void VulkanStateWriter::SetResourceDataCache(ResourceDataCache* cache, uint64_t write_sequence)
+{
+    resource_data_cache_ = cache;
+    write_sequence_      = write_sequence;
+}
+
 void VulkanStateWriter::WriteState(const VulkanStateTable& state_table, uint64_t frame_number)
 {
     // clang-format off
@@ -1011,6 +1030,19 @@ void VulkanStateWriter::ProcessBufferMemory(const DeviceWrapper*
 
         assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
 
+        if (snapshot_entry.cached_data != nullptr)
+        {
+            ResourceDataCacheEntry* cached_data = snapshot_entry.cached_data;
+
+            auto upload_cmd       = reinterpret_cast<format::InitBufferCommandHeader*>(cached_data->block.data());
+            upload_cmd->thread_id = thread_id_;
+
+            output_stream_->Write(cached_data->block.data(), cached_data->block.size());
+
+            resource_data_cache_->buffers[buffer_wrapper->handle_id] = std::move(*cached_data);
+            continue;
+        }
+
         if (snapshot_entry.need_staging_copy)
         {
             VkCommandBufferBeginInfo begin_info = { VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO };
@@ -1114,6 +1146,15 @@ void VulkanStateWriter::ProcessBufferMemory(const DeviceWrapper*
             output_stream_->Write(&upload_cmd, sizeof(upload_cmd));
             output_stream_->Write(bytes, data_size);
 
+            if (resource_data_cache_ != nullptr)
+            {
+                ResourceDataCacheEntry& cache_entry = resource_data_cache_->buffers[buffer_wrapper->handle_id];
+                cache_entry.write_sequence          = write_sequence_;
+                cache_entry.block.resize(sizeof(upload_cmd) + data_size);
+                memcpy(cache_entry.block.data(), &upload_cmd, sizeof(upload_cmd));
+                memcpy(cache_entry.block.data() + sizeof(upload_cmd), bytes, data_size);
+            }
+
             if (snapshot_entry.need_staging_copy)
             {
                 device_table->UnmapMemory(device_wrapper->handle, staging_memory);
@@ -1156,6 +1197,22 @@ void VulkanStateWriter::ProcessImageMemory(const DeviceWrapper*
 
         assert((image_wrapper != nullptr) && (memory_wrapper != nullptr));
 
+        if (snapshot_entry.cached_data != nullptr)
+        {
+            // The image layout may have changed without modifying the image content.
+            ResourceDataCacheEntry* cached_data = snapshot_entry.cached_data;
+
+            auto upload_cmd       = reinterpret_cast<format::InitImageCommandHeader*>(cached_data->block.data());
+            upload_cmd->thread_id = thread_id_;
+            upload_cmd->layout    = image_wrapper->current_layout;
+
+            output_stream_->Write(cached_data->block.data(), cached_data->block.size());
+
+            resource_data_cache_->images[std::make_pair(image_wrapper->handle_id, snapshot_entry.aspect)] =
+                std::move(*cached_data);
+            continue;
+        }
+
         if (snapshot_entry.need_staging_copy)
         {
             VkImage        resolve_image  = VK_NULL_HANDLE;
@@ -1401,6 +1458,19 @@ void VulkanStateWriter::ProcessImageMemory(const DeviceWrapper*
             output_stream_->Write(snapshot_entry.level_sizes.data(), levels_size);
             output_stream_->Write(bytes, data_size);
 
+            if (resource_data_cache_ != nullptr)
+            {
+                ResourceDataCacheEntry& cache_entry =
+                    resource_data_cache_->images[std::make_pair(image_wrapper->handle_id, snapshot_entry.aspect)];
+                cache_entry.write_sequence = write_sequence_;
+                cache_entry.block.resize(sizeof(upload_cmd) + levels_size + data_size);
+
+                uint8_t* block = cache_entry.block.data();
+                memcpy(block, &upload_cmd, sizeof(upload_cmd));
+                memcpy(block + sizeof(upload_cmd), snapshot_entry.level_sizes.data(), levels_size);
+                memcpy(block + sizeof(upload_cmd) + levels_size, bytes, data_size);
+            }
+
             if (snapshot_entry.need_staging_copy)
             {
                 device_table->UnmapMemory(device_wrapper->handle, staging_memory);
@@ -1476,13 +1546,16 @@ void VulkanStateWriter::WriteBufferMemoryState(const VulkanStateTable& state_tab
             snapshot_info.memory_wrapper    = memory_wrapper;
             snapshot_info.memory_properties = GetMemoryProperties(device_wrapper, memory_wrapper, state_table);
             snapshot_info.need_staging_copy = !IsBufferReadable(snapshot_info.memory_properties, memory_wrapper);
+            snapshot_info.cached_data       = FindCachedBufferData(wrapper, memory_wrapper);
 
             if ((*max_resource_size) < wrapper->created_size)
             {
                 (*max_resource_size) = wrapper->created_size;
             }
 
-            if (snapshot_info.need_staging_copy && ((*max_staging_copy_size) < wrapper->created_size))
+            // Cached data does not require a staging copy.
+            if (snapshot_info.need_staging_copy && (snapshot_info.cached_data == nullptr) &&
+                ((*max_staging_copy_size) < wrapper->created_size))
             {
                 (*max_staging_copy_size) = wrapper->created_size;
             }
@@ -1565,6 +1638,8 @@ void VulkanStateWriter::WriteImageMemoryState(const VulkanStateTable& state_tabl
                     snapshot_info.memory_properties = memory_properties;
                     snapshot_info.need_staging_copy = need_staging_copy;
                     snapshot_info.aspect            = aspect;
+                    snapshot_info.cached_data =
+                        FindCachedImageData(wrapper, memory_wrapper, memory_requirements.size, aspect);
 
                     GetImageSizes(wrapper, &snapshot_info);
 
@@ -1573,7 +1648,8 @@ void VulkanStateWriter::WriteImageMemoryState(const VulkanStateTable& state_tabl
                         (*max_resource_size) = snapshot_info.resource_size;
                     }
 
-                    if (snapshot_info.need_staging_copy && ((*max_staging_copy_size) < snapshot_info.resource_size))
+                    if (snapshot_info.need_staging_copy && (snapshot_info.cached_data == nullptr) &&
+                        ((*max_staging_copy_size) < snapshot_info.resource_size))
                     {
                         (*max_staging_copy_size) = snapshot_info.resource_size;
                     }
@@ -1640,12 +1716,84 @@ void VulkanStateWriter::WriteImageSubresourceLayouts(const ImageWrapper* image_w
     }
 }
 
+bool VulkanStateWriter::IsMemoryRangeWritten(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size) const
+{
+    auto entry = previous_resource_data_.written_memory_ranges.find(memory_id);
+    if (entry != previous_resource_data_.written_memory_ranges.end())
+    {
+        for (const auto& range : entry->second)
+        {
+            if ((range.offset < (offset + size)) &&
+                ((range.size == VK_WHOLE_SIZE) || (offset < (range.offset + range.size))))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+VulkanStateWriter::ResourceDataCacheEntry*
+VulkanStateWriter::FindCachedBufferData(const BufferWrapper* buffer_wrapper, const DeviceMemoryWrapper* memory_wrapper)
+{
+    assert((buffer_wrapper != nullptr) && (memory_wrapper != nullptr));
+
+    // Writes through buffer device addresses are not tracked, so buffers that support them are always read back.
+    const VkBufferUsageFlags kAddressUsage =
+        VK_BUFFER_USAGE_SHADER_DEVICE_ADDRESS_BIT | VK_BUFFER_USAGE_ACCELERATION_STRUCTURE_STORAGE_BIT_KHR;
+
+    if ((resource_data_cache_ != nullptr) && ((buffer_wrapper->usage & kAddressUsage) == 0) &&
+        (buffer_wrapper->address == 0))
+    {
+        auto entry = previous_resource_data_.buffers.find(buffer_wrapper->handle_id);
+        if ((entry != previous_resource_data_.buffers.end()) &&
+            IsCachedDataValid(entry->second, buffer_wrapper->write_sequence, memory_wrapper) &&
+            !IsMemoryRangeWritten(
+                memory_wrapper->handle_id, buffer_wrapper->bind_offset, buffer_wrapper->created_size))
+        {
+            return &entry->second;
+        }
+    }
+
+    return nullptr;
+}
+
+VulkanStateWriter::ResourceDataCacheEntry*
+VulkanStateWriter::FindCachedImageData(const ImageWrapper*        image_wrapper,
+                                       const DeviceMemoryWrapper* memory_wrapper,
+                                       VkDeviceSize               memory_size,
+                                       VkImageAspectFlagBits      aspect)
+{
+    assert((image_wrapper != nullptr) && (memory_wrapper != nullptr));
+
+    if (resource_data_cache_ != nullptr)
+    {
+        auto entry = previous_resource_data_.images.find(std::make_pair(image_wrapper->handle_id, aspect));
+        if ((entry != previous_resource_data_.images.end()) &&
+            IsCachedDataValid(entry->second, image_wrapper->write_sequence, memory_wrapper) &&
+            !IsMemoryRangeWritten(memory_wrapper->handle_id, image_wrapper->bind_offset, memory_size))
+        {
+            return &entry->second;
+        }
+    }
+
+    return nullptr;
+}
+
 void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_table)
 {
     DeviceResourceTables resources;
     VkDeviceSize         max_resource_size     = 0;
     VkDeviceSize         max_staging_copy_size = 0;
 
+    // Cache entries are moved back to the cache as they are written, so that entries for resources that have been
+    // destroyed since the previous snapshot are released.
+    if (resource_data_cache_ != nullptr)
+    {
+        std::swap(previous_resource_data_, *resource_data_cache_);
+    }
+
     WriteBufferMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
     WriteImageMemoryState(state_table, &resources, &max_resource_size, &max_staging_copy_size);
 
@@ -1757,6 +1905,11 @@ void VulkanStateWriter::WriteResourceMemoryState(const VulkanStateTable& state_t
             GFXRECON_LOG_ERROR("Failed to create a staging buffer to process trim state");
         }
     }
+
+    // Release cached data for resources that were not part of the snapshot.
+    previous_resource_data_.buffers.clear();
+    previous_resource_data_.images.clear();
+    previous_resource_data_.written_memory_ranges.clear();
 }
 
 void VulkanStateWriter::WriteMappedMemoryState(const VulkanStateTable& state_table)
@@ -31,12 +31,15 @@
 #include "generated/generated_vulkan_dispatch_table.h"
 #include "util/compressor.h"
 #include "util/defines.h"
-#include "util/file_output_stream.h"
+#include "util/output_stream.h"
 #include "util/memory_output_stream.h"
 
 #include "vulkan/vulkan.h"
 
+#include <map>
 #include <set>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
@@ -45,10 +48,42 @@ GFXRECON_BEGIN_NAMESPACE(encode)
 class VulkanStateWriter
 {
   public:
-    VulkanStateWriter(util::FileOutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
+    // Resource data blocks written by previous state snapshots, which are written again by later snapshots for
+    // resources that have not been modified, instead of reading the resource content back from the device.
+    struct ResourceDataCacheEntry
+    {
+        uint64_t             write_sequence{ 0 }; // Write sequence number of the snapshot that read the data.
+        std::vector<uint8_t> block;               // Complete kInitBufferCommand or kInitImageCommand block.
+    };
+
+    // Range of a memory object that was written through a bound resource.  The size is VK_WHOLE_SIZE when the extent
+    // of the resource is not known, which includes the rest of the memory object.
+    struct MemoryRange
+    {
+        VkDeviceSize offset{ 0 };
+        VkDeviceSize size{ 0 };
+    };
+
+    struct ResourceDataCache
+    {
+        std::unordered_map<format::HandleId, ResourceDataCacheEntry>                         buffers;
+        std::map<std::pair<format::HandleId, VkImageAspectFlagBits>, ResourceDataCacheEntry> images;
+
+        // Memory ranges written through resources since the cached data was read, by memory ID.  Cached data is not
+        // used for a resource that overlaps a written range, which may have been written through an aliased resource.
+        std::unordered_map<format::HandleId, std::vector<MemoryRange>> written_memory_ranges;
+    };
+
+  public:
+    VulkanStateWriter(util::OutputStream* output_stream, util::Compressor* compressor, format::ThreadId thread_id);
 
     ~VulkanStateWriter();
 
+    // Enables reuse of resource data from previous snapshots.  Resources with write sequence numbers greater than the
+    // sequence number of their cached data are read from the device.  After the state is written, the cache only
+    // contains entries for resources that were part of the snapshot.
+    void SetResourceDataCache(ResourceDataCache* cache, uint64_t write_sequence);
+
     // Returns number of bytes written to the output_stream.
     void WriteState(const VulkanStateTable& state_table, uint64_t frame_number);
 
@@ -60,6 +95,7 @@ class VulkanStateWriter
         const DeviceMemoryWrapper* memory_wrapper{ nullptr };
         VkMemoryPropertyFlags      memory_properties{};
         bool                       need_staging_copy{ false };
+        ResourceDataCacheEntry*    cached_data{ nullptr };
     };
 
     struct ImageSnapshotInfo
@@ -71,6 +107,7 @@ class VulkanStateWriter
         VkImageAspectFlagBits      aspect{};
         VkDeviceSize               resource_size{ 0 }; // Combined size of all sub-resources.
         std::vector<uint64_t>      level_sizes;        // Combined size of all layers in a mip level.
+        ResourceDataCacheEntry*    cached_data{ nullptr };
     };
 
     struct ResourceSnapshotInfo
@@ -165,6 +202,16 @@ class VulkanStateWriter
 
     void WriteImageSubresourceLayouts(const ImageWrapper* image_wrapper, VkImageAspectFlags aspect_flags);
 
+    bool IsMemoryRangeWritten(format::HandleId memory_id, VkDeviceSize offset, VkDeviceSize size) const;
+
+    ResourceDataCacheEntry* FindCachedBufferData(const BufferWrapper*       buffer_wrapper,
+                                                 const DeviceMemoryWrapper* memory_wrapper);
+
+    ResourceDataCacheEntry* FindCachedImageData(const ImageWrapper*        image_wrapper,
+                                                const DeviceMemoryWrapper* memory_wrapper,
+                                                VkDeviceSize               memory_size,
+                                                VkImageAspectFlagBits      aspect);
+
     void WriteResourceMemoryState(const VulkanStateTable& state_table);
 
     void WriteMappedMemoryState(const VulkanStateTable& state_table);
@@ -355,12 +402,15 @@ class VulkanStateWriter
     bool IsFramebufferValid(const FramebufferWrapper* framebuffer_wrapper, const VulkanStateTable& state_table);
 
   private:
-    util::FileOutputStream*  output_stream_;
+    util::OutputStream*      output_stream_;
     util::Compressor*        compressor_;
     std::vector<uint8_t>     compressed_parameter_buffer_;
     format::ThreadId         thread_id_;
     util::MemoryOutputStream parameter_stream_;
     ParameterEncoder         encoder_;
+    ResourceDataCache*       resource_data_cache_;
+    ResourceDataCache        previous_resource_data_;
+    uint64_t                 write_sequence_;
 };
 
 GFXRECON_END_NAMESPACE(encode)
@@ -97,7 +97,8 @@ enum MetaDataType : uint32_t
     kSetDevicePropertiesCommand         = 11,
     kSetDeviceMemoryPropertiesCommand   = 12,
     kResizeWindowCommand2               = 13,
-    kSetOpaqueAddressCommand            = 14
+    kSetOpaqueAddressCommand            = 14,
+    kCaptureProfileCommand              = 15
 };
 
 enum CompressionType : uint32_t
@@ -386,6 +387,27 @@ struct SetOpaqueAddressCommand
     uint64_t         address;
 };
 
+struct CaptureProfileCommandHeader
+{
+    MetaDataHeader   meta_header;
+    format::ThreadId thread_id;
+    uint32_t         frame_count;
+    uint32_t         entry_count; // Header is followed by 'entry_count' CaptureProfileEntry records.
+};
+
+// Capture layer overhead for a single API call, with times specified in nanoseconds.
+struct CaptureProfileEntry
+{
+    ApiCallId api_call_id;
+    uint64_t  call_count;
+    uint64_t  encode_time;
+    uint64_t  state_tracking_time;
+    uint64_t  compression_time;
+    uint64_t  file_lock_wait_time;
+    uint64_t  file_write_time;
+    uint64_t  memory_tracking_time;
+};
+
 #pragma pack(pop)
 
 GFXRECON_END_NAMESPACE(format)
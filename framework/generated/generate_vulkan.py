@@ -59,6 +59,8 @@ generate_targets = [
     'generated_vulkan_referenced_resource_consumer.cpp',
     'generated_vulkan_struct_handle_mappers.h',
     'generated_vulkan_struct_handle_mappers.cpp',
+    'generated_vulkan_struct_to_json.h',
+    'generated_vulkan_struct_to_json.cpp',
     'generated_vulkan_feature_util.cpp'
 ]
 
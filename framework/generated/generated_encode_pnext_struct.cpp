@@ -28,6 +28,7 @@
 
 #include "generated/generated_vulkan_struct_encoders.h"
 
+#include "encode/parameter_encoded_size.h"
 #include "encode/parameter_encoder.h"
 #include "encode/struct_pointer_encoder.h"
 #include "encode/trace_manager.h"
@@ -871,5 +872,558 @@ void EncodePNextStruct(ParameterEncoder* encoder, const void* value)
     }
 }
 
+size_t ComputePNextStructEncodedSize(const void* value)
+{
+    auto base = reinterpret_cast<const VkBaseInStructure*>(value);
+
+    // Ignore the structures added to the pnext chain by the loader.
+    while ((base != nullptr) && ((base->sType == VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO) ||
+                                 (base->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO)))
+    {
+        base = base->pNext;
+    }
+
+    if (base != nullptr)
+    {
+        switch (base->sType)
+        {
+        default:
+            // Unrecognized pNext values are omitted by EncodePNextStruct.
+            return ComputePNextStructEncodedSize(base->pNext);
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceSubgroupProperties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevice16BitStorageFeatures*>(base));
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkMemoryDedicatedRequirements*>(base));
+        case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkMemoryDedicatedAllocateInfo*>(base));
+        case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkMemoryAllocateFlagsInfo*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceGroupRenderPassBeginInfo*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceGroupCommandBufferBeginInfo*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceGroupSubmitInfo*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceGroupBindSparseInfo*>(base));
+        case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkBindBufferMemoryDeviceGroupInfo*>(base));
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkBindImageMemoryDeviceGroupInfo*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceGroupDeviceCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFeatures2*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePointClippingProperties*>(base));
+        case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkRenderPassInputAttachmentAspectCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImageViewUsageCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineTessellationDomainOriginStateCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkRenderPassMultiviewCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMultiviewFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMultiviewProperties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVariablePointersFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceProtectedMemoryFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceProtectedMemoryProperties*>(base));
+        case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkProtectedSubmitInfo*>(base));
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSamplerYcbcrConversionInfo*>(base));
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkBindImagePlaneMemoryInfo*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImagePlaneMemoryRequirementsInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceSamplerYcbcrConversionFeatures*>(base));
+        case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSamplerYcbcrConversionImageFormatProperties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceExternalImageFormatInfo*>(base));
+        case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExternalImageFormatProperties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceIDProperties*>(base));
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExternalMemoryImageCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExternalMemoryBufferCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportMemoryAllocateInfo*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportFenceCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportSemaphoreCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMaintenance3Properties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderDrawParametersFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVulkan11Features*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVulkan11Properties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVulkan12Features*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVulkan12Properties*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImageFormatListCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevice8BitStorageFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDriverProperties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderAtomicInt64Features*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderFloat16Int8Features*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFloatControlsProperties*>(base));
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDescriptorSetLayoutBindingFlagsCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDescriptorIndexingProperties*>(base));
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDescriptorSetVariableDescriptorCountAllocateInfo*>(base));
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDescriptorSetVariableDescriptorCountLayoutSupport*>(base));
+        case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSubpassDescriptionDepthStencilResolve*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDepthStencilResolveProperties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceScalarBlockLayoutFeatures*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImageStencilUsageCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSamplerReductionModeCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceSamplerFilterMinmaxProperties*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVulkanMemoryModelFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceImagelessFramebufferFeatures*>(base));
+        case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkFramebufferAttachmentsCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkRenderPassAttachmentBeginInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceUniformBufferStandardLayoutFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures*>(base));
+        case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkAttachmentReferenceStencilLayout*>(base));
+        case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkAttachmentDescriptionStencilLayout*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceHostQueryResetFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreFeatures*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceTimelineSemaphoreProperties*>(base));
+        case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSemaphoreTypeCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkTimelineSemaphoreSubmitInfo*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeatures*>(base));
+        case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkBufferOpaqueCaptureAddressCreateInfo*>(base));
+        case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkMemoryOpaqueCaptureAddressAllocateInfo*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImageSwapchainCreateInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkBindImageMemorySwapchainInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceGroupPresentInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceGroupSwapchainCreateInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDisplayPresentInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImportMemoryWin32HandleInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportMemoryWin32HandleInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImportMemoryFdInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportSemaphoreWin32HandleInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkD3D12FenceSubmitInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePushDescriptorPropertiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPresentRegionsKHR*>(base));
+        case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSharedPresentSurfaceCapabilitiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportFenceWin32HandleInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePerformanceQueryFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePerformanceQueryPropertiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkQueryPoolPerformanceCreateInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPerformanceQuerySubmitInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePortabilitySubsetFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePortabilitySubsetPropertiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderClockFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkFragmentShadingRateAttachmentInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineFragmentShadingRateStateCreateInfoKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRatePropertiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSurfaceProtectedCapabilitiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDebugReportCallbackCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineRasterizationStateRasterizationOrderAMD*>(base));
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDedicatedAllocationImageCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDedicatedAllocationBufferCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDedicatedAllocationMemoryAllocateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceTransformFeedbackFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceTransformFeedbackPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineRasterizationStateStreamCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkTextureLODGatherFormatPropertiesAMD*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceCornerSampledImageFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExternalMemoryImageCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportMemoryAllocateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImportMemoryWin32HandleInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExportMemoryWin32HandleInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkWin32KeyedMutexAcquireReleaseInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkValidationFlagsEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImageViewASTCDecodeModeEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceASTCDecodeFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceConditionalRenderingFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkCommandBufferInheritanceConditionalRenderingInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineViewportWScalingStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSwapchainCounterCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPresentTimesInfoGOOGLE*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineViewportSwizzleStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDiscardRectanglePropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineDiscardRectangleStateCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceConservativeRasterizationPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineRasterizationConservativeStateCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDepthClipEnableFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineRasterizationDepthClipStateCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDebugUtilsMessengerCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkAndroidHardwareBufferUsageANDROID*>(base));
+        case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkAndroidHardwareBufferFormatPropertiesANDROID*>(base));
+        case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImportAndroidHardwareBufferInfoANDROID*>(base));
+        case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkExternalFormatANDROID*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceInlineUniformBlockPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkWriteDescriptorSetInlineUniformBlockEXT*>(base));
+        case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDescriptorPoolInlineUniformBlockCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSampleLocationsInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkRenderPassSampleLocationsBeginInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineSampleLocationsStateCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceSampleLocationsPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineColorBlendAdvancedStateCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineCoverageToColorStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineCoverageModulationStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDrmFormatModifierPropertiesListEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceImageDrmFormatModifierInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImageDrmFormatModifierListCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImageDrmFormatModifierExplicitCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkShaderModuleValidationCacheCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineViewportShadingRateImageStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShadingRateImageFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShadingRateImagePropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceRayTracingPropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineRepresentativeFragmentTestStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceImageViewImageFormatInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkFilterCubicImageViewImageFormatPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceQueueGlobalPriorityCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkImportMemoryHostPointerInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceExternalMemoryHostPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineCompilerControlCreateInfoAMD*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderCorePropertiesAMD*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceMemoryOverallocationCreateInfoAMD*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineVertexInputDivisorStateCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPresentFrameTokenGGP*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineCreationFeedbackCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMeshShaderFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMeshShaderPropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderImageFootprintFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineViewportExclusiveScissorStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceExclusiveScissorFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkQueueFamilyCheckpointPropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL*>(base));
+        case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkQueryPoolPerformanceQueryCreateInfoINTEL*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePCIBusInfoPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDisplayNativeHdrSurfaceCapabilitiesAMD*>(base));
+        case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSwapchainDisplayNativeHdrCreateInfoAMD*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMapPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkRenderPassFragmentDensityMapCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceSubgroupSizeControlPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderCoreProperties2AMD*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceCoherentMemoryFeaturesAMD*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMemoryBudgetPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMemoryPriorityFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkMemoryPriorityAllocateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkBufferDeviceAddressCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkValidationFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceCooperativeMatrixPropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceCoverageReductionModeFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineCoverageReductionStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSurfaceFullScreenExclusiveInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSurfaceCapabilitiesFullScreenExclusiveEXT*>(base));
+        case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSurfaceFullScreenExclusiveWin32InfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceLineRasterizationFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceLineRasterizationPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineRasterizationLineStateCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceIndexTypeUint8FeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkGraphicsPipelineShaderGroupsCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkRenderPassTransformBeginInfoQCOM*>(base));
+        case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkCommandBufferInheritanceRenderPassTransformInfoQCOM*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceDeviceMemoryReportCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceRobustness2FeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceRobustness2PropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkSamplerCustomBorderColorCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceCustomBorderColorPropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceCustomBorderColorFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePrivateDataFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDevicePrivateDataCreateInfoEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceDiagnosticsConfigFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkDeviceDiagnosticsConfigCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV*>(base));
+        case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPipelineFragmentShadingRateEnumStateCreateInfoNV*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT*>(base));
+        case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkCopyCommandTransformInfoQCOM*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceImageRobustnessFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDevice4444FormatsFeaturesEXT*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_VALVE:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE*>(base));
+        case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkMutableDescriptorTypeCreateInfoVALVE*>(base));
+        case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkWriteDescriptorSetAccelerationStructureKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceAccelerationStructureFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceAccelerationStructurePropertiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceRayTracingPipelineFeaturesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceRayTracingPipelinePropertiesKHR*>(base));
+        case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR:
+            return ComputeStructPtrEncodedSize(reinterpret_cast<const VkPhysicalDeviceRayQueryFeaturesKHR*>(base));
+        }
+    }
+
+    // pNext was either NULL or an ignored loader specific struct.
+    return ParameterEncodedSize::StructPtrPreamble(nullptr);
+}
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
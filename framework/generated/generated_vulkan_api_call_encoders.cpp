@@ -63,6 +63,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateInstance(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateInstance);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
         encoder->EncodeHandlePtr(pInstance, omit_output_data);
@@ -303,6 +304,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDevice(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDevice);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -384,6 +386,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueSubmit(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkQueueSubmit);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pSubmits, submitCount));
         encoder->EncodeHandleValue(queue);
         encoder->EncodeUInt32Value(submitCount);
         EncodeStructArray(encoder, pSubmits, submitCount);
@@ -460,6 +463,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateMemory(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkAllocateMemory);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pAllocateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pAllocateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -576,6 +580,7 @@ VKAPI_ATTR VkResult VKAPI_CALL FlushMappedMemoryRanges(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkFlushMappedMemoryRanges);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pMemoryRanges, memoryRangeCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(memoryRangeCount);
         EncodeStructArray(encoder, pMemoryRanges, memoryRangeCount);
@@ -604,6 +609,7 @@ VKAPI_ATTR VkResult VKAPI_CALL InvalidateMappedMemoryRanges(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkInvalidateMappedMemoryRanges);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pMemoryRanges, memoryRangeCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(memoryRangeCount);
         EncodeStructArray(encoder, pMemoryRanges, memoryRangeCount);
@@ -825,6 +831,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueueBindSparse(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkQueueBindSparse);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pBindInfo, bindInfoCount));
         encoder->EncodeHandleValue(queue);
         encoder->EncodeUInt32Value(bindInfoCount);
         EncodeStructArray(encoder, pBindInfo, bindInfoCount);
@@ -864,6 +871,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFence(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateFence);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1014,6 +1022,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSemaphore(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateSemaphore);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1079,6 +1088,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateEvent(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateEvent);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1219,6 +1229,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateQueryPool(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateQueryPool);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1320,6 +1331,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBuffer(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateBuffer);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1387,6 +1399,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateBufferView(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateBufferView);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1454,6 +1467,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImage(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateImage);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1509,6 +1523,7 @@ VKAPI_ATTR void VKAPI_CALL GetImageSubresourceLayout(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetImageSubresourceLayout);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSubresource));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(image);
         EncodeStructPtr(encoder, pSubresource);
@@ -1547,6 +1562,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImageView(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateImageView);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1614,6 +1630,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateShaderModule(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateShaderModule);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1679,6 +1696,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineCache(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreatePipelineCache);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1815,6 +1833,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateGraphicsPipelines(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateGraphicsPipelines);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pCreateInfos, createInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(pipelineCache);
         encoder->EncodeUInt32Value(createInfoCount);
@@ -1861,6 +1880,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateComputePipelines(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateComputePipelines);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pCreateInfos, createInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(pipelineCache);
         encoder->EncodeUInt32Value(createInfoCount);
@@ -1930,6 +1950,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePipelineLayout(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreatePipelineLayout);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -1997,6 +2018,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSampler(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateSampler);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -2064,6 +2086,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorSetLayout(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDescriptorSetLayout);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -2129,6 +2152,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorPool(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDescriptorPool);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -2222,6 +2246,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateDescriptorSets(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkAllocateDescriptorSets);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pAllocateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pAllocateInfo);
         encoder->EncodeHandleArray(pDescriptorSets, (pAllocateInfo != nullptr) ? (pAllocateInfo->descriptorSetCount) : 0, omit_output_data);
@@ -2279,6 +2304,7 @@ VKAPI_ATTR void VKAPI_CALL UpdateDescriptorSets(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkUpdateDescriptorSets);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pDescriptorWrites, descriptorWriteCount) + ComputeStructArrayEncodedSize(pDescriptorCopies, descriptorCopyCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(descriptorWriteCount);
         EncodeStructArray(encoder, pDescriptorWrites, descriptorWriteCount);
@@ -2325,6 +2351,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateFramebuffer(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateFramebuffer);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -2390,6 +2417,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateRenderPass);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -2479,6 +2507,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateCommandPool(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateCommandPool);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -2572,6 +2601,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AllocateCommandBuffers(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkAllocateCommandBuffers);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pAllocateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pAllocateInfo);
         encoder->EncodeHandleArray(pCommandBuffers, (pAllocateInfo != nullptr) ? (pAllocateInfo->commandBufferCount) : 0, omit_output_data);
@@ -2629,6 +2659,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BeginCommandBuffer(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkBeginCommandBuffer);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pBeginInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pBeginInfo);
         encoder->EncodeEnumValue(result);
@@ -2721,6 +2752,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewport(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewport);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pViewports, viewportCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(firstViewport);
         encoder->EncodeUInt32Value(viewportCount);
@@ -2746,6 +2778,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissor(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetScissor);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pScissors, scissorCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(firstScissor);
         encoder->EncodeUInt32Value(scissorCount);
@@ -3183,6 +3216,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBuffer);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pRegions, regionCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(srcBuffer);
         encoder->EncodeHandleValue(dstBuffer);
@@ -3214,6 +3248,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImage);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pRegions, regionCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(srcImage);
         encoder->EncodeEnumValue(srcImageLayout);
@@ -3248,6 +3283,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBlitImage);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pRegions, regionCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(srcImage);
         encoder->EncodeEnumValue(srcImageLayout);
@@ -3281,6 +3317,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBufferToImage);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pRegions, regionCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(srcBuffer);
         encoder->EncodeHandleValue(dstImage);
@@ -3312,6 +3349,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pRegions, regionCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(srcImage);
         encoder->EncodeEnumValue(srcImageLayout);
@@ -3399,6 +3437,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearColorImage(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdClearColorImage);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pColor) + ComputeStructArrayEncodedSize(pRanges, rangeCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(image);
         encoder->EncodeEnumValue(imageLayout);
@@ -3429,6 +3468,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearDepthStencilImage(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pDepthStencil) + ComputeStructArrayEncodedSize(pRanges, rangeCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(image);
         encoder->EncodeEnumValue(imageLayout);
@@ -3458,6 +3498,7 @@ VKAPI_ATTR void VKAPI_CALL CmdClearAttachments(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdClearAttachments);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pAttachments, attachmentCount) + ComputeStructArrayEncodedSize(pRects, rectCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(attachmentCount);
         EncodeStructArray(encoder, pAttachments, attachmentCount);
@@ -3487,6 +3528,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdResolveImage);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pRegions, regionCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeHandleValue(srcImage);
         encoder->EncodeEnumValue(srcImageLayout);
@@ -3572,6 +3614,7 @@ VKAPI_ATTR void VKAPI_CALL CmdWaitEvents(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdWaitEvents);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pMemoryBarriers, memoryBarrierCount) + ComputeStructArrayEncodedSize(pBufferMemoryBarriers, bufferMemoryBarrierCount) + ComputeStructArrayEncodedSize(pImageMemoryBarriers, imageMemoryBarrierCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(eventCount);
         encoder->EncodeHandleArray(pEvents, eventCount);
@@ -3614,6 +3657,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPipelineBarrier(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPipelineBarrier);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pMemoryBarriers, memoryBarrierCount) + ComputeStructArrayEncodedSize(pBufferMemoryBarriers, bufferMemoryBarrierCount) + ComputeStructArrayEncodedSize(pImageMemoryBarriers, imageMemoryBarrierCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeFlagsValue(srcStageMask);
         encoder->EncodeFlagsValue(dstStageMask);
@@ -3814,6 +3858,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginRenderPass);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pRenderPassBegin));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pRenderPassBegin);
         encoder->EncodeEnumValue(contents);
@@ -3910,6 +3955,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkBindBufferMemory2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pBindInfos, bindInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(bindInfoCount);
         EncodeStructArray(encoder, pBindInfos, bindInfoCount);
@@ -3938,6 +3984,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkBindImageMemory2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pBindInfos, bindInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(bindInfoCount);
         EncodeStructArray(encoder, pBindInfos, bindInfoCount);
@@ -4082,6 +4129,7 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         EncodeStructPtr(encoder, pMemoryRequirements);
@@ -4107,6 +4155,7 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         EncodeStructPtr(encoder, pMemoryRequirements);
@@ -4133,6 +4182,7 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeUInt32Ptr(pSparseMemoryRequirementCount);
@@ -4228,6 +4278,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pImageFormatInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pImageFormatInfo);
         EncodeStructPtr(encoder, pImageFormatProperties, omit_output_data);
@@ -4299,6 +4350,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pFormatInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pFormatInfo);
         encoder->EncodeUInt32Ptr(pPropertyCount);
@@ -4349,6 +4401,7 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceQueue2(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkGetDeviceQueue2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pQueueInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pQueueInfo);
         encoder->EncodeHandlePtr(pQueue);
@@ -4384,6 +4437,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversion(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversion);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -4451,6 +4505,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplate(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplate);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -4504,6 +4559,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferProperties(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferProperties);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExternalBufferInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pExternalBufferInfo);
         EncodeStructPtr(encoder, pExternalBufferProperties);
@@ -4527,6 +4583,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFenceProperties(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFenceProperties);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExternalFenceInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pExternalFenceInfo);
         EncodeStructPtr(encoder, pExternalFenceProperties);
@@ -4550,6 +4607,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphoreProperties(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphoreProperties);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExternalSemaphoreInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pExternalSemaphoreInfo);
         EncodeStructPtr(encoder, pExternalSemaphoreProperties);
@@ -4575,6 +4633,7 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupport(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupport);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pSupport);
@@ -4676,6 +4735,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateRenderPass2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -4699,6 +4759,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginRenderPass2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pRenderPassBegin) + ComputeStructPtrEncodedSize(pSubpassBeginInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pRenderPassBegin);
         EncodeStructPtr(encoder, pSubpassBeginInfo);
@@ -4724,6 +4785,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdNextSubpass2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSubpassBeginInfo) + ComputeStructPtrEncodedSize(pSubpassEndInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pSubpassBeginInfo);
         EncodeStructPtr(encoder, pSubpassEndInfo);
@@ -4746,6 +4808,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndRenderPass2);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSubpassEndInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pSubpassEndInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder);
@@ -4833,6 +4896,7 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphores(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkWaitSemaphores);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pWaitInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pWaitInfo);
         encoder->EncodeUInt64Value(timeout);
@@ -4860,6 +4924,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphore(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkSignalSemaphore);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSignalInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pSignalInfo);
         encoder->EncodeEnumValue(result);
@@ -4886,6 +4951,7 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddress(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetBufferDeviceAddress);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeVkDeviceAddressValue(result);
@@ -4912,6 +4978,7 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddress(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddress);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeUInt64Value(result);
@@ -4938,6 +5005,7 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddress(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddress);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeUInt64Value(result);
@@ -5141,6 +5209,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSwapchainKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateSwapchainKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -5276,6 +5345,7 @@ VKAPI_ATTR VkResult VKAPI_CALL QueuePresentKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkQueuePresentKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pPresentInfo));
         encoder->EncodeHandleValue(queue);
         EncodeStructPtr(encoder, pPresentInfo);
         encoder->EncodeEnumValue(result);
@@ -5407,6 +5477,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireNextImage2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkAcquireNextImage2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pAcquireInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pAcquireInfo);
         encoder->EncodeUInt32Ptr(pImageIndex, omit_output_data);
@@ -5600,6 +5671,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayModeKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDisplayModeKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(physicalDevice);
         encoder->EncodeHandleValue(display);
         EncodeStructPtr(encoder, pCreateInfo);
@@ -5677,6 +5749,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDisplayPlaneSurfaceKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDisplayPlaneSurfaceKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -5719,6 +5792,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSharedSwapchainsKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateSharedSwapchainsKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pCreateInfos, swapchainCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(swapchainCount);
         EncodeStructArray(encoder, pCreateInfos, swapchainCount);
@@ -5759,6 +5833,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXlibSurfaceKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateXlibSurfaceKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -5826,6 +5901,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateXcbSurfaceKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateXcbSurfaceKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -5893,6 +5969,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWaylandSurfaceKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateWaylandSurfaceKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -5958,6 +6035,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAndroidSurfaceKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateAndroidSurfaceKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -5997,6 +6075,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateWin32SurfaceKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateWin32SurfaceKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -6119,6 +6198,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceImageFormatProperties2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceImageFormatProperties2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pImageFormatInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pImageFormatInfo);
         EncodeStructPtr(encoder, pImageFormatProperties, omit_output_data);
@@ -6190,6 +6270,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceSparseImageFormatProperties2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSparseImageFormatProperties2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pFormatInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pFormatInfo);
         encoder->EncodeUInt32Ptr(pPropertyCount);
@@ -6354,6 +6435,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalBufferPropertiesKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalBufferPropertiesKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExternalBufferInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pExternalBufferInfo);
         EncodeStructPtr(encoder, pExternalBufferProperties);
@@ -6385,6 +6467,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryWin32HandleKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetMemoryWin32HandleKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGetWin32HandleInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pGetWin32HandleInfo);
         encoder->EncodeVoidPtrPtr(pHandle, omit_output_data);
@@ -6453,6 +6536,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryFdKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetMemoryFdKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGetFdInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pGetFdInfo);
         encoder->EncodeInt32Ptr(pFd, omit_output_data);
@@ -6513,6 +6597,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalSemaphorePropertiesKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExternalSemaphoreInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pExternalSemaphoreInfo);
         EncodeStructPtr(encoder, pExternalSemaphoreProperties);
@@ -6537,6 +6622,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreWin32HandleKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkImportSemaphoreWin32HandleKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pImportSemaphoreWin32HandleInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pImportSemaphoreWin32HandleInfo);
         encoder->EncodeEnumValue(result);
@@ -6570,6 +6656,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreWin32HandleKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetSemaphoreWin32HandleKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGetWin32HandleInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pGetWin32HandleInfo);
         encoder->EncodeVoidPtrPtr(pHandle, omit_output_data);
@@ -6597,6 +6684,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportSemaphoreFdKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkImportSemaphoreFdKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pImportSemaphoreFdInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pImportSemaphoreFdInfo);
         encoder->EncodeEnumValue(result);
@@ -6630,6 +6718,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetSemaphoreFdKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetSemaphoreFdKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGetFdInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pGetFdInfo);
         encoder->EncodeInt32Ptr(pFd, omit_output_data);
@@ -6655,6 +6744,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPushDescriptorSetKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pDescriptorWrites, descriptorWriteCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeEnumValue(pipelineBindPoint);
         encoder->EncodeHandleValue(layout);
@@ -6702,6 +6792,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDescriptorUpdateTemplateKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDescriptorUpdateTemplateKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -6767,6 +6858,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRenderPass2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateRenderPass2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -6790,6 +6882,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginRenderPass2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pRenderPassBegin) + ComputeStructPtrEncodedSize(pSubpassBeginInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pRenderPassBegin);
         EncodeStructPtr(encoder, pSubpassBeginInfo);
@@ -6815,6 +6908,7 @@ VKAPI_ATTR void VKAPI_CALL CmdNextSubpass2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSubpassBeginInfo) + ComputeStructPtrEncodedSize(pSubpassEndInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pSubpassBeginInfo);
         EncodeStructPtr(encoder, pSubpassEndInfo);
@@ -6837,6 +6931,7 @@ VKAPI_ATTR void VKAPI_CALL CmdEndRenderPass2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSubpassEndInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pSubpassEndInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder);
@@ -6888,6 +6983,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceExternalFencePropertiesKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceExternalFencePropertiesKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExternalFenceInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pExternalFenceInfo);
         EncodeStructPtr(encoder, pExternalFenceProperties);
@@ -6912,6 +7008,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceWin32HandleKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkImportFenceWin32HandleKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pImportFenceWin32HandleInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pImportFenceWin32HandleInfo);
         encoder->EncodeEnumValue(result);
@@ -6945,6 +7042,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceWin32HandleKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetFenceWin32HandleKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGetWin32HandleInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pGetWin32HandleInfo);
         encoder->EncodeVoidPtrPtr(pHandle, omit_output_data);
@@ -6972,6 +7070,7 @@ VKAPI_ATTR VkResult VKAPI_CALL ImportFenceFdKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkImportFenceFdKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pImportFenceFdInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pImportFenceFdInfo);
         encoder->EncodeEnumValue(result);
@@ -7005,6 +7104,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetFenceFdKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetFenceFdKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGetFdInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pGetFdInfo);
         encoder->EncodeInt32Ptr(pFd, omit_output_data);
@@ -7067,6 +7167,7 @@ VKAPI_ATTR void VKAPI_CALL GetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pPerformanceQueryCreateInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pPerformanceQueryCreateInfo);
         encoder->EncodeUInt32Ptr(pNumPasses);
@@ -7089,6 +7190,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquireProfilingLockKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkAcquireProfilingLockKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeEnumValue(result);
@@ -7141,6 +7243,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceCapabilities2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceCapabilities2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSurfaceInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pSurfaceInfo);
         EncodeStructPtr(encoder, pSurfaceCapabilities, omit_output_data);
@@ -7176,6 +7279,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfaceFormats2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfaceFormats2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSurfaceInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pSurfaceInfo);
         encoder->EncodeUInt32Ptr(pSurfaceFormatCount, omit_output_data);
@@ -7325,6 +7429,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDisplayPlaneCapabilities2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetDisplayPlaneCapabilities2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pDisplayPlaneInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pDisplayPlaneInfo);
         EncodeStructPtr(encoder, pCapabilities, omit_output_data);
@@ -7353,6 +7458,7 @@ VKAPI_ATTR void VKAPI_CALL GetImageMemoryRequirements2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetImageMemoryRequirements2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         EncodeStructPtr(encoder, pMemoryRequirements);
@@ -7378,6 +7484,7 @@ VKAPI_ATTR void VKAPI_CALL GetBufferMemoryRequirements2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         EncodeStructPtr(encoder, pMemoryRequirements);
@@ -7404,6 +7511,7 @@ VKAPI_ATTR void VKAPI_CALL GetImageSparseMemoryRequirements2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeUInt32Ptr(pSparseMemoryRequirementCount);
@@ -7440,6 +7548,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateSamplerYcbcrConversionKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateSamplerYcbcrConversionKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -7495,6 +7604,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BindBufferMemory2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkBindBufferMemory2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pBindInfos, bindInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(bindInfoCount);
         EncodeStructArray(encoder, pBindInfos, bindInfoCount);
@@ -7523,6 +7633,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BindImageMemory2KHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkBindImageMemory2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pBindInfos, bindInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(bindInfoCount);
         EncodeStructArray(encoder, pBindInfos, bindInfoCount);
@@ -7551,6 +7662,7 @@ VKAPI_ATTR void VKAPI_CALL GetDescriptorSetLayoutSupportKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetDescriptorSetLayoutSupportKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pSupport);
@@ -7675,6 +7787,7 @@ VKAPI_ATTR VkResult VKAPI_CALL WaitSemaphoresKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkWaitSemaphoresKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pWaitInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pWaitInfo);
         encoder->EncodeUInt64Value(timeout);
@@ -7702,6 +7815,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SignalSemaphoreKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkSignalSemaphoreKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSignalInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pSignalInfo);
         encoder->EncodeEnumValue(result);
@@ -7755,6 +7869,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetFragmentShadingRateKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pFragmentSize));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pFragmentSize);
         encoder->EncodeEnumArray(combinerOps, 2);
@@ -7783,6 +7898,7 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetBufferDeviceAddressKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeVkDeviceAddressValue(result);
@@ -7809,6 +7925,7 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetBufferOpaqueCaptureAddressKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetBufferOpaqueCaptureAddressKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeUInt64Value(result);
@@ -7835,6 +7952,7 @@ VKAPI_ATTR uint64_t VKAPI_CALL GetDeviceMemoryOpaqueCaptureAddressKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetDeviceMemoryOpaqueCaptureAddressKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeUInt64Value(result);
@@ -8007,6 +8125,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutablePropertiesKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPipelineExecutablePropertiesKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pPipelineInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pPipelineInfo);
         encoder->EncodeUInt32Ptr(pExecutableCount, omit_output_data);
@@ -8043,6 +8162,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableStatisticsKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPipelineExecutableStatisticsKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExecutableInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pExecutableInfo);
         encoder->EncodeUInt32Ptr(pStatisticCount, omit_output_data);
@@ -8079,6 +8199,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPipelineExecutableInternalRepresentationsKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPipelineExecutableInternalRepresentationsKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pExecutableInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pExecutableInfo);
         encoder->EncodeUInt32Ptr(pInternalRepresentationCount, omit_output_data);
@@ -8101,6 +8222,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBuffer2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCopyBufferInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pCopyBufferInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdCopyBuffer2KHRHandles, pCopyBufferInfo);
@@ -8124,6 +8246,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImage2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImage2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCopyImageInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pCopyImageInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdCopyImage2KHRHandles, pCopyImageInfo);
@@ -8147,6 +8270,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyBufferToImage2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCopyBufferToImageInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pCopyBufferToImageInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdCopyBufferToImage2KHRHandles, pCopyBufferToImageInfo);
@@ -8170,6 +8294,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyImageToBuffer2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCopyImageToBufferInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pCopyImageToBufferInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdCopyImageToBuffer2KHRHandles, pCopyImageToBufferInfo);
@@ -8193,6 +8318,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBlitImage2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBlitImage2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pBlitImageInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pBlitImageInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdBlitImage2KHRHandles, pBlitImageInfo);
@@ -8216,6 +8342,7 @@ VKAPI_ATTR void VKAPI_CALL CmdResolveImage2KHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdResolveImage2KHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pResolveImageInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pResolveImageInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdResolveImage2KHRHandles, pResolveImageInfo);
@@ -8256,6 +8383,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugReportCallbackEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDebugReportCallbackEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -8344,6 +8472,7 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectTagEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkDebugMarkerSetObjectTagEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pTagInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pTagInfo);
         encoder->EncodeEnumValue(result);
@@ -8370,6 +8499,7 @@ VKAPI_ATTR VkResult VKAPI_CALL DebugMarkerSetObjectNameEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkDebugMarkerSetObjectNameEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pNameInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pNameInfo);
         encoder->EncodeEnumValue(result);
@@ -8390,6 +8520,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerBeginEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pMarkerInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pMarkerInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder);
@@ -8430,6 +8561,7 @@ VKAPI_ATTR void VKAPI_CALL CmdDebugMarkerInsertEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pMarkerInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pMarkerInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder);
@@ -8632,6 +8764,7 @@ VKAPI_ATTR uint32_t VKAPI_CALL GetImageViewHandleNVX(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetImageViewHandleNVX);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeUInt32Value(result);
@@ -8807,6 +8940,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateStreamDescriptorSurfaceGGP(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateStreamDescriptorSurfaceGGP);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -8923,6 +9057,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateViSurfaceNN(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateViSurfaceNN);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -8945,6 +9080,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginConditionalRenderingEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pConditionalRenderingBegin));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pConditionalRenderingBegin);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdBeginConditionalRenderingEXTHandles, pConditionalRenderingBegin);
@@ -8989,6 +9125,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWScalingNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pViewportWScalings, viewportCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(firstViewport);
         encoder->EncodeUInt32Value(viewportCount);
@@ -9142,6 +9279,7 @@ VKAPI_ATTR VkResult VKAPI_CALL DisplayPowerControlEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkDisplayPowerControlEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pDisplayPowerInfo));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(display);
         EncodeStructPtr(encoder, pDisplayPowerInfo);
@@ -9180,6 +9318,7 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDeviceEventEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkRegisterDeviceEventEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pDeviceEventInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pDeviceEventInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -9221,6 +9360,7 @@ VKAPI_ATTR VkResult VKAPI_CALL RegisterDisplayEventEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkRegisterDisplayEventEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pDisplayEventInfo));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(display);
         EncodeStructPtr(encoder, pDisplayEventInfo);
@@ -9349,6 +9489,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetDiscardRectangleEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pDiscardRectangles, discardRectangleCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(firstDiscardRectangle);
         encoder->EncodeUInt32Value(discardRectangleCount);
@@ -9374,6 +9515,7 @@ VKAPI_ATTR void VKAPI_CALL SetHdrMetadataEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkSetHdrMetadataEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pMetadata, swapchainCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(swapchainCount);
         encoder->EncodeHandleArray(pSwapchains, swapchainCount);
@@ -9416,6 +9558,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIOSSurfaceMVK(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateIOSSurfaceMVK);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -9455,6 +9598,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMacOSSurfaceMVK(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateMacOSSurfaceMVK);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -9483,6 +9627,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectNameEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkSetDebugUtilsObjectNameEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pNameInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pNameInfo);
         encoder->EncodeEnumValue(result);
@@ -9509,6 +9654,7 @@ VKAPI_ATTR VkResult VKAPI_CALL SetDebugUtilsObjectTagEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkSetDebugUtilsObjectTagEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pTagInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pTagInfo);
         encoder->EncodeEnumValue(result);
@@ -9529,6 +9675,7 @@ VKAPI_ATTR void VKAPI_CALL QueueBeginDebugUtilsLabelEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkQueueBeginDebugUtilsLabelEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pLabelInfo));
         encoder->EncodeHandleValue(queue);
         EncodeStructPtr(encoder, pLabelInfo);
         TraceManager::Get()->EndApiCallTrace(encoder);
@@ -9569,6 +9716,7 @@ VKAPI_ATTR void VKAPI_CALL QueueInsertDebugUtilsLabelEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkQueueInsertDebugUtilsLabelEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pLabelInfo));
         encoder->EncodeHandleValue(queue);
         EncodeStructPtr(encoder, pLabelInfo);
         TraceManager::Get()->EndApiCallTrace(encoder);
@@ -9590,6 +9738,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBeginDebugUtilsLabelEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pLabelInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pLabelInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder);
@@ -9630,6 +9779,7 @@ VKAPI_ATTR void VKAPI_CALL CmdInsertDebugUtilsLabelEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pLabelInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pLabelInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder);
@@ -9668,6 +9818,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDebugUtilsMessengerEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDebugUtilsMessengerEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -9718,6 +9869,7 @@ VKAPI_ATTR void VKAPI_CALL SubmitDebugUtilsMessageEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkSubmitDebugUtilsMessageEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCallbackData));
         encoder->EncodeHandleValue(instance);
         encoder->EncodeEnumValue(messageSeverity);
         encoder->EncodeFlagsValue(messageTypes);
@@ -9786,6 +9938,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetMemoryAndroidHardwareBufferANDROID(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetMemoryAndroidHardwareBufferANDROID);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeVoidPtrPtr(pBuffer, omit_output_data);
@@ -9807,6 +9960,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetSampleLocationsEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSampleLocationsInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pSampleLocationsInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder);
@@ -9901,6 +10055,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateValidationCacheEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateValidationCacheEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -10041,6 +10196,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportShadingRatePaletteNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pShadingRatePalettes, viewportCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(firstViewport);
         encoder->EncodeUInt32Value(viewportCount);
@@ -10066,6 +10222,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetCoarseSampleOrderNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pCustomSampleOrders, customSampleOrderCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeEnumValue(sampleOrderType);
         encoder->EncodeUInt32Value(customSampleOrderCount);
@@ -10108,6 +10265,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateAccelerationStructureNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -10163,6 +10321,7 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureMemoryRequirementsNV(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetAccelerationStructureMemoryRequirementsNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         EncodeStructPtr(encoder, pMemoryRequirements);
@@ -10188,6 +10347,7 @@ VKAPI_ATTR VkResult VKAPI_CALL BindAccelerationStructureMemoryNV(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkBindAccelerationStructureMemoryNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pBindInfos, bindInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(bindInfoCount);
         EncodeStructArray(encoder, pBindInfos, bindInfoCount);
@@ -10216,6 +10376,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructureNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeHandleValue(instanceData);
@@ -10350,6 +10511,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pCreateInfos, createInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(pipelineCache);
         encoder->EncodeUInt32Value(createInfoCount);
@@ -10653,6 +10815,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetCalibratedTimestampsEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetCalibratedTimestampsEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pTimestampInfos, timestampCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeUInt32Value(timestampCount);
         EncodeStructArray(encoder, pTimestampInfos, timestampCount);
@@ -10762,6 +10925,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetExclusiveScissorNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pExclusiveScissors, exclusiveScissorCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(firstExclusiveScissor);
         encoder->EncodeUInt32Value(exclusiveScissorCount);
@@ -10833,6 +10997,7 @@ VKAPI_ATTR VkResult VKAPI_CALL InitializePerformanceApiINTEL(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkInitializePerformanceApiINTEL);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInitializeInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInitializeInfo);
         encoder->EncodeEnumValue(result);
@@ -10876,6 +11041,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceMarkerINTEL(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pMarkerInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pMarkerInfo);
         encoder->EncodeEnumValue(result);
@@ -10900,6 +11066,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceStreamMarkerINTEL(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pMarkerInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pMarkerInfo);
         encoder->EncodeEnumValue(result);
@@ -10924,6 +11091,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CmdSetPerformanceOverrideINTEL(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pOverrideInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pOverrideInfo);
         encoder->EncodeEnumValue(result);
@@ -10960,6 +11128,7 @@ VKAPI_ATTR VkResult VKAPI_CALL AcquirePerformanceConfigurationINTEL(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkAcquirePerformanceConfigurationINTEL);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pAcquireInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pAcquireInfo);
         encoder->EncodeHandlePtr(pConfiguration, omit_output_data);
@@ -11106,6 +11275,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateImagePipeSurfaceFUCHSIA(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateImagePipeSurfaceFUCHSIA);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -11145,6 +11315,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateMetalSurfaceEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateMetalSurfaceEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -11173,6 +11344,7 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetBufferDeviceAddressEXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetBufferDeviceAddressEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeVkDeviceAddressValue(result);
@@ -11301,6 +11473,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetPhysicalDeviceSurfacePresentModes2EXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetPhysicalDeviceSurfacePresentModes2EXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSurfaceInfo));
         encoder->EncodeHandleValue(physicalDevice);
         EncodeStructPtr(encoder, pSurfaceInfo);
         encoder->EncodeUInt32Ptr(pPresentModeCount, omit_output_data);
@@ -11386,6 +11559,7 @@ VKAPI_ATTR VkResult VKAPI_CALL GetDeviceGroupSurfacePresentModes2EXT(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetDeviceGroupSurfacePresentModes2EXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pSurfaceInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pSurfaceInfo);
         encoder->EncodeFlagsPtr(pModes, omit_output_data);
@@ -11424,6 +11598,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateHeadlessSurfaceEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateHeadlessSurfaceEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -11559,6 +11734,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetViewportWithCountEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pViewports, viewportCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(viewportCount);
         EncodeStructArray(encoder, pViewports, viewportCount);
@@ -11582,6 +11758,7 @@ VKAPI_ATTR void VKAPI_CALL CmdSetScissorWithCountEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pScissors, scissorCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(scissorCount);
         EncodeStructArray(encoder, pScissors, scissorCount);
@@ -11778,6 +11955,7 @@ VKAPI_ATTR void VKAPI_CALL GetGeneratedCommandsMemoryRequirementsNV(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetGeneratedCommandsMemoryRequirementsNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         EncodeStructPtr(encoder, pMemoryRequirements);
@@ -11796,6 +11974,7 @@ VKAPI_ATTR void VKAPI_CALL CmdPreprocessGeneratedCommandsNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGeneratedCommandsInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pGeneratedCommandsInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdPreprocessGeneratedCommandsNVHandles, pGeneratedCommandsInfo);
@@ -11820,6 +11999,7 @@ VKAPI_ATTR void VKAPI_CALL CmdExecuteGeneratedCommandsNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pGeneratedCommandsInfo));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeVkBool32Value(isPreprocessed);
         EncodeStructPtr(encoder, pGeneratedCommandsInfo);
@@ -11889,6 +12069,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateIndirectCommandsLayoutNV(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateIndirectCommandsLayoutNV);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -11954,6 +12135,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreatePrivateDataSlotEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreatePrivateDataSlotEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -12165,6 +12347,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateDirectFBSurfaceEXT(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateDirectFBSurfaceEXT);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(instance);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -12223,6 +12406,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateAccelerationStructureKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateAccelerationStructureKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pCreateInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pCreateInfo);
         EncodeStructPtr(encoder, pAllocator);
@@ -12273,6 +12457,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pInfos, infoCount) + ComputeStructArray2DEncodedSize(ppBuildRangeInfos, ArraySize2D<VkCommandBuffer, uint32_t, const VkAccelerationStructureBuildGeometryInfoKHR*, const VkAccelerationStructureBuildRangeInfoKHR* const*>(commandBuffer, infoCount, pInfos, ppBuildRangeInfos)));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(infoCount);
         EncodeStructArray(encoder, pInfos, infoCount);
@@ -12302,6 +12487,7 @@ VKAPI_ATTR void VKAPI_CALL CmdBuildAccelerationStructuresIndirectKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pInfos, infoCount));
         encoder->EncodeHandleValue(commandBuffer);
         encoder->EncodeUInt32Value(infoCount);
         EncodeStructArray(encoder, pInfos, infoCount);
@@ -12337,6 +12523,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyAccelerationStructureToMemoryKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(deferredOperation);
         EncodeStructPtr(encoder, pInfo);
@@ -12366,6 +12553,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CopyMemoryToAccelerationStructureKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(deferredOperation);
         EncodeStructPtr(encoder, pInfo);
@@ -12429,6 +12617,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdCopyAccelerationStructureKHRHandles, pInfo);
@@ -12452,6 +12641,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyAccelerationStructureToMemoryKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdCopyAccelerationStructureToMemoryKHRHandles, pInfo);
@@ -12475,6 +12665,7 @@ VKAPI_ATTR void VKAPI_CALL CmdCopyMemoryToAccelerationStructureKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pInfo);
         TraceManager::Get()->EndCommandApiCallTrace(commandBuffer, encoder, TrackCmdCopyMemoryToAccelerationStructureKHRHandles, pInfo);
@@ -12504,6 +12695,7 @@ VKAPI_ATTR VkDeviceAddress VKAPI_CALL GetAccelerationStructureDeviceAddressKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetAccelerationStructureDeviceAddressKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pInfo);
         encoder->EncodeVkDeviceAddressValue(result);
@@ -12561,6 +12753,7 @@ VKAPI_ATTR void VKAPI_CALL GetDeviceAccelerationStructureCompatibilityKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetDeviceAccelerationStructureCompatibilityKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pVersionInfo));
         encoder->EncodeHandleValue(device);
         EncodeStructPtr(encoder, pVersionInfo);
         encoder->EncodeEnumPtr(pCompatibility);
@@ -12588,6 +12781,7 @@ VKAPI_ATTR void VKAPI_CALL GetAccelerationStructureBuildSizesKHR(
     auto encoder = TraceManager::Get()->BeginApiCallTrace(format::ApiCallId::ApiCall_vkGetAccelerationStructureBuildSizesKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pBuildInfo));
         encoder->EncodeHandleValue(device);
         encoder->EncodeEnumValue(buildType);
         EncodeStructPtr(encoder, pBuildInfo);
@@ -12614,6 +12808,7 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdTraceRaysKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pRaygenShaderBindingTable) + ComputeStructPtrEncodedSize(pMissShaderBindingTable) + ComputeStructPtrEncodedSize(pHitShaderBindingTable) + ComputeStructPtrEncodedSize(pCallableShaderBindingTable));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pRaygenShaderBindingTable);
         EncodeStructPtr(encoder, pMissShaderBindingTable);
@@ -12665,6 +12860,7 @@ VKAPI_ATTR VkResult VKAPI_CALL CreateRayTracingPipelinesKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCreateRayTracingPipelinesKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructArrayEncodedSize(pCreateInfos, createInfoCount));
         encoder->EncodeHandleValue(device);
         encoder->EncodeHandleValue(deferredOperation);
         encoder->EncodeHandleValue(pipelineCache);
@@ -12733,6 +12929,7 @@ VKAPI_ATTR void VKAPI_CALL CmdTraceRaysIndirectKHR(
     auto encoder = TraceManager::Get()->BeginTrackedApiCallTrace(format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR);
     if (encoder)
     {
+        encoder->Reserve(ComputeStructPtrEncodedSize(pRaygenShaderBindingTable) + ComputeStructPtrEncodedSize(pMissShaderBindingTable) + ComputeStructPtrEncodedSize(pHitShaderBindingTable) + ComputeStructPtrEncodedSize(pCallableShaderBindingTable));
         encoder->EncodeHandleValue(commandBuffer);
         EncodeStructPtr(encoder, pRaygenShaderBindingTable);
         EncodeStructPtr(encoder, pMissShaderBindingTable);
@@ -28,6 +28,8 @@
 
 #include "generated/generated_vulkan_ascii_consumer.h"
 
+#include "decode/vulkan_json_util.h"
+#include "generated/generated_vulkan_struct_to_json.h"
 #include "util/defines.h"
 
 #include "vulkan/vulkan.h"
@@ -41,14 +43,21 @@ void VulkanAsciiConsumer::Process_vkCreateInstance(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkInstance>*           pInstance)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateInstance");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateInstance");
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pInstance", pInstance);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyInstance(
     format::HandleId                            instance,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyInstance");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyInstance");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDevices(
@@ -57,14 +66,21 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDevices(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceCount,
     HandlePointerDecoder<VkPhysicalDevice>*     pPhysicalDevices)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDevices");
+    util::JsonWriter& writer = WriteApiCallStart("vkEnumeratePhysicalDevices");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pPhysicalDeviceCount", pPhysicalDeviceCount);
+    FieldToJson(writer, "pPhysicalDevices", pPhysicalDevices);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFeatures(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures>* pFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFeatures");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceFeatures");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pFeatures", pFeatures);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties(
@@ -72,7 +88,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties>* pFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFormatProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceFormatProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "format", format);
+    FieldToJson(writer, "pFormatProperties", pFormatProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
@@ -85,14 +105,25 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties(
     VkImageCreateFlags                          flags,
     StructPointerDecoder<Decoded_VkImageFormatProperties>* pImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceImageFormatProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceImageFormatProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "format", format);
+    FieldToJson(writer, "type", type);
+    FieldToJson(writer, "tiling", tiling);
+    FieldToJson(writer, "usage", usage);
+    FieldToJson(writer, "flags", flags);
+    FieldToJson(writer, "pImageFormatProperties", pImageFormatProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
@@ -100,14 +131,21 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties>* pQueueFamilyProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceQueueFamilyProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pQueueFamilyPropertyCount", pQueueFamilyPropertyCount);
+    FieldToJson(writer, "pQueueFamilyProperties", pQueueFamilyProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMemoryProperties(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties>* pMemoryProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMemoryProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceMemoryProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pMemoryProperties", pMemoryProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDevice(
@@ -117,14 +155,22 @@ void VulkanAsciiConsumer::Process_vkCreateDevice(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDevice>*             pDevice)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDevice");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDevice");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pDevice", pDevice);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDevice(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDevice");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDevice");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceQueue(
@@ -133,7 +179,12 @@ void VulkanAsciiConsumer::Process_vkGetDeviceQueue(
     uint32_t                                    queueIndex,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceQueue");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceQueue");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    FieldToJson(writer, "queueIndex", queueIndex);
+    FieldToJson(writer, "pQueue", pQueue);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkQueueSubmit(
@@ -143,21 +194,30 @@ void VulkanAsciiConsumer::Process_vkQueueSubmit(
     StructPointerDecoder<Decoded_VkSubmitInfo>* pSubmits,
     format::HandleId                            fence)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueSubmit");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueueSubmit");
+    FieldToJson(writer, "queue", queue);
+    FieldToJson(writer, "submitCount", submitCount);
+    FieldToJson(writer, "pSubmits", pSubmits);
+    FieldToJson(writer, "fence", fence);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkQueueWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            queue)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueWaitIdle");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueueWaitIdle");
+    FieldToJson(writer, "queue", queue);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDeviceWaitIdle(
     VkResult                                    returnValue,
     format::HandleId                            device)
 {
-    fprintf(GetFile(), "%s\n", "vkDeviceWaitIdle");
+    util::JsonWriter& writer = WriteApiCallStart("vkDeviceWaitIdle");
+    FieldToJson(writer, "device", device);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAllocateMemory(
@@ -167,7 +227,12 @@ void VulkanAsciiConsumer::Process_vkAllocateMemory(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeviceMemory>*       pMemory)
 {
-    fprintf(GetFile(), "%s\n", "vkAllocateMemory");
+    util::JsonWriter& writer = WriteApiCallStart("vkAllocateMemory");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pAllocateInfo", pAllocateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pMemory", pMemory);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkFreeMemory(
@@ -175,7 +240,11 @@ void VulkanAsciiConsumer::Process_vkFreeMemory(
     format::HandleId                            memory,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkFreeMemory");
+    util::JsonWriter& writer = WriteApiCallStart("vkFreeMemory");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "memory", memory);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkMapMemory(
@@ -187,14 +256,24 @@ void VulkanAsciiConsumer::Process_vkMapMemory(
     VkMemoryMapFlags                            flags,
     PointerDecoder<uint64_t, void*>*            ppData)
 {
-    fprintf(GetFile(), "%s\n", "vkMapMemory");
+    util::JsonWriter& writer = WriteApiCallStart("vkMapMemory");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "memory", memory);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "size", size);
+    FieldToJson(writer, "flags", flags);
+    FieldToJson(writer, "ppData", ppData);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkUnmapMemory(
     format::HandleId                            device,
     format::HandleId                            memory)
 {
-    fprintf(GetFile(), "%s\n", "vkUnmapMemory");
+    util::JsonWriter& writer = WriteApiCallStart("vkUnmapMemory");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "memory", memory);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkFlushMappedMemoryRanges(
@@ -203,7 +282,11 @@ void VulkanAsciiConsumer::Process_vkFlushMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkFlushMappedMemoryRanges");
+    util::JsonWriter& writer = WriteApiCallStart("vkFlushMappedMemoryRanges");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "memoryRangeCount", memoryRangeCount);
+    FieldToJson(writer, "pMemoryRanges", pMemoryRanges);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkInvalidateMappedMemoryRanges(
@@ -212,7 +295,11 @@ void VulkanAsciiConsumer::Process_vkInvalidateMappedMemoryRanges(
     uint32_t                                    memoryRangeCount,
     StructPointerDecoder<Decoded_VkMappedMemoryRange>* pMemoryRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkInvalidateMappedMemoryRanges");
+    util::JsonWriter& writer = WriteApiCallStart("vkInvalidateMappedMemoryRanges");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "memoryRangeCount", memoryRangeCount);
+    FieldToJson(writer, "pMemoryRanges", pMemoryRanges);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceMemoryCommitment(
@@ -220,7 +307,11 @@ void VulkanAsciiConsumer::Process_vkGetDeviceMemoryCommitment(
     format::HandleId                            memory,
     PointerDecoder<VkDeviceSize>*               pCommittedMemoryInBytes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceMemoryCommitment");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceMemoryCommitment");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "memory", memory);
+    FieldToJson(writer, "pCommittedMemoryInBytes", pCommittedMemoryInBytes);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkBindBufferMemory(
@@ -230,7 +321,12 @@ void VulkanAsciiConsumer::Process_vkBindBufferMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    fprintf(GetFile(), "%s\n", "vkBindBufferMemory");
+    util::JsonWriter& writer = WriteApiCallStart("vkBindBufferMemory");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "memory", memory);
+    FieldToJson(writer, "memoryOffset", memoryOffset);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkBindImageMemory(
@@ -240,7 +336,12 @@ void VulkanAsciiConsumer::Process_vkBindImageMemory(
     format::HandleId                            memory,
     VkDeviceSize                                memoryOffset)
 {
-    fprintf(GetFile(), "%s\n", "vkBindImageMemory");
+    util::JsonWriter& writer = WriteApiCallStart("vkBindImageMemory");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "memory", memory);
+    FieldToJson(writer, "memoryOffset", memoryOffset);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements(
@@ -248,7 +349,11 @@ void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferMemoryRequirements");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferMemoryRequirements");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements(
@@ -256,7 +361,11 @@ void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkMemoryRequirements>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageMemoryRequirements");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageMemoryRequirements");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements(
@@ -265,7 +374,12 @@ void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements>* pSparseMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSparseMemoryRequirements");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageSparseMemoryRequirements");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "pSparseMemoryRequirementCount", pSparseMemoryRequirementCount);
+    FieldToJson(writer, "pSparseMemoryRequirements", pSparseMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties(
@@ -278,7 +392,16 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSparseImageFormatProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSparseImageFormatProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "format", format);
+    FieldToJson(writer, "type", type);
+    FieldToJson(writer, "samples", samples);
+    FieldToJson(writer, "usage", usage);
+    FieldToJson(writer, "tiling", tiling);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkQueueBindSparse(
@@ -288,7 +411,12 @@ void VulkanAsciiConsumer::Process_vkQueueBindSparse(
     StructPointerDecoder<Decoded_VkBindSparseInfo>* pBindInfo,
     format::HandleId                            fence)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueBindSparse");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueueBindSparse");
+    FieldToJson(writer, "queue", queue);
+    FieldToJson(writer, "bindInfoCount", bindInfoCount);
+    FieldToJson(writer, "pBindInfo", pBindInfo);
+    FieldToJson(writer, "fence", fence);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateFence(
@@ -298,7 +426,12 @@ void VulkanAsciiConsumer::Process_vkCreateFence(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateFence");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateFence");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pFence", pFence);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyFence(
@@ -306,7 +439,11 @@ void VulkanAsciiConsumer::Process_vkDestroyFence(
     format::HandleId                            fence,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyFence");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyFence");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "fence", fence);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkResetFences(
@@ -315,7 +452,11 @@ void VulkanAsciiConsumer::Process_vkResetFences(
     uint32_t                                    fenceCount,
     HandlePointerDecoder<VkFence>*              pFences)
 {
-    fprintf(GetFile(), "%s\n", "vkResetFences");
+    util::JsonWriter& writer = WriteApiCallStart("vkResetFences");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "fenceCount", fenceCount);
+    FieldToJson(writer, "pFences", pFences);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetFenceStatus(
@@ -323,7 +464,10 @@ void VulkanAsciiConsumer::Process_vkGetFenceStatus(
     format::HandleId                            device,
     format::HandleId                            fence)
 {
-    fprintf(GetFile(), "%s\n", "vkGetFenceStatus");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetFenceStatus");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "fence", fence);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkWaitForFences(
@@ -334,7 +478,13 @@ void VulkanAsciiConsumer::Process_vkWaitForFences(
     VkBool32                                    waitAll,
     uint64_t                                    timeout)
 {
-    fprintf(GetFile(), "%s\n", "vkWaitForFences");
+    util::JsonWriter& writer = WriteApiCallStart("vkWaitForFences");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "fenceCount", fenceCount);
+    FieldToJson(writer, "pFences", pFences);
+    FieldToJson(writer, "waitAll", waitAll);
+    FieldToJson(writer, "timeout", timeout);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSemaphore(
@@ -344,7 +494,12 @@ void VulkanAsciiConsumer::Process_vkCreateSemaphore(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSemaphore>*          pSemaphore)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSemaphore");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateSemaphore");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSemaphore", pSemaphore);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySemaphore(
@@ -352,7 +507,11 @@ void VulkanAsciiConsumer::Process_vkDestroySemaphore(
     format::HandleId                            semaphore,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySemaphore");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroySemaphore");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "semaphore", semaphore);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateEvent(
@@ -362,7 +521,12 @@ void VulkanAsciiConsumer::Process_vkCreateEvent(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkEvent>*              pEvent)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateEvent");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateEvent");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pEvent", pEvent);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyEvent(
@@ -370,7 +534,11 @@ void VulkanAsciiConsumer::Process_vkDestroyEvent(
     format::HandleId                            event,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyEvent");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyEvent");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "event", event);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetEventStatus(
@@ -378,7 +546,10 @@ void VulkanAsciiConsumer::Process_vkGetEventStatus(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    fprintf(GetFile(), "%s\n", "vkGetEventStatus");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetEventStatus");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "event", event);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkSetEvent(
@@ -386,7 +557,10 @@ void VulkanAsciiConsumer::Process_vkSetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    fprintf(GetFile(), "%s\n", "vkSetEvent");
+    util::JsonWriter& writer = WriteApiCallStart("vkSetEvent");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "event", event);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkResetEvent(
@@ -394,7 +568,10 @@ void VulkanAsciiConsumer::Process_vkResetEvent(
     format::HandleId                            device,
     format::HandleId                            event)
 {
-    fprintf(GetFile(), "%s\n", "vkResetEvent");
+    util::JsonWriter& writer = WriteApiCallStart("vkResetEvent");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "event", event);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateQueryPool(
@@ -404,7 +581,12 @@ void VulkanAsciiConsumer::Process_vkCreateQueryPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkQueryPool>*          pQueryPool)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateQueryPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateQueryPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pQueryPool", pQueryPool);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyQueryPool(
@@ -412,7 +594,11 @@ void VulkanAsciiConsumer::Process_vkDestroyQueryPool(
     format::HandleId                            queryPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyQueryPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyQueryPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetQueryPoolResults(
@@ -426,7 +612,16 @@ void VulkanAsciiConsumer::Process_vkGetQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    fprintf(GetFile(), "%s\n", "vkGetQueryPoolResults");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetQueryPoolResults");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "firstQuery", firstQuery);
+    FieldToJson(writer, "queryCount", queryCount);
+    FieldToJson(writer, "dataSize", dataSize);
+    FieldToJson(writer, "pData", pData);
+    FieldToJson(writer, "stride", stride);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateBuffer(
@@ -436,7 +631,12 @@ void VulkanAsciiConsumer::Process_vkCreateBuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBuffer>*             pBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateBuffer");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pBuffer", pBuffer);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyBuffer(
@@ -444,7 +644,11 @@ void VulkanAsciiConsumer::Process_vkDestroyBuffer(
     format::HandleId                            buffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyBuffer");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateBufferView(
@@ -454,7 +658,12 @@ void VulkanAsciiConsumer::Process_vkCreateBufferView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkBufferView>*         pView)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateBufferView");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateBufferView");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pView", pView);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyBufferView(
@@ -462,7 +671,11 @@ void VulkanAsciiConsumer::Process_vkDestroyBufferView(
     format::HandleId                            bufferView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyBufferView");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyBufferView");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "bufferView", bufferView);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateImage(
@@ -472,7 +685,12 @@ void VulkanAsciiConsumer::Process_vkCreateImage(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImage>*              pImage)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateImage");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pImage", pImage);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyImage(
@@ -480,7 +698,11 @@ void VulkanAsciiConsumer::Process_vkDestroyImage(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyImage");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSubresourceLayout(
@@ -489,7 +711,12 @@ void VulkanAsciiConsumer::Process_vkGetImageSubresourceLayout(
     StructPointerDecoder<Decoded_VkImageSubresource>* pSubresource,
     StructPointerDecoder<Decoded_VkSubresourceLayout>* pLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSubresourceLayout");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageSubresourceLayout");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "pSubresource", pSubresource);
+    FieldToJson(writer, "pLayout", pLayout);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateImageView(
@@ -499,7 +726,12 @@ void VulkanAsciiConsumer::Process_vkCreateImageView(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkImageView>*          pView)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateImageView");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateImageView");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pView", pView);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyImageView(
@@ -507,7 +739,11 @@ void VulkanAsciiConsumer::Process_vkDestroyImageView(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyImageView");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyImageView");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "imageView", imageView);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateShaderModule(
@@ -517,7 +753,12 @@ void VulkanAsciiConsumer::Process_vkCreateShaderModule(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkShaderModule>*       pShaderModule)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateShaderModule");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateShaderModule");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pShaderModule", pShaderModule);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyShaderModule(
@@ -525,7 +766,11 @@ void VulkanAsciiConsumer::Process_vkDestroyShaderModule(
     format::HandleId                            shaderModule,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyShaderModule");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyShaderModule");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "shaderModule", shaderModule);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreatePipelineCache(
@@ -535,7 +780,12 @@ void VulkanAsciiConsumer::Process_vkCreatePipelineCache(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipelineCache>*      pPipelineCache)
 {
-    fprintf(GetFile(), "%s\n", "vkCreatePipelineCache");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreatePipelineCache");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pPipelineCache", pPipelineCache);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPipelineCache(
@@ -543,7 +793,11 @@ void VulkanAsciiConsumer::Process_vkDestroyPipelineCache(
     format::HandleId                            pipelineCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPipelineCache");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyPipelineCache");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipelineCache", pipelineCache);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineCacheData(
@@ -553,7 +807,12 @@ void VulkanAsciiConsumer::Process_vkGetPipelineCacheData(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineCacheData");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPipelineCacheData");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipelineCache", pipelineCache);
+    FieldToJson(writer, "pDataSize", pDataSize);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkMergePipelineCaches(
@@ -563,7 +822,12 @@ void VulkanAsciiConsumer::Process_vkMergePipelineCaches(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkPipelineCache>*      pSrcCaches)
 {
-    fprintf(GetFile(), "%s\n", "vkMergePipelineCaches");
+    util::JsonWriter& writer = WriteApiCallStart("vkMergePipelineCaches");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "dstCache", dstCache);
+    FieldToJson(writer, "srcCacheCount", srcCacheCount);
+    FieldToJson(writer, "pSrcCaches", pSrcCaches);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateGraphicsPipelines(
@@ -575,7 +839,14 @@ void VulkanAsciiConsumer::Process_vkCreateGraphicsPipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateGraphicsPipelines");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateGraphicsPipelines");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipelineCache", pipelineCache);
+    FieldToJson(writer, "createInfoCount", createInfoCount);
+    FieldToJson(writer, "pCreateInfos", pCreateInfos);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pPipelines", pPipelines);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateComputePipelines(
@@ -587,7 +858,14 @@ void VulkanAsciiConsumer::Process_vkCreateComputePipelines(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateComputePipelines");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateComputePipelines");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipelineCache", pipelineCache);
+    FieldToJson(writer, "createInfoCount", createInfoCount);
+    FieldToJson(writer, "pCreateInfos", pCreateInfos);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pPipelines", pPipelines);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPipeline(
@@ -595,7 +873,11 @@ void VulkanAsciiConsumer::Process_vkDestroyPipeline(
     format::HandleId                            pipeline,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPipeline");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyPipeline");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreatePipelineLayout(
@@ -605,7 +887,12 @@ void VulkanAsciiConsumer::Process_vkCreatePipelineLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipelineLayout>*     pPipelineLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCreatePipelineLayout");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreatePipelineLayout");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pPipelineLayout", pPipelineLayout);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPipelineLayout(
@@ -613,7 +900,11 @@ void VulkanAsciiConsumer::Process_vkDestroyPipelineLayout(
     format::HandleId                            pipelineLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPipelineLayout");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyPipelineLayout");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipelineLayout", pipelineLayout);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSampler(
@@ -623,7 +914,12 @@ void VulkanAsciiConsumer::Process_vkCreateSampler(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSampler>*            pSampler)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSampler");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateSampler");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSampler", pSampler);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySampler(
@@ -631,7 +927,11 @@ void VulkanAsciiConsumer::Process_vkDestroySampler(
     format::HandleId                            sampler,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySampler");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroySampler");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "sampler", sampler);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorSetLayout(
@@ -641,7 +941,12 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorSetLayout(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorSetLayout>* pSetLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorSetLayout");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDescriptorSetLayout");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSetLayout", pSetLayout);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorSetLayout(
@@ -649,7 +954,11 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorSetLayout(
     format::HandleId                            descriptorSetLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorSetLayout");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDescriptorSetLayout");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorSetLayout", descriptorSetLayout);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorPool(
@@ -659,7 +968,12 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorPool>*     pDescriptorPool)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDescriptorPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pDescriptorPool", pDescriptorPool);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorPool(
@@ -667,7 +981,11 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorPool(
     format::HandleId                            descriptorPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDescriptorPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorPool", descriptorPool);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkResetDescriptorPool(
@@ -676,7 +994,11 @@ void VulkanAsciiConsumer::Process_vkResetDescriptorPool(
     format::HandleId                            descriptorPool,
     VkDescriptorPoolResetFlags                  flags)
 {
-    fprintf(GetFile(), "%s\n", "vkResetDescriptorPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkResetDescriptorPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorPool", descriptorPool);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAllocateDescriptorSets(
@@ -685,7 +1007,11 @@ void VulkanAsciiConsumer::Process_vkAllocateDescriptorSets(
     StructPointerDecoder<Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    fprintf(GetFile(), "%s\n", "vkAllocateDescriptorSets");
+    util::JsonWriter& writer = WriteApiCallStart("vkAllocateDescriptorSets");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pAllocateInfo", pAllocateInfo);
+    FieldToJson(writer, "pDescriptorSets", pDescriptorSets);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkFreeDescriptorSets(
@@ -695,7 +1021,12 @@ void VulkanAsciiConsumer::Process_vkFreeDescriptorSets(
     uint32_t                                    descriptorSetCount,
     HandlePointerDecoder<VkDescriptorSet>*      pDescriptorSets)
 {
-    fprintf(GetFile(), "%s\n", "vkFreeDescriptorSets");
+    util::JsonWriter& writer = WriteApiCallStart("vkFreeDescriptorSets");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorPool", descriptorPool);
+    FieldToJson(writer, "descriptorSetCount", descriptorSetCount);
+    FieldToJson(writer, "pDescriptorSets", pDescriptorSets);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkUpdateDescriptorSets(
@@ -705,7 +1036,13 @@ void VulkanAsciiConsumer::Process_vkUpdateDescriptorSets(
     uint32_t                                    descriptorCopyCount,
     StructPointerDecoder<Decoded_VkCopyDescriptorSet>* pDescriptorCopies)
 {
-    fprintf(GetFile(), "%s\n", "vkUpdateDescriptorSets");
+    util::JsonWriter& writer = WriteApiCallStart("vkUpdateDescriptorSets");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorWriteCount", descriptorWriteCount);
+    FieldToJson(writer, "pDescriptorWrites", pDescriptorWrites);
+    FieldToJson(writer, "descriptorCopyCount", descriptorCopyCount);
+    FieldToJson(writer, "pDescriptorCopies", pDescriptorCopies);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateFramebuffer(
@@ -715,7 +1052,12 @@ void VulkanAsciiConsumer::Process_vkCreateFramebuffer(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFramebuffer>*        pFramebuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateFramebuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateFramebuffer");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pFramebuffer", pFramebuffer);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyFramebuffer(
@@ -723,7 +1065,11 @@ void VulkanAsciiConsumer::Process_vkDestroyFramebuffer(
     format::HandleId                            framebuffer,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyFramebuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyFramebuffer");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "framebuffer", framebuffer);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRenderPass(
@@ -733,7 +1079,12 @@ void VulkanAsciiConsumer::Process_vkCreateRenderPass(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRenderPass");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateRenderPass");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pRenderPass", pRenderPass);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyRenderPass(
@@ -741,7 +1092,11 @@ void VulkanAsciiConsumer::Process_vkDestroyRenderPass(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyRenderPass");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyRenderPass");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "renderPass", renderPass);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetRenderAreaGranularity(
@@ -749,7 +1104,11 @@ void VulkanAsciiConsumer::Process_vkGetRenderAreaGranularity(
     format::HandleId                            renderPass,
     StructPointerDecoder<Decoded_VkExtent2D>*   pGranularity)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRenderAreaGranularity");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetRenderAreaGranularity");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "renderPass", renderPass);
+    FieldToJson(writer, "pGranularity", pGranularity);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateCommandPool(
@@ -759,7 +1118,12 @@ void VulkanAsciiConsumer::Process_vkCreateCommandPool(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkCommandPool>*        pCommandPool)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateCommandPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateCommandPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pCommandPool", pCommandPool);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyCommandPool(
@@ -767,7 +1131,11 @@ void VulkanAsciiConsumer::Process_vkDestroyCommandPool(
     format::HandleId                            commandPool,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyCommandPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyCommandPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "commandPool", commandPool);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkResetCommandPool(
@@ -776,7 +1144,11 @@ void VulkanAsciiConsumer::Process_vkResetCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolResetFlags                     flags)
 {
-    fprintf(GetFile(), "%s\n", "vkResetCommandPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkResetCommandPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "commandPool", commandPool);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAllocateCommandBuffers(
@@ -785,7 +1157,11 @@ void VulkanAsciiConsumer::Process_vkAllocateCommandBuffers(
     StructPointerDecoder<Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    fprintf(GetFile(), "%s\n", "vkAllocateCommandBuffers");
+    util::JsonWriter& writer = WriteApiCallStart("vkAllocateCommandBuffers");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pAllocateInfo", pAllocateInfo);
+    FieldToJson(writer, "pCommandBuffers", pCommandBuffers);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkFreeCommandBuffers(
@@ -794,7 +1170,12 @@ void VulkanAsciiConsumer::Process_vkFreeCommandBuffers(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    fprintf(GetFile(), "%s\n", "vkFreeCommandBuffers");
+    util::JsonWriter& writer = WriteApiCallStart("vkFreeCommandBuffers");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "commandPool", commandPool);
+    FieldToJson(writer, "commandBufferCount", commandBufferCount);
+    FieldToJson(writer, "pCommandBuffers", pCommandBuffers);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkBeginCommandBuffer(
@@ -802,14 +1183,19 @@ void VulkanAsciiConsumer::Process_vkBeginCommandBuffer(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCommandBufferBeginInfo>* pBeginInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkBeginCommandBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkBeginCommandBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pBeginInfo", pBeginInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkEndCommandBuffer(
     VkResult                                    returnValue,
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkEndCommandBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkEndCommandBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkResetCommandBuffer(
@@ -817,7 +1203,10 @@ void VulkanAsciiConsumer::Process_vkResetCommandBuffer(
     format::HandleId                            commandBuffer,
     VkCommandBufferResetFlags                   flags)
 {
-    fprintf(GetFile(), "%s\n", "vkResetCommandBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkResetCommandBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindPipeline(
@@ -825,7 +1214,11 @@ void VulkanAsciiConsumer::Process_vkCmdBindPipeline(
     VkPipelineBindPoint                         pipelineBindPoint,
     format::HandleId                            pipeline)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindPipeline");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindPipeline");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pipelineBindPoint", pipelineBindPoint);
+    FieldToJson(writer, "pipeline", pipeline);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewport(
@@ -834,7 +1227,12 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewport(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewport");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetViewport");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstViewport", firstViewport);
+    FieldToJson(writer, "viewportCount", viewportCount);
+    FieldToJson(writer, "pViewports", pViewports);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetScissor(
@@ -843,14 +1241,22 @@ void VulkanAsciiConsumer::Process_vkCmdSetScissor(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetScissor");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetScissor");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstScissor", firstScissor);
+    FieldToJson(writer, "scissorCount", scissorCount);
+    FieldToJson(writer, "pScissors", pScissors);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetLineWidth(
     format::HandleId                            commandBuffer,
     float                                       lineWidth)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetLineWidth");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetLineWidth");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "lineWidth", lineWidth);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthBias(
@@ -859,14 +1265,22 @@ void VulkanAsciiConsumer::Process_vkCmdSetDepthBias(
     float                                       depthBiasClamp,
     float                                       depthBiasSlopeFactor)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthBias");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDepthBias");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "depthBiasConstantFactor", depthBiasConstantFactor);
+    FieldToJson(writer, "depthBiasClamp", depthBiasClamp);
+    FieldToJson(writer, "depthBiasSlopeFactor", depthBiasSlopeFactor);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetBlendConstants(
     format::HandleId                            commandBuffer,
     PointerDecoder<float>*                      blendConstants)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetBlendConstants");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetBlendConstants");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "blendConstants", blendConstants);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthBounds(
@@ -874,7 +1288,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetDepthBounds(
     float                                       minDepthBounds,
     float                                       maxDepthBounds)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthBounds");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDepthBounds");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "minDepthBounds", minDepthBounds);
+    FieldToJson(writer, "maxDepthBounds", maxDepthBounds);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilCompareMask(
@@ -882,7 +1300,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilCompareMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    compareMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilCompareMask");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetStencilCompareMask");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "faceMask", faceMask);
+    FieldToJson(writer, "compareMask", compareMask);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilWriteMask(
@@ -890,7 +1312,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilWriteMask(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    writeMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilWriteMask");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetStencilWriteMask");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "faceMask", faceMask);
+    FieldToJson(writer, "writeMask", writeMask);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilReference(
@@ -898,7 +1324,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilReference(
     VkStencilFaceFlags                          faceMask,
     uint32_t                                    reference)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilReference");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetStencilReference");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "faceMask", faceMask);
+    FieldToJson(writer, "reference", reference);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindDescriptorSets(
@@ -911,7 +1341,16 @@ void VulkanAsciiConsumer::Process_vkCmdBindDescriptorSets(
     uint32_t                                    dynamicOffsetCount,
     PointerDecoder<uint32_t>*                   pDynamicOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindDescriptorSets");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindDescriptorSets");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pipelineBindPoint", pipelineBindPoint);
+    FieldToJson(writer, "layout", layout);
+    FieldToJson(writer, "firstSet", firstSet);
+    FieldToJson(writer, "descriptorSetCount", descriptorSetCount);
+    FieldToJson(writer, "pDescriptorSets", pDescriptorSets);
+    FieldToJson(writer, "dynamicOffsetCount", dynamicOffsetCount);
+    FieldToJson(writer, "pDynamicOffsets", pDynamicOffsets);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindIndexBuffer(
@@ -920,7 +1359,12 @@ void VulkanAsciiConsumer::Process_vkCmdBindIndexBuffer(
     VkDeviceSize                                offset,
     VkIndexType                                 indexType)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindIndexBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindIndexBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "indexType", indexType);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers(
@@ -930,7 +1374,13 @@ void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers(
     HandlePointerDecoder<VkBuffer>*             pBuffers,
     PointerDecoder<VkDeviceSize>*               pOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindVertexBuffers");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindVertexBuffers");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstBinding", firstBinding);
+    FieldToJson(writer, "bindingCount", bindingCount);
+    FieldToJson(writer, "pBuffers", pBuffers);
+    FieldToJson(writer, "pOffsets", pOffsets);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDraw(
@@ -940,7 +1390,13 @@ void VulkanAsciiConsumer::Process_vkCmdDraw(
     uint32_t                                    firstVertex,
     uint32_t                                    firstInstance)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDraw");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDraw");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "vertexCount", vertexCount);
+    FieldToJson(writer, "instanceCount", instanceCount);
+    FieldToJson(writer, "firstVertex", firstVertex);
+    FieldToJson(writer, "firstInstance", firstInstance);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexed(
@@ -951,7 +1407,14 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexed(
     int32_t                                     vertexOffset,
     uint32_t                                    firstInstance)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexed");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndexed");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "indexCount", indexCount);
+    FieldToJson(writer, "instanceCount", instanceCount);
+    FieldToJson(writer, "firstIndex", firstIndex);
+    FieldToJson(writer, "vertexOffset", vertexOffset);
+    FieldToJson(writer, "firstInstance", firstInstance);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirect(
@@ -961,7 +1424,13 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirect");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndirect");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "drawCount", drawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirect(
@@ -971,7 +1440,13 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirect(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirect");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndexedIndirect");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "drawCount", drawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatch(
@@ -980,7 +1455,12 @@ void VulkanAsciiConsumer::Process_vkCmdDispatch(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatch");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDispatch");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "groupCountX", groupCountX);
+    FieldToJson(writer, "groupCountY", groupCountY);
+    FieldToJson(writer, "groupCountZ", groupCountZ);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatchIndirect(
@@ -988,7 +1468,11 @@ void VulkanAsciiConsumer::Process_vkCmdDispatchIndirect(
     format::HandleId                            buffer,
     VkDeviceSize                                offset)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatchIndirect");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDispatchIndirect");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBuffer(
@@ -998,7 +1482,13 @@ void VulkanAsciiConsumer::Process_vkCmdCopyBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferCopy>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "srcBuffer", srcBuffer);
+    FieldToJson(writer, "dstBuffer", dstBuffer);
+    FieldToJson(writer, "regionCount", regionCount);
+    FieldToJson(writer, "pRegions", pRegions);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImage(
@@ -1010,7 +1500,15 @@ void VulkanAsciiConsumer::Process_vkCmdCopyImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageCopy>*  pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyImage");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "srcImage", srcImage);
+    FieldToJson(writer, "srcImageLayout", srcImageLayout);
+    FieldToJson(writer, "dstImage", dstImage);
+    FieldToJson(writer, "dstImageLayout", dstImageLayout);
+    FieldToJson(writer, "regionCount", regionCount);
+    FieldToJson(writer, "pRegions", pRegions);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBlitImage(
@@ -1023,7 +1521,16 @@ void VulkanAsciiConsumer::Process_vkCmdBlitImage(
     StructPointerDecoder<Decoded_VkImageBlit>*  pRegions,
     VkFilter                                    filter)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBlitImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBlitImage");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "srcImage", srcImage);
+    FieldToJson(writer, "srcImageLayout", srcImageLayout);
+    FieldToJson(writer, "dstImage", dstImage);
+    FieldToJson(writer, "dstImageLayout", dstImageLayout);
+    FieldToJson(writer, "regionCount", regionCount);
+    FieldToJson(writer, "pRegions", pRegions);
+    FieldToJson(writer, "filter", filter);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBufferToImage(
@@ -1034,7 +1541,14 @@ void VulkanAsciiConsumer::Process_vkCmdCopyBufferToImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBufferToImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyBufferToImage");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "srcBuffer", srcBuffer);
+    FieldToJson(writer, "dstImage", dstImage);
+    FieldToJson(writer, "dstImageLayout", dstImageLayout);
+    FieldToJson(writer, "regionCount", regionCount);
+    FieldToJson(writer, "pRegions", pRegions);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImageToBuffer(
@@ -1045,7 +1559,14 @@ void VulkanAsciiConsumer::Process_vkCmdCopyImageToBuffer(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkBufferImageCopy>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImageToBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyImageToBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "srcImage", srcImage);
+    FieldToJson(writer, "srcImageLayout", srcImageLayout);
+    FieldToJson(writer, "dstBuffer", dstBuffer);
+    FieldToJson(writer, "regionCount", regionCount);
+    FieldToJson(writer, "pRegions", pRegions);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdUpdateBuffer(
@@ -1055,7 +1576,13 @@ void VulkanAsciiConsumer::Process_vkCmdUpdateBuffer(
     VkDeviceSize                                dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdUpdateBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdUpdateBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "dstBuffer", dstBuffer);
+    FieldToJson(writer, "dstOffset", dstOffset);
+    FieldToJson(writer, "dataSize", dataSize);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdFillBuffer(
@@ -1065,7 +1592,13 @@ void VulkanAsciiConsumer::Process_vkCmdFillBuffer(
     VkDeviceSize                                size,
     uint32_t                                    data)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdFillBuffer");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdFillBuffer");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "dstBuffer", dstBuffer);
+    FieldToJson(writer, "dstOffset", dstOffset);
+    FieldToJson(writer, "size", size);
+    FieldToJson(writer, "data", data);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdClearColorImage(
@@ -1076,7 +1609,14 @@ void VulkanAsciiConsumer::Process_vkCmdClearColorImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdClearColorImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdClearColorImage");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "imageLayout", imageLayout);
+    FieldToJson(writer, "pColor", pColor);
+    FieldToJson(writer, "rangeCount", rangeCount);
+    FieldToJson(writer, "pRanges", pRanges);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdClearDepthStencilImage(
@@ -1087,7 +1627,14 @@ void VulkanAsciiConsumer::Process_vkCmdClearDepthStencilImage(
     uint32_t                                    rangeCount,
     StructPointerDecoder<Decoded_VkImageSubresourceRange>* pRanges)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdClearDepthStencilImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdClearDepthStencilImage");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "imageLayout", imageLayout);
+    FieldToJson(writer, "pDepthStencil", pDepthStencil);
+    FieldToJson(writer, "rangeCount", rangeCount);
+    FieldToJson(writer, "pRanges", pRanges);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdClearAttachments(
@@ -1097,7 +1644,13 @@ void VulkanAsciiConsumer::Process_vkCmdClearAttachments(
     uint32_t                                    rectCount,
     StructPointerDecoder<Decoded_VkClearRect>*  pRects)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdClearAttachments");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdClearAttachments");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "attachmentCount", attachmentCount);
+    FieldToJson(writer, "pAttachments", pAttachments);
+    FieldToJson(writer, "rectCount", rectCount);
+    FieldToJson(writer, "pRects", pRects);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResolveImage(
@@ -1109,7 +1662,15 @@ void VulkanAsciiConsumer::Process_vkCmdResolveImage(
     uint32_t                                    regionCount,
     StructPointerDecoder<Decoded_VkImageResolve>* pRegions)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResolveImage");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdResolveImage");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "srcImage", srcImage);
+    FieldToJson(writer, "srcImageLayout", srcImageLayout);
+    FieldToJson(writer, "dstImage", dstImage);
+    FieldToJson(writer, "dstImageLayout", dstImageLayout);
+    FieldToJson(writer, "regionCount", regionCount);
+    FieldToJson(writer, "pRegions", pRegions);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetEvent(
@@ -1117,7 +1678,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetEvent");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetEvent");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "event", event);
+    FieldToJson(writer, "stageMask", stageMask);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResetEvent(
@@ -1125,7 +1690,11 @@ void VulkanAsciiConsumer::Process_vkCmdResetEvent(
     format::HandleId                            event,
     VkPipelineStageFlags                        stageMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResetEvent");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdResetEvent");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "event", event);
+    FieldToJson(writer, "stageMask", stageMask);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWaitEvents(
@@ -1141,7 +1710,19 @@ void VulkanAsciiConsumer::Process_vkCmdWaitEvents(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWaitEvents");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdWaitEvents");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "eventCount", eventCount);
+    FieldToJson(writer, "pEvents", pEvents);
+    FieldToJson(writer, "srcStageMask", srcStageMask);
+    FieldToJson(writer, "dstStageMask", dstStageMask);
+    FieldToJson(writer, "memoryBarrierCount", memoryBarrierCount);
+    FieldToJson(writer, "pMemoryBarriers", pMemoryBarriers);
+    FieldToJson(writer, "bufferMemoryBarrierCount", bufferMemoryBarrierCount);
+    FieldToJson(writer, "pBufferMemoryBarriers", pBufferMemoryBarriers);
+    FieldToJson(writer, "imageMemoryBarrierCount", imageMemoryBarrierCount);
+    FieldToJson(writer, "pImageMemoryBarriers", pImageMemoryBarriers);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPipelineBarrier(
@@ -1156,7 +1737,18 @@ void VulkanAsciiConsumer::Process_vkCmdPipelineBarrier(
     uint32_t                                    imageMemoryBarrierCount,
     StructPointerDecoder<Decoded_VkImageMemoryBarrier>* pImageMemoryBarriers)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPipelineBarrier");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdPipelineBarrier");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "srcStageMask", srcStageMask);
+    FieldToJson(writer, "dstStageMask", dstStageMask);
+    FieldToJson(writer, "dependencyFlags", dependencyFlags);
+    FieldToJson(writer, "memoryBarrierCount", memoryBarrierCount);
+    FieldToJson(writer, "pMemoryBarriers", pMemoryBarriers);
+    FieldToJson(writer, "bufferMemoryBarrierCount", bufferMemoryBarrierCount);
+    FieldToJson(writer, "pBufferMemoryBarriers", pBufferMemoryBarriers);
+    FieldToJson(writer, "imageMemoryBarrierCount", imageMemoryBarrierCount);
+    FieldToJson(writer, "pImageMemoryBarriers", pImageMemoryBarriers);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginQuery(
@@ -1165,7 +1757,12 @@ void VulkanAsciiConsumer::Process_vkCmdBeginQuery(
     uint32_t                                    query,
     VkQueryControlFlags                         flags)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginQuery");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginQuery");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "query", query);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndQuery(
@@ -1173,7 +1770,11 @@ void VulkanAsciiConsumer::Process_vkCmdEndQuery(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndQuery");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndQuery");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "query", query);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResetQueryPool(
@@ -1182,7 +1783,12 @@ void VulkanAsciiConsumer::Process_vkCmdResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResetQueryPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdResetQueryPool");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "firstQuery", firstQuery);
+    FieldToJson(writer, "queryCount", queryCount);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteTimestamp(
@@ -1191,7 +1797,12 @@ void VulkanAsciiConsumer::Process_vkCmdWriteTimestamp(
     format::HandleId                            queryPool,
     uint32_t                                    query)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteTimestamp");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdWriteTimestamp");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pipelineStage", pipelineStage);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "query", query);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyQueryPoolResults(
@@ -1204,7 +1815,16 @@ void VulkanAsciiConsumer::Process_vkCmdCopyQueryPoolResults(
     VkDeviceSize                                stride,
     VkQueryResultFlags                          flags)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyQueryPoolResults");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyQueryPoolResults");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "firstQuery", firstQuery);
+    FieldToJson(writer, "queryCount", queryCount);
+    FieldToJson(writer, "dstBuffer", dstBuffer);
+    FieldToJson(writer, "dstOffset", dstOffset);
+    FieldToJson(writer, "stride", stride);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPushConstants(
@@ -1215,7 +1835,14 @@ void VulkanAsciiConsumer::Process_vkCmdPushConstants(
     uint32_t                                    size,
     PointerDecoder<uint8_t>*                    pValues)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPushConstants");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdPushConstants");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "layout", layout);
+    FieldToJson(writer, "stageFlags", stageFlags);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "size", size);
+    FieldToJson(writer, "pValues", pValues);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass(
@@ -1223,20 +1850,29 @@ void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     VkSubpassContents                           contents)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginRenderPass");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginRenderPass");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pRenderPassBegin", pRenderPassBegin);
+    FieldToJson(writer, "contents", contents);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdNextSubpass(
     format::HandleId                            commandBuffer,
     VkSubpassContents                           contents)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdNextSubpass");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdNextSubpass");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "contents", contents);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndRenderPass(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndRenderPass");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndRenderPass");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdExecuteCommands(
@@ -1244,7 +1880,11 @@ void VulkanAsciiConsumer::Process_vkCmdExecuteCommands(
     uint32_t                                    commandBufferCount,
     HandlePointerDecoder<VkCommandBuffer>*      pCommandBuffers)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdExecuteCommands");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdExecuteCommands");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "commandBufferCount", commandBufferCount);
+    FieldToJson(writer, "pCommandBuffers", pCommandBuffers);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkBindBufferMemory2(
@@ -1253,7 +1893,11 @@ void VulkanAsciiConsumer::Process_vkBindBufferMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindBufferMemory2");
+    util::JsonWriter& writer = WriteApiCallStart("vkBindBufferMemory2");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "bindInfoCount", bindInfoCount);
+    FieldToJson(writer, "pBindInfos", pBindInfos);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkBindImageMemory2(
@@ -1262,7 +1906,11 @@ void VulkanAsciiConsumer::Process_vkBindImageMemory2(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindImageMemory2");
+    util::JsonWriter& writer = WriteApiCallStart("vkBindImageMemory2");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "bindInfoCount", bindInfoCount);
+    FieldToJson(writer, "pBindInfos", pBindInfos);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
@@ -1272,14 +1920,23 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeatures(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupPeerMemoryFeatures");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceGroupPeerMemoryFeatures");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "heapIndex", heapIndex);
+    FieldToJson(writer, "localDeviceIndex", localDeviceIndex);
+    FieldToJson(writer, "remoteDeviceIndex", remoteDeviceIndex);
+    FieldToJson(writer, "pPeerMemoryFeatures", pPeerMemoryFeatures);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDeviceMask(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDeviceMask");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDeviceMask");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "deviceMask", deviceMask);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatchBase(
@@ -1291,7 +1948,15 @@ void VulkanAsciiConsumer::Process_vkCmdDispatchBase(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatchBase");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDispatchBase");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "baseGroupX", baseGroupX);
+    FieldToJson(writer, "baseGroupY", baseGroupY);
+    FieldToJson(writer, "baseGroupZ", baseGroupZ);
+    FieldToJson(writer, "groupCountX", groupCountX);
+    FieldToJson(writer, "groupCountY", groupCountY);
+    FieldToJson(writer, "groupCountZ", groupCountZ);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroups(
@@ -1300,7 +1965,11 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroups(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDeviceGroups");
+    util::JsonWriter& writer = WriteApiCallStart("vkEnumeratePhysicalDeviceGroups");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pPhysicalDeviceGroupCount", pPhysicalDeviceGroupCount);
+    FieldToJson(writer, "pPhysicalDeviceGroupProperties", pPhysicalDeviceGroupProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2(
@@ -1308,7 +1977,11 @@ void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageMemoryRequirements2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageMemoryRequirements2");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2(
@@ -1316,7 +1989,11 @@ void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferMemoryRequirements2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferMemoryRequirements2");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2(
@@ -1325,21 +2002,32 @@ void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSparseMemoryRequirements2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageSparseMemoryRequirements2");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pSparseMemoryRequirementCount", pSparseMemoryRequirementCount);
+    FieldToJson(writer, "pSparseMemoryRequirements", pSparseMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFeatures2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFeatures2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceFeatures2");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pFeatures", pFeatures);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceProperties2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceProperties2");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
@@ -1347,7 +2035,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFormatProperties2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceFormatProperties2");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "format", format);
+    FieldToJson(writer, "pFormatProperties", pFormatProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2(
@@ -1356,7 +2048,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2(
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceImageFormatProperties2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceImageFormatProperties2");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pImageFormatInfo", pImageFormatInfo);
+    FieldToJson(writer, "pImageFormatProperties", pImageFormatProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2(
@@ -1364,14 +2060,21 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyProperties2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceQueueFamilyProperties2");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pQueueFamilyPropertyCount", pQueueFamilyPropertyCount);
+    FieldToJson(writer, "pQueueFamilyProperties", pQueueFamilyProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMemoryProperties2(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMemoryProperties2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceMemoryProperties2");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pMemoryProperties", pMemoryProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2(
@@ -1380,7 +2083,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSparseImageFormatProperties2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSparseImageFormatProperties2");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pFormatInfo", pFormatInfo);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkTrimCommandPool(
@@ -1388,7 +2096,11 @@ void VulkanAsciiConsumer::Process_vkTrimCommandPool(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    fprintf(GetFile(), "%s\n", "vkTrimCommandPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkTrimCommandPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "commandPool", commandPool);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceQueue2(
@@ -1396,7 +2108,11 @@ void VulkanAsciiConsumer::Process_vkGetDeviceQueue2(
     StructPointerDecoder<Decoded_VkDeviceQueueInfo2>* pQueueInfo,
     HandlePointerDecoder<VkQueue>*              pQueue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceQueue2");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceQueue2");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pQueueInfo", pQueueInfo);
+    FieldToJson(writer, "pQueue", pQueue);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversion(
@@ -1406,7 +2122,12 @@ void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversion(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSamplerYcbcrConversion");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateSamplerYcbcrConversion");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pYcbcrConversion", pYcbcrConversion);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversion(
@@ -1414,7 +2135,11 @@ void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversion(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySamplerYcbcrConversion");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroySamplerYcbcrConversion");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "ycbcrConversion", ycbcrConversion);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplate(
@@ -1424,7 +2149,12 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplate(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorUpdateTemplate");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDescriptorUpdateTemplate");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pDescriptorUpdateTemplate", pDescriptorUpdateTemplate);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplate(
@@ -1432,7 +2162,11 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplate(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorUpdateTemplate");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDescriptorUpdateTemplate");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorUpdateTemplate", descriptorUpdateTemplate);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferProperties(
@@ -1440,7 +2174,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferProperties(
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalBufferProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceExternalBufferProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pExternalBufferInfo", pExternalBufferInfo);
+    FieldToJson(writer, "pExternalBufferProperties", pExternalBufferProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFenceProperties(
@@ -1448,7 +2186,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFenceProperties(
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalFenceProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceExternalFenceProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pExternalFenceInfo", pExternalFenceInfo);
+    FieldToJson(writer, "pExternalFenceProperties", pExternalFenceProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties(
@@ -1456,7 +2198,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalSemaphoreProperties");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceExternalSemaphoreProperties");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pExternalSemaphoreInfo", pExternalSemaphoreInfo);
+    FieldToJson(writer, "pExternalSemaphoreProperties", pExternalSemaphoreProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupport(
@@ -1464,7 +2210,11 @@ void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupport(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDescriptorSetLayoutSupport");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDescriptorSetLayoutSupport");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pSupport", pSupport);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCount(
@@ -1476,7 +2226,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectCount");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndirectCount");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "countBuffer", countBuffer);
+    FieldToJson(writer, "countBufferOffset", countBufferOffset);
+    FieldToJson(writer, "maxDrawCount", maxDrawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCount(
@@ -1488,7 +2246,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCount(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirectCount");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndexedIndirectCount");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "countBuffer", countBuffer);
+    FieldToJson(writer, "countBufferOffset", countBufferOffset);
+    FieldToJson(writer, "maxDrawCount", maxDrawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRenderPass2(
@@ -1498,7 +2264,12 @@ void VulkanAsciiConsumer::Process_vkCreateRenderPass2(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRenderPass2");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateRenderPass2");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pRenderPass", pRenderPass);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2(
@@ -1506,7 +2277,11 @@ void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginRenderPass2");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginRenderPass2");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pRenderPassBegin", pRenderPassBegin);
+    FieldToJson(writer, "pSubpassBeginInfo", pSubpassBeginInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdNextSubpass2(
@@ -1514,14 +2289,21 @@ void VulkanAsciiConsumer::Process_vkCmdNextSubpass2(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdNextSubpass2");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdNextSubpass2");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pSubpassBeginInfo", pSubpassBeginInfo);
+    FieldToJson(writer, "pSubpassEndInfo", pSubpassEndInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndRenderPass2(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndRenderPass2");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndRenderPass2");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pSubpassEndInfo", pSubpassEndInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkResetQueryPool(
@@ -1530,7 +2312,12 @@ void VulkanAsciiConsumer::Process_vkResetQueryPool(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    fprintf(GetFile(), "%s\n", "vkResetQueryPool");
+    util::JsonWriter& writer = WriteApiCallStart("vkResetQueryPool");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "firstQuery", firstQuery);
+    FieldToJson(writer, "queryCount", queryCount);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValue(
@@ -1539,7 +2326,11 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValue(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreCounterValue");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetSemaphoreCounterValue");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "semaphore", semaphore);
+    FieldToJson(writer, "pValue", pValue);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkWaitSemaphores(
@@ -1548,7 +2339,11 @@ void VulkanAsciiConsumer::Process_vkWaitSemaphores(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    fprintf(GetFile(), "%s\n", "vkWaitSemaphores");
+    util::JsonWriter& writer = WriteApiCallStart("vkWaitSemaphores");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pWaitInfo", pWaitInfo);
+    FieldToJson(writer, "timeout", timeout);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkSignalSemaphore(
@@ -1556,7 +2351,10 @@ void VulkanAsciiConsumer::Process_vkSignalSemaphore(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSignalSemaphore");
+    util::JsonWriter& writer = WriteApiCallStart("vkSignalSemaphore");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pSignalInfo", pSignalInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddress(
@@ -1564,7 +2362,10 @@ void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferDeviceAddress");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferDeviceAddress");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddress(
@@ -1572,7 +2373,10 @@ void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferOpaqueCaptureAddress");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferOpaqueCaptureAddress");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
@@ -1580,7 +2384,10 @@ void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddress(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceMemoryOpaqueCaptureAddress");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceMemoryOpaqueCaptureAddress");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySurfaceKHR(
@@ -1588,7 +2395,11 @@ void VulkanAsciiConsumer::Process_vkDestroySurfaceKHR(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySurfaceKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroySurfaceKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
@@ -1598,7 +2409,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceSupportKHR(
     format::HandleId                            surface,
     PointerDecoder<VkBool32>*                   pSupported)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceSupportKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfaceSupportKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pSupported", pSupported);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
@@ -1607,7 +2423,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilitiesKHR(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilitiesKHR>* pSurfaceCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfaceCapabilitiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pSurfaceCapabilities", pSurfaceCapabilities);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
@@ -1617,7 +2437,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormatsKHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormatKHR>* pSurfaceFormats)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceFormatsKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfaceFormatsKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pSurfaceFormatCount", pSurfaceFormatCount);
+    FieldToJson(writer, "pSurfaceFormats", pSurfaceFormats);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR(
@@ -1627,7 +2452,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModesKHR(
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfacePresentModesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfacePresentModesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pPresentModeCount", pPresentModeCount);
+    FieldToJson(writer, "pPresentModes", pPresentModes);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSwapchainKHR(
@@ -1637,7 +2467,12 @@ void VulkanAsciiConsumer::Process_vkCreateSwapchainKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSwapchainKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateSwapchainKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSwapchain", pSwapchain);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySwapchainKHR(
@@ -1645,7 +2480,11 @@ void VulkanAsciiConsumer::Process_vkDestroySwapchainKHR(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySwapchainKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroySwapchainKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetSwapchainImagesKHR(
@@ -1655,7 +2494,12 @@ void VulkanAsciiConsumer::Process_vkGetSwapchainImagesKHR(
     PointerDecoder<uint32_t>*                   pSwapchainImageCount,
     HandlePointerDecoder<VkImage>*              pSwapchainImages)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSwapchainImagesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetSwapchainImagesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    FieldToJson(writer, "pSwapchainImageCount", pSwapchainImageCount);
+    FieldToJson(writer, "pSwapchainImages", pSwapchainImages);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireNextImageKHR(
@@ -1667,7 +2511,14 @@ void VulkanAsciiConsumer::Process_vkAcquireNextImageKHR(
     format::HandleId                            fence,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireNextImageKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkAcquireNextImageKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    FieldToJson(writer, "timeout", timeout);
+    FieldToJson(writer, "semaphore", semaphore);
+    FieldToJson(writer, "fence", fence);
+    FieldToJson(writer, "pImageIndex", pImageIndex);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkQueuePresentKHR(
@@ -1675,7 +2526,10 @@ void VulkanAsciiConsumer::Process_vkQueuePresentKHR(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkPresentInfoKHR>* pPresentInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkQueuePresentKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueuePresentKHR");
+    FieldToJson(writer, "queue", queue);
+    FieldToJson(writer, "pPresentInfo", pPresentInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
@@ -1683,7 +2537,10 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupPresentCapabilitiesKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceGroupPresentCapabilitiesKHR>* pDeviceGroupPresentCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupPresentCapabilitiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceGroupPresentCapabilitiesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pDeviceGroupPresentCapabilities", pDeviceGroupPresentCapabilities);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
@@ -1692,7 +2549,11 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModesKHR(
     format::HandleId                            surface,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupSurfacePresentModesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceGroupSurfacePresentModesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pModes", pModes);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
@@ -1702,7 +2563,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDevicePresentRectanglesKHR(
     PointerDecoder<uint32_t>*                   pRectCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pRects)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDevicePresentRectanglesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDevicePresentRectanglesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pRectCount", pRectCount);
+    FieldToJson(writer, "pRects", pRects);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireNextImage2KHR(
@@ -1711,7 +2577,11 @@ void VulkanAsciiConsumer::Process_vkAcquireNextImage2KHR(
     StructPointerDecoder<Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
     PointerDecoder<uint32_t>*                   pImageIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireNextImage2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkAcquireNextImage2KHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pAcquireInfo", pAcquireInfo);
+    FieldToJson(writer, "pImageIndex", pImageIndex);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
@@ -1720,7 +2590,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayPropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceDisplayPropertiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
@@ -1729,7 +2603,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlanePropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlanePropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceDisplayPlanePropertiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
@@ -1739,7 +2617,12 @@ void VulkanAsciiConsumer::Process_vkGetDisplayPlaneSupportedDisplaysKHR(
     PointerDecoder<uint32_t>*                   pDisplayCount,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplays)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayPlaneSupportedDisplaysKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDisplayPlaneSupportedDisplaysKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "planeIndex", planeIndex);
+    FieldToJson(writer, "pDisplayCount", pDisplayCount);
+    FieldToJson(writer, "pDisplays", pDisplays);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayModePropertiesKHR(
@@ -1749,7 +2632,12 @@ void VulkanAsciiConsumer::Process_vkGetDisplayModePropertiesKHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModePropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayModePropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDisplayModePropertiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "display", display);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDisplayModeKHR(
@@ -1760,7 +2648,13 @@ void VulkanAsciiConsumer::Process_vkCreateDisplayModeKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDisplayModeKHR>*     pMode)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDisplayModeKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDisplayModeKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "display", display);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pMode", pMode);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
@@ -1770,7 +2664,12 @@ void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilitiesKHR(
     uint32_t                                    planeIndex,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilitiesKHR>* pCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayPlaneCapabilitiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDisplayPlaneCapabilitiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "mode", mode);
+    FieldToJson(writer, "planeIndex", planeIndex);
+    FieldToJson(writer, "pCapabilities", pCapabilities);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
@@ -1780,7 +2679,12 @@ void VulkanAsciiConsumer::Process_vkCreateDisplayPlaneSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDisplayPlaneSurfaceKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDisplayPlaneSurfaceKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSharedSwapchainsKHR(
@@ -1791,7 +2695,13 @@ void VulkanAsciiConsumer::Process_vkCreateSharedSwapchainsKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSharedSwapchainsKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateSharedSwapchainsKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchainCount", swapchainCount);
+    FieldToJson(writer, "pCreateInfos", pCreateInfos);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSwapchains", pSwapchains);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateXlibSurfaceKHR(
@@ -1801,7 +2711,12 @@ void VulkanAsciiConsumer::Process_vkCreateXlibSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateXlibSurfaceKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateXlibSurfaceKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(
@@ -1811,7 +2726,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXlibPresentationSupportKHR(
     uint64_t                                    dpy,
     size_t                                      visualID)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceXlibPresentationSupportKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceXlibPresentationSupportKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    FieldToJson(writer, "dpy", dpy);
+    FieldToJson(writer, "visualID", visualID);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateXcbSurfaceKHR(
@@ -1821,7 +2741,12 @@ void VulkanAsciiConsumer::Process_vkCreateXcbSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateXcbSurfaceKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateXcbSurfaceKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(
@@ -1831,7 +2756,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceXcbPresentationSupportKHR(
     uint64_t                                    connection,
     uint32_t                                    visual_id)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceXcbPresentationSupportKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceXcbPresentationSupportKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    FieldToJson(writer, "connection", connection);
+    FieldToJson(writer, "visual_id", visual_id);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateWaylandSurfaceKHR(
@@ -1841,7 +2771,12 @@ void VulkanAsciiConsumer::Process_vkCreateWaylandSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateWaylandSurfaceKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateWaylandSurfaceKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSupportKHR(
@@ -1850,7 +2785,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWaylandPresentationSupportK
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    display)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceWaylandPresentationSupportKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    FieldToJson(writer, "display", display);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateAndroidSurfaceKHR(
@@ -1860,7 +2799,12 @@ void VulkanAsciiConsumer::Process_vkCreateAndroidSurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateAndroidSurfaceKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateAndroidSurfaceKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateWin32SurfaceKHR(
@@ -1870,7 +2814,12 @@ void VulkanAsciiConsumer::Process_vkCreateWin32SurfaceKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateWin32SurfaceKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateWin32SurfaceKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWin32PresentationSupportKHR(
@@ -1878,21 +2827,30 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceWin32PresentationSupportKHR
     format::HandleId                            physicalDevice,
     uint32_t                                    queueFamilyIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceWin32PresentationSupportKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceWin32PresentationSupportKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFeatures2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFeatures2>* pFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFeatures2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceFeatures2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pFeatures", pFeatures);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
@@ -1900,7 +2858,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFormatProperties2KHR(
     VkFormat                                    format,
     StructPointerDecoder<Decoded_VkFormatProperties2>* pFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFormatProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceFormatProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "format", format);
+    FieldToJson(writer, "pFormatProperties", pFormatProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2KHR(
@@ -1909,7 +2871,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceImageFormatProperties2KHR(
     StructPointerDecoder<Decoded_VkPhysicalDeviceImageFormatInfo2>* pImageFormatInfo,
     StructPointerDecoder<Decoded_VkImageFormatProperties2>* pImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceImageFormatProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceImageFormatProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pImageFormatInfo", pImageFormatInfo);
+    FieldToJson(writer, "pImageFormatProperties", pImageFormatProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
@@ -1917,14 +2883,21 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyProperties2KHR(
     PointerDecoder<uint32_t>*                   pQueueFamilyPropertyCount,
     StructPointerDecoder<Decoded_VkQueueFamilyProperties2>* pQueueFamilyProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceQueueFamilyProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pQueueFamilyPropertyCount", pQueueFamilyPropertyCount);
+    FieldToJson(writer, "pQueueFamilyProperties", pQueueFamilyProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMemoryProperties2KHR(
     format::HandleId                            physicalDevice,
     StructPointerDecoder<Decoded_VkPhysicalDeviceMemoryProperties2>* pMemoryProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMemoryProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceMemoryProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pMemoryProperties", pMemoryProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties2KHR(
@@ -1933,7 +2906,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSparseImageFormatProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkSparseImageFormatProperties2>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSparseImageFormatProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pFormatInfo", pFormatInfo);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
@@ -1943,14 +2921,23 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupPeerMemoryFeaturesKHR(
     uint32_t                                    remoteDeviceIndex,
     PointerDecoder<VkPeerMemoryFeatureFlags>*   pPeerMemoryFeatures)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupPeerMemoryFeaturesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceGroupPeerMemoryFeaturesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "heapIndex", heapIndex);
+    FieldToJson(writer, "localDeviceIndex", localDeviceIndex);
+    FieldToJson(writer, "remoteDeviceIndex", remoteDeviceIndex);
+    FieldToJson(writer, "pPeerMemoryFeatures", pPeerMemoryFeatures);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDeviceMaskKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    deviceMask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDeviceMaskKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDeviceMaskKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "deviceMask", deviceMask);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDispatchBaseKHR(
@@ -1962,7 +2949,15 @@ void VulkanAsciiConsumer::Process_vkCmdDispatchBaseKHR(
     uint32_t                                    groupCountY,
     uint32_t                                    groupCountZ)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDispatchBaseKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDispatchBaseKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "baseGroupX", baseGroupX);
+    FieldToJson(writer, "baseGroupY", baseGroupY);
+    FieldToJson(writer, "baseGroupZ", baseGroupZ);
+    FieldToJson(writer, "groupCountX", groupCountX);
+    FieldToJson(writer, "groupCountY", groupCountY);
+    FieldToJson(writer, "groupCountZ", groupCountZ);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkTrimCommandPoolKHR(
@@ -1970,7 +2965,11 @@ void VulkanAsciiConsumer::Process_vkTrimCommandPoolKHR(
     format::HandleId                            commandPool,
     VkCommandPoolTrimFlags                      flags)
 {
-    fprintf(GetFile(), "%s\n", "vkTrimCommandPoolKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkTrimCommandPoolKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "commandPool", commandPool);
+    FieldToJson(writer, "flags", flags);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
@@ -1979,7 +2978,11 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceGroupsKHR(
     PointerDecoder<uint32_t>*                   pPhysicalDeviceGroupCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceGroupProperties>* pPhysicalDeviceGroupProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDeviceGroupsKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkEnumeratePhysicalDeviceGroupsKHR");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pPhysicalDeviceGroupCount", pPhysicalDeviceGroupCount);
+    FieldToJson(writer, "pPhysicalDeviceGroupProperties", pPhysicalDeviceGroupProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR(
@@ -1987,7 +2990,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalBufferPropertiesKHR
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalBufferInfo>* pExternalBufferInfo,
     StructPointerDecoder<Decoded_VkExternalBufferProperties>* pExternalBufferProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceExternalBufferPropertiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pExternalBufferInfo", pExternalBufferInfo);
+    FieldToJson(writer, "pExternalBufferProperties", pExternalBufferProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleKHR(
@@ -1996,7 +3003,11 @@ void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleKHR(
     StructPointerDecoder<Decoded_VkMemoryGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryWin32HandleKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetMemoryWin32HandleKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pGetWin32HandleInfo", pGetWin32HandleInfo);
+    FieldToJson(writer, "pHandle", pHandle);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
@@ -2006,7 +3017,12 @@ void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandlePropertiesKHR(
     uint64_t                                    handle,
     StructPointerDecoder<Decoded_VkMemoryWin32HandlePropertiesKHR>* pMemoryWin32HandleProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryWin32HandlePropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetMemoryWin32HandlePropertiesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "handleType", handleType);
+    FieldToJson(writer, "handle", handle);
+    FieldToJson(writer, "pMemoryWin32HandleProperties", pMemoryWin32HandleProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryFdKHR(
@@ -2015,7 +3031,11 @@ void VulkanAsciiConsumer::Process_vkGetMemoryFdKHR(
     StructPointerDecoder<Decoded_VkMemoryGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryFdKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetMemoryFdKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pGetFdInfo", pGetFdInfo);
+    FieldToJson(writer, "pFd", pFd);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryFdPropertiesKHR(
@@ -2025,7 +3045,12 @@ void VulkanAsciiConsumer::Process_vkGetMemoryFdPropertiesKHR(
     int                                         fd,
     StructPointerDecoder<Decoded_VkMemoryFdPropertiesKHR>* pMemoryFdProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryFdPropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetMemoryFdPropertiesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "handleType", handleType);
+    FieldToJson(writer, "fd", fd);
+    FieldToJson(writer, "pMemoryFdProperties", pMemoryFdProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphorePropertiesKHR(
@@ -2033,7 +3058,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalSemaphoreProperties
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalSemaphoreInfo>* pExternalSemaphoreInfo,
     StructPointerDecoder<Decoded_VkExternalSemaphoreProperties>* pExternalSemaphoreProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceExternalSemaphorePropertiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pExternalSemaphoreInfo", pExternalSemaphoreInfo);
+    FieldToJson(writer, "pExternalSemaphoreProperties", pExternalSemaphoreProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkImportSemaphoreWin32HandleKHR(
@@ -2041,7 +3070,10 @@ void VulkanAsciiConsumer::Process_vkImportSemaphoreWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreWin32HandleInfoKHR>* pImportSemaphoreWin32HandleInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportSemaphoreWin32HandleKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkImportSemaphoreWin32HandleKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pImportSemaphoreWin32HandleInfo", pImportSemaphoreWin32HandleInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreWin32HandleKHR(
@@ -2050,7 +3082,11 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreWin32HandleKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreWin32HandleKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetSemaphoreWin32HandleKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pGetWin32HandleInfo", pGetWin32HandleInfo);
+    FieldToJson(writer, "pHandle", pHandle);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkImportSemaphoreFdKHR(
@@ -2058,7 +3094,10 @@ void VulkanAsciiConsumer::Process_vkImportSemaphoreFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportSemaphoreFdInfoKHR>* pImportSemaphoreFdInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportSemaphoreFdKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkImportSemaphoreFdKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pImportSemaphoreFdInfo", pImportSemaphoreFdInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreFdKHR(
@@ -2067,7 +3106,11 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreFdKHR(
     StructPointerDecoder<Decoded_VkSemaphoreGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreFdKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetSemaphoreFdKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pGetFdInfo", pGetFdInfo);
+    FieldToJson(writer, "pFd", pFd);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPushDescriptorSetKHR(
@@ -2078,7 +3121,14 @@ void VulkanAsciiConsumer::Process_vkCmdPushDescriptorSetKHR(
     uint32_t                                    descriptorWriteCount,
     StructPointerDecoder<Decoded_VkWriteDescriptorSet>* pDescriptorWrites)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPushDescriptorSetKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdPushDescriptorSetKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pipelineBindPoint", pipelineBindPoint);
+    FieldToJson(writer, "layout", layout);
+    FieldToJson(writer, "set", set);
+    FieldToJson(writer, "descriptorWriteCount", descriptorWriteCount);
+    FieldToJson(writer, "pDescriptorWrites", pDescriptorWrites);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
@@ -2088,7 +3138,12 @@ void VulkanAsciiConsumer::Process_vkCreateDescriptorUpdateTemplateKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDescriptorUpdateTemplate>* pDescriptorUpdateTemplate)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDescriptorUpdateTemplateKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDescriptorUpdateTemplateKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pDescriptorUpdateTemplate", pDescriptorUpdateTemplate);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
@@ -2096,7 +3151,11 @@ void VulkanAsciiConsumer::Process_vkDestroyDescriptorUpdateTemplateKHR(
     format::HandleId                            descriptorUpdateTemplate,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDescriptorUpdateTemplateKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDescriptorUpdateTemplateKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "descriptorUpdateTemplate", descriptorUpdateTemplate);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRenderPass2KHR(
@@ -2106,7 +3165,12 @@ void VulkanAsciiConsumer::Process_vkCreateRenderPass2KHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkRenderPass>*         pRenderPass)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRenderPass2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateRenderPass2KHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pRenderPass", pRenderPass);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2KHR(
@@ -2114,7 +3178,11 @@ void VulkanAsciiConsumer::Process_vkCmdBeginRenderPass2KHR(
     StructPointerDecoder<Decoded_VkRenderPassBeginInfo>* pRenderPassBegin,
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginRenderPass2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginRenderPass2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pRenderPassBegin", pRenderPassBegin);
+    FieldToJson(writer, "pSubpassBeginInfo", pSubpassBeginInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdNextSubpass2KHR(
@@ -2122,14 +3190,21 @@ void VulkanAsciiConsumer::Process_vkCmdNextSubpass2KHR(
     StructPointerDecoder<Decoded_VkSubpassBeginInfo>* pSubpassBeginInfo,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdNextSubpass2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdNextSubpass2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pSubpassBeginInfo", pSubpassBeginInfo);
+    FieldToJson(writer, "pSubpassEndInfo", pSubpassEndInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndRenderPass2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSubpassEndInfo>* pSubpassEndInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndRenderPass2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndRenderPass2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pSubpassEndInfo", pSubpassEndInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetSwapchainStatusKHR(
@@ -2137,7 +3212,10 @@ void VulkanAsciiConsumer::Process_vkGetSwapchainStatusKHR(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSwapchainStatusKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetSwapchainStatusKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(
@@ -2145,7 +3223,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalFencePropertiesKHR(
     StructPointerDecoder<Decoded_VkPhysicalDeviceExternalFenceInfo>* pExternalFenceInfo,
     StructPointerDecoder<Decoded_VkExternalFenceProperties>* pExternalFenceProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalFencePropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceExternalFencePropertiesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pExternalFenceInfo", pExternalFenceInfo);
+    FieldToJson(writer, "pExternalFenceProperties", pExternalFenceProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkImportFenceWin32HandleKHR(
@@ -2153,7 +3235,10 @@ void VulkanAsciiConsumer::Process_vkImportFenceWin32HandleKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceWin32HandleInfoKHR>* pImportFenceWin32HandleInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportFenceWin32HandleKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkImportFenceWin32HandleKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pImportFenceWin32HandleInfo", pImportFenceWin32HandleInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetFenceWin32HandleKHR(
@@ -2162,7 +3247,11 @@ void VulkanAsciiConsumer::Process_vkGetFenceWin32HandleKHR(
     StructPointerDecoder<Decoded_VkFenceGetWin32HandleInfoKHR>* pGetWin32HandleInfo,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetFenceWin32HandleKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetFenceWin32HandleKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pGetWin32HandleInfo", pGetWin32HandleInfo);
+    FieldToJson(writer, "pHandle", pHandle);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkImportFenceFdKHR(
@@ -2170,7 +3259,10 @@ void VulkanAsciiConsumer::Process_vkImportFenceFdKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImportFenceFdInfoKHR>* pImportFenceFdInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkImportFenceFdKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkImportFenceFdKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pImportFenceFdInfo", pImportFenceFdInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetFenceFdKHR(
@@ -2179,7 +3271,11 @@ void VulkanAsciiConsumer::Process_vkGetFenceFdKHR(
     StructPointerDecoder<Decoded_VkFenceGetFdInfoKHR>* pGetFdInfo,
     PointerDecoder<int>*                        pFd)
 {
-    fprintf(GetFile(), "%s\n", "vkGetFenceFdKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetFenceFdKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pGetFdInfo", pGetFdInfo);
+    FieldToJson(writer, "pFd", pFd);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR(
@@ -2190,7 +3286,13 @@ void VulkanAsciiConsumer::Process_vkEnumeratePhysicalDeviceQueueFamilyPerformanc
     StructPointerDecoder<Decoded_VkPerformanceCounterKHR>* pCounters,
     StructPointerDecoder<Decoded_VkPerformanceCounterDescriptionKHR>* pCounterDescriptions)
 {
-    fprintf(GetFile(), "%s\n", "vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkEnumeratePhysicalDeviceQueueFamilyPerformanceQueryCountersKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    FieldToJson(writer, "pCounterCount", pCounterCount);
+    FieldToJson(writer, "pCounters", pCounters);
+    FieldToJson(writer, "pCounterDescriptions", pCounterDescriptions);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR(
@@ -2198,7 +3300,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceQueueFamilyPerformanceQuery
     StructPointerDecoder<Decoded_VkQueryPoolPerformanceCreateInfoKHR>* pPerformanceQueryCreateInfo,
     PointerDecoder<uint32_t>*                   pNumPasses)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceQueueFamilyPerformanceQueryPassesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pPerformanceQueryCreateInfo", pPerformanceQueryCreateInfo);
+    FieldToJson(writer, "pNumPasses", pNumPasses);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireProfilingLockKHR(
@@ -2206,13 +3312,18 @@ void VulkanAsciiConsumer::Process_vkAcquireProfilingLockKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAcquireProfilingLockInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireProfilingLockKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkAcquireProfilingLockKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkReleaseProfilingLockKHR(
     format::HandleId                            device)
 {
-    fprintf(GetFile(), "%s\n", "vkReleaseProfilingLockKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkReleaseProfilingLockKHR");
+    FieldToJson(writer, "device", device);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
@@ -2221,7 +3332,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2KHR(
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2KHR>* pSurfaceCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfaceCapabilities2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pSurfaceInfo", pSurfaceInfo);
+    FieldToJson(writer, "pSurfaceCapabilities", pSurfaceCapabilities);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
@@ -2231,7 +3346,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceFormats2KHR(
     PointerDecoder<uint32_t>*                   pSurfaceFormatCount,
     StructPointerDecoder<Decoded_VkSurfaceFormat2KHR>* pSurfaceFormats)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceFormats2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfaceFormats2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pSurfaceInfo", pSurfaceInfo);
+    FieldToJson(writer, "pSurfaceFormatCount", pSurfaceFormatCount);
+    FieldToJson(writer, "pSurfaceFormats", pSurfaceFormats);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
@@ -2240,7 +3360,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayProperties2KHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceDisplayProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
@@ -2249,7 +3373,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDisplayPlaneProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayPlaneProperties2KHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceDisplayPlaneProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayModeProperties2KHR(
@@ -2259,7 +3387,12 @@ void VulkanAsciiConsumer::Process_vkGetDisplayModeProperties2KHR(
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkDisplayModeProperties2KHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayModeProperties2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDisplayModeProperties2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "display", display);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
@@ -2268,7 +3401,11 @@ void VulkanAsciiConsumer::Process_vkGetDisplayPlaneCapabilities2KHR(
     StructPointerDecoder<Decoded_VkDisplayPlaneInfo2KHR>* pDisplayPlaneInfo,
     StructPointerDecoder<Decoded_VkDisplayPlaneCapabilities2KHR>* pCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDisplayPlaneCapabilities2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDisplayPlaneCapabilities2KHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pDisplayPlaneInfo", pDisplayPlaneInfo);
+    FieldToJson(writer, "pCapabilities", pCapabilities);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2KHR(
@@ -2276,7 +3413,11 @@ void VulkanAsciiConsumer::Process_vkGetImageMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkImageMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageMemoryRequirements2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageMemoryRequirements2KHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2KHR(
@@ -2284,7 +3425,11 @@ void VulkanAsciiConsumer::Process_vkGetBufferMemoryRequirements2KHR(
     StructPointerDecoder<Decoded_VkBufferMemoryRequirementsInfo2>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferMemoryRequirements2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferMemoryRequirements2KHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
@@ -2293,7 +3438,12 @@ void VulkanAsciiConsumer::Process_vkGetImageSparseMemoryRequirements2KHR(
     PointerDecoder<uint32_t>*                   pSparseMemoryRequirementCount,
     StructPointerDecoder<Decoded_VkSparseImageMemoryRequirements2>* pSparseMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageSparseMemoryRequirements2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageSparseMemoryRequirements2KHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pSparseMemoryRequirementCount", pSparseMemoryRequirementCount);
+    FieldToJson(writer, "pSparseMemoryRequirements", pSparseMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
@@ -2303,7 +3453,12 @@ void VulkanAsciiConsumer::Process_vkCreateSamplerYcbcrConversionKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSamplerYcbcrConversion>* pYcbcrConversion)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateSamplerYcbcrConversionKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateSamplerYcbcrConversionKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pYcbcrConversion", pYcbcrConversion);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
@@ -2311,7 +3466,11 @@ void VulkanAsciiConsumer::Process_vkDestroySamplerYcbcrConversionKHR(
     format::HandleId                            ycbcrConversion,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroySamplerYcbcrConversionKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroySamplerYcbcrConversionKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "ycbcrConversion", ycbcrConversion);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkBindBufferMemory2KHR(
@@ -2320,7 +3479,11 @@ void VulkanAsciiConsumer::Process_vkBindBufferMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindBufferMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindBufferMemory2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkBindBufferMemory2KHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "bindInfoCount", bindInfoCount);
+    FieldToJson(writer, "pBindInfos", pBindInfos);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkBindImageMemory2KHR(
@@ -2329,7 +3492,11 @@ void VulkanAsciiConsumer::Process_vkBindImageMemory2KHR(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindImageMemoryInfo>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindImageMemory2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkBindImageMemory2KHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "bindInfoCount", bindInfoCount);
+    FieldToJson(writer, "pBindInfos", pBindInfos);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
@@ -2337,7 +3504,11 @@ void VulkanAsciiConsumer::Process_vkGetDescriptorSetLayoutSupportKHR(
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutCreateInfo>* pCreateInfo,
     StructPointerDecoder<Decoded_VkDescriptorSetLayoutSupport>* pSupport)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDescriptorSetLayoutSupportKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDescriptorSetLayoutSupportKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pSupport", pSupport);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountKHR(
@@ -2349,7 +3520,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectCountKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndirectCountKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "countBuffer", countBuffer);
+    FieldToJson(writer, "countBufferOffset", countBufferOffset);
+    FieldToJson(writer, "maxDrawCount", maxDrawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
@@ -2361,7 +3540,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountKHR(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirectCountKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndexedIndirectCountKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "countBuffer", countBuffer);
+    FieldToJson(writer, "countBufferOffset", countBufferOffset);
+    FieldToJson(writer, "maxDrawCount", maxDrawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValueKHR(
@@ -2370,7 +3557,11 @@ void VulkanAsciiConsumer::Process_vkGetSemaphoreCounterValueKHR(
     format::HandleId                            semaphore,
     PointerDecoder<uint64_t>*                   pValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSemaphoreCounterValueKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetSemaphoreCounterValueKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "semaphore", semaphore);
+    FieldToJson(writer, "pValue", pValue);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkWaitSemaphoresKHR(
@@ -2379,7 +3570,11 @@ void VulkanAsciiConsumer::Process_vkWaitSemaphoresKHR(
     StructPointerDecoder<Decoded_VkSemaphoreWaitInfo>* pWaitInfo,
     uint64_t                                    timeout)
 {
-    fprintf(GetFile(), "%s\n", "vkWaitSemaphoresKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkWaitSemaphoresKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pWaitInfo", pWaitInfo);
+    FieldToJson(writer, "timeout", timeout);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkSignalSemaphoreKHR(
@@ -2387,7 +3582,10 @@ void VulkanAsciiConsumer::Process_vkSignalSemaphoreKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkSemaphoreSignalInfo>* pSignalInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSignalSemaphoreKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkSignalSemaphoreKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pSignalInfo", pSignalInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKHR(
@@ -2396,7 +3594,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceFragmentShadingRatesKHR(
     PointerDecoder<uint32_t>*                   pFragmentShadingRateCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceFragmentShadingRateKHR>* pFragmentShadingRates)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceFragmentShadingRatesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceFragmentShadingRatesKHR");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pFragmentShadingRateCount", pFragmentShadingRateCount);
+    FieldToJson(writer, "pFragmentShadingRates", pFragmentShadingRates);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateKHR(
@@ -2404,7 +3606,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateKHR(
     StructPointerDecoder<Decoded_VkExtent2D>*   pFragmentSize,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetFragmentShadingRateKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetFragmentShadingRateKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pFragmentSize", pFragmentSize);
+    FieldToJson(writer, "combinerOps", combinerOps);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressKHR(
@@ -2412,7 +3618,10 @@ void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferDeviceAddressKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferDeviceAddressKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
@@ -2420,7 +3629,10 @@ void VulkanAsciiConsumer::Process_vkGetBufferOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferOpaqueCaptureAddressKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferOpaqueCaptureAddressKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
@@ -2428,7 +3640,10 @@ void VulkanAsciiConsumer::Process_vkGetDeviceMemoryOpaqueCaptureAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceMemoryOpaqueCaptureAddressKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDeferredOperationKHR(
@@ -2437,7 +3652,11 @@ void VulkanAsciiConsumer::Process_vkCreateDeferredOperationKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDeferredOperationKHR>* pDeferredOperation)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDeferredOperationKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDeferredOperationKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pDeferredOperation", pDeferredOperation);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDeferredOperationKHR(
@@ -2445,7 +3664,11 @@ void VulkanAsciiConsumer::Process_vkDestroyDeferredOperationKHR(
     format::HandleId                            operation,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDeferredOperationKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDeferredOperationKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "operation", operation);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
@@ -2453,7 +3676,10 @@ void VulkanAsciiConsumer::Process_vkGetDeferredOperationMaxConcurrencyKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeferredOperationMaxConcurrencyKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeferredOperationMaxConcurrencyKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "operation", operation);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeferredOperationResultKHR(
@@ -2461,7 +3687,10 @@ void VulkanAsciiConsumer::Process_vkGetDeferredOperationResultKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeferredOperationResultKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeferredOperationResultKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "operation", operation);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDeferredOperationJoinKHR(
@@ -2469,7 +3698,10 @@ void VulkanAsciiConsumer::Process_vkDeferredOperationJoinKHR(
     format::HandleId                            device,
     format::HandleId                            operation)
 {
-    fprintf(GetFile(), "%s\n", "vkDeferredOperationJoinKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkDeferredOperationJoinKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "operation", operation);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
@@ -2479,7 +3711,12 @@ void VulkanAsciiConsumer::Process_vkGetPipelineExecutablePropertiesKHR(
     PointerDecoder<uint32_t>*                   pExecutableCount,
     StructPointerDecoder<Decoded_VkPipelineExecutablePropertiesKHR>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineExecutablePropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPipelineExecutablePropertiesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pPipelineInfo", pPipelineInfo);
+    FieldToJson(writer, "pExecutableCount", pExecutableCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
@@ -2489,7 +3726,12 @@ void VulkanAsciiConsumer::Process_vkGetPipelineExecutableStatisticsKHR(
     PointerDecoder<uint32_t>*                   pStatisticCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableStatisticKHR>* pStatistics)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineExecutableStatisticsKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPipelineExecutableStatisticsKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pExecutableInfo", pExecutableInfo);
+    FieldToJson(writer, "pStatisticCount", pStatisticCount);
+    FieldToJson(writer, "pStatistics", pStatistics);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPipelineExecutableInternalRepresentationsKHR(
@@ -2499,49 +3741,72 @@ void VulkanAsciiConsumer::Process_vkGetPipelineExecutableInternalRepresentations
     PointerDecoder<uint32_t>*                   pInternalRepresentationCount,
     StructPointerDecoder<Decoded_VkPipelineExecutableInternalRepresentationKHR>* pInternalRepresentations)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPipelineExecutableInternalRepresentationsKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPipelineExecutableInternalRepresentationsKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pExecutableInfo", pExecutableInfo);
+    FieldToJson(writer, "pInternalRepresentationCount", pInternalRepresentationCount);
+    FieldToJson(writer, "pInternalRepresentations", pInternalRepresentations);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferInfo2KHR>* pCopyBufferInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBuffer2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyBuffer2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pCopyBufferInfo", pCopyBufferInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageInfo2KHR>* pCopyImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImage2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyImage2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pCopyImageInfo", pCopyImageInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyBufferToImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyBufferToImageInfo2KHR>* pCopyBufferToImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyBufferToImage2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyBufferToImage2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pCopyBufferToImageInfo", pCopyBufferToImageInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyImageToBuffer2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyImageToBufferInfo2KHR>* pCopyImageToBufferInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyImageToBuffer2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyImageToBuffer2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pCopyImageToBufferInfo", pCopyImageToBufferInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBlitImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkBlitImageInfo2KHR>* pBlitImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBlitImage2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBlitImage2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pBlitImageInfo", pBlitImageInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdResolveImage2KHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkResolveImageInfo2KHR>* pResolveImageInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdResolveImage2KHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdResolveImage2KHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pResolveImageInfo", pResolveImageInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDebugReportCallbackEXT(
@@ -2551,7 +3816,12 @@ void VulkanAsciiConsumer::Process_vkCreateDebugReportCallbackEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugReportCallbackEXT>* pCallback)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDebugReportCallbackEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDebugReportCallbackEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pCallback", pCallback);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDebugReportCallbackEXT(
@@ -2559,7 +3829,11 @@ void VulkanAsciiConsumer::Process_vkDestroyDebugReportCallbackEXT(
     format::HandleId                            callback,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDebugReportCallbackEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDebugReportCallbackEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "callback", callback);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkDebugReportMessageEXT(
@@ -2572,7 +3846,16 @@ void VulkanAsciiConsumer::Process_vkDebugReportMessageEXT(
     StringDecoder*                              pLayerPrefix,
     StringDecoder*                              pMessage)
 {
-    fprintf(GetFile(), "%s\n", "vkDebugReportMessageEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDebugReportMessageEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "flags", flags);
+    FieldToJson(writer, "objectType", objectType);
+    FieldToJson(writer, "object", object);
+    FieldToJson(writer, "location", location);
+    FieldToJson(writer, "messageCode", messageCode);
+    FieldToJson(writer, "pLayerPrefix", pLayerPrefix);
+    FieldToJson(writer, "pMessage", pMessage);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectTagEXT(
@@ -2580,7 +3863,10 @@ void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectTagInfoEXT>* pTagInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkDebugMarkerSetObjectTagEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDebugMarkerSetObjectTagEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pTagInfo", pTagInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectNameEXT(
@@ -2588,27 +3874,38 @@ void VulkanAsciiConsumer::Process_vkDebugMarkerSetObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugMarkerObjectNameInfoEXT>* pNameInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkDebugMarkerSetObjectNameEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDebugMarkerSetObjectNameEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pNameInfo", pNameInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDebugMarkerBeginEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDebugMarkerBeginEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDebugMarkerBeginEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pMarkerInfo", pMarkerInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDebugMarkerEndEXT(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDebugMarkerEndEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDebugMarkerEndEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDebugMarkerInsertEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugMarkerMarkerInfoEXT>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDebugMarkerInsertEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDebugMarkerInsertEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pMarkerInfo", pMarkerInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
@@ -2619,7 +3916,14 @@ void VulkanAsciiConsumer::Process_vkCmdBindTransformFeedbackBuffersEXT(
     PointerDecoder<VkDeviceSize>*               pOffsets,
     PointerDecoder<VkDeviceSize>*               pSizes)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindTransformFeedbackBuffersEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindTransformFeedbackBuffersEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstBinding", firstBinding);
+    FieldToJson(writer, "bindingCount", bindingCount);
+    FieldToJson(writer, "pBuffers", pBuffers);
+    FieldToJson(writer, "pOffsets", pOffsets);
+    FieldToJson(writer, "pSizes", pSizes);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginTransformFeedbackEXT(
@@ -2629,7 +3933,13 @@ void VulkanAsciiConsumer::Process_vkCmdBeginTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginTransformFeedbackEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginTransformFeedbackEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstCounterBuffer", firstCounterBuffer);
+    FieldToJson(writer, "counterBufferCount", counterBufferCount);
+    FieldToJson(writer, "pCounterBuffers", pCounterBuffers);
+    FieldToJson(writer, "pCounterBufferOffsets", pCounterBufferOffsets);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndTransformFeedbackEXT(
@@ -2639,7 +3949,13 @@ void VulkanAsciiConsumer::Process_vkCmdEndTransformFeedbackEXT(
     HandlePointerDecoder<VkBuffer>*             pCounterBuffers,
     PointerDecoder<VkDeviceSize>*               pCounterBufferOffsets)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndTransformFeedbackEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndTransformFeedbackEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstCounterBuffer", firstCounterBuffer);
+    FieldToJson(writer, "counterBufferCount", counterBufferCount);
+    FieldToJson(writer, "pCounterBuffers", pCounterBuffers);
+    FieldToJson(writer, "pCounterBufferOffsets", pCounterBufferOffsets);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginQueryIndexedEXT(
@@ -2649,7 +3965,13 @@ void VulkanAsciiConsumer::Process_vkCmdBeginQueryIndexedEXT(
     VkQueryControlFlags                         flags,
     uint32_t                                    index)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginQueryIndexedEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginQueryIndexedEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "query", query);
+    FieldToJson(writer, "flags", flags);
+    FieldToJson(writer, "index", index);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndQueryIndexedEXT(
@@ -2658,7 +3980,12 @@ void VulkanAsciiConsumer::Process_vkCmdEndQueryIndexedEXT(
     uint32_t                                    query,
     uint32_t                                    index)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndQueryIndexedEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndQueryIndexedEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "query", query);
+    FieldToJson(writer, "index", index);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectByteCountEXT(
@@ -2670,7 +3997,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectByteCountEXT(
     uint32_t                                    counterOffset,
     uint32_t                                    vertexStride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectByteCountEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndirectByteCountEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "instanceCount", instanceCount);
+    FieldToJson(writer, "firstInstance", firstInstance);
+    FieldToJson(writer, "counterBuffer", counterBuffer);
+    FieldToJson(writer, "counterBufferOffset", counterBufferOffset);
+    FieldToJson(writer, "counterOffset", counterOffset);
+    FieldToJson(writer, "vertexStride", vertexStride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageViewHandleNVX(
@@ -2678,7 +4013,10 @@ void VulkanAsciiConsumer::Process_vkGetImageViewHandleNVX(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkImageViewHandleInfoNVX>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageViewHandleNVX");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageViewHandleNVX");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageViewAddressNVX(
@@ -2687,7 +4025,11 @@ void VulkanAsciiConsumer::Process_vkGetImageViewAddressNVX(
     format::HandleId                            imageView,
     StructPointerDecoder<Decoded_VkImageViewAddressPropertiesNVX>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageViewAddressNVX");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageViewAddressNVX");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "imageView", imageView);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountAMD(
@@ -2699,7 +4041,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndirectCountAMD");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndirectCountAMD");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "countBuffer", countBuffer);
+    FieldToJson(writer, "countBufferOffset", countBufferOffset);
+    FieldToJson(writer, "maxDrawCount", maxDrawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
@@ -2711,7 +4061,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawIndexedIndirectCountAMD(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawIndexedIndirectCountAMD");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawIndexedIndirectCountAMD");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "countBuffer", countBuffer);
+    FieldToJson(writer, "countBufferOffset", countBufferOffset);
+    FieldToJson(writer, "maxDrawCount", maxDrawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetShaderInfoAMD(
@@ -2723,7 +4081,14 @@ void VulkanAsciiConsumer::Process_vkGetShaderInfoAMD(
     PointerDecoder<size_t>*                     pInfoSize,
     PointerDecoder<uint8_t>*                    pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetShaderInfoAMD");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetShaderInfoAMD");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "shaderStage", shaderStage);
+    FieldToJson(writer, "infoType", infoType);
+    FieldToJson(writer, "pInfoSize", pInfoSize);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
@@ -2733,7 +4098,12 @@ void VulkanAsciiConsumer::Process_vkCreateStreamDescriptorSurfaceGGP(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateStreamDescriptorSurfaceGGP");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateStreamDescriptorSurfaceGGP");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalImageFormatPropertiesNV(
@@ -2747,7 +4117,16 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceExternalImageFormatProperti
     VkExternalMemoryHandleTypeFlagsNV           externalHandleType,
     StructPointerDecoder<Decoded_VkExternalImageFormatPropertiesNV>* pExternalImageFormatProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceExternalImageFormatPropertiesNV");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "format", format);
+    FieldToJson(writer, "type", type);
+    FieldToJson(writer, "tiling", tiling);
+    FieldToJson(writer, "usage", usage);
+    FieldToJson(writer, "flags", flags);
+    FieldToJson(writer, "externalHandleType", externalHandleType);
+    FieldToJson(writer, "pExternalImageFormatProperties", pExternalImageFormatProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleNV(
@@ -2757,7 +4136,12 @@ void VulkanAsciiConsumer::Process_vkGetMemoryWin32HandleNV(
     VkExternalMemoryHandleTypeFlagsNV           handleType,
     PointerDecoder<uint64_t, void*>*            pHandle)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryWin32HandleNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetMemoryWin32HandleNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "memory", memory);
+    FieldToJson(writer, "handleType", handleType);
+    FieldToJson(writer, "pHandle", pHandle);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateViSurfaceNN(
@@ -2767,20 +4151,30 @@ void VulkanAsciiConsumer::Process_vkCreateViSurfaceNN(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateViSurfaceNN");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateViSurfaceNN");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginConditionalRenderingEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkConditionalRenderingBeginInfoEXT>* pConditionalRenderingBegin)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginConditionalRenderingEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginConditionalRenderingEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pConditionalRenderingBegin", pConditionalRenderingBegin);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndConditionalRenderingEXT(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndConditionalRenderingEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndConditionalRenderingEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewportWScalingNV(
@@ -2789,7 +4183,12 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewportWScalingNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewportWScalingNV>* pViewportWScalings)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewportWScalingNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetViewportWScalingNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstViewport", firstViewport);
+    FieldToJson(writer, "viewportCount", viewportCount);
+    FieldToJson(writer, "pViewportWScalings", pViewportWScalings);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkReleaseDisplayEXT(
@@ -2797,7 +4196,10 @@ void VulkanAsciiConsumer::Process_vkReleaseDisplayEXT(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    fprintf(GetFile(), "%s\n", "vkReleaseDisplayEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkReleaseDisplayEXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "display", display);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireXlibDisplayEXT(
@@ -2806,7 +4208,11 @@ void VulkanAsciiConsumer::Process_vkAcquireXlibDisplayEXT(
     uint64_t                                    dpy,
     format::HandleId                            display)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireXlibDisplayEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkAcquireXlibDisplayEXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "dpy", dpy);
+    FieldToJson(writer, "display", display);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetRandROutputDisplayEXT(
@@ -2816,7 +4222,12 @@ void VulkanAsciiConsumer::Process_vkGetRandROutputDisplayEXT(
     size_t                                      rrOutput,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRandROutputDisplayEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetRandROutputDisplayEXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "dpy", dpy);
+    FieldToJson(writer, "rrOutput", rrOutput);
+    FieldToJson(writer, "pDisplay", pDisplay);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
@@ -2825,7 +4236,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfaceCapabilities2EXT(
     format::HandleId                            surface,
     StructPointerDecoder<Decoded_VkSurfaceCapabilities2EXT>* pSurfaceCapabilities)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfaceCapabilities2EXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "surface", surface);
+    FieldToJson(writer, "pSurfaceCapabilities", pSurfaceCapabilities);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDisplayPowerControlEXT(
@@ -2834,7 +4249,11 @@ void VulkanAsciiConsumer::Process_vkDisplayPowerControlEXT(
     format::HandleId                            display,
     StructPointerDecoder<Decoded_VkDisplayPowerInfoEXT>* pDisplayPowerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkDisplayPowerControlEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDisplayPowerControlEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "display", display);
+    FieldToJson(writer, "pDisplayPowerInfo", pDisplayPowerInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkRegisterDeviceEventEXT(
@@ -2844,7 +4263,12 @@ void VulkanAsciiConsumer::Process_vkRegisterDeviceEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    fprintf(GetFile(), "%s\n", "vkRegisterDeviceEventEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkRegisterDeviceEventEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pDeviceEventInfo", pDeviceEventInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pFence", pFence);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkRegisterDisplayEventEXT(
@@ -2855,7 +4279,13 @@ void VulkanAsciiConsumer::Process_vkRegisterDisplayEventEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkFence>*              pFence)
 {
-    fprintf(GetFile(), "%s\n", "vkRegisterDisplayEventEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkRegisterDisplayEventEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "display", display);
+    FieldToJson(writer, "pDisplayEventInfo", pDisplayEventInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pFence", pFence);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetSwapchainCounterEXT(
@@ -2865,7 +4295,12 @@ void VulkanAsciiConsumer::Process_vkGetSwapchainCounterEXT(
     VkSurfaceCounterFlagBitsEXT                 counter,
     PointerDecoder<uint64_t>*                   pCounterValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetSwapchainCounterEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetSwapchainCounterEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    FieldToJson(writer, "counter", counter);
+    FieldToJson(writer, "pCounterValue", pCounterValue);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
@@ -2874,7 +4309,11 @@ void VulkanAsciiConsumer::Process_vkGetRefreshCycleDurationGOOGLE(
     format::HandleId                            swapchain,
     StructPointerDecoder<Decoded_VkRefreshCycleDurationGOOGLE>* pDisplayTimingProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRefreshCycleDurationGOOGLE");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetRefreshCycleDurationGOOGLE");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    FieldToJson(writer, "pDisplayTimingProperties", pDisplayTimingProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPastPresentationTimingGOOGLE(
@@ -2884,7 +4323,12 @@ void VulkanAsciiConsumer::Process_vkGetPastPresentationTimingGOOGLE(
     PointerDecoder<uint32_t>*                   pPresentationTimingCount,
     StructPointerDecoder<Decoded_VkPastPresentationTimingGOOGLE>* pPresentationTimings)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPastPresentationTimingGOOGLE");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPastPresentationTimingGOOGLE");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    FieldToJson(writer, "pPresentationTimingCount", pPresentationTimingCount);
+    FieldToJson(writer, "pPresentationTimings", pPresentationTimings);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDiscardRectangleEXT(
@@ -2893,7 +4337,12 @@ void VulkanAsciiConsumer::Process_vkCmdSetDiscardRectangleEXT(
     uint32_t                                    discardRectangleCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pDiscardRectangles)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDiscardRectangleEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDiscardRectangleEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstDiscardRectangle", firstDiscardRectangle);
+    FieldToJson(writer, "discardRectangleCount", discardRectangleCount);
+    FieldToJson(writer, "pDiscardRectangles", pDiscardRectangles);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkSetHdrMetadataEXT(
@@ -2902,7 +4351,12 @@ void VulkanAsciiConsumer::Process_vkSetHdrMetadataEXT(
     HandlePointerDecoder<VkSwapchainKHR>*       pSwapchains,
     StructPointerDecoder<Decoded_VkHdrMetadataEXT>* pMetadata)
 {
-    fprintf(GetFile(), "%s\n", "vkSetHdrMetadataEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkSetHdrMetadataEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchainCount", swapchainCount);
+    FieldToJson(writer, "pSwapchains", pSwapchains);
+    FieldToJson(writer, "pMetadata", pMetadata);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateIOSSurfaceMVK(
@@ -2912,7 +4366,12 @@ void VulkanAsciiConsumer::Process_vkCreateIOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateIOSSurfaceMVK");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateIOSSurfaceMVK");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateMacOSSurfaceMVK(
@@ -2922,7 +4381,12 @@ void VulkanAsciiConsumer::Process_vkCreateMacOSSurfaceMVK(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateMacOSSurfaceMVK");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateMacOSSurfaceMVK");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectNameEXT(
@@ -2930,7 +4394,10 @@ void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectNameEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectNameInfoEXT>* pNameInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSetDebugUtilsObjectNameEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkSetDebugUtilsObjectNameEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pNameInfo", pNameInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectTagEXT(
@@ -2938,47 +4405,66 @@ void VulkanAsciiConsumer::Process_vkSetDebugUtilsObjectTagEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkDebugUtilsObjectTagInfoEXT>* pTagInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkSetDebugUtilsObjectTagEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkSetDebugUtilsObjectTagEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pTagInfo", pTagInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkQueueBeginDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueBeginDebugUtilsLabelEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueueBeginDebugUtilsLabelEXT");
+    FieldToJson(writer, "queue", queue);
+    FieldToJson(writer, "pLabelInfo", pLabelInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkQueueEndDebugUtilsLabelEXT(
     format::HandleId                            queue)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueEndDebugUtilsLabelEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueueEndDebugUtilsLabelEXT");
+    FieldToJson(writer, "queue", queue);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkQueueInsertDebugUtilsLabelEXT(
     format::HandleId                            queue,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueInsertDebugUtilsLabelEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueueInsertDebugUtilsLabelEXT");
+    FieldToJson(writer, "queue", queue);
+    FieldToJson(writer, "pLabelInfo", pLabelInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBeginDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBeginDebugUtilsLabelEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBeginDebugUtilsLabelEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pLabelInfo", pLabelInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdEndDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdEndDebugUtilsLabelEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdEndDebugUtilsLabelEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdInsertDebugUtilsLabelEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkDebugUtilsLabelEXT>* pLabelInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdInsertDebugUtilsLabelEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdInsertDebugUtilsLabelEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pLabelInfo", pLabelInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDebugUtilsMessengerEXT(
@@ -2988,7 +4474,12 @@ void VulkanAsciiConsumer::Process_vkCreateDebugUtilsMessengerEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkDebugUtilsMessengerEXT>* pMessenger)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDebugUtilsMessengerEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDebugUtilsMessengerEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pMessenger", pMessenger);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
@@ -2996,7 +4487,11 @@ void VulkanAsciiConsumer::Process_vkDestroyDebugUtilsMessengerEXT(
     format::HandleId                            messenger,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyDebugUtilsMessengerEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyDebugUtilsMessengerEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "messenger", messenger);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkSubmitDebugUtilsMessageEXT(
@@ -3005,7 +4500,12 @@ void VulkanAsciiConsumer::Process_vkSubmitDebugUtilsMessageEXT(
     VkDebugUtilsMessageTypeFlagsEXT             messageTypes,
     StructPointerDecoder<Decoded_VkDebugUtilsMessengerCallbackDataEXT>* pCallbackData)
 {
-    fprintf(GetFile(), "%s\n", "vkSubmitDebugUtilsMessageEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkSubmitDebugUtilsMessageEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "messageSeverity", messageSeverity);
+    FieldToJson(writer, "messageTypes", messageTypes);
+    FieldToJson(writer, "pCallbackData", pCallbackData);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDROID(
@@ -3014,7 +4514,11 @@ void VulkanAsciiConsumer::Process_vkGetAndroidHardwareBufferPropertiesANDROID(
     uint64_t                                    buffer,
     StructPointerDecoder<Decoded_VkAndroidHardwareBufferPropertiesANDROID>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAndroidHardwareBufferPropertiesANDROID");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetAndroidHardwareBufferPropertiesANDROID");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
@@ -3023,14 +4527,21 @@ void VulkanAsciiConsumer::Process_vkGetMemoryAndroidHardwareBufferANDROID(
     StructPointerDecoder<Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID>* pInfo,
     PointerDecoder<uint64_t, void*>*            pBuffer)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryAndroidHardwareBufferANDROID");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetMemoryAndroidHardwareBufferANDROID");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pBuffer", pBuffer);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetSampleLocationsEXT(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkSampleLocationsInfoEXT>* pSampleLocationsInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetSampleLocationsEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetSampleLocationsEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pSampleLocationsInfo", pSampleLocationsInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(
@@ -3038,7 +4549,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceMultisamplePropertiesEXT(
     VkSampleCountFlagBits                       samples,
     StructPointerDecoder<Decoded_VkMultisamplePropertiesEXT>* pMultisampleProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceMultisamplePropertiesEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceMultisamplePropertiesEXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "samples", samples);
+    FieldToJson(writer, "pMultisampleProperties", pMultisampleProperties);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
@@ -3047,7 +4562,11 @@ void VulkanAsciiConsumer::Process_vkGetImageDrmFormatModifierPropertiesEXT(
     format::HandleId                            image,
     StructPointerDecoder<Decoded_VkImageDrmFormatModifierPropertiesEXT>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetImageDrmFormatModifierPropertiesEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetImageDrmFormatModifierPropertiesEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "image", image);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateValidationCacheEXT(
@@ -3057,7 +4576,12 @@ void VulkanAsciiConsumer::Process_vkCreateValidationCacheEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkValidationCacheEXT>* pValidationCache)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateValidationCacheEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateValidationCacheEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pValidationCache", pValidationCache);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyValidationCacheEXT(
@@ -3065,7 +4589,11 @@ void VulkanAsciiConsumer::Process_vkDestroyValidationCacheEXT(
     format::HandleId                            validationCache,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyValidationCacheEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyValidationCacheEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "validationCache", validationCache);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkMergeValidationCachesEXT(
@@ -3075,7 +4603,12 @@ void VulkanAsciiConsumer::Process_vkMergeValidationCachesEXT(
     uint32_t                                    srcCacheCount,
     HandlePointerDecoder<VkValidationCacheEXT>* pSrcCaches)
 {
-    fprintf(GetFile(), "%s\n", "vkMergeValidationCachesEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkMergeValidationCachesEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "dstCache", dstCache);
+    FieldToJson(writer, "srcCacheCount", srcCacheCount);
+    FieldToJson(writer, "pSrcCaches", pSrcCaches);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetValidationCacheDataEXT(
@@ -3085,7 +4618,12 @@ void VulkanAsciiConsumer::Process_vkGetValidationCacheDataEXT(
     PointerDecoder<size_t>*                     pDataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetValidationCacheDataEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetValidationCacheDataEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "validationCache", validationCache);
+    FieldToJson(writer, "pDataSize", pDataSize);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindShadingRateImageNV(
@@ -3093,7 +4631,11 @@ void VulkanAsciiConsumer::Process_vkCmdBindShadingRateImageNV(
     format::HandleId                            imageView,
     VkImageLayout                               imageLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindShadingRateImageNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindShadingRateImageNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "imageView", imageView);
+    FieldToJson(writer, "imageLayout", imageLayout);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
@@ -3102,7 +4644,12 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewportShadingRatePaletteNV(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkShadingRatePaletteNV>* pShadingRatePalettes)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewportShadingRatePaletteNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetViewportShadingRatePaletteNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstViewport", firstViewport);
+    FieldToJson(writer, "viewportCount", viewportCount);
+    FieldToJson(writer, "pShadingRatePalettes", pShadingRatePalettes);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetCoarseSampleOrderNV(
@@ -3111,7 +4658,12 @@ void VulkanAsciiConsumer::Process_vkCmdSetCoarseSampleOrderNV(
     uint32_t                                    customSampleOrderCount,
     StructPointerDecoder<Decoded_VkCoarseSampleOrderCustomNV>* pCustomSampleOrders)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetCoarseSampleOrderNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetCoarseSampleOrderNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "sampleOrderType", sampleOrderType);
+    FieldToJson(writer, "customSampleOrderCount", customSampleOrderCount);
+    FieldToJson(writer, "pCustomSampleOrders", pCustomSampleOrders);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureNV(
@@ -3121,7 +4673,12 @@ void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureNV>* pAccelerationStructure)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateAccelerationStructureNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateAccelerationStructureNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pAccelerationStructure", pAccelerationStructure);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureNV(
@@ -3129,7 +4686,11 @@ void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureNV(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyAccelerationStructureNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyAccelerationStructureNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "accelerationStructure", accelerationStructure);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureMemoryRequirementsNV(
@@ -3137,7 +4698,11 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureMemoryRequirementsNV
     StructPointerDecoder<Decoded_VkAccelerationStructureMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2KHR>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureMemoryRequirementsNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetAccelerationStructureMemoryRequirementsNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkBindAccelerationStructureMemoryNV(
@@ -3146,7 +4711,11 @@ void VulkanAsciiConsumer::Process_vkBindAccelerationStructureMemoryNV(
     uint32_t                                    bindInfoCount,
     StructPointerDecoder<Decoded_VkBindAccelerationStructureMemoryInfoNV>* pBindInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkBindAccelerationStructureMemoryNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkBindAccelerationStructureMemoryNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "bindInfoCount", bindInfoCount);
+    FieldToJson(writer, "pBindInfos", pBindInfos);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructureNV(
@@ -3160,7 +4729,17 @@ void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructureNV(
     format::HandleId                            scratch,
     VkDeviceSize                                scratchOffset)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBuildAccelerationStructureNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBuildAccelerationStructureNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "instanceData", instanceData);
+    FieldToJson(writer, "instanceOffset", instanceOffset);
+    FieldToJson(writer, "update", update);
+    FieldToJson(writer, "dst", dst);
+    FieldToJson(writer, "src", src);
+    FieldToJson(writer, "scratch", scratch);
+    FieldToJson(writer, "scratchOffset", scratchOffset);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureNV(
@@ -3169,7 +4748,12 @@ void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureNV(
     format::HandleId                            src,
     VkCopyAccelerationStructureModeKHR          mode)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyAccelerationStructureNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyAccelerationStructureNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "dst", dst);
+    FieldToJson(writer, "src", src);
+    FieldToJson(writer, "mode", mode);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdTraceRaysNV(
@@ -3189,7 +4773,23 @@ void VulkanAsciiConsumer::Process_vkCmdTraceRaysNV(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdTraceRaysNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdTraceRaysNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "raygenShaderBindingTableBuffer", raygenShaderBindingTableBuffer);
+    FieldToJson(writer, "raygenShaderBindingOffset", raygenShaderBindingOffset);
+    FieldToJson(writer, "missShaderBindingTableBuffer", missShaderBindingTableBuffer);
+    FieldToJson(writer, "missShaderBindingOffset", missShaderBindingOffset);
+    FieldToJson(writer, "missShaderBindingStride", missShaderBindingStride);
+    FieldToJson(writer, "hitShaderBindingTableBuffer", hitShaderBindingTableBuffer);
+    FieldToJson(writer, "hitShaderBindingOffset", hitShaderBindingOffset);
+    FieldToJson(writer, "hitShaderBindingStride", hitShaderBindingStride);
+    FieldToJson(writer, "callableShaderBindingTableBuffer", callableShaderBindingTableBuffer);
+    FieldToJson(writer, "callableShaderBindingOffset", callableShaderBindingOffset);
+    FieldToJson(writer, "callableShaderBindingStride", callableShaderBindingStride);
+    FieldToJson(writer, "width", width);
+    FieldToJson(writer, "height", height);
+    FieldToJson(writer, "depth", depth);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesNV(
@@ -3201,7 +4801,14 @@ void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRayTracingPipelinesNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateRayTracingPipelinesNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipelineCache", pipelineCache);
+    FieldToJson(writer, "createInfoCount", createInfoCount);
+    FieldToJson(writer, "pCreateInfos", pCreateInfos);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pPipelines", pPipelines);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
@@ -3213,7 +4820,14 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesKHR(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingShaderGroupHandlesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetRayTracingShaderGroupHandlesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "firstGroup", firstGroup);
+    FieldToJson(writer, "groupCount", groupCount);
+    FieldToJson(writer, "dataSize", dataSize);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
@@ -3225,7 +4839,14 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupHandlesNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingShaderGroupHandlesNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetRayTracingShaderGroupHandlesNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "firstGroup", firstGroup);
+    FieldToJson(writer, "groupCount", groupCount);
+    FieldToJson(writer, "dataSize", dataSize);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureHandleNV(
@@ -3235,7 +4856,12 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureHandleNV(
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureHandleNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetAccelerationStructureHandleNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "accelerationStructure", accelerationStructure);
+    FieldToJson(writer, "dataSize", dataSize);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesNV(
@@ -3246,7 +4872,14 @@ void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesNV(
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteAccelerationStructuresPropertiesNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdWriteAccelerationStructuresPropertiesNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "accelerationStructureCount", accelerationStructureCount);
+    FieldToJson(writer, "pAccelerationStructures", pAccelerationStructures);
+    FieldToJson(writer, "queryType", queryType);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "firstQuery", firstQuery);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCompileDeferredNV(
@@ -3255,7 +4888,11 @@ void VulkanAsciiConsumer::Process_vkCompileDeferredNV(
     format::HandleId                            pipeline,
     uint32_t                                    shader)
 {
-    fprintf(GetFile(), "%s\n", "vkCompileDeferredNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCompileDeferredNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "shader", shader);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
@@ -3265,7 +4902,12 @@ void VulkanAsciiConsumer::Process_vkGetMemoryHostPointerPropertiesEXT(
     uint64_t                                    pHostPointer,
     StructPointerDecoder<Decoded_VkMemoryHostPointerPropertiesEXT>* pMemoryHostPointerProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetMemoryHostPointerPropertiesEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetMemoryHostPointerPropertiesEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "handleType", handleType);
+    FieldToJson(writer, "pHostPointer", pHostPointer);
+    FieldToJson(writer, "pMemoryHostPointerProperties", pMemoryHostPointerProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteBufferMarkerAMD(
@@ -3275,7 +4917,13 @@ void VulkanAsciiConsumer::Process_vkCmdWriteBufferMarkerAMD(
     VkDeviceSize                                dstOffset,
     uint32_t                                    marker)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteBufferMarkerAMD");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdWriteBufferMarkerAMD");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pipelineStage", pipelineStage);
+    FieldToJson(writer, "dstBuffer", dstBuffer);
+    FieldToJson(writer, "dstOffset", dstOffset);
+    FieldToJson(writer, "marker", marker);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT(
@@ -3284,7 +4932,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCalibrateableTimeDomainsEXT
     PointerDecoder<uint32_t>*                   pTimeDomainCount,
     PointerDecoder<VkTimeDomainEXT>*            pTimeDomains)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceCalibrateableTimeDomainsEXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pTimeDomainCount", pTimeDomainCount);
+    FieldToJson(writer, "pTimeDomains", pTimeDomains);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetCalibratedTimestampsEXT(
@@ -3295,7 +4947,13 @@ void VulkanAsciiConsumer::Process_vkGetCalibratedTimestampsEXT(
     PointerDecoder<uint64_t>*                   pTimestamps,
     PointerDecoder<uint64_t>*                   pMaxDeviation)
 {
-    fprintf(GetFile(), "%s\n", "vkGetCalibratedTimestampsEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetCalibratedTimestampsEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "timestampCount", timestampCount);
+    FieldToJson(writer, "pTimestampInfos", pTimestampInfos);
+    FieldToJson(writer, "pTimestamps", pTimestamps);
+    FieldToJson(writer, "pMaxDeviation", pMaxDeviation);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksNV(
@@ -3303,7 +4961,11 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksNV(
     uint32_t                                    taskCount,
     uint32_t                                    firstTask)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMeshTasksNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawMeshTasksNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "taskCount", taskCount);
+    FieldToJson(writer, "firstTask", firstTask);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
@@ -3313,7 +4975,13 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectNV(
     uint32_t                                    drawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMeshTasksIndirectNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawMeshTasksIndirectNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "drawCount", drawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
@@ -3325,7 +4993,15 @@ void VulkanAsciiConsumer::Process_vkCmdDrawMeshTasksIndirectCountNV(
     uint32_t                                    maxDrawCount,
     uint32_t                                    stride)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdDrawMeshTasksIndirectCountNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdDrawMeshTasksIndirectCountNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "buffer", buffer);
+    FieldToJson(writer, "offset", offset);
+    FieldToJson(writer, "countBuffer", countBuffer);
+    FieldToJson(writer, "countBufferOffset", countBufferOffset);
+    FieldToJson(writer, "maxDrawCount", maxDrawCount);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetExclusiveScissorNV(
@@ -3334,14 +5010,22 @@ void VulkanAsciiConsumer::Process_vkCmdSetExclusiveScissorNV(
     uint32_t                                    exclusiveScissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pExclusiveScissors)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetExclusiveScissorNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetExclusiveScissorNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstExclusiveScissor", firstExclusiveScissor);
+    FieldToJson(writer, "exclusiveScissorCount", exclusiveScissorCount);
+    FieldToJson(writer, "pExclusiveScissors", pExclusiveScissors);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetCheckpointNV(
     format::HandleId                            commandBuffer,
     uint64_t                                    pCheckpointMarker)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetCheckpointNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetCheckpointNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pCheckpointMarker", pCheckpointMarker);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetQueueCheckpointDataNV(
@@ -3349,7 +5033,11 @@ void VulkanAsciiConsumer::Process_vkGetQueueCheckpointDataNV(
     PointerDecoder<uint32_t>*                   pCheckpointDataCount,
     StructPointerDecoder<Decoded_VkCheckpointDataNV>* pCheckpointData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetQueueCheckpointDataNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetQueueCheckpointDataNV");
+    FieldToJson(writer, "queue", queue);
+    FieldToJson(writer, "pCheckpointDataCount", pCheckpointDataCount);
+    FieldToJson(writer, "pCheckpointData", pCheckpointData);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkInitializePerformanceApiINTEL(
@@ -3357,13 +5045,18 @@ void VulkanAsciiConsumer::Process_vkInitializePerformanceApiINTEL(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkInitializePerformanceApiInfoINTEL>* pInitializeInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkInitializePerformanceApiINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkInitializePerformanceApiINTEL");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInitializeInfo", pInitializeInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkUninitializePerformanceApiINTEL(
     format::HandleId                            device)
 {
-    fprintf(GetFile(), "%s\n", "vkUninitializePerformanceApiINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkUninitializePerformanceApiINTEL");
+    FieldToJson(writer, "device", device);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
@@ -3371,7 +5064,10 @@ void VulkanAsciiConsumer::Process_vkCmdSetPerformanceMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceMarkerInfoINTEL>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPerformanceMarkerINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetPerformanceMarkerINTEL");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pMarkerInfo", pMarkerInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
@@ -3379,7 +5075,10 @@ void VulkanAsciiConsumer::Process_vkCmdSetPerformanceStreamMarkerINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceStreamMarkerInfoINTEL>* pMarkerInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPerformanceStreamMarkerINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetPerformanceStreamMarkerINTEL");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pMarkerInfo", pMarkerInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
@@ -3387,7 +5086,10 @@ void VulkanAsciiConsumer::Process_vkCmdSetPerformanceOverrideINTEL(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkPerformanceOverrideInfoINTEL>* pOverrideInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPerformanceOverrideINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetPerformanceOverrideINTEL");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pOverrideInfo", pOverrideInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
@@ -3396,7 +5098,11 @@ void VulkanAsciiConsumer::Process_vkAcquirePerformanceConfigurationINTEL(
     StructPointerDecoder<Decoded_VkPerformanceConfigurationAcquireInfoINTEL>* pAcquireInfo,
     HandlePointerDecoder<VkPerformanceConfigurationINTEL>* pConfiguration)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquirePerformanceConfigurationINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkAcquirePerformanceConfigurationINTEL");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pAcquireInfo", pAcquireInfo);
+    FieldToJson(writer, "pConfiguration", pConfiguration);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkReleasePerformanceConfigurationINTEL(
@@ -3404,7 +5110,10 @@ void VulkanAsciiConsumer::Process_vkReleasePerformanceConfigurationINTEL(
     format::HandleId                            device,
     format::HandleId                            configuration)
 {
-    fprintf(GetFile(), "%s\n", "vkReleasePerformanceConfigurationINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkReleasePerformanceConfigurationINTEL");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "configuration", configuration);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
@@ -3412,7 +5121,10 @@ void VulkanAsciiConsumer::Process_vkQueueSetPerformanceConfigurationINTEL(
     format::HandleId                            queue,
     format::HandleId                            configuration)
 {
-    fprintf(GetFile(), "%s\n", "vkQueueSetPerformanceConfigurationINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkQueueSetPerformanceConfigurationINTEL");
+    FieldToJson(writer, "queue", queue);
+    FieldToJson(writer, "configuration", configuration);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPerformanceParameterINTEL(
@@ -3421,7 +5133,11 @@ void VulkanAsciiConsumer::Process_vkGetPerformanceParameterINTEL(
     VkPerformanceParameterTypeINTEL             parameter,
     StructPointerDecoder<Decoded_VkPerformanceValueINTEL>* pValue)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPerformanceParameterINTEL");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPerformanceParameterINTEL");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "parameter", parameter);
+    FieldToJson(writer, "pValue", pValue);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkSetLocalDimmingAMD(
@@ -3429,7 +5145,11 @@ void VulkanAsciiConsumer::Process_vkSetLocalDimmingAMD(
     format::HandleId                            swapChain,
     VkBool32                                    localDimmingEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkSetLocalDimmingAMD");
+    util::JsonWriter& writer = WriteApiCallStart("vkSetLocalDimmingAMD");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapChain", swapChain);
+    FieldToJson(writer, "localDimmingEnable", localDimmingEnable);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
@@ -3439,7 +5159,12 @@ void VulkanAsciiConsumer::Process_vkCreateImagePipeSurfaceFUCHSIA(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateImagePipeSurfaceFUCHSIA");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateImagePipeSurfaceFUCHSIA");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateMetalSurfaceEXT(
@@ -3449,7 +5174,12 @@ void VulkanAsciiConsumer::Process_vkCreateMetalSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateMetalSurfaceEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateMetalSurfaceEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressEXT(
@@ -3457,7 +5187,10 @@ void VulkanAsciiConsumer::Process_vkGetBufferDeviceAddressEXT(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkBufferDeviceAddressInfo>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetBufferDeviceAddressEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetBufferDeviceAddressEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
@@ -3466,7 +5199,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceToolPropertiesEXT(
     PointerDecoder<uint32_t>*                   pToolCount,
     StructPointerDecoder<Decoded_VkPhysicalDeviceToolPropertiesEXT>* pToolProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceToolPropertiesEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceToolPropertiesEXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pToolCount", pToolCount);
+    FieldToJson(writer, "pToolProperties", pToolProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixPropertiesNV(
@@ -3475,7 +5212,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceCooperativeMatrixProperties
     PointerDecoder<uint32_t>*                   pPropertyCount,
     StructPointerDecoder<Decoded_VkCooperativeMatrixPropertiesNV>* pProperties)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceCooperativeMatrixPropertiesNV");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pPropertyCount", pPropertyCount);
+    FieldToJson(writer, "pProperties", pProperties);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV(
@@ -3484,7 +5225,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSupportedFramebufferMixedSa
     PointerDecoder<uint32_t>*                   pCombinationCount,
     StructPointerDecoder<Decoded_VkFramebufferMixedSamplesCombinationNV>* pCombinations)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSupportedFramebufferMixedSamplesCombinationsNV");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pCombinationCount", pCombinationCount);
+    FieldToJson(writer, "pCombinations", pCombinations);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(
@@ -3494,7 +5239,12 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceSurfacePresentModes2EXT(
     PointerDecoder<uint32_t>*                   pPresentModeCount,
     PointerDecoder<VkPresentModeKHR>*           pPresentModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceSurfacePresentModes2EXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceSurfacePresentModes2EXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "pSurfaceInfo", pSurfaceInfo);
+    FieldToJson(writer, "pPresentModeCount", pPresentModeCount);
+    FieldToJson(writer, "pPresentModes", pPresentModes);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
@@ -3502,7 +5252,10 @@ void VulkanAsciiConsumer::Process_vkAcquireFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireFullScreenExclusiveModeEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkAcquireFullScreenExclusiveModeEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
@@ -3510,7 +5263,10 @@ void VulkanAsciiConsumer::Process_vkReleaseFullScreenExclusiveModeEXT(
     format::HandleId                            device,
     format::HandleId                            swapchain)
 {
-    fprintf(GetFile(), "%s\n", "vkReleaseFullScreenExclusiveModeEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkReleaseFullScreenExclusiveModeEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "swapchain", swapchain);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
@@ -3519,7 +5275,11 @@ void VulkanAsciiConsumer::Process_vkGetDeviceGroupSurfacePresentModes2EXT(
     StructPointerDecoder<Decoded_VkPhysicalDeviceSurfaceInfo2KHR>* pSurfaceInfo,
     PointerDecoder<VkDeviceGroupPresentModeFlagsKHR>* pModes)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceGroupSurfacePresentModes2EXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceGroupSurfacePresentModes2EXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pSurfaceInfo", pSurfaceInfo);
+    FieldToJson(writer, "pModes", pModes);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateHeadlessSurfaceEXT(
@@ -3529,7 +5289,12 @@ void VulkanAsciiConsumer::Process_vkCreateHeadlessSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateHeadlessSurfaceEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateHeadlessSurfaceEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetLineStippleEXT(
@@ -3537,7 +5302,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetLineStippleEXT(
     uint32_t                                    lineStippleFactor,
     uint16_t                                    lineStipplePattern)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetLineStippleEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetLineStippleEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "lineStippleFactor", lineStippleFactor);
+    FieldToJson(writer, "lineStipplePattern", lineStipplePattern);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkResetQueryPoolEXT(
@@ -3546,28 +5315,42 @@ void VulkanAsciiConsumer::Process_vkResetQueryPoolEXT(
     uint32_t                                    firstQuery,
     uint32_t                                    queryCount)
 {
-    fprintf(GetFile(), "%s\n", "vkResetQueryPoolEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkResetQueryPoolEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "firstQuery", firstQuery);
+    FieldToJson(writer, "queryCount", queryCount);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetCullModeEXT(
     format::HandleId                            commandBuffer,
     VkCullModeFlags                             cullMode)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetCullModeEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetCullModeEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "cullMode", cullMode);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetFrontFaceEXT(
     format::HandleId                            commandBuffer,
     VkFrontFace                                 frontFace)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetFrontFaceEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetFrontFaceEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "frontFace", frontFace);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetPrimitiveTopologyEXT(
     format::HandleId                            commandBuffer,
     VkPrimitiveTopology                         primitiveTopology)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetPrimitiveTopologyEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetPrimitiveTopologyEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "primitiveTopology", primitiveTopology);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetViewportWithCountEXT(
@@ -3575,7 +5358,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetViewportWithCountEXT(
     uint32_t                                    viewportCount,
     StructPointerDecoder<Decoded_VkViewport>*   pViewports)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetViewportWithCountEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetViewportWithCountEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "viewportCount", viewportCount);
+    FieldToJson(writer, "pViewports", pViewports);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetScissorWithCountEXT(
@@ -3583,7 +5370,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetScissorWithCountEXT(
     uint32_t                                    scissorCount,
     StructPointerDecoder<Decoded_VkRect2D>*     pScissors)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetScissorWithCountEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetScissorWithCountEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "scissorCount", scissorCount);
+    FieldToJson(writer, "pScissors", pScissors);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers2EXT(
@@ -3595,42 +5386,65 @@ void VulkanAsciiConsumer::Process_vkCmdBindVertexBuffers2EXT(
     PointerDecoder<VkDeviceSize>*               pSizes,
     PointerDecoder<VkDeviceSize>*               pStrides)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindVertexBuffers2EXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindVertexBuffers2EXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "firstBinding", firstBinding);
+    FieldToJson(writer, "bindingCount", bindingCount);
+    FieldToJson(writer, "pBuffers", pBuffers);
+    FieldToJson(writer, "pOffsets", pOffsets);
+    FieldToJson(writer, "pSizes", pSizes);
+    FieldToJson(writer, "pStrides", pStrides);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthTestEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthTestEnableEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDepthTestEnableEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "depthTestEnable", depthTestEnable);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthWriteEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthWriteEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthWriteEnableEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDepthWriteEnableEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "depthWriteEnable", depthWriteEnable);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthCompareOpEXT(
     format::HandleId                            commandBuffer,
     VkCompareOp                                 depthCompareOp)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthCompareOpEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDepthCompareOpEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "depthCompareOp", depthCompareOp);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetDepthBoundsTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    depthBoundsTestEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetDepthBoundsTestEnableEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetDepthBoundsTestEnableEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "depthBoundsTestEnable", depthBoundsTestEnable);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilTestEnableEXT(
     format::HandleId                            commandBuffer,
     VkBool32                                    stencilTestEnable)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilTestEnableEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetStencilTestEnableEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "stencilTestEnable", stencilTestEnable);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetStencilOpEXT(
@@ -3641,7 +5455,14 @@ void VulkanAsciiConsumer::Process_vkCmdSetStencilOpEXT(
     VkStencilOp                                 depthFailOp,
     VkCompareOp                                 compareOp)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetStencilOpEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetStencilOpEXT");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "faceMask", faceMask);
+    FieldToJson(writer, "failOp", failOp);
+    FieldToJson(writer, "passOp", passOp);
+    FieldToJson(writer, "depthFailOp", depthFailOp);
+    FieldToJson(writer, "compareOp", compareOp);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsNV(
@@ -3649,14 +5470,21 @@ void VulkanAsciiConsumer::Process_vkGetGeneratedCommandsMemoryRequirementsNV(
     StructPointerDecoder<Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV>* pInfo,
     StructPointerDecoder<Decoded_VkMemoryRequirements2>* pMemoryRequirements)
 {
-    fprintf(GetFile(), "%s\n", "vkGetGeneratedCommandsMemoryRequirementsNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetGeneratedCommandsMemoryRequirementsNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    FieldToJson(writer, "pMemoryRequirements", pMemoryRequirements);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdPreprocessGeneratedCommandsNV(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdPreprocessGeneratedCommandsNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdPreprocessGeneratedCommandsNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pGeneratedCommandsInfo", pGeneratedCommandsInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
@@ -3664,7 +5492,11 @@ void VulkanAsciiConsumer::Process_vkCmdExecuteGeneratedCommandsNV(
     VkBool32                                    isPreprocessed,
     StructPointerDecoder<Decoded_VkGeneratedCommandsInfoNV>* pGeneratedCommandsInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdExecuteGeneratedCommandsNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdExecuteGeneratedCommandsNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "isPreprocessed", isPreprocessed);
+    FieldToJson(writer, "pGeneratedCommandsInfo", pGeneratedCommandsInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBindPipelineShaderGroupNV(
@@ -3673,7 +5505,12 @@ void VulkanAsciiConsumer::Process_vkCmdBindPipelineShaderGroupNV(
     format::HandleId                            pipeline,
     uint32_t                                    groupIndex)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBindPipelineShaderGroupNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBindPipelineShaderGroupNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pipelineBindPoint", pipelineBindPoint);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "groupIndex", groupIndex);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateIndirectCommandsLayoutNV(
@@ -3683,7 +5520,12 @@ void VulkanAsciiConsumer::Process_vkCreateIndirectCommandsLayoutNV(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkIndirectCommandsLayoutNV>* pIndirectCommandsLayout)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateIndirectCommandsLayoutNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateIndirectCommandsLayoutNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pIndirectCommandsLayout", pIndirectCommandsLayout);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
@@ -3691,7 +5533,11 @@ void VulkanAsciiConsumer::Process_vkDestroyIndirectCommandsLayoutNV(
     format::HandleId                            indirectCommandsLayout,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyIndirectCommandsLayoutNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyIndirectCommandsLayoutNV");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "indirectCommandsLayout", indirectCommandsLayout);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreatePrivateDataSlotEXT(
@@ -3701,7 +5547,12 @@ void VulkanAsciiConsumer::Process_vkCreatePrivateDataSlotEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPrivateDataSlotEXT>* pPrivateDataSlot)
 {
-    fprintf(GetFile(), "%s\n", "vkCreatePrivateDataSlotEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreatePrivateDataSlotEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pPrivateDataSlot", pPrivateDataSlot);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyPrivateDataSlotEXT(
@@ -3709,7 +5560,11 @@ void VulkanAsciiConsumer::Process_vkDestroyPrivateDataSlotEXT(
     format::HandleId                            privateDataSlot,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyPrivateDataSlotEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyPrivateDataSlotEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "privateDataSlot", privateDataSlot);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkSetPrivateDataEXT(
@@ -3720,7 +5575,13 @@ void VulkanAsciiConsumer::Process_vkSetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     uint64_t                                    data)
 {
-    fprintf(GetFile(), "%s\n", "vkSetPrivateDataEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkSetPrivateDataEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "objectType", objectType);
+    FieldToJson(writer, "objectHandle", objectHandle);
+    FieldToJson(writer, "privateDataSlot", privateDataSlot);
+    FieldToJson(writer, "data", data);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPrivateDataEXT(
@@ -3730,7 +5591,13 @@ void VulkanAsciiConsumer::Process_vkGetPrivateDataEXT(
     format::HandleId                            privateDataSlot,
     PointerDecoder<uint64_t>*                   pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPrivateDataEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPrivateDataEXT");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "objectType", objectType);
+    FieldToJson(writer, "objectHandle", objectHandle);
+    FieldToJson(writer, "privateDataSlot", privateDataSlot);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
@@ -3738,7 +5605,11 @@ void VulkanAsciiConsumer::Process_vkCmdSetFragmentShadingRateEnumNV(
     VkFragmentShadingRateNV                     shadingRate,
     PointerDecoder<VkFragmentShadingRateCombinerOpKHR>* combinerOps)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetFragmentShadingRateEnumNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetFragmentShadingRateEnumNV");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "shadingRate", shadingRate);
+    FieldToJson(writer, "combinerOps", combinerOps);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkAcquireWinrtDisplayNV(
@@ -3746,7 +5617,10 @@ void VulkanAsciiConsumer::Process_vkAcquireWinrtDisplayNV(
     format::HandleId                            physicalDevice,
     format::HandleId                            display)
 {
-    fprintf(GetFile(), "%s\n", "vkAcquireWinrtDisplayNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkAcquireWinrtDisplayNV");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "display", display);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetWinrtDisplayNV(
@@ -3755,7 +5629,11 @@ void VulkanAsciiConsumer::Process_vkGetWinrtDisplayNV(
     uint32_t                                    deviceRelativeId,
     HandlePointerDecoder<VkDisplayKHR>*         pDisplay)
 {
-    fprintf(GetFile(), "%s\n", "vkGetWinrtDisplayNV");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetWinrtDisplayNV");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "deviceRelativeId", deviceRelativeId);
+    FieldToJson(writer, "pDisplay", pDisplay);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateDirectFBSurfaceEXT(
@@ -3765,7 +5643,12 @@ void VulkanAsciiConsumer::Process_vkCreateDirectFBSurfaceEXT(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkSurfaceKHR>*         pSurface)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateDirectFBSurfaceEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateDirectFBSurfaceEXT");
+    FieldToJson(writer, "instance", instance);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pSurface", pSurface);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSupportEXT(
@@ -3774,7 +5657,11 @@ void VulkanAsciiConsumer::Process_vkGetPhysicalDeviceDirectFBPresentationSupport
     uint32_t                                    queueFamilyIndex,
     uint64_t                                    dfb)
 {
-    fprintf(GetFile(), "%s\n", "vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetPhysicalDeviceDirectFBPresentationSupportEXT");
+    FieldToJson(writer, "physicalDevice", physicalDevice);
+    FieldToJson(writer, "queueFamilyIndex", queueFamilyIndex);
+    FieldToJson(writer, "dfb", dfb);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureKHR(
@@ -3784,7 +5671,12 @@ void VulkanAsciiConsumer::Process_vkCreateAccelerationStructureKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkAccelerationStructureKHR>* pAccelerationStructure)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateAccelerationStructureKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateAccelerationStructureKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pCreateInfo", pCreateInfo);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pAccelerationStructure", pAccelerationStructure);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureKHR(
@@ -3792,7 +5684,11 @@ void VulkanAsciiConsumer::Process_vkDestroyAccelerationStructureKHR(
     format::HandleId                            accelerationStructure,
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator)
 {
-    fprintf(GetFile(), "%s\n", "vkDestroyAccelerationStructureKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkDestroyAccelerationStructureKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "accelerationStructure", accelerationStructure);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
@@ -3801,7 +5697,12 @@ void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresKHR(
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildGeometryInfoKHR>* pInfos,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildRangeInfoKHR*>* ppBuildRangeInfos)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBuildAccelerationStructuresKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBuildAccelerationStructuresKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "infoCount", infoCount);
+    FieldToJson(writer, "pInfos", pInfos);
+    FieldToJson(writer, "ppBuildRangeInfos", ppBuildRangeInfos);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresIndirectKHR(
@@ -3812,7 +5713,14 @@ void VulkanAsciiConsumer::Process_vkCmdBuildAccelerationStructuresIndirectKHR(
     PointerDecoder<uint32_t>*                   pIndirectStrides,
     PointerDecoder<uint32_t*>*                  ppMaxPrimitiveCounts)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdBuildAccelerationStructuresIndirectKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdBuildAccelerationStructuresIndirectKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "infoCount", infoCount);
+    FieldToJson(writer, "pInfos", pInfos);
+    FieldToJson(writer, "pIndirectDeviceAddresses", pIndirectDeviceAddresses);
+    FieldToJson(writer, "pIndirectStrides", pIndirectStrides);
+    FieldToJson(writer, "ppMaxPrimitiveCounts", ppMaxPrimitiveCounts);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
@@ -3821,7 +5729,11 @@ void VulkanAsciiConsumer::Process_vkCopyAccelerationStructureToMemoryKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCopyAccelerationStructureToMemoryKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCopyAccelerationStructureToMemoryKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "deferredOperation", deferredOperation);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
@@ -3830,7 +5742,11 @@ void VulkanAsciiConsumer::Process_vkCopyMemoryToAccelerationStructureKHR(
     format::HandleId                            deferredOperation,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCopyMemoryToAccelerationStructureKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCopyMemoryToAccelerationStructureKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "deferredOperation", deferredOperation);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkWriteAccelerationStructuresPropertiesKHR(
@@ -3843,28 +5759,45 @@ void VulkanAsciiConsumer::Process_vkWriteAccelerationStructuresPropertiesKHR(
     PointerDecoder<uint8_t>*                    pData,
     size_t                                      stride)
 {
-    fprintf(GetFile(), "%s\n", "vkWriteAccelerationStructuresPropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkWriteAccelerationStructuresPropertiesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "accelerationStructureCount", accelerationStructureCount);
+    FieldToJson(writer, "pAccelerationStructures", pAccelerationStructures);
+    FieldToJson(writer, "queryType", queryType);
+    FieldToJson(writer, "dataSize", dataSize);
+    FieldToJson(writer, "pData", pData);
+    FieldToJson(writer, "stride", stride);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyAccelerationStructureKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyAccelerationStructureKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyAccelerationStructureToMemoryKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyAccelerationStructureToMemoryInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyAccelerationStructureToMemoryKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyAccelerationStructureToMemoryKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdCopyMemoryToAccelerationStructureKHR(
     format::HandleId                            commandBuffer,
     StructPointerDecoder<Decoded_VkCopyMemoryToAccelerationStructureInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdCopyMemoryToAccelerationStructureKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdCopyMemoryToAccelerationStructureKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureDeviceAddressKHR(
@@ -3872,7 +5805,10 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureDeviceAddressKHR(
     format::HandleId                            device,
     StructPointerDecoder<Decoded_VkAccelerationStructureDeviceAddressInfoKHR>* pInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureDeviceAddressKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetAccelerationStructureDeviceAddressKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pInfo", pInfo);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesKHR(
@@ -3883,7 +5819,14 @@ void VulkanAsciiConsumer::Process_vkCmdWriteAccelerationStructuresPropertiesKHR(
     format::HandleId                            queryPool,
     uint32_t                                    firstQuery)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdWriteAccelerationStructuresPropertiesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdWriteAccelerationStructuresPropertiesKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "accelerationStructureCount", accelerationStructureCount);
+    FieldToJson(writer, "pAccelerationStructures", pAccelerationStructures);
+    FieldToJson(writer, "queryType", queryType);
+    FieldToJson(writer, "queryPool", queryPool);
+    FieldToJson(writer, "firstQuery", firstQuery);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetDeviceAccelerationStructureCompatibilityKHR(
@@ -3891,7 +5834,11 @@ void VulkanAsciiConsumer::Process_vkGetDeviceAccelerationStructureCompatibilityK
     StructPointerDecoder<Decoded_VkAccelerationStructureVersionInfoKHR>* pVersionInfo,
     PointerDecoder<VkAccelerationStructureCompatibilityKHR>* pCompatibility)
 {
-    fprintf(GetFile(), "%s\n", "vkGetDeviceAccelerationStructureCompatibilityKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetDeviceAccelerationStructureCompatibilityKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pVersionInfo", pVersionInfo);
+    FieldToJson(writer, "pCompatibility", pCompatibility);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
@@ -3901,7 +5848,13 @@ void VulkanAsciiConsumer::Process_vkGetAccelerationStructureBuildSizesKHR(
     PointerDecoder<uint32_t>*                   pMaxPrimitiveCounts,
     StructPointerDecoder<Decoded_VkAccelerationStructureBuildSizesInfoKHR>* pSizeInfo)
 {
-    fprintf(GetFile(), "%s\n", "vkGetAccelerationStructureBuildSizesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetAccelerationStructureBuildSizesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "buildType", buildType);
+    FieldToJson(writer, "pBuildInfo", pBuildInfo);
+    FieldToJson(writer, "pMaxPrimitiveCounts", pMaxPrimitiveCounts);
+    FieldToJson(writer, "pSizeInfo", pSizeInfo);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCmdTraceRaysKHR(
@@ -3914,7 +5867,16 @@ void VulkanAsciiConsumer::Process_vkCmdTraceRaysKHR(
     uint32_t                                    height,
     uint32_t                                    depth)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdTraceRaysKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdTraceRaysKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pRaygenShaderBindingTable", pRaygenShaderBindingTable);
+    FieldToJson(writer, "pMissShaderBindingTable", pMissShaderBindingTable);
+    FieldToJson(writer, "pHitShaderBindingTable", pHitShaderBindingTable);
+    FieldToJson(writer, "pCallableShaderBindingTable", pCallableShaderBindingTable);
+    FieldToJson(writer, "width", width);
+    FieldToJson(writer, "height", height);
+    FieldToJson(writer, "depth", depth);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesKHR(
@@ -3927,7 +5889,15 @@ void VulkanAsciiConsumer::Process_vkCreateRayTracingPipelinesKHR(
     StructPointerDecoder<Decoded_VkAllocationCallbacks>* pAllocator,
     HandlePointerDecoder<VkPipeline>*           pPipelines)
 {
-    fprintf(GetFile(), "%s\n", "vkCreateRayTracingPipelinesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCreateRayTracingPipelinesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "deferredOperation", deferredOperation);
+    FieldToJson(writer, "pipelineCache", pipelineCache);
+    FieldToJson(writer, "createInfoCount", createInfoCount);
+    FieldToJson(writer, "pCreateInfos", pCreateInfos);
+    FieldToJson(writer, "pAllocator", pAllocator);
+    FieldToJson(writer, "pPipelines", pPipelines);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHandlesKHR(
@@ -3939,7 +5909,14 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingCaptureReplayShaderGroupHandles
     size_t                                      dataSize,
     PointerDecoder<uint8_t>*                    pData)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetRayTracingCaptureReplayShaderGroupHandlesKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "firstGroup", firstGroup);
+    FieldToJson(writer, "groupCount", groupCount);
+    FieldToJson(writer, "dataSize", dataSize);
+    FieldToJson(writer, "pData", pData);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdTraceRaysIndirectKHR(
@@ -3950,7 +5927,14 @@ void VulkanAsciiConsumer::Process_vkCmdTraceRaysIndirectKHR(
     StructPointerDecoder<Decoded_VkStridedDeviceAddressRegionKHR>* pCallableShaderBindingTable,
     VkDeviceAddress                             indirectDeviceAddress)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdTraceRaysIndirectKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdTraceRaysIndirectKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pRaygenShaderBindingTable", pRaygenShaderBindingTable);
+    FieldToJson(writer, "pMissShaderBindingTable", pMissShaderBindingTable);
+    FieldToJson(writer, "pHitShaderBindingTable", pHitShaderBindingTable);
+    FieldToJson(writer, "pCallableShaderBindingTable", pCallableShaderBindingTable);
+    FieldToJson(writer, "indirectDeviceAddress", indirectDeviceAddress);
+    WriteApiCallEnd();
 }
 
 void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
@@ -3960,14 +5944,22 @@ void VulkanAsciiConsumer::Process_vkGetRayTracingShaderGroupStackSizeKHR(
     uint32_t                                    group,
     VkShaderGroupShaderKHR                      groupShader)
 {
-    fprintf(GetFile(), "%s\n", "vkGetRayTracingShaderGroupStackSizeKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkGetRayTracingShaderGroupStackSizeKHR");
+    FieldToJson(writer, "device", device);
+    FieldToJson(writer, "pipeline", pipeline);
+    FieldToJson(writer, "group", group);
+    FieldToJson(writer, "groupShader", groupShader);
+    WriteApiCallEnd(returnValue);
 }
 
 void VulkanAsciiConsumer::Process_vkCmdSetRayTracingPipelineStackSizeKHR(
     format::HandleId                            commandBuffer,
     uint32_t                                    pipelineStackSize)
 {
-    fprintf(GetFile(), "%s\n", "vkCmdSetRayTracingPipelineStackSizeKHR");
+    util::JsonWriter& writer = WriteApiCallStart("vkCmdSetRayTracingPipelineStackSizeKHR");
+    FieldToJson(writer, "commandBuffer", commandBuffer);
+    FieldToJson(writer, "pipelineStackSize", pipelineStackSize);
+    WriteApiCallEnd();
 }
 
 GFXRECON_END_NAMESPACE(decode)
@@ -29,6 +29,7 @@
 #include "generated/generated_vulkan_struct_encoders.h"
 
 #include "encode/custom_vulkan_struct_encoders.h"
+#include "encode/parameter_encoded_size.h"
 #include "encode/parameter_encoder.h"
 #include "encode/struct_pointer_encoder.h"
 #include "util/defines.h"
@@ -44,6 +45,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExtent2D& value)
     encoder->EncodeUInt32Value(value.height);
 }
 
+size_t ComputeEncodedSize(const VkExtent2D& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExtent3D& value)
 {
     encoder->EncodeUInt32Value(value.width);
@@ -51,12 +63,35 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExtent3D& value)
     encoder->EncodeUInt32Value(value.depth);
 }
 
+size_t ComputeEncodedSize(const VkExtent3D& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkOffset2D& value)
 {
     encoder->EncodeInt32Value(value.x);
     encoder->EncodeInt32Value(value.y);
 }
 
+size_t ComputeEncodedSize(const VkOffset2D& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::Int32Value();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkOffset3D& value)
 {
     encoder->EncodeInt32Value(value.x);
@@ -64,12 +99,33 @@ void EncodeStruct(ParameterEncoder* encoder, const VkOffset3D& value)
     encoder->EncodeInt32Value(value.z);
 }
 
+size_t ComputeEncodedSize(const VkOffset3D& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::Int32Value();
+    size += ParameterEncodedSize::Int32Value();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRect2D& value)
 {
     EncodeStruct(encoder, value.offset);
     EncodeStruct(encoder, value.extent);
 }
 
+size_t ComputeEncodedSize(const VkRect2D& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.offset);
+    size += ComputeEncodedSize(value.extent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferMemoryBarrier& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -83,6 +139,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferMemoryBarrier& value)
     encoder->EncodeVkDeviceSizeValue(value.size);
 }
 
+size_t ComputeEncodedSize(const VkBufferMemoryBarrier& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDispatchIndirectCommand& value)
 {
     encoder->EncodeUInt32Value(value.x);
@@ -90,6 +162,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDispatchIndirectCommand& va
     encoder->EncodeUInt32Value(value.z);
 }
 
+size_t ComputeEncodedSize(const VkDispatchIndirectCommand& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawIndexedIndirectCommand& value)
 {
     encoder->EncodeUInt32Value(value.indexCount);
@@ -99,6 +183,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDrawIndexedIndirectCommand&
     encoder->EncodeUInt32Value(value.firstInstance);
 }
 
+size_t ComputeEncodedSize(const VkDrawIndexedIndirectCommand& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::Int32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawIndirectCommand& value)
 {
     encoder->EncodeUInt32Value(value.vertexCount);
@@ -107,6 +205,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDrawIndirectCommand& value)
     encoder->EncodeUInt32Value(value.firstInstance);
 }
 
+size_t ComputeEncodedSize(const VkDrawIndirectCommand& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresourceRange& value)
 {
     encoder->EncodeFlagsValue(value.aspectMask);
@@ -116,6 +227,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresourceRange& valu
     encoder->EncodeUInt32Value(value.layerCount);
 }
 
+size_t ComputeEncodedSize(const VkImageSubresourceRange& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageMemoryBarrier& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -130,6 +255,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageMemoryBarrier& value)
     EncodeStruct(encoder, value.subresourceRange);
 }
 
+size_t ComputeEncodedSize(const VkImageMemoryBarrier& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ComputeEncodedSize(value.subresourceRange);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryBarrier& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -138,6 +280,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryBarrier& value)
     encoder->EncodeFlagsValue(value.dstAccessMask);
 }
 
+size_t ComputeEncodedSize(const VkMemoryBarrier& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAllocationCallbacks& value)
 {
     encoder->EncodeVoidPtr(value.pUserData);
@@ -148,6 +301,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAllocationCallbacks& value)
     encoder->EncodeFunctionPtr(value.pfnInternalFree);
 }
 
+size_t ComputeEncodedSize(const VkAllocationCallbacks& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::FunctionPtr();
+    size += ParameterEncodedSize::FunctionPtr();
+    size += ParameterEncodedSize::FunctionPtr();
+    size += ParameterEncodedSize::FunctionPtr();
+    size += ParameterEncodedSize::FunctionPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkApplicationInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -159,6 +327,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkApplicationInfo& value)
     encoder->EncodeUInt32Value(value.apiVersion);
 }
 
+size_t ComputeEncodedSize(const VkApplicationInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::String(value.pApplicationName);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::String(value.pEngineName);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFormatProperties& value)
 {
     encoder->EncodeFlagsValue(value.linearTilingFeatures);
@@ -166,6 +348,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFormatProperties& value)
     encoder->EncodeFlagsValue(value.bufferFeatures);
 }
 
+size_t ComputeEncodedSize(const VkFormatProperties& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageFormatProperties& value)
 {
     EncodeStruct(encoder, value.maxExtent);
@@ -175,6 +369,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageFormatProperties& valu
     encoder->EncodeVkDeviceSizeValue(value.maxResourceSize);
 }
 
+size_t ComputeEncodedSize(const VkImageFormatProperties& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.maxExtent);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkInstanceCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -187,18 +393,55 @@ void EncodeStruct(ParameterEncoder* encoder, const VkInstanceCreateInfo& value)
     encoder->EncodeStringArray(value.ppEnabledExtensionNames, value.enabledExtensionCount);
 }
 
+size_t ComputeEncodedSize(const VkInstanceCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeStructPtrEncodedSize(value.pApplicationInfo);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::StringArray(value.ppEnabledLayerNames, value.enabledLayerCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::StringArray(value.ppEnabledExtensionNames, value.enabledExtensionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryHeap& value)
 {
     encoder->EncodeVkDeviceSizeValue(value.size);
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkMemoryHeap& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryType& value)
 {
     encoder->EncodeFlagsValue(value.propertyFlags);
     encoder->EncodeUInt32Value(value.heapIndex);
 }
 
+size_t ComputeEncodedSize(const VkMemoryType& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFeatures& value)
 {
     encoder->EncodeVkBool32Value(value.robustBufferAccess);
@@ -258,6 +501,70 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFeatures& val
     encoder->EncodeVkBool32Value(value.inheritedQueries);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFeatures& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLimits& value)
 {
     encoder->EncodeUInt32Value(value.maxImageDimension1D);
@@ -368,6 +675,119 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLimits& value
     encoder->EncodeVkDeviceSizeValue(value.nonCoherentAtomSize);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceLimits& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.maxComputeWorkGroupCount, 3);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.maxComputeWorkGroupSize, 3);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.maxViewportDimensions, 2);
+    size += ParameterEncodedSize::FloatArray(value.viewportBoundsRange, 2);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::Int32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::Int32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FloatArray(value.pointSizeRange, 2);
+    size += ParameterEncodedSize::FloatArray(value.lineWidthRange, 2);
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryProperties& value)
 {
     encoder->EncodeUInt32Value(value.memoryTypeCount);
@@ -376,6 +796,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryPropert
     EncodeStructArray(encoder, value.memoryHeaps, value.memoryHeapCount);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.memoryTypes, value.memoryTypeCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.memoryHeaps, value.memoryHeapCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSparseProperties& value)
 {
     encoder->EncodeVkBool32Value(value.residencyStandard2DBlockShape);
@@ -385,6 +816,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSparsePropert
     encoder->EncodeVkBool32Value(value.residencyNonResidentStrict);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSparseProperties& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProperties& value)
 {
     encoder->EncodeUInt32Value(value.apiVersion);
@@ -398,6 +843,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProperties& v
     EncodeStruct(encoder, value.sparseProperties);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::String(value.deviceName);
+    size += ParameterEncodedSize::UInt8Array(value.pipelineCacheUUID, VK_UUID_SIZE);
+    size += ComputeEncodedSize(value.limits);
+    size += ComputeEncodedSize(value.sparseProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyProperties& value)
 {
     encoder->EncodeFlagsValue(value.queueFlags);
@@ -406,6 +867,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyProperties& valu
     EncodeStruct(encoder, value.minImageTransferGranularity);
 }
 
+size_t ComputeEncodedSize(const VkQueueFamilyProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.minImageTransferGranularity);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -416,6 +888,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueCreateInfo& valu
     encoder->EncodeFloatArray(value.pQueuePriorities, value.queueCount);
 }
 
+size_t ComputeEncodedSize(const VkDeviceQueueCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FloatArray(value.pQueuePriorities, value.queueCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -430,12 +915,38 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceCreateInfo& value)
     EncodeStructPtr(encoder, value.pEnabledFeatures);
 }
 
+size_t ComputeEncodedSize(const VkDeviceCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pQueueCreateInfos, value.queueCreateInfoCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::StringArray(value.ppEnabledLayerNames, value.enabledLayerCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::StringArray(value.ppEnabledExtensionNames, value.enabledExtensionCount);
+    size += ComputeStructPtrEncodedSize(value.pEnabledFeatures);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExtensionProperties& value)
 {
     encoder->EncodeString(value.extensionName);
     encoder->EncodeUInt32Value(value.specVersion);
 }
 
+size_t ComputeEncodedSize(const VkExtensionProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::String(value.extensionName);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkLayerProperties& value)
 {
     encoder->EncodeString(value.layerName);
@@ -444,6 +955,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkLayerProperties& value)
     encoder->EncodeString(value.description);
 }
 
+size_t ComputeEncodedSize(const VkLayerProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::String(value.layerName);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::String(value.description);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubmitInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -457,6 +979,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubmitInfo& value)
     encoder->EncodeHandleArray(value.pSignalSemaphores, value.signalSemaphoreCount);
 }
 
+size_t ComputeEncodedSize(const VkSubmitInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pWaitSemaphores, value.waitSemaphoreCount);
+    size += ParameterEncodedSize::FlagsArray(value.pWaitDstStageMask, value.waitSemaphoreCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pCommandBuffers, value.commandBufferCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pSignalSemaphores, value.signalSemaphoreCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMappedMemoryRange& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -466,6 +1004,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMappedMemoryRange& value)
     encoder->EncodeVkDeviceSizeValue(value.size);
 }
 
+size_t ComputeEncodedSize(const VkMappedMemoryRange& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryAllocateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -474,6 +1024,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryAllocateInfo& value)
     encoder->EncodeUInt32Value(value.memoryTypeIndex);
 }
 
+size_t ComputeEncodedSize(const VkMemoryAllocateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryRequirements& value)
 {
     encoder->EncodeVkDeviceSizeValue(value.size);
@@ -481,6 +1042,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryRequirements& value)
     encoder->EncodeUInt32Value(value.memoryTypeBits);
 }
 
+size_t ComputeEncodedSize(const VkMemoryRequirements& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseMemoryBind& value)
 {
     encoder->EncodeVkDeviceSizeValue(value.resourceOffset);
@@ -490,6 +1063,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseMemoryBind& value)
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkSparseMemoryBind& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseBufferMemoryBindInfo& value)
 {
     encoder->EncodeHandleValue(value.buffer);
@@ -497,6 +1084,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseBufferMemoryBindInfo&
     EncodeStructArray(encoder, value.pBinds, value.bindCount);
 }
 
+size_t ComputeEncodedSize(const VkSparseBufferMemoryBindInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pBinds, value.bindCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageOpaqueMemoryBindInfo& value)
 {
     encoder->EncodeHandleValue(value.image);
@@ -504,6 +1101,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageOpaqueMemoryBind
     EncodeStructArray(encoder, value.pBinds, value.bindCount);
 }
 
+size_t ComputeEncodedSize(const VkSparseImageOpaqueMemoryBindInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pBinds, value.bindCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresource& value)
 {
     encoder->EncodeFlagsValue(value.aspectMask);
@@ -511,6 +1118,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresource& value)
     encoder->EncodeUInt32Value(value.arrayLayer);
 }
 
+size_t ComputeEncodedSize(const VkImageSubresource& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryBind& value)
 {
     EncodeStruct(encoder, value.subresource);
@@ -521,6 +1140,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryBind& valu
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkSparseImageMemoryBind& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.subresource);
+    size += ComputeEncodedSize(value.offset);
+    size += ComputeEncodedSize(value.extent);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryBindInfo& value)
 {
     encoder->EncodeHandleValue(value.image);
@@ -528,6 +1160,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryBindInfo&
     EncodeStructArray(encoder, value.pBinds, value.bindCount);
 }
 
+size_t ComputeEncodedSize(const VkSparseImageMemoryBindInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pBinds, value.bindCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindSparseInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -544,6 +1186,25 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindSparseInfo& value)
     encoder->EncodeHandleArray(value.pSignalSemaphores, value.signalSemaphoreCount);
 }
 
+size_t ComputeEncodedSize(const VkBindSparseInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pWaitSemaphores, value.waitSemaphoreCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pBufferBinds, value.bufferBindCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pImageOpaqueBinds, value.imageOpaqueBindCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pImageBinds, value.imageBindCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pSignalSemaphores, value.signalSemaphoreCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageFormatProperties& value)
 {
     encoder->EncodeFlagsValue(value.aspectMask);
@@ -551,6 +1212,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageFormatProperties
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkSparseImageFormatProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.imageGranularity);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryRequirements& value)
 {
     EncodeStruct(encoder, value.formatProperties);
@@ -560,6 +1231,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryRequiremen
     encoder->EncodeVkDeviceSizeValue(value.imageMipTailStride);
 }
 
+size_t ComputeEncodedSize(const VkSparseImageMemoryRequirements& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.formatProperties);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFenceCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -567,6 +1250,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFenceCreateInfo& value)
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkFenceCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -574,6 +1267,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreCreateInfo& value)
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkSemaphoreCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkEventCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -581,6 +1284,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkEventCreateInfo& value)
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkEventCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -591,6 +1304,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolCreateInfo& value)
     encoder->EncodeFlagsValue(value.pipelineStatistics);
 }
 
+size_t ComputeEncodedSize(const VkQueryPoolCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -603,6 +1329,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferCreateInfo& value)
     encoder->EncodeUInt32Array(value.pQueueFamilyIndices, value.queueFamilyIndexCount);
 }
 
+size_t ComputeEncodedSize(const VkBufferCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pQueueFamilyIndices, value.queueFamilyIndexCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferViewCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -614,6 +1355,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferViewCreateInfo& value
     encoder->EncodeVkDeviceSizeValue(value.range);
 }
 
+size_t ComputeEncodedSize(const VkBufferViewCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -633,6 +1388,28 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageCreateInfo& value)
     encoder->EncodeEnumValue(value.initialLayout);
 }
 
+size_t ComputeEncodedSize(const VkImageCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.extent);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pQueueFamilyIndices, value.queueFamilyIndexCount);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubresourceLayout& value)
 {
     encoder->EncodeVkDeviceSizeValue(value.offset);
@@ -642,6 +1419,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubresourceLayout& value)
     encoder->EncodeVkDeviceSizeValue(value.depthPitch);
 }
 
+size_t ComputeEncodedSize(const VkSubresourceLayout& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkComponentMapping& value)
 {
     encoder->EncodeEnumValue(value.r);
@@ -650,6 +1441,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkComponentMapping& value)
     encoder->EncodeEnumValue(value.a);
 }
 
+size_t ComputeEncodedSize(const VkComponentMapping& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -662,6 +1466,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageViewCreateInfo& value)
     EncodeStruct(encoder, value.subresourceRange);
 }
 
+size_t ComputeEncodedSize(const VkImageViewCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.components);
+    size += ComputeEncodedSize(value.subresourceRange);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -671,6 +1490,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleCreateInfo& val
     encoder->EncodeUInt32Array(value.pCode, value.codeSize / 4);
 }
 
+size_t ComputeEncodedSize(const VkShaderModuleCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::UInt32Array(value.pCode, value.codeSize / 4);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCacheCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -680,6 +1511,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCacheCreateInfo& va
     encoder->EncodeVoidArray(value.pInitialData, value.initialDataSize);
 }
 
+size_t ComputeEncodedSize(const VkPipelineCacheCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::VoidArray(value.pInitialData, value.initialDataSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSpecializationMapEntry& value)
 {
     encoder->EncodeUInt32Value(value.constantID);
@@ -687,6 +1530,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSpecializationMapEntry& val
     encoder->EncodeSizeTValue(value.size);
 }
 
+size_t ComputeEncodedSize(const VkSpecializationMapEntry& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::SizeTValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSpecializationInfo& value)
 {
     encoder->EncodeUInt32Value(value.mapEntryCount);
@@ -695,6 +1550,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSpecializationInfo& value)
     encoder->EncodeVoidArray(value.pData, value.dataSize);
 }
 
+size_t ComputeEncodedSize(const VkSpecializationInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pMapEntries, value.mapEntryCount);
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::VoidArray(value.pData, value.dataSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineShaderStageCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -706,6 +1572,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineShaderStageCreateIn
     EncodeStructPtr(encoder, value.pSpecializationInfo);
 }
 
+size_t ComputeEncodedSize(const VkPipelineShaderStageCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::String(value.pName);
+    size += ComputeStructPtrEncodedSize(value.pSpecializationInfo);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkComputePipelineCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -717,6 +1597,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkComputePipelineCreateInfo&
     encoder->EncodeInt32Value(value.basePipelineIndex);
 }
 
+size_t ComputeEncodedSize(const VkComputePipelineCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.stage);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDescription& value)
 {
     encoder->EncodeUInt32Value(value.binding);
@@ -724,6 +1618,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDescripti
     encoder->EncodeEnumValue(value.inputRate);
 }
 
+size_t ComputeEncodedSize(const VkVertexInputBindingDescription& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputAttributeDescription& value)
 {
     encoder->EncodeUInt32Value(value.location);
@@ -732,17 +1638,44 @@ void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputAttributeDescrip
     encoder->EncodeUInt32Value(value.offset);
 }
 
-void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputStateCreateInfo& value)
+size_t ComputeEncodedSize(const VkVertexInputAttributeDescription& value)
 {
-    encoder->EncodeEnumValue(value.sType);
-    EncodePNextStruct(encoder, value.pNext);
-    encoder->EncodeFlagsValue(value.flags);
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
+void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputStateCreateInfo& value)
+{
+    encoder->EncodeEnumValue(value.sType);
+    EncodePNextStruct(encoder, value.pNext);
+    encoder->EncodeFlagsValue(value.flags);
     encoder->EncodeUInt32Value(value.vertexBindingDescriptionCount);
     EncodeStructArray(encoder, value.pVertexBindingDescriptions, value.vertexBindingDescriptionCount);
     encoder->EncodeUInt32Value(value.vertexAttributeDescriptionCount);
     EncodeStructArray(encoder, value.pVertexAttributeDescriptions, value.vertexAttributeDescriptionCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineVertexInputStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pVertexBindingDescriptions, value.vertexBindingDescriptionCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pVertexAttributeDescriptions, value.vertexAttributeDescriptionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineInputAssemblyStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -752,6 +1685,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineInputAssemblyStateC
     encoder->EncodeVkBool32Value(value.primitiveRestartEnable);
 }
 
+size_t ComputeEncodedSize(const VkPipelineInputAssemblyStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineTessellationStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -760,6 +1705,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineTessellationStateCr
     encoder->EncodeUInt32Value(value.patchControlPoints);
 }
 
+size_t ComputeEncodedSize(const VkPipelineTessellationStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkViewport& value)
 {
     encoder->EncodeFloatValue(value.x);
@@ -770,6 +1726,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkViewport& value)
     encoder->EncodeFloatValue(value.maxDepth);
 }
 
+size_t ComputeEncodedSize(const VkViewport& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -781,6 +1752,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportStateCreate
     EncodeStructArray(encoder, value.pScissors, value.scissorCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineViewportStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pViewports, value.viewportCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pScissors, value.scissorCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -798,6 +1783,26 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateC
     encoder->EncodeFloatValue(value.lineWidth);
 }
 
+size_t ComputeEncodedSize(const VkPipelineRasterizationStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineMultisampleStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -811,6 +1816,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineMultisampleStateCre
     encoder->EncodeVkBool32Value(value.alphaToOneEnable);
 }
 
+size_t ComputeEncodedSize(const VkPipelineMultisampleStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::VkSampleMaskArray(value.pSampleMask, (value.rasterizationSamples + 31) / 32);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkStencilOpState& value)
 {
     encoder->EncodeEnumValue(value.failOp);
@@ -822,6 +1843,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkStencilOpState& value)
     encoder->EncodeUInt32Value(value.reference);
 }
 
+size_t ComputeEncodedSize(const VkStencilOpState& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDepthStencilStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -838,6 +1875,25 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDepthStencilStateCr
     encoder->EncodeFloatValue(value.maxDepthBounds);
 }
 
+size_t ComputeEncodedSize(const VkPipelineDepthStencilStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ComputeEncodedSize(value.front);
+    size += ComputeEncodedSize(value.back);
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAttachmentState& value)
 {
     encoder->EncodeVkBool32Value(value.blendEnable);
@@ -850,6 +1906,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAttachmen
     encoder->EncodeFlagsValue(value.colorWriteMask);
 }
 
+size_t ComputeEncodedSize(const VkPipelineColorBlendAttachmentState& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -862,6 +1935,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendStateCrea
     encoder->EncodeFloatArray(value.blendConstants, 4);
 }
 
+size_t ComputeEncodedSize(const VkPipelineColorBlendStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pAttachments, value.attachmentCount);
+    size += ParameterEncodedSize::FloatArray(value.blendConstants, 4);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDynamicStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -871,6 +1959,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDynamicStateCreateI
     encoder->EncodeEnumArray(value.pDynamicStates, value.dynamicStateCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineDynamicStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pDynamicStates, value.dynamicStateCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsPipelineCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -894,6 +1994,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsPipelineCreateInfo&
     encoder->EncodeInt32Value(value.basePipelineIndex);
 }
 
+size_t ComputeEncodedSize(const VkGraphicsPipelineCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pStages, value.stageCount);
+    size += ComputeStructPtrEncodedSize(value.pVertexInputState);
+    size += ComputeStructPtrEncodedSize(value.pInputAssemblyState);
+    size += ComputeStructPtrEncodedSize(value.pTessellationState);
+    size += ComputeStructPtrEncodedSize(value.pViewportState);
+    size += ComputeStructPtrEncodedSize(value.pRasterizationState);
+    size += ComputeStructPtrEncodedSize(value.pMultisampleState);
+    size += ComputeStructPtrEncodedSize(value.pDepthStencilState);
+    size += ComputeStructPtrEncodedSize(value.pColorBlendState);
+    size += ComputeStructPtrEncodedSize(value.pDynamicState);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPushConstantRange& value)
 {
     encoder->EncodeFlagsValue(value.stageFlags);
@@ -901,6 +2027,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPushConstantRange& value)
     encoder->EncodeUInt32Value(value.size);
 }
 
+size_t ComputeEncodedSize(const VkPushConstantRange& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineLayoutCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -912,6 +2050,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineLayoutCreateInfo& v
     EncodeStructArray(encoder, value.pPushConstantRanges, value.pushConstantRangeCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineLayoutCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pSetLayouts, value.setLayoutCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pPushConstantRanges, value.pushConstantRangeCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -934,6 +2086,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSamplerCreateInfo& value)
     encoder->EncodeVkBool32Value(value.unnormalizedCoordinates);
 }
 
+size_t ComputeEncodedSize(const VkSamplerCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyDescriptorSet& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -947,6 +2124,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyDescriptorSet& value)
     encoder->EncodeUInt32Value(value.descriptorCount);
 }
 
+size_t ComputeEncodedSize(const VkCopyDescriptorSet& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorBufferInfo& value)
 {
     encoder->EncodeHandleValue(value.buffer);
@@ -954,12 +2147,35 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorBufferInfo& value
     encoder->EncodeVkDeviceSizeValue(value.range);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorBufferInfo& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolSize& value)
 {
     encoder->EncodeEnumValue(value.type);
     encoder->EncodeUInt32Value(value.descriptorCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorPoolSize& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -970,6 +2186,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolCreateInfo& v
     EncodeStructArray(encoder, value.pPoolSizes, value.poolSizeCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorPoolCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pPoolSizes, value.poolSizeCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetAllocateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -979,6 +2208,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetAllocateInfo&
     encoder->EncodeHandleArray(value.pSetLayouts, value.descriptorSetCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorSetAllocateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pSetLayouts, value.descriptorSetCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutBinding& value)
 {
     encoder->EncodeUInt32Value(value.binding);
@@ -988,6 +2229,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutBinding&
     encoder->EncodeHandleArray(value.pImmutableSamplers, value.descriptorCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutBinding& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::HandleArray(value.pImmutableSamplers, value.descriptorCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -997,6 +2250,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutCreateIn
     EncodeStructArray(encoder, value.pBindings, value.bindingCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pBindings, value.bindingCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentDescription& value)
 {
     encoder->EncodeFlagsValue(value.flags);
@@ -1010,12 +2275,41 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentDescription& valu
     encoder->EncodeEnumValue(value.finalLayout);
 }
 
+size_t ComputeEncodedSize(const VkAttachmentDescription& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentReference& value)
 {
     encoder->EncodeUInt32Value(value.attachment);
     encoder->EncodeEnumValue(value.layout);
 }
 
+size_t ComputeEncodedSize(const VkAttachmentReference& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1029,6 +2323,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferCreateInfo& valu
     encoder->EncodeUInt32Value(value.layers);
 }
 
+size_t ComputeEncodedSize(const VkFramebufferCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pAttachments, value.attachmentCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDescription& value)
 {
     encoder->EncodeFlagsValue(value.flags);
@@ -1043,6 +2353,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDescription& value)
     encoder->EncodeUInt32Array(value.pPreserveAttachments, value.preserveAttachmentCount);
 }
 
+size_t ComputeEncodedSize(const VkSubpassDescription& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pInputAttachments, value.inputAttachmentCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pColorAttachments, value.colorAttachmentCount);
+    size += ComputeStructArrayEncodedSize(value.pResolveAttachments, value.colorAttachmentCount);
+    size += ComputeStructPtrEncodedSize(value.pDepthStencilAttachment);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pPreserveAttachments, value.preserveAttachmentCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDependency& value)
 {
     encoder->EncodeUInt32Value(value.srcSubpass);
@@ -1054,6 +2381,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDependency& value)
     encoder->EncodeFlagsValue(value.dependencyFlags);
 }
 
+size_t ComputeEncodedSize(const VkSubpassDependency& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1067,6 +2410,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassCreateInfo& value
     EncodeStructArray(encoder, value.pDependencies, value.dependencyCount);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pAttachments, value.attachmentCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pSubpasses, value.subpassCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pDependencies, value.dependencyCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandPoolCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1075,6 +2434,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandPoolCreateInfo& valu
     encoder->EncodeUInt32Value(value.queueFamilyIndex);
 }
 
+size_t ComputeEncodedSize(const VkCommandPoolCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferAllocateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1084,6 +2454,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferAllocateInfo&
     encoder->EncodeUInt32Value(value.commandBufferCount);
 }
 
+size_t ComputeEncodedSize(const VkCommandBufferAllocateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1096,6 +2478,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceInf
     encoder->EncodeFlagsValue(value.pipelineStatistics);
 }
 
+size_t ComputeEncodedSize(const VkCommandBufferInheritanceInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferBeginInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1104,6 +2501,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferBeginInfo& val
     EncodeStructPtr(encoder, value.pInheritanceInfo);
 }
 
+size_t ComputeEncodedSize(const VkCommandBufferBeginInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeStructPtrEncodedSize(value.pInheritanceInfo);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferCopy& value)
 {
     encoder->EncodeVkDeviceSizeValue(value.srcOffset);
@@ -1111,6 +2519,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferCopy& value)
     encoder->EncodeVkDeviceSizeValue(value.size);
 }
 
+size_t ComputeEncodedSize(const VkBufferCopy& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresourceLayers& value)
 {
     encoder->EncodeFlagsValue(value.aspectMask);
@@ -1119,6 +2539,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageSubresourceLayers& val
     encoder->EncodeUInt32Value(value.layerCount);
 }
 
+size_t ComputeEncodedSize(const VkImageSubresourceLayers& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferImageCopy& value)
 {
     encoder->EncodeVkDeviceSizeValue(value.bufferOffset);
@@ -1129,12 +2562,36 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferImageCopy& value)
     EncodeStruct(encoder, value.imageExtent);
 }
 
+size_t ComputeEncodedSize(const VkBufferImageCopy& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.imageSubresource);
+    size += ComputeEncodedSize(value.imageOffset);
+    size += ComputeEncodedSize(value.imageExtent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkClearDepthStencilValue& value)
 {
     encoder->EncodeFloatValue(value.depth);
     encoder->EncodeUInt32Value(value.stencil);
 }
 
+size_t ComputeEncodedSize(const VkClearDepthStencilValue& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkClearAttachment& value)
 {
     encoder->EncodeFlagsValue(value.aspectMask);
@@ -1142,6 +2599,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkClearAttachment& value)
     EncodeStruct(encoder, value.clearValue);
 }
 
+size_t ComputeEncodedSize(const VkClearAttachment& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.clearValue);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkClearRect& value)
 {
     EncodeStruct(encoder, value.rect);
@@ -1149,6 +2616,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkClearRect& value)
     encoder->EncodeUInt32Value(value.layerCount);
 }
 
+size_t ComputeEncodedSize(const VkClearRect& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.rect);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageBlit& value)
 {
     EncodeStruct(encoder, value.srcSubresource);
@@ -1157,6 +2634,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageBlit& value)
     EncodeStructArray(encoder, value.dstOffsets, 2);
 }
 
+size_t ComputeEncodedSize(const VkImageBlit& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.srcSubresource);
+    size += ComputeStructArrayEncodedSize(value.srcOffsets, 2);
+    size += ComputeEncodedSize(value.dstSubresource);
+    size += ComputeStructArrayEncodedSize(value.dstOffsets, 2);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy& value)
 {
     EncodeStruct(encoder, value.srcSubresource);
@@ -1166,6 +2654,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy& value)
     EncodeStruct(encoder, value.extent);
 }
 
+size_t ComputeEncodedSize(const VkImageCopy& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.srcSubresource);
+    size += ComputeEncodedSize(value.srcOffset);
+    size += ComputeEncodedSize(value.dstSubresource);
+    size += ComputeEncodedSize(value.dstOffset);
+    size += ComputeEncodedSize(value.extent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve& value)
 {
     EncodeStruct(encoder, value.srcSubresource);
@@ -1175,6 +2675,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve& value)
     EncodeStruct(encoder, value.extent);
 }
 
+size_t ComputeEncodedSize(const VkImageResolve& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.srcSubresource);
+    size += ComputeEncodedSize(value.srcOffset);
+    size += ComputeEncodedSize(value.dstSubresource);
+    size += ComputeEncodedSize(value.dstOffset);
+    size += ComputeEncodedSize(value.extent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassBeginInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1186,6 +2698,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassBeginInfo& value)
     EncodeStructArray(encoder, value.pClearValues, value.clearValueCount);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassBeginInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ComputeEncodedSize(value.renderArea);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pClearValues, value.clearValueCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1196,6 +2722,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupPrope
     encoder->EncodeVkBool32Value(value.quadOperationsInAllStages);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSubgroupProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindBufferMemoryInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1205,6 +2744,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindBufferMemoryInfo& value
     encoder->EncodeVkDeviceSizeValue(value.memoryOffset);
 }
 
+size_t ComputeEncodedSize(const VkBindBufferMemoryInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemoryInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1214,6 +2765,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemoryInfo& value)
     encoder->EncodeVkDeviceSizeValue(value.memoryOffset);
 }
 
+size_t ComputeEncodedSize(const VkBindImageMemoryInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevice16BitStorageFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1224,6 +2787,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevice16BitStorageF
     encoder->EncodeVkBool32Value(value.storageInputOutput16);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevice16BitStorageFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryDedicatedRequirements& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1232,6 +2808,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryDedicatedRequirements
     encoder->EncodeVkBool32Value(value.requiresDedicatedAllocation);
 }
 
+size_t ComputeEncodedSize(const VkMemoryDedicatedRequirements& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryDedicatedAllocateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1240,6 +2827,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryDedicatedAllocateInfo
     encoder->EncodeHandleValue(value.buffer);
 }
 
+size_t ComputeEncodedSize(const VkMemoryDedicatedAllocateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryAllocateFlagsInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1248,6 +2846,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryAllocateFlagsInfo& va
     encoder->EncodeUInt32Value(value.deviceMask);
 }
 
+size_t ComputeEncodedSize(const VkMemoryAllocateFlagsInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupRenderPassBeginInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1257,6 +2866,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupRenderPassBeginI
     EncodeStructArray(encoder, value.pDeviceRenderAreas, value.deviceRenderAreaCount);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupRenderPassBeginInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pDeviceRenderAreas, value.deviceRenderAreaCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupCommandBufferBeginInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1264,6 +2885,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupCommandBufferBeg
     encoder->EncodeUInt32Value(value.deviceMask);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupCommandBufferBeginInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupSubmitInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1276,6 +2907,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupSubmitInfo& valu
     encoder->EncodeUInt32Array(value.pSignalSemaphoreDeviceIndices, value.signalSemaphoreCount);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupSubmitInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pWaitSemaphoreDeviceIndices, value.waitSemaphoreCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pCommandBufferDeviceMasks, value.commandBufferCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pSignalSemaphoreDeviceIndices, value.signalSemaphoreCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupBindSparseInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1284,6 +2930,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupBindSparseInfo&
     encoder->EncodeUInt32Value(value.memoryDeviceIndex);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupBindSparseInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindBufferMemoryDeviceGroupInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1292,6 +2949,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindBufferMemoryDeviceGroup
     encoder->EncodeUInt32Array(value.pDeviceIndices, value.deviceIndexCount);
 }
 
+size_t ComputeEncodedSize(const VkBindBufferMemoryDeviceGroupInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pDeviceIndices, value.deviceIndexCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemoryDeviceGroupInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1302,6 +2970,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemoryDeviceGroupI
     EncodeStructArray(encoder, value.pSplitInstanceBindRegions, value.splitInstanceBindRegionCount);
 }
 
+size_t ComputeEncodedSize(const VkBindImageMemoryDeviceGroupInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pDeviceIndices, value.deviceIndexCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pSplitInstanceBindRegions, value.splitInstanceBindRegionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceGroupProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1311,6 +2992,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceGroupProperti
     encoder->EncodeVkBool32Value(value.subsetAllocation);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceGroupProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.physicalDevices, value.physicalDeviceCount);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupDeviceCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1319,6 +3012,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupDeviceCreateInfo
     encoder->EncodeHandleArray(value.pPhysicalDevices, value.physicalDeviceCount);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupDeviceCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pPhysicalDevices, value.physicalDeviceCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferMemoryRequirementsInfo2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1326,6 +3030,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferMemoryRequirementsInf
     encoder->EncodeHandleValue(value.buffer);
 }
 
+size_t ComputeEncodedSize(const VkBufferMemoryRequirementsInfo2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageMemoryRequirementsInfo2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1333,13 +3047,33 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageMemoryRequirementsInfo
     encoder->EncodeHandleValue(value.image);
 }
 
-void EncodeStruct(ParameterEncoder* encoder, const VkImageSparseMemoryRequirementsInfo2& value)
+size_t ComputeEncodedSize(const VkImageMemoryRequirementsInfo2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
+void EncodeStruct(ParameterEncoder* encoder, const VkImageSparseMemoryRequirementsInfo2& value)
 {
     encoder->EncodeEnumValue(value.sType);
     EncodePNextStruct(encoder, value.pNext);
     encoder->EncodeHandleValue(value.image);
 }
 
+size_t ComputeEncodedSize(const VkImageSparseMemoryRequirementsInfo2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryRequirements2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1347,6 +3081,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryRequirements2& value)
     EncodeStruct(encoder, value.memoryRequirements);
 }
 
+size_t ComputeEncodedSize(const VkMemoryRequirements2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.memoryRequirements);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryRequirements2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1354,6 +3098,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageMemoryRequiremen
     EncodeStruct(encoder, value.memoryRequirements);
 }
 
+size_t ComputeEncodedSize(const VkSparseImageMemoryRequirements2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.memoryRequirements);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFeatures2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1361,6 +3115,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFeatures2& va
     EncodeStruct(encoder, value.features);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFeatures2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.features);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProperties2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1368,6 +3132,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProperties2&
     EncodeStruct(encoder, value.properties);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceProperties2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.properties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFormatProperties2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1375,6 +3149,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFormatProperties2& value)
     EncodeStruct(encoder, value.formatProperties);
 }
 
+size_t ComputeEncodedSize(const VkFormatProperties2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.formatProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageFormatProperties2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1382,6 +3166,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageFormatProperties2& val
     EncodeStruct(encoder, value.imageFormatProperties);
 }
 
+size_t ComputeEncodedSize(const VkImageFormatProperties2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.imageFormatProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageFormatInfo2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1393,6 +3187,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageFormatIn
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageFormatInfo2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyProperties2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1400,6 +3208,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyProperties2& val
     EncodeStruct(encoder, value.queueFamilyProperties);
 }
 
+size_t ComputeEncodedSize(const VkQueueFamilyProperties2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.queueFamilyProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryProperties2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1407,6 +3225,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryPropert
     EncodeStruct(encoder, value.memoryProperties);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryProperties2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.memoryProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageFormatProperties2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1414,6 +3242,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSparseImageFormatProperties
     EncodeStruct(encoder, value.properties);
 }
 
+size_t ComputeEncodedSize(const VkSparseImageFormatProperties2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.properties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSparseImageFormatInfo2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1425,6 +3263,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSparseImageFo
     encoder->EncodeEnumValue(value.tiling);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSparseImageFormatInfo2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePointClippingProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1432,6 +3284,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePointClipping
     encoder->EncodeEnumValue(value.pointClippingBehavior);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePointClippingProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkInputAttachmentAspectReference& value)
 {
     encoder->EncodeUInt32Value(value.subpass);
@@ -1439,6 +3301,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkInputAttachmentAspectRefere
     encoder->EncodeFlagsValue(value.aspectMask);
 }
 
+size_t ComputeEncodedSize(const VkInputAttachmentAspectReference& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassInputAttachmentAspectCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1447,6 +3321,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassInputAttachmentAs
     EncodeStructArray(encoder, value.pAspectReferences, value.aspectReferenceCount);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassInputAttachmentAspectCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pAspectReferences, value.aspectReferenceCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewUsageCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1454,6 +3339,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageViewUsageCreateInfo& v
     encoder->EncodeFlagsValue(value.usage);
 }
 
+size_t ComputeEncodedSize(const VkImageViewUsageCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineTessellationDomainOriginStateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1461,6 +3356,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineTessellationDomainO
     encoder->EncodeEnumValue(value.domainOrigin);
 }
 
+size_t ComputeEncodedSize(const VkPipelineTessellationDomainOriginStateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassMultiviewCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1473,6 +3378,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassMultiviewCreateIn
     encoder->EncodeUInt32Array(value.pCorrelationMasks, value.correlationMaskCount);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassMultiviewCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pViewMasks, value.subpassCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::Int32Array(value.pViewOffsets, value.dependencyCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pCorrelationMasks, value.correlationMaskCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1482,6 +3402,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewFeat
     encoder->EncodeVkBool32Value(value.multiviewTessellationShader);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMultiviewFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1490,6 +3422,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewProp
     encoder->EncodeUInt32Value(value.maxMultiviewInstanceIndex);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMultiviewProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVariablePointersFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1498,6 +3441,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVariablePoint
     encoder->EncodeVkBool32Value(value.variablePointers);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVariablePointersFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProtectedMemoryFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1505,6 +3459,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProtectedMemo
     encoder->EncodeVkBool32Value(value.protectedMemory);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceProtectedMemoryFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProtectedMemoryProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1512,6 +3476,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceProtectedMemo
     encoder->EncodeVkBool32Value(value.protectedNoFault);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceProtectedMemoryProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueInfo2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1521,6 +3495,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueInfo2& value)
     encoder->EncodeUInt32Value(value.queueIndex);
 }
 
+size_t ComputeEncodedSize(const VkDeviceQueueInfo2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkProtectedSubmitInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1528,6 +3514,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkProtectedSubmitInfo& value)
     encoder->EncodeVkBool32Value(value.protectedSubmit);
 }
 
+size_t ComputeEncodedSize(const VkProtectedSubmitInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerYcbcrConversionCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1542,6 +3538,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSamplerYcbcrConversionCreat
     encoder->EncodeVkBool32Value(value.forceExplicitReconstruction);
 }
 
+size_t ComputeEncodedSize(const VkSamplerYcbcrConversionCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.components);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerYcbcrConversionInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1549,6 +3562,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSamplerYcbcrConversionInfo&
     encoder->EncodeHandleValue(value.conversion);
 }
 
+size_t ComputeEncodedSize(const VkSamplerYcbcrConversionInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindImagePlaneMemoryInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1556,6 +3579,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindImagePlaneMemoryInfo& v
     encoder->EncodeEnumValue(value.planeAspect);
 }
 
+size_t ComputeEncodedSize(const VkBindImagePlaneMemoryInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImagePlaneMemoryRequirementsInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1563,6 +3596,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImagePlaneMemoryRequirement
     encoder->EncodeEnumValue(value.planeAspect);
 }
 
+size_t ComputeEncodedSize(const VkImagePlaneMemoryRequirementsInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSamplerYcbcrConversionFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1570,6 +3613,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSamplerYcbcrC
     encoder->EncodeVkBool32Value(value.samplerYcbcrConversion);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSamplerYcbcrConversionFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerYcbcrConversionImageFormatProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1577,6 +3630,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSamplerYcbcrConversionImage
     encoder->EncodeUInt32Value(value.combinedImageSamplerDescriptorCount);
 }
 
+size_t ComputeEncodedSize(const VkSamplerYcbcrConversionImageFormatProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorUpdateTemplateEntry& value)
 {
     encoder->EncodeUInt32Value(value.dstBinding);
@@ -1587,6 +3650,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorUpdateTemplateEnt
     encoder->EncodeSizeTValue(value.stride);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorUpdateTemplateEntry& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::SizeTValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorUpdateTemplateCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1601,6 +3679,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorUpdateTemplateCre
     encoder->EncodeUInt32Value(value.set);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorUpdateTemplateCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pDescriptorUpdateEntries, value.descriptorUpdateEntryCount);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryProperties& value)
 {
     encoder->EncodeFlagsValue(value.externalMemoryFeatures);
@@ -1608,6 +3703,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryProperties& v
     encoder->EncodeFlagsValue(value.compatibleHandleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExternalMemoryProperties& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalImageFormatInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1615,6 +3722,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalImage
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalImageFormatInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalImageFormatProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1622,6 +3739,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalImageFormatProperti
     EncodeStruct(encoder, value.externalMemoryProperties);
 }
 
+size_t ComputeEncodedSize(const VkExternalImageFormatProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.externalMemoryProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalBufferInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1631,6 +3758,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalBuffe
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalBufferInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalBufferProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1638,6 +3777,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalBufferProperties& v
     EncodeStruct(encoder, value.externalMemoryProperties);
 }
 
+size_t ComputeEncodedSize(const VkExternalBufferProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.externalMemoryProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceIDProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1649,6 +3798,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceIDProperties&
     encoder->EncodeVkBool32Value(value.deviceLUIDValid);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceIDProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt8Array(value.deviceUUID, VK_UUID_SIZE);
+    size += ParameterEncodedSize::UInt8Array(value.driverUUID, VK_UUID_SIZE);
+    size += ParameterEncodedSize::UInt8Array(value.deviceLUID, VK_LUID_SIZE);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryImageCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1656,6 +3819,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryImageCreateIn
     encoder->EncodeFlagsValue(value.handleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExternalMemoryImageCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryBufferCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1663,6 +3836,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryBufferCreateI
     encoder->EncodeFlagsValue(value.handleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExternalMemoryBufferCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryAllocateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1670,6 +3853,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryAllocateInfo& v
     encoder->EncodeFlagsValue(value.handleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExportMemoryAllocateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalFenceInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1677,6 +3870,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalFence
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalFenceInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalFenceProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1686,6 +3889,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalFenceProperties& va
     encoder->EncodeFlagsValue(value.externalFenceFeatures);
 }
 
+size_t ComputeEncodedSize(const VkExternalFenceProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportFenceCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1693,6 +3908,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportFenceCreateInfo& valu
     encoder->EncodeFlagsValue(value.handleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExportFenceCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportSemaphoreCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1700,6 +3925,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportSemaphoreCreateInfo&
     encoder->EncodeFlagsValue(value.handleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExportSemaphoreCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalSemaphoreInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1707,6 +3942,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalSemap
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalSemaphoreInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalSemaphoreProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1716,6 +3961,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalSemaphoreProperties
     encoder->EncodeFlagsValue(value.externalSemaphoreFeatures);
 }
 
+size_t ComputeEncodedSize(const VkExternalSemaphoreProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMaintenance3Properties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1724,6 +3981,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMaintenance3P
     encoder->EncodeVkDeviceSizeValue(value.maxMemoryAllocationSize);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMaintenance3Properties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutSupport& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1731,6 +3999,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutSupport&
     encoder->EncodeVkBool32Value(value.supported);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutSupport& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDrawParametersFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1738,6 +4016,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDrawPar
     encoder->EncodeVkBool32Value(value.shaderDrawParameters);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderDrawParametersFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Features& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1756,6 +4044,27 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Featu
     encoder->EncodeVkBool32Value(value.shaderDrawParameters);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan11Features& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Properties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1777,6 +4086,30 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Prope
     encoder->EncodeVkDeviceSizeValue(value.maxMemoryAllocationSize);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan11Properties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt8Array(value.deviceUUID, VK_UUID_SIZE);
+    size += ParameterEncodedSize::UInt8Array(value.driverUUID, VK_UUID_SIZE);
+    size += ParameterEncodedSize::UInt8Array(value.deviceLUID, VK_LUID_SIZE);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan12Features& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1830,6 +4163,62 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan12Featu
     encoder->EncodeVkBool32Value(value.subgroupBroadcastDynamicId);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan12Features& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkConformanceVersion& value)
 {
     encoder->EncodeUInt8Value(value.major);
@@ -1838,6 +4227,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkConformanceVersion& value)
     encoder->EncodeUInt8Value(value.patch);
 }
 
+size_t ComputeEncodedSize(const VkConformanceVersion& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt8Value();
+    size += ParameterEncodedSize::UInt8Value();
+    size += ParameterEncodedSize::UInt8Value();
+    size += ParameterEncodedSize::UInt8Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan12Properties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1896,6 +4298,67 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan12Prope
     encoder->EncodeFlagsValue(value.framebufferIntegerColorSampleCounts);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan12Properties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::String(value.driverName);
+    size += ParameterEncodedSize::String(value.driverInfo);
+    size += ComputeEncodedSize(value.conformanceVersion);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageFormatListCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1904,6 +4367,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageFormatListCreateInfo&
     encoder->EncodeEnumArray(value.pViewFormats, value.viewFormatCount);
 }
 
+size_t ComputeEncodedSize(const VkImageFormatListCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pViewFormats, value.viewFormatCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentDescription2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1919,6 +4393,24 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentDescription2& val
     encoder->EncodeEnumValue(value.finalLayout);
 }
 
+size_t ComputeEncodedSize(const VkAttachmentDescription2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentReference2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1928,6 +4420,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentReference2& value
     encoder->EncodeFlagsValue(value.aspectMask);
 }
 
+size_t ComputeEncodedSize(const VkAttachmentReference2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDescription2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1945,6 +4449,26 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDescription2& value)
     encoder->EncodeUInt32Array(value.pPreserveAttachments, value.preserveAttachmentCount);
 }
 
+size_t ComputeEncodedSize(const VkSubpassDescription2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pInputAttachments, value.inputAttachmentCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pColorAttachments, value.colorAttachmentCount);
+    size += ComputeStructArrayEncodedSize(value.pResolveAttachments, value.colorAttachmentCount);
+    size += ComputeStructPtrEncodedSize(value.pDepthStencilAttachment);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pPreserveAttachments, value.preserveAttachmentCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDependency2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1959,6 +4483,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDependency2& value)
     encoder->EncodeInt32Value(value.viewOffset);
 }
 
+size_t ComputeEncodedSize(const VkSubpassDependency2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassCreateInfo2& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1974,6 +4515,24 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassCreateInfo2& valu
     encoder->EncodeUInt32Array(value.pCorrelatedViewMasks, value.correlatedViewMaskCount);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassCreateInfo2& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pAttachments, value.attachmentCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pSubpasses, value.subpassCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pDependencies, value.dependencyCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pCorrelatedViewMasks, value.correlatedViewMaskCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassBeginInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -1981,10 +4540,29 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubpassBeginInfo& value)
     encoder->EncodeEnumValue(value.contents);
 }
 
-void EncodeStruct(ParameterEncoder* encoder, const VkSubpassEndInfo& value)
+size_t ComputeEncodedSize(const VkSubpassBeginInfo& value)
 {
-    encoder->EncodeEnumValue(value.sType);
-    EncodePNextStruct(encoder, value.pNext);
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
+void EncodeStruct(ParameterEncoder* encoder, const VkSubpassEndInfo& value)
+{
+    encoder->EncodeEnumValue(value.sType);
+    EncodePNextStruct(encoder, value.pNext);
+}
+
+size_t ComputeEncodedSize(const VkSubpassEndInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+
+    return size;
 }
 
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevice8BitStorageFeatures& value)
@@ -1996,6 +4574,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevice8BitStorageFe
     encoder->EncodeVkBool32Value(value.storagePushConstant8);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevice8BitStorageFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDriverProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2006,6 +4596,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDriverPropert
     EncodeStruct(encoder, value.conformanceVersion);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDriverProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::String(value.driverName);
+    size += ParameterEncodedSize::String(value.driverInfo);
+    size += ComputeEncodedSize(value.conformanceVersion);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderAtomicInt64Features& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2014,6 +4617,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderAtomicI
     encoder->EncodeVkBool32Value(value.shaderSharedInt64Atomics);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderAtomicInt64Features& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderFloat16Int8Features& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2022,6 +4636,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderFloat16
     encoder->EncodeVkBool32Value(value.shaderInt8);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderFloat16Int8Features& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFloatControlsProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2045,6 +4670,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFloatControls
     encoder->EncodeVkBool32Value(value.shaderRoundingModeRTZFloat64);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFloatControlsProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutBindingFlagsCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2053,6 +4704,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutBindingF
     encoder->EncodeFlagsArray(value.pBindingFlags, value.bindingCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutBindingFlagsCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsArray(value.pBindingFlags, value.bindingCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDescriptorIndexingFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2079,6 +4741,35 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDescriptorInd
     encoder->EncodeVkBool32Value(value.runtimeDescriptorArray);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDescriptorIndexingFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDescriptorIndexingProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2108,6 +4799,38 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDescriptorInd
     encoder->EncodeUInt32Value(value.maxDescriptorSetUpdateAfterBindInputAttachments);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDescriptorIndexingProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetVariableDescriptorCountAllocateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2116,6 +4839,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetVariableDescri
     encoder->EncodeUInt32Array(value.pDescriptorCounts, value.descriptorSetCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorSetVariableDescriptorCountAllocateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pDescriptorCounts, value.descriptorSetCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetVariableDescriptorCountLayoutSupport& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2123,6 +4857,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetVariableDescri
     encoder->EncodeUInt32Value(value.maxVariableDescriptorCount);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorSetVariableDescriptorCountLayoutSupport& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDescriptionDepthStencilResolve& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2132,6 +4876,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSubpassDescriptionDepthSten
     EncodeStructPtr(encoder, value.pDepthStencilResolveAttachment);
 }
 
+size_t ComputeEncodedSize(const VkSubpassDescriptionDepthStencilResolve& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeStructPtrEncodedSize(value.pDepthStencilResolveAttachment);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDepthStencilResolveProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2142,6 +4898,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDepthStencilR
     encoder->EncodeVkBool32Value(value.independentResolve);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDepthStencilResolveProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceScalarBlockLayoutFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2149,6 +4918,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceScalarBlockLa
     encoder->EncodeVkBool32Value(value.scalarBlockLayout);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceScalarBlockLayoutFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageStencilUsageCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2156,6 +4935,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageStencilUsageCreateInfo
     encoder->EncodeFlagsValue(value.stencilUsage);
 }
 
+size_t ComputeEncodedSize(const VkImageStencilUsageCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerReductionModeCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2163,6 +4952,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSamplerReductionModeCreateI
     encoder->EncodeEnumValue(value.reductionMode);
 }
 
+size_t ComputeEncodedSize(const VkSamplerReductionModeCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSamplerFilterMinmaxProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2171,6 +4970,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSamplerFilter
     encoder->EncodeVkBool32Value(value.filterMinmaxImageComponentMapping);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSamplerFilterMinmaxProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkanMemoryModelFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2180,6 +4990,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkanMemoryM
     encoder->EncodeVkBool32Value(value.vulkanMemoryModelAvailabilityVisibilityChains);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkanMemoryModelFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImagelessFramebufferFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2187,6 +5009,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImagelessFram
     encoder->EncodeVkBool32Value(value.imagelessFramebuffer);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceImagelessFramebufferFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferAttachmentImageInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2200,6 +5032,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferAttachmentImageI
     encoder->EncodeEnumArray(value.pViewFormats, value.viewFormatCount);
 }
 
+size_t ComputeEncodedSize(const VkFramebufferAttachmentImageInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pViewFormats, value.viewFormatCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferAttachmentsCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2208,6 +5056,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferAttachmentsCreat
     EncodeStructArray(encoder, value.pAttachmentImageInfos, value.attachmentImageInfoCount);
 }
 
+size_t ComputeEncodedSize(const VkFramebufferAttachmentsCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pAttachmentImageInfos, value.attachmentImageInfoCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassAttachmentBeginInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2216,6 +5075,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassAttachmentBeginIn
     encoder->EncodeHandleArray(value.pAttachments, value.attachmentCount);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassAttachmentBeginInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pAttachments, value.attachmentCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2223,6 +5093,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceUniformBuffer
     encoder->EncodeVkBool32Value(value.uniformBufferStandardLayout);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2230,6 +5110,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSubgrou
     encoder->EncodeVkBool32Value(value.shaderSubgroupExtendedTypes);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2237,6 +5127,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSeparateDepth
     encoder->EncodeVkBool32Value(value.separateDepthStencilLayouts);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentReferenceStencilLayout& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2244,6 +5144,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentReferenceStencilL
     encoder->EncodeEnumValue(value.stencilLayout);
 }
 
+size_t ComputeEncodedSize(const VkAttachmentReferenceStencilLayout& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentDescriptionStencilLayout& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2252,6 +5162,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentDescriptionStenci
     encoder->EncodeEnumValue(value.stencilFinalLayout);
 }
 
+size_t ComputeEncodedSize(const VkAttachmentDescriptionStencilLayout& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceHostQueryResetFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2259,6 +5180,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceHostQueryRese
     encoder->EncodeVkBool32Value(value.hostQueryReset);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceHostQueryResetFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTimelineSemaphoreFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2266,6 +5197,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTimelineSemap
     encoder->EncodeVkBool32Value(value.timelineSemaphore);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTimelineSemaphoreFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTimelineSemaphoreProperties& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2273,6 +5214,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTimelineSemap
     encoder->EncodeUInt64Value(value.maxTimelineSemaphoreValueDifference);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTimelineSemaphoreProperties& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreTypeCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2281,6 +5232,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreTypeCreateInfo& va
     encoder->EncodeUInt64Value(value.initialValue);
 }
 
+size_t ComputeEncodedSize(const VkSemaphoreTypeCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkTimelineSemaphoreSubmitInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2291,6 +5253,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkTimelineSemaphoreSubmitInfo
     encoder->EncodeUInt64Array(value.pSignalSemaphoreValues, value.signalSemaphoreValueCount);
 }
 
+size_t ComputeEncodedSize(const VkTimelineSemaphoreSubmitInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Array(value.pWaitSemaphoreValues, value.waitSemaphoreValueCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Array(value.pSignalSemaphoreValues, value.signalSemaphoreValueCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreWaitInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2301,6 +5276,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreWaitInfo& value)
     encoder->EncodeUInt64Array(value.pValues, value.semaphoreCount);
 }
 
+size_t ComputeEncodedSize(const VkSemaphoreWaitInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pSemaphores, value.semaphoreCount);
+    size += ParameterEncodedSize::UInt64Array(value.pValues, value.semaphoreCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreSignalInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2309,6 +5297,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreSignalInfo& value)
     encoder->EncodeUInt64Value(value.value);
 }
 
+size_t ComputeEncodedSize(const VkSemaphoreSignalInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBufferDeviceAddressFeatures& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2318,6 +5317,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBufferDeviceA
     encoder->EncodeVkBool32Value(value.bufferDeviceAddressMultiDevice);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceBufferDeviceAddressFeatures& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferDeviceAddressInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2325,6 +5336,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferDeviceAddressInfo& va
     encoder->EncodeHandleValue(value.buffer);
 }
 
+size_t ComputeEncodedSize(const VkBufferDeviceAddressInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferOpaqueCaptureAddressCreateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2332,6 +5353,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferOpaqueCaptureAddressC
     encoder->EncodeUInt64Value(value.opaqueCaptureAddress);
 }
 
+size_t ComputeEncodedSize(const VkBufferOpaqueCaptureAddressCreateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryOpaqueCaptureAddressAllocateInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2339,6 +5370,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryOpaqueCaptureAddressA
     encoder->EncodeUInt64Value(value.opaqueCaptureAddress);
 }
 
+size_t ComputeEncodedSize(const VkMemoryOpaqueCaptureAddressAllocateInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryOpaqueCaptureAddressInfo& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2346,6 +5387,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryOpaqueCaptureAd
     encoder->EncodeHandleValue(value.memory);
 }
 
+size_t ComputeEncodedSize(const VkDeviceMemoryOpaqueCaptureAddressInfo& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR& value)
 {
     encoder->EncodeUInt32Value(value.minImageCount);
@@ -2360,12 +5411,40 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR& val
     encoder->EncodeFlagsValue(value.supportedUsageFlags);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceCapabilitiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.currentExtent);
+    size += ComputeEncodedSize(value.minImageExtent);
+    size += ComputeEncodedSize(value.maxImageExtent);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormatKHR& value)
 {
     encoder->EncodeEnumValue(value.format);
     encoder->EncodeEnumValue(value.colorSpace);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceFormatKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2388,6 +5467,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCreateInfoKHR& val
     encoder->EncodeHandleValue(value.oldSwapchain);
 }
 
+size_t ComputeEncodedSize(const VkSwapchainCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.imageExtent);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pQueueFamilyIndices, value.queueFamilyIndexCount);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2400,6 +5504,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPresentInfoKHR& value)
     encoder->EncodeEnumArray(value.pResults, value.swapchainCount);
 }
 
+size_t ComputeEncodedSize(const VkPresentInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pWaitSemaphores, value.waitSemaphoreCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pSwapchains, value.swapchainCount);
+    size += ParameterEncodedSize::UInt32Array(value.pImageIndices, value.swapchainCount);
+    size += ParameterEncodedSize::EnumArray(value.pResults, value.swapchainCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSwapchainCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2407,6 +5526,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageSwapchainCreateInfoKHR
     encoder->EncodeHandleValue(value.swapchain);
 }
 
+size_t ComputeEncodedSize(const VkImageSwapchainCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemorySwapchainInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2415,6 +5544,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemorySwapchainInf
     encoder->EncodeUInt32Value(value.imageIndex);
 }
 
+size_t ComputeEncodedSize(const VkBindImageMemorySwapchainInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAcquireNextImageInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2426,6 +5566,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAcquireNextImageInfoKHR& va
     encoder->EncodeUInt32Value(value.deviceMask);
 }
 
+size_t ComputeEncodedSize(const VkAcquireNextImageInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupPresentCapabilitiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2434,6 +5588,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupPresentCapabilit
     encoder->EncodeFlagsValue(value.modes);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupPresentCapabilitiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Array(value.presentMask, VK_MAX_DEVICE_GROUP_SIZE);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupPresentInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2443,6 +5608,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupPresentInfoKHR&
     encoder->EncodeEnumValue(value.mode);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupPresentInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pDeviceMasks, value.swapchainCount);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupSwapchainCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2450,12 +5627,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupSwapchainCreateI
     encoder->EncodeFlagsValue(value.modes);
 }
 
+size_t ComputeEncodedSize(const VkDeviceGroupSwapchainCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeParametersKHR& value)
 {
     EncodeStruct(encoder, value.visibleRegion);
     encoder->EncodeUInt32Value(value.refreshRate);
 }
 
+size_t ComputeEncodedSize(const VkDisplayModeParametersKHR& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.visibleRegion);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2464,12 +5660,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeCreateInfoKHR& v
     EncodeStruct(encoder, value.parameters);
 }
 
+size_t ComputeEncodedSize(const VkDisplayModeCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.parameters);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModePropertiesKHR& value)
 {
     encoder->EncodeHandleValue(value.displayMode);
     EncodeStruct(encoder, value.parameters);
 }
 
+size_t ComputeEncodedSize(const VkDisplayModePropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ComputeEncodedSize(value.parameters);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneCapabilitiesKHR& value)
 {
     encoder->EncodeFlagsValue(value.supportedAlpha);
@@ -2483,12 +5699,39 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneCapabilitiesKHR
     EncodeStruct(encoder, value.maxDstExtent);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPlaneCapabilitiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.minSrcPosition);
+    size += ComputeEncodedSize(value.maxSrcPosition);
+    size += ComputeEncodedSize(value.minSrcExtent);
+    size += ComputeEncodedSize(value.maxSrcExtent);
+    size += ComputeEncodedSize(value.minDstPosition);
+    size += ComputeEncodedSize(value.maxDstPosition);
+    size += ComputeEncodedSize(value.minDstExtent);
+    size += ComputeEncodedSize(value.maxDstExtent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlanePropertiesKHR& value)
 {
     encoder->EncodeHandleValue(value.currentDisplay);
     encoder->EncodeUInt32Value(value.currentStackIndex);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPlanePropertiesKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPropertiesKHR& value)
 {
     encoder->EncodeHandleValue(value.display);
@@ -2500,6 +5743,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPropertiesKHR& value
     encoder->EncodeVkBool32Value(value.persistentContent);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::String(value.displayName);
+    size += ComputeEncodedSize(value.physicalDimensions);
+    size += ComputeEncodedSize(value.physicalResolution);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplaySurfaceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2514,6 +5771,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplaySurfaceCreateInfoKHR
     EncodeStruct(encoder, value.imageExtent);
 }
 
+size_t ComputeEncodedSize(const VkDisplaySurfaceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.imageExtent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPresentInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2523,6 +5797,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPresentInfoKHR& valu
     encoder->EncodeVkBool32Value(value.persistent);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPresentInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.srcRect);
+    size += ComputeEncodedSize(value.dstRect);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkXlibSurfaceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2532,6 +5818,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkXlibSurfaceCreateInfoKHR& v
     encoder->EncodeSizeTValue(value.window);
 }
 
+size_t ComputeEncodedSize(const VkXlibSurfaceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::SizeTValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkXcbSurfaceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2541,6 +5839,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkXcbSurfaceCreateInfoKHR& va
     encoder->EncodeUInt32Value(value.window);
 }
 
+size_t ComputeEncodedSize(const VkXcbSurfaceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWaylandSurfaceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2550,6 +5860,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWaylandSurfaceCreateInfoKHR
     encoder->EncodeVoidPtr(value.surface);
 }
 
+size_t ComputeEncodedSize(const VkWaylandSurfaceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidSurfaceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2558,6 +5880,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAndroidSurfaceCreateInfoKHR
     encoder->EncodeVoidPtr(value.window);
 }
 
+size_t ComputeEncodedSize(const VkAndroidSurfaceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWin32SurfaceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2567,6 +5900,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWin32SurfaceCreateInfoKHR&
     encoder->EncodeVoidPtr(value.hwnd);
 }
 
+size_t ComputeEncodedSize(const VkWin32SurfaceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2576,6 +5921,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryWin32HandleInfo
     encoder->EncodeWString(value.name);
 }
 
+size_t ComputeEncodedSize(const VkImportMemoryWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::WString(value.name);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2585,13 +5942,35 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryWin32HandleInfo
     encoder->EncodeWString(value.name);
 }
 
-void EncodeStruct(ParameterEncoder* encoder, const VkMemoryWin32HandlePropertiesKHR& value)
+size_t ComputeEncodedSize(const VkExportMemoryWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeStructPtrEncodedSize(value.pAttributes);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::WString(value.name);
+
+    return size;
+}
+
+void EncodeStruct(ParameterEncoder* encoder, const VkMemoryWin32HandlePropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
     EncodePNextStruct(encoder, value.pNext);
     encoder->EncodeUInt32Value(value.memoryTypeBits);
 }
 
+size_t ComputeEncodedSize(const VkMemoryWin32HandlePropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2600,6 +5979,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetWin32HandleInfoKHR
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkMemoryGetWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryFdInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2608,6 +5998,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryFdInfoKHR& valu
     encoder->EncodeInt32Value(value.fd);
 }
 
+size_t ComputeEncodedSize(const VkImportMemoryFdInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryFdPropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2615,6 +6016,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryFdPropertiesKHR& valu
     encoder->EncodeUInt32Value(value.memoryTypeBits);
 }
 
+size_t ComputeEncodedSize(const VkMemoryFdPropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetFdInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2623,6 +6034,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetFdInfoKHR& value)
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkMemoryGetFdInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWin32KeyedMutexAcquireReleaseInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2636,6 +6058,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWin32KeyedMutexAcquireRelea
     encoder->EncodeUInt64Array(value.pReleaseKeys, value.releaseCount);
 }
 
+size_t ComputeEncodedSize(const VkWin32KeyedMutexAcquireReleaseInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pAcquireSyncs, value.acquireCount);
+    size += ParameterEncodedSize::UInt64Array(value.pAcquireKeys, value.acquireCount);
+    size += ParameterEncodedSize::UInt32Array(value.pAcquireTimeouts, value.acquireCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pReleaseSyncs, value.releaseCount);
+    size += ParameterEncodedSize::UInt64Array(value.pReleaseKeys, value.releaseCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportSemaphoreWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2647,6 +6085,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportSemaphoreWin32HandleI
     encoder->EncodeWString(value.name);
 }
 
+size_t ComputeEncodedSize(const VkImportSemaphoreWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::WString(value.name);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportSemaphoreWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2656,6 +6108,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportSemaphoreWin32HandleI
     encoder->EncodeWString(value.name);
 }
 
+size_t ComputeEncodedSize(const VkExportSemaphoreWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeStructPtrEncodedSize(value.pAttributes);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::WString(value.name);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkD3D12FenceSubmitInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2666,6 +6130,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkD3D12FenceSubmitInfoKHR& va
     encoder->EncodeUInt64Array(value.pSignalSemaphoreValues, value.signalSemaphoreValuesCount);
 }
 
+size_t ComputeEncodedSize(const VkD3D12FenceSubmitInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Array(value.pWaitSemaphoreValues, value.waitSemaphoreValuesCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Array(value.pSignalSemaphoreValues, value.signalSemaphoreValuesCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreGetWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2674,6 +6151,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreGetWin32HandleInfo
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkSemaphoreGetWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportSemaphoreFdInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2684,6 +6172,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportSemaphoreFdInfoKHR& v
     encoder->EncodeInt32Value(value.fd);
 }
 
+size_t ComputeEncodedSize(const VkImportSemaphoreFdInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreGetFdInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2692,6 +6193,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreGetFdInfoKHR& valu
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkSemaphoreGetFdInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePushDescriptorPropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2699,6 +6211,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePushDescripto
     encoder->EncodeUInt32Value(value.maxPushDescriptors);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePushDescriptorPropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRectLayerKHR& value)
 {
     EncodeStruct(encoder, value.offset);
@@ -2706,12 +6228,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRectLayerKHR& value)
     encoder->EncodeUInt32Value(value.layer);
 }
 
+size_t ComputeEncodedSize(const VkRectLayerKHR& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.offset);
+    size += ComputeEncodedSize(value.extent);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionKHR& value)
 {
     encoder->EncodeUInt32Value(value.rectangleCount);
     EncodeStructArray(encoder, value.pRectangles, value.rectangleCount);
 }
 
+size_t ComputeEncodedSize(const VkPresentRegionKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRectangles, value.rectangleCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionsKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2720,6 +6261,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionsKHR& value)
     EncodeStructArray(encoder, value.pRegions, value.swapchainCount);
 }
 
+size_t ComputeEncodedSize(const VkPresentRegionsKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRegions, value.swapchainCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSharedPresentSurfaceCapabilitiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2727,6 +6279,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSharedPresentSurfaceCapabil
     encoder->EncodeFlagsValue(value.sharedPresentSupportedUsageFlags);
 }
 
+size_t ComputeEncodedSize(const VkSharedPresentSurfaceCapabilitiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2738,6 +6300,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceWin32HandleInfoK
     encoder->EncodeWString(value.name);
 }
 
+size_t ComputeEncodedSize(const VkImportFenceWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::WString(value.name);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportFenceWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2747,6 +6323,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportFenceWin32HandleInfoK
     encoder->EncodeWString(value.name);
 }
 
+size_t ComputeEncodedSize(const VkExportFenceWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeStructPtrEncodedSize(value.pAttributes);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::WString(value.name);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFenceGetWin32HandleInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2755,6 +6343,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFenceGetWin32HandleInfoKHR&
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkFenceGetWin32HandleInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceFdInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2765,6 +6364,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceFdInfoKHR& value
     encoder->EncodeInt32Value(value.fd);
 }
 
+size_t ComputeEncodedSize(const VkImportFenceFdInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFenceGetFdInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2773,6 +6385,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFenceGetFdInfoKHR& value)
     encoder->EncodeEnumValue(value.handleType);
 }
 
+size_t ComputeEncodedSize(const VkFenceGetFdInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePerformanceQueryFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2781,6 +6404,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePerformanceQu
     encoder->EncodeVkBool32Value(value.performanceCounterMultipleQueryPools);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePerformanceQueryFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePerformanceQueryPropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2788,6 +6422,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePerformanceQu
     encoder->EncodeVkBool32Value(value.allowCommandBufferQueryCopies);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePerformanceQueryPropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceCounterKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2798,6 +6442,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceCounterKHR& valu
     encoder->EncodeUInt8Array(value.uuid, VK_UUID_SIZE);
 }
 
+size_t ComputeEncodedSize(const VkPerformanceCounterKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt8Array(value.uuid, VK_UUID_SIZE);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceCounterDescriptionKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2808,6 +6465,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceCounterDescripti
     encoder->EncodeString(value.description);
 }
 
+size_t ComputeEncodedSize(const VkPerformanceCounterDescriptionKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::String(value.name);
+    size += ParameterEncodedSize::String(value.category);
+    size += ParameterEncodedSize::String(value.description);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolPerformanceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2817,6 +6487,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolPerformanceCreateI
     encoder->EncodeUInt32Array(value.pCounterIndices, value.counterIndexCount);
 }
 
+size_t ComputeEncodedSize(const VkQueryPoolPerformanceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pCounterIndices, value.counterIndexCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAcquireProfilingLockInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2825,6 +6507,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAcquireProfilingLockInfoKHR
     encoder->EncodeUInt64Value(value.timeout);
 }
 
+size_t ComputeEncodedSize(const VkAcquireProfilingLockInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceQuerySubmitInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2832,6 +6525,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceQuerySubmitInfoK
     encoder->EncodeUInt32Value(value.counterPassIndex);
 }
 
+size_t ComputeEncodedSize(const VkPerformanceQuerySubmitInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSurfaceInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2839,6 +6542,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSurfaceInfo2K
     encoder->EncodeHandleValue(value.surface);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSurfaceInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2846,6 +6559,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2KHR& va
     EncodeStruct(encoder, value.surfaceCapabilities);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceCapabilities2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.surfaceCapabilities);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormat2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2853,6 +6576,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormat2KHR& value)
     EncodeStruct(encoder, value.surfaceFormat);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceFormat2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.surfaceFormat);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayProperties2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2860,6 +6593,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayProperties2KHR& valu
     EncodeStruct(encoder, value.displayProperties);
 }
 
+size_t ComputeEncodedSize(const VkDisplayProperties2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.displayProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneProperties2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2867,6 +6610,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneProperties2KHR&
     EncodeStruct(encoder, value.displayPlaneProperties);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPlaneProperties2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.displayPlaneProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeProperties2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2874,6 +6627,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeProperties2KHR&
     EncodeStruct(encoder, value.displayModeProperties);
 }
 
+size_t ComputeEncodedSize(const VkDisplayModeProperties2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.displayModeProperties);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2882,6 +6645,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneInfo2KHR& value
     encoder->EncodeUInt32Value(value.planeIndex);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPlaneInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneCapabilities2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2889,6 +6663,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneCapabilities2KH
     EncodeStruct(encoder, value.capabilities);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPlaneCapabilities2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.capabilities);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePortabilitySubsetFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2910,6 +6694,30 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePortabilitySu
     encoder->EncodeVkBool32Value(value.vertexAttributeAccessBeyondStride);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePortabilitySubsetFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePortabilitySubsetPropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2917,6 +6725,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePortabilitySu
     encoder->EncodeUInt32Value(value.minVertexInputBindingStrideAlignment);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePortabilitySubsetPropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderClockFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2925,6 +6743,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderClockFe
     encoder->EncodeVkBool32Value(value.shaderDeviceClock);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderClockFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2932,6 +6761,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderTermina
     encoder->EncodeVkBool32Value(value.shaderTerminateInvocation);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFragmentShadingRateAttachmentInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2940,6 +6779,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFragmentShadingRateAttachme
     EncodeStruct(encoder, value.shadingRateAttachmentTexelSize);
 }
 
+size_t ComputeEncodedSize(const VkFragmentShadingRateAttachmentInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeStructPtrEncodedSize(value.pFragmentShadingRateAttachment);
+    size += ComputeEncodedSize(value.shadingRateAttachmentTexelSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineFragmentShadingRateStateCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2948,6 +6798,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineFragmentShadingRate
     encoder->EncodeEnumArray(value.combinerOps, 2);
 }
 
+size_t ComputeEncodedSize(const VkPipelineFragmentShadingRateStateCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.fragmentSize);
+    size += ParameterEncodedSize::EnumArray(value.combinerOps, 2);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2957,6 +6818,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadi
     encoder->EncodeVkBool32Value(value.attachmentFragmentShadingRate);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2980,6 +6853,32 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadi
     encoder->EncodeVkBool32Value(value.fragmentShadingRateStrictMultiplyCombiner);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.minFragmentShadingRateAttachmentTexelSize);
+    size += ComputeEncodedSize(value.maxFragmentShadingRateAttachmentTexelSize);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ComputeEncodedSize(value.maxFragmentSize);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2988,6 +6887,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadi
     EncodeStruct(encoder, value.fragmentSize);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.fragmentSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceProtectedCapabilitiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -2995,6 +6905,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceProtectedCapabilitie
     encoder->EncodeVkBool32Value(value.supportsProtected);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceProtectedCapabilitiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3002,6 +6922,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePipelineExecu
     encoder->EncodeVkBool32Value(value.pipelineExecutableInfo);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3009,6 +6939,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineInfoKHR& value)
     encoder->EncodeHandleValue(value.pipeline);
 }
 
+size_t ComputeEncodedSize(const VkPipelineInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutablePropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3019,6 +6959,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutablePropertie
     encoder->EncodeUInt32Value(value.subgroupSize);
 }
 
+size_t ComputeEncodedSize(const VkPipelineExecutablePropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::String(value.name);
+    size += ParameterEncodedSize::String(value.description);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3027,6 +6980,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableInfoKHR&
     encoder->EncodeUInt32Value(value.executableIndex);
 }
 
+size_t ComputeEncodedSize(const VkPipelineExecutableInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableStatisticKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3037,6 +7001,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableStatistic
     EncodeStruct(encoder, value.value);
 }
 
+size_t ComputeEncodedSize(const VkPipelineExecutableStatisticKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::String(value.name);
+    size += ParameterEncodedSize::String(value.description);
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.value);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableInternalRepresentationKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3048,6 +7025,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableInternalR
     encoder->EncodeVoidArray(value.pData, value.dataSize);
 }
 
+size_t ComputeEncodedSize(const VkPipelineExecutableInternalRepresentationKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::String(value.name);
+    size += ParameterEncodedSize::String(value.description);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::VoidArray(value.pData, value.dataSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineLibraryCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3056,6 +7047,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineLibraryCreateInfoKH
     encoder->EncodeHandleArray(value.pLibraries, value.libraryCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineLibraryCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pLibraries, value.libraryCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferCopy2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3065,6 +7067,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferCopy2KHR& value)
     encoder->EncodeVkDeviceSizeValue(value.size);
 }
 
+size_t ComputeEncodedSize(const VkBufferCopy2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyBufferInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3075,6 +7089,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyBufferInfo2KHR& value)
     EncodeStructArray(encoder, value.pRegions, value.regionCount);
 }
 
+size_t ComputeEncodedSize(const VkCopyBufferInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRegions, value.regionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3086,6 +7113,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy2KHR& value)
     EncodeStruct(encoder, value.extent);
 }
 
+size_t ComputeEncodedSize(const VkImageCopy2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.srcSubresource);
+    size += ComputeEncodedSize(value.srcOffset);
+    size += ComputeEncodedSize(value.dstSubresource);
+    size += ComputeEncodedSize(value.dstOffset);
+    size += ComputeEncodedSize(value.extent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyImageInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3098,6 +7139,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyImageInfo2KHR& value)
     EncodeStructArray(encoder, value.pRegions, value.regionCount);
 }
 
+size_t ComputeEncodedSize(const VkCopyImageInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRegions, value.regionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferImageCopy2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3110,6 +7166,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferImageCopy2KHR& value)
     EncodeStruct(encoder, value.imageExtent);
 }
 
+size_t ComputeEncodedSize(const VkBufferImageCopy2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.imageSubresource);
+    size += ComputeEncodedSize(value.imageOffset);
+    size += ComputeEncodedSize(value.imageExtent);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyBufferToImageInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3121,6 +7192,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyBufferToImageInfo2KHR&
     EncodeStructArray(encoder, value.pRegions, value.regionCount);
 }
 
+size_t ComputeEncodedSize(const VkCopyBufferToImageInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRegions, value.regionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyImageToBufferInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3132,6 +7217,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyImageToBufferInfo2KHR&
     EncodeStructArray(encoder, value.pRegions, value.regionCount);
 }
 
+size_t ComputeEncodedSize(const VkCopyImageToBufferInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRegions, value.regionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageBlit2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3142,6 +7241,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageBlit2KHR& value)
     EncodeStructArray(encoder, value.dstOffsets, 2);
 }
 
+size_t ComputeEncodedSize(const VkImageBlit2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.srcSubresource);
+    size += ComputeStructArrayEncodedSize(value.srcOffsets, 2);
+    size += ComputeEncodedSize(value.dstSubresource);
+    size += ComputeStructArrayEncodedSize(value.dstOffsets, 2);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBlitImageInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3155,6 +7267,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBlitImageInfo2KHR& value)
     encoder->EncodeEnumValue(value.filter);
 }
 
+size_t ComputeEncodedSize(const VkBlitImageInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRegions, value.regionCount);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3166,7 +7294,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve2KHR& value)
     EncodeStruct(encoder, value.extent);
 }
 
-void EncodeStruct(ParameterEncoder* encoder, const VkResolveImageInfo2KHR& value)
+size_t ComputeEncodedSize(const VkImageResolve2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.srcSubresource);
+    size += ComputeEncodedSize(value.srcOffset);
+    size += ComputeEncodedSize(value.dstSubresource);
+    size += ComputeEncodedSize(value.dstOffset);
+    size += ComputeEncodedSize(value.extent);
+
+    return size;
+}
+
+void EncodeStruct(ParameterEncoder* encoder, const VkResolveImageInfo2KHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
     EncodePNextStruct(encoder, value.pNext);
@@ -3178,6 +7320,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkResolveImageInfo2KHR& value
     EncodeStructArray(encoder, value.pRegions, value.regionCount);
 }
 
+size_t ComputeEncodedSize(const VkResolveImageInfo2KHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pRegions, value.regionCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugReportCallbackCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3187,6 +7344,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugReportCallbackCreateIn
     encoder->EncodeVoidPtr(value.pUserData);
 }
 
+size_t ComputeEncodedSize(const VkDebugReportCallbackCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FunctionPtr();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateRasterizationOrderAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3194,6 +7363,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateR
     encoder->EncodeEnumValue(value.rasterizationOrder);
 }
 
+size_t ComputeEncodedSize(const VkPipelineRasterizationStateRasterizationOrderAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerObjectNameInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3203,6 +7382,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerObjectNameInfoEX
     encoder->EncodeString(value.pObjectName);
 }
 
+size_t ComputeEncodedSize(const VkDebugMarkerObjectNameInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::String(value.pObjectName);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerObjectTagInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3214,6 +7405,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerObjectTagInfoEXT
     encoder->EncodeVoidArray(value.pTag, value.tagSize);
 }
 
+size_t ComputeEncodedSize(const VkDebugMarkerObjectTagInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::VoidArray(value.pTag, value.tagSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerMarkerInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3222,6 +7427,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerMarkerInfoEXT& v
     encoder->EncodeFloatArray(value.color, 4);
 }
 
+size_t ComputeEncodedSize(const VkDebugMarkerMarkerInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::String(value.pMarkerName);
+    size += ParameterEncodedSize::FloatArray(value.color, 4);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationImageCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3229,6 +7445,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationImageCre
     encoder->EncodeVkBool32Value(value.dedicatedAllocation);
 }
 
+size_t ComputeEncodedSize(const VkDedicatedAllocationImageCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationBufferCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3236,6 +7462,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationBufferCr
     encoder->EncodeVkBool32Value(value.dedicatedAllocation);
 }
 
+size_t ComputeEncodedSize(const VkDedicatedAllocationBufferCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationMemoryAllocateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3244,6 +7480,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationMemoryAl
     encoder->EncodeHandleValue(value.buffer);
 }
 
+size_t ComputeEncodedSize(const VkDedicatedAllocationMemoryAllocateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTransformFeedbackFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3252,6 +7499,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTransformFeed
     encoder->EncodeVkBool32Value(value.geometryStreams);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTransformFeedbackFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTransformFeedbackPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3268,6 +7526,25 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTransformFeed
     encoder->EncodeVkBool32Value(value.transformFeedbackDraw);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTransformFeedbackPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateStreamCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3276,6 +7553,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateS
     encoder->EncodeUInt32Value(value.rasterizationStream);
 }
 
+size_t ComputeEncodedSize(const VkPipelineRasterizationStateStreamCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewHandleInfoNVX& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3285,6 +7573,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageViewHandleInfoNVX& val
     encoder->EncodeHandleValue(value.sampler);
 }
 
+size_t ComputeEncodedSize(const VkImageViewHandleInfoNVX& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewAddressPropertiesNVX& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3293,6 +7593,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageViewAddressPropertiesN
     encoder->EncodeVkDeviceSizeValue(value.size);
 }
 
+size_t ComputeEncodedSize(const VkImageViewAddressPropertiesNVX& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceAddressValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkTextureLODGatherFormatPropertiesAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3300,6 +7611,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkTextureLODGatherFormatPrope
     encoder->EncodeVkBool32Value(value.supportsTextureGatherLODBiasAMD);
 }
 
+size_t ComputeEncodedSize(const VkTextureLODGatherFormatPropertiesAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderResourceUsageAMD& value)
 {
     encoder->EncodeUInt32Value(value.numUsedVgprs);
@@ -3309,6 +7630,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkShaderResourceUsageAMD& val
     encoder->EncodeSizeTValue(value.scratchMemUsageInBytes);
 }
 
+size_t ComputeEncodedSize(const VkShaderResourceUsageAMD& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::SizeTValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderStatisticsInfoAMD& value)
 {
     encoder->EncodeFlagsValue(value.shaderStageMask);
@@ -3320,6 +7655,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkShaderStatisticsInfoAMD& va
     encoder->EncodeUInt32Array(value.computeWorkGroupSize, 3);
 }
 
+size_t ComputeEncodedSize(const VkShaderStatisticsInfoAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.resourceUsage);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.computeWorkGroupSize, 3);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkStreamDescriptorSurfaceCreateInfoGGP& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3328,6 +7677,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkStreamDescriptorSurfaceCrea
     encoder->EncodeUInt64Value(value.streamDescriptor);
 }
 
+size_t ComputeEncodedSize(const VkStreamDescriptorSurfaceCreateInfoGGP& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCornerSampledImageFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3335,6 +7695,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCornerSampled
     encoder->EncodeVkBool32Value(value.cornerSampledImage);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCornerSampledImageFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalImageFormatPropertiesNV& value)
 {
     EncodeStruct(encoder, value.imageFormatProperties);
@@ -3343,6 +7713,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalImageFormatProperti
     encoder->EncodeFlagsValue(value.compatibleHandleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExternalImageFormatPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.imageFormatProperties);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryImageCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3350,6 +7731,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryImageCreateIn
     encoder->EncodeFlagsValue(value.handleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExternalMemoryImageCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryAllocateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3357,6 +7748,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryAllocateInfoNV&
     encoder->EncodeFlagsValue(value.handleTypes);
 }
 
+size_t ComputeEncodedSize(const VkExportMemoryAllocateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryWin32HandleInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3365,6 +7766,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryWin32HandleInfo
     encoder->EncodeVoidPtr(value.handle);
 }
 
+size_t ComputeEncodedSize(const VkImportMemoryWin32HandleInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryWin32HandleInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3373,6 +7785,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryWin32HandleInfo
     encoder->EncodeUInt32Value(value.dwAccess);
 }
 
+size_t ComputeEncodedSize(const VkExportMemoryWin32HandleInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeStructPtrEncodedSize(value.pAttributes);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWin32KeyedMutexAcquireReleaseInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3386,6 +7809,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWin32KeyedMutexAcquireRelea
     encoder->EncodeUInt64Array(value.pReleaseKeys, value.releaseCount);
 }
 
+size_t ComputeEncodedSize(const VkWin32KeyedMutexAcquireReleaseInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pAcquireSyncs, value.acquireCount);
+    size += ParameterEncodedSize::UInt64Array(value.pAcquireKeys, value.acquireCount);
+    size += ParameterEncodedSize::UInt32Array(value.pAcquireTimeoutMilliseconds, value.acquireCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pReleaseSyncs, value.releaseCount);
+    size += ParameterEncodedSize::UInt64Array(value.pReleaseKeys, value.releaseCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationFlagsEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3394,6 +7833,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkValidationFlagsEXT& value)
     encoder->EncodeEnumArray(value.pDisabledValidationChecks, value.disabledValidationCheckCount);
 }
 
+size_t ComputeEncodedSize(const VkValidationFlagsEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pDisabledValidationChecks, value.disabledValidationCheckCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkViSurfaceCreateInfoNN& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3402,6 +7852,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkViSurfaceCreateInfoNN& valu
     encoder->EncodeVoidPtr(value.window);
 }
 
+size_t ComputeEncodedSize(const VkViSurfaceCreateInfoNN& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3409,6 +7870,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTextureCompre
     encoder->EncodeVkBool32Value(value.textureCompressionASTC_HDR);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewASTCDecodeModeEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3416,6 +7887,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageViewASTCDecodeModeEXT&
     encoder->EncodeEnumValue(value.decodeMode);
 }
 
+size_t ComputeEncodedSize(const VkImageViewASTCDecodeModeEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceASTCDecodeFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3423,6 +7904,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceASTCDecodeFea
     encoder->EncodeVkBool32Value(value.decodeModeSharedExponent);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceASTCDecodeFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkConditionalRenderingBeginInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3432,6 +7923,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkConditionalRenderingBeginIn
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkConditionalRenderingBeginInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceConditionalRenderingFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3440,6 +7943,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceConditionalRe
     encoder->EncodeVkBool32Value(value.inheritedConditionalRendering);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceConditionalRenderingFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceConditionalRenderingInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3447,12 +7961,33 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceCon
     encoder->EncodeVkBool32Value(value.conditionalRenderingEnable);
 }
 
+size_t ComputeEncodedSize(const VkCommandBufferInheritanceConditionalRenderingInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportWScalingNV& value)
 {
     encoder->EncodeFloatValue(value.xcoeff);
     encoder->EncodeFloatValue(value.ycoeff);
 }
 
+size_t ComputeEncodedSize(const VkViewportWScalingNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportWScalingStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3462,6 +7997,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportWScalingSta
     EncodeStructArray(encoder, value.pViewportWScalings, value.viewportCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineViewportWScalingStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pViewportWScalings, value.viewportCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2EXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3479,6 +8026,26 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2EXT& va
     encoder->EncodeFlagsValue(value.supportedSurfaceCounters);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceCapabilities2EXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.currentExtent);
+    size += ComputeEncodedSize(value.minImageExtent);
+    size += ComputeEncodedSize(value.maxImageExtent);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPowerInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3486,6 +8053,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPowerInfoEXT& value)
     encoder->EncodeEnumValue(value.powerState);
 }
 
+size_t ComputeEncodedSize(const VkDisplayPowerInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceEventInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3493,6 +8070,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceEventInfoEXT& value)
     encoder->EncodeEnumValue(value.deviceEvent);
 }
 
+size_t ComputeEncodedSize(const VkDeviceEventInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayEventInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3500,6 +8087,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayEventInfoEXT& value)
     encoder->EncodeEnumValue(value.displayEvent);
 }
 
+size_t ComputeEncodedSize(const VkDisplayEventInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCounterCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3507,11 +8104,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCounterCreateInfoE
     encoder->EncodeFlagsValue(value.surfaceCounters);
 }
 
+size_t ComputeEncodedSize(const VkSwapchainCounterCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRefreshCycleDurationGOOGLE& value)
 {
     encoder->EncodeUInt64Value(value.refreshDuration);
 }
 
+size_t ComputeEncodedSize(const VkRefreshCycleDurationGOOGLE& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPastPresentationTimingGOOGLE& value)
 {
     encoder->EncodeUInt32Value(value.presentID);
@@ -3521,12 +8138,37 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPastPresentationTimingGOOGL
     encoder->EncodeUInt64Value(value.presentMargin);
 }
 
+size_t ComputeEncodedSize(const VkPastPresentationTimingGOOGLE& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimeGOOGLE& value)
 {
     encoder->EncodeUInt32Value(value.presentID);
     encoder->EncodeUInt64Value(value.desiredPresentTime);
 }
 
+size_t ComputeEncodedSize(const VkPresentTimeGOOGLE& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimesInfoGOOGLE& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3535,6 +8177,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimesInfoGOOGLE& val
     EncodeStructArray(encoder, value.pTimes, value.swapchainCount);
 }
 
+size_t ComputeEncodedSize(const VkPresentTimesInfoGOOGLE& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pTimes, value.swapchainCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3542,6 +8195,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewPerV
     encoder->EncodeVkBool32Value(value.perViewPositionAllComponents);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportSwizzleNV& value)
 {
     encoder->EncodeEnumValue(value.x);
@@ -3550,6 +8213,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkViewportSwizzleNV& value)
     encoder->EncodeEnumValue(value.w);
 }
 
+size_t ComputeEncodedSize(const VkViewportSwizzleNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportSwizzleStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3559,6 +8235,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportSwizzleStat
     EncodeStructArray(encoder, value.pViewportSwizzles, value.viewportCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineViewportSwizzleStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pViewportSwizzles, value.viewportCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiscardRectanglePropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3566,6 +8254,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiscardRectan
     encoder->EncodeUInt32Value(value.maxDiscardRectangles);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDiscardRectanglePropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDiscardRectangleStateCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3576,6 +8274,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDiscardRectangleSta
     EncodeStructArray(encoder, value.pDiscardRectangles, value.discardRectangleCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineDiscardRectangleStateCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pDiscardRectangles, value.discardRectangleCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3591,6 +8302,24 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceConservativeR
     encoder->EncodeVkBool32Value(value.conservativeRasterizationPostDepthCoverage);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationConservativeStateCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3600,6 +8329,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationConser
     encoder->EncodeFloatValue(value.extraPrimitiveOverestimationSize);
 }
 
+size_t ComputeEncodedSize(const VkPipelineRasterizationConservativeStateCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDepthClipEnableFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3607,6 +8348,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDepthClipEnab
     encoder->EncodeVkBool32Value(value.depthClipEnable);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDepthClipEnableFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationDepthClipStateCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3615,12 +8366,34 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationDepthC
     encoder->EncodeVkBool32Value(value.depthClipEnable);
 }
 
+size_t ComputeEncodedSize(const VkPipelineRasterizationDepthClipStateCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkXYColorEXT& value)
 {
     encoder->EncodeFloatValue(value.x);
     encoder->EncodeFloatValue(value.y);
 }
 
+size_t ComputeEncodedSize(const VkXYColorEXT& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkHdrMetadataEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3635,6 +8408,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkHdrMetadataEXT& value)
     encoder->EncodeFloatValue(value.maxFrameAverageLightLevel);
 }
 
+size_t ComputeEncodedSize(const VkHdrMetadataEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.displayPrimaryRed);
+    size += ComputeEncodedSize(value.displayPrimaryGreen);
+    size += ComputeEncodedSize(value.displayPrimaryBlue);
+    size += ComputeEncodedSize(value.whitePoint);
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkIOSSurfaceCreateInfoMVK& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3643,6 +8433,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkIOSSurfaceCreateInfoMVK& va
     encoder->EncodeVoidPtr(value.pView);
 }
 
+size_t ComputeEncodedSize(const VkIOSSurfaceCreateInfoMVK& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMacOSSurfaceCreateInfoMVK& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3651,6 +8452,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMacOSSurfaceCreateInfoMVK&
     encoder->EncodeVoidPtr(value.pView);
 }
 
+size_t ComputeEncodedSize(const VkMacOSSurfaceCreateInfoMVK& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsLabelEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3659,6 +8471,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsLabelEXT& value)
     encoder->EncodeFloatArray(value.color, 4);
 }
 
+size_t ComputeEncodedSize(const VkDebugUtilsLabelEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::String(value.pLabelName);
+    size += ParameterEncodedSize::FloatArray(value.color, 4);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsObjectNameInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3668,6 +8491,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsObjectNameInfoEXT
     encoder->EncodeString(value.pObjectName);
 }
 
+size_t ComputeEncodedSize(const VkDebugUtilsObjectNameInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::String(value.pObjectName);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsMessengerCallbackDataEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3684,6 +8519,25 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsMessengerCallback
     EncodeStructArray(encoder, value.pObjects, value.objectCount);
 }
 
+size_t ComputeEncodedSize(const VkDebugUtilsMessengerCallbackDataEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::String(value.pMessageIdName);
+    size += ParameterEncodedSize::Int32Value();
+    size += ParameterEncodedSize::String(value.pMessage);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pQueueLabels, value.queueLabelCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pCmdBufLabels, value.cmdBufLabelCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pObjects, value.objectCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsMessengerCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3695,6 +8549,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsMessengerCreateIn
     encoder->EncodeVoidPtr(value.pUserData);
 }
 
+size_t ComputeEncodedSize(const VkDebugUtilsMessengerCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FunctionPtr();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsObjectTagInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3706,6 +8574,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsObjectTagInfoEXT&
     encoder->EncodeVoidArray(value.pTag, value.tagSize);
 }
 
+size_t ComputeEncodedSize(const VkDebugUtilsObjectTagInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::VoidArray(value.pTag, value.tagSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferUsageANDROID& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3713,6 +8595,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferUsageA
     encoder->EncodeUInt64Value(value.androidHardwareBufferUsage);
 }
 
+size_t ComputeEncodedSize(const VkAndroidHardwareBufferUsageANDROID& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferPropertiesANDROID& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3721,6 +8613,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferProper
     encoder->EncodeUInt32Value(value.memoryTypeBits);
 }
 
+size_t ComputeEncodedSize(const VkAndroidHardwareBufferPropertiesANDROID& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferFormatPropertiesANDROID& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3735,6 +8638,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferFormat
     encoder->EncodeEnumValue(value.suggestedYChromaOffset);
 }
 
+size_t ComputeEncodedSize(const VkAndroidHardwareBufferFormatPropertiesANDROID& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.samplerYcbcrConversionComponents);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportAndroidHardwareBufferInfoANDROID& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3742,6 +8662,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportAndroidHardwareBuffer
     encoder->EncodeVoidPtr(value.buffer);
 }
 
+size_t ComputeEncodedSize(const VkImportAndroidHardwareBufferInfoANDROID& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetAndroidHardwareBufferInfoANDROID& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3749,6 +8679,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetAndroidHardwareBuf
     encoder->EncodeHandleValue(value.memory);
 }
 
+size_t ComputeEncodedSize(const VkMemoryGetAndroidHardwareBufferInfoANDROID& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalFormatANDROID& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3756,6 +8696,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkExternalFormatANDROID& valu
     encoder->EncodeUInt64Value(value.externalFormat);
 }
 
+size_t ComputeEncodedSize(const VkExternalFormatANDROID& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInlineUniformBlockFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3764,6 +8714,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInlineUniform
     encoder->EncodeVkBool32Value(value.descriptorBindingInlineUniformBlockUpdateAfterBind);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceInlineUniformBlockFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInlineUniformBlockPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3775,6 +8736,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInlineUniform
     encoder->EncodeUInt32Value(value.maxDescriptorSetUpdateAfterBindInlineUniformBlocks);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceInlineUniformBlockPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSetInlineUniformBlockEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3783,6 +8758,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSetInlineUni
     encoder->EncodeVoidArray(value.pData, value.dataSize);
 }
 
+size_t ComputeEncodedSize(const VkWriteDescriptorSetInlineUniformBlockEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VoidArray(value.pData, value.dataSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolInlineUniformBlockCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3790,12 +8776,33 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolInlineUniform
     encoder->EncodeUInt32Value(value.maxInlineUniformBlockBindings);
 }
 
+size_t ComputeEncodedSize(const VkDescriptorPoolInlineUniformBlockCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSampleLocationEXT& value)
 {
     encoder->EncodeFloatValue(value.x);
     encoder->EncodeFloatValue(value.y);
 }
 
+size_t ComputeEncodedSize(const VkSampleLocationEXT& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSampleLocationsInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3806,18 +8813,49 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSampleLocationsInfoEXT& val
     EncodeStructArray(encoder, value.pSampleLocations, value.sampleLocationsCount);
 }
 
+size_t ComputeEncodedSize(const VkSampleLocationsInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.sampleLocationGridSize);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pSampleLocations, value.sampleLocationsCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentSampleLocationsEXT& value)
 {
     encoder->EncodeUInt32Value(value.attachmentIndex);
     EncodeStruct(encoder, value.sampleLocationsInfo);
 }
 
+size_t ComputeEncodedSize(const VkAttachmentSampleLocationsEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.sampleLocationsInfo);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSubpassSampleLocationsEXT& value)
 {
     encoder->EncodeUInt32Value(value.subpassIndex);
     EncodeStruct(encoder, value.sampleLocationsInfo);
 }
 
+size_t ComputeEncodedSize(const VkSubpassSampleLocationsEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeEncodedSize(value.sampleLocationsInfo);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassSampleLocationsBeginInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3828,6 +8866,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassSampleLocationsBe
     EncodeStructArray(encoder, value.pPostSubpassSampleLocations, value.postSubpassSampleLocationsCount);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassSampleLocationsBeginInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pAttachmentInitialSampleLocations, value.attachmentInitialSampleLocationsCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pPostSubpassSampleLocations, value.postSubpassSampleLocationsCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineSampleLocationsStateCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3836,6 +8887,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineSampleLocationsStat
     EncodeStruct(encoder, value.sampleLocationsInfo);
 }
 
+size_t ComputeEncodedSize(const VkPipelineSampleLocationsStateCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ComputeEncodedSize(value.sampleLocationsInfo);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSampleLocationsPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3847,6 +8909,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSampleLocatio
     encoder->EncodeVkBool32Value(value.variableSampleLocations);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSampleLocationsPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ComputeEncodedSize(value.maxSampleLocationGridSize);
+    size += ParameterEncodedSize::FloatArray(value.sampleLocationCoordinateRange, 2);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMultisamplePropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3854,6 +8930,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMultisamplePropertiesEXT& v
     EncodeStruct(encoder, value.maxSampleLocationGridSize);
 }
 
+size_t ComputeEncodedSize(const VkMultisamplePropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.maxSampleLocationGridSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3861,6 +8947,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperatio
     encoder->EncodeVkBool32Value(value.advancedBlendCoherentOperations);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3873,6 +8969,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperatio
     encoder->EncodeVkBool32Value(value.advancedBlendAllOperations);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAdvancedStateCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3882,6 +8993,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAdvancedS
     encoder->EncodeEnumValue(value.blendOverlap);
 }
 
+size_t ComputeEncodedSize(const VkPipelineColorBlendAdvancedStateCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageToColorStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3891,6 +9014,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageToColorStat
     encoder->EncodeUInt32Value(value.coverageToColorLocation);
 }
 
+size_t ComputeEncodedSize(const VkPipelineCoverageToColorStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageModulationStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3902,6 +9037,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageModulationS
     encoder->EncodeFloatArray(value.pCoverageModulationTable, value.coverageModulationTableCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineCoverageModulationStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FloatArray(value.pCoverageModulationTable, value.coverageModulationTableCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3910,6 +9059,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSMBuilt
     encoder->EncodeUInt32Value(value.shaderWarpsPerSM);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3917,6 +9077,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSMBuilt
     encoder->EncodeVkBool32Value(value.shaderSMBuiltins);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesEXT& value)
 {
     encoder->EncodeUInt64Value(value.drmFormatModifier);
@@ -3924,6 +9094,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierProperties
     encoder->EncodeFlagsValue(value.drmFormatModifierTilingFeatures);
 }
 
+size_t ComputeEncodedSize(const VkDrmFormatModifierPropertiesEXT& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesListEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3932,6 +9114,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierProperties
     EncodeStructArray(encoder, value.pDrmFormatModifierProperties, value.drmFormatModifierCount);
 }
 
+size_t ComputeEncodedSize(const VkDrmFormatModifierPropertiesListEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pDrmFormatModifierProperties, value.drmFormatModifierCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3942,6 +9135,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageDrmForma
     encoder->EncodeUInt32Array(value.pQueueFamilyIndices, value.queueFamilyIndexCount);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pQueueFamilyIndices, value.queueFamilyIndexCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierListCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3950,6 +9156,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierListC
     encoder->EncodeUInt64Array(value.pDrmFormatModifiers, value.drmFormatModifierCount);
 }
 
+size_t ComputeEncodedSize(const VkImageDrmFormatModifierListCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Array(value.pDrmFormatModifiers, value.drmFormatModifierCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierExplicitCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3959,6 +9176,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierExpli
     EncodeStructArray(encoder, value.pPlaneLayouts, value.drmFormatModifierPlaneCount);
 }
 
+size_t ComputeEncodedSize(const VkImageDrmFormatModifierExplicitCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pPlaneLayouts, value.drmFormatModifierPlaneCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3966,6 +9195,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierPrope
     encoder->EncodeUInt64Value(value.drmFormatModifier);
 }
 
+size_t ComputeEncodedSize(const VkImageDrmFormatModifierPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationCacheCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3975,6 +9214,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkValidationCacheCreateInfoEX
     encoder->EncodeVoidArray(value.pInitialData, value.initialDataSize);
 }
 
+size_t ComputeEncodedSize(const VkValidationCacheCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::SizeTValue();
+    size += ParameterEncodedSize::VoidArray(value.pInitialData, value.initialDataSize);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleValidationCacheCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3982,12 +9233,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleValidationCache
     encoder->EncodeHandleValue(value.validationCache);
 }
 
+size_t ComputeEncodedSize(const VkShaderModuleValidationCacheCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkShadingRatePaletteNV& value)
 {
     encoder->EncodeUInt32Value(value.shadingRatePaletteEntryCount);
     encoder->EncodeEnumArray(value.pShadingRatePaletteEntries, value.shadingRatePaletteEntryCount);
 }
 
+size_t ComputeEncodedSize(const VkShadingRatePaletteNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pShadingRatePaletteEntries, value.shadingRatePaletteEntryCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportShadingRateImageStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -3997,6 +9267,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportShadingRate
     EncodeStructArray(encoder, value.pShadingRatePalettes, value.viewportCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineViewportShadingRateImageStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pShadingRatePalettes, value.viewportCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShadingRateImageFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4005,6 +9287,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShadingRateIm
     encoder->EncodeVkBool32Value(value.shadingRateCoarseSampleOrder);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShadingRateImageFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShadingRateImagePropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4014,6 +9307,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShadingRateIm
     encoder->EncodeUInt32Value(value.shadingRateMaxCoarseSamples);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShadingRateImagePropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.shadingRateTexelSize);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleLocationNV& value)
 {
     encoder->EncodeUInt32Value(value.pixelX);
@@ -4021,6 +9326,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleLocationNV& val
     encoder->EncodeUInt32Value(value.sample);
 }
 
+size_t ComputeEncodedSize(const VkCoarseSampleLocationNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleOrderCustomNV& value)
 {
     encoder->EncodeEnumValue(value.shadingRate);
@@ -4029,6 +9346,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleOrderCustomNV&
     EncodeStructArray(encoder, value.pSampleLocations, value.sampleLocationCount);
 }
 
+size_t ComputeEncodedSize(const VkCoarseSampleOrderCustomNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pSampleLocations, value.sampleLocationCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4038,6 +9366,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportCoarseSampl
     EncodeStructArray(encoder, value.pCustomSampleOrders, value.customSampleOrderCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pCustomSampleOrders, value.customSampleOrderCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4049,6 +9389,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreate
     encoder->EncodeUInt32Value(value.intersectionShader);
 }
 
+size_t ComputeEncodedSize(const VkRayTracingShaderGroupCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4064,6 +9418,24 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInf
     encoder->EncodeInt32Value(value.basePipelineIndex);
 }
 
+size_t ComputeEncodedSize(const VkRayTracingPipelineCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pStages, value.stageCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pGroups, value.groupCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGeometryTrianglesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4081,6 +9453,26 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGeometryTrianglesNV& value)
     encoder->EncodeVkDeviceSizeValue(value.transformOffset);
 }
 
+size_t ComputeEncodedSize(const VkGeometryTrianglesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGeometryAABBNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4091,12 +9483,34 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGeometryAABBNV& value)
     encoder->EncodeVkDeviceSizeValue(value.offset);
 }
 
+size_t ComputeEncodedSize(const VkGeometryAABBNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGeometryDataNV& value)
 {
     EncodeStruct(encoder, value.triangles);
     EncodeStruct(encoder, value.aabbs);
 }
 
+size_t ComputeEncodedSize(const VkGeometryDataNV& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.triangles);
+    size += ComputeEncodedSize(value.aabbs);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGeometryNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4106,6 +9520,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGeometryNV& value)
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkGeometryNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.geometry);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4117,6 +9543,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInfoNV
     EncodeStructArray(encoder, value.pGeometries, value.geometryCount);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pGeometries, value.geometryCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4125,6 +9565,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureCreate
     EncodeStruct(encoder, value.info);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ComputeEncodedSize(value.info);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindAccelerationStructureMemoryInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4136,6 +9587,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindAccelerationStructureMe
     encoder->EncodeUInt32Array(value.pDeviceIndices, value.deviceIndexCount);
 }
 
+size_t ComputeEncodedSize(const VkBindAccelerationStructureMemoryInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pDeviceIndices, value.deviceIndexCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSetAccelerationStructureNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4144,6 +9609,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSetAccelerat
     encoder->EncodeHandleArray(value.pAccelerationStructures, value.accelerationStructureCount);
 }
 
+size_t ComputeEncodedSize(const VkWriteDescriptorSetAccelerationStructureNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pAccelerationStructures, value.accelerationStructureCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureMemoryRequirementsInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4152,6 +9628,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureMemory
     encoder->EncodeHandleValue(value.accelerationStructure);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureMemoryRequirementsInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4166,11 +9653,36 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPro
     encoder->EncodeUInt32Value(value.maxDescriptorSetAccelerationStructures);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayTracingPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkTransformMatrixKHR& value)
 {
     encoder->EncodeFloat2DMatrix(value.matrix, 3, 4);
 }
 
+size_t ComputeEncodedSize(const VkTransformMatrixKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::Float2DMatrix(value.matrix, 3, 4);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAabbPositionsKHR& value)
 {
     encoder->EncodeFloatValue(value.minX);
@@ -4181,6 +9693,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAabbPositionsKHR& value)
     encoder->EncodeFloatValue(value.maxZ);
 }
 
+size_t ComputeEncodedSize(const VkAabbPositionsKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInstanceKHR& value)
 {
     EncodeStruct(encoder, value.transform);
@@ -4191,6 +9718,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInstan
     encoder->EncodeUInt64Value(value.accelerationStructureReference);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureInstanceKHR& value)
+{
+    size_t size = 0;
+    size += ComputeEncodedSize(value.transform);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4198,6 +9738,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRepresentativ
     encoder->EncodeVkBool32Value(value.representativeFragmentTest);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4205,6 +9755,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRepresentativeFragm
     encoder->EncodeVkBool32Value(value.representativeFragmentTestEnable);
 }
 
+size_t ComputeEncodedSize(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageViewImageFormatInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4212,6 +9772,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageViewImag
     encoder->EncodeEnumValue(value.imageViewType);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageViewImageFormatInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFilterCubicImageViewImageFormatPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4220,6 +9790,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFilterCubicImageViewImageFo
     encoder->EncodeVkBool32Value(value.filterCubicMinmax);
 }
 
+size_t ComputeEncodedSize(const VkFilterCubicImageViewImageFormatPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueGlobalPriorityCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4227,6 +9808,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueGlobalPriorityCr
     encoder->EncodeEnumValue(value.globalPriority);
 }
 
+size_t ComputeEncodedSize(const VkDeviceQueueGlobalPriorityCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryHostPointerInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4235,6 +9826,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryHostPointerInfo
     encoder->EncodeVoidPtr(value.pHostPointer);
 }
 
+size_t ComputeEncodedSize(const VkImportMemoryHostPointerInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryHostPointerPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4242,6 +9844,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryHostPointerProperties
     encoder->EncodeUInt32Value(value.memoryTypeBits);
 }
 
+size_t ComputeEncodedSize(const VkMemoryHostPointerPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4249,6 +9861,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalMemor
     encoder->EncodeVkDeviceSizeValue(value.minImportedHostPointerAlignment);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCompilerControlCreateInfoAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4256,6 +9878,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCompilerControlCrea
     encoder->EncodeFlagsValue(value.compilerControlFlags);
 }
 
+size_t ComputeEncodedSize(const VkPipelineCompilerControlCreateInfoAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCalibratedTimestampInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4263,6 +9895,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCalibratedTimestampInfoEXT&
     encoder->EncodeEnumValue(value.timeDomain);
 }
 
+size_t ComputeEncodedSize(const VkCalibratedTimestampInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderCorePropertiesAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4283,6 +9925,29 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderCorePro
     encoder->EncodeUInt32Value(value.vgprAllocationGranularity);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderCorePropertiesAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryOverallocationCreateInfoAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4290,6 +9955,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryOverallocationC
     encoder->EncodeEnumValue(value.overallocationBehavior);
 }
 
+size_t ComputeEncodedSize(const VkDeviceMemoryOverallocationCreateInfoAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4297,12 +9972,33 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttribu
     encoder->EncodeUInt32Value(value.maxVertexAttribDivisor);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDivisorDescriptionEXT& value)
 {
     encoder->EncodeUInt32Value(value.binding);
     encoder->EncodeUInt32Value(value.divisor);
 }
 
+size_t ComputeEncodedSize(const VkVertexInputBindingDivisorDescriptionEXT& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputDivisorStateCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4311,6 +10007,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputDivisorS
     EncodeStructArray(encoder, value.pVertexBindingDivisors, value.vertexBindingDivisorCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineVertexInputDivisorStateCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pVertexBindingDivisors, value.vertexBindingDivisorCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4319,6 +10026,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttribu
     encoder->EncodeVkBool32Value(value.vertexAttributeInstanceRateZeroDivisor);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentFrameTokenGGP& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4326,12 +10044,33 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPresentFrameTokenGGP& value
     encoder->EncodeUInt64Value(value.frameToken);
 }
 
+size_t ComputeEncodedSize(const VkPresentFrameTokenGGP& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCreationFeedbackEXT& value)
 {
     encoder->EncodeFlagsValue(value.flags);
     encoder->EncodeUInt64Value(value.duration);
 }
 
+size_t ComputeEncodedSize(const VkPipelineCreationFeedbackEXT& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCreationFeedbackCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4341,6 +10080,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCreationFeedbackCre
     EncodeStructArray(encoder, value.pPipelineStageCreationFeedbacks, value.pipelineStageCreationFeedbackCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineCreationFeedbackCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeStructPtrEncodedSize(value.pPipelineCreationFeedback);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pPipelineStageCreationFeedbacks, value.pipelineStageCreationFeedbackCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4349,6 +10100,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceComputeShader
     encoder->EncodeVkBool32Value(value.computeDerivativeGroupLinear);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4357,6 +10119,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderFea
     encoder->EncodeVkBool32Value(value.meshShader);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMeshShaderFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4376,12 +10149,45 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderPro
     encoder->EncodeUInt32Value(value.meshOutputPerPrimitiveGranularity);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMeshShaderPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.maxTaskWorkGroupSize, 3);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.maxMeshWorkGroupSize, 3);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandNV& value)
 {
     encoder->EncodeUInt32Value(value.taskCount);
     encoder->EncodeUInt32Value(value.firstTask);
 }
 
+size_t ComputeEncodedSize(const VkDrawMeshTasksIndirectCommandNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4389,6 +10195,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShade
     encoder->EncodeVkBool32Value(value.fragmentShaderBarycentric);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageFootprintFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4396,6 +10212,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageFo
     encoder->EncodeVkBool32Value(value.imageFootprint);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderImageFootprintFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportExclusiveScissorStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4404,6 +10230,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportExclusiveSc
     EncodeStructArray(encoder, value.pExclusiveScissors, value.exclusiveScissorCount);
 }
 
+size_t ComputeEncodedSize(const VkPipelineViewportExclusiveScissorStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pExclusiveScissors, value.exclusiveScissorCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExclusiveScissorFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4411,6 +10248,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExclusiveScis
     encoder->EncodeVkBool32Value(value.exclusiveScissor);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExclusiveScissorFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyCheckpointPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4418,6 +10265,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyCheckpointProper
     encoder->EncodeFlagsValue(value.checkpointExecutionStageMask);
 }
 
+size_t ComputeEncodedSize(const VkQueueFamilyCheckpointPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCheckpointDataNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4426,6 +10283,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCheckpointDataNV& value)
     encoder->EncodeVoidPtr(value.pCheckpointMarker);
 }
 
+size_t ComputeEncodedSize(const VkCheckpointDataNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4433,6 +10301,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderInteger
     encoder->EncodeVkBool32Value(value.shaderIntegerFunctions2);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkInitializePerformanceApiInfoINTEL& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4440,6 +10318,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkInitializePerformanceApiInf
     encoder->EncodeVoidPtr(value.pUserData);
 }
 
+size_t ComputeEncodedSize(const VkInitializePerformanceApiInfoINTEL& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolPerformanceQueryCreateInfoINTEL& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4447,6 +10335,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolPerformanceQueryCr
     encoder->EncodeEnumValue(value.performanceCountersSampling);
 }
 
+size_t ComputeEncodedSize(const VkQueryPoolPerformanceQueryCreateInfoINTEL& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceMarkerInfoINTEL& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4454,6 +10352,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceMarkerInfoINTEL&
     encoder->EncodeUInt64Value(value.marker);
 }
 
+size_t ComputeEncodedSize(const VkPerformanceMarkerInfoINTEL& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceStreamMarkerInfoINTEL& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4461,6 +10369,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceStreamMarkerInfo
     encoder->EncodeUInt32Value(value.marker);
 }
 
+size_t ComputeEncodedSize(const VkPerformanceStreamMarkerInfoINTEL& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceOverrideInfoINTEL& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4470,6 +10388,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceOverrideInfoINTE
     encoder->EncodeUInt64Value(value.parameter);
 }
 
+size_t ComputeEncodedSize(const VkPerformanceOverrideInfoINTEL& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt64Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceConfigurationAcquireInfoINTEL& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4477,6 +10407,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceConfigurationAcq
     encoder->EncodeEnumValue(value.type);
 }
 
+size_t ComputeEncodedSize(const VkPerformanceConfigurationAcquireInfoINTEL& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePCIBusInfoPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4487,6 +10427,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePCIBusInfoPro
     encoder->EncodeUInt32Value(value.pciFunction);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePCIBusInfoPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayNativeHdrSurfaceCapabilitiesAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4494,6 +10447,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayNativeHdrSurfaceCapa
     encoder->EncodeVkBool32Value(value.localDimmingSupport);
 }
 
+size_t ComputeEncodedSize(const VkDisplayNativeHdrSurfaceCapabilitiesAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainDisplayNativeHdrCreateInfoAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4501,6 +10464,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainDisplayNativeHdrCr
     encoder->EncodeVkBool32Value(value.localDimmingEnable);
 }
 
+size_t ComputeEncodedSize(const VkSwapchainDisplayNativeHdrCreateInfoAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImagePipeSurfaceCreateInfoFUCHSIA& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4509,6 +10482,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImagePipeSurfaceCreateInfoF
     encoder->EncodeUInt32Value(value.imagePipeHandle);
 }
 
+size_t ComputeEncodedSize(const VkImagePipeSurfaceCreateInfoFUCHSIA& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMetalSurfaceCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4517,6 +10501,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMetalSurfaceCreateInfoEXT&
     encoder->EncodeVoidPtr(value.pLayer);
 }
 
+size_t ComputeEncodedSize(const VkMetalSurfaceCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4526,6 +10521,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensi
     encoder->EncodeVkBool32Value(value.fragmentDensityMapNonSubsampledImages);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4535,6 +10542,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensi
     encoder->EncodeVkBool32Value(value.fragmentDensityInvocations);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.minFragmentDensityTexelSize);
+    size += ComputeEncodedSize(value.maxFragmentDensityTexelSize);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassFragmentDensityMapCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4542,6 +10561,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassFragmentDensityMa
     EncodeStruct(encoder, value.fragmentDensityMapAttachment);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassFragmentDensityMapCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.fragmentDensityMapAttachment);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupSizeControlFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4550,6 +10579,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupSizeC
     encoder->EncodeVkBool32Value(value.computeFullSubgroups);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSubgroupSizeControlFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupSizeControlPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4560,6 +10600,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupSizeC
     encoder->EncodeFlagsValue(value.requiredSubgroupSizeStages);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSubgroupSizeControlPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4567,6 +10620,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineShaderStageRequired
     encoder->EncodeUInt32Value(value.requiredSubgroupSize);
 }
 
+size_t ComputeEncodedSize(const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderCoreProperties2AMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4575,6 +10638,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderCorePro
     encoder->EncodeUInt32Value(value.activeComputeUnitCount);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderCoreProperties2AMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCoherentMemoryFeaturesAMD& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4582,6 +10656,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCoherentMemor
     encoder->EncodeVkBool32Value(value.deviceCoherentMemory);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCoherentMemoryFeaturesAMD& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4590,6 +10674,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageAt
     encoder->EncodeVkBool32Value(value.sparseImageInt64Atomics);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryBudgetPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4598,6 +10693,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryBudgetP
     encoder->EncodeVkDeviceSizeArray(value.heapUsage, VK_MAX_MEMORY_HEAPS);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryBudgetPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeArray(value.heapBudget, VK_MAX_MEMORY_HEAPS);
+    size += ParameterEncodedSize::VkDeviceSizeArray(value.heapUsage, VK_MAX_MEMORY_HEAPS);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryPriorityFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4605,6 +10711,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryPriorit
     encoder->EncodeVkBool32Value(value.memoryPriority);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryPriorityFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryPriorityAllocateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4612,6 +10728,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMemoryPriorityAllocateInfoE
     encoder->EncodeFloatValue(value.priority);
 }
 
+size_t ComputeEncodedSize(const VkMemoryPriorityAllocateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FloatValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4619,6 +10745,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDedicatedAllo
     encoder->EncodeVkBool32Value(value.dedicatedAllocationImageAliasing);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4628,6 +10764,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBufferDeviceA
     encoder->EncodeVkBool32Value(value.bufferDeviceAddressMultiDevice);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferDeviceAddressCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4635,6 +10783,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferDeviceAddressCreateIn
     encoder->EncodeVkDeviceAddressValue(value.deviceAddress);
 }
 
+size_t ComputeEncodedSize(const VkBufferDeviceAddressCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceAddressValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceToolPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4646,6 +10804,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceToolPropertie
     encoder->EncodeString(value.layer);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceToolPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::String(value.name);
+    size += ParameterEncodedSize::String(value.version);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::String(value.description);
+    size += ParameterEncodedSize::String(value.layer);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4656,6 +10828,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkValidationFeaturesEXT& valu
     encoder->EncodeEnumArray(value.pDisabledValidationFeatures, value.disabledValidationFeatureCount);
 }
 
+size_t ComputeEncodedSize(const VkValidationFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pEnabledValidationFeatures, value.enabledValidationFeatureCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pDisabledValidationFeatures, value.disabledValidationFeatureCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCooperativeMatrixPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4670,6 +10855,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCooperativeMatrixProperties
     encoder->EncodeEnumValue(value.scope);
 }
 
+size_t ComputeEncodedSize(const VkCooperativeMatrixPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCooperativeMatrixFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4678,6 +10880,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCooperativeMa
     encoder->EncodeVkBool32Value(value.cooperativeMatrixRobustBufferAccess);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCooperativeMatrixFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCooperativeMatrixPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4685,6 +10898,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCooperativeMa
     encoder->EncodeFlagsValue(value.cooperativeMatrixSupportedStages);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCooperativeMatrixPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCoverageReductionModeFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4692,6 +10915,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCoverageReduc
     encoder->EncodeVkBool32Value(value.coverageReductionMode);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCoverageReductionModeFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageReductionStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4700,6 +10933,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageReductionSt
     encoder->EncodeEnumValue(value.coverageReductionMode);
 }
 
+size_t ComputeEncodedSize(const VkPipelineCoverageReductionStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferMixedSamplesCombinationNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4710,6 +10954,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferMixedSamplesComb
     encoder->EncodeFlagsValue(value.colorSamples);
 }
 
+size_t ComputeEncodedSize(const VkFramebufferMixedSamplesCombinationNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4719,6 +10976,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShade
     encoder->EncodeVkBool32Value(value.fragmentShaderShadingRateInterlock);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4726,6 +10995,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceYcbcrImageArr
     encoder->EncodeVkBool32Value(value.ycbcrImageArrays);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFullScreenExclusiveInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4733,6 +11012,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFullScreenExclusiveI
     encoder->EncodeEnumValue(value.fullScreenExclusive);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceFullScreenExclusiveInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesFullScreenExclusiveEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4740,6 +11029,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesFullScre
     encoder->EncodeVkBool32Value(value.fullScreenExclusiveSupported);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceCapabilitiesFullScreenExclusiveEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFullScreenExclusiveWin32InfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4747,6 +11046,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFullScreenExclusiveW
     encoder->EncodeVoidPtr(value.hmonitor);
 }
 
+size_t ComputeEncodedSize(const VkSurfaceFullScreenExclusiveWin32InfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkHeadlessSurfaceCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4754,6 +11063,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkHeadlessSurfaceCreateInfoEX
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkHeadlessSurfaceCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLineRasterizationFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4766,6 +11085,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLineRasteriza
     encoder->EncodeVkBool32Value(value.stippledSmoothLines);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceLineRasterizationFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLineRasterizationPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4773,6 +11107,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLineRasteriza
     encoder->EncodeUInt32Value(value.lineSubPixelPrecisionBits);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceLineRasterizationPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationLineStateCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4783,6 +11127,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationLineSt
     encoder->EncodeUInt16Value(value.lineStipplePattern);
 }
 
+size_t ComputeEncodedSize(const VkPipelineRasterizationLineStateCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt16Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4801,6 +11158,27 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderAtomicF
     encoder->EncodeVkBool32Value(value.sparseImageFloat32AtomicAdd);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4808,6 +11186,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceIndexTypeUint
     encoder->EncodeVkBool32Value(value.indexTypeUint8);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4815,6 +11203,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExtendedDynam
     encoder->EncodeVkBool32Value(value.extendedDynamicState);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4822,6 +11220,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDemoteT
     encoder->EncodeVkBool32Value(value.shaderDemoteToHelperInvocation);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4837,6 +11245,24 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceGenerat
     encoder->EncodeUInt32Value(value.minIndirectCommandsBufferOffsetAlignment);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4844,6 +11270,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceGenerat
     encoder->EncodeVkBool32Value(value.deviceGeneratedCommands);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsShaderGroupCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4854,6 +11290,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsShaderGroupCreateIn
     EncodeStructPtr(encoder, value.pTessellationState);
 }
 
+size_t ComputeEncodedSize(const VkGraphicsShaderGroupCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pStages, value.stageCount);
+    size += ComputeStructPtrEncodedSize(value.pVertexInputState);
+    size += ComputeStructPtrEncodedSize(value.pTessellationState);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsPipelineShaderGroupsCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4864,11 +11313,34 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsPipelineShaderGroup
     encoder->EncodeHandleArray(value.pPipelines, value.pipelineCount);
 }
 
+size_t ComputeEncodedSize(const VkGraphicsPipelineShaderGroupsCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pGroups, value.groupCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pPipelines, value.pipelineCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindShaderGroupIndirectCommandNV& value)
 {
     encoder->EncodeUInt32Value(value.groupIndex);
 }
 
+size_t ComputeEncodedSize(const VkBindShaderGroupIndirectCommandNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindIndexBufferIndirectCommandNV& value)
 {
     encoder->EncodeVkDeviceAddressValue(value.bufferAddress);
@@ -4876,6 +11348,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindIndexBufferIndirectComm
     encoder->EncodeEnumValue(value.indexType);
 }
 
+size_t ComputeEncodedSize(const VkBindIndexBufferIndirectCommandNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceAddressValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBindVertexBufferIndirectCommandNV& value)
 {
     encoder->EncodeVkDeviceAddressValue(value.bufferAddress);
@@ -4883,17 +11367,50 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBindVertexBufferIndirectCom
     encoder->EncodeUInt32Value(value.stride);
 }
 
+size_t ComputeEncodedSize(const VkBindVertexBufferIndirectCommandNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceAddressValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSetStateFlagsIndirectCommandNV& value)
 {
     encoder->EncodeUInt32Value(value.data);
 }
 
+size_t ComputeEncodedSize(const VkSetStateFlagsIndirectCommandNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsStreamNV& value)
 {
     encoder->EncodeHandleValue(value.buffer);
     encoder->EncodeVkDeviceSizeValue(value.offset);
 }
 
+size_t ComputeEncodedSize(const VkIndirectCommandsStreamNV& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsLayoutTokenNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4913,6 +11430,28 @@ void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsLayoutToken
     encoder->EncodeUInt32Array(value.pIndexTypeValues, value.indexTypeCount);
 }
 
+size_t ComputeEncodedSize(const VkIndirectCommandsLayoutTokenNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pIndexTypes, value.indexTypeCount);
+    size += ParameterEncodedSize::UInt32Array(value.pIndexTypeValues, value.indexTypeCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsLayoutCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4925,6 +11464,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsLayoutCreat
     encoder->EncodeUInt32Array(value.pStreamStrides, value.streamCount);
 }
 
+size_t ComputeEncodedSize(const VkIndirectCommandsLayoutCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pTokens, value.tokenCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Array(value.pStreamStrides, value.streamCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4944,6 +11498,28 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsInfoNV& va
     encoder->EncodeVkDeviceSizeValue(value.sequencesIndexOffset);
 }
 
+size_t ComputeEncodedSize(const VkGeneratedCommandsInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pStreams, value.streamCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsMemoryRequirementsInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4954,6 +11530,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsMemoryRequ
     encoder->EncodeUInt32Value(value.maxSequencesCount);
 }
 
+size_t ComputeEncodedSize(const VkGeneratedCommandsMemoryRequirementsInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4961,6 +11550,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTexelBufferAl
     encoder->EncodeVkBool32Value(value.texelBufferAlignment);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4971,6 +11570,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTexelBufferAl
     encoder->EncodeVkBool32Value(value.uniformTexelBufferOffsetSingleTexelAlignment);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassTransformBeginInfoQCOM& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4978,6 +11590,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassTransformBeginInf
     encoder->EncodeEnumValue(value.transform);
 }
 
+size_t ComputeEncodedSize(const VkRenderPassTransformBeginInfoQCOM& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4986,6 +11608,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceRen
     EncodeStruct(encoder, value.renderArea);
 }
 
+size_t ComputeEncodedSize(const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.renderArea);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -4993,6 +11626,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceMemoryR
     encoder->EncodeVkBool32Value(value.deviceMemoryReport);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryReportCallbackDataEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5006,6 +11649,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryReportCallbackD
     encoder->EncodeUInt32Value(value.heapIndex);
 }
 
+size_t ComputeEncodedSize(const VkDeviceMemoryReportCallbackDataEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceDeviceMemoryReportCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5015,6 +11674,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceDeviceMemoryReportCre
     encoder->EncodeVoidPtr(value.pUserData);
 }
 
+size_t ComputeEncodedSize(const VkDeviceDeviceMemoryReportCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::FunctionPtr();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRobustness2FeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5024,6 +11695,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRobustness2Fe
     encoder->EncodeVkBool32Value(value.nullDescriptor);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRobustness2FeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRobustness2PropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5032,6 +11715,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRobustness2Pr
     encoder->EncodeVkDeviceSizeValue(value.robustUniformBufferAccessSizeAlignment);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRobustness2PropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerCustomBorderColorCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5040,6 +11734,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkSamplerCustomBorderColorCre
     encoder->EncodeEnumValue(value.format);
 }
 
+size_t ComputeEncodedSize(const VkSamplerCustomBorderColorCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.customBorderColor);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCustomBorderColorPropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5047,6 +11752,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCustomBorderC
     encoder->EncodeUInt32Value(value.maxCustomBorderColorSamplers);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCustomBorderColorPropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCustomBorderColorFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5055,6 +11770,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCustomBorderC
     encoder->EncodeVkBool32Value(value.customBorderColorWithoutFormat);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCustomBorderColorFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePrivateDataFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5062,6 +11788,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePrivateDataFe
     encoder->EncodeVkBool32Value(value.privateData);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePrivateDataFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDevicePrivateDataCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5069,6 +11805,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDevicePrivateDataCreateInfo
     encoder->EncodeUInt32Value(value.privateDataSlotRequestCount);
 }
 
+size_t ComputeEncodedSize(const VkDevicePrivateDataCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPrivateDataSlotCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5076,6 +11822,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPrivateDataSlotCreateInfoEX
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkPrivateDataSlotCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5083,6 +11839,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePipelineCreat
     encoder->EncodeVkBool32Value(value.pipelineCreationCacheControl);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5090,6 +11856,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiagnosticsCo
     encoder->EncodeVkBool32Value(value.diagnosticsConfig);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceDiagnosticsConfigCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5097,6 +11873,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceDiagnosticsConfigCrea
     encoder->EncodeFlagsValue(value.flags);
 }
 
+size_t ComputeEncodedSize(const VkDeviceDiagnosticsConfigCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5106,6 +11892,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadi
     encoder->EncodeVkBool32Value(value.noInvocationFragmentShadingRates);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5113,6 +11911,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadi
     encoder->EncodeEnumValue(value.maxFragmentShadingRateInvocationCount);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5122,6 +11930,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineFragmentShadingRate
     encoder->EncodeEnumArray(value.combinerOps, 2);
 }
 
+size_t ComputeEncodedSize(const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::EnumArray(value.combinerOps, 2);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5129,6 +11949,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensi
     encoder->EncodeVkBool32Value(value.fragmentDensityMapDeferred);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5139,6 +11969,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensi
     encoder->EncodeUInt32Value(value.maxDescriptorSetSubsampledSamplers);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyCommandTransformInfoQCOM& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5146,6 +11989,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyCommandTransformInfoQCO
     encoder->EncodeEnumValue(value.transform);
 }
 
+size_t ComputeEncodedSize(const VkCopyCommandTransformInfoQCOM& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageRobustnessFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5153,6 +12006,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageRobustne
     encoder->EncodeVkBool32Value(value.robustImageAccess);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageRobustnessFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevice4444FormatsFeaturesEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5161,6 +12024,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevice4444FormatsFe
     encoder->EncodeVkBool32Value(value.formatA4B4G4R4);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDevice4444FormatsFeaturesEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDirectFBSurfaceCreateInfoEXT& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5170,6 +12044,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDirectFBSurfaceCreateInfoEX
     encoder->EncodeVoidPtr(value.surface);
 }
 
+size_t ComputeEncodedSize(const VkDirectFBSurfaceCreateInfoEXT& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::VoidPtr();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5177,12 +12063,31 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMutableDescri
     encoder->EncodeVkBool32Value(value.mutableDescriptorType);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMutableDescriptorTypeListVALVE& value)
 {
     encoder->EncodeUInt32Value(value.descriptorTypeCount);
     encoder->EncodeEnumArray(value.pDescriptorTypes, value.descriptorTypeCount);
 }
 
+size_t ComputeEncodedSize(const VkMutableDescriptorTypeListVALVE& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumArray(value.pDescriptorTypes, value.descriptorTypeCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMutableDescriptorTypeCreateInfoVALVE& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5191,6 +12096,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkMutableDescriptorTypeCreate
     EncodeStructArray(encoder, value.pMutableDescriptorTypeLists, value.mutableDescriptorTypeListCount);
 }
 
+size_t ComputeEncodedSize(const VkMutableDescriptorTypeCreateInfoVALVE& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pMutableDescriptorTypeLists, value.mutableDescriptorTypeListCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildRangeInfoKHR& value)
 {
     encoder->EncodeUInt32Value(value.primitiveCount);
@@ -5199,6 +12115,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildR
     encoder->EncodeUInt32Value(value.transformOffset);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureBuildRangeInfoKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryTrianglesDataKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5212,6 +12141,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeomet
     EncodeStruct(encoder, value.transformData);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryTrianglesDataKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.vertexData);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputeEncodedSize(value.indexData);
+    size += ComputeEncodedSize(value.transformData);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryAabbsDataKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5220,6 +12165,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeomet
     encoder->EncodeVkDeviceSizeValue(value.stride);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryAabbsDataKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.data);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryInstancesDataKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5228,6 +12184,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeomet
     EncodeStruct(encoder, value.data);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryInstancesDataKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ComputeEncodedSize(value.data);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildGeometryInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5243,6 +12210,24 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildG
     EncodeStruct(encoder, value.scratchData);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureBuildGeometryInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pGeometries, value.geometryCount);
+    size += ComputeStructArray2DEncodedSize(value.ppGeometries, value.geometryCount, 1);
+    size += ComputeEncodedSize(value.scratchData);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5255,6 +12240,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureCreate
     encoder->EncodeVkDeviceAddressValue(value.deviceAddress);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::VkDeviceAddressValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSetAccelerationStructureKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5263,6 +12263,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSetAccelerat
     encoder->EncodeHandleArray(value.pAccelerationStructures, value.accelerationStructureCount);
 }
 
+size_t ComputeEncodedSize(const VkWriteDescriptorSetAccelerationStructureKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::HandleArray(value.pAccelerationStructures, value.accelerationStructureCount);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceAccelerationStructureFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5274,6 +12285,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceAccelerationS
     encoder->EncodeVkBool32Value(value.descriptorBindingAccelerationStructureUpdateAfterBind);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceAccelerationStructureFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceAccelerationStructurePropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5288,6 +12313,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceAccelerationS
     encoder->EncodeUInt32Value(value.minAccelerationStructureScratchOffsetAlignment);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceAccelerationStructurePropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt64Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureDeviceAddressInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5295,6 +12337,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureDevice
     encoder->EncodeHandleValue(value.accelerationStructure);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureDeviceAddressInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureVersionInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5302,6 +12354,16 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureVersio
     encoder->EncodeUInt8Array(value.pVersionData, 2*VK_UUID_SIZE);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureVersionInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt8Array(value.pVersionData, 2*VK_UUID_SIZE);
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyAccelerationStructureToMemoryInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5311,6 +12373,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyAccelerationStructureTo
     encoder->EncodeEnumValue(value.mode);
 }
 
+size_t ComputeEncodedSize(const VkCopyAccelerationStructureToMemoryInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ComputeEncodedSize(value.dst);
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyMemoryToAccelerationStructureInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5320,6 +12394,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyMemoryToAccelerationStr
     encoder->EncodeEnumValue(value.mode);
 }
 
+size_t ComputeEncodedSize(const VkCopyMemoryToAccelerationStructureInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ComputeEncodedSize(value.src);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyAccelerationStructureInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5329,6 +12415,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyAccelerationStructureIn
     encoder->EncodeEnumValue(value.mode);
 }
 
+size_t ComputeEncodedSize(const VkCopyAccelerationStructureInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::EnumValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildSizesInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5338,6 +12436,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildS
     encoder->EncodeVkDeviceSizeValue(value.buildScratchSize);
 }
 
+size_t ComputeEncodedSize(const VkAccelerationStructureBuildSizesInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5350,6 +12460,21 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreate
     encoder->EncodeVoidPtr(value.pShaderGroupCaptureReplayHandle);
 }
 
+size_t ComputeEncodedSize(const VkRayTracingShaderGroupCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::EnumValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::VoidPtr();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineInterfaceCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5358,6 +12483,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineInterface
     encoder->EncodeUInt32Value(value.maxPipelineRayHitAttributeSize);
 }
 
+size_t ComputeEncodedSize(const VkRayTracingPipelineInterfaceCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5376,6 +12512,27 @@ void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInf
     encoder->EncodeInt32Value(value.basePipelineIndex);
 }
 
+size_t ComputeEncodedSize(const VkRayTracingPipelineCreateInfoKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::FlagsValue();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pStages, value.stageCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructArrayEncodedSize(value.pGroups, value.groupCount);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ComputeStructPtrEncodedSize(value.pLibraryInfo);
+    size += ComputeStructPtrEncodedSize(value.pLibraryInterface);
+    size += ComputeStructPtrEncodedSize(value.pDynamicState);
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::HandleValue();
+    size += ParameterEncodedSize::Int32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5387,6 +12544,20 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPip
     encoder->EncodeVkBool32Value(value.rayTraversalPrimitiveCulling);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5401,6 +12572,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPip
     encoder->EncodeUInt32Value(value.maxRayHitAttributeSize);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionKHR& value)
 {
     encoder->EncodeVkDeviceAddressValue(value.deviceAddress);
@@ -5408,6 +12596,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionK
     encoder->EncodeVkDeviceSizeValue(value.size);
 }
 
+size_t ComputeEncodedSize(const VkStridedDeviceAddressRegionKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::VkDeviceAddressValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+    size += ParameterEncodedSize::VkDeviceSizeValue();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR& value)
 {
     encoder->EncodeUInt32Value(value.width);
@@ -5415,6 +12615,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR
     encoder->EncodeUInt32Value(value.depth);
 }
 
+size_t ComputeEncodedSize(const VkTraceRaysIndirectCommandKHR& value)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(value);
+
+    size_t size = 0;
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+    size += ParameterEncodedSize::UInt32Value();
+
+    return size;
+}
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayQueryFeaturesKHR& value)
 {
     encoder->EncodeEnumValue(value.sType);
@@ -5422,5 +12634,15 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayQueryFeatu
     encoder->EncodeVkBool32Value(value.rayQuery);
 }
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayQueryFeaturesKHR& value)
+{
+    size_t size = 0;
+    size += ParameterEncodedSize::EnumValue();
+    size += ComputePNextStructEncodedSize(value.pNext);
+    size += ParameterEncodedSize::VkBool32Value();
+
+    return size;
+}
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
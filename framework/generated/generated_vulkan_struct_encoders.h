@@ -41,6 +41,7 @@ GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(encode)
 
 void EncodePNextStruct(ParameterEncoder* encoder, const void* value);
+size_t ComputePNextStructEncodedSize(const void* value);
 
 void EncodeStruct(ParameterEncoder* encoder, const VkExtent2D& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkExtent3D& value);
@@ -146,6 +147,110 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassBeginInfo& value);
 
+size_t ComputeEncodedSize(const VkExtent2D& value);
+size_t ComputeEncodedSize(const VkExtent3D& value);
+size_t ComputeEncodedSize(const VkOffset2D& value);
+size_t ComputeEncodedSize(const VkOffset3D& value);
+size_t ComputeEncodedSize(const VkRect2D& value);
+size_t ComputeEncodedSize(const VkBufferMemoryBarrier& value);
+size_t ComputeEncodedSize(const VkDispatchIndirectCommand& value);
+size_t ComputeEncodedSize(const VkDrawIndexedIndirectCommand& value);
+size_t ComputeEncodedSize(const VkDrawIndirectCommand& value);
+size_t ComputeEncodedSize(const VkImageSubresourceRange& value);
+size_t ComputeEncodedSize(const VkImageMemoryBarrier& value);
+size_t ComputeEncodedSize(const VkMemoryBarrier& value);
+size_t ComputeEncodedSize(const VkAllocationCallbacks& value);
+size_t ComputeEncodedSize(const VkApplicationInfo& value);
+size_t ComputeEncodedSize(const VkFormatProperties& value);
+size_t ComputeEncodedSize(const VkImageFormatProperties& value);
+size_t ComputeEncodedSize(const VkInstanceCreateInfo& value);
+size_t ComputeEncodedSize(const VkMemoryHeap& value);
+size_t ComputeEncodedSize(const VkMemoryType& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceLimits& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceSparseProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceProperties& value);
+size_t ComputeEncodedSize(const VkQueueFamilyProperties& value);
+size_t ComputeEncodedSize(const VkDeviceQueueCreateInfo& value);
+size_t ComputeEncodedSize(const VkDeviceCreateInfo& value);
+size_t ComputeEncodedSize(const VkExtensionProperties& value);
+size_t ComputeEncodedSize(const VkLayerProperties& value);
+size_t ComputeEncodedSize(const VkSubmitInfo& value);
+size_t ComputeEncodedSize(const VkMappedMemoryRange& value);
+size_t ComputeEncodedSize(const VkMemoryAllocateInfo& value);
+size_t ComputeEncodedSize(const VkMemoryRequirements& value);
+size_t ComputeEncodedSize(const VkSparseMemoryBind& value);
+size_t ComputeEncodedSize(const VkSparseBufferMemoryBindInfo& value);
+size_t ComputeEncodedSize(const VkSparseImageOpaqueMemoryBindInfo& value);
+size_t ComputeEncodedSize(const VkImageSubresource& value);
+size_t ComputeEncodedSize(const VkSparseImageMemoryBind& value);
+size_t ComputeEncodedSize(const VkSparseImageMemoryBindInfo& value);
+size_t ComputeEncodedSize(const VkBindSparseInfo& value);
+size_t ComputeEncodedSize(const VkSparseImageFormatProperties& value);
+size_t ComputeEncodedSize(const VkSparseImageMemoryRequirements& value);
+size_t ComputeEncodedSize(const VkFenceCreateInfo& value);
+size_t ComputeEncodedSize(const VkSemaphoreCreateInfo& value);
+size_t ComputeEncodedSize(const VkEventCreateInfo& value);
+size_t ComputeEncodedSize(const VkQueryPoolCreateInfo& value);
+size_t ComputeEncodedSize(const VkBufferCreateInfo& value);
+size_t ComputeEncodedSize(const VkBufferViewCreateInfo& value);
+size_t ComputeEncodedSize(const VkImageCreateInfo& value);
+size_t ComputeEncodedSize(const VkSubresourceLayout& value);
+size_t ComputeEncodedSize(const VkComponentMapping& value);
+size_t ComputeEncodedSize(const VkImageViewCreateInfo& value);
+size_t ComputeEncodedSize(const VkShaderModuleCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineCacheCreateInfo& value);
+size_t ComputeEncodedSize(const VkSpecializationMapEntry& value);
+size_t ComputeEncodedSize(const VkSpecializationInfo& value);
+size_t ComputeEncodedSize(const VkPipelineShaderStageCreateInfo& value);
+size_t ComputeEncodedSize(const VkComputePipelineCreateInfo& value);
+size_t ComputeEncodedSize(const VkVertexInputBindingDescription& value);
+size_t ComputeEncodedSize(const VkVertexInputAttributeDescription& value);
+size_t ComputeEncodedSize(const VkPipelineVertexInputStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineInputAssemblyStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineTessellationStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkViewport& value);
+size_t ComputeEncodedSize(const VkPipelineViewportStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineRasterizationStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineMultisampleStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkStencilOpState& value);
+size_t ComputeEncodedSize(const VkPipelineDepthStencilStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineColorBlendAttachmentState& value);
+size_t ComputeEncodedSize(const VkPipelineColorBlendStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineDynamicStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkGraphicsPipelineCreateInfo& value);
+size_t ComputeEncodedSize(const VkPushConstantRange& value);
+size_t ComputeEncodedSize(const VkPipelineLayoutCreateInfo& value);
+size_t ComputeEncodedSize(const VkSamplerCreateInfo& value);
+size_t ComputeEncodedSize(const VkCopyDescriptorSet& value);
+size_t ComputeEncodedSize(const VkDescriptorBufferInfo& value);
+size_t ComputeEncodedSize(const VkDescriptorPoolSize& value);
+size_t ComputeEncodedSize(const VkDescriptorPoolCreateInfo& value);
+size_t ComputeEncodedSize(const VkDescriptorSetAllocateInfo& value);
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutBinding& value);
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutCreateInfo& value);
+size_t ComputeEncodedSize(const VkAttachmentDescription& value);
+size_t ComputeEncodedSize(const VkAttachmentReference& value);
+size_t ComputeEncodedSize(const VkFramebufferCreateInfo& value);
+size_t ComputeEncodedSize(const VkSubpassDescription& value);
+size_t ComputeEncodedSize(const VkSubpassDependency& value);
+size_t ComputeEncodedSize(const VkRenderPassCreateInfo& value);
+size_t ComputeEncodedSize(const VkCommandPoolCreateInfo& value);
+size_t ComputeEncodedSize(const VkCommandBufferAllocateInfo& value);
+size_t ComputeEncodedSize(const VkCommandBufferInheritanceInfo& value);
+size_t ComputeEncodedSize(const VkCommandBufferBeginInfo& value);
+size_t ComputeEncodedSize(const VkBufferCopy& value);
+size_t ComputeEncodedSize(const VkImageSubresourceLayers& value);
+size_t ComputeEncodedSize(const VkBufferImageCopy& value);
+size_t ComputeEncodedSize(const VkClearDepthStencilValue& value);
+size_t ComputeEncodedSize(const VkClearAttachment& value);
+size_t ComputeEncodedSize(const VkClearRect& value);
+size_t ComputeEncodedSize(const VkImageBlit& value);
+size_t ComputeEncodedSize(const VkImageCopy& value);
+size_t ComputeEncodedSize(const VkImageResolve& value);
+size_t ComputeEncodedSize(const VkRenderPassBeginInfo& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupProperties& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkBindBufferMemoryInfo& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkBindImageMemoryInfo& value);
@@ -215,6 +320,75 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMaintenance3P
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorSetLayoutSupport& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDrawParametersFeatures& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSubgroupProperties& value);
+size_t ComputeEncodedSize(const VkBindBufferMemoryInfo& value);
+size_t ComputeEncodedSize(const VkBindImageMemoryInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDevice16BitStorageFeatures& value);
+size_t ComputeEncodedSize(const VkMemoryDedicatedRequirements& value);
+size_t ComputeEncodedSize(const VkMemoryDedicatedAllocateInfo& value);
+size_t ComputeEncodedSize(const VkMemoryAllocateFlagsInfo& value);
+size_t ComputeEncodedSize(const VkDeviceGroupRenderPassBeginInfo& value);
+size_t ComputeEncodedSize(const VkDeviceGroupCommandBufferBeginInfo& value);
+size_t ComputeEncodedSize(const VkDeviceGroupSubmitInfo& value);
+size_t ComputeEncodedSize(const VkDeviceGroupBindSparseInfo& value);
+size_t ComputeEncodedSize(const VkBindBufferMemoryDeviceGroupInfo& value);
+size_t ComputeEncodedSize(const VkBindImageMemoryDeviceGroupInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceGroupProperties& value);
+size_t ComputeEncodedSize(const VkDeviceGroupDeviceCreateInfo& value);
+size_t ComputeEncodedSize(const VkBufferMemoryRequirementsInfo2& value);
+size_t ComputeEncodedSize(const VkImageMemoryRequirementsInfo2& value);
+size_t ComputeEncodedSize(const VkImageSparseMemoryRequirementsInfo2& value);
+size_t ComputeEncodedSize(const VkMemoryRequirements2& value);
+size_t ComputeEncodedSize(const VkSparseImageMemoryRequirements2& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFeatures2& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceProperties2& value);
+size_t ComputeEncodedSize(const VkFormatProperties2& value);
+size_t ComputeEncodedSize(const VkImageFormatProperties2& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageFormatInfo2& value);
+size_t ComputeEncodedSize(const VkQueueFamilyProperties2& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryProperties2& value);
+size_t ComputeEncodedSize(const VkSparseImageFormatProperties2& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceSparseImageFormatInfo2& value);
+size_t ComputeEncodedSize(const VkPhysicalDevicePointClippingProperties& value);
+size_t ComputeEncodedSize(const VkInputAttachmentAspectReference& value);
+size_t ComputeEncodedSize(const VkRenderPassInputAttachmentAspectCreateInfo& value);
+size_t ComputeEncodedSize(const VkImageViewUsageCreateInfo& value);
+size_t ComputeEncodedSize(const VkPipelineTessellationDomainOriginStateCreateInfo& value);
+size_t ComputeEncodedSize(const VkRenderPassMultiviewCreateInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceMultiviewFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceMultiviewProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceVariablePointersFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceProtectedMemoryFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceProtectedMemoryProperties& value);
+size_t ComputeEncodedSize(const VkDeviceQueueInfo2& value);
+size_t ComputeEncodedSize(const VkProtectedSubmitInfo& value);
+size_t ComputeEncodedSize(const VkSamplerYcbcrConversionCreateInfo& value);
+size_t ComputeEncodedSize(const VkSamplerYcbcrConversionInfo& value);
+size_t ComputeEncodedSize(const VkBindImagePlaneMemoryInfo& value);
+size_t ComputeEncodedSize(const VkImagePlaneMemoryRequirementsInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceSamplerYcbcrConversionFeatures& value);
+size_t ComputeEncodedSize(const VkSamplerYcbcrConversionImageFormatProperties& value);
+size_t ComputeEncodedSize(const VkDescriptorUpdateTemplateEntry& value);
+size_t ComputeEncodedSize(const VkDescriptorUpdateTemplateCreateInfo& value);
+size_t ComputeEncodedSize(const VkExternalMemoryProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalImageFormatInfo& value);
+size_t ComputeEncodedSize(const VkExternalImageFormatProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalBufferInfo& value);
+size_t ComputeEncodedSize(const VkExternalBufferProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceIDProperties& value);
+size_t ComputeEncodedSize(const VkExternalMemoryImageCreateInfo& value);
+size_t ComputeEncodedSize(const VkExternalMemoryBufferCreateInfo& value);
+size_t ComputeEncodedSize(const VkExportMemoryAllocateInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalFenceInfo& value);
+size_t ComputeEncodedSize(const VkExternalFenceProperties& value);
+size_t ComputeEncodedSize(const VkExportFenceCreateInfo& value);
+size_t ComputeEncodedSize(const VkExportSemaphoreCreateInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalSemaphoreInfo& value);
+size_t ComputeEncodedSize(const VkExternalSemaphoreProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceMaintenance3Properties& value);
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutSupport& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderDrawParametersFeatures& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Features& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan11Properties& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVulkan12Features& value);
@@ -267,9 +441,64 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBufferOpaqueCaptureAddressC
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryOpaqueCaptureAddressAllocateInfo& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryOpaqueCaptureAddressInfo& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan11Features& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan11Properties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan12Features& value);
+size_t ComputeEncodedSize(const VkConformanceVersion& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkan12Properties& value);
+size_t ComputeEncodedSize(const VkImageFormatListCreateInfo& value);
+size_t ComputeEncodedSize(const VkAttachmentDescription2& value);
+size_t ComputeEncodedSize(const VkAttachmentReference2& value);
+size_t ComputeEncodedSize(const VkSubpassDescription2& value);
+size_t ComputeEncodedSize(const VkSubpassDependency2& value);
+size_t ComputeEncodedSize(const VkRenderPassCreateInfo2& value);
+size_t ComputeEncodedSize(const VkSubpassBeginInfo& value);
+size_t ComputeEncodedSize(const VkSubpassEndInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDevice8BitStorageFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceDriverProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderAtomicInt64Features& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderFloat16Int8Features& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFloatControlsProperties& value);
+size_t ComputeEncodedSize(const VkDescriptorSetLayoutBindingFlagsCreateInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceDescriptorIndexingFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceDescriptorIndexingProperties& value);
+size_t ComputeEncodedSize(const VkDescriptorSetVariableDescriptorCountAllocateInfo& value);
+size_t ComputeEncodedSize(const VkDescriptorSetVariableDescriptorCountLayoutSupport& value);
+size_t ComputeEncodedSize(const VkSubpassDescriptionDepthStencilResolve& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceDepthStencilResolveProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceScalarBlockLayoutFeatures& value);
+size_t ComputeEncodedSize(const VkImageStencilUsageCreateInfo& value);
+size_t ComputeEncodedSize(const VkSamplerReductionModeCreateInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceSamplerFilterMinmaxProperties& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceVulkanMemoryModelFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceImagelessFramebufferFeatures& value);
+size_t ComputeEncodedSize(const VkFramebufferAttachmentImageInfo& value);
+size_t ComputeEncodedSize(const VkFramebufferAttachmentsCreateInfo& value);
+size_t ComputeEncodedSize(const VkRenderPassAttachmentBeginInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& value);
+size_t ComputeEncodedSize(const VkAttachmentReferenceStencilLayout& value);
+size_t ComputeEncodedSize(const VkAttachmentDescriptionStencilLayout& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceHostQueryResetFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceTimelineSemaphoreFeatures& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceTimelineSemaphoreProperties& value);
+size_t ComputeEncodedSize(const VkSemaphoreTypeCreateInfo& value);
+size_t ComputeEncodedSize(const VkTimelineSemaphoreSubmitInfo& value);
+size_t ComputeEncodedSize(const VkSemaphoreWaitInfo& value);
+size_t ComputeEncodedSize(const VkSemaphoreSignalInfo& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceBufferDeviceAddressFeatures& value);
+size_t ComputeEncodedSize(const VkBufferDeviceAddressInfo& value);
+size_t ComputeEncodedSize(const VkBufferOpaqueCaptureAddressCreateInfo& value);
+size_t ComputeEncodedSize(const VkMemoryOpaqueCaptureAddressAllocateInfo& value);
+size_t ComputeEncodedSize(const VkDeviceMemoryOpaqueCaptureAddressInfo& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormatKHR& value);
 
+size_t ComputeEncodedSize(const VkSurfaceCapabilitiesKHR& value);
+size_t ComputeEncodedSize(const VkSurfaceFormatKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageSwapchainCreateInfoKHR& value);
@@ -279,6 +508,15 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupPresentCapabilit
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupPresentInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceGroupSwapchainCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkSwapchainCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkPresentInfoKHR& value);
+size_t ComputeEncodedSize(const VkImageSwapchainCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkBindImageMemorySwapchainInfoKHR& value);
+size_t ComputeEncodedSize(const VkAcquireNextImageInfoKHR& value);
+size_t ComputeEncodedSize(const VkDeviceGroupPresentCapabilitiesKHR& value);
+size_t ComputeEncodedSize(const VkDeviceGroupPresentInfoKHR& value);
+size_t ComputeEncodedSize(const VkDeviceGroupSwapchainCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeParametersKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModePropertiesKHR& value);
@@ -287,52 +525,106 @@ void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlanePropertiesKHR&
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPropertiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplaySurfaceCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkDisplayModeParametersKHR& value);
+size_t ComputeEncodedSize(const VkDisplayModeCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkDisplayModePropertiesKHR& value);
+size_t ComputeEncodedSize(const VkDisplayPlaneCapabilitiesKHR& value);
+size_t ComputeEncodedSize(const VkDisplayPlanePropertiesKHR& value);
+size_t ComputeEncodedSize(const VkDisplayPropertiesKHR& value);
+size_t ComputeEncodedSize(const VkDisplaySurfaceCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPresentInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkDisplayPresentInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkXlibSurfaceCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkXlibSurfaceCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkXcbSurfaceCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkXcbSurfaceCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWaylandSurfaceCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkWaylandSurfaceCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidSurfaceCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkAndroidSurfaceCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWin32SurfaceCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkWin32SurfaceCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryWin32HandleInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryWin32HandleInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryWin32HandlePropertiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetWin32HandleInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkImportMemoryWin32HandleInfoKHR& value);
+size_t ComputeEncodedSize(const VkExportMemoryWin32HandleInfoKHR& value);
+size_t ComputeEncodedSize(const VkMemoryWin32HandlePropertiesKHR& value);
+size_t ComputeEncodedSize(const VkMemoryGetWin32HandleInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryFdInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryFdPropertiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetFdInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkImportMemoryFdInfoKHR& value);
+size_t ComputeEncodedSize(const VkMemoryFdPropertiesKHR& value);
+size_t ComputeEncodedSize(const VkMemoryGetFdInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWin32KeyedMutexAcquireReleaseInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkWin32KeyedMutexAcquireReleaseInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportSemaphoreWin32HandleInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkExportSemaphoreWin32HandleInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkD3D12FenceSubmitInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreGetWin32HandleInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkImportSemaphoreWin32HandleInfoKHR& value);
+size_t ComputeEncodedSize(const VkExportSemaphoreWin32HandleInfoKHR& value);
+size_t ComputeEncodedSize(const VkD3D12FenceSubmitInfoKHR& value);
+size_t ComputeEncodedSize(const VkSemaphoreGetWin32HandleInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportSemaphoreFdInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSemaphoreGetFdInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkImportSemaphoreFdInfoKHR& value);
+size_t ComputeEncodedSize(const VkSemaphoreGetFdInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePushDescriptorPropertiesKHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePushDescriptorPropertiesKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRectLayerKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentRegionsKHR& value);
 
+size_t ComputeEncodedSize(const VkRectLayerKHR& value);
+size_t ComputeEncodedSize(const VkPresentRegionKHR& value);
+size_t ComputeEncodedSize(const VkPresentRegionsKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSharedPresentSurfaceCapabilitiesKHR& value);
 
+size_t ComputeEncodedSize(const VkSharedPresentSurfaceCapabilitiesKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceWin32HandleInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkExportFenceWin32HandleInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkFenceGetWin32HandleInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkImportFenceWin32HandleInfoKHR& value);
+size_t ComputeEncodedSize(const VkExportFenceWin32HandleInfoKHR& value);
+size_t ComputeEncodedSize(const VkFenceGetWin32HandleInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportFenceFdInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkFenceGetFdInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkImportFenceFdInfoKHR& value);
+size_t ComputeEncodedSize(const VkFenceGetFdInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePerformanceQueryFeaturesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePerformanceQueryPropertiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceCounterKHR& value);
@@ -341,31 +633,64 @@ void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolPerformanceCreateI
 void EncodeStruct(ParameterEncoder* encoder, const VkAcquireProfilingLockInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceQuerySubmitInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePerformanceQueryFeaturesKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDevicePerformanceQueryPropertiesKHR& value);
+size_t ComputeEncodedSize(const VkPerformanceCounterKHR& value);
+size_t ComputeEncodedSize(const VkPerformanceCounterDescriptionKHR& value);
+size_t ComputeEncodedSize(const VkQueryPoolPerformanceCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkAcquireProfilingLockInfoKHR& value);
+size_t ComputeEncodedSize(const VkPerformanceQuerySubmitInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSurfaceInfo2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFormat2KHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSurfaceInfo2KHR& value);
+size_t ComputeEncodedSize(const VkSurfaceCapabilities2KHR& value);
+size_t ComputeEncodedSize(const VkSurfaceFormat2KHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayProperties2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneProperties2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayModeProperties2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneInfo2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPlaneCapabilities2KHR& value);
 
+size_t ComputeEncodedSize(const VkDisplayProperties2KHR& value);
+size_t ComputeEncodedSize(const VkDisplayPlaneProperties2KHR& value);
+size_t ComputeEncodedSize(const VkDisplayModeProperties2KHR& value);
+size_t ComputeEncodedSize(const VkDisplayPlaneInfo2KHR& value);
+size_t ComputeEncodedSize(const VkDisplayPlaneCapabilities2KHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePortabilitySubsetFeaturesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePortabilitySubsetPropertiesKHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePortabilitySubsetFeaturesKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDevicePortabilitySubsetPropertiesKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderClockFeaturesKHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderClockFeaturesKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkFragmentShadingRateAttachmentInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineFragmentShadingRateStateCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateKHR& value);
 
+size_t ComputeEncodedSize(const VkFragmentShadingRateAttachmentInfoKHR& value);
+size_t ComputeEncodedSize(const VkPipelineFragmentShadingRateStateCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceProtectedCapabilitiesKHR& value);
 
+size_t ComputeEncodedSize(const VkSurfaceProtectedCapabilitiesKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutablePropertiesKHR& value);
@@ -373,8 +698,17 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableInfoKHR&
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableStatisticKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineExecutableInternalRepresentationKHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& value);
+size_t ComputeEncodedSize(const VkPipelineInfoKHR& value);
+size_t ComputeEncodedSize(const VkPipelineExecutablePropertiesKHR& value);
+size_t ComputeEncodedSize(const VkPipelineExecutableInfoKHR& value);
+size_t ComputeEncodedSize(const VkPipelineExecutableStatisticKHR& value);
+size_t ComputeEncodedSize(const VkPipelineExecutableInternalRepresentationKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineLibraryCreateInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkPipelineLibraryCreateInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferCopy2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyBufferInfo2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageCopy2KHR& value);
@@ -387,99 +721,204 @@ void EncodeStruct(ParameterEncoder* encoder, const VkBlitImageInfo2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageResolve2KHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkResolveImageInfo2KHR& value);
 
+size_t ComputeEncodedSize(const VkBufferCopy2KHR& value);
+size_t ComputeEncodedSize(const VkCopyBufferInfo2KHR& value);
+size_t ComputeEncodedSize(const VkImageCopy2KHR& value);
+size_t ComputeEncodedSize(const VkCopyImageInfo2KHR& value);
+size_t ComputeEncodedSize(const VkBufferImageCopy2KHR& value);
+size_t ComputeEncodedSize(const VkCopyBufferToImageInfo2KHR& value);
+size_t ComputeEncodedSize(const VkCopyImageToBufferInfo2KHR& value);
+size_t ComputeEncodedSize(const VkImageBlit2KHR& value);
+size_t ComputeEncodedSize(const VkBlitImageInfo2KHR& value);
+size_t ComputeEncodedSize(const VkImageResolve2KHR& value);
+size_t ComputeEncodedSize(const VkResolveImageInfo2KHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugReportCallbackCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkDebugReportCallbackCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateRasterizationOrderAMD& value);
 
+size_t ComputeEncodedSize(const VkPipelineRasterizationStateRasterizationOrderAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerObjectNameInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerObjectTagInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugMarkerMarkerInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkDebugMarkerObjectNameInfoEXT& value);
+size_t ComputeEncodedSize(const VkDebugMarkerObjectTagInfoEXT& value);
+size_t ComputeEncodedSize(const VkDebugMarkerMarkerInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationImageCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationBufferCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDedicatedAllocationMemoryAllocateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkDedicatedAllocationImageCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkDedicatedAllocationBufferCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkDedicatedAllocationMemoryAllocateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTransformFeedbackFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTransformFeedbackPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationStateStreamCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTransformFeedbackFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceTransformFeedbackPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPipelineRasterizationStateStreamCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewHandleInfoNVX& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewAddressPropertiesNVX& value);
 
+size_t ComputeEncodedSize(const VkImageViewHandleInfoNVX& value);
+size_t ComputeEncodedSize(const VkImageViewAddressPropertiesNVX& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkTextureLODGatherFormatPropertiesAMD& value);
 
+size_t ComputeEncodedSize(const VkTextureLODGatherFormatPropertiesAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderResourceUsageAMD& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderStatisticsInfoAMD& value);
 
+size_t ComputeEncodedSize(const VkShaderResourceUsageAMD& value);
+size_t ComputeEncodedSize(const VkShaderStatisticsInfoAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkStreamDescriptorSurfaceCreateInfoGGP& value);
 
+size_t ComputeEncodedSize(const VkStreamDescriptorSurfaceCreateInfoGGP& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCornerSampledImageFeaturesNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCornerSampledImageFeaturesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalImageFormatPropertiesNV& value);
 
+size_t ComputeEncodedSize(const VkExternalImageFormatPropertiesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalMemoryImageCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryAllocateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkExternalMemoryImageCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkExportMemoryAllocateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryWin32HandleInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkExportMemoryWin32HandleInfoNV& value);
 
+size_t ComputeEncodedSize(const VkImportMemoryWin32HandleInfoNV& value);
+size_t ComputeEncodedSize(const VkExportMemoryWin32HandleInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkWin32KeyedMutexAcquireReleaseInfoNV& value);
 
+size_t ComputeEncodedSize(const VkWin32KeyedMutexAcquireReleaseInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationFlagsEXT& value);
 
+size_t ComputeEncodedSize(const VkValidationFlagsEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkViSurfaceCreateInfoNN& value);
 
+size_t ComputeEncodedSize(const VkViSurfaceCreateInfoNN& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImageViewASTCDecodeModeEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceASTCDecodeFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkImageViewASTCDecodeModeEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceASTCDecodeFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkConditionalRenderingBeginInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceConditionalRenderingFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceConditionalRenderingInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkConditionalRenderingBeginInfoEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceConditionalRenderingFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkCommandBufferInheritanceConditionalRenderingInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportWScalingNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportWScalingStateCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkViewportWScalingNV& value);
+size_t ComputeEncodedSize(const VkPipelineViewportWScalingStateCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilities2EXT& value);
 
+size_t ComputeEncodedSize(const VkSurfaceCapabilities2EXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayPowerInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceEventInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayEventInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainCounterCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkDisplayPowerInfoEXT& value);
+size_t ComputeEncodedSize(const VkDeviceEventInfoEXT& value);
+size_t ComputeEncodedSize(const VkDisplayEventInfoEXT& value);
+size_t ComputeEncodedSize(const VkSwapchainCounterCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRefreshCycleDurationGOOGLE& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPastPresentationTimingGOOGLE& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimeGOOGLE& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentTimesInfoGOOGLE& value);
 
+size_t ComputeEncodedSize(const VkRefreshCycleDurationGOOGLE& value);
+size_t ComputeEncodedSize(const VkPastPresentationTimingGOOGLE& value);
+size_t ComputeEncodedSize(const VkPresentTimeGOOGLE& value);
+size_t ComputeEncodedSize(const VkPresentTimesInfoGOOGLE& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkViewportSwizzleNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportSwizzleStateCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkViewportSwizzleNV& value);
+size_t ComputeEncodedSize(const VkPipelineViewportSwizzleStateCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiscardRectanglePropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineDiscardRectangleStateCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDiscardRectanglePropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPipelineDiscardRectangleStateCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationConservativeStateCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPipelineRasterizationConservativeStateCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDepthClipEnableFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationDepthClipStateCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDepthClipEnableFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPipelineRasterizationDepthClipStateCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkXYColorEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkHdrMetadataEXT& value);
 
+size_t ComputeEncodedSize(const VkXYColorEXT& value);
+size_t ComputeEncodedSize(const VkHdrMetadataEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkIOSSurfaceCreateInfoMVK& value);
 
+size_t ComputeEncodedSize(const VkIOSSurfaceCreateInfoMVK& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMacOSSurfaceCreateInfoMVK& value);
 
+size_t ComputeEncodedSize(const VkMacOSSurfaceCreateInfoMVK& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsLabelEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsObjectNameInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsMessengerCallbackDataEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsMessengerCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDebugUtilsObjectTagInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkDebugUtilsLabelEXT& value);
+size_t ComputeEncodedSize(const VkDebugUtilsObjectNameInfoEXT& value);
+size_t ComputeEncodedSize(const VkDebugUtilsMessengerCallbackDataEXT& value);
+size_t ComputeEncodedSize(const VkDebugUtilsMessengerCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkDebugUtilsObjectTagInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferUsageANDROID& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferPropertiesANDROID& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAndroidHardwareBufferFormatPropertiesANDROID& value);
@@ -487,11 +926,23 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImportAndroidHardwareBuffer
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryGetAndroidHardwareBufferInfoANDROID& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkExternalFormatANDROID& value);
 
+size_t ComputeEncodedSize(const VkAndroidHardwareBufferUsageANDROID& value);
+size_t ComputeEncodedSize(const VkAndroidHardwareBufferPropertiesANDROID& value);
+size_t ComputeEncodedSize(const VkAndroidHardwareBufferFormatPropertiesANDROID& value);
+size_t ComputeEncodedSize(const VkImportAndroidHardwareBufferInfoANDROID& value);
+size_t ComputeEncodedSize(const VkMemoryGetAndroidHardwareBufferInfoANDROID& value);
+size_t ComputeEncodedSize(const VkExternalFormatANDROID& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInlineUniformBlockFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceInlineUniformBlockPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkWriteDescriptorSetInlineUniformBlockEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDescriptorPoolInlineUniformBlockCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceInlineUniformBlockFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceInlineUniformBlockPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkWriteDescriptorSetInlineUniformBlockEXT& value);
+size_t ComputeEncodedSize(const VkDescriptorPoolInlineUniformBlockCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSampleLocationEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSampleLocationsInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAttachmentSampleLocationsEXT& value);
@@ -501,17 +952,37 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPipelineSampleLocationsStat
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSampleLocationsPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMultisamplePropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkSampleLocationEXT& value);
+size_t ComputeEncodedSize(const VkSampleLocationsInfoEXT& value);
+size_t ComputeEncodedSize(const VkAttachmentSampleLocationsEXT& value);
+size_t ComputeEncodedSize(const VkSubpassSampleLocationsEXT& value);
+size_t ComputeEncodedSize(const VkRenderPassSampleLocationsBeginInfoEXT& value);
+size_t ComputeEncodedSize(const VkPipelineSampleLocationsStateCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceSampleLocationsPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkMultisamplePropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineColorBlendAdvancedStateCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPipelineColorBlendAdvancedStateCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageToColorStateCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkPipelineCoverageToColorStateCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageModulationStateCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkPipelineCoverageModulationStateCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDrmFormatModifierPropertiesListEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& value);
@@ -519,9 +990,19 @@ void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierListC
 void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierExplicitCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkImageDrmFormatModifierPropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkDrmFormatModifierPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkDrmFormatModifierPropertiesListEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& value);
+size_t ComputeEncodedSize(const VkImageDrmFormatModifierListCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkImageDrmFormatModifierExplicitCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkImageDrmFormatModifierPropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationCacheCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkShaderModuleValidationCacheCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkValidationCacheCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkShaderModuleValidationCacheCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkShadingRatePaletteNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportShadingRateImageStateCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShadingRateImageFeaturesNV& value);
@@ -530,6 +1011,14 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleLocationNV& val
 void EncodeStruct(ParameterEncoder* encoder, const VkCoarseSampleOrderCustomNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkShadingRatePaletteNV& value);
+size_t ComputeEncodedSize(const VkPipelineViewportShadingRateImageStateCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceShadingRateImageFeaturesNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceShadingRateImagePropertiesNV& value);
+size_t ComputeEncodedSize(const VkCoarseSampleLocationNV& value);
+size_t ComputeEncodedSize(const VkCoarseSampleOrderCustomNV& value);
+size_t ComputeEncodedSize(const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkGeometryTrianglesNV& value);
@@ -546,54 +1035,118 @@ void EncodeStruct(ParameterEncoder* encoder, const VkTransformMatrixKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAabbPositionsKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureInstanceKHR& value);
 
+size_t ComputeEncodedSize(const VkRayTracingShaderGroupCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkRayTracingPipelineCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkGeometryTrianglesNV& value);
+size_t ComputeEncodedSize(const VkGeometryAABBNV& value);
+size_t ComputeEncodedSize(const VkGeometryDataNV& value);
+size_t ComputeEncodedSize(const VkGeometryNV& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureInfoNV& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkBindAccelerationStructureMemoryInfoNV& value);
+size_t ComputeEncodedSize(const VkWriteDescriptorSetAccelerationStructureNV& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureMemoryRequirementsInfoNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayTracingPropertiesNV& value);
+size_t ComputeEncodedSize(const VkTransformMatrixKHR& value);
+size_t ComputeEncodedSize(const VkAabbPositionsKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureInstanceKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& value);
+size_t ComputeEncodedSize(const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageViewImageFormatInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkFilterCubicImageViewImageFormatPropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageViewImageFormatInfoEXT& value);
+size_t ComputeEncodedSize(const VkFilterCubicImageViewImageFormatPropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceQueueGlobalPriorityCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkDeviceQueueGlobalPriorityCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImportMemoryHostPointerInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryHostPointerPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkImportMemoryHostPointerInfoEXT& value);
+size_t ComputeEncodedSize(const VkMemoryHostPointerPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCompilerControlCreateInfoAMD& value);
 
+size_t ComputeEncodedSize(const VkPipelineCompilerControlCreateInfoAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCalibratedTimestampInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkCalibratedTimestampInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderCorePropertiesAMD& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderCorePropertiesAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryOverallocationCreateInfoAMD& value);
 
+size_t ComputeEncodedSize(const VkDeviceMemoryOverallocationCreateInfoAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkVertexInputBindingDivisorDescriptionEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineVertexInputDivisorStateCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkVertexInputBindingDivisorDescriptionEXT& value);
+size_t ComputeEncodedSize(const VkPipelineVertexInputDivisorStateCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPresentFrameTokenGGP& value);
 
+size_t ComputeEncodedSize(const VkPresentFrameTokenGGP& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCreationFeedbackEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCreationFeedbackCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPipelineCreationFeedbackEXT& value);
+size_t ComputeEncodedSize(const VkPipelineCreationFeedbackCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMeshShaderPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDrawMeshTasksIndirectCommandNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMeshShaderFeaturesNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceMeshShaderPropertiesNV& value);
+size_t ComputeEncodedSize(const VkDrawMeshTasksIndirectCommandNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageFootprintFeaturesNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderImageFootprintFeaturesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineViewportExclusiveScissorStateCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExclusiveScissorFeaturesNV& value);
 
+size_t ComputeEncodedSize(const VkPipelineViewportExclusiveScissorStateCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceExclusiveScissorFeaturesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkQueueFamilyCheckpointPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkCheckpointDataNV& value);
 
+size_t ComputeEncodedSize(const VkQueueFamilyCheckpointPropertiesNV& value);
+size_t ComputeEncodedSize(const VkCheckpointDataNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkInitializePerformanceApiInfoINTEL& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkQueryPoolPerformanceQueryCreateInfoINTEL& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceMarkerInfoINTEL& value);
@@ -601,73 +1154,147 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceStreamMarkerInfo
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceOverrideInfoINTEL& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPerformanceConfigurationAcquireInfoINTEL& value);
 
+size_t ComputeEncodedSize(const VkInitializePerformanceApiInfoINTEL& value);
+size_t ComputeEncodedSize(const VkQueryPoolPerformanceQueryCreateInfoINTEL& value);
+size_t ComputeEncodedSize(const VkPerformanceMarkerInfoINTEL& value);
+size_t ComputeEncodedSize(const VkPerformanceStreamMarkerInfoINTEL& value);
+size_t ComputeEncodedSize(const VkPerformanceOverrideInfoINTEL& value);
+size_t ComputeEncodedSize(const VkPerformanceConfigurationAcquireInfoINTEL& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePCIBusInfoPropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePCIBusInfoPropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDisplayNativeHdrSurfaceCapabilitiesAMD& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSwapchainDisplayNativeHdrCreateInfoAMD& value);
 
+size_t ComputeEncodedSize(const VkDisplayNativeHdrSurfaceCapabilitiesAMD& value);
+size_t ComputeEncodedSize(const VkSwapchainDisplayNativeHdrCreateInfoAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkImagePipeSurfaceCreateInfoFUCHSIA& value);
 
+size_t ComputeEncodedSize(const VkImagePipeSurfaceCreateInfoFUCHSIA& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkMetalSurfaceCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkMetalSurfaceCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassFragmentDensityMapCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkRenderPassFragmentDensityMapCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupSizeControlFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceSubgroupSizeControlPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceSubgroupSizeControlFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceSubgroupSizeControlPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderCoreProperties2AMD& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderCoreProperties2AMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCoherentMemoryFeaturesAMD& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCoherentMemoryFeaturesAMD& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryBudgetPropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryBudgetPropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMemoryPriorityFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMemoryPriorityAllocateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMemoryPriorityFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkMemoryPriorityAllocateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkBufferDeviceAddressCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkBufferDeviceAddressCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceToolPropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceToolPropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkValidationFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkValidationFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCooperativeMatrixPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCooperativeMatrixFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCooperativeMatrixPropertiesNV& value);
 
+size_t ComputeEncodedSize(const VkCooperativeMatrixPropertiesNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceCooperativeMatrixFeaturesNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceCooperativeMatrixPropertiesNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCoverageReductionModeFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineCoverageReductionStateCreateInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkFramebufferMixedSamplesCombinationNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceCoverageReductionModeFeaturesNV& value);
+size_t ComputeEncodedSize(const VkPipelineCoverageReductionStateCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkFramebufferMixedSamplesCombinationNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFullScreenExclusiveInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceCapabilitiesFullScreenExclusiveEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkSurfaceFullScreenExclusiveWin32InfoEXT& value);
 
+size_t ComputeEncodedSize(const VkSurfaceFullScreenExclusiveInfoEXT& value);
+size_t ComputeEncodedSize(const VkSurfaceCapabilitiesFullScreenExclusiveEXT& value);
+size_t ComputeEncodedSize(const VkSurfaceFullScreenExclusiveWin32InfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkHeadlessSurfaceCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkHeadlessSurfaceCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLineRasterizationFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceLineRasterizationPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineRasterizationLineStateCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceLineRasterizationFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceLineRasterizationPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPipelineRasterizationLineStateCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkGraphicsShaderGroupCreateInfoNV& value);
@@ -682,51 +1309,110 @@ void EncodeStruct(ParameterEncoder* encoder, const VkIndirectCommandsLayoutCreat
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsInfoNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkGeneratedCommandsMemoryRequirementsInfoNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& value);
+size_t ComputeEncodedSize(const VkGraphicsShaderGroupCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkGraphicsPipelineShaderGroupsCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkBindShaderGroupIndirectCommandNV& value);
+size_t ComputeEncodedSize(const VkBindIndexBufferIndirectCommandNV& value);
+size_t ComputeEncodedSize(const VkBindVertexBufferIndirectCommandNV& value);
+size_t ComputeEncodedSize(const VkSetStateFlagsIndirectCommandNV& value);
+size_t ComputeEncodedSize(const VkIndirectCommandsStreamNV& value);
+size_t ComputeEncodedSize(const VkIndirectCommandsLayoutTokenNV& value);
+size_t ComputeEncodedSize(const VkIndirectCommandsLayoutCreateInfoNV& value);
+size_t ComputeEncodedSize(const VkGeneratedCommandsInfoNV& value);
+size_t ComputeEncodedSize(const VkGeneratedCommandsMemoryRequirementsInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRenderPassTransformBeginInfoQCOM& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& value);
 
+size_t ComputeEncodedSize(const VkRenderPassTransformBeginInfoQCOM& value);
+size_t ComputeEncodedSize(const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceMemoryReportCallbackDataEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceDeviceMemoryReportCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkDeviceMemoryReportCallbackDataEXT& value);
+size_t ComputeEncodedSize(const VkDeviceDeviceMemoryReportCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRobustness2FeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRobustness2PropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRobustness2FeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceRobustness2PropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkSamplerCustomBorderColorCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCustomBorderColorPropertiesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceCustomBorderColorFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkSamplerCustomBorderColorCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceCustomBorderColorPropertiesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceCustomBorderColorFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePrivateDataFeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDevicePrivateDataCreateInfoEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPrivateDataSlotCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePrivateDataFeaturesEXT& value);
+size_t ComputeEncodedSize(const VkDevicePrivateDataCreateInfoEXT& value);
+size_t ComputeEncodedSize(const VkPrivateDataSlotCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkDeviceDiagnosticsConfigCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& value);
+size_t ComputeEncodedSize(const VkDeviceDiagnosticsConfigCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& value);
+size_t ComputeEncodedSize(const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyCommandTransformInfoQCOM& value);
 
+size_t ComputeEncodedSize(const VkCopyCommandTransformInfoQCOM& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceImageRobustnessFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceImageRobustnessFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDevice4444FormatsFeaturesEXT& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDevice4444FormatsFeaturesEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkDirectFBSurfaceCreateInfoEXT& value);
 
+size_t ComputeEncodedSize(const VkDirectFBSurfaceCreateInfoEXT& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMutableDescriptorTypeListVALVE& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkMutableDescriptorTypeCreateInfoVALVE& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE& value);
+size_t ComputeEncodedSize(const VkMutableDescriptorTypeListVALVE& value);
+size_t ComputeEncodedSize(const VkMutableDescriptorTypeCreateInfoVALVE& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildRangeInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryTrianglesDataKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureGeometryAabbsDataKHR& value);
@@ -743,6 +1429,22 @@ void EncodeStruct(ParameterEncoder* encoder, const VkCopyMemoryToAccelerationStr
 void EncodeStruct(ParameterEncoder* encoder, const VkCopyAccelerationStructureInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkAccelerationStructureBuildSizesInfoKHR& value);
 
+size_t ComputeEncodedSize(const VkAccelerationStructureBuildRangeInfoKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryTrianglesDataKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryAabbsDataKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureGeometryInstancesDataKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureBuildGeometryInfoKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkWriteDescriptorSetAccelerationStructureKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceAccelerationStructureFeaturesKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceAccelerationStructurePropertiesKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureDeviceAddressInfoKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureVersionInfoKHR& value);
+size_t ComputeEncodedSize(const VkCopyAccelerationStructureToMemoryInfoKHR& value);
+size_t ComputeEncodedSize(const VkCopyMemoryToAccelerationStructureInfoKHR& value);
+size_t ComputeEncodedSize(const VkCopyAccelerationStructureInfoKHR& value);
+size_t ComputeEncodedSize(const VkAccelerationStructureBuildSizesInfoKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingShaderGroupCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineInterfaceCreateInfoKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkRayTracingPipelineCreateInfoKHR& value);
@@ -751,8 +1453,18 @@ void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayTracingPip
 void EncodeStruct(ParameterEncoder* encoder, const VkStridedDeviceAddressRegionKHR& value);
 void EncodeStruct(ParameterEncoder* encoder, const VkTraceRaysIndirectCommandKHR& value);
 
+size_t ComputeEncodedSize(const VkRayTracingShaderGroupCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkRayTracingPipelineInterfaceCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkRayTracingPipelineCreateInfoKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& value);
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& value);
+size_t ComputeEncodedSize(const VkStridedDeviceAddressRegionKHR& value);
+size_t ComputeEncodedSize(const VkTraceRaysIndirectCommandKHR& value);
+
 void EncodeStruct(ParameterEncoder* encoder, const VkPhysicalDeviceRayQueryFeaturesKHR& value);
 
+size_t ComputeEncodedSize(const VkPhysicalDeviceRayQueryFeaturesKHR& value);
+
 GFXRECON_END_NAMESPACE(encode)
 GFXRECON_END_NAMESPACE(gfxrecon)
 
@@ -0,0 +1,8501 @@
+/*
+** Copyright (c) 2018-2020 Valve Corporation
+** Copyright (c) 2018-2020 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+** This file is generated from the Khronos Vulkan XML API Registry.
+**
+*/
+
+#include "generated/generated_vulkan_struct_to_json.h"
+
+#include "decode/vulkan_json_util.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExtent2D& data)
+{
+    const VkExtent2D& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "width", value.width);
+    FieldToJson(writer, "height", value.height);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExtent3D& data)
+{
+    const VkExtent3D& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "width", value.width);
+    FieldToJson(writer, "height", value.height);
+    FieldToJson(writer, "depth", value.depth);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkOffset2D& data)
+{
+    const VkOffset2D& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "x", value.x);
+    FieldToJson(writer, "y", value.y);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkOffset3D& data)
+{
+    const VkOffset3D& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "x", value.x);
+    FieldToJson(writer, "y", value.y);
+    FieldToJson(writer, "z", value.z);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRect2D& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "offset", data.offset);
+    FieldToJson(writer, "extent", data.extent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferMemoryBarrier& data)
+{
+    const VkBufferMemoryBarrier& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcAccessMask", value.srcAccessMask);
+    FieldToJson(writer, "dstAccessMask", value.dstAccessMask);
+    FieldToJson(writer, "srcQueueFamilyIndex", value.srcQueueFamilyIndex);
+    FieldToJson(writer, "dstQueueFamilyIndex", value.dstQueueFamilyIndex);
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDispatchIndirectCommand& data)
+{
+    const VkDispatchIndirectCommand& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "x", value.x);
+    FieldToJson(writer, "y", value.y);
+    FieldToJson(writer, "z", value.z);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrawIndexedIndirectCommand& data)
+{
+    const VkDrawIndexedIndirectCommand& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "indexCount", value.indexCount);
+    FieldToJson(writer, "instanceCount", value.instanceCount);
+    FieldToJson(writer, "firstIndex", value.firstIndex);
+    FieldToJson(writer, "vertexOffset", value.vertexOffset);
+    FieldToJson(writer, "firstInstance", value.firstInstance);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrawIndirectCommand& data)
+{
+    const VkDrawIndirectCommand& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "vertexCount", value.vertexCount);
+    FieldToJson(writer, "instanceCount", value.instanceCount);
+    FieldToJson(writer, "firstVertex", value.firstVertex);
+    FieldToJson(writer, "firstInstance", value.firstInstance);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSubresourceRange& data)
+{
+    const VkImageSubresourceRange& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "aspectMask", value.aspectMask);
+    FieldToJson(writer, "baseMipLevel", value.baseMipLevel);
+    FieldToJson(writer, "levelCount", value.levelCount);
+    FieldToJson(writer, "baseArrayLayer", value.baseArrayLayer);
+    FieldToJson(writer, "layerCount", value.layerCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageMemoryBarrier& data)
+{
+    const VkImageMemoryBarrier& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcAccessMask", value.srcAccessMask);
+    FieldToJson(writer, "dstAccessMask", value.dstAccessMask);
+    FieldToJson(writer, "oldLayout", value.oldLayout);
+    FieldToJson(writer, "newLayout", value.newLayout);
+    FieldToJson(writer, "srcQueueFamilyIndex", value.srcQueueFamilyIndex);
+    FieldToJson(writer, "dstQueueFamilyIndex", value.dstQueueFamilyIndex);
+    FieldToJson(writer, "image", data.image);
+    FieldToJson(writer, "subresourceRange", data.subresourceRange);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryBarrier& data)
+{
+    const VkMemoryBarrier& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcAccessMask", value.srcAccessMask);
+    FieldToJson(writer, "dstAccessMask", value.dstAccessMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAllocationCallbacks& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "pUserData", data.pUserData);
+    FieldToJson(writer, "pfnAllocation", data.pfnAllocation);
+    FieldToJson(writer, "pfnReallocation", data.pfnReallocation);
+    FieldToJson(writer, "pfnFree", data.pfnFree);
+    FieldToJson(writer, "pfnInternalAllocation", data.pfnInternalAllocation);
+    FieldToJson(writer, "pfnInternalFree", data.pfnInternalFree);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkApplicationInfo& data)
+{
+    const VkApplicationInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pApplicationName", data.pApplicationName);
+    FieldToJson(writer, "applicationVersion", value.applicationVersion);
+    FieldToJson(writer, "pEngineName", data.pEngineName);
+    FieldToJson(writer, "engineVersion", value.engineVersion);
+    FieldToJson(writer, "apiVersion", value.apiVersion);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFormatProperties& data)
+{
+    const VkFormatProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "linearTilingFeatures", value.linearTilingFeatures);
+    FieldToJson(writer, "optimalTilingFeatures", value.optimalTilingFeatures);
+    FieldToJson(writer, "bufferFeatures", value.bufferFeatures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageFormatProperties& data)
+{
+    const VkImageFormatProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "maxExtent", data.maxExtent);
+    FieldToJson(writer, "maxMipLevels", value.maxMipLevels);
+    FieldToJson(writer, "maxArrayLayers", value.maxArrayLayers);
+    FieldToJson(writer, "sampleCounts", value.sampleCounts);
+    FieldToJson(writer, "maxResourceSize", value.maxResourceSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkInstanceCreateInfo& data)
+{
+    const VkInstanceCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pApplicationInfo", data.pApplicationInfo);
+    FieldToJson(writer, "enabledLayerCount", value.enabledLayerCount);
+    FieldToJson(writer, "ppEnabledLayerNames", data.ppEnabledLayerNames);
+    FieldToJson(writer, "enabledExtensionCount", value.enabledExtensionCount);
+    FieldToJson(writer, "ppEnabledExtensionNames", data.ppEnabledExtensionNames);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryHeap& data)
+{
+    const VkMemoryHeap& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryType& data)
+{
+    const VkMemoryType& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "propertyFlags", value.propertyFlags);
+    FieldToJson(writer, "heapIndex", value.heapIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFeatures& data)
+{
+    const VkPhysicalDeviceFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "robustBufferAccess", value.robustBufferAccess);
+    FieldToJson(writer, "fullDrawIndexUint32", value.fullDrawIndexUint32);
+    FieldToJson(writer, "imageCubeArray", value.imageCubeArray);
+    FieldToJson(writer, "independentBlend", value.independentBlend);
+    FieldToJson(writer, "geometryShader", value.geometryShader);
+    FieldToJson(writer, "tessellationShader", value.tessellationShader);
+    FieldToJson(writer, "sampleRateShading", value.sampleRateShading);
+    FieldToJson(writer, "dualSrcBlend", value.dualSrcBlend);
+    FieldToJson(writer, "logicOp", value.logicOp);
+    FieldToJson(writer, "multiDrawIndirect", value.multiDrawIndirect);
+    FieldToJson(writer, "drawIndirectFirstInstance", value.drawIndirectFirstInstance);
+    FieldToJson(writer, "depthClamp", value.depthClamp);
+    FieldToJson(writer, "depthBiasClamp", value.depthBiasClamp);
+    FieldToJson(writer, "fillModeNonSolid", value.fillModeNonSolid);
+    FieldToJson(writer, "depthBounds", value.depthBounds);
+    FieldToJson(writer, "wideLines", value.wideLines);
+    FieldToJson(writer, "largePoints", value.largePoints);
+    FieldToJson(writer, "alphaToOne", value.alphaToOne);
+    FieldToJson(writer, "multiViewport", value.multiViewport);
+    FieldToJson(writer, "samplerAnisotropy", value.samplerAnisotropy);
+    FieldToJson(writer, "textureCompressionETC2", value.textureCompressionETC2);
+    FieldToJson(writer, "textureCompressionASTC_LDR", value.textureCompressionASTC_LDR);
+    FieldToJson(writer, "textureCompressionBC", value.textureCompressionBC);
+    FieldToJson(writer, "occlusionQueryPrecise", value.occlusionQueryPrecise);
+    FieldToJson(writer, "pipelineStatisticsQuery", value.pipelineStatisticsQuery);
+    FieldToJson(writer, "vertexPipelineStoresAndAtomics", value.vertexPipelineStoresAndAtomics);
+    FieldToJson(writer, "fragmentStoresAndAtomics", value.fragmentStoresAndAtomics);
+    FieldToJson(writer, "shaderTessellationAndGeometryPointSize", value.shaderTessellationAndGeometryPointSize);
+    FieldToJson(writer, "shaderImageGatherExtended", value.shaderImageGatherExtended);
+    FieldToJson(writer, "shaderStorageImageExtendedFormats", value.shaderStorageImageExtendedFormats);
+    FieldToJson(writer, "shaderStorageImageMultisample", value.shaderStorageImageMultisample);
+    FieldToJson(writer, "shaderStorageImageReadWithoutFormat", value.shaderStorageImageReadWithoutFormat);
+    FieldToJson(writer, "shaderStorageImageWriteWithoutFormat", value.shaderStorageImageWriteWithoutFormat);
+    FieldToJson(writer, "shaderUniformBufferArrayDynamicIndexing", value.shaderUniformBufferArrayDynamicIndexing);
+    FieldToJson(writer, "shaderSampledImageArrayDynamicIndexing", value.shaderSampledImageArrayDynamicIndexing);
+    FieldToJson(writer, "shaderStorageBufferArrayDynamicIndexing", value.shaderStorageBufferArrayDynamicIndexing);
+    FieldToJson(writer, "shaderStorageImageArrayDynamicIndexing", value.shaderStorageImageArrayDynamicIndexing);
+    FieldToJson(writer, "shaderClipDistance", value.shaderClipDistance);
+    FieldToJson(writer, "shaderCullDistance", value.shaderCullDistance);
+    FieldToJson(writer, "shaderFloat64", value.shaderFloat64);
+    FieldToJson(writer, "shaderInt64", value.shaderInt64);
+    FieldToJson(writer, "shaderInt16", value.shaderInt16);
+    FieldToJson(writer, "shaderResourceResidency", value.shaderResourceResidency);
+    FieldToJson(writer, "shaderResourceMinLod", value.shaderResourceMinLod);
+    FieldToJson(writer, "sparseBinding", value.sparseBinding);
+    FieldToJson(writer, "sparseResidencyBuffer", value.sparseResidencyBuffer);
+    FieldToJson(writer, "sparseResidencyImage2D", value.sparseResidencyImage2D);
+    FieldToJson(writer, "sparseResidencyImage3D", value.sparseResidencyImage3D);
+    FieldToJson(writer, "sparseResidency2Samples", value.sparseResidency2Samples);
+    FieldToJson(writer, "sparseResidency4Samples", value.sparseResidency4Samples);
+    FieldToJson(writer, "sparseResidency8Samples", value.sparseResidency8Samples);
+    FieldToJson(writer, "sparseResidency16Samples", value.sparseResidency16Samples);
+    FieldToJson(writer, "sparseResidencyAliased", value.sparseResidencyAliased);
+    FieldToJson(writer, "variableMultisampleRate", value.variableMultisampleRate);
+    FieldToJson(writer, "inheritedQueries", value.inheritedQueries);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceLimits& data)
+{
+    const VkPhysicalDeviceLimits& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "maxImageDimension1D", value.maxImageDimension1D);
+    FieldToJson(writer, "maxImageDimension2D", value.maxImageDimension2D);
+    FieldToJson(writer, "maxImageDimension3D", value.maxImageDimension3D);
+    FieldToJson(writer, "maxImageDimensionCube", value.maxImageDimensionCube);
+    FieldToJson(writer, "maxImageArrayLayers", value.maxImageArrayLayers);
+    FieldToJson(writer, "maxTexelBufferElements", value.maxTexelBufferElements);
+    FieldToJson(writer, "maxUniformBufferRange", value.maxUniformBufferRange);
+    FieldToJson(writer, "maxStorageBufferRange", value.maxStorageBufferRange);
+    FieldToJson(writer, "maxPushConstantsSize", value.maxPushConstantsSize);
+    FieldToJson(writer, "maxMemoryAllocationCount", value.maxMemoryAllocationCount);
+    FieldToJson(writer, "maxSamplerAllocationCount", value.maxSamplerAllocationCount);
+    FieldToJson(writer, "bufferImageGranularity", value.bufferImageGranularity);
+    FieldToJson(writer, "sparseAddressSpaceSize", value.sparseAddressSpaceSize);
+    FieldToJson(writer, "maxBoundDescriptorSets", value.maxBoundDescriptorSets);
+    FieldToJson(writer, "maxPerStageDescriptorSamplers", value.maxPerStageDescriptorSamplers);
+    FieldToJson(writer, "maxPerStageDescriptorUniformBuffers", value.maxPerStageDescriptorUniformBuffers);
+    FieldToJson(writer, "maxPerStageDescriptorStorageBuffers", value.maxPerStageDescriptorStorageBuffers);
+    FieldToJson(writer, "maxPerStageDescriptorSampledImages", value.maxPerStageDescriptorSampledImages);
+    FieldToJson(writer, "maxPerStageDescriptorStorageImages", value.maxPerStageDescriptorStorageImages);
+    FieldToJson(writer, "maxPerStageDescriptorInputAttachments", value.maxPerStageDescriptorInputAttachments);
+    FieldToJson(writer, "maxPerStageResources", value.maxPerStageResources);
+    FieldToJson(writer, "maxDescriptorSetSamplers", value.maxDescriptorSetSamplers);
+    FieldToJson(writer, "maxDescriptorSetUniformBuffers", value.maxDescriptorSetUniformBuffers);
+    FieldToJson(writer, "maxDescriptorSetUniformBuffersDynamic", value.maxDescriptorSetUniformBuffersDynamic);
+    FieldToJson(writer, "maxDescriptorSetStorageBuffers", value.maxDescriptorSetStorageBuffers);
+    FieldToJson(writer, "maxDescriptorSetStorageBuffersDynamic", value.maxDescriptorSetStorageBuffersDynamic);
+    FieldToJson(writer, "maxDescriptorSetSampledImages", value.maxDescriptorSetSampledImages);
+    FieldToJson(writer, "maxDescriptorSetStorageImages", value.maxDescriptorSetStorageImages);
+    FieldToJson(writer, "maxDescriptorSetInputAttachments", value.maxDescriptorSetInputAttachments);
+    FieldToJson(writer, "maxVertexInputAttributes", value.maxVertexInputAttributes);
+    FieldToJson(writer, "maxVertexInputBindings", value.maxVertexInputBindings);
+    FieldToJson(writer, "maxVertexInputAttributeOffset", value.maxVertexInputAttributeOffset);
+    FieldToJson(writer, "maxVertexInputBindingStride", value.maxVertexInputBindingStride);
+    FieldToJson(writer, "maxVertexOutputComponents", value.maxVertexOutputComponents);
+    FieldToJson(writer, "maxTessellationGenerationLevel", value.maxTessellationGenerationLevel);
+    FieldToJson(writer, "maxTessellationPatchSize", value.maxTessellationPatchSize);
+    FieldToJson(writer, "maxTessellationControlPerVertexInputComponents", value.maxTessellationControlPerVertexInputComponents);
+    FieldToJson(writer, "maxTessellationControlPerVertexOutputComponents", value.maxTessellationControlPerVertexOutputComponents);
+    FieldToJson(writer, "maxTessellationControlPerPatchOutputComponents", value.maxTessellationControlPerPatchOutputComponents);
+    FieldToJson(writer, "maxTessellationControlTotalOutputComponents", value.maxTessellationControlTotalOutputComponents);
+    FieldToJson(writer, "maxTessellationEvaluationInputComponents", value.maxTessellationEvaluationInputComponents);
+    FieldToJson(writer, "maxTessellationEvaluationOutputComponents", value.maxTessellationEvaluationOutputComponents);
+    FieldToJson(writer, "maxGeometryShaderInvocations", value.maxGeometryShaderInvocations);
+    FieldToJson(writer, "maxGeometryInputComponents", value.maxGeometryInputComponents);
+    FieldToJson(writer, "maxGeometryOutputComponents", value.maxGeometryOutputComponents);
+    FieldToJson(writer, "maxGeometryOutputVertices", value.maxGeometryOutputVertices);
+    FieldToJson(writer, "maxGeometryTotalOutputComponents", value.maxGeometryTotalOutputComponents);
+    FieldToJson(writer, "maxFragmentInputComponents", value.maxFragmentInputComponents);
+    FieldToJson(writer, "maxFragmentOutputAttachments", value.maxFragmentOutputAttachments);
+    FieldToJson(writer, "maxFragmentDualSrcAttachments", value.maxFragmentDualSrcAttachments);
+    FieldToJson(writer, "maxFragmentCombinedOutputResources", value.maxFragmentCombinedOutputResources);
+    FieldToJson(writer, "maxComputeSharedMemorySize", value.maxComputeSharedMemorySize);
+    FieldToJson(writer, "maxComputeWorkGroupCount", data.maxComputeWorkGroupCount);
+    FieldToJson(writer, "maxComputeWorkGroupInvocations", value.maxComputeWorkGroupInvocations);
+    FieldToJson(writer, "maxComputeWorkGroupSize", data.maxComputeWorkGroupSize);
+    FieldToJson(writer, "subPixelPrecisionBits", value.subPixelPrecisionBits);
+    FieldToJson(writer, "subTexelPrecisionBits", value.subTexelPrecisionBits);
+    FieldToJson(writer, "mipmapPrecisionBits", value.mipmapPrecisionBits);
+    FieldToJson(writer, "maxDrawIndexedIndexValue", value.maxDrawIndexedIndexValue);
+    FieldToJson(writer, "maxDrawIndirectCount", value.maxDrawIndirectCount);
+    FieldToJson(writer, "maxSamplerLodBias", value.maxSamplerLodBias);
+    FieldToJson(writer, "maxSamplerAnisotropy", value.maxSamplerAnisotropy);
+    FieldToJson(writer, "maxViewports", value.maxViewports);
+    FieldToJson(writer, "maxViewportDimensions", data.maxViewportDimensions);
+    FieldToJson(writer, "viewportBoundsRange", data.viewportBoundsRange);
+    FieldToJson(writer, "viewportSubPixelBits", value.viewportSubPixelBits);
+    FieldToJson(writer, "minMemoryMapAlignment", value.minMemoryMapAlignment);
+    FieldToJson(writer, "minTexelBufferOffsetAlignment", value.minTexelBufferOffsetAlignment);
+    FieldToJson(writer, "minUniformBufferOffsetAlignment", value.minUniformBufferOffsetAlignment);
+    FieldToJson(writer, "minStorageBufferOffsetAlignment", value.minStorageBufferOffsetAlignment);
+    FieldToJson(writer, "minTexelOffset", value.minTexelOffset);
+    FieldToJson(writer, "maxTexelOffset", value.maxTexelOffset);
+    FieldToJson(writer, "minTexelGatherOffset", value.minTexelGatherOffset);
+    FieldToJson(writer, "maxTexelGatherOffset", value.maxTexelGatherOffset);
+    FieldToJson(writer, "minInterpolationOffset", value.minInterpolationOffset);
+    FieldToJson(writer, "maxInterpolationOffset", value.maxInterpolationOffset);
+    FieldToJson(writer, "subPixelInterpolationOffsetBits", value.subPixelInterpolationOffsetBits);
+    FieldToJson(writer, "maxFramebufferWidth", value.maxFramebufferWidth);
+    FieldToJson(writer, "maxFramebufferHeight", value.maxFramebufferHeight);
+    FieldToJson(writer, "maxFramebufferLayers", value.maxFramebufferLayers);
+    FieldToJson(writer, "framebufferColorSampleCounts", value.framebufferColorSampleCounts);
+    FieldToJson(writer, "framebufferDepthSampleCounts", value.framebufferDepthSampleCounts);
+    FieldToJson(writer, "framebufferStencilSampleCounts", value.framebufferStencilSampleCounts);
+    FieldToJson(writer, "framebufferNoAttachmentsSampleCounts", value.framebufferNoAttachmentsSampleCounts);
+    FieldToJson(writer, "maxColorAttachments", value.maxColorAttachments);
+    FieldToJson(writer, "sampledImageColorSampleCounts", value.sampledImageColorSampleCounts);
+    FieldToJson(writer, "sampledImageIntegerSampleCounts", value.sampledImageIntegerSampleCounts);
+    FieldToJson(writer, "sampledImageDepthSampleCounts", value.sampledImageDepthSampleCounts);
+    FieldToJson(writer, "sampledImageStencilSampleCounts", value.sampledImageStencilSampleCounts);
+    FieldToJson(writer, "storageImageSampleCounts", value.storageImageSampleCounts);
+    FieldToJson(writer, "maxSampleMaskWords", value.maxSampleMaskWords);
+    FieldToJson(writer, "timestampComputeAndGraphics", value.timestampComputeAndGraphics);
+    FieldToJson(writer, "timestampPeriod", value.timestampPeriod);
+    FieldToJson(writer, "maxClipDistances", value.maxClipDistances);
+    FieldToJson(writer, "maxCullDistances", value.maxCullDistances);
+    FieldToJson(writer, "maxCombinedClipAndCullDistances", value.maxCombinedClipAndCullDistances);
+    FieldToJson(writer, "discreteQueuePriorities", value.discreteQueuePriorities);
+    FieldToJson(writer, "pointSizeRange", data.pointSizeRange);
+    FieldToJson(writer, "lineWidthRange", data.lineWidthRange);
+    FieldToJson(writer, "pointSizeGranularity", value.pointSizeGranularity);
+    FieldToJson(writer, "lineWidthGranularity", value.lineWidthGranularity);
+    FieldToJson(writer, "strictLines", value.strictLines);
+    FieldToJson(writer, "standardSampleLocations", value.standardSampleLocations);
+    FieldToJson(writer, "optimalBufferCopyOffsetAlignment", value.optimalBufferCopyOffsetAlignment);
+    FieldToJson(writer, "optimalBufferCopyRowPitchAlignment", value.optimalBufferCopyRowPitchAlignment);
+    FieldToJson(writer, "nonCoherentAtomSize", value.nonCoherentAtomSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryProperties& data)
+{
+    const VkPhysicalDeviceMemoryProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "memoryTypeCount", value.memoryTypeCount);
+    FieldToJson(writer, "memoryTypes", data.memoryTypes);
+    FieldToJson(writer, "memoryHeapCount", value.memoryHeapCount);
+    FieldToJson(writer, "memoryHeaps", data.memoryHeaps);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSparseProperties& data)
+{
+    const VkPhysicalDeviceSparseProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "residencyStandard2DBlockShape", value.residencyStandard2DBlockShape);
+    FieldToJson(writer, "residencyStandard2DMultisampleBlockShape", value.residencyStandard2DMultisampleBlockShape);
+    FieldToJson(writer, "residencyStandard3DBlockShape", value.residencyStandard3DBlockShape);
+    FieldToJson(writer, "residencyAlignedMipSize", value.residencyAlignedMipSize);
+    FieldToJson(writer, "residencyNonResidentStrict", value.residencyNonResidentStrict);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProperties& data)
+{
+    const VkPhysicalDeviceProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "apiVersion", value.apiVersion);
+    FieldToJson(writer, "driverVersion", value.driverVersion);
+    FieldToJson(writer, "vendorID", value.vendorID);
+    FieldToJson(writer, "deviceID", value.deviceID);
+    FieldToJson(writer, "deviceType", value.deviceType);
+    FieldToJson(writer, "deviceName", data.deviceName);
+    FieldToJson(writer, "pipelineCacheUUID", data.pipelineCacheUUID);
+    FieldToJson(writer, "limits", data.limits);
+    FieldToJson(writer, "sparseProperties", data.sparseProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueueFamilyProperties& data)
+{
+    const VkQueueFamilyProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "queueFlags", value.queueFlags);
+    FieldToJson(writer, "queueCount", value.queueCount);
+    FieldToJson(writer, "timestampValidBits", value.timestampValidBits);
+    FieldToJson(writer, "minImageTransferGranularity", data.minImageTransferGranularity);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceQueueCreateInfo& data)
+{
+    const VkDeviceQueueCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "queueFamilyIndex", value.queueFamilyIndex);
+    FieldToJson(writer, "queueCount", value.queueCount);
+    FieldToJson(writer, "pQueuePriorities", data.pQueuePriorities);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceCreateInfo& data)
+{
+    const VkDeviceCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "queueCreateInfoCount", value.queueCreateInfoCount);
+    FieldToJson(writer, "pQueueCreateInfos", data.pQueueCreateInfos);
+    FieldToJson(writer, "enabledLayerCount", value.enabledLayerCount);
+    FieldToJson(writer, "ppEnabledLayerNames", data.ppEnabledLayerNames);
+    FieldToJson(writer, "enabledExtensionCount", value.enabledExtensionCount);
+    FieldToJson(writer, "ppEnabledExtensionNames", data.ppEnabledExtensionNames);
+    FieldToJson(writer, "pEnabledFeatures", data.pEnabledFeatures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExtensionProperties& data)
+{
+    const VkExtensionProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "extensionName", data.extensionName);
+    FieldToJson(writer, "specVersion", value.specVersion);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkLayerProperties& data)
+{
+    const VkLayerProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "layerName", data.layerName);
+    FieldToJson(writer, "specVersion", value.specVersion);
+    FieldToJson(writer, "implementationVersion", value.implementationVersion);
+    FieldToJson(writer, "description", data.description);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubmitInfo& data)
+{
+    const VkSubmitInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "waitSemaphoreCount", value.waitSemaphoreCount);
+    FieldToJson(writer, "pWaitSemaphores", data.pWaitSemaphores);
+    FieldToJson(writer, "pWaitDstStageMask", data.pWaitDstStageMask);
+    FieldToJson(writer, "commandBufferCount", value.commandBufferCount);
+    FieldToJson(writer, "pCommandBuffers", data.pCommandBuffers);
+    FieldToJson(writer, "signalSemaphoreCount", value.signalSemaphoreCount);
+    FieldToJson(writer, "pSignalSemaphores", data.pSignalSemaphores);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMappedMemoryRange& data)
+{
+    const VkMappedMemoryRange& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryAllocateInfo& data)
+{
+    const VkMemoryAllocateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "allocationSize", value.allocationSize);
+    FieldToJson(writer, "memoryTypeIndex", value.memoryTypeIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryRequirements& data)
+{
+    const VkMemoryRequirements& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "alignment", value.alignment);
+    FieldToJson(writer, "memoryTypeBits", value.memoryTypeBits);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseMemoryBind& data)
+{
+    const VkSparseMemoryBind& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "resourceOffset", value.resourceOffset);
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "memoryOffset", value.memoryOffset);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseBufferMemoryBindInfo& data)
+{
+    const VkSparseBufferMemoryBindInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "bindCount", value.bindCount);
+    FieldToJson(writer, "pBinds", data.pBinds);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageOpaqueMemoryBindInfo& data)
+{
+    const VkSparseImageOpaqueMemoryBindInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "image", data.image);
+    FieldToJson(writer, "bindCount", value.bindCount);
+    FieldToJson(writer, "pBinds", data.pBinds);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSubresource& data)
+{
+    const VkImageSubresource& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "aspectMask", value.aspectMask);
+    FieldToJson(writer, "mipLevel", value.mipLevel);
+    FieldToJson(writer, "arrayLayer", value.arrayLayer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryBind& data)
+{
+    const VkSparseImageMemoryBind& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "subresource", data.subresource);
+    FieldToJson(writer, "offset", data.offset);
+    FieldToJson(writer, "extent", data.extent);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "memoryOffset", value.memoryOffset);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryBindInfo& data)
+{
+    const VkSparseImageMemoryBindInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "image", data.image);
+    FieldToJson(writer, "bindCount", value.bindCount);
+    FieldToJson(writer, "pBinds", data.pBinds);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindSparseInfo& data)
+{
+    const VkBindSparseInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "waitSemaphoreCount", value.waitSemaphoreCount);
+    FieldToJson(writer, "pWaitSemaphores", data.pWaitSemaphores);
+    FieldToJson(writer, "bufferBindCount", value.bufferBindCount);
+    FieldToJson(writer, "pBufferBinds", data.pBufferBinds);
+    FieldToJson(writer, "imageOpaqueBindCount", value.imageOpaqueBindCount);
+    FieldToJson(writer, "pImageOpaqueBinds", data.pImageOpaqueBinds);
+    FieldToJson(writer, "imageBindCount", value.imageBindCount);
+    FieldToJson(writer, "pImageBinds", data.pImageBinds);
+    FieldToJson(writer, "signalSemaphoreCount", value.signalSemaphoreCount);
+    FieldToJson(writer, "pSignalSemaphores", data.pSignalSemaphores);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageFormatProperties& data)
+{
+    const VkSparseImageFormatProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "aspectMask", value.aspectMask);
+    FieldToJson(writer, "imageGranularity", data.imageGranularity);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryRequirements& data)
+{
+    const VkSparseImageMemoryRequirements& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "formatProperties", data.formatProperties);
+    FieldToJson(writer, "imageMipTailFirstLod", value.imageMipTailFirstLod);
+    FieldToJson(writer, "imageMipTailSize", value.imageMipTailSize);
+    FieldToJson(writer, "imageMipTailOffset", value.imageMipTailOffset);
+    FieldToJson(writer, "imageMipTailStride", value.imageMipTailStride);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFenceCreateInfo& data)
+{
+    const VkFenceCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreCreateInfo& data)
+{
+    const VkSemaphoreCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkEventCreateInfo& data)
+{
+    const VkEventCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueryPoolCreateInfo& data)
+{
+    const VkQueryPoolCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "queryType", value.queryType);
+    FieldToJson(writer, "queryCount", value.queryCount);
+    FieldToJson(writer, "pipelineStatistics", value.pipelineStatistics);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferCreateInfo& data)
+{
+    const VkBufferCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "usage", value.usage);
+    FieldToJson(writer, "sharingMode", value.sharingMode);
+    FieldToJson(writer, "queueFamilyIndexCount", value.queueFamilyIndexCount);
+    FieldToJson(writer, "pQueueFamilyIndices", data.pQueueFamilyIndices);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferViewCreateInfo& data)
+{
+    const VkBufferViewCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "range", value.range);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageCreateInfo& data)
+{
+    const VkImageCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "imageType", value.imageType);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "extent", data.extent);
+    FieldToJson(writer, "mipLevels", value.mipLevels);
+    FieldToJson(writer, "arrayLayers", value.arrayLayers);
+    FieldToJson(writer, "samples", value.samples);
+    FieldToJson(writer, "tiling", value.tiling);
+    FieldToJson(writer, "usage", value.usage);
+    FieldToJson(writer, "sharingMode", value.sharingMode);
+    FieldToJson(writer, "queueFamilyIndexCount", value.queueFamilyIndexCount);
+    FieldToJson(writer, "pQueueFamilyIndices", data.pQueueFamilyIndices);
+    FieldToJson(writer, "initialLayout", value.initialLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubresourceLayout& data)
+{
+    const VkSubresourceLayout& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "rowPitch", value.rowPitch);
+    FieldToJson(writer, "arrayPitch", value.arrayPitch);
+    FieldToJson(writer, "depthPitch", value.depthPitch);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkComponentMapping& data)
+{
+    const VkComponentMapping& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "r", value.r);
+    FieldToJson(writer, "g", value.g);
+    FieldToJson(writer, "b", value.b);
+    FieldToJson(writer, "a", value.a);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewCreateInfo& data)
+{
+    const VkImageViewCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "image", data.image);
+    FieldToJson(writer, "viewType", value.viewType);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "components", data.components);
+    FieldToJson(writer, "subresourceRange", data.subresourceRange);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderModuleCreateInfo& data)
+{
+    const VkShaderModuleCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "codeSize", value.codeSize);
+    FieldToJson(writer, "pCode", data.pCode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCacheCreateInfo& data)
+{
+    const VkPipelineCacheCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "initialDataSize", value.initialDataSize);
+    FieldToJson(writer, "pInitialData", data.pInitialData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSpecializationMapEntry& data)
+{
+    const VkSpecializationMapEntry& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "constantID", value.constantID);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSpecializationInfo& data)
+{
+    const VkSpecializationInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "mapEntryCount", value.mapEntryCount);
+    FieldToJson(writer, "pMapEntries", data.pMapEntries);
+    FieldToJson(writer, "dataSize", value.dataSize);
+    FieldToJson(writer, "pData", data.pData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineShaderStageCreateInfo& data)
+{
+    const VkPipelineShaderStageCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "stage", value.stage);
+    FieldToJson(writer, "module", data.module);
+    FieldToJson(writer, "pName", data.pName);
+    FieldToJson(writer, "pSpecializationInfo", data.pSpecializationInfo);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkComputePipelineCreateInfo& data)
+{
+    const VkComputePipelineCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "stage", data.stage);
+    FieldToJson(writer, "layout", data.layout);
+    FieldToJson(writer, "basePipelineHandle", data.basePipelineHandle);
+    FieldToJson(writer, "basePipelineIndex", value.basePipelineIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkVertexInputBindingDescription& data)
+{
+    const VkVertexInputBindingDescription& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "binding", value.binding);
+    FieldToJson(writer, "stride", value.stride);
+    FieldToJson(writer, "inputRate", value.inputRate);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkVertexInputAttributeDescription& data)
+{
+    const VkVertexInputAttributeDescription& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "location", value.location);
+    FieldToJson(writer, "binding", value.binding);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "offset", value.offset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineVertexInputStateCreateInfo& data)
+{
+    const VkPipelineVertexInputStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "vertexBindingDescriptionCount", value.vertexBindingDescriptionCount);
+    FieldToJson(writer, "pVertexBindingDescriptions", data.pVertexBindingDescriptions);
+    FieldToJson(writer, "vertexAttributeDescriptionCount", value.vertexAttributeDescriptionCount);
+    FieldToJson(writer, "pVertexAttributeDescriptions", data.pVertexAttributeDescriptions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineInputAssemblyStateCreateInfo& data)
+{
+    const VkPipelineInputAssemblyStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "topology", value.topology);
+    FieldToJson(writer, "primitiveRestartEnable", value.primitiveRestartEnable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineTessellationStateCreateInfo& data)
+{
+    const VkPipelineTessellationStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "patchControlPoints", value.patchControlPoints);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViewport& data)
+{
+    const VkViewport& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "x", value.x);
+    FieldToJson(writer, "y", value.y);
+    FieldToJson(writer, "width", value.width);
+    FieldToJson(writer, "height", value.height);
+    FieldToJson(writer, "minDepth", value.minDepth);
+    FieldToJson(writer, "maxDepth", value.maxDepth);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportStateCreateInfo& data)
+{
+    const VkPipelineViewportStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "viewportCount", value.viewportCount);
+    FieldToJson(writer, "pViewports", data.pViewports);
+    FieldToJson(writer, "scissorCount", value.scissorCount);
+    FieldToJson(writer, "pScissors", data.pScissors);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationStateCreateInfo& data)
+{
+    const VkPipelineRasterizationStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "depthClampEnable", value.depthClampEnable);
+    FieldToJson(writer, "rasterizerDiscardEnable", value.rasterizerDiscardEnable);
+    FieldToJson(writer, "polygonMode", value.polygonMode);
+    FieldToJson(writer, "cullMode", value.cullMode);
+    FieldToJson(writer, "frontFace", value.frontFace);
+    FieldToJson(writer, "depthBiasEnable", value.depthBiasEnable);
+    FieldToJson(writer, "depthBiasConstantFactor", value.depthBiasConstantFactor);
+    FieldToJson(writer, "depthBiasClamp", value.depthBiasClamp);
+    FieldToJson(writer, "depthBiasSlopeFactor", value.depthBiasSlopeFactor);
+    FieldToJson(writer, "lineWidth", value.lineWidth);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineMultisampleStateCreateInfo& data)
+{
+    const VkPipelineMultisampleStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "rasterizationSamples", value.rasterizationSamples);
+    FieldToJson(writer, "sampleShadingEnable", value.sampleShadingEnable);
+    FieldToJson(writer, "minSampleShading", value.minSampleShading);
+    FieldToJson(writer, "pSampleMask", data.pSampleMask);
+    FieldToJson(writer, "alphaToCoverageEnable", value.alphaToCoverageEnable);
+    FieldToJson(writer, "alphaToOneEnable", value.alphaToOneEnable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkStencilOpState& data)
+{
+    const VkStencilOpState& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "failOp", value.failOp);
+    FieldToJson(writer, "passOp", value.passOp);
+    FieldToJson(writer, "depthFailOp", value.depthFailOp);
+    FieldToJson(writer, "compareOp", value.compareOp);
+    FieldToJson(writer, "compareMask", value.compareMask);
+    FieldToJson(writer, "writeMask", value.writeMask);
+    FieldToJson(writer, "reference", value.reference);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineDepthStencilStateCreateInfo& data)
+{
+    const VkPipelineDepthStencilStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "depthTestEnable", value.depthTestEnable);
+    FieldToJson(writer, "depthWriteEnable", value.depthWriteEnable);
+    FieldToJson(writer, "depthCompareOp", value.depthCompareOp);
+    FieldToJson(writer, "depthBoundsTestEnable", value.depthBoundsTestEnable);
+    FieldToJson(writer, "stencilTestEnable", value.stencilTestEnable);
+    FieldToJson(writer, "front", data.front);
+    FieldToJson(writer, "back", data.back);
+    FieldToJson(writer, "minDepthBounds", value.minDepthBounds);
+    FieldToJson(writer, "maxDepthBounds", value.maxDepthBounds);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineColorBlendAttachmentState& data)
+{
+    const VkPipelineColorBlendAttachmentState& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "blendEnable", value.blendEnable);
+    FieldToJson(writer, "srcColorBlendFactor", value.srcColorBlendFactor);
+    FieldToJson(writer, "dstColorBlendFactor", value.dstColorBlendFactor);
+    FieldToJson(writer, "colorBlendOp", value.colorBlendOp);
+    FieldToJson(writer, "srcAlphaBlendFactor", value.srcAlphaBlendFactor);
+    FieldToJson(writer, "dstAlphaBlendFactor", value.dstAlphaBlendFactor);
+    FieldToJson(writer, "alphaBlendOp", value.alphaBlendOp);
+    FieldToJson(writer, "colorWriteMask", value.colorWriteMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineColorBlendStateCreateInfo& data)
+{
+    const VkPipelineColorBlendStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "logicOpEnable", value.logicOpEnable);
+    FieldToJson(writer, "logicOp", value.logicOp);
+    FieldToJson(writer, "attachmentCount", value.attachmentCount);
+    FieldToJson(writer, "pAttachments", data.pAttachments);
+    FieldToJson(writer, "blendConstants", data.blendConstants);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineDynamicStateCreateInfo& data)
+{
+    const VkPipelineDynamicStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "dynamicStateCount", value.dynamicStateCount);
+    FieldToJson(writer, "pDynamicStates", data.pDynamicStates);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGraphicsPipelineCreateInfo& data)
+{
+    const VkGraphicsPipelineCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "stageCount", value.stageCount);
+    FieldToJson(writer, "pStages", data.pStages);
+    FieldToJson(writer, "pVertexInputState", data.pVertexInputState);
+    FieldToJson(writer, "pInputAssemblyState", data.pInputAssemblyState);
+    FieldToJson(writer, "pTessellationState", data.pTessellationState);
+    FieldToJson(writer, "pViewportState", data.pViewportState);
+    FieldToJson(writer, "pRasterizationState", data.pRasterizationState);
+    FieldToJson(writer, "pMultisampleState", data.pMultisampleState);
+    FieldToJson(writer, "pDepthStencilState", data.pDepthStencilState);
+    FieldToJson(writer, "pColorBlendState", data.pColorBlendState);
+    FieldToJson(writer, "pDynamicState", data.pDynamicState);
+    FieldToJson(writer, "layout", data.layout);
+    FieldToJson(writer, "renderPass", data.renderPass);
+    FieldToJson(writer, "subpass", value.subpass);
+    FieldToJson(writer, "basePipelineHandle", data.basePipelineHandle);
+    FieldToJson(writer, "basePipelineIndex", value.basePipelineIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPushConstantRange& data)
+{
+    const VkPushConstantRange& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "stageFlags", value.stageFlags);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineLayoutCreateInfo& data)
+{
+    const VkPipelineLayoutCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "setLayoutCount", value.setLayoutCount);
+    FieldToJson(writer, "pSetLayouts", data.pSetLayouts);
+    FieldToJson(writer, "pushConstantRangeCount", value.pushConstantRangeCount);
+    FieldToJson(writer, "pPushConstantRanges", data.pPushConstantRanges);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerCreateInfo& data)
+{
+    const VkSamplerCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "magFilter", value.magFilter);
+    FieldToJson(writer, "minFilter", value.minFilter);
+    FieldToJson(writer, "mipmapMode", value.mipmapMode);
+    FieldToJson(writer, "addressModeU", value.addressModeU);
+    FieldToJson(writer, "addressModeV", value.addressModeV);
+    FieldToJson(writer, "addressModeW", value.addressModeW);
+    FieldToJson(writer, "mipLodBias", value.mipLodBias);
+    FieldToJson(writer, "anisotropyEnable", value.anisotropyEnable);
+    FieldToJson(writer, "maxAnisotropy", value.maxAnisotropy);
+    FieldToJson(writer, "compareEnable", value.compareEnable);
+    FieldToJson(writer, "compareOp", value.compareOp);
+    FieldToJson(writer, "minLod", value.minLod);
+    FieldToJson(writer, "maxLod", value.maxLod);
+    FieldToJson(writer, "borderColor", value.borderColor);
+    FieldToJson(writer, "unnormalizedCoordinates", value.unnormalizedCoordinates);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyDescriptorSet& data)
+{
+    const VkCopyDescriptorSet& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcSet", data.srcSet);
+    FieldToJson(writer, "srcBinding", value.srcBinding);
+    FieldToJson(writer, "srcArrayElement", value.srcArrayElement);
+    FieldToJson(writer, "dstSet", data.dstSet);
+    FieldToJson(writer, "dstBinding", value.dstBinding);
+    FieldToJson(writer, "dstArrayElement", value.dstArrayElement);
+    FieldToJson(writer, "descriptorCount", value.descriptorCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorBufferInfo& data)
+{
+    const VkDescriptorBufferInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "range", value.range);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorPoolSize& data)
+{
+    const VkDescriptorPoolSize& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "descriptorCount", value.descriptorCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorPoolCreateInfo& data)
+{
+    const VkDescriptorPoolCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "maxSets", value.maxSets);
+    FieldToJson(writer, "poolSizeCount", value.poolSizeCount);
+    FieldToJson(writer, "pPoolSizes", data.pPoolSizes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetAllocateInfo& data)
+{
+    const VkDescriptorSetAllocateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "descriptorPool", data.descriptorPool);
+    FieldToJson(writer, "descriptorSetCount", value.descriptorSetCount);
+    FieldToJson(writer, "pSetLayouts", data.pSetLayouts);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutBinding& data)
+{
+    const VkDescriptorSetLayoutBinding& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "binding", value.binding);
+    FieldToJson(writer, "descriptorType", value.descriptorType);
+    FieldToJson(writer, "descriptorCount", value.descriptorCount);
+    FieldToJson(writer, "stageFlags", value.stageFlags);
+    FieldToJson(writer, "pImmutableSamplers", data.pImmutableSamplers);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutCreateInfo& data)
+{
+    const VkDescriptorSetLayoutCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "bindingCount", value.bindingCount);
+    FieldToJson(writer, "pBindings", data.pBindings);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentDescription& data)
+{
+    const VkAttachmentDescription& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "samples", value.samples);
+    FieldToJson(writer, "loadOp", value.loadOp);
+    FieldToJson(writer, "storeOp", value.storeOp);
+    FieldToJson(writer, "stencilLoadOp", value.stencilLoadOp);
+    FieldToJson(writer, "stencilStoreOp", value.stencilStoreOp);
+    FieldToJson(writer, "initialLayout", value.initialLayout);
+    FieldToJson(writer, "finalLayout", value.finalLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentReference& data)
+{
+    const VkAttachmentReference& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "attachment", value.attachment);
+    FieldToJson(writer, "layout", value.layout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferCreateInfo& data)
+{
+    const VkFramebufferCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "renderPass", data.renderPass);
+    FieldToJson(writer, "attachmentCount", value.attachmentCount);
+    FieldToJson(writer, "pAttachments", data.pAttachments);
+    FieldToJson(writer, "width", value.width);
+    FieldToJson(writer, "height", value.height);
+    FieldToJson(writer, "layers", value.layers);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDescription& data)
+{
+    const VkSubpassDescription& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pipelineBindPoint", value.pipelineBindPoint);
+    FieldToJson(writer, "inputAttachmentCount", value.inputAttachmentCount);
+    FieldToJson(writer, "pInputAttachments", data.pInputAttachments);
+    FieldToJson(writer, "colorAttachmentCount", value.colorAttachmentCount);
+    FieldToJson(writer, "pColorAttachments", data.pColorAttachments);
+    FieldToJson(writer, "pResolveAttachments", data.pResolveAttachments);
+    FieldToJson(writer, "pDepthStencilAttachment", data.pDepthStencilAttachment);
+    FieldToJson(writer, "preserveAttachmentCount", value.preserveAttachmentCount);
+    FieldToJson(writer, "pPreserveAttachments", data.pPreserveAttachments);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDependency& data)
+{
+    const VkSubpassDependency& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "srcSubpass", value.srcSubpass);
+    FieldToJson(writer, "dstSubpass", value.dstSubpass);
+    FieldToJson(writer, "srcStageMask", value.srcStageMask);
+    FieldToJson(writer, "dstStageMask", value.dstStageMask);
+    FieldToJson(writer, "srcAccessMask", value.srcAccessMask);
+    FieldToJson(writer, "dstAccessMask", value.dstAccessMask);
+    FieldToJson(writer, "dependencyFlags", value.dependencyFlags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassCreateInfo& data)
+{
+    const VkRenderPassCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "attachmentCount", value.attachmentCount);
+    FieldToJson(writer, "pAttachments", data.pAttachments);
+    FieldToJson(writer, "subpassCount", value.subpassCount);
+    FieldToJson(writer, "pSubpasses", data.pSubpasses);
+    FieldToJson(writer, "dependencyCount", value.dependencyCount);
+    FieldToJson(writer, "pDependencies", data.pDependencies);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandPoolCreateInfo& data)
+{
+    const VkCommandPoolCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "queueFamilyIndex", value.queueFamilyIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferAllocateInfo& data)
+{
+    const VkCommandBufferAllocateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "commandPool", data.commandPool);
+    FieldToJson(writer, "level", value.level);
+    FieldToJson(writer, "commandBufferCount", value.commandBufferCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferInheritanceInfo& data)
+{
+    const VkCommandBufferInheritanceInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "renderPass", data.renderPass);
+    FieldToJson(writer, "subpass", value.subpass);
+    FieldToJson(writer, "framebuffer", data.framebuffer);
+    FieldToJson(writer, "occlusionQueryEnable", value.occlusionQueryEnable);
+    FieldToJson(writer, "queryFlags", value.queryFlags);
+    FieldToJson(writer, "pipelineStatistics", value.pipelineStatistics);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferBeginInfo& data)
+{
+    const VkCommandBufferBeginInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pInheritanceInfo", data.pInheritanceInfo);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferCopy& data)
+{
+    const VkBufferCopy& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "srcOffset", value.srcOffset);
+    FieldToJson(writer, "dstOffset", value.dstOffset);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSubresourceLayers& data)
+{
+    const VkImageSubresourceLayers& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "aspectMask", value.aspectMask);
+    FieldToJson(writer, "mipLevel", value.mipLevel);
+    FieldToJson(writer, "baseArrayLayer", value.baseArrayLayer);
+    FieldToJson(writer, "layerCount", value.layerCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferImageCopy& data)
+{
+    const VkBufferImageCopy& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "bufferOffset", value.bufferOffset);
+    FieldToJson(writer, "bufferRowLength", value.bufferRowLength);
+    FieldToJson(writer, "bufferImageHeight", value.bufferImageHeight);
+    FieldToJson(writer, "imageSubresource", data.imageSubresource);
+    FieldToJson(writer, "imageOffset", data.imageOffset);
+    FieldToJson(writer, "imageExtent", data.imageExtent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearDepthStencilValue& data)
+{
+    const VkClearDepthStencilValue& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "depth", value.depth);
+    FieldToJson(writer, "stencil", value.stencil);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearAttachment& data)
+{
+    const VkClearAttachment& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "aspectMask", value.aspectMask);
+    FieldToJson(writer, "colorAttachment", value.colorAttachment);
+    FieldToJson(writer, "clearValue", data.clearValue);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearRect& data)
+{
+    const VkClearRect& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "rect", data.rect);
+    FieldToJson(writer, "baseArrayLayer", value.baseArrayLayer);
+    FieldToJson(writer, "layerCount", value.layerCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageBlit& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "srcSubresource", data.srcSubresource);
+    FieldToJson(writer, "srcOffsets", data.srcOffsets);
+    FieldToJson(writer, "dstSubresource", data.dstSubresource);
+    FieldToJson(writer, "dstOffsets", data.dstOffsets);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageCopy& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "srcSubresource", data.srcSubresource);
+    FieldToJson(writer, "srcOffset", data.srcOffset);
+    FieldToJson(writer, "dstSubresource", data.dstSubresource);
+    FieldToJson(writer, "dstOffset", data.dstOffset);
+    FieldToJson(writer, "extent", data.extent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageResolve& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "srcSubresource", data.srcSubresource);
+    FieldToJson(writer, "srcOffset", data.srcOffset);
+    FieldToJson(writer, "dstSubresource", data.dstSubresource);
+    FieldToJson(writer, "dstOffset", data.dstOffset);
+    FieldToJson(writer, "extent", data.extent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassBeginInfo& data)
+{
+    const VkRenderPassBeginInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "renderPass", data.renderPass);
+    FieldToJson(writer, "framebuffer", data.framebuffer);
+    FieldToJson(writer, "renderArea", data.renderArea);
+    FieldToJson(writer, "clearValueCount", value.clearValueCount);
+    FieldToJson(writer, "pClearValues", data.pClearValues);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSubgroupProperties& data)
+{
+    const VkPhysicalDeviceSubgroupProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "subgroupSize", value.subgroupSize);
+    FieldToJson(writer, "supportedStages", value.supportedStages);
+    FieldToJson(writer, "supportedOperations", value.supportedOperations);
+    FieldToJson(writer, "quadOperationsInAllStages", value.quadOperationsInAllStages);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindBufferMemoryInfo& data)
+{
+    const VkBindBufferMemoryInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "memoryOffset", value.memoryOffset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImageMemoryInfo& data)
+{
+    const VkBindImageMemoryInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "image", data.image);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "memoryOffset", value.memoryOffset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevice16BitStorageFeatures& data)
+{
+    const VkPhysicalDevice16BitStorageFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "storageBuffer16BitAccess", value.storageBuffer16BitAccess);
+    FieldToJson(writer, "uniformAndStorageBuffer16BitAccess", value.uniformAndStorageBuffer16BitAccess);
+    FieldToJson(writer, "storagePushConstant16", value.storagePushConstant16);
+    FieldToJson(writer, "storageInputOutput16", value.storageInputOutput16);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryDedicatedRequirements& data)
+{
+    const VkMemoryDedicatedRequirements& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "prefersDedicatedAllocation", value.prefersDedicatedAllocation);
+    FieldToJson(writer, "requiresDedicatedAllocation", value.requiresDedicatedAllocation);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryDedicatedAllocateInfo& data)
+{
+    const VkMemoryDedicatedAllocateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "image", data.image);
+    FieldToJson(writer, "buffer", data.buffer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryAllocateFlagsInfo& data)
+{
+    const VkMemoryAllocateFlagsInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "deviceMask", value.deviceMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupRenderPassBeginInfo& data)
+{
+    const VkDeviceGroupRenderPassBeginInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceMask", value.deviceMask);
+    FieldToJson(writer, "deviceRenderAreaCount", value.deviceRenderAreaCount);
+    FieldToJson(writer, "pDeviceRenderAreas", data.pDeviceRenderAreas);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupCommandBufferBeginInfo& data)
+{
+    const VkDeviceGroupCommandBufferBeginInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceMask", value.deviceMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupSubmitInfo& data)
+{
+    const VkDeviceGroupSubmitInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "waitSemaphoreCount", value.waitSemaphoreCount);
+    FieldToJson(writer, "pWaitSemaphoreDeviceIndices", data.pWaitSemaphoreDeviceIndices);
+    FieldToJson(writer, "commandBufferCount", value.commandBufferCount);
+    FieldToJson(writer, "pCommandBufferDeviceMasks", data.pCommandBufferDeviceMasks);
+    FieldToJson(writer, "signalSemaphoreCount", value.signalSemaphoreCount);
+    FieldToJson(writer, "pSignalSemaphoreDeviceIndices", data.pSignalSemaphoreDeviceIndices);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupBindSparseInfo& data)
+{
+    const VkDeviceGroupBindSparseInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "resourceDeviceIndex", value.resourceDeviceIndex);
+    FieldToJson(writer, "memoryDeviceIndex", value.memoryDeviceIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindBufferMemoryDeviceGroupInfo& data)
+{
+    const VkBindBufferMemoryDeviceGroupInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceIndexCount", value.deviceIndexCount);
+    FieldToJson(writer, "pDeviceIndices", data.pDeviceIndices);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImageMemoryDeviceGroupInfo& data)
+{
+    const VkBindImageMemoryDeviceGroupInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceIndexCount", value.deviceIndexCount);
+    FieldToJson(writer, "pDeviceIndices", data.pDeviceIndices);
+    FieldToJson(writer, "splitInstanceBindRegionCount", value.splitInstanceBindRegionCount);
+    FieldToJson(writer, "pSplitInstanceBindRegions", data.pSplitInstanceBindRegions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceGroupProperties& data)
+{
+    const VkPhysicalDeviceGroupProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "physicalDeviceCount", value.physicalDeviceCount);
+    FieldToJson(writer, "physicalDevices", data.physicalDevices);
+    FieldToJson(writer, "subsetAllocation", value.subsetAllocation);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupDeviceCreateInfo& data)
+{
+    const VkDeviceGroupDeviceCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "physicalDeviceCount", value.physicalDeviceCount);
+    FieldToJson(writer, "pPhysicalDevices", data.pPhysicalDevices);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferMemoryRequirementsInfo2& data)
+{
+    const VkBufferMemoryRequirementsInfo2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "buffer", data.buffer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageMemoryRequirementsInfo2& data)
+{
+    const VkImageMemoryRequirementsInfo2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "image", data.image);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSparseMemoryRequirementsInfo2& data)
+{
+    const VkImageSparseMemoryRequirementsInfo2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "image", data.image);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryRequirements2& data)
+{
+    const VkMemoryRequirements2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memoryRequirements", data.memoryRequirements);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryRequirements2& data)
+{
+    const VkSparseImageMemoryRequirements2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memoryRequirements", data.memoryRequirements);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFeatures2& data)
+{
+    const VkPhysicalDeviceFeatures2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "features", data.features);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProperties2& data)
+{
+    const VkPhysicalDeviceProperties2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "properties", data.properties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFormatProperties2& data)
+{
+    const VkFormatProperties2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "formatProperties", data.formatProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageFormatProperties2& data)
+{
+    const VkImageFormatProperties2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "imageFormatProperties", data.imageFormatProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageFormatInfo2& data)
+{
+    const VkPhysicalDeviceImageFormatInfo2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "tiling", value.tiling);
+    FieldToJson(writer, "usage", value.usage);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueueFamilyProperties2& data)
+{
+    const VkQueueFamilyProperties2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "queueFamilyProperties", data.queueFamilyProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryProperties2& data)
+{
+    const VkPhysicalDeviceMemoryProperties2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memoryProperties", data.memoryProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageFormatProperties2& data)
+{
+    const VkSparseImageFormatProperties2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "properties", data.properties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSparseImageFormatInfo2& data)
+{
+    const VkPhysicalDeviceSparseImageFormatInfo2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "samples", value.samples);
+    FieldToJson(writer, "usage", value.usage);
+    FieldToJson(writer, "tiling", value.tiling);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePointClippingProperties& data)
+{
+    const VkPhysicalDevicePointClippingProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pointClippingBehavior", value.pointClippingBehavior);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkInputAttachmentAspectReference& data)
+{
+    const VkInputAttachmentAspectReference& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "subpass", value.subpass);
+    FieldToJson(writer, "inputAttachmentIndex", value.inputAttachmentIndex);
+    FieldToJson(writer, "aspectMask", value.aspectMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassInputAttachmentAspectCreateInfo& data)
+{
+    const VkRenderPassInputAttachmentAspectCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "aspectReferenceCount", value.aspectReferenceCount);
+    FieldToJson(writer, "pAspectReferences", data.pAspectReferences);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewUsageCreateInfo& data)
+{
+    const VkImageViewUsageCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "usage", value.usage);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineTessellationDomainOriginStateCreateInfo& data)
+{
+    const VkPipelineTessellationDomainOriginStateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "domainOrigin", value.domainOrigin);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassMultiviewCreateInfo& data)
+{
+    const VkRenderPassMultiviewCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "subpassCount", value.subpassCount);
+    FieldToJson(writer, "pViewMasks", data.pViewMasks);
+    FieldToJson(writer, "dependencyCount", value.dependencyCount);
+    FieldToJson(writer, "pViewOffsets", data.pViewOffsets);
+    FieldToJson(writer, "correlationMaskCount", value.correlationMaskCount);
+    FieldToJson(writer, "pCorrelationMasks", data.pCorrelationMasks);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMultiviewFeatures& data)
+{
+    const VkPhysicalDeviceMultiviewFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "multiview", value.multiview);
+    FieldToJson(writer, "multiviewGeometryShader", value.multiviewGeometryShader);
+    FieldToJson(writer, "multiviewTessellationShader", value.multiviewTessellationShader);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMultiviewProperties& data)
+{
+    const VkPhysicalDeviceMultiviewProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxMultiviewViewCount", value.maxMultiviewViewCount);
+    FieldToJson(writer, "maxMultiviewInstanceIndex", value.maxMultiviewInstanceIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVariablePointersFeatures& data)
+{
+    const VkPhysicalDeviceVariablePointersFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "variablePointersStorageBuffer", value.variablePointersStorageBuffer);
+    FieldToJson(writer, "variablePointers", value.variablePointers);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProtectedMemoryFeatures& data)
+{
+    const VkPhysicalDeviceProtectedMemoryFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "protectedMemory", value.protectedMemory);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProtectedMemoryProperties& data)
+{
+    const VkPhysicalDeviceProtectedMemoryProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "protectedNoFault", value.protectedNoFault);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceQueueInfo2& data)
+{
+    const VkDeviceQueueInfo2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "queueFamilyIndex", value.queueFamilyIndex);
+    FieldToJson(writer, "queueIndex", value.queueIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkProtectedSubmitInfo& data)
+{
+    const VkProtectedSubmitInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "protectedSubmit", value.protectedSubmit);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerYcbcrConversionCreateInfo& data)
+{
+    const VkSamplerYcbcrConversionCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "ycbcrModel", value.ycbcrModel);
+    FieldToJson(writer, "ycbcrRange", value.ycbcrRange);
+    FieldToJson(writer, "components", data.components);
+    FieldToJson(writer, "xChromaOffset", value.xChromaOffset);
+    FieldToJson(writer, "yChromaOffset", value.yChromaOffset);
+    FieldToJson(writer, "chromaFilter", value.chromaFilter);
+    FieldToJson(writer, "forceExplicitReconstruction", value.forceExplicitReconstruction);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerYcbcrConversionInfo& data)
+{
+    const VkSamplerYcbcrConversionInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "conversion", data.conversion);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImagePlaneMemoryInfo& data)
+{
+    const VkBindImagePlaneMemoryInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "planeAspect", value.planeAspect);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImagePlaneMemoryRequirementsInfo& data)
+{
+    const VkImagePlaneMemoryRequirementsInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "planeAspect", value.planeAspect);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSamplerYcbcrConversionFeatures& data)
+{
+    const VkPhysicalDeviceSamplerYcbcrConversionFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "samplerYcbcrConversion", value.samplerYcbcrConversion);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerYcbcrConversionImageFormatProperties& data)
+{
+    const VkSamplerYcbcrConversionImageFormatProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "combinedImageSamplerDescriptorCount", value.combinedImageSamplerDescriptorCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorUpdateTemplateEntry& data)
+{
+    const VkDescriptorUpdateTemplateEntry& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "dstBinding", value.dstBinding);
+    FieldToJson(writer, "dstArrayElement", value.dstArrayElement);
+    FieldToJson(writer, "descriptorCount", value.descriptorCount);
+    FieldToJson(writer, "descriptorType", value.descriptorType);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "stride", value.stride);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorUpdateTemplateCreateInfo& data)
+{
+    const VkDescriptorUpdateTemplateCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "descriptorUpdateEntryCount", value.descriptorUpdateEntryCount);
+    FieldToJson(writer, "pDescriptorUpdateEntries", data.pDescriptorUpdateEntries);
+    FieldToJson(writer, "templateType", value.templateType);
+    FieldToJson(writer, "descriptorSetLayout", data.descriptorSetLayout);
+    FieldToJson(writer, "pipelineBindPoint", value.pipelineBindPoint);
+    FieldToJson(writer, "pipelineLayout", data.pipelineLayout);
+    FieldToJson(writer, "set", value.set);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryProperties& data)
+{
+    const VkExternalMemoryProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "externalMemoryFeatures", value.externalMemoryFeatures);
+    FieldToJson(writer, "exportFromImportedHandleTypes", value.exportFromImportedHandleTypes);
+    FieldToJson(writer, "compatibleHandleTypes", value.compatibleHandleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalImageFormatInfo& data)
+{
+    const VkPhysicalDeviceExternalImageFormatInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalImageFormatProperties& data)
+{
+    const VkExternalImageFormatProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "externalMemoryProperties", data.externalMemoryProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalBufferInfo& data)
+{
+    const VkPhysicalDeviceExternalBufferInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "usage", value.usage);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalBufferProperties& data)
+{
+    const VkExternalBufferProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "externalMemoryProperties", data.externalMemoryProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceIDProperties& data)
+{
+    const VkPhysicalDeviceIDProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceUUID", data.deviceUUID);
+    FieldToJson(writer, "driverUUID", data.driverUUID);
+    FieldToJson(writer, "deviceLUID", data.deviceLUID);
+    FieldToJson(writer, "deviceNodeMask", value.deviceNodeMask);
+    FieldToJson(writer, "deviceLUIDValid", value.deviceLUIDValid);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryImageCreateInfo& data)
+{
+    const VkExternalMemoryImageCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleTypes", value.handleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryBufferCreateInfo& data)
+{
+    const VkExternalMemoryBufferCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleTypes", value.handleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryAllocateInfo& data)
+{
+    const VkExportMemoryAllocateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleTypes", value.handleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalFenceInfo& data)
+{
+    const VkPhysicalDeviceExternalFenceInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalFenceProperties& data)
+{
+    const VkExternalFenceProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "exportFromImportedHandleTypes", value.exportFromImportedHandleTypes);
+    FieldToJson(writer, "compatibleHandleTypes", value.compatibleHandleTypes);
+    FieldToJson(writer, "externalFenceFeatures", value.externalFenceFeatures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportFenceCreateInfo& data)
+{
+    const VkExportFenceCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleTypes", value.handleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportSemaphoreCreateInfo& data)
+{
+    const VkExportSemaphoreCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleTypes", value.handleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalSemaphoreInfo& data)
+{
+    const VkPhysicalDeviceExternalSemaphoreInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalSemaphoreProperties& data)
+{
+    const VkExternalSemaphoreProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "exportFromImportedHandleTypes", value.exportFromImportedHandleTypes);
+    FieldToJson(writer, "compatibleHandleTypes", value.compatibleHandleTypes);
+    FieldToJson(writer, "externalSemaphoreFeatures", value.externalSemaphoreFeatures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMaintenance3Properties& data)
+{
+    const VkPhysicalDeviceMaintenance3Properties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxPerSetDescriptors", value.maxPerSetDescriptors);
+    FieldToJson(writer, "maxMemoryAllocationSize", value.maxMemoryAllocationSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutSupport& data)
+{
+    const VkDescriptorSetLayoutSupport& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "supported", value.supported);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderDrawParametersFeatures& data)
+{
+    const VkPhysicalDeviceShaderDrawParametersFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderDrawParameters", value.shaderDrawParameters);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan11Features& data)
+{
+    const VkPhysicalDeviceVulkan11Features& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "storageBuffer16BitAccess", value.storageBuffer16BitAccess);
+    FieldToJson(writer, "uniformAndStorageBuffer16BitAccess", value.uniformAndStorageBuffer16BitAccess);
+    FieldToJson(writer, "storagePushConstant16", value.storagePushConstant16);
+    FieldToJson(writer, "storageInputOutput16", value.storageInputOutput16);
+    FieldToJson(writer, "multiview", value.multiview);
+    FieldToJson(writer, "multiviewGeometryShader", value.multiviewGeometryShader);
+    FieldToJson(writer, "multiviewTessellationShader", value.multiviewTessellationShader);
+    FieldToJson(writer, "variablePointersStorageBuffer", value.variablePointersStorageBuffer);
+    FieldToJson(writer, "variablePointers", value.variablePointers);
+    FieldToJson(writer, "protectedMemory", value.protectedMemory);
+    FieldToJson(writer, "samplerYcbcrConversion", value.samplerYcbcrConversion);
+    FieldToJson(writer, "shaderDrawParameters", value.shaderDrawParameters);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan11Properties& data)
+{
+    const VkPhysicalDeviceVulkan11Properties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceUUID", data.deviceUUID);
+    FieldToJson(writer, "driverUUID", data.driverUUID);
+    FieldToJson(writer, "deviceLUID", data.deviceLUID);
+    FieldToJson(writer, "deviceNodeMask", value.deviceNodeMask);
+    FieldToJson(writer, "deviceLUIDValid", value.deviceLUIDValid);
+    FieldToJson(writer, "subgroupSize", value.subgroupSize);
+    FieldToJson(writer, "subgroupSupportedStages", value.subgroupSupportedStages);
+    FieldToJson(writer, "subgroupSupportedOperations", value.subgroupSupportedOperations);
+    FieldToJson(writer, "subgroupQuadOperationsInAllStages", value.subgroupQuadOperationsInAllStages);
+    FieldToJson(writer, "pointClippingBehavior", value.pointClippingBehavior);
+    FieldToJson(writer, "maxMultiviewViewCount", value.maxMultiviewViewCount);
+    FieldToJson(writer, "maxMultiviewInstanceIndex", value.maxMultiviewInstanceIndex);
+    FieldToJson(writer, "protectedNoFault", value.protectedNoFault);
+    FieldToJson(writer, "maxPerSetDescriptors", value.maxPerSetDescriptors);
+    FieldToJson(writer, "maxMemoryAllocationSize", value.maxMemoryAllocationSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan12Features& data)
+{
+    const VkPhysicalDeviceVulkan12Features& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "samplerMirrorClampToEdge", value.samplerMirrorClampToEdge);
+    FieldToJson(writer, "drawIndirectCount", value.drawIndirectCount);
+    FieldToJson(writer, "storageBuffer8BitAccess", value.storageBuffer8BitAccess);
+    FieldToJson(writer, "uniformAndStorageBuffer8BitAccess", value.uniformAndStorageBuffer8BitAccess);
+    FieldToJson(writer, "storagePushConstant8", value.storagePushConstant8);
+    FieldToJson(writer, "shaderBufferInt64Atomics", value.shaderBufferInt64Atomics);
+    FieldToJson(writer, "shaderSharedInt64Atomics", value.shaderSharedInt64Atomics);
+    FieldToJson(writer, "shaderFloat16", value.shaderFloat16);
+    FieldToJson(writer, "shaderInt8", value.shaderInt8);
+    FieldToJson(writer, "descriptorIndexing", value.descriptorIndexing);
+    FieldToJson(writer, "shaderInputAttachmentArrayDynamicIndexing", value.shaderInputAttachmentArrayDynamicIndexing);
+    FieldToJson(writer, "shaderUniformTexelBufferArrayDynamicIndexing", value.shaderUniformTexelBufferArrayDynamicIndexing);
+    FieldToJson(writer, "shaderStorageTexelBufferArrayDynamicIndexing", value.shaderStorageTexelBufferArrayDynamicIndexing);
+    FieldToJson(writer, "shaderUniformBufferArrayNonUniformIndexing", value.shaderUniformBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderSampledImageArrayNonUniformIndexing", value.shaderSampledImageArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderStorageBufferArrayNonUniformIndexing", value.shaderStorageBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderStorageImageArrayNonUniformIndexing", value.shaderStorageImageArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderInputAttachmentArrayNonUniformIndexing", value.shaderInputAttachmentArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderUniformTexelBufferArrayNonUniformIndexing", value.shaderUniformTexelBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderStorageTexelBufferArrayNonUniformIndexing", value.shaderStorageTexelBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "descriptorBindingUniformBufferUpdateAfterBind", value.descriptorBindingUniformBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingSampledImageUpdateAfterBind", value.descriptorBindingSampledImageUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingStorageImageUpdateAfterBind", value.descriptorBindingStorageImageUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingStorageBufferUpdateAfterBind", value.descriptorBindingStorageBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingUniformTexelBufferUpdateAfterBind", value.descriptorBindingUniformTexelBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingStorageTexelBufferUpdateAfterBind", value.descriptorBindingStorageTexelBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingUpdateUnusedWhilePending", value.descriptorBindingUpdateUnusedWhilePending);
+    FieldToJson(writer, "descriptorBindingPartiallyBound", value.descriptorBindingPartiallyBound);
+    FieldToJson(writer, "descriptorBindingVariableDescriptorCount", value.descriptorBindingVariableDescriptorCount);
+    FieldToJson(writer, "runtimeDescriptorArray", value.runtimeDescriptorArray);
+    FieldToJson(writer, "samplerFilterMinmax", value.samplerFilterMinmax);
+    FieldToJson(writer, "scalarBlockLayout", value.scalarBlockLayout);
+    FieldToJson(writer, "imagelessFramebuffer", value.imagelessFramebuffer);
+    FieldToJson(writer, "uniformBufferStandardLayout", value.uniformBufferStandardLayout);
+    FieldToJson(writer, "shaderSubgroupExtendedTypes", value.shaderSubgroupExtendedTypes);
+    FieldToJson(writer, "separateDepthStencilLayouts", value.separateDepthStencilLayouts);
+    FieldToJson(writer, "hostQueryReset", value.hostQueryReset);
+    FieldToJson(writer, "timelineSemaphore", value.timelineSemaphore);
+    FieldToJson(writer, "bufferDeviceAddress", value.bufferDeviceAddress);
+    FieldToJson(writer, "bufferDeviceAddressCaptureReplay", value.bufferDeviceAddressCaptureReplay);
+    FieldToJson(writer, "bufferDeviceAddressMultiDevice", value.bufferDeviceAddressMultiDevice);
+    FieldToJson(writer, "vulkanMemoryModel", value.vulkanMemoryModel);
+    FieldToJson(writer, "vulkanMemoryModelDeviceScope", value.vulkanMemoryModelDeviceScope);
+    FieldToJson(writer, "vulkanMemoryModelAvailabilityVisibilityChains", value.vulkanMemoryModelAvailabilityVisibilityChains);
+    FieldToJson(writer, "shaderOutputViewportIndex", value.shaderOutputViewportIndex);
+    FieldToJson(writer, "shaderOutputLayer", value.shaderOutputLayer);
+    FieldToJson(writer, "subgroupBroadcastDynamicId", value.subgroupBroadcastDynamicId);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkConformanceVersion& data)
+{
+    const VkConformanceVersion& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "major", value.major);
+    FieldToJson(writer, "minor", value.minor);
+    FieldToJson(writer, "subminor", value.subminor);
+    FieldToJson(writer, "patch", value.patch);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan12Properties& data)
+{
+    const VkPhysicalDeviceVulkan12Properties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "driverID", value.driverID);
+    FieldToJson(writer, "driverName", data.driverName);
+    FieldToJson(writer, "driverInfo", data.driverInfo);
+    FieldToJson(writer, "conformanceVersion", data.conformanceVersion);
+    FieldToJson(writer, "denormBehaviorIndependence", value.denormBehaviorIndependence);
+    FieldToJson(writer, "roundingModeIndependence", value.roundingModeIndependence);
+    FieldToJson(writer, "shaderSignedZeroInfNanPreserveFloat16", value.shaderSignedZeroInfNanPreserveFloat16);
+    FieldToJson(writer, "shaderSignedZeroInfNanPreserveFloat32", value.shaderSignedZeroInfNanPreserveFloat32);
+    FieldToJson(writer, "shaderSignedZeroInfNanPreserveFloat64", value.shaderSignedZeroInfNanPreserveFloat64);
+    FieldToJson(writer, "shaderDenormPreserveFloat16", value.shaderDenormPreserveFloat16);
+    FieldToJson(writer, "shaderDenormPreserveFloat32", value.shaderDenormPreserveFloat32);
+    FieldToJson(writer, "shaderDenormPreserveFloat64", value.shaderDenormPreserveFloat64);
+    FieldToJson(writer, "shaderDenormFlushToZeroFloat16", value.shaderDenormFlushToZeroFloat16);
+    FieldToJson(writer, "shaderDenormFlushToZeroFloat32", value.shaderDenormFlushToZeroFloat32);
+    FieldToJson(writer, "shaderDenormFlushToZeroFloat64", value.shaderDenormFlushToZeroFloat64);
+    FieldToJson(writer, "shaderRoundingModeRTEFloat16", value.shaderRoundingModeRTEFloat16);
+    FieldToJson(writer, "shaderRoundingModeRTEFloat32", value.shaderRoundingModeRTEFloat32);
+    FieldToJson(writer, "shaderRoundingModeRTEFloat64", value.shaderRoundingModeRTEFloat64);
+    FieldToJson(writer, "shaderRoundingModeRTZFloat16", value.shaderRoundingModeRTZFloat16);
+    FieldToJson(writer, "shaderRoundingModeRTZFloat32", value.shaderRoundingModeRTZFloat32);
+    FieldToJson(writer, "shaderRoundingModeRTZFloat64", value.shaderRoundingModeRTZFloat64);
+    FieldToJson(writer, "maxUpdateAfterBindDescriptorsInAllPools", value.maxUpdateAfterBindDescriptorsInAllPools);
+    FieldToJson(writer, "shaderUniformBufferArrayNonUniformIndexingNative", value.shaderUniformBufferArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderSampledImageArrayNonUniformIndexingNative", value.shaderSampledImageArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderStorageBufferArrayNonUniformIndexingNative", value.shaderStorageBufferArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderStorageImageArrayNonUniformIndexingNative", value.shaderStorageImageArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderInputAttachmentArrayNonUniformIndexingNative", value.shaderInputAttachmentArrayNonUniformIndexingNative);
+    FieldToJson(writer, "robustBufferAccessUpdateAfterBind", value.robustBufferAccessUpdateAfterBind);
+    FieldToJson(writer, "quadDivergentImplicitLod", value.quadDivergentImplicitLod);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindSamplers", value.maxPerStageDescriptorUpdateAfterBindSamplers);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindUniformBuffers", value.maxPerStageDescriptorUpdateAfterBindUniformBuffers);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindStorageBuffers", value.maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindSampledImages", value.maxPerStageDescriptorUpdateAfterBindSampledImages);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindStorageImages", value.maxPerStageDescriptorUpdateAfterBindStorageImages);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindInputAttachments", value.maxPerStageDescriptorUpdateAfterBindInputAttachments);
+    FieldToJson(writer, "maxPerStageUpdateAfterBindResources", value.maxPerStageUpdateAfterBindResources);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindSamplers", value.maxDescriptorSetUpdateAfterBindSamplers);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindUniformBuffers", value.maxDescriptorSetUpdateAfterBindUniformBuffers);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindUniformBuffersDynamic", value.maxDescriptorSetUpdateAfterBindUniformBuffersDynamic);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindStorageBuffers", value.maxDescriptorSetUpdateAfterBindStorageBuffers);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindStorageBuffersDynamic", value.maxDescriptorSetUpdateAfterBindStorageBuffersDynamic);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindSampledImages", value.maxDescriptorSetUpdateAfterBindSampledImages);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindStorageImages", value.maxDescriptorSetUpdateAfterBindStorageImages);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindInputAttachments", value.maxDescriptorSetUpdateAfterBindInputAttachments);
+    FieldToJson(writer, "supportedDepthResolveModes", value.supportedDepthResolveModes);
+    FieldToJson(writer, "supportedStencilResolveModes", value.supportedStencilResolveModes);
+    FieldToJson(writer, "independentResolveNone", value.independentResolveNone);
+    FieldToJson(writer, "independentResolve", value.independentResolve);
+    FieldToJson(writer, "filterMinmaxSingleComponentFormats", value.filterMinmaxSingleComponentFormats);
+    FieldToJson(writer, "filterMinmaxImageComponentMapping", value.filterMinmaxImageComponentMapping);
+    FieldToJson(writer, "maxTimelineSemaphoreValueDifference", value.maxTimelineSemaphoreValueDifference);
+    FieldToJson(writer, "framebufferIntegerColorSampleCounts", value.framebufferIntegerColorSampleCounts);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageFormatListCreateInfo& data)
+{
+    const VkImageFormatListCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "viewFormatCount", value.viewFormatCount);
+    FieldToJson(writer, "pViewFormats", data.pViewFormats);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentDescription2& data)
+{
+    const VkAttachmentDescription2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "samples", value.samples);
+    FieldToJson(writer, "loadOp", value.loadOp);
+    FieldToJson(writer, "storeOp", value.storeOp);
+    FieldToJson(writer, "stencilLoadOp", value.stencilLoadOp);
+    FieldToJson(writer, "stencilStoreOp", value.stencilStoreOp);
+    FieldToJson(writer, "initialLayout", value.initialLayout);
+    FieldToJson(writer, "finalLayout", value.finalLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentReference2& data)
+{
+    const VkAttachmentReference2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "attachment", value.attachment);
+    FieldToJson(writer, "layout", value.layout);
+    FieldToJson(writer, "aspectMask", value.aspectMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDescription2& data)
+{
+    const VkSubpassDescription2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pipelineBindPoint", value.pipelineBindPoint);
+    FieldToJson(writer, "viewMask", value.viewMask);
+    FieldToJson(writer, "inputAttachmentCount", value.inputAttachmentCount);
+    FieldToJson(writer, "pInputAttachments", data.pInputAttachments);
+    FieldToJson(writer, "colorAttachmentCount", value.colorAttachmentCount);
+    FieldToJson(writer, "pColorAttachments", data.pColorAttachments);
+    FieldToJson(writer, "pResolveAttachments", data.pResolveAttachments);
+    FieldToJson(writer, "pDepthStencilAttachment", data.pDepthStencilAttachment);
+    FieldToJson(writer, "preserveAttachmentCount", value.preserveAttachmentCount);
+    FieldToJson(writer, "pPreserveAttachments", data.pPreserveAttachments);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDependency2& data)
+{
+    const VkSubpassDependency2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcSubpass", value.srcSubpass);
+    FieldToJson(writer, "dstSubpass", value.dstSubpass);
+    FieldToJson(writer, "srcStageMask", value.srcStageMask);
+    FieldToJson(writer, "dstStageMask", value.dstStageMask);
+    FieldToJson(writer, "srcAccessMask", value.srcAccessMask);
+    FieldToJson(writer, "dstAccessMask", value.dstAccessMask);
+    FieldToJson(writer, "dependencyFlags", value.dependencyFlags);
+    FieldToJson(writer, "viewOffset", value.viewOffset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassCreateInfo2& data)
+{
+    const VkRenderPassCreateInfo2& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "attachmentCount", value.attachmentCount);
+    FieldToJson(writer, "pAttachments", data.pAttachments);
+    FieldToJson(writer, "subpassCount", value.subpassCount);
+    FieldToJson(writer, "pSubpasses", data.pSubpasses);
+    FieldToJson(writer, "dependencyCount", value.dependencyCount);
+    FieldToJson(writer, "pDependencies", data.pDependencies);
+    FieldToJson(writer, "correlatedViewMaskCount", value.correlatedViewMaskCount);
+    FieldToJson(writer, "pCorrelatedViewMasks", data.pCorrelatedViewMasks);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassBeginInfo& data)
+{
+    const VkSubpassBeginInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "contents", value.contents);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassEndInfo& data)
+{
+    const VkSubpassEndInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevice8BitStorageFeatures& data)
+{
+    const VkPhysicalDevice8BitStorageFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "storageBuffer8BitAccess", value.storageBuffer8BitAccess);
+    FieldToJson(writer, "uniformAndStorageBuffer8BitAccess", value.uniformAndStorageBuffer8BitAccess);
+    FieldToJson(writer, "storagePushConstant8", value.storagePushConstant8);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDriverProperties& data)
+{
+    const VkPhysicalDeviceDriverProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "driverID", value.driverID);
+    FieldToJson(writer, "driverName", data.driverName);
+    FieldToJson(writer, "driverInfo", data.driverInfo);
+    FieldToJson(writer, "conformanceVersion", data.conformanceVersion);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderAtomicInt64Features& data)
+{
+    const VkPhysicalDeviceShaderAtomicInt64Features& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderBufferInt64Atomics", value.shaderBufferInt64Atomics);
+    FieldToJson(writer, "shaderSharedInt64Atomics", value.shaderSharedInt64Atomics);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderFloat16Int8Features& data)
+{
+    const VkPhysicalDeviceShaderFloat16Int8Features& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderFloat16", value.shaderFloat16);
+    FieldToJson(writer, "shaderInt8", value.shaderInt8);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFloatControlsProperties& data)
+{
+    const VkPhysicalDeviceFloatControlsProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "denormBehaviorIndependence", value.denormBehaviorIndependence);
+    FieldToJson(writer, "roundingModeIndependence", value.roundingModeIndependence);
+    FieldToJson(writer, "shaderSignedZeroInfNanPreserveFloat16", value.shaderSignedZeroInfNanPreserveFloat16);
+    FieldToJson(writer, "shaderSignedZeroInfNanPreserveFloat32", value.shaderSignedZeroInfNanPreserveFloat32);
+    FieldToJson(writer, "shaderSignedZeroInfNanPreserveFloat64", value.shaderSignedZeroInfNanPreserveFloat64);
+    FieldToJson(writer, "shaderDenormPreserveFloat16", value.shaderDenormPreserveFloat16);
+    FieldToJson(writer, "shaderDenormPreserveFloat32", value.shaderDenormPreserveFloat32);
+    FieldToJson(writer, "shaderDenormPreserveFloat64", value.shaderDenormPreserveFloat64);
+    FieldToJson(writer, "shaderDenormFlushToZeroFloat16", value.shaderDenormFlushToZeroFloat16);
+    FieldToJson(writer, "shaderDenormFlushToZeroFloat32", value.shaderDenormFlushToZeroFloat32);
+    FieldToJson(writer, "shaderDenormFlushToZeroFloat64", value.shaderDenormFlushToZeroFloat64);
+    FieldToJson(writer, "shaderRoundingModeRTEFloat16", value.shaderRoundingModeRTEFloat16);
+    FieldToJson(writer, "shaderRoundingModeRTEFloat32", value.shaderRoundingModeRTEFloat32);
+    FieldToJson(writer, "shaderRoundingModeRTEFloat64", value.shaderRoundingModeRTEFloat64);
+    FieldToJson(writer, "shaderRoundingModeRTZFloat16", value.shaderRoundingModeRTZFloat16);
+    FieldToJson(writer, "shaderRoundingModeRTZFloat32", value.shaderRoundingModeRTZFloat32);
+    FieldToJson(writer, "shaderRoundingModeRTZFloat64", value.shaderRoundingModeRTZFloat64);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutBindingFlagsCreateInfo& data)
+{
+    const VkDescriptorSetLayoutBindingFlagsCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "bindingCount", value.bindingCount);
+    FieldToJson(writer, "pBindingFlags", data.pBindingFlags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDescriptorIndexingFeatures& data)
+{
+    const VkPhysicalDeviceDescriptorIndexingFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderInputAttachmentArrayDynamicIndexing", value.shaderInputAttachmentArrayDynamicIndexing);
+    FieldToJson(writer, "shaderUniformTexelBufferArrayDynamicIndexing", value.shaderUniformTexelBufferArrayDynamicIndexing);
+    FieldToJson(writer, "shaderStorageTexelBufferArrayDynamicIndexing", value.shaderStorageTexelBufferArrayDynamicIndexing);
+    FieldToJson(writer, "shaderUniformBufferArrayNonUniformIndexing", value.shaderUniformBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderSampledImageArrayNonUniformIndexing", value.shaderSampledImageArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderStorageBufferArrayNonUniformIndexing", value.shaderStorageBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderStorageImageArrayNonUniformIndexing", value.shaderStorageImageArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderInputAttachmentArrayNonUniformIndexing", value.shaderInputAttachmentArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderUniformTexelBufferArrayNonUniformIndexing", value.shaderUniformTexelBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "shaderStorageTexelBufferArrayNonUniformIndexing", value.shaderStorageTexelBufferArrayNonUniformIndexing);
+    FieldToJson(writer, "descriptorBindingUniformBufferUpdateAfterBind", value.descriptorBindingUniformBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingSampledImageUpdateAfterBind", value.descriptorBindingSampledImageUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingStorageImageUpdateAfterBind", value.descriptorBindingStorageImageUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingStorageBufferUpdateAfterBind", value.descriptorBindingStorageBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingUniformTexelBufferUpdateAfterBind", value.descriptorBindingUniformTexelBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingStorageTexelBufferUpdateAfterBind", value.descriptorBindingStorageTexelBufferUpdateAfterBind);
+    FieldToJson(writer, "descriptorBindingUpdateUnusedWhilePending", value.descriptorBindingUpdateUnusedWhilePending);
+    FieldToJson(writer, "descriptorBindingPartiallyBound", value.descriptorBindingPartiallyBound);
+    FieldToJson(writer, "descriptorBindingVariableDescriptorCount", value.descriptorBindingVariableDescriptorCount);
+    FieldToJson(writer, "runtimeDescriptorArray", value.runtimeDescriptorArray);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDescriptorIndexingProperties& data)
+{
+    const VkPhysicalDeviceDescriptorIndexingProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxUpdateAfterBindDescriptorsInAllPools", value.maxUpdateAfterBindDescriptorsInAllPools);
+    FieldToJson(writer, "shaderUniformBufferArrayNonUniformIndexingNative", value.shaderUniformBufferArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderSampledImageArrayNonUniformIndexingNative", value.shaderSampledImageArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderStorageBufferArrayNonUniformIndexingNative", value.shaderStorageBufferArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderStorageImageArrayNonUniformIndexingNative", value.shaderStorageImageArrayNonUniformIndexingNative);
+    FieldToJson(writer, "shaderInputAttachmentArrayNonUniformIndexingNative", value.shaderInputAttachmentArrayNonUniformIndexingNative);
+    FieldToJson(writer, "robustBufferAccessUpdateAfterBind", value.robustBufferAccessUpdateAfterBind);
+    FieldToJson(writer, "quadDivergentImplicitLod", value.quadDivergentImplicitLod);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindSamplers", value.maxPerStageDescriptorUpdateAfterBindSamplers);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindUniformBuffers", value.maxPerStageDescriptorUpdateAfterBindUniformBuffers);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindStorageBuffers", value.maxPerStageDescriptorUpdateAfterBindStorageBuffers);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindSampledImages", value.maxPerStageDescriptorUpdateAfterBindSampledImages);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindStorageImages", value.maxPerStageDescriptorUpdateAfterBindStorageImages);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindInputAttachments", value.maxPerStageDescriptorUpdateAfterBindInputAttachments);
+    FieldToJson(writer, "maxPerStageUpdateAfterBindResources", value.maxPerStageUpdateAfterBindResources);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindSamplers", value.maxDescriptorSetUpdateAfterBindSamplers);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindUniformBuffers", value.maxDescriptorSetUpdateAfterBindUniformBuffers);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindUniformBuffersDynamic", value.maxDescriptorSetUpdateAfterBindUniformBuffersDynamic);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindStorageBuffers", value.maxDescriptorSetUpdateAfterBindStorageBuffers);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindStorageBuffersDynamic", value.maxDescriptorSetUpdateAfterBindStorageBuffersDynamic);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindSampledImages", value.maxDescriptorSetUpdateAfterBindSampledImages);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindStorageImages", value.maxDescriptorSetUpdateAfterBindStorageImages);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindInputAttachments", value.maxDescriptorSetUpdateAfterBindInputAttachments);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetVariableDescriptorCountAllocateInfo& data)
+{
+    const VkDescriptorSetVariableDescriptorCountAllocateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "descriptorSetCount", value.descriptorSetCount);
+    FieldToJson(writer, "pDescriptorCounts", data.pDescriptorCounts);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetVariableDescriptorCountLayoutSupport& data)
+{
+    const VkDescriptorSetVariableDescriptorCountLayoutSupport& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxVariableDescriptorCount", value.maxVariableDescriptorCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDescriptionDepthStencilResolve& data)
+{
+    const VkSubpassDescriptionDepthStencilResolve& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "depthResolveMode", value.depthResolveMode);
+    FieldToJson(writer, "stencilResolveMode", value.stencilResolveMode);
+    FieldToJson(writer, "pDepthStencilResolveAttachment", data.pDepthStencilResolveAttachment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDepthStencilResolveProperties& data)
+{
+    const VkPhysicalDeviceDepthStencilResolveProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "supportedDepthResolveModes", value.supportedDepthResolveModes);
+    FieldToJson(writer, "supportedStencilResolveModes", value.supportedStencilResolveModes);
+    FieldToJson(writer, "independentResolveNone", value.independentResolveNone);
+    FieldToJson(writer, "independentResolve", value.independentResolve);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceScalarBlockLayoutFeatures& data)
+{
+    const VkPhysicalDeviceScalarBlockLayoutFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "scalarBlockLayout", value.scalarBlockLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageStencilUsageCreateInfo& data)
+{
+    const VkImageStencilUsageCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "stencilUsage", value.stencilUsage);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerReductionModeCreateInfo& data)
+{
+    const VkSamplerReductionModeCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "reductionMode", value.reductionMode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSamplerFilterMinmaxProperties& data)
+{
+    const VkPhysicalDeviceSamplerFilterMinmaxProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "filterMinmaxSingleComponentFormats", value.filterMinmaxSingleComponentFormats);
+    FieldToJson(writer, "filterMinmaxImageComponentMapping", value.filterMinmaxImageComponentMapping);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkanMemoryModelFeatures& data)
+{
+    const VkPhysicalDeviceVulkanMemoryModelFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "vulkanMemoryModel", value.vulkanMemoryModel);
+    FieldToJson(writer, "vulkanMemoryModelDeviceScope", value.vulkanMemoryModelDeviceScope);
+    FieldToJson(writer, "vulkanMemoryModelAvailabilityVisibilityChains", value.vulkanMemoryModelAvailabilityVisibilityChains);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImagelessFramebufferFeatures& data)
+{
+    const VkPhysicalDeviceImagelessFramebufferFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "imagelessFramebuffer", value.imagelessFramebuffer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferAttachmentImageInfo& data)
+{
+    const VkFramebufferAttachmentImageInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "usage", value.usage);
+    FieldToJson(writer, "width", value.width);
+    FieldToJson(writer, "height", value.height);
+    FieldToJson(writer, "layerCount", value.layerCount);
+    FieldToJson(writer, "viewFormatCount", value.viewFormatCount);
+    FieldToJson(writer, "pViewFormats", data.pViewFormats);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferAttachmentsCreateInfo& data)
+{
+    const VkFramebufferAttachmentsCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "attachmentImageInfoCount", value.attachmentImageInfoCount);
+    FieldToJson(writer, "pAttachmentImageInfos", data.pAttachmentImageInfos);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassAttachmentBeginInfo& data)
+{
+    const VkRenderPassAttachmentBeginInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "attachmentCount", value.attachmentCount);
+    FieldToJson(writer, "pAttachments", data.pAttachments);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& data)
+{
+    const VkPhysicalDeviceUniformBufferStandardLayoutFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "uniformBufferStandardLayout", value.uniformBufferStandardLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& data)
+{
+    const VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderSubgroupExtendedTypes", value.shaderSubgroupExtendedTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& data)
+{
+    const VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "separateDepthStencilLayouts", value.separateDepthStencilLayouts);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentReferenceStencilLayout& data)
+{
+    const VkAttachmentReferenceStencilLayout& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "stencilLayout", value.stencilLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentDescriptionStencilLayout& data)
+{
+    const VkAttachmentDescriptionStencilLayout& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "stencilInitialLayout", value.stencilInitialLayout);
+    FieldToJson(writer, "stencilFinalLayout", value.stencilFinalLayout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceHostQueryResetFeatures& data)
+{
+    const VkPhysicalDeviceHostQueryResetFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "hostQueryReset", value.hostQueryReset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTimelineSemaphoreFeatures& data)
+{
+    const VkPhysicalDeviceTimelineSemaphoreFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "timelineSemaphore", value.timelineSemaphore);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTimelineSemaphoreProperties& data)
+{
+    const VkPhysicalDeviceTimelineSemaphoreProperties& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxTimelineSemaphoreValueDifference", value.maxTimelineSemaphoreValueDifference);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreTypeCreateInfo& data)
+{
+    const VkSemaphoreTypeCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "semaphoreType", value.semaphoreType);
+    FieldToJson(writer, "initialValue", value.initialValue);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTimelineSemaphoreSubmitInfo& data)
+{
+    const VkTimelineSemaphoreSubmitInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "waitSemaphoreValueCount", value.waitSemaphoreValueCount);
+    FieldToJson(writer, "pWaitSemaphoreValues", data.pWaitSemaphoreValues);
+    FieldToJson(writer, "signalSemaphoreValueCount", value.signalSemaphoreValueCount);
+    FieldToJson(writer, "pSignalSemaphoreValues", data.pSignalSemaphoreValues);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreWaitInfo& data)
+{
+    const VkSemaphoreWaitInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "semaphoreCount", value.semaphoreCount);
+    FieldToJson(writer, "pSemaphores", data.pSemaphores);
+    FieldToJson(writer, "pValues", data.pValues);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreSignalInfo& data)
+{
+    const VkSemaphoreSignalInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "semaphore", data.semaphore);
+    FieldToJson(writer, "value", value.value);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeatures& data)
+{
+    const VkPhysicalDeviceBufferDeviceAddressFeatures& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "bufferDeviceAddress", value.bufferDeviceAddress);
+    FieldToJson(writer, "bufferDeviceAddressCaptureReplay", value.bufferDeviceAddressCaptureReplay);
+    FieldToJson(writer, "bufferDeviceAddressMultiDevice", value.bufferDeviceAddressMultiDevice);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferDeviceAddressInfo& data)
+{
+    const VkBufferDeviceAddressInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "buffer", data.buffer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferOpaqueCaptureAddressCreateInfo& data)
+{
+    const VkBufferOpaqueCaptureAddressCreateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "opaqueCaptureAddress", value.opaqueCaptureAddress);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryOpaqueCaptureAddressAllocateInfo& data)
+{
+    const VkMemoryOpaqueCaptureAddressAllocateInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "opaqueCaptureAddress", value.opaqueCaptureAddress);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo& data)
+{
+    const VkDeviceMemoryOpaqueCaptureAddressInfo& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memory", data.memory);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilitiesKHR& data)
+{
+    const VkSurfaceCapabilitiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "minImageCount", value.minImageCount);
+    FieldToJson(writer, "maxImageCount", value.maxImageCount);
+    FieldToJson(writer, "currentExtent", data.currentExtent);
+    FieldToJson(writer, "minImageExtent", data.minImageExtent);
+    FieldToJson(writer, "maxImageExtent", data.maxImageExtent);
+    FieldToJson(writer, "maxImageArrayLayers", value.maxImageArrayLayers);
+    FieldToJson(writer, "supportedTransforms", value.supportedTransforms);
+    FieldToJson(writer, "currentTransform", value.currentTransform);
+    FieldToJson(writer, "supportedCompositeAlpha", value.supportedCompositeAlpha);
+    FieldToJson(writer, "supportedUsageFlags", value.supportedUsageFlags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFormatKHR& data)
+{
+    const VkSurfaceFormatKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "colorSpace", value.colorSpace);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSwapchainCreateInfoKHR& data)
+{
+    const VkSwapchainCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "surface", data.surface);
+    FieldToJson(writer, "minImageCount", value.minImageCount);
+    FieldToJson(writer, "imageFormat", value.imageFormat);
+    FieldToJson(writer, "imageColorSpace", value.imageColorSpace);
+    FieldToJson(writer, "imageExtent", data.imageExtent);
+    FieldToJson(writer, "imageArrayLayers", value.imageArrayLayers);
+    FieldToJson(writer, "imageUsage", value.imageUsage);
+    FieldToJson(writer, "imageSharingMode", value.imageSharingMode);
+    FieldToJson(writer, "queueFamilyIndexCount", value.queueFamilyIndexCount);
+    FieldToJson(writer, "pQueueFamilyIndices", data.pQueueFamilyIndices);
+    FieldToJson(writer, "preTransform", value.preTransform);
+    FieldToJson(writer, "compositeAlpha", value.compositeAlpha);
+    FieldToJson(writer, "presentMode", value.presentMode);
+    FieldToJson(writer, "clipped", value.clipped);
+    FieldToJson(writer, "oldSwapchain", data.oldSwapchain);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentInfoKHR& data)
+{
+    const VkPresentInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "waitSemaphoreCount", value.waitSemaphoreCount);
+    FieldToJson(writer, "pWaitSemaphores", data.pWaitSemaphores);
+    FieldToJson(writer, "swapchainCount", value.swapchainCount);
+    FieldToJson(writer, "pSwapchains", data.pSwapchains);
+    FieldToJson(writer, "pImageIndices", data.pImageIndices);
+    FieldToJson(writer, "pResults", data.pResults);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSwapchainCreateInfoKHR& data)
+{
+    const VkImageSwapchainCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "swapchain", data.swapchain);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImageMemorySwapchainInfoKHR& data)
+{
+    const VkBindImageMemorySwapchainInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "swapchain", data.swapchain);
+    FieldToJson(writer, "imageIndex", value.imageIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAcquireNextImageInfoKHR& data)
+{
+    const VkAcquireNextImageInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "swapchain", data.swapchain);
+    FieldToJson(writer, "timeout", value.timeout);
+    FieldToJson(writer, "semaphore", data.semaphore);
+    FieldToJson(writer, "fence", data.fence);
+    FieldToJson(writer, "deviceMask", value.deviceMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupPresentCapabilitiesKHR& data)
+{
+    const VkDeviceGroupPresentCapabilitiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "presentMask", data.presentMask);
+    FieldToJson(writer, "modes", value.modes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupPresentInfoKHR& data)
+{
+    const VkDeviceGroupPresentInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "swapchainCount", value.swapchainCount);
+    FieldToJson(writer, "pDeviceMasks", data.pDeviceMasks);
+    FieldToJson(writer, "mode", value.mode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupSwapchainCreateInfoKHR& data)
+{
+    const VkDeviceGroupSwapchainCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "modes", value.modes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModeParametersKHR& data)
+{
+    const VkDisplayModeParametersKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "visibleRegion", data.visibleRegion);
+    FieldToJson(writer, "refreshRate", value.refreshRate);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModeCreateInfoKHR& data)
+{
+    const VkDisplayModeCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "parameters", data.parameters);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModePropertiesKHR& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "displayMode", data.displayMode);
+    FieldToJson(writer, "parameters", data.parameters);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneCapabilitiesKHR& data)
+{
+    const VkDisplayPlaneCapabilitiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "supportedAlpha", value.supportedAlpha);
+    FieldToJson(writer, "minSrcPosition", data.minSrcPosition);
+    FieldToJson(writer, "maxSrcPosition", data.maxSrcPosition);
+    FieldToJson(writer, "minSrcExtent", data.minSrcExtent);
+    FieldToJson(writer, "maxSrcExtent", data.maxSrcExtent);
+    FieldToJson(writer, "minDstPosition", data.minDstPosition);
+    FieldToJson(writer, "maxDstPosition", data.maxDstPosition);
+    FieldToJson(writer, "minDstExtent", data.minDstExtent);
+    FieldToJson(writer, "maxDstExtent", data.maxDstExtent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlanePropertiesKHR& data)
+{
+    const VkDisplayPlanePropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "currentDisplay", data.currentDisplay);
+    FieldToJson(writer, "currentStackIndex", value.currentStackIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPropertiesKHR& data)
+{
+    const VkDisplayPropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "display", data.display);
+    FieldToJson(writer, "displayName", data.displayName);
+    FieldToJson(writer, "physicalDimensions", data.physicalDimensions);
+    FieldToJson(writer, "physicalResolution", data.physicalResolution);
+    FieldToJson(writer, "supportedTransforms", value.supportedTransforms);
+    FieldToJson(writer, "planeReorderPossible", value.planeReorderPossible);
+    FieldToJson(writer, "persistentContent", value.persistentContent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplaySurfaceCreateInfoKHR& data)
+{
+    const VkDisplaySurfaceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "displayMode", data.displayMode);
+    FieldToJson(writer, "planeIndex", value.planeIndex);
+    FieldToJson(writer, "planeStackIndex", value.planeStackIndex);
+    FieldToJson(writer, "transform", value.transform);
+    FieldToJson(writer, "globalAlpha", value.globalAlpha);
+    FieldToJson(writer, "alphaMode", value.alphaMode);
+    FieldToJson(writer, "imageExtent", data.imageExtent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPresentInfoKHR& data)
+{
+    const VkDisplayPresentInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcRect", data.srcRect);
+    FieldToJson(writer, "dstRect", data.dstRect);
+    FieldToJson(writer, "persistent", value.persistent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkXlibSurfaceCreateInfoKHR& data)
+{
+    const VkXlibSurfaceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "dpy", data.dpy);
+    FieldToJson(writer, "window", value.window);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkXcbSurfaceCreateInfoKHR& data)
+{
+    const VkXcbSurfaceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "connection", data.connection);
+    FieldToJson(writer, "window", value.window);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWaylandSurfaceCreateInfoKHR& data)
+{
+    const VkWaylandSurfaceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "display", data.display);
+    FieldToJson(writer, "surface", data.surface);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidSurfaceCreateInfoKHR& data)
+{
+    const VkAndroidSurfaceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "window", data.window);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWin32SurfaceCreateInfoKHR& data)
+{
+    const VkWin32SurfaceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "hinstance", data.hinstance);
+    FieldToJson(writer, "hwnd", data.hwnd);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryWin32HandleInfoKHR& data)
+{
+    const VkImportMemoryWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "handle", data.handle);
+    FieldToJson(writer, "name", data.name);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryWin32HandleInfoKHR& data)
+{
+    const VkExportMemoryWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pAttributes", data.pAttributes);
+    FieldToJson(writer, "dwAccess", value.dwAccess);
+    FieldToJson(writer, "name", data.name);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryWin32HandlePropertiesKHR& data)
+{
+    const VkMemoryWin32HandlePropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memoryTypeBits", value.memoryTypeBits);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryGetWin32HandleInfoKHR& data)
+{
+    const VkMemoryGetWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryFdInfoKHR& data)
+{
+    const VkImportMemoryFdInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "fd", value.fd);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryFdPropertiesKHR& data)
+{
+    const VkMemoryFdPropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memoryTypeBits", value.memoryTypeBits);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryGetFdInfoKHR& data)
+{
+    const VkMemoryGetFdInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoKHR& data)
+{
+    const VkWin32KeyedMutexAcquireReleaseInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "acquireCount", value.acquireCount);
+    FieldToJson(writer, "pAcquireSyncs", data.pAcquireSyncs);
+    FieldToJson(writer, "pAcquireKeys", data.pAcquireKeys);
+    FieldToJson(writer, "pAcquireTimeouts", data.pAcquireTimeouts);
+    FieldToJson(writer, "releaseCount", value.releaseCount);
+    FieldToJson(writer, "pReleaseSyncs", data.pReleaseSyncs);
+    FieldToJson(writer, "pReleaseKeys", data.pReleaseKeys);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportSemaphoreWin32HandleInfoKHR& data)
+{
+    const VkImportSemaphoreWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "semaphore", data.semaphore);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "handle", data.handle);
+    FieldToJson(writer, "name", data.name);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportSemaphoreWin32HandleInfoKHR& data)
+{
+    const VkExportSemaphoreWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pAttributes", data.pAttributes);
+    FieldToJson(writer, "dwAccess", value.dwAccess);
+    FieldToJson(writer, "name", data.name);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkD3D12FenceSubmitInfoKHR& data)
+{
+    const VkD3D12FenceSubmitInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "waitSemaphoreValuesCount", value.waitSemaphoreValuesCount);
+    FieldToJson(writer, "pWaitSemaphoreValues", data.pWaitSemaphoreValues);
+    FieldToJson(writer, "signalSemaphoreValuesCount", value.signalSemaphoreValuesCount);
+    FieldToJson(writer, "pSignalSemaphoreValues", data.pSignalSemaphoreValues);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreGetWin32HandleInfoKHR& data)
+{
+    const VkSemaphoreGetWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "semaphore", data.semaphore);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportSemaphoreFdInfoKHR& data)
+{
+    const VkImportSemaphoreFdInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "semaphore", data.semaphore);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "fd", value.fd);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreGetFdInfoKHR& data)
+{
+    const VkSemaphoreGetFdInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "semaphore", data.semaphore);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePushDescriptorPropertiesKHR& data)
+{
+    const VkPhysicalDevicePushDescriptorPropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxPushDescriptors", value.maxPushDescriptors);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRectLayerKHR& data)
+{
+    const VkRectLayerKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "offset", data.offset);
+    FieldToJson(writer, "extent", data.extent);
+    FieldToJson(writer, "layer", value.layer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentRegionKHR& data)
+{
+    const VkPresentRegionKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "rectangleCount", value.rectangleCount);
+    FieldToJson(writer, "pRectangles", data.pRectangles);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentRegionsKHR& data)
+{
+    const VkPresentRegionsKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "swapchainCount", value.swapchainCount);
+    FieldToJson(writer, "pRegions", data.pRegions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSharedPresentSurfaceCapabilitiesKHR& data)
+{
+    const VkSharedPresentSurfaceCapabilitiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "sharedPresentSupportedUsageFlags", value.sharedPresentSupportedUsageFlags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportFenceWin32HandleInfoKHR& data)
+{
+    const VkImportFenceWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fence", data.fence);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "handle", data.handle);
+    FieldToJson(writer, "name", data.name);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportFenceWin32HandleInfoKHR& data)
+{
+    const VkExportFenceWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pAttributes", data.pAttributes);
+    FieldToJson(writer, "dwAccess", value.dwAccess);
+    FieldToJson(writer, "name", data.name);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFenceGetWin32HandleInfoKHR& data)
+{
+    const VkFenceGetWin32HandleInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fence", data.fence);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportFenceFdInfoKHR& data)
+{
+    const VkImportFenceFdInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fence", data.fence);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "fd", value.fd);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFenceGetFdInfoKHR& data)
+{
+    const VkFenceGetFdInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fence", data.fence);
+    FieldToJson(writer, "handleType", value.handleType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePerformanceQueryFeaturesKHR& data)
+{
+    const VkPhysicalDevicePerformanceQueryFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "performanceCounterQueryPools", value.performanceCounterQueryPools);
+    FieldToJson(writer, "performanceCounterMultipleQueryPools", value.performanceCounterMultipleQueryPools);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePerformanceQueryPropertiesKHR& data)
+{
+    const VkPhysicalDevicePerformanceQueryPropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "allowCommandBufferQueryCopies", value.allowCommandBufferQueryCopies);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceCounterKHR& data)
+{
+    const VkPerformanceCounterKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "unit", value.unit);
+    FieldToJson(writer, "scope", value.scope);
+    FieldToJson(writer, "storage", value.storage);
+    FieldToJson(writer, "uuid", data.uuid);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceCounterDescriptionKHR& data)
+{
+    const VkPerformanceCounterDescriptionKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "name", data.name);
+    FieldToJson(writer, "category", data.category);
+    FieldToJson(writer, "description", data.description);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueryPoolPerformanceCreateInfoKHR& data)
+{
+    const VkQueryPoolPerformanceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "queueFamilyIndex", value.queueFamilyIndex);
+    FieldToJson(writer, "counterIndexCount", value.counterIndexCount);
+    FieldToJson(writer, "pCounterIndices", data.pCounterIndices);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAcquireProfilingLockInfoKHR& data)
+{
+    const VkAcquireProfilingLockInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "timeout", value.timeout);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceQuerySubmitInfoKHR& data)
+{
+    const VkPerformanceQuerySubmitInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "counterPassIndex", value.counterPassIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSurfaceInfo2KHR& data)
+{
+    const VkPhysicalDeviceSurfaceInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "surface", data.surface);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilities2KHR& data)
+{
+    const VkSurfaceCapabilities2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "surfaceCapabilities", data.surfaceCapabilities);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFormat2KHR& data)
+{
+    const VkSurfaceFormat2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "surfaceFormat", data.surfaceFormat);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayProperties2KHR& data)
+{
+    const VkDisplayProperties2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "displayProperties", data.displayProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneProperties2KHR& data)
+{
+    const VkDisplayPlaneProperties2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "displayPlaneProperties", data.displayPlaneProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModeProperties2KHR& data)
+{
+    const VkDisplayModeProperties2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "displayModeProperties", data.displayModeProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneInfo2KHR& data)
+{
+    const VkDisplayPlaneInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "mode", data.mode);
+    FieldToJson(writer, "planeIndex", value.planeIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneCapabilities2KHR& data)
+{
+    const VkDisplayPlaneCapabilities2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "capabilities", data.capabilities);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePortabilitySubsetFeaturesKHR& data)
+{
+    const VkPhysicalDevicePortabilitySubsetFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "constantAlphaColorBlendFactors", value.constantAlphaColorBlendFactors);
+    FieldToJson(writer, "events", value.events);
+    FieldToJson(writer, "imageViewFormatReinterpretation", value.imageViewFormatReinterpretation);
+    FieldToJson(writer, "imageViewFormatSwizzle", value.imageViewFormatSwizzle);
+    FieldToJson(writer, "imageView2DOn3DImage", value.imageView2DOn3DImage);
+    FieldToJson(writer, "multisampleArrayImage", value.multisampleArrayImage);
+    FieldToJson(writer, "mutableComparisonSamplers", value.mutableComparisonSamplers);
+    FieldToJson(writer, "pointPolygons", value.pointPolygons);
+    FieldToJson(writer, "samplerMipLodBias", value.samplerMipLodBias);
+    FieldToJson(writer, "separateStencilMaskRef", value.separateStencilMaskRef);
+    FieldToJson(writer, "shaderSampleRateInterpolationFunctions", value.shaderSampleRateInterpolationFunctions);
+    FieldToJson(writer, "tessellationIsolines", value.tessellationIsolines);
+    FieldToJson(writer, "tessellationPointMode", value.tessellationPointMode);
+    FieldToJson(writer, "triangleFans", value.triangleFans);
+    FieldToJson(writer, "vertexAttributeAccessBeyondStride", value.vertexAttributeAccessBeyondStride);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePortabilitySubsetPropertiesKHR& data)
+{
+    const VkPhysicalDevicePortabilitySubsetPropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "minVertexInputBindingStrideAlignment", value.minVertexInputBindingStrideAlignment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderClockFeaturesKHR& data)
+{
+    const VkPhysicalDeviceShaderClockFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderSubgroupClock", value.shaderSubgroupClock);
+    FieldToJson(writer, "shaderDeviceClock", value.shaderDeviceClock);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR& data)
+{
+    const VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderTerminateInvocation", value.shaderTerminateInvocation);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFragmentShadingRateAttachmentInfoKHR& data)
+{
+    const VkFragmentShadingRateAttachmentInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pFragmentShadingRateAttachment", data.pFragmentShadingRateAttachment);
+    FieldToJson(writer, "shadingRateAttachmentTexelSize", data.shadingRateAttachmentTexelSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineFragmentShadingRateStateCreateInfoKHR& data)
+{
+    const VkPipelineFragmentShadingRateStateCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fragmentSize", data.fragmentSize);
+    FieldToJson(writer, "combinerOps", data.combinerOps);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& data)
+{
+    const VkPhysicalDeviceFragmentShadingRateFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pipelineFragmentShadingRate", value.pipelineFragmentShadingRate);
+    FieldToJson(writer, "primitiveFragmentShadingRate", value.primitiveFragmentShadingRate);
+    FieldToJson(writer, "attachmentFragmentShadingRate", value.attachmentFragmentShadingRate);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& data)
+{
+    const VkPhysicalDeviceFragmentShadingRatePropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "minFragmentShadingRateAttachmentTexelSize", data.minFragmentShadingRateAttachmentTexelSize);
+    FieldToJson(writer, "maxFragmentShadingRateAttachmentTexelSize", data.maxFragmentShadingRateAttachmentTexelSize);
+    FieldToJson(writer, "maxFragmentShadingRateAttachmentTexelSizeAspectRatio", value.maxFragmentShadingRateAttachmentTexelSizeAspectRatio);
+    FieldToJson(writer, "primitiveFragmentShadingRateWithMultipleViewports", value.primitiveFragmentShadingRateWithMultipleViewports);
+    FieldToJson(writer, "layeredShadingRateAttachments", value.layeredShadingRateAttachments);
+    FieldToJson(writer, "fragmentShadingRateNonTrivialCombinerOps", value.fragmentShadingRateNonTrivialCombinerOps);
+    FieldToJson(writer, "maxFragmentSize", data.maxFragmentSize);
+    FieldToJson(writer, "maxFragmentSizeAspectRatio", value.maxFragmentSizeAspectRatio);
+    FieldToJson(writer, "maxFragmentShadingRateCoverageSamples", value.maxFragmentShadingRateCoverageSamples);
+    FieldToJson(writer, "maxFragmentShadingRateRasterizationSamples", value.maxFragmentShadingRateRasterizationSamples);
+    FieldToJson(writer, "fragmentShadingRateWithShaderDepthStencilWrites", value.fragmentShadingRateWithShaderDepthStencilWrites);
+    FieldToJson(writer, "fragmentShadingRateWithSampleMask", value.fragmentShadingRateWithSampleMask);
+    FieldToJson(writer, "fragmentShadingRateWithShaderSampleMask", value.fragmentShadingRateWithShaderSampleMask);
+    FieldToJson(writer, "fragmentShadingRateWithConservativeRasterization", value.fragmentShadingRateWithConservativeRasterization);
+    FieldToJson(writer, "fragmentShadingRateWithFragmentShaderInterlock", value.fragmentShadingRateWithFragmentShaderInterlock);
+    FieldToJson(writer, "fragmentShadingRateWithCustomSampleLocations", value.fragmentShadingRateWithCustomSampleLocations);
+    FieldToJson(writer, "fragmentShadingRateStrictMultiplyCombiner", value.fragmentShadingRateStrictMultiplyCombiner);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateKHR& data)
+{
+    const VkPhysicalDeviceFragmentShadingRateKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "sampleCounts", value.sampleCounts);
+    FieldToJson(writer, "fragmentSize", data.fragmentSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceProtectedCapabilitiesKHR& data)
+{
+    const VkSurfaceProtectedCapabilitiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "supportsProtected", value.supportsProtected);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& data)
+{
+    const VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pipelineExecutableInfo", value.pipelineExecutableInfo);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineInfoKHR& data)
+{
+    const VkPipelineInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pipeline", data.pipeline);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutablePropertiesKHR& data)
+{
+    const VkPipelineExecutablePropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "stages", value.stages);
+    FieldToJson(writer, "name", data.name);
+    FieldToJson(writer, "description", data.description);
+    FieldToJson(writer, "subgroupSize", value.subgroupSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableInfoKHR& data)
+{
+    const VkPipelineExecutableInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pipeline", data.pipeline);
+    FieldToJson(writer, "executableIndex", value.executableIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableStatisticKHR& data)
+{
+    const VkPipelineExecutableStatisticKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "name", data.name);
+    FieldToJson(writer, "description", data.description);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "value", data.value);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableInternalRepresentationKHR& data)
+{
+    const VkPipelineExecutableInternalRepresentationKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "name", data.name);
+    FieldToJson(writer, "description", data.description);
+    FieldToJson(writer, "isText", value.isText);
+    FieldToJson(writer, "dataSize", value.dataSize);
+    FieldToJson(writer, "pData", data.pData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineLibraryCreateInfoKHR& data)
+{
+    const VkPipelineLibraryCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "libraryCount", value.libraryCount);
+    FieldToJson(writer, "pLibraries", data.pLibraries);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferCopy2KHR& data)
+{
+    const VkBufferCopy2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcOffset", value.srcOffset);
+    FieldToJson(writer, "dstOffset", value.dstOffset);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyBufferInfo2KHR& data)
+{
+    const VkCopyBufferInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcBuffer", data.srcBuffer);
+    FieldToJson(writer, "dstBuffer", data.dstBuffer);
+    FieldToJson(writer, "regionCount", value.regionCount);
+    FieldToJson(writer, "pRegions", data.pRegions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageCopy2KHR& data)
+{
+    const VkImageCopy2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcSubresource", data.srcSubresource);
+    FieldToJson(writer, "srcOffset", data.srcOffset);
+    FieldToJson(writer, "dstSubresource", data.dstSubresource);
+    FieldToJson(writer, "dstOffset", data.dstOffset);
+    FieldToJson(writer, "extent", data.extent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyImageInfo2KHR& data)
+{
+    const VkCopyImageInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcImage", data.srcImage);
+    FieldToJson(writer, "srcImageLayout", value.srcImageLayout);
+    FieldToJson(writer, "dstImage", data.dstImage);
+    FieldToJson(writer, "dstImageLayout", value.dstImageLayout);
+    FieldToJson(writer, "regionCount", value.regionCount);
+    FieldToJson(writer, "pRegions", data.pRegions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferImageCopy2KHR& data)
+{
+    const VkBufferImageCopy2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "bufferOffset", value.bufferOffset);
+    FieldToJson(writer, "bufferRowLength", value.bufferRowLength);
+    FieldToJson(writer, "bufferImageHeight", value.bufferImageHeight);
+    FieldToJson(writer, "imageSubresource", data.imageSubresource);
+    FieldToJson(writer, "imageOffset", data.imageOffset);
+    FieldToJson(writer, "imageExtent", data.imageExtent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyBufferToImageInfo2KHR& data)
+{
+    const VkCopyBufferToImageInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcBuffer", data.srcBuffer);
+    FieldToJson(writer, "dstImage", data.dstImage);
+    FieldToJson(writer, "dstImageLayout", value.dstImageLayout);
+    FieldToJson(writer, "regionCount", value.regionCount);
+    FieldToJson(writer, "pRegions", data.pRegions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyImageToBufferInfo2KHR& data)
+{
+    const VkCopyImageToBufferInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcImage", data.srcImage);
+    FieldToJson(writer, "srcImageLayout", value.srcImageLayout);
+    FieldToJson(writer, "dstBuffer", data.dstBuffer);
+    FieldToJson(writer, "regionCount", value.regionCount);
+    FieldToJson(writer, "pRegions", data.pRegions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageBlit2KHR& data)
+{
+    const VkImageBlit2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcSubresource", data.srcSubresource);
+    FieldToJson(writer, "srcOffsets", data.srcOffsets);
+    FieldToJson(writer, "dstSubresource", data.dstSubresource);
+    FieldToJson(writer, "dstOffsets", data.dstOffsets);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBlitImageInfo2KHR& data)
+{
+    const VkBlitImageInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcImage", data.srcImage);
+    FieldToJson(writer, "srcImageLayout", value.srcImageLayout);
+    FieldToJson(writer, "dstImage", data.dstImage);
+    FieldToJson(writer, "dstImageLayout", value.dstImageLayout);
+    FieldToJson(writer, "regionCount", value.regionCount);
+    FieldToJson(writer, "pRegions", data.pRegions);
+    FieldToJson(writer, "filter", value.filter);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageResolve2KHR& data)
+{
+    const VkImageResolve2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcSubresource", data.srcSubresource);
+    FieldToJson(writer, "srcOffset", data.srcOffset);
+    FieldToJson(writer, "dstSubresource", data.dstSubresource);
+    FieldToJson(writer, "dstOffset", data.dstOffset);
+    FieldToJson(writer, "extent", data.extent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkResolveImageInfo2KHR& data)
+{
+    const VkResolveImageInfo2KHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcImage", data.srcImage);
+    FieldToJson(writer, "srcImageLayout", value.srcImageLayout);
+    FieldToJson(writer, "dstImage", data.dstImage);
+    FieldToJson(writer, "dstImageLayout", value.dstImageLayout);
+    FieldToJson(writer, "regionCount", value.regionCount);
+    FieldToJson(writer, "pRegions", data.pRegions);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugReportCallbackCreateInfoEXT& data)
+{
+    const VkDebugReportCallbackCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pfnCallback", data.pfnCallback);
+    FieldToJson(writer, "pUserData", data.pUserData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationStateRasterizationOrderAMD& data)
+{
+    const VkPipelineRasterizationStateRasterizationOrderAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "rasterizationOrder", value.rasterizationOrder);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugMarkerObjectNameInfoEXT& data)
+{
+    const VkDebugMarkerObjectNameInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "objectType", value.objectType);
+    FieldToJson(writer, "object", data.object);
+    FieldToJson(writer, "pObjectName", data.pObjectName);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugMarkerObjectTagInfoEXT& data)
+{
+    const VkDebugMarkerObjectTagInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "objectType", value.objectType);
+    FieldToJson(writer, "object", data.object);
+    FieldToJson(writer, "tagName", value.tagName);
+    FieldToJson(writer, "tagSize", value.tagSize);
+    FieldToJson(writer, "pTag", data.pTag);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugMarkerMarkerInfoEXT& data)
+{
+    const VkDebugMarkerMarkerInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pMarkerName", data.pMarkerName);
+    FieldToJson(writer, "color", data.color);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDedicatedAllocationImageCreateInfoNV& data)
+{
+    const VkDedicatedAllocationImageCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "dedicatedAllocation", value.dedicatedAllocation);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDedicatedAllocationBufferCreateInfoNV& data)
+{
+    const VkDedicatedAllocationBufferCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "dedicatedAllocation", value.dedicatedAllocation);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDedicatedAllocationMemoryAllocateInfoNV& data)
+{
+    const VkDedicatedAllocationMemoryAllocateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "image", data.image);
+    FieldToJson(writer, "buffer", data.buffer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTransformFeedbackFeaturesEXT& data)
+{
+    const VkPhysicalDeviceTransformFeedbackFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "transformFeedback", value.transformFeedback);
+    FieldToJson(writer, "geometryStreams", value.geometryStreams);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTransformFeedbackPropertiesEXT& data)
+{
+    const VkPhysicalDeviceTransformFeedbackPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxTransformFeedbackStreams", value.maxTransformFeedbackStreams);
+    FieldToJson(writer, "maxTransformFeedbackBuffers", value.maxTransformFeedbackBuffers);
+    FieldToJson(writer, "maxTransformFeedbackBufferSize", value.maxTransformFeedbackBufferSize);
+    FieldToJson(writer, "maxTransformFeedbackStreamDataSize", value.maxTransformFeedbackStreamDataSize);
+    FieldToJson(writer, "maxTransformFeedbackBufferDataSize", value.maxTransformFeedbackBufferDataSize);
+    FieldToJson(writer, "maxTransformFeedbackBufferDataStride", value.maxTransformFeedbackBufferDataStride);
+    FieldToJson(writer, "transformFeedbackQueries", value.transformFeedbackQueries);
+    FieldToJson(writer, "transformFeedbackStreamsLinesTriangles", value.transformFeedbackStreamsLinesTriangles);
+    FieldToJson(writer, "transformFeedbackRasterizationStreamSelect", value.transformFeedbackRasterizationStreamSelect);
+    FieldToJson(writer, "transformFeedbackDraw", value.transformFeedbackDraw);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationStateStreamCreateInfoEXT& data)
+{
+    const VkPipelineRasterizationStateStreamCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "rasterizationStream", value.rasterizationStream);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewHandleInfoNVX& data)
+{
+    const VkImageViewHandleInfoNVX& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "imageView", data.imageView);
+    FieldToJson(writer, "descriptorType", value.descriptorType);
+    FieldToJson(writer, "sampler", data.sampler);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewAddressPropertiesNVX& data)
+{
+    const VkImageViewAddressPropertiesNVX& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceAddress", value.deviceAddress);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTextureLODGatherFormatPropertiesAMD& data)
+{
+    const VkTextureLODGatherFormatPropertiesAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "supportsTextureGatherLODBiasAMD", value.supportsTextureGatherLODBiasAMD);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderResourceUsageAMD& data)
+{
+    const VkShaderResourceUsageAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "numUsedVgprs", value.numUsedVgprs);
+    FieldToJson(writer, "numUsedSgprs", value.numUsedSgprs);
+    FieldToJson(writer, "ldsSizePerLocalWorkGroup", value.ldsSizePerLocalWorkGroup);
+    FieldToJson(writer, "ldsUsageSizeInBytes", value.ldsUsageSizeInBytes);
+    FieldToJson(writer, "scratchMemUsageInBytes", value.scratchMemUsageInBytes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderStatisticsInfoAMD& data)
+{
+    const VkShaderStatisticsInfoAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "shaderStageMask", value.shaderStageMask);
+    FieldToJson(writer, "resourceUsage", data.resourceUsage);
+    FieldToJson(writer, "numPhysicalVgprs", value.numPhysicalVgprs);
+    FieldToJson(writer, "numPhysicalSgprs", value.numPhysicalSgprs);
+    FieldToJson(writer, "numAvailableVgprs", value.numAvailableVgprs);
+    FieldToJson(writer, "numAvailableSgprs", value.numAvailableSgprs);
+    FieldToJson(writer, "computeWorkGroupSize", data.computeWorkGroupSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkStreamDescriptorSurfaceCreateInfoGGP& data)
+{
+    const VkStreamDescriptorSurfaceCreateInfoGGP& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "streamDescriptor", value.streamDescriptor);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCornerSampledImageFeaturesNV& data)
+{
+    const VkPhysicalDeviceCornerSampledImageFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "cornerSampledImage", value.cornerSampledImage);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalImageFormatPropertiesNV& data)
+{
+    const VkExternalImageFormatPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "imageFormatProperties", data.imageFormatProperties);
+    FieldToJson(writer, "externalMemoryFeatures", value.externalMemoryFeatures);
+    FieldToJson(writer, "exportFromImportedHandleTypes", value.exportFromImportedHandleTypes);
+    FieldToJson(writer, "compatibleHandleTypes", value.compatibleHandleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryImageCreateInfoNV& data)
+{
+    const VkExternalMemoryImageCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleTypes", value.handleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryAllocateInfoNV& data)
+{
+    const VkExportMemoryAllocateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleTypes", value.handleTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryWin32HandleInfoNV& data)
+{
+    const VkImportMemoryWin32HandleInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "handle", data.handle);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryWin32HandleInfoNV& data)
+{
+    const VkExportMemoryWin32HandleInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pAttributes", data.pAttributes);
+    FieldToJson(writer, "dwAccess", value.dwAccess);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoNV& data)
+{
+    const VkWin32KeyedMutexAcquireReleaseInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "acquireCount", value.acquireCount);
+    FieldToJson(writer, "pAcquireSyncs", data.pAcquireSyncs);
+    FieldToJson(writer, "pAcquireKeys", data.pAcquireKeys);
+    FieldToJson(writer, "pAcquireTimeoutMilliseconds", data.pAcquireTimeoutMilliseconds);
+    FieldToJson(writer, "releaseCount", value.releaseCount);
+    FieldToJson(writer, "pReleaseSyncs", data.pReleaseSyncs);
+    FieldToJson(writer, "pReleaseKeys", data.pReleaseKeys);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkValidationFlagsEXT& data)
+{
+    const VkValidationFlagsEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "disabledValidationCheckCount", value.disabledValidationCheckCount);
+    FieldToJson(writer, "pDisabledValidationChecks", data.pDisabledValidationChecks);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViSurfaceCreateInfoNN& data)
+{
+    const VkViSurfaceCreateInfoNN& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "window", data.window);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT& data)
+{
+    const VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "textureCompressionASTC_HDR", value.textureCompressionASTC_HDR);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewASTCDecodeModeEXT& data)
+{
+    const VkImageViewASTCDecodeModeEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "decodeMode", value.decodeMode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceASTCDecodeFeaturesEXT& data)
+{
+    const VkPhysicalDeviceASTCDecodeFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "decodeModeSharedExponent", value.decodeModeSharedExponent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkConditionalRenderingBeginInfoEXT& data)
+{
+    const VkConditionalRenderingBeginInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceConditionalRenderingFeaturesEXT& data)
+{
+    const VkPhysicalDeviceConditionalRenderingFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "conditionalRendering", value.conditionalRendering);
+    FieldToJson(writer, "inheritedConditionalRendering", value.inheritedConditionalRendering);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferInheritanceConditionalRenderingInfoEXT& data)
+{
+    const VkCommandBufferInheritanceConditionalRenderingInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "conditionalRenderingEnable", value.conditionalRenderingEnable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViewportWScalingNV& data)
+{
+    const VkViewportWScalingNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "xcoeff", value.xcoeff);
+    FieldToJson(writer, "ycoeff", value.ycoeff);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportWScalingStateCreateInfoNV& data)
+{
+    const VkPipelineViewportWScalingStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "viewportWScalingEnable", value.viewportWScalingEnable);
+    FieldToJson(writer, "viewportCount", value.viewportCount);
+    FieldToJson(writer, "pViewportWScalings", data.pViewportWScalings);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilities2EXT& data)
+{
+    const VkSurfaceCapabilities2EXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "minImageCount", value.minImageCount);
+    FieldToJson(writer, "maxImageCount", value.maxImageCount);
+    FieldToJson(writer, "currentExtent", data.currentExtent);
+    FieldToJson(writer, "minImageExtent", data.minImageExtent);
+    FieldToJson(writer, "maxImageExtent", data.maxImageExtent);
+    FieldToJson(writer, "maxImageArrayLayers", value.maxImageArrayLayers);
+    FieldToJson(writer, "supportedTransforms", value.supportedTransforms);
+    FieldToJson(writer, "currentTransform", value.currentTransform);
+    FieldToJson(writer, "supportedCompositeAlpha", value.supportedCompositeAlpha);
+    FieldToJson(writer, "supportedUsageFlags", value.supportedUsageFlags);
+    FieldToJson(writer, "supportedSurfaceCounters", value.supportedSurfaceCounters);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPowerInfoEXT& data)
+{
+    const VkDisplayPowerInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "powerState", value.powerState);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceEventInfoEXT& data)
+{
+    const VkDeviceEventInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceEvent", value.deviceEvent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayEventInfoEXT& data)
+{
+    const VkDisplayEventInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "displayEvent", value.displayEvent);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSwapchainCounterCreateInfoEXT& data)
+{
+    const VkSwapchainCounterCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "surfaceCounters", value.surfaceCounters);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRefreshCycleDurationGOOGLE& data)
+{
+    const VkRefreshCycleDurationGOOGLE& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "refreshDuration", value.refreshDuration);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPastPresentationTimingGOOGLE& data)
+{
+    const VkPastPresentationTimingGOOGLE& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "presentID", value.presentID);
+    FieldToJson(writer, "desiredPresentTime", value.desiredPresentTime);
+    FieldToJson(writer, "actualPresentTime", value.actualPresentTime);
+    FieldToJson(writer, "earliestPresentTime", value.earliestPresentTime);
+    FieldToJson(writer, "presentMargin", value.presentMargin);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentTimeGOOGLE& data)
+{
+    const VkPresentTimeGOOGLE& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "presentID", value.presentID);
+    FieldToJson(writer, "desiredPresentTime", value.desiredPresentTime);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentTimesInfoGOOGLE& data)
+{
+    const VkPresentTimesInfoGOOGLE& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "swapchainCount", value.swapchainCount);
+    FieldToJson(writer, "pTimes", data.pTimes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& data)
+{
+    const VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "perViewPositionAllComponents", value.perViewPositionAllComponents);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViewportSwizzleNV& data)
+{
+    const VkViewportSwizzleNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "x", value.x);
+    FieldToJson(writer, "y", value.y);
+    FieldToJson(writer, "z", value.z);
+    FieldToJson(writer, "w", value.w);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportSwizzleStateCreateInfoNV& data)
+{
+    const VkPipelineViewportSwizzleStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "viewportCount", value.viewportCount);
+    FieldToJson(writer, "pViewportSwizzles", data.pViewportSwizzles);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDiscardRectanglePropertiesEXT& data)
+{
+    const VkPhysicalDeviceDiscardRectanglePropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxDiscardRectangles", value.maxDiscardRectangles);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineDiscardRectangleStateCreateInfoEXT& data)
+{
+    const VkPipelineDiscardRectangleStateCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "discardRectangleMode", value.discardRectangleMode);
+    FieldToJson(writer, "discardRectangleCount", value.discardRectangleCount);
+    FieldToJson(writer, "pDiscardRectangles", data.pDiscardRectangles);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& data)
+{
+    const VkPhysicalDeviceConservativeRasterizationPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "primitiveOverestimationSize", value.primitiveOverestimationSize);
+    FieldToJson(writer, "maxExtraPrimitiveOverestimationSize", value.maxExtraPrimitiveOverestimationSize);
+    FieldToJson(writer, "extraPrimitiveOverestimationSizeGranularity", value.extraPrimitiveOverestimationSizeGranularity);
+    FieldToJson(writer, "primitiveUnderestimation", value.primitiveUnderestimation);
+    FieldToJson(writer, "conservativePointAndLineRasterization", value.conservativePointAndLineRasterization);
+    FieldToJson(writer, "degenerateTrianglesRasterized", value.degenerateTrianglesRasterized);
+    FieldToJson(writer, "degenerateLinesRasterized", value.degenerateLinesRasterized);
+    FieldToJson(writer, "fullyCoveredFragmentShaderInputVariable", value.fullyCoveredFragmentShaderInputVariable);
+    FieldToJson(writer, "conservativeRasterizationPostDepthCoverage", value.conservativeRasterizationPostDepthCoverage);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationConservativeStateCreateInfoEXT& data)
+{
+    const VkPipelineRasterizationConservativeStateCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "conservativeRasterizationMode", value.conservativeRasterizationMode);
+    FieldToJson(writer, "extraPrimitiveOverestimationSize", value.extraPrimitiveOverestimationSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDepthClipEnableFeaturesEXT& data)
+{
+    const VkPhysicalDeviceDepthClipEnableFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "depthClipEnable", value.depthClipEnable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationDepthClipStateCreateInfoEXT& data)
+{
+    const VkPipelineRasterizationDepthClipStateCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "depthClipEnable", value.depthClipEnable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkXYColorEXT& data)
+{
+    const VkXYColorEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "x", value.x);
+    FieldToJson(writer, "y", value.y);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkHdrMetadataEXT& data)
+{
+    const VkHdrMetadataEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "displayPrimaryRed", data.displayPrimaryRed);
+    FieldToJson(writer, "displayPrimaryGreen", data.displayPrimaryGreen);
+    FieldToJson(writer, "displayPrimaryBlue", data.displayPrimaryBlue);
+    FieldToJson(writer, "whitePoint", data.whitePoint);
+    FieldToJson(writer, "maxLuminance", value.maxLuminance);
+    FieldToJson(writer, "minLuminance", value.minLuminance);
+    FieldToJson(writer, "maxContentLightLevel", value.maxContentLightLevel);
+    FieldToJson(writer, "maxFrameAverageLightLevel", value.maxFrameAverageLightLevel);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIOSSurfaceCreateInfoMVK& data)
+{
+    const VkIOSSurfaceCreateInfoMVK& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pView", data.pView);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMacOSSurfaceCreateInfoMVK& data)
+{
+    const VkMacOSSurfaceCreateInfoMVK& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pView", data.pView);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsLabelEXT& data)
+{
+    const VkDebugUtilsLabelEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pLabelName", data.pLabelName);
+    FieldToJson(writer, "color", data.color);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsObjectNameInfoEXT& data)
+{
+    const VkDebugUtilsObjectNameInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "objectType", value.objectType);
+    FieldToJson(writer, "objectHandle", data.objectHandle);
+    FieldToJson(writer, "pObjectName", data.pObjectName);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsMessengerCallbackDataEXT& data)
+{
+    const VkDebugUtilsMessengerCallbackDataEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pMessageIdName", data.pMessageIdName);
+    FieldToJson(writer, "messageIdNumber", value.messageIdNumber);
+    FieldToJson(writer, "pMessage", data.pMessage);
+    FieldToJson(writer, "queueLabelCount", value.queueLabelCount);
+    FieldToJson(writer, "pQueueLabels", data.pQueueLabels);
+    FieldToJson(writer, "cmdBufLabelCount", value.cmdBufLabelCount);
+    FieldToJson(writer, "pCmdBufLabels", data.pCmdBufLabels);
+    FieldToJson(writer, "objectCount", value.objectCount);
+    FieldToJson(writer, "pObjects", data.pObjects);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsMessengerCreateInfoEXT& data)
+{
+    const VkDebugUtilsMessengerCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "messageSeverity", value.messageSeverity);
+    FieldToJson(writer, "messageType", value.messageType);
+    FieldToJson(writer, "pfnUserCallback", data.pfnUserCallback);
+    FieldToJson(writer, "pUserData", data.pUserData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsObjectTagInfoEXT& data)
+{
+    const VkDebugUtilsObjectTagInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "objectType", value.objectType);
+    FieldToJson(writer, "objectHandle", data.objectHandle);
+    FieldToJson(writer, "tagName", value.tagName);
+    FieldToJson(writer, "tagSize", value.tagSize);
+    FieldToJson(writer, "pTag", data.pTag);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidHardwareBufferUsageANDROID& data)
+{
+    const VkAndroidHardwareBufferUsageANDROID& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "androidHardwareBufferUsage", value.androidHardwareBufferUsage);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidHardwareBufferPropertiesANDROID& data)
+{
+    const VkAndroidHardwareBufferPropertiesANDROID& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "allocationSize", value.allocationSize);
+    FieldToJson(writer, "memoryTypeBits", value.memoryTypeBits);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidHardwareBufferFormatPropertiesANDROID& data)
+{
+    const VkAndroidHardwareBufferFormatPropertiesANDROID& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "format", value.format);
+    FieldToJson(writer, "externalFormat", value.externalFormat);
+    FieldToJson(writer, "formatFeatures", value.formatFeatures);
+    FieldToJson(writer, "samplerYcbcrConversionComponents", data.samplerYcbcrConversionComponents);
+    FieldToJson(writer, "suggestedYcbcrModel", value.suggestedYcbcrModel);
+    FieldToJson(writer, "suggestedYcbcrRange", value.suggestedYcbcrRange);
+    FieldToJson(writer, "suggestedXChromaOffset", value.suggestedXChromaOffset);
+    FieldToJson(writer, "suggestedYChromaOffset", value.suggestedYChromaOffset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportAndroidHardwareBufferInfoANDROID& data)
+{
+    const VkImportAndroidHardwareBufferInfoANDROID& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "buffer", data.buffer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID& data)
+{
+    const VkMemoryGetAndroidHardwareBufferInfoANDROID& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memory", data.memory);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalFormatANDROID& data)
+{
+    const VkExternalFormatANDROID& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "externalFormat", value.externalFormat);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& data)
+{
+    const VkPhysicalDeviceInlineUniformBlockFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "inlineUniformBlock", value.inlineUniformBlock);
+    FieldToJson(writer, "descriptorBindingInlineUniformBlockUpdateAfterBind", value.descriptorBindingInlineUniformBlockUpdateAfterBind);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& data)
+{
+    const VkPhysicalDeviceInlineUniformBlockPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxInlineUniformBlockSize", value.maxInlineUniformBlockSize);
+    FieldToJson(writer, "maxPerStageDescriptorInlineUniformBlocks", value.maxPerStageDescriptorInlineUniformBlocks);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks", value.maxPerStageDescriptorUpdateAfterBindInlineUniformBlocks);
+    FieldToJson(writer, "maxDescriptorSetInlineUniformBlocks", value.maxDescriptorSetInlineUniformBlocks);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindInlineUniformBlocks", value.maxDescriptorSetUpdateAfterBindInlineUniformBlocks);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSetInlineUniformBlockEXT& data)
+{
+    const VkWriteDescriptorSetInlineUniformBlockEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "dataSize", value.dataSize);
+    FieldToJson(writer, "pData", data.pData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& data)
+{
+    const VkDescriptorPoolInlineUniformBlockCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxInlineUniformBlockBindings", value.maxInlineUniformBlockBindings);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSampleLocationEXT& data)
+{
+    const VkSampleLocationEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "x", value.x);
+    FieldToJson(writer, "y", value.y);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSampleLocationsInfoEXT& data)
+{
+    const VkSampleLocationsInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "sampleLocationsPerPixel", value.sampleLocationsPerPixel);
+    FieldToJson(writer, "sampleLocationGridSize", data.sampleLocationGridSize);
+    FieldToJson(writer, "sampleLocationsCount", value.sampleLocationsCount);
+    FieldToJson(writer, "pSampleLocations", data.pSampleLocations);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentSampleLocationsEXT& data)
+{
+    const VkAttachmentSampleLocationsEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "attachmentIndex", value.attachmentIndex);
+    FieldToJson(writer, "sampleLocationsInfo", data.sampleLocationsInfo);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassSampleLocationsEXT& data)
+{
+    const VkSubpassSampleLocationsEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "subpassIndex", value.subpassIndex);
+    FieldToJson(writer, "sampleLocationsInfo", data.sampleLocationsInfo);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassSampleLocationsBeginInfoEXT& data)
+{
+    const VkRenderPassSampleLocationsBeginInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "attachmentInitialSampleLocationsCount", value.attachmentInitialSampleLocationsCount);
+    FieldToJson(writer, "pAttachmentInitialSampleLocations", data.pAttachmentInitialSampleLocations);
+    FieldToJson(writer, "postSubpassSampleLocationsCount", value.postSubpassSampleLocationsCount);
+    FieldToJson(writer, "pPostSubpassSampleLocations", data.pPostSubpassSampleLocations);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineSampleLocationsStateCreateInfoEXT& data)
+{
+    const VkPipelineSampleLocationsStateCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "sampleLocationsEnable", value.sampleLocationsEnable);
+    FieldToJson(writer, "sampleLocationsInfo", data.sampleLocationsInfo);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSampleLocationsPropertiesEXT& data)
+{
+    const VkPhysicalDeviceSampleLocationsPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "sampleLocationSampleCounts", value.sampleLocationSampleCounts);
+    FieldToJson(writer, "maxSampleLocationGridSize", data.maxSampleLocationGridSize);
+    FieldToJson(writer, "sampleLocationCoordinateRange", data.sampleLocationCoordinateRange);
+    FieldToJson(writer, "sampleLocationSubPixelBits", value.sampleLocationSubPixelBits);
+    FieldToJson(writer, "variableSampleLocations", value.variableSampleLocations);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMultisamplePropertiesEXT& data)
+{
+    const VkMultisamplePropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxSampleLocationGridSize", data.maxSampleLocationGridSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& data)
+{
+    const VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "advancedBlendCoherentOperations", value.advancedBlendCoherentOperations);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& data)
+{
+    const VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "advancedBlendMaxColorAttachments", value.advancedBlendMaxColorAttachments);
+    FieldToJson(writer, "advancedBlendIndependentBlend", value.advancedBlendIndependentBlend);
+    FieldToJson(writer, "advancedBlendNonPremultipliedSrcColor", value.advancedBlendNonPremultipliedSrcColor);
+    FieldToJson(writer, "advancedBlendNonPremultipliedDstColor", value.advancedBlendNonPremultipliedDstColor);
+    FieldToJson(writer, "advancedBlendCorrelatedOverlap", value.advancedBlendCorrelatedOverlap);
+    FieldToJson(writer, "advancedBlendAllOperations", value.advancedBlendAllOperations);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineColorBlendAdvancedStateCreateInfoEXT& data)
+{
+    const VkPipelineColorBlendAdvancedStateCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "srcPremultiplied", value.srcPremultiplied);
+    FieldToJson(writer, "dstPremultiplied", value.dstPremultiplied);
+    FieldToJson(writer, "blendOverlap", value.blendOverlap);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCoverageToColorStateCreateInfoNV& data)
+{
+    const VkPipelineCoverageToColorStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "coverageToColorEnable", value.coverageToColorEnable);
+    FieldToJson(writer, "coverageToColorLocation", value.coverageToColorLocation);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCoverageModulationStateCreateInfoNV& data)
+{
+    const VkPipelineCoverageModulationStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "coverageModulationMode", value.coverageModulationMode);
+    FieldToJson(writer, "coverageModulationTableEnable", value.coverageModulationTableEnable);
+    FieldToJson(writer, "coverageModulationTableCount", value.coverageModulationTableCount);
+    FieldToJson(writer, "pCoverageModulationTable", data.pCoverageModulationTable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& data)
+{
+    const VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderSMCount", value.shaderSMCount);
+    FieldToJson(writer, "shaderWarpsPerSM", value.shaderWarpsPerSM);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& data)
+{
+    const VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderSMBuiltins", value.shaderSMBuiltins);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrmFormatModifierPropertiesEXT& data)
+{
+    const VkDrmFormatModifierPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "drmFormatModifier", value.drmFormatModifier);
+    FieldToJson(writer, "drmFormatModifierPlaneCount", value.drmFormatModifierPlaneCount);
+    FieldToJson(writer, "drmFormatModifierTilingFeatures", value.drmFormatModifierTilingFeatures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrmFormatModifierPropertiesListEXT& data)
+{
+    const VkDrmFormatModifierPropertiesListEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "drmFormatModifierCount", value.drmFormatModifierCount);
+    FieldToJson(writer, "pDrmFormatModifierProperties", data.pDrmFormatModifierProperties);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& data)
+{
+    const VkPhysicalDeviceImageDrmFormatModifierInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "drmFormatModifier", value.drmFormatModifier);
+    FieldToJson(writer, "sharingMode", value.sharingMode);
+    FieldToJson(writer, "queueFamilyIndexCount", value.queueFamilyIndexCount);
+    FieldToJson(writer, "pQueueFamilyIndices", data.pQueueFamilyIndices);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageDrmFormatModifierListCreateInfoEXT& data)
+{
+    const VkImageDrmFormatModifierListCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "drmFormatModifierCount", value.drmFormatModifierCount);
+    FieldToJson(writer, "pDrmFormatModifiers", data.pDrmFormatModifiers);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageDrmFormatModifierExplicitCreateInfoEXT& data)
+{
+    const VkImageDrmFormatModifierExplicitCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "drmFormatModifier", value.drmFormatModifier);
+    FieldToJson(writer, "drmFormatModifierPlaneCount", value.drmFormatModifierPlaneCount);
+    FieldToJson(writer, "pPlaneLayouts", data.pPlaneLayouts);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageDrmFormatModifierPropertiesEXT& data)
+{
+    const VkImageDrmFormatModifierPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "drmFormatModifier", value.drmFormatModifier);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkValidationCacheCreateInfoEXT& data)
+{
+    const VkValidationCacheCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "initialDataSize", value.initialDataSize);
+    FieldToJson(writer, "pInitialData", data.pInitialData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderModuleValidationCacheCreateInfoEXT& data)
+{
+    const VkShaderModuleValidationCacheCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "validationCache", data.validationCache);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShadingRatePaletteNV& data)
+{
+    const VkShadingRatePaletteNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "shadingRatePaletteEntryCount", value.shadingRatePaletteEntryCount);
+    FieldToJson(writer, "pShadingRatePaletteEntries", data.pShadingRatePaletteEntries);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportShadingRateImageStateCreateInfoNV& data)
+{
+    const VkPipelineViewportShadingRateImageStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shadingRateImageEnable", value.shadingRateImageEnable);
+    FieldToJson(writer, "viewportCount", value.viewportCount);
+    FieldToJson(writer, "pShadingRatePalettes", data.pShadingRatePalettes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShadingRateImageFeaturesNV& data)
+{
+    const VkPhysicalDeviceShadingRateImageFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shadingRateImage", value.shadingRateImage);
+    FieldToJson(writer, "shadingRateCoarseSampleOrder", value.shadingRateCoarseSampleOrder);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShadingRateImagePropertiesNV& data)
+{
+    const VkPhysicalDeviceShadingRateImagePropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shadingRateTexelSize", data.shadingRateTexelSize);
+    FieldToJson(writer, "shadingRatePaletteSize", value.shadingRatePaletteSize);
+    FieldToJson(writer, "shadingRateMaxCoarseSamples", value.shadingRateMaxCoarseSamples);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCoarseSampleLocationNV& data)
+{
+    const VkCoarseSampleLocationNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "pixelX", value.pixelX);
+    FieldToJson(writer, "pixelY", value.pixelY);
+    FieldToJson(writer, "sample", value.sample);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCoarseSampleOrderCustomNV& data)
+{
+    const VkCoarseSampleOrderCustomNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "shadingRate", value.shadingRate);
+    FieldToJson(writer, "sampleCount", value.sampleCount);
+    FieldToJson(writer, "sampleLocationCount", value.sampleLocationCount);
+    FieldToJson(writer, "pSampleLocations", data.pSampleLocations);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& data)
+{
+    const VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "sampleOrderType", value.sampleOrderType);
+    FieldToJson(writer, "customSampleOrderCount", value.customSampleOrderCount);
+    FieldToJson(writer, "pCustomSampleOrders", data.pCustomSampleOrders);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingShaderGroupCreateInfoNV& data)
+{
+    const VkRayTracingShaderGroupCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "generalShader", value.generalShader);
+    FieldToJson(writer, "closestHitShader", value.closestHitShader);
+    FieldToJson(writer, "anyHitShader", value.anyHitShader);
+    FieldToJson(writer, "intersectionShader", value.intersectionShader);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingPipelineCreateInfoNV& data)
+{
+    const VkRayTracingPipelineCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "stageCount", value.stageCount);
+    FieldToJson(writer, "pStages", data.pStages);
+    FieldToJson(writer, "groupCount", value.groupCount);
+    FieldToJson(writer, "pGroups", data.pGroups);
+    FieldToJson(writer, "maxRecursionDepth", value.maxRecursionDepth);
+    FieldToJson(writer, "layout", data.layout);
+    FieldToJson(writer, "basePipelineHandle", data.basePipelineHandle);
+    FieldToJson(writer, "basePipelineIndex", value.basePipelineIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryTrianglesNV& data)
+{
+    const VkGeometryTrianglesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "vertexData", data.vertexData);
+    FieldToJson(writer, "vertexOffset", value.vertexOffset);
+    FieldToJson(writer, "vertexCount", value.vertexCount);
+    FieldToJson(writer, "vertexStride", value.vertexStride);
+    FieldToJson(writer, "vertexFormat", value.vertexFormat);
+    FieldToJson(writer, "indexData", data.indexData);
+    FieldToJson(writer, "indexOffset", value.indexOffset);
+    FieldToJson(writer, "indexCount", value.indexCount);
+    FieldToJson(writer, "indexType", value.indexType);
+    FieldToJson(writer, "transformData", data.transformData);
+    FieldToJson(writer, "transformOffset", value.transformOffset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryAABBNV& data)
+{
+    const VkGeometryAABBNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "aabbData", data.aabbData);
+    FieldToJson(writer, "numAABBs", value.numAABBs);
+    FieldToJson(writer, "stride", value.stride);
+    FieldToJson(writer, "offset", value.offset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryDataNV& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "triangles", data.triangles);
+    FieldToJson(writer, "aabbs", data.aabbs);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryNV& data)
+{
+    const VkGeometryNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "geometryType", value.geometryType);
+    FieldToJson(writer, "geometry", data.geometry);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureInfoNV& data)
+{
+    const VkAccelerationStructureInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "instanceCount", value.instanceCount);
+    FieldToJson(writer, "geometryCount", value.geometryCount);
+    FieldToJson(writer, "pGeometries", data.pGeometries);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureCreateInfoNV& data)
+{
+    const VkAccelerationStructureCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "compactedSize", value.compactedSize);
+    FieldToJson(writer, "info", data.info);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindAccelerationStructureMemoryInfoNV& data)
+{
+    const VkBindAccelerationStructureMemoryInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "accelerationStructure", data.accelerationStructure);
+    FieldToJson(writer, "memory", data.memory);
+    FieldToJson(writer, "memoryOffset", value.memoryOffset);
+    FieldToJson(writer, "deviceIndexCount", value.deviceIndexCount);
+    FieldToJson(writer, "pDeviceIndices", data.pDeviceIndices);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSetAccelerationStructureNV& data)
+{
+    const VkWriteDescriptorSetAccelerationStructureNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "accelerationStructureCount", value.accelerationStructureCount);
+    FieldToJson(writer, "pAccelerationStructures", data.pAccelerationStructures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureMemoryRequirementsInfoNV& data)
+{
+    const VkAccelerationStructureMemoryRequirementsInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "accelerationStructure", data.accelerationStructure);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayTracingPropertiesNV& data)
+{
+    const VkPhysicalDeviceRayTracingPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderGroupHandleSize", value.shaderGroupHandleSize);
+    FieldToJson(writer, "maxRecursionDepth", value.maxRecursionDepth);
+    FieldToJson(writer, "maxShaderGroupStride", value.maxShaderGroupStride);
+    FieldToJson(writer, "shaderGroupBaseAlignment", value.shaderGroupBaseAlignment);
+    FieldToJson(writer, "maxGeometryCount", value.maxGeometryCount);
+    FieldToJson(writer, "maxInstanceCount", value.maxInstanceCount);
+    FieldToJson(writer, "maxTriangleCount", value.maxTriangleCount);
+    FieldToJson(writer, "maxDescriptorSetAccelerationStructures", value.maxDescriptorSetAccelerationStructures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTransformMatrixKHR& data)
+{
+    writer.BeginObject();
+    FieldToJson(writer, "matrix", data.matrix);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAabbPositionsKHR& data)
+{
+    const VkAabbPositionsKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "minX", value.minX);
+    FieldToJson(writer, "minY", value.minY);
+    FieldToJson(writer, "minZ", value.minZ);
+    FieldToJson(writer, "maxX", value.maxX);
+    FieldToJson(writer, "maxY", value.maxY);
+    FieldToJson(writer, "maxZ", value.maxZ);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureInstanceKHR& data)
+{
+    const VkAccelerationStructureInstanceKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "transform", data.transform);
+    FieldToJson(writer, "instanceCustomIndex", static_cast<uint32_t>(value.instanceCustomIndex));
+    FieldToJson(writer, "mask", static_cast<uint32_t>(value.mask));
+    FieldToJson(writer, "instanceShaderBindingTableRecordOffset", static_cast<uint32_t>(value.instanceShaderBindingTableRecordOffset));
+    FieldToJson(writer, "flags", static_cast<VkGeometryInstanceFlagsKHR>(value.flags));
+    FieldToJson(writer, "accelerationStructureReference", value.accelerationStructureReference);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& data)
+{
+    const VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "representativeFragmentTest", value.representativeFragmentTest);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& data)
+{
+    const VkPipelineRepresentativeFragmentTestStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "representativeFragmentTestEnable", value.representativeFragmentTestEnable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageViewImageFormatInfoEXT& data)
+{
+    const VkPhysicalDeviceImageViewImageFormatInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "imageViewType", value.imageViewType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFilterCubicImageViewImageFormatPropertiesEXT& data)
+{
+    const VkFilterCubicImageViewImageFormatPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "filterCubic", value.filterCubic);
+    FieldToJson(writer, "filterCubicMinmax", value.filterCubicMinmax);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceQueueGlobalPriorityCreateInfoEXT& data)
+{
+    const VkDeviceQueueGlobalPriorityCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "globalPriority", value.globalPriority);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryHostPointerInfoEXT& data)
+{
+    const VkImportMemoryHostPointerInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "handleType", value.handleType);
+    FieldToJson(writer, "pHostPointer", data.pHostPointer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryHostPointerPropertiesEXT& data)
+{
+    const VkMemoryHostPointerPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memoryTypeBits", value.memoryTypeBits);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& data)
+{
+    const VkPhysicalDeviceExternalMemoryHostPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "minImportedHostPointerAlignment", value.minImportedHostPointerAlignment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCompilerControlCreateInfoAMD& data)
+{
+    const VkPipelineCompilerControlCreateInfoAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "compilerControlFlags", value.compilerControlFlags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCalibratedTimestampInfoEXT& data)
+{
+    const VkCalibratedTimestampInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "timeDomain", value.timeDomain);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderCorePropertiesAMD& data)
+{
+    const VkPhysicalDeviceShaderCorePropertiesAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderEngineCount", value.shaderEngineCount);
+    FieldToJson(writer, "shaderArraysPerEngineCount", value.shaderArraysPerEngineCount);
+    FieldToJson(writer, "computeUnitsPerShaderArray", value.computeUnitsPerShaderArray);
+    FieldToJson(writer, "simdPerComputeUnit", value.simdPerComputeUnit);
+    FieldToJson(writer, "wavefrontsPerSimd", value.wavefrontsPerSimd);
+    FieldToJson(writer, "wavefrontSize", value.wavefrontSize);
+    FieldToJson(writer, "sgprsPerSimd", value.sgprsPerSimd);
+    FieldToJson(writer, "minSgprAllocation", value.minSgprAllocation);
+    FieldToJson(writer, "maxSgprAllocation", value.maxSgprAllocation);
+    FieldToJson(writer, "sgprAllocationGranularity", value.sgprAllocationGranularity);
+    FieldToJson(writer, "vgprsPerSimd", value.vgprsPerSimd);
+    FieldToJson(writer, "minVgprAllocation", value.minVgprAllocation);
+    FieldToJson(writer, "maxVgprAllocation", value.maxVgprAllocation);
+    FieldToJson(writer, "vgprAllocationGranularity", value.vgprAllocationGranularity);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceMemoryOverallocationCreateInfoAMD& data)
+{
+    const VkDeviceMemoryOverallocationCreateInfoAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "overallocationBehavior", value.overallocationBehavior);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& data)
+{
+    const VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxVertexAttribDivisor", value.maxVertexAttribDivisor);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkVertexInputBindingDivisorDescriptionEXT& data)
+{
+    const VkVertexInputBindingDivisorDescriptionEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "binding", value.binding);
+    FieldToJson(writer, "divisor", value.divisor);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineVertexInputDivisorStateCreateInfoEXT& data)
+{
+    const VkPipelineVertexInputDivisorStateCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "vertexBindingDivisorCount", value.vertexBindingDivisorCount);
+    FieldToJson(writer, "pVertexBindingDivisors", data.pVertexBindingDivisors);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& data)
+{
+    const VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "vertexAttributeInstanceRateDivisor", value.vertexAttributeInstanceRateDivisor);
+    FieldToJson(writer, "vertexAttributeInstanceRateZeroDivisor", value.vertexAttributeInstanceRateZeroDivisor);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentFrameTokenGGP& data)
+{
+    const VkPresentFrameTokenGGP& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "frameToken", value.frameToken);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCreationFeedbackEXT& data)
+{
+    const VkPipelineCreationFeedbackEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "duration", value.duration);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCreationFeedbackCreateInfoEXT& data)
+{
+    const VkPipelineCreationFeedbackCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pPipelineCreationFeedback", data.pPipelineCreationFeedback);
+    FieldToJson(writer, "pipelineStageCreationFeedbackCount", value.pipelineStageCreationFeedbackCount);
+    FieldToJson(writer, "pPipelineStageCreationFeedbacks", data.pPipelineStageCreationFeedbacks);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& data)
+{
+    const VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "computeDerivativeGroupQuads", value.computeDerivativeGroupQuads);
+    FieldToJson(writer, "computeDerivativeGroupLinear", value.computeDerivativeGroupLinear);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMeshShaderFeaturesNV& data)
+{
+    const VkPhysicalDeviceMeshShaderFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "taskShader", value.taskShader);
+    FieldToJson(writer, "meshShader", value.meshShader);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMeshShaderPropertiesNV& data)
+{
+    const VkPhysicalDeviceMeshShaderPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxDrawMeshTasksCount", value.maxDrawMeshTasksCount);
+    FieldToJson(writer, "maxTaskWorkGroupInvocations", value.maxTaskWorkGroupInvocations);
+    FieldToJson(writer, "maxTaskWorkGroupSize", data.maxTaskWorkGroupSize);
+    FieldToJson(writer, "maxTaskTotalMemorySize", value.maxTaskTotalMemorySize);
+    FieldToJson(writer, "maxTaskOutputCount", value.maxTaskOutputCount);
+    FieldToJson(writer, "maxMeshWorkGroupInvocations", value.maxMeshWorkGroupInvocations);
+    FieldToJson(writer, "maxMeshWorkGroupSize", data.maxMeshWorkGroupSize);
+    FieldToJson(writer, "maxMeshTotalMemorySize", value.maxMeshTotalMemorySize);
+    FieldToJson(writer, "maxMeshOutputVertices", value.maxMeshOutputVertices);
+    FieldToJson(writer, "maxMeshOutputPrimitives", value.maxMeshOutputPrimitives);
+    FieldToJson(writer, "maxMeshMultiviewViewCount", value.maxMeshMultiviewViewCount);
+    FieldToJson(writer, "meshOutputPerVertexGranularity", value.meshOutputPerVertexGranularity);
+    FieldToJson(writer, "meshOutputPerPrimitiveGranularity", value.meshOutputPerPrimitiveGranularity);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrawMeshTasksIndirectCommandNV& data)
+{
+    const VkDrawMeshTasksIndirectCommandNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "taskCount", value.taskCount);
+    FieldToJson(writer, "firstTask", value.firstTask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& data)
+{
+    const VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fragmentShaderBarycentric", value.fragmentShaderBarycentric);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderImageFootprintFeaturesNV& data)
+{
+    const VkPhysicalDeviceShaderImageFootprintFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "imageFootprint", value.imageFootprint);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportExclusiveScissorStateCreateInfoNV& data)
+{
+    const VkPipelineViewportExclusiveScissorStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "exclusiveScissorCount", value.exclusiveScissorCount);
+    FieldToJson(writer, "pExclusiveScissors", data.pExclusiveScissors);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExclusiveScissorFeaturesNV& data)
+{
+    const VkPhysicalDeviceExclusiveScissorFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "exclusiveScissor", value.exclusiveScissor);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueueFamilyCheckpointPropertiesNV& data)
+{
+    const VkQueueFamilyCheckpointPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "checkpointExecutionStageMask", value.checkpointExecutionStageMask);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCheckpointDataNV& data)
+{
+    const VkCheckpointDataNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "stage", value.stage);
+    FieldToJson(writer, "pCheckpointMarker", data.pCheckpointMarker);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& data)
+{
+    const VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderIntegerFunctions2", value.shaderIntegerFunctions2);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkInitializePerformanceApiInfoINTEL& data)
+{
+    const VkInitializePerformanceApiInfoINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pUserData", data.pUserData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueryPoolPerformanceQueryCreateInfoINTEL& data)
+{
+    const VkQueryPoolPerformanceQueryCreateInfoINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "performanceCountersSampling", value.performanceCountersSampling);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceMarkerInfoINTEL& data)
+{
+    const VkPerformanceMarkerInfoINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "marker", value.marker);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceStreamMarkerInfoINTEL& data)
+{
+    const VkPerformanceStreamMarkerInfoINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "marker", value.marker);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceOverrideInfoINTEL& data)
+{
+    const VkPerformanceOverrideInfoINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "enable", value.enable);
+    FieldToJson(writer, "parameter", value.parameter);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceConfigurationAcquireInfoINTEL& data)
+{
+    const VkPerformanceConfigurationAcquireInfoINTEL& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "type", value.type);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePCIBusInfoPropertiesEXT& data)
+{
+    const VkPhysicalDevicePCIBusInfoPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pciDomain", value.pciDomain);
+    FieldToJson(writer, "pciBus", value.pciBus);
+    FieldToJson(writer, "pciDevice", value.pciDevice);
+    FieldToJson(writer, "pciFunction", value.pciFunction);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayNativeHdrSurfaceCapabilitiesAMD& data)
+{
+    const VkDisplayNativeHdrSurfaceCapabilitiesAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "localDimmingSupport", value.localDimmingSupport);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSwapchainDisplayNativeHdrCreateInfoAMD& data)
+{
+    const VkSwapchainDisplayNativeHdrCreateInfoAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "localDimmingEnable", value.localDimmingEnable);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImagePipeSurfaceCreateInfoFUCHSIA& data)
+{
+    const VkImagePipeSurfaceCreateInfoFUCHSIA& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "imagePipeHandle", value.imagePipeHandle);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMetalSurfaceCreateInfoEXT& data)
+{
+    const VkMetalSurfaceCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pLayer", data.pLayer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& data)
+{
+    const VkPhysicalDeviceFragmentDensityMapFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fragmentDensityMap", value.fragmentDensityMap);
+    FieldToJson(writer, "fragmentDensityMapDynamic", value.fragmentDensityMapDynamic);
+    FieldToJson(writer, "fragmentDensityMapNonSubsampledImages", value.fragmentDensityMapNonSubsampledImages);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& data)
+{
+    const VkPhysicalDeviceFragmentDensityMapPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "minFragmentDensityTexelSize", data.minFragmentDensityTexelSize);
+    FieldToJson(writer, "maxFragmentDensityTexelSize", data.maxFragmentDensityTexelSize);
+    FieldToJson(writer, "fragmentDensityInvocations", value.fragmentDensityInvocations);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassFragmentDensityMapCreateInfoEXT& data)
+{
+    const VkRenderPassFragmentDensityMapCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fragmentDensityMapAttachment", data.fragmentDensityMapAttachment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSubgroupSizeControlFeaturesEXT& data)
+{
+    const VkPhysicalDeviceSubgroupSizeControlFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "subgroupSizeControl", value.subgroupSizeControl);
+    FieldToJson(writer, "computeFullSubgroups", value.computeFullSubgroups);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSubgroupSizeControlPropertiesEXT& data)
+{
+    const VkPhysicalDeviceSubgroupSizeControlPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "minSubgroupSize", value.minSubgroupSize);
+    FieldToJson(writer, "maxSubgroupSize", value.maxSubgroupSize);
+    FieldToJson(writer, "maxComputeWorkgroupSubgroups", value.maxComputeWorkgroupSubgroups);
+    FieldToJson(writer, "requiredSubgroupSizeStages", value.requiredSubgroupSizeStages);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT& data)
+{
+    const VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "requiredSubgroupSize", value.requiredSubgroupSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderCoreProperties2AMD& data)
+{
+    const VkPhysicalDeviceShaderCoreProperties2AMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderCoreFeatures", value.shaderCoreFeatures);
+    FieldToJson(writer, "activeComputeUnitCount", value.activeComputeUnitCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCoherentMemoryFeaturesAMD& data)
+{
+    const VkPhysicalDeviceCoherentMemoryFeaturesAMD& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceCoherentMemory", value.deviceCoherentMemory);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& data)
+{
+    const VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderImageInt64Atomics", value.shaderImageInt64Atomics);
+    FieldToJson(writer, "sparseImageInt64Atomics", value.sparseImageInt64Atomics);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryBudgetPropertiesEXT& data)
+{
+    const VkPhysicalDeviceMemoryBudgetPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "heapBudget", data.heapBudget);
+    FieldToJson(writer, "heapUsage", data.heapUsage);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryPriorityFeaturesEXT& data)
+{
+    const VkPhysicalDeviceMemoryPriorityFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "memoryPriority", value.memoryPriority);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryPriorityAllocateInfoEXT& data)
+{
+    const VkMemoryPriorityAllocateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "priority", value.priority);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& data)
+{
+    const VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "dedicatedAllocationImageAliasing", value.dedicatedAllocationImageAliasing);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& data)
+{
+    const VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "bufferDeviceAddress", value.bufferDeviceAddress);
+    FieldToJson(writer, "bufferDeviceAddressCaptureReplay", value.bufferDeviceAddressCaptureReplay);
+    FieldToJson(writer, "bufferDeviceAddressMultiDevice", value.bufferDeviceAddressMultiDevice);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferDeviceAddressCreateInfoEXT& data)
+{
+    const VkBufferDeviceAddressCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceAddress", value.deviceAddress);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceToolPropertiesEXT& data)
+{
+    const VkPhysicalDeviceToolPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "name", data.name);
+    FieldToJson(writer, "version", data.version);
+    FieldToJson(writer, "purposes", value.purposes);
+    FieldToJson(writer, "description", data.description);
+    FieldToJson(writer, "layer", data.layer);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkValidationFeaturesEXT& data)
+{
+    const VkValidationFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "enabledValidationFeatureCount", value.enabledValidationFeatureCount);
+    FieldToJson(writer, "pEnabledValidationFeatures", data.pEnabledValidationFeatures);
+    FieldToJson(writer, "disabledValidationFeatureCount", value.disabledValidationFeatureCount);
+    FieldToJson(writer, "pDisabledValidationFeatures", data.pDisabledValidationFeatures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCooperativeMatrixPropertiesNV& data)
+{
+    const VkCooperativeMatrixPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "MSize", value.MSize);
+    FieldToJson(writer, "NSize", value.NSize);
+    FieldToJson(writer, "KSize", value.KSize);
+    FieldToJson(writer, "AType", value.AType);
+    FieldToJson(writer, "BType", value.BType);
+    FieldToJson(writer, "CType", value.CType);
+    FieldToJson(writer, "DType", value.DType);
+    FieldToJson(writer, "scope", value.scope);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCooperativeMatrixFeaturesNV& data)
+{
+    const VkPhysicalDeviceCooperativeMatrixFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "cooperativeMatrix", value.cooperativeMatrix);
+    FieldToJson(writer, "cooperativeMatrixRobustBufferAccess", value.cooperativeMatrixRobustBufferAccess);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCooperativeMatrixPropertiesNV& data)
+{
+    const VkPhysicalDeviceCooperativeMatrixPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "cooperativeMatrixSupportedStages", value.cooperativeMatrixSupportedStages);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCoverageReductionModeFeaturesNV& data)
+{
+    const VkPhysicalDeviceCoverageReductionModeFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "coverageReductionMode", value.coverageReductionMode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCoverageReductionStateCreateInfoNV& data)
+{
+    const VkPipelineCoverageReductionStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "coverageReductionMode", value.coverageReductionMode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferMixedSamplesCombinationNV& data)
+{
+    const VkFramebufferMixedSamplesCombinationNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "coverageReductionMode", value.coverageReductionMode);
+    FieldToJson(writer, "rasterizationSamples", value.rasterizationSamples);
+    FieldToJson(writer, "depthStencilSamples", value.depthStencilSamples);
+    FieldToJson(writer, "colorSamples", value.colorSamples);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& data)
+{
+    const VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fragmentShaderSampleInterlock", value.fragmentShaderSampleInterlock);
+    FieldToJson(writer, "fragmentShaderPixelInterlock", value.fragmentShaderPixelInterlock);
+    FieldToJson(writer, "fragmentShaderShadingRateInterlock", value.fragmentShaderShadingRateInterlock);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& data)
+{
+    const VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "ycbcrImageArrays", value.ycbcrImageArrays);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFullScreenExclusiveInfoEXT& data)
+{
+    const VkSurfaceFullScreenExclusiveInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fullScreenExclusive", value.fullScreenExclusive);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilitiesFullScreenExclusiveEXT& data)
+{
+    const VkSurfaceCapabilitiesFullScreenExclusiveEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fullScreenExclusiveSupported", value.fullScreenExclusiveSupported);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFullScreenExclusiveWin32InfoEXT& data)
+{
+    const VkSurfaceFullScreenExclusiveWin32InfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "hmonitor", data.hmonitor);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkHeadlessSurfaceCreateInfoEXT& data)
+{
+    const VkHeadlessSurfaceCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceLineRasterizationFeaturesEXT& data)
+{
+    const VkPhysicalDeviceLineRasterizationFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "rectangularLines", value.rectangularLines);
+    FieldToJson(writer, "bresenhamLines", value.bresenhamLines);
+    FieldToJson(writer, "smoothLines", value.smoothLines);
+    FieldToJson(writer, "stippledRectangularLines", value.stippledRectangularLines);
+    FieldToJson(writer, "stippledBresenhamLines", value.stippledBresenhamLines);
+    FieldToJson(writer, "stippledSmoothLines", value.stippledSmoothLines);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceLineRasterizationPropertiesEXT& data)
+{
+    const VkPhysicalDeviceLineRasterizationPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "lineSubPixelPrecisionBits", value.lineSubPixelPrecisionBits);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationLineStateCreateInfoEXT& data)
+{
+    const VkPipelineRasterizationLineStateCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "lineRasterizationMode", value.lineRasterizationMode);
+    FieldToJson(writer, "stippledLineEnable", value.stippledLineEnable);
+    FieldToJson(writer, "lineStippleFactor", value.lineStippleFactor);
+    FieldToJson(writer, "lineStipplePattern", value.lineStipplePattern);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& data)
+{
+    const VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderBufferFloat32Atomics", value.shaderBufferFloat32Atomics);
+    FieldToJson(writer, "shaderBufferFloat32AtomicAdd", value.shaderBufferFloat32AtomicAdd);
+    FieldToJson(writer, "shaderBufferFloat64Atomics", value.shaderBufferFloat64Atomics);
+    FieldToJson(writer, "shaderBufferFloat64AtomicAdd", value.shaderBufferFloat64AtomicAdd);
+    FieldToJson(writer, "shaderSharedFloat32Atomics", value.shaderSharedFloat32Atomics);
+    FieldToJson(writer, "shaderSharedFloat32AtomicAdd", value.shaderSharedFloat32AtomicAdd);
+    FieldToJson(writer, "shaderSharedFloat64Atomics", value.shaderSharedFloat64Atomics);
+    FieldToJson(writer, "shaderSharedFloat64AtomicAdd", value.shaderSharedFloat64AtomicAdd);
+    FieldToJson(writer, "shaderImageFloat32Atomics", value.shaderImageFloat32Atomics);
+    FieldToJson(writer, "shaderImageFloat32AtomicAdd", value.shaderImageFloat32AtomicAdd);
+    FieldToJson(writer, "sparseImageFloat32Atomics", value.sparseImageFloat32Atomics);
+    FieldToJson(writer, "sparseImageFloat32AtomicAdd", value.sparseImageFloat32AtomicAdd);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& data)
+{
+    const VkPhysicalDeviceIndexTypeUint8FeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "indexTypeUint8", value.indexTypeUint8);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& data)
+{
+    const VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "extendedDynamicState", value.extendedDynamicState);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& data)
+{
+    const VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderDemoteToHelperInvocation", value.shaderDemoteToHelperInvocation);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& data)
+{
+    const VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxGraphicsShaderGroupCount", value.maxGraphicsShaderGroupCount);
+    FieldToJson(writer, "maxIndirectSequenceCount", value.maxIndirectSequenceCount);
+    FieldToJson(writer, "maxIndirectCommandsTokenCount", value.maxIndirectCommandsTokenCount);
+    FieldToJson(writer, "maxIndirectCommandsStreamCount", value.maxIndirectCommandsStreamCount);
+    FieldToJson(writer, "maxIndirectCommandsTokenOffset", value.maxIndirectCommandsTokenOffset);
+    FieldToJson(writer, "maxIndirectCommandsStreamStride", value.maxIndirectCommandsStreamStride);
+    FieldToJson(writer, "minSequencesCountBufferOffsetAlignment", value.minSequencesCountBufferOffsetAlignment);
+    FieldToJson(writer, "minSequencesIndexBufferOffsetAlignment", value.minSequencesIndexBufferOffsetAlignment);
+    FieldToJson(writer, "minIndirectCommandsBufferOffsetAlignment", value.minIndirectCommandsBufferOffsetAlignment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& data)
+{
+    const VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceGeneratedCommands", value.deviceGeneratedCommands);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGraphicsShaderGroupCreateInfoNV& data)
+{
+    const VkGraphicsShaderGroupCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "stageCount", value.stageCount);
+    FieldToJson(writer, "pStages", data.pStages);
+    FieldToJson(writer, "pVertexInputState", data.pVertexInputState);
+    FieldToJson(writer, "pTessellationState", data.pTessellationState);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGraphicsPipelineShaderGroupsCreateInfoNV& data)
+{
+    const VkGraphicsPipelineShaderGroupsCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "groupCount", value.groupCount);
+    FieldToJson(writer, "pGroups", data.pGroups);
+    FieldToJson(writer, "pipelineCount", value.pipelineCount);
+    FieldToJson(writer, "pPipelines", data.pPipelines);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindShaderGroupIndirectCommandNV& data)
+{
+    const VkBindShaderGroupIndirectCommandNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "groupIndex", value.groupIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindIndexBufferIndirectCommandNV& data)
+{
+    const VkBindIndexBufferIndirectCommandNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "bufferAddress", value.bufferAddress);
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "indexType", value.indexType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindVertexBufferIndirectCommandNV& data)
+{
+    const VkBindVertexBufferIndirectCommandNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "bufferAddress", value.bufferAddress);
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "stride", value.stride);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSetStateFlagsIndirectCommandNV& data)
+{
+    const VkSetStateFlagsIndirectCommandNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "data", value.data);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIndirectCommandsStreamNV& data)
+{
+    const VkIndirectCommandsStreamNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "offset", value.offset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIndirectCommandsLayoutTokenNV& data)
+{
+    const VkIndirectCommandsLayoutTokenNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "tokenType", value.tokenType);
+    FieldToJson(writer, "stream", value.stream);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "vertexBindingUnit", value.vertexBindingUnit);
+    FieldToJson(writer, "vertexDynamicStride", value.vertexDynamicStride);
+    FieldToJson(writer, "pushconstantPipelineLayout", data.pushconstantPipelineLayout);
+    FieldToJson(writer, "pushconstantShaderStageFlags", value.pushconstantShaderStageFlags);
+    FieldToJson(writer, "pushconstantOffset", value.pushconstantOffset);
+    FieldToJson(writer, "pushconstantSize", value.pushconstantSize);
+    FieldToJson(writer, "indirectStateFlags", value.indirectStateFlags);
+    FieldToJson(writer, "indexTypeCount", value.indexTypeCount);
+    FieldToJson(writer, "pIndexTypes", data.pIndexTypes);
+    FieldToJson(writer, "pIndexTypeValues", data.pIndexTypeValues);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIndirectCommandsLayoutCreateInfoNV& data)
+{
+    const VkIndirectCommandsLayoutCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pipelineBindPoint", value.pipelineBindPoint);
+    FieldToJson(writer, "tokenCount", value.tokenCount);
+    FieldToJson(writer, "pTokens", data.pTokens);
+    FieldToJson(writer, "streamCount", value.streamCount);
+    FieldToJson(writer, "pStreamStrides", data.pStreamStrides);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeneratedCommandsInfoNV& data)
+{
+    const VkGeneratedCommandsInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pipelineBindPoint", value.pipelineBindPoint);
+    FieldToJson(writer, "pipeline", data.pipeline);
+    FieldToJson(writer, "indirectCommandsLayout", data.indirectCommandsLayout);
+    FieldToJson(writer, "streamCount", value.streamCount);
+    FieldToJson(writer, "pStreams", data.pStreams);
+    FieldToJson(writer, "sequencesCount", value.sequencesCount);
+    FieldToJson(writer, "preprocessBuffer", data.preprocessBuffer);
+    FieldToJson(writer, "preprocessOffset", value.preprocessOffset);
+    FieldToJson(writer, "preprocessSize", value.preprocessSize);
+    FieldToJson(writer, "sequencesCountBuffer", data.sequencesCountBuffer);
+    FieldToJson(writer, "sequencesCountOffset", value.sequencesCountOffset);
+    FieldToJson(writer, "sequencesIndexBuffer", data.sequencesIndexBuffer);
+    FieldToJson(writer, "sequencesIndexOffset", value.sequencesIndexOffset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV& data)
+{
+    const VkGeneratedCommandsMemoryRequirementsInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pipelineBindPoint", value.pipelineBindPoint);
+    FieldToJson(writer, "pipeline", data.pipeline);
+    FieldToJson(writer, "indirectCommandsLayout", data.indirectCommandsLayout);
+    FieldToJson(writer, "maxSequencesCount", value.maxSequencesCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& data)
+{
+    const VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "texelBufferAlignment", value.texelBufferAlignment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& data)
+{
+    const VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "storageTexelBufferOffsetAlignmentBytes", value.storageTexelBufferOffsetAlignmentBytes);
+    FieldToJson(writer, "storageTexelBufferOffsetSingleTexelAlignment", value.storageTexelBufferOffsetSingleTexelAlignment);
+    FieldToJson(writer, "uniformTexelBufferOffsetAlignmentBytes", value.uniformTexelBufferOffsetAlignmentBytes);
+    FieldToJson(writer, "uniformTexelBufferOffsetSingleTexelAlignment", value.uniformTexelBufferOffsetSingleTexelAlignment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassTransformBeginInfoQCOM& data)
+{
+    const VkRenderPassTransformBeginInfoQCOM& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "transform", value.transform);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& data)
+{
+    const VkCommandBufferInheritanceRenderPassTransformInfoQCOM& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "transform", value.transform);
+    FieldToJson(writer, "renderArea", data.renderArea);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& data)
+{
+    const VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "deviceMemoryReport", value.deviceMemoryReport);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceMemoryReportCallbackDataEXT& data)
+{
+    const VkDeviceMemoryReportCallbackDataEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "memoryObjectId", value.memoryObjectId);
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "objectType", value.objectType);
+    FieldToJson(writer, "objectHandle", value.objectHandle);
+    FieldToJson(writer, "heapIndex", value.heapIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceDeviceMemoryReportCreateInfoEXT& data)
+{
+    const VkDeviceDeviceMemoryReportCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "pfnUserCallback", data.pfnUserCallback);
+    FieldToJson(writer, "pUserData", data.pUserData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRobustness2FeaturesEXT& data)
+{
+    const VkPhysicalDeviceRobustness2FeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "robustBufferAccess2", value.robustBufferAccess2);
+    FieldToJson(writer, "robustImageAccess2", value.robustImageAccess2);
+    FieldToJson(writer, "nullDescriptor", value.nullDescriptor);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRobustness2PropertiesEXT& data)
+{
+    const VkPhysicalDeviceRobustness2PropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "robustStorageBufferAccessSizeAlignment", value.robustStorageBufferAccessSizeAlignment);
+    FieldToJson(writer, "robustUniformBufferAccessSizeAlignment", value.robustUniformBufferAccessSizeAlignment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerCustomBorderColorCreateInfoEXT& data)
+{
+    const VkSamplerCustomBorderColorCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "customBorderColor", data.customBorderColor);
+    FieldToJson(writer, "format", value.format);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCustomBorderColorPropertiesEXT& data)
+{
+    const VkPhysicalDeviceCustomBorderColorPropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxCustomBorderColorSamplers", value.maxCustomBorderColorSamplers);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCustomBorderColorFeaturesEXT& data)
+{
+    const VkPhysicalDeviceCustomBorderColorFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "customBorderColors", value.customBorderColors);
+    FieldToJson(writer, "customBorderColorWithoutFormat", value.customBorderColorWithoutFormat);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePrivateDataFeaturesEXT& data)
+{
+    const VkPhysicalDevicePrivateDataFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "privateData", value.privateData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDevicePrivateDataCreateInfoEXT& data)
+{
+    const VkDevicePrivateDataCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "privateDataSlotRequestCount", value.privateDataSlotRequestCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPrivateDataSlotCreateInfoEXT& data)
+{
+    const VkPrivateDataSlotCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT& data)
+{
+    const VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pipelineCreationCacheControl", value.pipelineCreationCacheControl);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& data)
+{
+    const VkPhysicalDeviceDiagnosticsConfigFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "diagnosticsConfig", value.diagnosticsConfig);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceDiagnosticsConfigCreateInfoNV& data)
+{
+    const VkDeviceDiagnosticsConfigCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& data)
+{
+    const VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fragmentShadingRateEnums", value.fragmentShadingRateEnums);
+    FieldToJson(writer, "supersampleFragmentShadingRates", value.supersampleFragmentShadingRates);
+    FieldToJson(writer, "noInvocationFragmentShadingRates", value.noInvocationFragmentShadingRates);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& data)
+{
+    const VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxFragmentShadingRateInvocationCount", value.maxFragmentShadingRateInvocationCount);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& data)
+{
+    const VkPipelineFragmentShadingRateEnumStateCreateInfoNV& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shadingRateType", value.shadingRateType);
+    FieldToJson(writer, "shadingRate", value.shadingRate);
+    FieldToJson(writer, "combinerOps", data.combinerOps);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& data)
+{
+    const VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "fragmentDensityMapDeferred", value.fragmentDensityMapDeferred);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& data)
+{
+    const VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "subsampledLoads", value.subsampledLoads);
+    FieldToJson(writer, "subsampledCoarseReconstructionEarlyAccess", value.subsampledCoarseReconstructionEarlyAccess);
+    FieldToJson(writer, "maxSubsampledArrayLayers", value.maxSubsampledArrayLayers);
+    FieldToJson(writer, "maxDescriptorSetSubsampledSamplers", value.maxDescriptorSetSubsampledSamplers);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyCommandTransformInfoQCOM& data)
+{
+    const VkCopyCommandTransformInfoQCOM& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "transform", value.transform);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageRobustnessFeaturesEXT& data)
+{
+    const VkPhysicalDeviceImageRobustnessFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "robustImageAccess", value.robustImageAccess);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevice4444FormatsFeaturesEXT& data)
+{
+    const VkPhysicalDevice4444FormatsFeaturesEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "formatA4R4G4B4", value.formatA4R4G4B4);
+    FieldToJson(writer, "formatA4B4G4R4", value.formatA4B4G4R4);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDirectFBSurfaceCreateInfoEXT& data)
+{
+    const VkDirectFBSurfaceCreateInfoEXT& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "dfb", data.dfb);
+    FieldToJson(writer, "surface", data.surface);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE& data)
+{
+    const VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "mutableDescriptorType", value.mutableDescriptorType);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMutableDescriptorTypeListVALVE& data)
+{
+    const VkMutableDescriptorTypeListVALVE& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "descriptorTypeCount", value.descriptorTypeCount);
+    FieldToJson(writer, "pDescriptorTypes", data.pDescriptorTypes);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMutableDescriptorTypeCreateInfoVALVE& data)
+{
+    const VkMutableDescriptorTypeCreateInfoVALVE& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "mutableDescriptorTypeListCount", value.mutableDescriptorTypeListCount);
+    FieldToJson(writer, "pMutableDescriptorTypeLists", data.pMutableDescriptorTypeLists);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureBuildRangeInfoKHR& data)
+{
+    const VkAccelerationStructureBuildRangeInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "primitiveCount", value.primitiveCount);
+    FieldToJson(writer, "primitiveOffset", value.primitiveOffset);
+    FieldToJson(writer, "firstVertex", value.firstVertex);
+    FieldToJson(writer, "transformOffset", value.transformOffset);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryTrianglesDataKHR& data)
+{
+    const VkAccelerationStructureGeometryTrianglesDataKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "vertexFormat", value.vertexFormat);
+    FieldToJson(writer, "vertexData", data.vertexData);
+    FieldToJson(writer, "vertexStride", value.vertexStride);
+    FieldToJson(writer, "maxVertex", value.maxVertex);
+    FieldToJson(writer, "indexType", value.indexType);
+    FieldToJson(writer, "indexData", data.indexData);
+    FieldToJson(writer, "transformData", data.transformData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryAabbsDataKHR& data)
+{
+    const VkAccelerationStructureGeometryAabbsDataKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "data", data.data);
+    FieldToJson(writer, "stride", value.stride);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryInstancesDataKHR& data)
+{
+    const VkAccelerationStructureGeometryInstancesDataKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "arrayOfPointers", value.arrayOfPointers);
+    FieldToJson(writer, "data", data.data);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureBuildGeometryInfoKHR& data)
+{
+    const VkAccelerationStructureBuildGeometryInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "mode", value.mode);
+    FieldToJson(writer, "srcAccelerationStructure", data.srcAccelerationStructure);
+    FieldToJson(writer, "dstAccelerationStructure", data.dstAccelerationStructure);
+    FieldToJson(writer, "geometryCount", value.geometryCount);
+    FieldToJson(writer, "pGeometries", data.pGeometries);
+    FieldToJson(writer, "ppGeometries", data.ppGeometries);
+    FieldToJson(writer, "scratchData", data.scratchData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureCreateInfoKHR& data)
+{
+    const VkAccelerationStructureCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "createFlags", value.createFlags);
+    FieldToJson(writer, "buffer", data.buffer);
+    FieldToJson(writer, "offset", value.offset);
+    FieldToJson(writer, "size", value.size);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "deviceAddress", value.deviceAddress);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSetAccelerationStructureKHR& data)
+{
+    const VkWriteDescriptorSetAccelerationStructureKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "accelerationStructureCount", value.accelerationStructureCount);
+    FieldToJson(writer, "pAccelerationStructures", data.pAccelerationStructures);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceAccelerationStructureFeaturesKHR& data)
+{
+    const VkPhysicalDeviceAccelerationStructureFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "accelerationStructure", value.accelerationStructure);
+    FieldToJson(writer, "accelerationStructureCaptureReplay", value.accelerationStructureCaptureReplay);
+    FieldToJson(writer, "accelerationStructureIndirectBuild", value.accelerationStructureIndirectBuild);
+    FieldToJson(writer, "accelerationStructureHostCommands", value.accelerationStructureHostCommands);
+    FieldToJson(writer, "descriptorBindingAccelerationStructureUpdateAfterBind", value.descriptorBindingAccelerationStructureUpdateAfterBind);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceAccelerationStructurePropertiesKHR& data)
+{
+    const VkPhysicalDeviceAccelerationStructurePropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxGeometryCount", value.maxGeometryCount);
+    FieldToJson(writer, "maxInstanceCount", value.maxInstanceCount);
+    FieldToJson(writer, "maxPrimitiveCount", value.maxPrimitiveCount);
+    FieldToJson(writer, "maxPerStageDescriptorAccelerationStructures", value.maxPerStageDescriptorAccelerationStructures);
+    FieldToJson(writer, "maxPerStageDescriptorUpdateAfterBindAccelerationStructures", value.maxPerStageDescriptorUpdateAfterBindAccelerationStructures);
+    FieldToJson(writer, "maxDescriptorSetAccelerationStructures", value.maxDescriptorSetAccelerationStructures);
+    FieldToJson(writer, "maxDescriptorSetUpdateAfterBindAccelerationStructures", value.maxDescriptorSetUpdateAfterBindAccelerationStructures);
+    FieldToJson(writer, "minAccelerationStructureScratchOffsetAlignment", value.minAccelerationStructureScratchOffsetAlignment);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureDeviceAddressInfoKHR& data)
+{
+    const VkAccelerationStructureDeviceAddressInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "accelerationStructure", data.accelerationStructure);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureVersionInfoKHR& data)
+{
+    const VkAccelerationStructureVersionInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "pVersionData", data.pVersionData);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyAccelerationStructureToMemoryInfoKHR& data)
+{
+    const VkCopyAccelerationStructureToMemoryInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "src", data.src);
+    FieldToJson(writer, "dst", data.dst);
+    FieldToJson(writer, "mode", value.mode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyMemoryToAccelerationStructureInfoKHR& data)
+{
+    const VkCopyMemoryToAccelerationStructureInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "src", data.src);
+    FieldToJson(writer, "dst", data.dst);
+    FieldToJson(writer, "mode", value.mode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyAccelerationStructureInfoKHR& data)
+{
+    const VkCopyAccelerationStructureInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "src", data.src);
+    FieldToJson(writer, "dst", data.dst);
+    FieldToJson(writer, "mode", value.mode);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureBuildSizesInfoKHR& data)
+{
+    const VkAccelerationStructureBuildSizesInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "accelerationStructureSize", value.accelerationStructureSize);
+    FieldToJson(writer, "updateScratchSize", value.updateScratchSize);
+    FieldToJson(writer, "buildScratchSize", value.buildScratchSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingShaderGroupCreateInfoKHR& data)
+{
+    const VkRayTracingShaderGroupCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "type", value.type);
+    FieldToJson(writer, "generalShader", value.generalShader);
+    FieldToJson(writer, "closestHitShader", value.closestHitShader);
+    FieldToJson(writer, "anyHitShader", value.anyHitShader);
+    FieldToJson(writer, "intersectionShader", value.intersectionShader);
+    FieldToJson(writer, "pShaderGroupCaptureReplayHandle", data.pShaderGroupCaptureReplayHandle);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingPipelineInterfaceCreateInfoKHR& data)
+{
+    const VkRayTracingPipelineInterfaceCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "maxPipelineRayPayloadSize", value.maxPipelineRayPayloadSize);
+    FieldToJson(writer, "maxPipelineRayHitAttributeSize", value.maxPipelineRayHitAttributeSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingPipelineCreateInfoKHR& data)
+{
+    const VkRayTracingPipelineCreateInfoKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "flags", value.flags);
+    FieldToJson(writer, "stageCount", value.stageCount);
+    FieldToJson(writer, "pStages", data.pStages);
+    FieldToJson(writer, "groupCount", value.groupCount);
+    FieldToJson(writer, "pGroups", data.pGroups);
+    FieldToJson(writer, "maxPipelineRayRecursionDepth", value.maxPipelineRayRecursionDepth);
+    FieldToJson(writer, "pLibraryInfo", data.pLibraryInfo);
+    FieldToJson(writer, "pLibraryInterface", data.pLibraryInterface);
+    FieldToJson(writer, "pDynamicState", data.pDynamicState);
+    FieldToJson(writer, "layout", data.layout);
+    FieldToJson(writer, "basePipelineHandle", data.basePipelineHandle);
+    FieldToJson(writer, "basePipelineIndex", value.basePipelineIndex);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& data)
+{
+    const VkPhysicalDeviceRayTracingPipelineFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "rayTracingPipeline", value.rayTracingPipeline);
+    FieldToJson(writer, "rayTracingPipelineShaderGroupHandleCaptureReplay", value.rayTracingPipelineShaderGroupHandleCaptureReplay);
+    FieldToJson(writer, "rayTracingPipelineShaderGroupHandleCaptureReplayMixed", value.rayTracingPipelineShaderGroupHandleCaptureReplayMixed);
+    FieldToJson(writer, "rayTracingPipelineTraceRaysIndirect", value.rayTracingPipelineTraceRaysIndirect);
+    FieldToJson(writer, "rayTraversalPrimitiveCulling", value.rayTraversalPrimitiveCulling);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& data)
+{
+    const VkPhysicalDeviceRayTracingPipelinePropertiesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "shaderGroupHandleSize", value.shaderGroupHandleSize);
+    FieldToJson(writer, "maxRayRecursionDepth", value.maxRayRecursionDepth);
+    FieldToJson(writer, "maxShaderGroupStride", value.maxShaderGroupStride);
+    FieldToJson(writer, "shaderGroupBaseAlignment", value.shaderGroupBaseAlignment);
+    FieldToJson(writer, "shaderGroupHandleCaptureReplaySize", value.shaderGroupHandleCaptureReplaySize);
+    FieldToJson(writer, "maxRayDispatchInvocationCount", value.maxRayDispatchInvocationCount);
+    FieldToJson(writer, "shaderGroupHandleAlignment", value.shaderGroupHandleAlignment);
+    FieldToJson(writer, "maxRayHitAttributeSize", value.maxRayHitAttributeSize);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkStridedDeviceAddressRegionKHR& data)
+{
+    const VkStridedDeviceAddressRegionKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "deviceAddress", value.deviceAddress);
+    FieldToJson(writer, "stride", value.stride);
+    FieldToJson(writer, "size", value.size);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTraceRaysIndirectCommandKHR& data)
+{
+    const VkTraceRaysIndirectCommandKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "width", value.width);
+    FieldToJson(writer, "height", value.height);
+    FieldToJson(writer, "depth", value.depth);
+    writer.EndObject();
+}
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayQueryFeaturesKHR& data)
+{
+    const VkPhysicalDeviceRayQueryFeaturesKHR& value = *data.decoded_value;
+
+    writer.BeginObject();
+    FieldToJson(writer, "sType", value.sType);
+    FieldToJson(writer, "pNext", data.pNext);
+    FieldToJson(writer, "rayQuery", value.rayQuery);
+    writer.EndObject();
+}
+
+void PNextToJson(util::JsonWriter& writer, const PNextNode* data)
+{
+    if ((data == nullptr) || (data->GetPointer() == nullptr))
+    {
+        writer.Null();
+    }
+    else
+    {
+        const VkBaseInStructure* base = reinterpret_cast<const VkBaseInStructure*>(data->GetPointer());
+
+        switch (base->sType)
+        {
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceSubgroupProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_16BIT_STORAGE_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevice16BitStorageFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_REQUIREMENTS:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkMemoryDedicatedRequirements*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_MEMORY_DEDICATED_ALLOCATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkMemoryDedicatedAllocateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_FLAGS_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkMemoryAllocateFlagsInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_GROUP_RENDER_PASS_BEGIN_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceGroupRenderPassBeginInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_GROUP_COMMAND_BUFFER_BEGIN_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceGroupCommandBufferBeginInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_GROUP_SUBMIT_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceGroupSubmitInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_GROUP_BIND_SPARSE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceGroupBindSparseInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_BIND_BUFFER_MEMORY_DEVICE_GROUP_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkBindBufferMemoryDeviceGroupInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_DEVICE_GROUP_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkBindImageMemoryDeviceGroupInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_GROUP_DEVICE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceGroupDeviceCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFeatures2*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_POINT_CLIPPING_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePointClippingProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_RENDER_PASS_INPUT_ATTACHMENT_ASPECT_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkRenderPassInputAttachmentAspectCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_VIEW_USAGE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImageViewUsageCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_TESSELLATION_DOMAIN_ORIGIN_STATE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineTessellationDomainOriginStateCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_RENDER_PASS_MULTIVIEW_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkRenderPassMultiviewCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMultiviewFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMultiviewProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VARIABLE_POINTERS_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVariablePointersFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceProtectedMemoryFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROTECTED_MEMORY_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceProtectedMemoryProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PROTECTED_SUBMIT_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkProtectedSubmitInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSamplerYcbcrConversionInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_BIND_IMAGE_PLANE_MEMORY_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkBindImagePlaneMemoryInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_PLANE_MEMORY_REQUIREMENTS_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImagePlaneMemoryRequirementsInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_YCBCR_CONVERSION_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceSamplerYcbcrConversionFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SAMPLER_YCBCR_CONVERSION_IMAGE_FORMAT_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSamplerYcbcrConversionImageFormatProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_IMAGE_FORMAT_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceExternalImageFormatInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_IMAGE_FORMAT_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExternalImageFormatProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ID_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceIDProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExternalMemoryImageCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_BUFFER_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExternalMemoryBufferCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportMemoryAllocateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_FENCE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportFenceCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportSemaphoreCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MAINTENANCE_3_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMaintenance3Properties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DRAW_PARAMETERS_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderDrawParametersFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVulkan11Features*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_1_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVulkan11Properties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVulkan12Features*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVulkan12Properties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_FORMAT_LIST_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImageFormatListCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_8BIT_STORAGE_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevice8BitStorageFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DRIVER_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDriverProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_INT64_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderAtomicInt64Features*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_FLOAT16_INT8_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderFloat16Int8Features*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FLOAT_CONTROLS_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFloatControlsProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDescriptorSetLayoutBindingFlagsCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDescriptorIndexingFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DESCRIPTOR_INDEXING_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDescriptorIndexingProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_ALLOCATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDescriptorSetVariableDescriptorCountAllocateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DESCRIPTOR_SET_VARIABLE_DESCRIPTOR_COUNT_LAYOUT_SUPPORT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDescriptorSetVariableDescriptorCountLayoutSupport*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SUBPASS_DESCRIPTION_DEPTH_STENCIL_RESOLVE:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSubpassDescriptionDepthStencilResolve*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_STENCIL_RESOLVE_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDepthStencilResolveProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SCALAR_BLOCK_LAYOUT_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceScalarBlockLayoutFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_STENCIL_USAGE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImageStencilUsageCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SAMPLER_REDUCTION_MODE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSamplerReductionModeCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLER_FILTER_MINMAX_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceSamplerFilterMinmaxProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_MEMORY_MODEL_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVulkanMemoryModelFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGELESS_FRAMEBUFFER_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceImagelessFramebufferFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_FRAMEBUFFER_ATTACHMENTS_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkFramebufferAttachmentsCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_RENDER_PASS_ATTACHMENT_BEGIN_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkRenderPassAttachmentBeginInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_UNIFORM_BUFFER_STANDARD_LAYOUT_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceUniformBufferStandardLayoutFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SUBGROUP_EXTENDED_TYPES_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SEPARATE_DEPTH_STENCIL_LAYOUTS_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_ATTACHMENT_REFERENCE_STENCIL_LAYOUT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkAttachmentReferenceStencilLayout*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_ATTACHMENT_DESCRIPTION_STENCIL_LAYOUT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkAttachmentDescriptionStencilLayout*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_HOST_QUERY_RESET_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceHostQueryResetFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceTimelineSemaphoreFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TIMELINE_SEMAPHORE_PROPERTIES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceTimelineSemaphoreProperties*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSemaphoreTypeCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_TIMELINE_SEMAPHORE_SUBMIT_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkTimelineSemaphoreSubmitInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceBufferDeviceAddressFeatures*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_BUFFER_OPAQUE_CAPTURE_ADDRESS_CREATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkBufferOpaqueCaptureAddressCreateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_MEMORY_OPAQUE_CAPTURE_ADDRESS_ALLOCATE_INFO:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkMemoryOpaqueCaptureAddressAllocateInfo*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_SWAPCHAIN_CREATE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImageSwapchainCreateInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_BIND_IMAGE_MEMORY_SWAPCHAIN_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkBindImageMemorySwapchainInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_GROUP_PRESENT_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceGroupPresentInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_GROUP_SWAPCHAIN_CREATE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceGroupSwapchainCreateInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DISPLAY_PRESENT_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDisplayPresentInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImportMemoryWin32HandleInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportMemoryWin32HandleInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMPORT_MEMORY_FD_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImportMemoryFdInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkWin32KeyedMutexAcquireReleaseInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_SEMAPHORE_WIN32_HANDLE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportSemaphoreWin32HandleInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_D3D12_FENCE_SUBMIT_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkD3D12FenceSubmitInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PUSH_DESCRIPTOR_PROPERTIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePushDescriptorPropertiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PRESENT_REGIONS_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPresentRegionsKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SHARED_PRESENT_SURFACE_CAPABILITIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSharedPresentSurfaceCapabilitiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_FENCE_WIN32_HANDLE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportFenceWin32HandleInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePerformanceQueryFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PERFORMANCE_QUERY_PROPERTIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePerformanceQueryPropertiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_CREATE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkQueryPoolPerformanceCreateInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PERFORMANCE_QUERY_SUBMIT_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPerformanceQuerySubmitInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePortabilitySubsetFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PORTABILITY_SUBSET_PROPERTIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePortabilitySubsetPropertiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CLOCK_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderClockFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_TERMINATE_INVOCATION_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_FRAGMENT_SHADING_RATE_ATTACHMENT_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkFragmentShadingRateAttachmentInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_STATE_CREATE_INFO_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineFragmentShadingRateStateCreateInfoKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentShadingRateFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_PROPERTIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentShadingRatePropertiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SURFACE_PROTECTED_CAPABILITIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSurfaceProtectedCapabilitiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_EXECUTABLE_PROPERTIES_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEBUG_REPORT_CALLBACK_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDebugReportCallbackCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_RASTERIZATION_ORDER_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineRasterizationStateRasterizationOrderAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_IMAGE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDedicatedAllocationImageCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_BUFFER_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDedicatedAllocationBufferCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEDICATED_ALLOCATION_MEMORY_ALLOCATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDedicatedAllocationMemoryAllocateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceTransformFeedbackFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TRANSFORM_FEEDBACK_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceTransformFeedbackPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_STATE_STREAM_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineRasterizationStateStreamCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_TEXTURE_LOD_GATHER_FORMAT_PROPERTIES_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkTextureLODGatherFormatPropertiesAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CORNER_SAMPLED_IMAGE_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceCornerSampledImageFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_MEMORY_IMAGE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExternalMemoryImageCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_MEMORY_ALLOCATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportMemoryAllocateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImportMemoryWin32HandleInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXPORT_MEMORY_WIN32_HANDLE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExportMemoryWin32HandleInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_WIN32_KEYED_MUTEX_ACQUIRE_RELEASE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkWin32KeyedMutexAcquireReleaseInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_VALIDATION_FLAGS_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkValidationFlagsEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXTURE_COMPRESSION_ASTC_HDR_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_VIEW_ASTC_DECODE_MODE_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImageViewASTCDecodeModeEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ASTC_DECODE_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceASTCDecodeFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONDITIONAL_RENDERING_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceConditionalRenderingFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_CONDITIONAL_RENDERING_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkCommandBufferInheritanceConditionalRenderingInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_W_SCALING_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineViewportWScalingStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SWAPCHAIN_COUNTER_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSwapchainCounterCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PRESENT_TIMES_INFO_GOOGLE:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPresentTimesInfoGOOGLE*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MULTIVIEW_PER_VIEW_ATTRIBUTES_PROPERTIES_NVX:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SWIZZLE_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineViewportSwizzleStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DISCARD_RECTANGLE_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDiscardRectanglePropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_DISCARD_RECTANGLE_STATE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineDiscardRectangleStateCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CONSERVATIVE_RASTERIZATION_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceConservativeRasterizationPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_CONSERVATIVE_STATE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineRasterizationConservativeStateCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEPTH_CLIP_ENABLE_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDepthClipEnableFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_DEPTH_CLIP_STATE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineRasterizationDepthClipStateCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEBUG_UTILS_MESSENGER_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDebugUtilsMessengerCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_USAGE_ANDROID:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkAndroidHardwareBufferUsageANDROID*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_ANDROID_HARDWARE_BUFFER_FORMAT_PROPERTIES_ANDROID:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkAndroidHardwareBufferFormatPropertiesANDROID*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMPORT_ANDROID_HARDWARE_BUFFER_INFO_ANDROID:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImportAndroidHardwareBufferInfoANDROID*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_EXTERNAL_FORMAT_ANDROID:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkExternalFormatANDROID*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceInlineUniformBlockFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INLINE_UNIFORM_BLOCK_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceInlineUniformBlockPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_INLINE_UNIFORM_BLOCK_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkWriteDescriptorSetInlineUniformBlockEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_INLINE_UNIFORM_BLOCK_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDescriptorPoolInlineUniformBlockCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SAMPLE_LOCATIONS_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSampleLocationsInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_RENDER_PASS_SAMPLE_LOCATIONS_BEGIN_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkRenderPassSampleLocationsBeginInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_SAMPLE_LOCATIONS_STATE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineSampleLocationsStateCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SAMPLE_LOCATIONS_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceSampleLocationsPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BLEND_OPERATION_ADVANCED_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_COLOR_BLEND_ADVANCED_STATE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineColorBlendAdvancedStateCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_TO_COLOR_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineCoverageToColorStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_MODULATION_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineCoverageModulationStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_SM_BUILTINS_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DRM_FORMAT_MODIFIER_PROPERTIES_LIST_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDrmFormatModifierPropertiesListEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_DRM_FORMAT_MODIFIER_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceImageDrmFormatModifierInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_LIST_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImageDrmFormatModifierListCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMAGE_DRM_FORMAT_MODIFIER_EXPLICIT_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImageDrmFormatModifierExplicitCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SHADER_MODULE_VALIDATION_CACHE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkShaderModuleValidationCacheCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_SHADING_RATE_IMAGE_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineViewportShadingRateImageStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShadingRateImageFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADING_RATE_IMAGE_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShadingRateImagePropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_COARSE_SAMPLE_ORDER_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkWriteDescriptorSetAccelerationStructureNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceRayTracingPropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_REPRESENTATIVE_FRAGMENT_TEST_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_REPRESENTATIVE_FRAGMENT_TEST_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineRepresentativeFragmentTestStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_VIEW_IMAGE_FORMAT_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceImageViewImageFormatInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_FILTER_CUBIC_IMAGE_VIEW_IMAGE_FORMAT_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkFilterCubicImageViewImageFormatPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_QUEUE_GLOBAL_PRIORITY_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceQueueGlobalPriorityCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_IMPORT_MEMORY_HOST_POINTER_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkImportMemoryHostPointerInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTERNAL_MEMORY_HOST_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceExternalMemoryHostPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_COMPILER_CONTROL_CREATE_INFO_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineCompilerControlCreateInfoAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderCorePropertiesAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_MEMORY_OVERALLOCATION_CREATE_INFO_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceMemoryOverallocationCreateInfoAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_VERTEX_INPUT_DIVISOR_STATE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineVertexInputDivisorStateCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VERTEX_ATTRIBUTE_DIVISOR_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PRESENT_FRAME_TOKEN_GGP:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPresentFrameTokenGGP*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineCreationFeedbackCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COMPUTE_SHADER_DERIVATIVES_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMeshShaderFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MESH_SHADER_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMeshShaderPropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_BARYCENTRIC_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_FOOTPRINT_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderImageFootprintFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_VIEWPORT_EXCLUSIVE_SCISSOR_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineViewportExclusiveScissorStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXCLUSIVE_SCISSOR_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceExclusiveScissorFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_QUEUE_FAMILY_CHECKPOINT_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkQueueFamilyCheckpointPropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_INTEGER_FUNCTIONS_2_FEATURES_INTEL:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_QUERY_POOL_PERFORMANCE_QUERY_CREATE_INFO_INTEL:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkQueryPoolPerformanceQueryCreateInfoINTEL*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PCI_BUS_INFO_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePCIBusInfoPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DISPLAY_NATIVE_HDR_SURFACE_CAPABILITIES_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDisplayNativeHdrSurfaceCapabilitiesAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SWAPCHAIN_DISPLAY_NATIVE_HDR_CREATE_INFO_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSwapchainDisplayNativeHdrCreateInfoAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentDensityMapFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentDensityMapPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_RENDER_PASS_FRAGMENT_DENSITY_MAP_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkRenderPassFragmentDensityMapCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceSubgroupSizeControlFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SUBGROUP_SIZE_CONTROL_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceSubgroupSizeControlPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_SHADER_STAGE_REQUIRED_SUBGROUP_SIZE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_CORE_PROPERTIES_2_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderCoreProperties2AMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COHERENT_MEMORY_FEATURES_AMD:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceCoherentMemoryFeaturesAMD*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_IMAGE_ATOMIC_INT64_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_BUDGET_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMemoryBudgetPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MEMORY_PRIORITY_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMemoryPriorityFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_MEMORY_PRIORITY_ALLOCATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkMemoryPriorityAllocateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEDICATED_ALLOCATION_IMAGE_ALIASING_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_BUFFER_DEVICE_ADDRESS_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_BUFFER_DEVICE_ADDRESS_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkBufferDeviceAddressCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_VALIDATION_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkValidationFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceCooperativeMatrixFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COOPERATIVE_MATRIX_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceCooperativeMatrixPropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_COVERAGE_REDUCTION_MODE_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceCoverageReductionModeFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_COVERAGE_REDUCTION_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineCoverageReductionStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADER_INTERLOCK_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_YCBCR_IMAGE_ARRAYS_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSurfaceFullScreenExclusiveInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SURFACE_CAPABILITIES_FULL_SCREEN_EXCLUSIVE_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSurfaceCapabilitiesFullScreenExclusiveEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SURFACE_FULL_SCREEN_EXCLUSIVE_WIN32_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSurfaceFullScreenExclusiveWin32InfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceLineRasterizationFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_LINE_RASTERIZATION_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceLineRasterizationPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_RASTERIZATION_LINE_STATE_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineRasterizationLineStateCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_ATOMIC_FLOAT_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_INDEX_TYPE_UINT8_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceIndexTypeUint8FeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_EXTENDED_DYNAMIC_STATE_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_SHADER_DEMOTE_TO_HELPER_INVOCATION_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_GENERATED_COMMANDS_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_GRAPHICS_PIPELINE_SHADER_GROUPS_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkGraphicsPipelineShaderGroupsCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_TEXEL_BUFFER_ALIGNMENT_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_RENDER_PASS_TRANSFORM_BEGIN_INFO_QCOM:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkRenderPassTransformBeginInfoQCOM*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDER_PASS_TRANSFORM_INFO_QCOM:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkCommandBufferInheritanceRenderPassTransformInfoQCOM*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DEVICE_MEMORY_REPORT_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_DEVICE_MEMORY_REPORT_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceDeviceMemoryReportCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceRobustness2FeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ROBUSTNESS_2_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceRobustness2PropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_SAMPLER_CUSTOM_BORDER_COLOR_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkSamplerCustomBorderColorCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceCustomBorderColorPropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_CUSTOM_BORDER_COLOR_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceCustomBorderColorFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PRIVATE_DATA_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePrivateDataFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_PRIVATE_DATA_CREATE_INFO_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDevicePrivateDataCreateInfoEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PIPELINE_CREATION_CACHE_CONTROL_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_DIAGNOSTICS_CONFIG_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceDiagnosticsConfigFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_DEVICE_DIAGNOSTICS_CONFIG_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkDeviceDiagnosticsConfigCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_FEATURES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_SHADING_RATE_ENUMS_PROPERTIES_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PIPELINE_FRAGMENT_SHADING_RATE_ENUM_STATE_CREATE_INFO_NV:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPipelineFragmentShadingRateEnumStateCreateInfoNV*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FRAGMENT_DENSITY_MAP_2_PROPERTIES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_COPY_COMMAND_TRANSFORM_INFO_QCOM:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkCopyCommandTransformInfoQCOM*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_IMAGE_ROBUSTNESS_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceImageRobustnessFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_4444_FORMATS_FEATURES_EXT:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDevice4444FormatsFeaturesEXT*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_MUTABLE_DESCRIPTOR_TYPE_FEATURES_VALVE:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_MUTABLE_DESCRIPTOR_TYPE_CREATE_INFO_VALVE:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkMutableDescriptorTypeCreateInfoVALVE*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET_ACCELERATION_STRUCTURE_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkWriteDescriptorSetAccelerationStructureKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceAccelerationStructureFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_ACCELERATION_STRUCTURE_PROPERTIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceAccelerationStructurePropertiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceRayTracingPipelineFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_TRACING_PIPELINE_PROPERTIES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceRayTracingPipelinePropertiesKHR*>(data->GetMetaStructPointer()));
+                break;
+            case VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_RAY_QUERY_FEATURES_KHR:
+                StructToJson(writer, *reinterpret_cast<const Decoded_VkPhysicalDeviceRayQueryFeaturesKHR*>(data->GetMetaStructPointer()));
+                break;
+            default:
+                // Unrecognized structure types were not decoded.
+                writer.Null();
+                break;
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
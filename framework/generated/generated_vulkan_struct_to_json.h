@@ -0,0 +1,756 @@
+/*
+** Copyright (c) 2018-2020 Valve Corporation
+** Copyright (c) 2018-2020 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+/*
+** This file is generated from the Khronos Vulkan XML API Registry.
+**
+*/
+
+#ifndef  GFXRECON_GENERATED_VULKAN_STRUCT_TO_JSON_H
+#define  GFXRECON_GENERATED_VULKAN_STRUCT_TO_JSON_H
+
+#include "decode/custom_vulkan_struct_to_json.h"
+#include "generated/generated_vulkan_struct_decoders.h"
+#include "util/defines.h"
+#include "util/json_writer.h"
+
+#include "vulkan/vulkan.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(decode)
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExtent2D& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExtent3D& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkOffset2D& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkOffset3D& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRect2D& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferMemoryBarrier& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDispatchIndirectCommand& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrawIndexedIndirectCommand& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrawIndirectCommand& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSubresourceRange& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageMemoryBarrier& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryBarrier& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAllocationCallbacks& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkApplicationInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFormatProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageFormatProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkInstanceCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryHeap& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryType& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceLimits& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSparseProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueueFamilyProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceQueueCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExtensionProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkLayerProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubmitInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMappedMemoryRange& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryAllocateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryRequirements& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseMemoryBind& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseBufferMemoryBindInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageOpaqueMemoryBindInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSubresource& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryBind& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryBindInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindSparseInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageFormatProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryRequirements& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFenceCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkEventCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueryPoolCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferViewCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubresourceLayout& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkComponentMapping& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderModuleCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCacheCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSpecializationMapEntry& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSpecializationInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineShaderStageCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkComputePipelineCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkVertexInputBindingDescription& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkVertexInputAttributeDescription& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineVertexInputStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineInputAssemblyStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineTessellationStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViewport& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineMultisampleStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkStencilOpState& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineDepthStencilStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineColorBlendAttachmentState& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineColorBlendStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineDynamicStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGraphicsPipelineCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPushConstantRange& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineLayoutCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyDescriptorSet& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorBufferInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorPoolSize& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorPoolCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetAllocateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutBinding& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentDescription& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentReference& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDescription& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDependency& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandPoolCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferAllocateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferInheritanceInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferBeginInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferCopy& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSubresourceLayers& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferImageCopy& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearDepthStencilValue& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearAttachment& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkClearRect& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageBlit& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageCopy& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageResolve& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassBeginInfo& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSubgroupProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindBufferMemoryInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImageMemoryInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevice16BitStorageFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryDedicatedRequirements& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryDedicatedAllocateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryAllocateFlagsInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupRenderPassBeginInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupCommandBufferBeginInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupSubmitInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupBindSparseInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindBufferMemoryDeviceGroupInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImageMemoryDeviceGroupInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceGroupProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupDeviceCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferMemoryRequirementsInfo2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageMemoryRequirementsInfo2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSparseMemoryRequirementsInfo2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryRequirements2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageMemoryRequirements2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFeatures2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProperties2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFormatProperties2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageFormatProperties2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageFormatInfo2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueueFamilyProperties2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryProperties2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSparseImageFormatProperties2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSparseImageFormatInfo2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePointClippingProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkInputAttachmentAspectReference& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassInputAttachmentAspectCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewUsageCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineTessellationDomainOriginStateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassMultiviewCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMultiviewFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMultiviewProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVariablePointersFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProtectedMemoryFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceProtectedMemoryProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceQueueInfo2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkProtectedSubmitInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerYcbcrConversionCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerYcbcrConversionInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImagePlaneMemoryInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImagePlaneMemoryRequirementsInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSamplerYcbcrConversionFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerYcbcrConversionImageFormatProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorUpdateTemplateEntry& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorUpdateTemplateCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalImageFormatInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalImageFormatProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalBufferInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalBufferProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceIDProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryImageCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryBufferCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryAllocateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalFenceInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalFenceProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportFenceCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportSemaphoreCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalSemaphoreInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalSemaphoreProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMaintenance3Properties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutSupport& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderDrawParametersFeatures& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan11Features& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan11Properties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan12Features& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkConformanceVersion& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkan12Properties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageFormatListCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentDescription2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentReference2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDescription2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDependency2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassCreateInfo2& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassBeginInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassEndInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevice8BitStorageFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDriverProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderAtomicInt64Features& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderFloat16Int8Features& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFloatControlsProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetLayoutBindingFlagsCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDescriptorIndexingFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDescriptorIndexingProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetVariableDescriptorCountAllocateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorSetVariableDescriptorCountLayoutSupport& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassDescriptionDepthStencilResolve& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDepthStencilResolveProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceScalarBlockLayoutFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageStencilUsageCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerReductionModeCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSamplerFilterMinmaxProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVulkanMemoryModelFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImagelessFramebufferFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferAttachmentImageInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferAttachmentsCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassAttachmentBeginInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceUniformBufferStandardLayoutFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderSubgroupExtendedTypesFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSeparateDepthStencilLayoutsFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentReferenceStencilLayout& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentDescriptionStencilLayout& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceHostQueryResetFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTimelineSemaphoreFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTimelineSemaphoreProperties& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreTypeCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTimelineSemaphoreSubmitInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreWaitInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreSignalInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeatures& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferDeviceAddressInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferOpaqueCaptureAddressCreateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryOpaqueCaptureAddressAllocateInfo& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceMemoryOpaqueCaptureAddressInfo& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilitiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFormatKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSwapchainCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageSwapchainCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindImageMemorySwapchainInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAcquireNextImageInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupPresentCapabilitiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupPresentInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceGroupSwapchainCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModeParametersKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModeCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModePropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneCapabilitiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlanePropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplaySurfaceCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPresentInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkXlibSurfaceCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkXcbSurfaceCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWaylandSurfaceCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidSurfaceCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWin32SurfaceCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryWin32HandleInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryWin32HandleInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryWin32HandlePropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryGetWin32HandleInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryFdInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryFdPropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryGetFdInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportSemaphoreWin32HandleInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportSemaphoreWin32HandleInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkD3D12FenceSubmitInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreGetWin32HandleInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportSemaphoreFdInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSemaphoreGetFdInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePushDescriptorPropertiesKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRectLayerKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentRegionKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentRegionsKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSharedPresentSurfaceCapabilitiesKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportFenceWin32HandleInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportFenceWin32HandleInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFenceGetWin32HandleInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportFenceFdInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFenceGetFdInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePerformanceQueryFeaturesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePerformanceQueryPropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceCounterKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceCounterDescriptionKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueryPoolPerformanceCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAcquireProfilingLockInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceQuerySubmitInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSurfaceInfo2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilities2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFormat2KHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayProperties2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneProperties2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayModeProperties2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneInfo2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPlaneCapabilities2KHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePortabilitySubsetFeaturesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePortabilitySubsetPropertiesKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderClockFeaturesKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderTerminateInvocationFeaturesKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFragmentShadingRateAttachmentInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineFragmentShadingRateStateCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateFeaturesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRatePropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceProtectedCapabilitiesKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePipelineExecutablePropertiesFeaturesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutablePropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableStatisticKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineExecutableInternalRepresentationKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineLibraryCreateInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferCopy2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyBufferInfo2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageCopy2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyImageInfo2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferImageCopy2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyBufferToImageInfo2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyImageToBufferInfo2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageBlit2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBlitImageInfo2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageResolve2KHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkResolveImageInfo2KHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugReportCallbackCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationStateRasterizationOrderAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugMarkerObjectNameInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugMarkerObjectTagInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugMarkerMarkerInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDedicatedAllocationImageCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDedicatedAllocationBufferCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDedicatedAllocationMemoryAllocateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTransformFeedbackFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTransformFeedbackPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationStateStreamCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewHandleInfoNVX& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewAddressPropertiesNVX& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTextureLODGatherFormatPropertiesAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderResourceUsageAMD& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderStatisticsInfoAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkStreamDescriptorSurfaceCreateInfoGGP& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCornerSampledImageFeaturesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalImageFormatPropertiesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalMemoryImageCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryAllocateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryWin32HandleInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExportMemoryWin32HandleInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWin32KeyedMutexAcquireReleaseInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkValidationFlagsEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViSurfaceCreateInfoNN& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTextureCompressionASTCHDRFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageViewASTCDecodeModeEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceASTCDecodeFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkConditionalRenderingBeginInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceConditionalRenderingFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferInheritanceConditionalRenderingInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViewportWScalingNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportWScalingStateCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilities2EXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayPowerInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceEventInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayEventInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSwapchainCounterCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRefreshCycleDurationGOOGLE& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPastPresentationTimingGOOGLE& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentTimeGOOGLE& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentTimesInfoGOOGLE& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMultiviewPerViewAttributesPropertiesNVX& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkViewportSwizzleNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportSwizzleStateCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDiscardRectanglePropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineDiscardRectangleStateCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceConservativeRasterizationPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationConservativeStateCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDepthClipEnableFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationDepthClipStateCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkXYColorEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkHdrMetadataEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIOSSurfaceCreateInfoMVK& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMacOSSurfaceCreateInfoMVK& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsLabelEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsObjectNameInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsMessengerCallbackDataEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsMessengerCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDebugUtilsObjectTagInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidHardwareBufferUsageANDROID& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidHardwareBufferPropertiesANDROID& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAndroidHardwareBufferFormatPropertiesANDROID& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportAndroidHardwareBufferInfoANDROID& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryGetAndroidHardwareBufferInfoANDROID& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkExternalFormatANDROID& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceInlineUniformBlockFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceInlineUniformBlockPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSetInlineUniformBlockEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDescriptorPoolInlineUniformBlockCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSampleLocationEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSampleLocationsInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAttachmentSampleLocationsEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSubpassSampleLocationsEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassSampleLocationsBeginInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineSampleLocationsStateCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSampleLocationsPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMultisamplePropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBlendOperationAdvancedFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBlendOperationAdvancedPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineColorBlendAdvancedStateCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCoverageToColorStateCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCoverageModulationStateCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderSMBuiltinsPropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderSMBuiltinsFeaturesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrmFormatModifierPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrmFormatModifierPropertiesListEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageDrmFormatModifierInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageDrmFormatModifierListCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageDrmFormatModifierExplicitCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImageDrmFormatModifierPropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkValidationCacheCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShaderModuleValidationCacheCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkShadingRatePaletteNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportShadingRateImageStateCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShadingRateImageFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShadingRateImagePropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCoarseSampleLocationNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCoarseSampleOrderCustomNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportCoarseSampleOrderStateCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingShaderGroupCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingPipelineCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryTrianglesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryAABBNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryDataNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeometryNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindAccelerationStructureMemoryInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSetAccelerationStructureNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureMemoryRequirementsInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayTracingPropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTransformMatrixKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAabbPositionsKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureInstanceKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRepresentativeFragmentTestFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRepresentativeFragmentTestStateCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageViewImageFormatInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFilterCubicImageViewImageFormatPropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceQueueGlobalPriorityCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImportMemoryHostPointerInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryHostPointerPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExternalMemoryHostPropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCompilerControlCreateInfoAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCalibratedTimestampInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderCorePropertiesAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceMemoryOverallocationCreateInfoAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVertexAttributeDivisorPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkVertexInputBindingDivisorDescriptionEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineVertexInputDivisorStateCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceVertexAttributeDivisorFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPresentFrameTokenGGP& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCreationFeedbackEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCreationFeedbackCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceComputeShaderDerivativesFeaturesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMeshShaderFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMeshShaderPropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDrawMeshTasksIndirectCommandNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShaderBarycentricFeaturesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderImageFootprintFeaturesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineViewportExclusiveScissorStateCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExclusiveScissorFeaturesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueueFamilyCheckpointPropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCheckpointDataNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderIntegerFunctions2FeaturesINTEL& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkInitializePerformanceApiInfoINTEL& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkQueryPoolPerformanceQueryCreateInfoINTEL& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceMarkerInfoINTEL& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceStreamMarkerInfoINTEL& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceOverrideInfoINTEL& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPerformanceConfigurationAcquireInfoINTEL& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePCIBusInfoPropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDisplayNativeHdrSurfaceCapabilitiesAMD& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSwapchainDisplayNativeHdrCreateInfoAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkImagePipeSurfaceCreateInfoFUCHSIA& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMetalSurfaceCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMapFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMapPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassFragmentDensityMapCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSubgroupSizeControlFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceSubgroupSizeControlPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineShaderStageRequiredSubgroupSizeCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderCoreProperties2AMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCoherentMemoryFeaturesAMD& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderImageAtomicInt64FeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryBudgetPropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMemoryPriorityFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMemoryPriorityAllocateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDedicatedAllocationImageAliasingFeaturesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceBufferDeviceAddressFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBufferDeviceAddressCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceToolPropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkValidationFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCooperativeMatrixPropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCooperativeMatrixFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCooperativeMatrixPropertiesNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCoverageReductionModeFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineCoverageReductionStateCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkFramebufferMixedSamplesCombinationNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShaderInterlockFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceYcbcrImageArraysFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFullScreenExclusiveInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceCapabilitiesFullScreenExclusiveEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSurfaceFullScreenExclusiveWin32InfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkHeadlessSurfaceCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceLineRasterizationFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceLineRasterizationPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineRasterizationLineStateCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderAtomicFloatFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceIndexTypeUint8FeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceExtendedDynamicStateFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceShaderDemoteToHelperInvocationFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsPropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDeviceGeneratedCommandsFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGraphicsShaderGroupCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGraphicsPipelineShaderGroupsCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindShaderGroupIndirectCommandNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindIndexBufferIndirectCommandNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkBindVertexBufferIndirectCommandNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSetStateFlagsIndirectCommandNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIndirectCommandsStreamNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIndirectCommandsLayoutTokenNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkIndirectCommandsLayoutCreateInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeneratedCommandsInfoNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkGeneratedCommandsMemoryRequirementsInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTexelBufferAlignmentFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceTexelBufferAlignmentPropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRenderPassTransformBeginInfoQCOM& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCommandBufferInheritanceRenderPassTransformInfoQCOM& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDeviceMemoryReportFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceMemoryReportCallbackDataEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceDeviceMemoryReportCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRobustness2FeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRobustness2PropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkSamplerCustomBorderColorCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCustomBorderColorPropertiesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceCustomBorderColorFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePrivateDataFeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDevicePrivateDataCreateInfoEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPrivateDataSlotCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevicePipelineCreationCacheControlFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceDiagnosticsConfigFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDeviceDiagnosticsConfigCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsFeaturesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentShadingRateEnumsPropertiesNV& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPipelineFragmentShadingRateEnumStateCreateInfoNV& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMap2FeaturesEXT& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceFragmentDensityMap2PropertiesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyCommandTransformInfoQCOM& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceImageRobustnessFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDevice4444FormatsFeaturesEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkDirectFBSurfaceCreateInfoEXT& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceMutableDescriptorTypeFeaturesVALVE& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMutableDescriptorTypeListVALVE& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkMutableDescriptorTypeCreateInfoVALVE& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureBuildRangeInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryTrianglesDataKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryAabbsDataKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureGeometryInstancesDataKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureBuildGeometryInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkWriteDescriptorSetAccelerationStructureKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceAccelerationStructureFeaturesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceAccelerationStructurePropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureDeviceAddressInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureVersionInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyAccelerationStructureToMemoryInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyMemoryToAccelerationStructureInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkCopyAccelerationStructureInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkAccelerationStructureBuildSizesInfoKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingShaderGroupCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingPipelineInterfaceCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkRayTracingPipelineCreateInfoKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayTracingPipelineFeaturesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayTracingPipelinePropertiesKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkStridedDeviceAddressRegionKHR& data);
+void StructToJson(util::JsonWriter& writer, const Decoded_VkTraceRaysIndirectCommandKHR& data);
+
+void StructToJson(util::JsonWriter& writer, const Decoded_VkPhysicalDeviceRayQueryFeaturesKHR& data);
+
+GFXRECON_END_NAMESPACE(decode)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif
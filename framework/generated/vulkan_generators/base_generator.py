@@ -999,6 +999,30 @@ class BaseGenerator(OutputGenerator):
 
         return '{}({})'.format(methodCall, ', '.join(args))
 
+    #
+    # Convert a parameter encoder method call, as generated by makeEncoderMethodCall, to an expression that computes the
+    # number of bytes written by the method call.
+    def makeEncodedSizeExpression(self, methodCall):
+        match = re.match(r'^(encoder->Encode|EncodeStruct|EncodePNextStruct)(\w*)\((.*)\)$', methodCall)
+        if not match:
+            raise ValueError('Unrecognized encoder method call: {}'.format(methodCall))
+
+        prefix, method, args = match.groups()
+        if prefix == 'encoder->Encode':
+            # Values have a fixed size, so their arguments are not needed.
+            if method.endswith('Value') or method in ['Address', 'VoidPtr', 'FunctionPtr']:
+                return 'ParameterEncodedSize::{}()'.format(method)
+            return 'ParameterEncodedSize::{}({})'.format(method, args)
+
+        # Remove the encoder argument from struct encoding calls.
+        args = args[len('encoder, '):]
+        if prefix == 'EncodePNextStruct':
+            return 'ComputePNextStructEncodedSize({})'.format(args)
+        elif method == '':
+            return 'ComputeEncodedSize({})'.format(args)
+        else:
+            return 'ComputeStruct{}EncodedSize({})'.format(method, args)
+
     #
     # Return appropriate feature protect string from 'platform' tag on feature.
     # From Vulkan-ValidationLayers common_codegen.py
@@ -53,12 +53,16 @@ class EncodePNextStructGenerator(BaseGenerator):
         # Map to store VkStructureType enum values.
         self.sTypeValues = dict()
 
+        # List of (VkStructureType, struct) pairs for all features, used to generate the encoded size function.
+        self.pNextStructs = []
+
     # Method override
     def beginFile(self, genOpts):
         BaseGenerator.beginFile(self, genOpts)
 
         write('#include "generated/generated_vulkan_struct_encoders.h"', file=self.outFile)
         self.newline()
+        write('#include "encode/parameter_encoded_size.h"', file=self.outFile)
         write('#include "encode/parameter_encoder.h"', file=self.outFile)
         write('#include "encode/struct_pointer_encoder.h"', file=self.outFile)
         write('#include "encode/trace_manager.h"', file=self.outFile)
@@ -113,6 +117,34 @@ class EncodePNextStructGenerator(BaseGenerator):
         write('    }', file=self.outFile)
         write('}', file=self.outFile)
         self.newline()
+        write('size_t ComputePNextStructEncodedSize(const void* value)', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    auto base = reinterpret_cast<const VkBaseInStructure*>(value);', file=self.outFile)
+        self.newline()
+        write('    // Ignore the structures added to the pnext chain by the loader.', file=self.outFile)
+        write('    while ((base != nullptr) && ((base->sType == VK_STRUCTURE_TYPE_LOADER_INSTANCE_CREATE_INFO) ||', file=self.outFile)
+        write('                                 (base->sType == VK_STRUCTURE_TYPE_LOADER_DEVICE_CREATE_INFO)))', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        base = base->pNext;', file=self.outFile)
+        write('    }', file=self.outFile)
+        self.newline()
+        write('    if (base != nullptr)', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        switch (base->sType)', file=self.outFile)
+        write('        {', file=self.outFile)
+        write('        default:', file=self.outFile)
+        write('            // Unrecognized pNext values are omitted by EncodePNextStruct.', file=self.outFile)
+        write('            return ComputePNextStructEncodedSize(base->pNext);', file=self.outFile)
+        for sType, struct in self.pNextStructs:
+            write('        case {}:'.format(sType), file=self.outFile)
+            write('            return ComputeStructPtrEncodedSize(reinterpret_cast<const {}*>(base));'.format(struct), file=self.outFile)
+        write('        }', file=self.outFile)
+        write('    }', file=self.outFile)
+        self.newline()
+        write('    // pNext was either NULL or an ignored loader specific struct.', file=self.outFile)
+        write('    return ParameterEncodedSize::StructPtrPreamble(nullptr);', file=self.outFile)
+        write('}', file=self.outFile)
+        self.newline()
         write('GFXRECON_END_NAMESPACE(encode)', file=self.outFile)
         write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
 
@@ -143,4 +175,5 @@ class EncodePNextStructGenerator(BaseGenerator):
             write('        case {}:'.format(self.sTypeValues[struct]), file=self.outFile)
             write('            EncodeStructPtr(encoder, reinterpret_cast<const {}*>(base));'.format(struct), file=self.outFile)
             write('            break;', file=self.outFile)
+            self.pNextStructs.append((self.sTypeValues[struct], struct))
         self.sTypeValues = dict()
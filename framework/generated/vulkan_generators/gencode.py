@@ -51,6 +51,8 @@ from vulkan_struct_decoders_body_generator import VulkanStructDecodersBodyGenera
 from vulkan_struct_decoders_forward_generator import VulkanStructDecodersForwardGenerator,VulkanStructDecodersForwardGeneratorOptions
 from vulkan_struct_decoders_header_generator import VulkanStructDecodersHeaderGenerator,VulkanStructDecodersHeaderGeneratorOptions
 from decode_pnext_struct_generator import DecodePNextStructGenerator,DecodePNextStructGeneratorOptions
+from vulkan_struct_to_json_body_generator import VulkanStructToJsonBodyGenerator,VulkanStructToJsonBodyGeneratorOptions
+from vulkan_struct_to_json_header_generator import VulkanStructToJsonHeaderGenerator,VulkanStructToJsonHeaderGeneratorOptions
 
 # Consumers
 from vulkan_consumer_header_generator import VulkanConsumerHeaderGenerator,VulkanConsumerHeaderGeneratorOptions
@@ -226,6 +228,30 @@ def makeGenOpts(args):
             protectFeature    = False)
         ]
 
+    genOpts['generated_vulkan_struct_to_json.cpp'] = [
+          VulkanStructToJsonBodyGenerator,
+          VulkanStructToJsonBodyGeneratorOptions(
+            filename          = 'generated_vulkan_struct_to_json.cpp',
+            directory         = directory,
+            blacklists        = blacklists,
+            platformTypes     = platformTypes,
+            prefixText        = prefixStrings + vkPrefixStrings,
+            protectFile       = False,
+            protectFeature    = False)
+        ]
+
+    genOpts['generated_vulkan_struct_to_json.h'] = [
+          VulkanStructToJsonHeaderGenerator,
+          VulkanStructToJsonHeaderGeneratorOptions(
+            filename          = 'generated_vulkan_struct_to_json.h',
+            directory         = directory,
+            blacklists        = blacklists,
+            platformTypes     = platformTypes,
+            prefixText        = prefixStrings + vkPrefixStrings,
+            protectFile       = True,
+            protectFeature    = False)
+        ]
+
     #
     # Consumer generation
     genOpts['generated_vulkan_consumer.h'] = [
@@ -62,6 +62,9 @@ class LayerFuncTableGenerator(BaseGenerator):
                                 'vkEnumerateInstanceExtensionProperties',
                                 'vkEnumerateDeviceExtensionProperties']
 
+        # Table entries, collected from all features and written sorted by name when the file is finished
+        self.funcTableEntries = dict()
+
     # Method override
     def beginFile(self, genOpts):
         BaseGenerator.beginFile(self, genOpts)
@@ -73,16 +76,44 @@ class LayerFuncTableGenerator(BaseGenerator):
         self.newline()
         write('#include "vulkan/vulkan.h"', file=self.outFile)
         self.newline()
-        write('#include <unordered_map>', file=self.outFile)
+        write('#include <algorithm>', file=self.outFile)
+        write('#include <cstring>', file=self.outFile)
+        write('#include <iterator>', file=self.outFile)
         self.newline()
         write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
         self.newline()
-        write('const std::unordered_map<std::string, PFN_vkVoidFunction> func_table = {', file=self.outFile)
+        write('struct LayerFuncTableEntry', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    const char*        name;', file=self.outFile)
+        write('    PFN_vkVoidFunction func;', file=self.outFile)
+        write('};', file=self.outFile)
+        self.newline()
 
     # Method override
     def endFile(self):
+        # The table is a constant-initialized array sorted by name, which requires no allocation or construction at
+        # library load and is searched with a binary search.
+        write('// Sorted by name for lookup with GetLayerFunc().', file=self.outFile)
+        write('const LayerFuncTableEntry func_table[] = {', file=self.outFile)
+        for cmd in sorted(self.funcTableEntries):
+            write(self.funcTableEntries[cmd], file=self.outFile)
         write('};', file=self.outFile)
         self.newline()
+        write('inline PFN_vkVoidFunction GetLayerFunc(const char* name)', file=self.outFile)
+        write('{', file=self.outFile)
+        write('    auto end   = std::end(func_table);', file=self.outFile)
+        write('    auto entry = std::lower_bound(std::begin(func_table), end, name, [](const LayerFuncTableEntry& lhs, const char* rhs) {', file=self.outFile)
+        write('        return (strcmp(lhs.name, rhs) < 0);', file=self.outFile)
+        write('    });', file=self.outFile)
+        self.newline()
+        write('    if ((entry != end) && (strcmp(entry->name, name) == 0))', file=self.outFile)
+        write('    {', file=self.outFile)
+        write('        return entry->func;', file=self.outFile)
+        write('    }', file=self.outFile)
+        self.newline()
+        write('    return nullptr;', file=self.outFile)
+        write('}', file=self.outFile)
+        self.newline()
         write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
 
         # Finish processing in superclass
@@ -104,5 +135,5 @@ class LayerFuncTableGenerator(BaseGenerator):
                 body = '    {{ "{}",{}reinterpret_cast<PFN_vkVoidFunction>({}) }},'.format(cmd, (' ' * align), cmd[2:])
             else:
                 body = '    {{ "{}",{}reinterpret_cast<PFN_vkVoidFunction>(encode::{}) }},'.format(cmd, (' ' * align), cmd[2:])
-            write(body, file=self.outFile)
+            self.funcTableEntries[cmd] = body
 
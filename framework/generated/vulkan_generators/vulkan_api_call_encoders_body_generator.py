@@ -270,6 +270,17 @@ class VulkanApiCallEncodersBodyGenerator(BaseGenerator):
         body += indent + '{\n'
         indent += ' ' * self.INDENT_SIZE
 
+        # Size the parameter buffer for the input struct parameters, which may contain large arrays and pNext chains,
+        # so that it is not repeatedly grown while the structs are encoded.
+        sizeTerms = []
+        for value in values:
+            if self.isStruct(value.baseType) and (value.isPointer or value.isArray) and self.isInputPointer(value) and (value.baseType != 'VkAllocationCallbacks'):
+                methodCall = self.makeEncoderMethodCall(name, value, values, '', omitOutputParam)
+                sizeTerms.append(self.makeEncodedSizeExpression(methodCall))
+
+        if sizeTerms:
+            body += indent + 'encoder->Reserve({});\n'.format(' + '.join(sizeTerms))
+
         for value in values:
             methodCall = self.makeEncoderMethodCall(name, value, values, '', omitOutputParam)
             body += indent + '{};\n'.format(methodCall)
@@ -57,6 +57,8 @@ class VulkanAsciiConsumerBodyGenerator(BaseGenerator):
 
         write('#include "generated/generated_vulkan_ascii_consumer.h"', file=self.outFile)
         self.newline()
+        write('#include "decode/vulkan_json_util.h"', file=self.outFile)
+        write('#include "generated/generated_vulkan_struct_to_json.h"', file=self.outFile)
         write('#include "util/defines.h"', file=self.outFile)
         self.newline()
         write('#include "vulkan/vulkan.h"', file=self.outFile)
@@ -101,5 +103,12 @@ class VulkanAsciiConsumerBodyGenerator(BaseGenerator):
     #
     # Return VulkanAsciiConsumer class member function definition.
     def makeConsumerFuncBody(self, returnType, name, values):
-        body = '    fprintf(GetFile(), "%s\\n", "' + name + '");\n'
+        body = '    util::JsonWriter& writer = WriteApiCallStart("{}");\n'.format(name)
+        for value in values:
+            body += '    FieldToJson(writer, "{name}", {name});\n'.format(name=value.name)
+
+        if returnType != 'void':
+            body += '    WriteApiCallEnd(returnValue);\n'
+        else:
+            body += '    WriteApiCallEnd();\n'
         return body
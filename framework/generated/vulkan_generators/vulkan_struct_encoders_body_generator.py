@@ -57,6 +57,7 @@ class VulkanStructEncodersBodyGenerator(BaseGenerator):
         write('#include "generated/generated_vulkan_struct_encoders.h"', file=self.outFile)
         self.newline()
         write('#include "encode/custom_vulkan_struct_encoders.h"', file=self.outFile)
+        write('#include "encode/parameter_encoded_size.h"', file=self.outFile)
         write('#include "encode/parameter_encoder.h"', file=self.outFile)
         write('#include "encode/struct_pointer_encoder.h"', file=self.outFile)
         write('#include "util/defines.h"', file=self.outFile)
@@ -91,6 +92,11 @@ class VulkanStructEncodersBodyGenerator(BaseGenerator):
             body += 'void EncodeStruct(ParameterEncoder* encoder, const {}& value)\n'.format(struct)
             body += '{\n'
             body += self.makeStructBody(struct, self.featureStructMembers[struct], 'value.')
+            body += '}\n'
+            body += '\n'
+            body += 'size_t ComputeEncodedSize(const {}& value)\n'.format(struct)
+            body += '{\n'
+            body += self.makeStructSizeBody(struct, self.featureStructMembers[struct], 'value.')
             body += '}'
             write(body, file=self.outFile)
 
@@ -111,3 +117,28 @@ class VulkanStructEncodersBodyGenerator(BaseGenerator):
                 body += '    {};\n'.format(methodCall)
 
         return body
+
+    #
+    # Encoded size function definition, which sums the sizes of the values written by the struct's encoder.
+    def makeStructSizeBody(self, name, values, prefix):
+        terms = []
+
+        for value in values:
+            if 'pNext' in value.name:
+                methodCall = 'EncodePNextStruct(encoder, {})'.format(prefix + value.name)
+            else:
+                methodCall = self.makeEncoderMethodCall(name, value, values, prefix)
+            terms.append(self.makeEncodedSizeExpression(methodCall))
+
+        body = ''
+        if not any(prefix in term for term in terms):
+            body += '    GFXRECON_UNREFERENCED_PARAMETER(value);\n'
+            body += '\n'
+
+        body += '    size_t size = 0;\n'
+        for term in terms:
+            body += '    size += {};\n'.format(term)
+        body += '\n'
+        body += '    return size;\n'
+
+        return body
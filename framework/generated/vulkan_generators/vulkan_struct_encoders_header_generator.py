@@ -66,6 +66,7 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
         write('GFXRECON_BEGIN_NAMESPACE(encode)', file=self.outFile)
         self.newline()
         write('void EncodePNextStruct(ParameterEncoder* encoder, const void* value);', file=self.outFile)
+        write('size_t ComputePNextStructEncodedSize(const void* value);', file=self.outFile)
 
     # Method override
     def endFile(self):
@@ -88,3 +89,6 @@ class VulkanStructEncodersHeaderGenerator(BaseGenerator):
     def generateFeature(self):
         for struct in self.getFilteredStructNames():
             write('void EncodeStruct(ParameterEncoder* encoder, const {}& value);'.format(struct), file=self.outFile)
+        self.newline()
+        for struct in self.getFilteredStructNames():
+            write('size_t ComputeEncodedSize(const {}& value);'.format(struct), file=self.outFile)
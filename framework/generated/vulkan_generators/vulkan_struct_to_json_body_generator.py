@@ -0,0 +1,184 @@
+#!/usr/bin/python3 -i
+#
+# Copyright (c) 2021 LunarG, Inc.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy
+# of this software and associated documentation files (the "Software"), to
+# deal in the Software without restriction, including without limitation the
+# rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+# sell copies of the Software, and to permit persons to whom the Software is
+# furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+# IN THE SOFTWARE.
+
+import os,re,sys
+
+import os,re,sys
+from base_generator import *
+
+class VulkanStructToJsonBodyGeneratorOptions(BaseGeneratorOptions):
+    """Options for generating C++ functions for writing decoded Vulkan structs as JSON"""
+    def __init__(self,
+                 blacklists = None,         # Path to JSON file listing apicalls and structs to ignore.
+                 platformTypes = None,      # Path to JSON file listing platform (WIN32, X11, etc.) defined types.
+                 filename = None,
+                 directory = '.',
+                 prefixText = '',
+                 protectFile = False,
+                 protectFeature = True):
+        BaseGeneratorOptions.__init__(self, blacklists, platformTypes,
+                                      filename, directory, prefixText,
+                                      protectFile, protectFeature)
+
+# VulkanStructToJsonBodyGenerator - subclass of BaseGenerator.
+# Generates C++ functions for writing decoded Vulkan API structures as JSON objects, with members written in
+# declaration order.  Members that are stored by the decoded struct wrapper are written from the wrapper, and all
+# other members are written from the decoded struct value.
+class VulkanStructToJsonBodyGenerator(BaseGenerator):
+    """Generate C++ functions for writing decoded Vulkan structs as JSON"""
+    def __init__(self,
+                 errFile = sys.stderr,
+                 warnFile = sys.stderr,
+                 diagFile = sys.stdout):
+        BaseGenerator.__init__(self,
+                               processCmds=False, processStructs=True, featureBreak=True,
+                               errFile=errFile, warnFile=warnFile, diagFile=diagFile)
+
+        # List of (struct, VkStructureType) pairs for the structs that can appear in a pNext chain.
+        self.pNextStructs = []
+
+    # Method override
+    def beginFile(self, genOpts):
+        BaseGenerator.beginFile(self, genOpts)
+
+        write('#include "generated/generated_vulkan_struct_to_json.h"', file=self.outFile)
+        self.newline()
+        write('#include "decode/vulkan_json_util.h"', file=self.outFile)
+        self.newline()
+        write('GFXRECON_BEGIN_NAMESPACE(gfxrecon)', file=self.outFile)
+        write('GFXRECON_BEGIN_NAMESPACE(decode)', file=self.outFile)
+
+    # Method override
+    def endFile(self):
+        self.newline()
+        write(self.makePNextToJson(), file=self.outFile)
+        self.newline()
+        write('GFXRECON_END_NAMESPACE(decode)', file=self.outFile)
+        write('GFXRECON_END_NAMESPACE(gfxrecon)', file=self.outFile)
+
+        # Finish processing in superclass
+        BaseGenerator.endFile(self)
+
+    # Method override
+    def genStruct(self, typeinfo, typename, alias):
+        BaseGenerator.genStruct(self, typeinfo, typename, alias)
+
+        if not alias:
+            # Only struct types that specify a 'structextends' tag can be used in a pNext chain.
+            parentStructs = typeinfo.elem.get('structextends')
+            if parentStructs:
+                sType = self.makeStructureTypeEnum(typeinfo, typename)
+                if sType:
+                    self.pNextStructs.append((typename, sType))
+
+    #
+    # Indicates that the current feature has C++ code to generate.
+    def needFeatureGeneration(self):
+        if self.featureStructMembers:
+            return True
+        return False
+
+    #
+    # Performs C++ code generation for the feature.
+    def generateFeature(self):
+        first = True
+        for struct in self.getFilteredStructNames():
+            body = '' if first else '\n'
+            body += 'void StructToJson(util::JsonWriter& writer, const Decoded_{}& data)\n'.format(struct)
+            body += '{\n'
+            body += self.makeStructToJsonBody(struct, self.featureStructMembers[struct])
+            body += '}'
+
+            write(body, file=self.outFile)
+            first = False
+
+    #
+    # Determines if a Vulkan struct member is stored by the decoded struct wrapper.  This must match the members
+    # declared by VulkanStructDecodersHeaderGenerator.
+    def isWrapperMember(self, name, value):
+        if value.name == 'pNext':
+            return True
+        elif value.isPointer or value.isArray:
+            return True
+        elif self.isFunctionPtr(value.baseType):
+            return True
+        elif self.isHandle(value.baseType):
+            return True
+        elif self.isStruct(value.baseType):
+            return True
+        elif self.isGenericStructHandleValue(name, value.name):
+            return True
+        return False
+
+    #
+    # Generate the C++ code for the StructToJson function body.
+    def makeStructToJsonBody(self, name, values):
+        fields = ''
+        usesValue = False
+
+        for value in values:
+            if self.isWrapperMember(name, value):
+                fields += '    FieldToJson(writer, "{name}", data.{name});\n'.format(name=value.name)
+            elif value.bitfieldWidth:
+                # Bit fields cannot be bound to a reference, so are passed by value.
+                fields += '    FieldToJson(writer, "{name}", static_cast<{}>(value.{name}));\n'.format(value.baseType, name=value.name)
+                usesValue = True
+            else:
+                fields += '    FieldToJson(writer, "{name}", value.{name});\n'.format(name=value.name)
+                usesValue = True
+
+        body = ''
+        if usesValue:
+            body += '    const {}& value = *data.decoded_value;\n'.format(name)
+            body += '\n'
+        body += '    writer.BeginObject();\n'
+        body += fields
+        body += '    writer.EndObject();\n'
+        return body
+
+    #
+    # Generate the C++ code for the PNextToJson function, which writes the struct at the head of a pNext chain.
+    def makePNextToJson(self):
+        body = 'void PNextToJson(util::JsonWriter& writer, const PNextNode* data)\n'
+        body += '{\n'
+        body += '    if ((data == nullptr) || (data->GetPointer() == nullptr))\n'
+        body += '    {\n'
+        body += '        writer.Null();\n'
+        body += '    }\n'
+        body += '    else\n'
+        body += '    {\n'
+        body += '        const VkBaseInStructure* base = reinterpret_cast<const VkBaseInStructure*>(data->GetPointer());\n'
+        body += '\n'
+        body += '        switch (base->sType)\n'
+        body += '        {\n'
+        for struct, sType in self.pNextStructs:
+            body += '            case {}:\n'.format(sType)
+            body += '                StructToJson(writer, *reinterpret_cast<const Decoded_{}*>(data->GetMetaStructPointer()));\n'.format(struct)
+            body += '                break;\n'
+        body += '            default:\n'
+        body += '                // Unrecognized structure types were not decoded.\n'
+        body += '                writer.Null();\n'
+        body += '                break;\n'
+        body += '        }\n'
+        body += '    }\n'
+        body += '}'
+        return body
@@ -0,0 +1,293 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/direct_file_output_stream.h"
+
+#if defined(__linux__)
+
+#include "util/logging.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cinttypes>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <linux/aio_abi.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+static_assert(sizeof(aio_context_t) == sizeof(unsigned long), "Unexpected aio_context_t size");
+
+// The native AIO interface has no glibc wrappers, and is called directly to avoid a dependency on libaio.
+static int IoSetup(unsigned nr_events, aio_context_t* context)
+{
+    return static_cast<int>(syscall(__NR_io_setup, nr_events, context));
+}
+
+static int IoDestroy(aio_context_t context)
+{
+    return static_cast<int>(syscall(__NR_io_destroy, context));
+}
+
+static int IoSubmit(aio_context_t context, long nr, struct iocb** iocbs)
+{
+    return static_cast<int>(syscall(__NR_io_submit, context, nr, iocbs));
+}
+
+static int IoGetEvents(aio_context_t context, long min_nr, long max_nr, struct io_event* events)
+{
+    return static_cast<int>(syscall(__NR_io_getevents, context, min_nr, max_nr, events, nullptr));
+}
+
+DirectFileOutputStream::DirectFileOutputStream(const std::string& filename, size_t buffer_size, uint32_t buffer_count) :
+    fd_(-1), aio_context_(0), buffer_size_(((buffer_size + kAlignment - 1) / kAlignment) * kAlignment),
+    in_flight_(buffer_count, false), in_flight_count_(0), current_buffer_(0), current_size_(0), file_offset_(0),
+    valid_(false)
+{
+    assert((buffer_size > 0) && (buffer_count > 0));
+
+    fd_ = open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_DIRECT, 0666);
+    if (fd_ < 0)
+    {
+        GFXRECON_LOG_WARNING("open(%s) with O_DIRECT failed (errno = %d)", filename.c_str(), errno);
+        return;
+    }
+
+    aio_context_t context = 0;
+    if (IoSetup(buffer_count, &context) < 0)
+    {
+        GFXRECON_LOG_WARNING("io_setup failed for %s (errno = %d)", filename.c_str(), errno);
+        Close();
+        return;
+    }
+
+    aio_context_ = context;
+
+    for (uint32_t i = 0; i < buffer_count; ++i)
+    {
+        void* buffer = nullptr;
+        if (posix_memalign(&buffer, kAlignment, buffer_size_) != 0)
+        {
+            GFXRECON_LOG_ERROR("Failed to allocate %" PRIuPTR " byte direct I/O buffer", buffer_size_);
+            Close();
+            return;
+        }
+
+        buffers_.push_back(static_cast<uint8_t*>(buffer));
+    }
+
+    valid_ = true;
+}
+
+DirectFileOutputStream::~DirectFileOutputStream()
+{
+    if (valid_)
+    {
+        Flush();
+    }
+
+    Close();
+}
+
+size_t DirectFileOutputStream::Write(const void* data, size_t len)
+{
+    if (!valid_)
+    {
+        return 0;
+    }
+
+    const uint8_t* bytes     = reinterpret_cast<const uint8_t*>(data);
+    size_t         remaining = len;
+
+    while (remaining > 0)
+    {
+        size_t copy_size = std::min(remaining, buffer_size_ - current_size_);
+
+        memcpy(buffers_[current_buffer_] + current_size_, bytes, copy_size);
+
+        current_size_ += copy_size;
+        bytes += copy_size;
+        remaining -= copy_size;
+
+        if ((current_size_ == buffer_size_) && !SubmitCurrentBuffer())
+        {
+            return len - remaining;
+        }
+    }
+
+    return len;
+}
+
+void DirectFileOutputStream::Flush()
+{
+    if (valid_ && WaitForWrites(in_flight_count_))
+    {
+        WriteTail();
+    }
+}
+
+bool DirectFileOutputStream::SubmitCurrentBuffer()
+{
+    struct iocb request;
+    memset(&request, 0, sizeof(request));
+    request.aio_data       = current_buffer_;
+    request.aio_lio_opcode = IOCB_CMD_PWRITE;
+    request.aio_fildes     = static_cast<uint32_t>(fd_);
+    request.aio_buf        = reinterpret_cast<uint64_t>(buffers_[current_buffer_]);
+    request.aio_nbytes     = buffer_size_;
+    request.aio_offset     = static_cast<int64_t>(file_offset_);
+
+    struct iocb* requests[] = { &request };
+
+    int result = 0;
+    do
+    {
+        result = IoSubmit(aio_context_, 1, requests);
+    } while ((result < 0) && ((errno == EINTR) || (errno == EAGAIN)));
+
+    if (result != 1)
+    {
+        GFXRECON_LOG_ERROR("io_submit failed (errno = %d)", errno);
+        valid_ = false;
+        return false;
+    }
+
+    in_flight_[current_buffer_] = true;
+    ++in_flight_count_;
+
+    file_offset_ += buffer_size_;
+    current_size_   = 0;
+    current_buffer_ = (current_buffer_ + 1) % static_cast<uint32_t>(buffers_.size());
+
+    // Block until the write that was submitted from the next buffer has completed, so that it can be reused.  Writes
+    // may complete out of order, so completions for other buffers can be retrieved before the completion for the next
+    // buffer.
+    while (in_flight_[current_buffer_])
+    {
+        if (!WaitForWrites(1))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool DirectFileOutputStream::WaitForWrites(uint32_t min_count)
+{
+    std::vector<struct io_event> events(buffers_.size());
+
+    while (min_count > 0)
+    {
+        int count = IoGetEvents(aio_context_, min_count, static_cast<long>(events.size()), events.data());
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            GFXRECON_LOG_ERROR("io_getevents failed (errno = %d)", errno);
+            valid_ = false;
+            return false;
+        }
+
+        for (int i = 0; i < count; ++i)
+        {
+            in_flight_[events[i].data] = false;
+            --in_flight_count_;
+
+            if (events[i].res != static_cast<int64_t>(buffer_size_))
+            {
+                GFXRECON_LOG_ERROR("Direct I/O write failed (result = %" PRId64 ")",
+                                   static_cast<int64_t>(events[i].res));
+                valid_ = false;
+            }
+        }
+
+        min_count -= std::min(min_count, static_cast<uint32_t>(count));
+    }
+
+    return valid_;
+}
+
+bool DirectFileOutputStream::WriteTail()
+{
+    if (current_size_ > 0)
+    {
+        // The padding is overwritten by the next write to the buffer, and removed from the file by the truncation.
+        size_t   aligned_size = ((current_size_ + kAlignment - 1) / kAlignment) * kAlignment;
+        uint8_t* buffer       = buffers_[current_buffer_];
+
+        memset(buffer + current_size_, 0, aligned_size - current_size_);
+
+        ssize_t written = pwrite(fd_, buffer, aligned_size, static_cast<off_t>(file_offset_));
+
+        if ((written != static_cast<ssize_t>(aligned_size)) ||
+            (ftruncate(fd_, static_cast<off_t>(file_offset_ + current_size_)) != 0))
+        {
+            GFXRECON_LOG_ERROR("Direct I/O write failed (errno = %d)", errno);
+            valid_ = false;
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void DirectFileOutputStream::Close()
+{
+    // Destroying the context blocks until pending writes, which reference the buffers, have completed or been
+    // cancelled.
+    if (aio_context_ != 0)
+    {
+        IoDestroy(aio_context_);
+        aio_context_     = 0;
+        in_flight_count_ = 0;
+    }
+
+    for (auto buffer : buffers_)
+    {
+        free(buffer);
+    }
+
+    buffers_.clear();
+
+    if (fd_ >= 0)
+    {
+        close(fd_);
+        fd_ = -1;
+    }
+
+    valid_ = false;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // defined(__linux__)
@@ -0,0 +1,98 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_DIRECT_FILE_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_DIRECT_FILE_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that bypasses the page cache by writing to a file opened with O_DIRECT.  Data is copied to a ring of
+// large aligned buffers, and each full buffer is submitted to the kernel with native asynchronous I/O so that the file
+// write overlaps with capture.  A buffer is only reused after its write has completed, which bounds the number of
+// writes in flight to the number of buffers.  IsValid() returns false when the file system or kernel does not support
+// direct or asynchronous I/O, in which case the caller is expected to fall back to FileOutputStream.
+class DirectFileOutputStream : public OutputStream
+{
+  public:
+    static const size_t   kDefaultBufferSize  = 4 * 1024 * 1024;
+    static const uint32_t kDefaultBufferCount = 4;
+
+    // O_DIRECT requires the memory address, file offset, and size of each write to be a multiple of the logical block
+    // size of the device.
+    static const size_t kAlignment = 4096;
+
+  public:
+    DirectFileOutputStream(const std::string& filename,
+                           size_t             buffer_size  = kDefaultBufferSize,
+                           uint32_t           buffer_count = kDefaultBufferCount);
+
+    virtual ~DirectFileOutputStream() override;
+
+    virtual bool IsValid() override { return valid_; }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    // Waits for all pending writes and writes the partially filled buffer, so that the file contains all data that has
+    // been written to the stream.  The partial buffer must be written synchronously and padded to the alignment size,
+    // with the file then truncated to its actual size, so frequent flushes negate the benefit of this stream.
+    virtual void Flush() override;
+
+    virtual uint64_t GetBytesWritten() override { return file_offset_ + current_size_; }
+
+  private:
+    bool SubmitCurrentBuffer();
+
+    bool WaitForWrites(uint32_t min_count);
+
+    bool WriteTail();
+
+    void Close();
+
+  private:
+    int                   fd_;
+    unsigned long         aio_context_;
+    size_t                buffer_size_;
+    std::vector<uint8_t*> buffers_;
+    std::vector<bool>     in_flight_;
+    uint32_t              in_flight_count_;
+    uint32_t              current_buffer_;
+    size_t                current_size_; // Bytes written to the current buffer.
+    uint64_t              file_offset_;  // File offset of the current buffer.
+    bool                  valid_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // defined(__linux__)
+
+#endif // GFXRECON_UTIL_DIRECT_FILE_OUTPUT_STREAM_H
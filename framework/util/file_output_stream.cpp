@@ -29,7 +29,8 @@
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-FileOutputStream::FileOutputStream(const std::string& filename, bool append) : file_(nullptr), own_file_(true)
+FileOutputStream::FileOutputStream(const std::string& filename, bool append) :
+    file_(nullptr), own_file_(true), bytes_written_(0)
 {
     const char* mode   = append ? "ab" : "wb";
     int32_t     result = platform::FileOpen(&file_, filename.c_str(), mode);
@@ -40,7 +41,7 @@ FileOutputStream::FileOutputStream(const std::string& filename, bool append) : f
     }
 }
 
-FileOutputStream::FileOutputStream(FILE* file, bool owned) : file_(file), own_file_(owned) {}
+FileOutputStream::FileOutputStream(FILE* file, bool owned) : file_(file), own_file_(owned), bytes_written_(0) {}
 
 FileOutputStream::~FileOutputStream()
 {
@@ -52,7 +53,9 @@ FileOutputStream::~FileOutputStream()
 
 size_t FileOutputStream::Write(const void* data, size_t len)
 {
-    return platform::FileWriteNoLock(data, 1, len, file_);
+    size_t written = platform::FileWriteNoLock(data, 1, len, file_);
+    bytes_written_ += written;
+    return written;
 }
 
 GFXRECON_END_NAMESPACE(util)
@@ -49,9 +49,12 @@ class FileOutputStream : public OutputStream
 
     virtual void Flush() override { platform::FileFlush(file_); }
 
+    virtual uint64_t GetBytesWritten() override { return bytes_written_; }
+
   private:
-    FILE* file_;
-    bool  own_file_;
+    FILE*    file_;
+    bool     own_file_;
+    uint64_t bytes_written_;
 };
 
 GFXRECON_END_NAMESPACE(util)
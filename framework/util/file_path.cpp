@@ -102,6 +102,27 @@ bool IsDirectory(const std::string& path)
     return is_dir;
 }
 
+bool IsNamedPipe(const std::string& path)
+{
+    bool is_pipe = false;
+
+#if defined(WIN32)
+    const char kPipePrefix[] = "\\\\.\\pipe\\";
+    if (path.compare(0, sizeof(kPipePrefix) - 1, kPipePrefix) == 0)
+    {
+        is_pipe = true;
+    }
+#else
+    struct stat info;
+    if ((stat(path.c_str(), &info) == 0) && (S_ISFIFO(info.st_mode)))
+    {
+        is_pipe = true;
+    }
+#endif
+
+    return is_pipe;
+}
+
 std::string Join(const std::string& lhs, const std::string& rhs)
 {
     std::string joined;
@@ -38,6 +38,9 @@ bool IsFile(const std::string& path);
 
 bool IsDirectory(const std::string& path);
 
+// Returns true for an existing FIFO, or for a Windows named pipe path of the form \\.\pipe\name.
+bool IsNamedPipe(const std::string& path);
+
 std::string Join(const std::string& lhs, const std::string& rhs);
 
 std::string InsertFilenamePostfix(const std::string& filename, const std::string& postfix);
@@ -23,10 +23,51 @@
 
 #include "util/hash.h"
 
+#include <cstring>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 GFXRECON_BEGIN_NAMESPACE(hash)
 
+const uint64_t kPrime64_1 = 0x9E3779B185EBCA87ull;
+const uint64_t kPrime64_2 = 0xC2B2AE3D27D4EB4Full;
+const uint64_t kPrime64_3 = 0x165667B19E3779F9ull;
+const uint64_t kPrime64_4 = 0x85EBCA77C2B2AE63ull;
+const uint64_t kPrime64_5 = 0x27D4EB2F165667C5ull;
+
+static uint64_t RotateLeft64(uint64_t value, uint32_t count)
+{
+    return (value << count) | (value >> (64 - count));
+}
+
+// Reads unaligned values in little-endian byte order.
+static uint64_t Read64(const uint8_t* data)
+{
+    uint64_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static uint32_t Read32(const uint8_t* data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static uint64_t Round64(uint64_t accumulator, uint64_t input)
+{
+    accumulator += input * kPrime64_2;
+    accumulator = RotateLeft64(accumulator, 31);
+    return accumulator * kPrime64_1;
+}
+
+static uint64_t MergeRound64(uint64_t accumulator, uint64_t value)
+{
+    accumulator ^= Round64(0, value);
+    return (accumulator * kPrime64_1) + kPrime64_4;
+}
+
 uint32_t CheckSum(const uint32_t* code, size_t code_size)
 {
     uint32_t sum            = 0;
@@ -40,6 +81,70 @@ uint32_t CheckSum(const uint32_t* code, size_t code_size)
     return sum;
 }
 
+uint64_t Hash64(const void* data, size_t size, uint64_t seed)
+{
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+    const uint8_t* end   = bytes + size;
+    uint64_t       hash  = 0;
+
+    if (size >= 32)
+    {
+        const uint8_t* limit = end - 32;
+        uint64_t       v1    = seed + kPrime64_1 + kPrime64_2;
+        uint64_t       v2    = seed + kPrime64_2;
+        uint64_t       v3    = seed;
+        uint64_t       v4    = seed - kPrime64_1;
+
+        do
+        {
+            v1 = Round64(v1, Read64(bytes));
+            v2 = Round64(v2, Read64(bytes + 8));
+            v3 = Round64(v3, Read64(bytes + 16));
+            v4 = Round64(v4, Read64(bytes + 24));
+            bytes += 32;
+        } while (bytes <= limit);
+
+        hash = RotateLeft64(v1, 1) + RotateLeft64(v2, 7) + RotateLeft64(v3, 12) + RotateLeft64(v4, 18);
+        hash = MergeRound64(hash, v1);
+        hash = MergeRound64(hash, v2);
+        hash = MergeRound64(hash, v3);
+        hash = MergeRound64(hash, v4);
+    }
+    else
+    {
+        hash = seed + kPrime64_5;
+    }
+
+    hash += static_cast<uint64_t>(size);
+
+    for (; (bytes + 8) <= end; bytes += 8)
+    {
+        hash ^= Round64(0, Read64(bytes));
+        hash = (RotateLeft64(hash, 27) * kPrime64_1) + kPrime64_4;
+    }
+
+    if ((bytes + 4) <= end)
+    {
+        hash ^= static_cast<uint64_t>(Read32(bytes)) * kPrime64_1;
+        hash = (RotateLeft64(hash, 23) * kPrime64_2) + kPrime64_3;
+        bytes += 4;
+    }
+
+    for (; bytes < end; ++bytes)
+    {
+        hash ^= (*bytes) * kPrime64_5;
+        hash = RotateLeft64(hash, 11) * kPrime64_1;
+    }
+
+    hash ^= hash >> 33;
+    hash *= kPrime64_2;
+    hash ^= hash >> 29;
+    hash *= kPrime64_3;
+    hash ^= hash >> 32;
+
+    return hash;
+}
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -27,6 +27,7 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
@@ -34,6 +35,10 @@ GFXRECON_BEGIN_NAMESPACE(hash)
 
 uint32_t CheckSum(const uint32_t* code, size_t code_size);
 
+// Computes a 64-bit non-cryptographic hash of the data with the XXH64 algorithm, which processes the data as four
+// independent streams to hash large buffers at close to memory bandwidth.
+uint64_t Hash64(const void* data, size_t size, uint64_t seed = 0);
+
 GFXRECON_END_NAMESPACE(hash)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
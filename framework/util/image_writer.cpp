@@ -24,6 +24,23 @@
 
 #include "platform.h"
 
+#ifdef ENABLE_ZLIB_COMPRESSION
+#include "zlib.h"
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_IMAGE_WRITER_SSE2
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#include <arm_neon.h>
+#define GFXRECON_IMAGE_WRITER_NEON
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 GFXRECON_BEGIN_NAMESPACE(imagewriter)
@@ -31,6 +48,74 @@ GFXRECON_BEGIN_NAMESPACE(imagewriter)
 const uint16_t kBmpBitCount = 32; // Expecting 32-bit BGRA bitmap data.
 const uint32_t kBmpBpp      = 4;  // Expecting 4 bytes per pixel for 32-bit BGRA bitmap data.
 
+const uint8_t  kPngSignature[]       = { 0x89, 'P', 'N', 'G', '\r', '\n', 0x1a, '\n' };
+const uint8_t  kPngColorTypeRgba     = 6;
+const uint8_t  kPngFilterSub         = 1;
+const uint32_t kPngMinParallelPixels = 1024 * 1024; // Images with fewer pixels are compressed by a single thread.
+const uint32_t kPngMinRowsPerStrip   = 64;
+const uint32_t kPngMaxStripCount     = 16;
+const uint8_t  kQoiOpIndex           = 0x00;
+const uint8_t  kQoiOpDiff            = 0x40;
+const uint8_t  kQoiOpLuma            = 0x80;
+const uint8_t  kQoiOpRun             = 0xc0;
+const uint8_t  kQoiOpRgb             = 0xfe;
+const uint8_t  kQoiOpRgba            = 0xff;
+const uint32_t kQoiMaxRun            = 62;
+const uint8_t  kQoiEndMarker[]       = { 0, 0, 0, 0, 0, 0, 0, 1 };
+const size_t   kQoiHeaderSize        = 14;
+
+static void WriteBigEndian32(uint32_t value, uint8_t* output)
+{
+    output[0] = static_cast<uint8_t>(value >> 24);
+    output[1] = static_cast<uint8_t>(value >> 16);
+    output[2] = static_cast<uint8_t>(value >> 8);
+    output[3] = static_cast<uint8_t>(value);
+}
+
+// Converts a row of BGRA pixels to RGBA pixels with an alpha value of 255.  Swapchain images frequently contain
+// undefined alpha values, which would produce transparent images with formats that retain alpha.
+static void ConvertBgraToOpaqueRgba(const uint8_t* bgra, uint32_t pixel_count, uint8_t* rgba)
+{
+    uint32_t i = 0;
+
+#if defined(GFXRECON_IMAGE_WRITER_SSE2)
+    const __m128i green_mask = _mm_set1_epi32(0x0000ff00);
+    const __m128i byte_mask  = _mm_set1_epi32(0x000000ff);
+    const __m128i alpha      = _mm_set1_epi32(static_cast<int>(0xff000000));
+
+    for (; (i + 4) <= pixel_count; i += 4)
+    {
+        __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(bgra + (i * 4)));
+        __m128i red    = _mm_and_si128(_mm_srli_epi32(pixels, 16), byte_mask);
+        __m128i blue   = _mm_slli_epi32(_mm_and_si128(pixels, byte_mask), 16);
+        __m128i result = _mm_or_si128(_mm_or_si128(_mm_and_si128(pixels, green_mask), alpha), _mm_or_si128(red, blue));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(rgba + (i * 4)), result);
+    }
+#elif defined(GFXRECON_IMAGE_WRITER_NEON)
+    const uint8x16_t alpha = vdupq_n_u8(0xff);
+
+    for (; (i + 16) <= pixel_count; i += 16)
+    {
+        uint8x16x4_t pixels = vld4q_u8(bgra + (i * 4));
+        uint8x16_t   blue   = pixels.val[0];
+        pixels.val[0]       = pixels.val[2];
+        pixels.val[2]       = blue;
+        pixels.val[3]       = alpha;
+        vst4q_u8(rgba + (i * 4), pixels);
+    }
+#endif
+
+    for (; i < pixel_count; ++i)
+    {
+        const uint8_t* source      = bgra + (i * 4);
+        uint8_t*       destination = rgba + (i * 4);
+        destination[0]             = source[2];
+        destination[1]             = source[1];
+        destination[2]             = source[0];
+        destination[3]             = 0xff;
+    }
+}
+
 bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
 {
     bool     success    = false;
@@ -89,6 +174,325 @@ bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height,
     return success;
 }
 
+#ifdef ENABLE_ZLIB_COMPRESSION
+
+static bool WritePngChunk(FILE* file, const char* type, const uint8_t* data, size_t size)
+{
+    uint8_t header[8];
+    uint8_t footer[4];
+
+    WriteBigEndian32(static_cast<uint32_t>(size), header);
+    std::memcpy(&header[4], type, 4);
+
+    uLong crc = crc32(0, &header[4], 4);
+    if (size > 0)
+    {
+        crc = crc32(crc, data, static_cast<uInt>(size));
+    }
+
+    WriteBigEndian32(static_cast<uint32_t>(crc), footer);
+
+    return (util::platform::FileWrite(header, sizeof(header), 1, file) == 1) &&
+           ((size == 0) || (util::platform::FileWrite(data, size, 1, file) == 1)) &&
+           (util::platform::FileWrite(footer, sizeof(footer), 1, file) == 1);
+}
+
+// Filters and compresses a horizontal strip of the image as a raw deflate stream.  Strips are flushed to a byte
+// boundary, so that the streams of consecutive strips can be concatenated, and only the last strip is finished.
+static bool CompressPngStrip(const uint8_t*        bgra,
+                             uint32_t              width,
+                             uint32_t              first_row,
+                             uint32_t              row_count,
+                             bool                  last_strip,
+                             std::vector<uint8_t>* output,
+                             uLong*                adler)
+{
+    size_t               row_size = 1 + (static_cast<size_t>(width) * 4);
+    std::vector<uint8_t> filtered(row_size * row_count);
+
+    for (uint32_t row = 0; row < row_count; ++row)
+    {
+        uint8_t* filtered_row = &filtered[row * row_size];
+        filtered_row[0]       = kPngFilterSub;
+
+        ConvertBgraToOpaqueRgba(bgra + ((first_row + row) * static_cast<size_t>(width) * 4), width, &filtered_row[1]);
+
+        // The Sub filter stores the difference between each byte and the corresponding byte of the previous pixel.
+        for (size_t i = row_size - 1; i > 4; --i)
+        {
+            filtered_row[i] = static_cast<uint8_t>(filtered_row[i] - filtered_row[i - 4]);
+        }
+    }
+
+    (*adler) = adler32(1, filtered.data(), static_cast<uInt>(filtered.size()));
+
+    z_stream stream = {};
+    if (deflateInit2(&stream, Z_BEST_SPEED, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return false;
+    }
+
+    // Reserve space for the compressed data, with room for the trailing flush marker.
+    output->resize(deflateBound(&stream, static_cast<uLong>(filtered.size())) + 16);
+
+    stream.next_in   = filtered.data();
+    stream.avail_in  = static_cast<uInt>(filtered.size());
+    stream.next_out  = output->data();
+    stream.avail_out = static_cast<uInt>(output->size());
+
+    int  result  = deflate(&stream, last_strip ? Z_FINISH : Z_SYNC_FLUSH);
+    bool success = last_strip ? (result == Z_STREAM_END) : ((result == Z_OK) && (stream.avail_in == 0));
+
+    output->resize(stream.total_out);
+    deflateEnd(&stream);
+
+    return success;
+}
+
+bool WritePngImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
+{
+    uint64_t image_size = static_cast<uint64_t>(height) * width * kBmpBpp;
+
+    if ((width == 0) || (height == 0) || (image_size > data_size))
+    {
+        return false;
+    }
+
+    // Split large images into strips that are compressed in parallel.
+    uint32_t strip_count = 1;
+    if ((static_cast<uint64_t>(width) * height) >= kPngMinParallelPixels)
+    {
+        uint32_t thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+        strip_count = std::min({ thread_count, kPngMaxStripCount, std::max(height / kPngMinRowsPerStrip, 1u) });
+    }
+
+    uint32_t                          rows_per_strip = (height + strip_count - 1) / strip_count;
+    std::vector<std::vector<uint8_t>> strip_data(strip_count);
+    std::vector<uLong>                strip_adler(strip_count, 1);
+    std::vector<char>                 strip_success(strip_count, 0);
+    std::vector<std::thread>          threads;
+    auto                              bytes = reinterpret_cast<const uint8_t*>(data);
+
+    auto compress = [&](uint32_t strip) {
+        uint32_t first_row  = strip * rows_per_strip;
+        uint32_t row_count  = std::min(rows_per_strip, height - first_row);
+        bool     last_strip = ((strip + 1) == strip_count);
+        strip_success[strip] = static_cast<char>(CompressPngStrip(
+            bytes, width, first_row, row_count, last_strip, &strip_data[strip], &strip_adler[strip]));
+    };
+
+    for (uint32_t strip = 1; strip < strip_count; ++strip)
+    {
+        threads.emplace_back(compress, strip);
+    }
+
+    compress(0);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (std::find(strip_success.begin(), strip_success.end(), 0) != strip_success.end())
+    {
+        return false;
+    }
+
+    // Assemble the zlib stream from the strips, combining the strip checksums.
+    uLong  adler     = strip_adler[0];
+    size_t zlib_size = 2 + 4;
+
+    for (uint32_t strip = 0; strip < strip_count; ++strip)
+    {
+        if (strip > 0)
+        {
+            uint32_t first_row  = strip * rows_per_strip;
+            uint32_t row_count  = std::min(rows_per_strip, height - first_row);
+            z_off_t  strip_size = static_cast<z_off_t>(row_count * (1 + (static_cast<size_t>(width) * 4)));
+            adler               = adler32_combine(adler, strip_adler[strip], strip_size);
+        }
+
+        zlib_size += strip_data[strip].size();
+    }
+
+    std::vector<uint8_t> zlib_data;
+    zlib_data.reserve(zlib_size);
+    zlib_data.push_back(0x78); // Deflate with a 32K window.
+    zlib_data.push_back(0x01); // Fastest compression level, with the header check bits.
+
+    for (const auto& strip : strip_data)
+    {
+        zlib_data.insert(zlib_data.end(), strip.begin(), strip.end());
+    }
+
+    uint8_t adler_bytes[4];
+    WriteBigEndian32(static_cast<uint32_t>(adler), adler_bytes);
+    zlib_data.insert(zlib_data.end(), adler_bytes, adler_bytes + 4);
+
+    uint8_t header[13];
+    WriteBigEndian32(width, &header[0]);
+    WriteBigEndian32(height, &header[4]);
+    header[8]  = 8; // Bit depth.
+    header[9]  = kPngColorTypeRgba;
+    header[10] = 0; // Compression method.
+    header[11] = 0; // Filter method.
+    header[12] = 0; // Interlace method.
+
+    bool    success = false;
+    FILE*   file    = nullptr;
+    int32_t result  = util::platform::FileOpen(&file, filename.c_str(), "wb");
+
+    if ((result == 0) && (file != nullptr))
+    {
+        success = (util::platform::FileWrite(kPngSignature, sizeof(kPngSignature), 1, file) == 1) &&
+                  WritePngChunk(file, "IHDR", header, sizeof(header)) &&
+                  WritePngChunk(file, "IDAT", zlib_data.data(), zlib_data.size()) &&
+                  WritePngChunk(file, "IEND", nullptr, 0) && !ferror(file);
+
+        util::platform::FileClose(file);
+    }
+
+    return success;
+}
+
+#else
+
+bool WritePngImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(filename);
+    GFXRECON_UNREFERENCED_PARAMETER(width);
+    GFXRECON_UNREFERENCED_PARAMETER(height);
+    GFXRECON_UNREFERENCED_PARAMETER(data_size);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    // PNG images require zlib.
+    return false;
+}
+
+#endif // ENABLE_ZLIB_COMPRESSION
+
+bool WriteQoiImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data)
+{
+    uint64_t pixel_count = static_cast<uint64_t>(height) * width;
+
+    if ((width == 0) || (height == 0) || ((pixel_count * kBmpBpp) > data_size))
+    {
+        return false;
+    }
+
+    // Worst case output is five bytes per pixel.  QOI encodes each pixel relative to the preceding pixels, so the
+    // encoder is sequential.
+    std::vector<uint8_t> output(kQoiHeaderSize + (pixel_count * 5) + sizeof(kQoiEndMarker));
+    std::vector<uint8_t> row(static_cast<size_t>(width) * 4);
+    uint8_t*             out = output.data();
+
+    std::memcpy(out, "qoif", 4);
+    WriteBigEndian32(width, out + 4);
+    WriteBigEndian32(height, out + 8);
+    out[12] = 4; // RGBA channels.
+    out[13] = 0; // sRGB with linear alpha.
+    out += kQoiHeaderSize;
+
+    uint8_t  index[64][4] = {};
+    uint8_t  previous[4]  = { 0, 0, 0, 0xff };
+    uint32_t run          = 0;
+    auto     bytes        = reinterpret_cast<const uint8_t*>(data);
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+        ConvertBgraToOpaqueRgba(bytes + (static_cast<size_t>(y) * width * 4), width, row.data());
+
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            const uint8_t* pixel = &row[x * 4];
+
+            if (std::memcmp(pixel, previous, 4) == 0)
+            {
+                ++run;
+                if (run == kQoiMaxRun)
+                {
+                    *out++ = static_cast<uint8_t>(kQoiOpRun | (run - 1));
+                    run    = 0;
+                }
+                continue;
+            }
+
+            if (run > 0)
+            {
+                *out++ = static_cast<uint8_t>(kQoiOpRun | (run - 1));
+                run    = 0;
+            }
+
+            uint32_t hash = ((pixel[0] * 3) + (pixel[1] * 5) + (pixel[2] * 7) + (pixel[3] * 11)) % 64;
+
+            if (std::memcmp(index[hash], pixel, 4) == 0)
+            {
+                *out++ = static_cast<uint8_t>(kQoiOpIndex | hash);
+            }
+            else
+            {
+                std::memcpy(index[hash], pixel, 4);
+
+                if (pixel[3] == previous[3])
+                {
+                    int8_t dr   = static_cast<int8_t>(pixel[0] - previous[0]);
+                    int8_t dg   = static_cast<int8_t>(pixel[1] - previous[1]);
+                    int8_t db   = static_cast<int8_t>(pixel[2] - previous[2]);
+                    int8_t dr_g = static_cast<int8_t>(dr - dg);
+                    int8_t db_g = static_cast<int8_t>(db - dg);
+
+                    if ((dr >= -2) && (dr <= 1) && (dg >= -2) && (dg <= 1) && (db >= -2) && (db <= 1))
+                    {
+                        *out++ = static_cast<uint8_t>(kQoiOpDiff | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2));
+                    }
+                    else if ((dg >= -32) && (dg <= 31) && (dr_g >= -8) && (dr_g <= 7) && (db_g >= -8) && (db_g <= 7))
+                    {
+                        *out++ = static_cast<uint8_t>(kQoiOpLuma | (dg + 32));
+                        *out++ = static_cast<uint8_t>(((dr_g + 8) << 4) | (db_g + 8));
+                    }
+                    else
+                    {
+                        *out++ = kQoiOpRgb;
+                        *out++ = pixel[0];
+                        *out++ = pixel[1];
+                        *out++ = pixel[2];
+                    }
+                }
+                else
+                {
+                    *out++ = kQoiOpRgba;
+                    std::memcpy(out, pixel, 4);
+                    out += 4;
+                }
+            }
+
+            std::memcpy(previous, pixel, 4);
+        }
+    }
+
+    if (run > 0)
+    {
+        *out++ = static_cast<uint8_t>(kQoiOpRun | (run - 1));
+    }
+
+    std::memcpy(out, kQoiEndMarker, sizeof(kQoiEndMarker));
+    out += sizeof(kQoiEndMarker);
+
+    bool    success = false;
+    FILE*   file    = nullptr;
+    int32_t result  = util::platform::FileOpen(&file, filename.c_str(), "wb");
+
+    if ((result == 0) && (file != nullptr))
+    {
+        size_t size = out - output.data();
+        success     = (util::platform::FileWrite(output.data(), size, 1, file) == 1) && !ferror(file);
+
+        util::platform::FileClose(file);
+    }
+
+    return success;
+}
+
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
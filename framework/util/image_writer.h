@@ -60,8 +60,17 @@ struct BmpInfoHeader
 
 #pragma pack(pop)
 
+// The image writers expect tightly packed 32-bit BGRA image data, with rows ordered from top to bottom.
+
 bool WriteBmpImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data);
 
+// Writes an opaque 8-bit RGBA PNG image, compressed with the fastest zlib level.  Large images are split into strips
+// that are compressed by multiple threads.  Fails when zlib support is not enabled.
+bool WritePngImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data);
+
+// Writes an opaque RGBA image in the lossless QOI format, which encodes faster than PNG with a moderately larger file.
+bool WriteQoiImage(const std::string& filename, uint32_t width, uint32_t height, uint64_t data_size, const void* data);
+
 GFXRECON_END_NAMESPACE(imagewriter)
 GFXRECON_END_NAMESPACE(util)
 GFXRECON_END_NAMESPACE(gfxrecon)
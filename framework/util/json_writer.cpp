@@ -0,0 +1,190 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/json_writer.h"
+
+#include "util/platform.h"
+
+#include <cassert>
+#include <cmath>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Space required for an escaped character, which may be written as a UTF-16 surrogate pair.
+const size_t kMaxEscapedCharSize = 12;
+
+const char kHexDigits[] = "0123456789abcdef";
+
+JsonWriter::JsonWriter(FILE* file, size_t buffer_size) :
+    file_(file), buffer_(std::make_unique<char[]>(buffer_size)), capacity_(buffer_size), size_(0),
+    need_separator_(false), write_error_(false)
+{
+    assert(buffer_size >= kMaxNumberSize);
+}
+
+JsonWriter::~JsonWriter()
+{
+    Flush();
+}
+
+void JsonWriter::SetFile(FILE* file)
+{
+    Flush();
+
+    file_           = file;
+    need_separator_ = false;
+}
+
+bool JsonWriter::Flush()
+{
+    bool success = true;
+
+    if (size_ > 0)
+    {
+        success = (file_ != nullptr) && (platform::FileWrite(buffer_.get(), 1, size_, file_) == size_);
+
+        if (!success)
+        {
+            write_error_ = true;
+        }
+    }
+
+    size_ = 0;
+
+    return success;
+}
+
+void JsonWriter::Float(float value)
+{
+    if (std::isfinite(value))
+    {
+        BeginValue(kMaxNumberSize);
+        size_ += snprintf(&buffer_[size_], kMaxNumberSize - 1, "%.9g", value);
+    }
+    else
+    {
+        String(std::isnan(value) ? "nan" : ((value < 0) ? "-inf" : "inf"));
+    }
+}
+
+void JsonWriter::Double(double value)
+{
+    if (std::isfinite(value))
+    {
+        BeginValue(kMaxNumberSize);
+        size_ += snprintf(&buffer_[size_], kMaxNumberSize - 1, "%.17g", value);
+    }
+    else
+    {
+        String(std::isnan(value) ? "nan" : ((value < 0) ? "-inf" : "inf"));
+    }
+}
+
+void JsonWriter::String(const char* value)
+{
+    BeginValue(kMaxCharSize);
+    buffer_[size_++] = '"';
+
+    for (const char* c = value; *c != '\0'; ++c)
+    {
+        uint8_t byte = static_cast<uint8_t>(*c);
+
+        Reserve(kMaxEscapedCharSize);
+
+        if (byte < 0x80)
+        {
+            WriteEscapedChar(byte);
+        }
+        else
+        {
+            // Multi-byte UTF-8 sequences are copied without modification.
+            buffer_[size_++] = *c;
+        }
+    }
+
+    Reserve(kMaxCharSize);
+    buffer_[size_++] = '"';
+}
+
+void JsonWriter::String(const wchar_t* value)
+{
+    BeginValue(kMaxCharSize);
+    buffer_[size_++] = '"';
+
+    for (const wchar_t* c = value; *c != L'\0'; ++c)
+    {
+        Reserve(kMaxEscapedCharSize);
+        WriteEscapedChar(static_cast<uint32_t>(*c));
+    }
+
+    Reserve(kMaxCharSize);
+    buffer_[size_++] = '"';
+}
+
+void JsonWriter::HexString(const uint8_t* data, size_t size)
+{
+    BeginValue(kMaxCharSize);
+    buffer_[size_++] = '"';
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        Reserve(kMaxCharSize);
+        buffer_[size_++] = kHexDigits[data[i] >> 4];
+        buffer_[size_++] = kHexDigits[data[i] & 0xf];
+    }
+
+    Reserve(kMaxCharSize);
+    buffer_[size_++] = '"';
+}
+
+void JsonWriter::WriteEscapedChar(uint32_t c)
+{
+    if ((c >= 0x20) && (c < 0x80) && (c != '"') && (c != '\\'))
+    {
+        buffer_[size_++] = static_cast<char>(c);
+    }
+    else if ((c == '"') || (c == '\\'))
+    {
+        buffer_[size_++] = '\\';
+        buffer_[size_++] = static_cast<char>(c);
+    }
+    else if (c > 0xffff)
+    {
+        // Characters outside of the basic multilingual plane are written as a UTF-16 surrogate pair.
+        c -= 0x10000;
+        WriteEscapedChar(0xd800 + (c >> 10));
+        WriteEscapedChar(0xdc00 + (c & 0x3ff));
+    }
+    else
+    {
+        buffer_[size_++] = '\\';
+        buffer_[size_++] = 'u';
+        buffer_[size_++] = kHexDigits[(c >> 12) & 0xf];
+        buffer_[size_++] = kHexDigits[(c >> 8) & 0xf];
+        buffer_[size_++] = kHexDigits[(c >> 4) & 0xf];
+        buffer_[size_++] = kHexDigits[c & 0xf];
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,217 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_JSON_WRITER_H
+#define GFXRECON_UTIL_JSON_WRITER_H
+
+#include "util/defines.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Formats JSON text into a fixed size buffer, which is written to a file when it fills.  Values are formatted directly
+// into the buffer, so writing a value does not allocate memory or make a library call.  Separators are inserted
+// automatically: a comma is written before each object member or array element that follows another.
+class JsonWriter
+{
+  public:
+    static const size_t kDefaultBufferSize = 256 * 1024;
+
+  public:
+    JsonWriter(FILE* file = nullptr, size_t buffer_size = kDefaultBufferSize);
+
+    ~JsonWriter();
+
+    // Flushes any buffered text to the current file before switching to the new file.
+    void SetFile(FILE* file);
+
+    FILE* GetFile() const { return file_; }
+
+    // Writes the buffered text to the file.  Returns false if the write failed or if there was buffered text with no
+    // file to write it to, which also sets the write error flag.  The buffered text is discarded in either case.
+    bool Flush();
+
+    // Returns true if any write to the file has failed, which means that text has been lost from the output.  The error
+    // is not cleared by later successful writes.
+    bool HasWriteError() const { return write_error_; }
+
+    void BeginObject()
+    {
+        BeginValue(kMaxCharSize);
+        buffer_[size_++] = '{';
+        need_separator_  = false;
+    }
+
+    void EndObject()
+    {
+        Reserve(kMaxCharSize);
+        buffer_[size_++] = '}';
+        need_separator_  = true;
+    }
+
+    void BeginArray()
+    {
+        BeginValue(kMaxCharSize);
+        buffer_[size_++] = '[';
+        need_separator_  = false;
+    }
+
+    void EndArray()
+    {
+        Reserve(kMaxCharSize);
+        buffer_[size_++] = ']';
+        need_separator_  = true;
+    }
+
+    // Writes an object member name, which must not require escaping.  The member value is written by the next call.
+    void Key(const char* key)
+    {
+        size_t length = std::strlen(key);
+
+        // Space for the separator, the quoted key, and the colon.
+        BeginValue(length + 4);
+        buffer_[size_++] = '"';
+        std::memcpy(&buffer_[size_], key, length);
+        size_ += length;
+        buffer_[size_++] = '"';
+        buffer_[size_++] = ':';
+        need_separator_  = false;
+    }
+
+    void Null() { WriteLiteral("null", 4); }
+
+    void Bool(bool value) { value ? WriteLiteral("true", 4) : WriteLiteral("false", 5); }
+
+    void Int(int64_t value)
+    {
+        BeginValue(kMaxNumberSize);
+
+        uint64_t magnitude = static_cast<uint64_t>(value);
+        if (value < 0)
+        {
+            buffer_[size_++] = '-';
+            magnitude        = 0 - magnitude;
+        }
+
+        WriteDigits(magnitude);
+    }
+
+    void UInt(uint64_t value)
+    {
+        BeginValue(kMaxNumberSize);
+        WriteDigits(value);
+    }
+
+    // Writes with enough precision to reproduce the value.  JSON has no representation for infinity or NaN, which are
+    // written as strings.
+    void Float(float value);
+
+    void Double(double value);
+
+    void String(const char* value);
+
+    void String(const wchar_t* value);
+
+    // Writes binary data as a string of hexadecimal digits, which is more compact than an array of numbers.
+    void HexString(const uint8_t* data, size_t size);
+
+    // Ends a line of JSON-lines output, after a top level value.
+    void EndLine()
+    {
+        Reserve(kMaxCharSize);
+        buffer_[size_++] = '\n';
+        need_separator_  = false;
+    }
+
+  private:
+    // Space required for the separator and a formatted number.
+    static const size_t kMaxNumberSize = 32;
+
+    // Space required for the separator and a character.
+    static const size_t kMaxCharSize = 2;
+
+  private:
+    // Flushes the buffer when it cannot hold the requested size.  A failed flush is recorded by the write error flag.
+    void Reserve(size_t size)
+    {
+        if ((size_ + size) > capacity_)
+        {
+            Flush();
+        }
+    }
+
+    void BeginValue(size_t size)
+    {
+        Reserve(size);
+
+        if (need_separator_)
+        {
+            buffer_[size_++] = ',';
+        }
+
+        need_separator_ = true;
+    }
+
+    void WriteLiteral(const char* literal, size_t length)
+    {
+        BeginValue(length + 1);
+        std::memcpy(&buffer_[size_], literal, length);
+        size_ += length;
+    }
+
+    void WriteDigits(uint64_t value)
+    {
+        char   digits[20];
+        size_t count = 0;
+
+        do
+        {
+            digits[count++] = static_cast<char>('0' + (value % 10));
+            value /= 10;
+        } while (value != 0);
+
+        while (count > 0)
+        {
+            buffer_[size_++] = digits[--count];
+        }
+    }
+
+    void WriteEscapedChar(uint32_t c);
+
+  private:
+    FILE*                   file_;
+    std::unique_ptr<char[]> buffer_;
+    size_t                  capacity_;
+    size_t                  size_;
+    bool                    need_separator_;
+    bool                    write_error_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_JSON_WRITER_H
@@ -0,0 +1,317 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/local_socket.h"
+
+#include "util/logging.h"
+
+#if !defined(WIN32)
+#include <cerrno>
+#include <csignal>
+#include <cstring>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(localsocket)
+
+bool IsSocketPath(const std::string& path)
+{
+    return (path.compare(0, sizeof(kPathPrefix) - 1, kPathPrefix) == 0);
+}
+
+std::string GetSocketPath(const std::string& path)
+{
+    if (IsSocketPath(path))
+    {
+        return path.substr(sizeof(kPathPrefix) - 1);
+    }
+
+    return path;
+}
+
+#if defined(WIN32)
+
+int Connect(const std::string& socket_path)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(socket_path);
+    GFXRECON_LOG_ERROR("Unix domain socket streams are not supported on this platform");
+    return kInvalidSocket;
+}
+
+FILE* AcceptStream(const std::string& socket_path)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(socket_path);
+    GFXRECON_LOG_ERROR("Unix domain socket streams are not supported on this platform");
+    return nullptr;
+}
+
+bool Send(int socket, const void* data, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(socket);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    return false;
+}
+
+int OpenPipe(const std::string& pipe_path)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pipe_path);
+    GFXRECON_LOG_ERROR("Named pipe streams are not supported on this platform");
+    return kInvalidSocket;
+}
+
+bool WritePipe(int pipe, const void* data, size_t size)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pipe);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    return false;
+}
+
+void Close(int socket)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(socket);
+}
+
+#else
+
+static bool InitAddress(const std::string& socket_path, sockaddr_un* address)
+{
+    if (socket_path.empty() || (socket_path.length() >= sizeof(address->sun_path)))
+    {
+        GFXRECON_LOG_ERROR("Invalid Unix domain socket path \"%s\"", socket_path.c_str());
+        return false;
+    }
+
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    memcpy(address->sun_path, socket_path.c_str(), socket_path.length());
+
+    return true;
+}
+
+int Connect(const std::string& socket_path)
+{
+    sockaddr_un address;
+    if (!InitAddress(socket_path, &address))
+    {
+        return kInvalidSocket;
+    }
+
+    int socket_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (socket_fd == kInvalidSocket)
+    {
+        GFXRECON_LOG_ERROR("Failed to create socket (errno = %d)", errno);
+        return kInvalidSocket;
+    }
+
+#if defined(__APPLE__)
+    // Report a closed connection as an error from send(), instead of raising SIGPIPE in the application.
+    int no_sigpipe = 1;
+    setsockopt(socket_fd, SOL_SOCKET, SO_NOSIGPIPE, &no_sigpipe, sizeof(no_sigpipe));
+#endif
+
+    if (connect(socket_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to connect to socket %s (errno = %d)", socket_path.c_str(), errno);
+        close(socket_fd);
+        return kInvalidSocket;
+    }
+
+    return socket_fd;
+}
+
+FILE* AcceptStream(const std::string& socket_path)
+{
+    sockaddr_un address;
+    if (!InitAddress(socket_path, &address))
+    {
+        return nullptr;
+    }
+
+    int listen_fd = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd == kInvalidSocket)
+    {
+        GFXRECON_LOG_ERROR("Failed to create socket (errno = %d)", errno);
+        return nullptr;
+    }
+
+    // Remove a socket file left behind by a previous session that did not receive a connection.
+    unlink(socket_path.c_str());
+
+    if ((bind(listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) != 0) || (listen(listen_fd, 1) != 0))
+    {
+        GFXRECON_LOG_ERROR("Failed to listen on socket %s (errno = %d)", socket_path.c_str(), errno);
+        close(listen_fd);
+        return nullptr;
+    }
+
+    GFXRECON_LOG_INFO("Waiting for capture stream connection on %s", socket_path.c_str());
+
+    int socket_fd = kInvalidSocket;
+    do
+    {
+        socket_fd = accept(listen_fd, nullptr, nullptr);
+    } while ((socket_fd == kInvalidSocket) && (errno == EINTR));
+
+    close(listen_fd);
+    unlink(socket_path.c_str());
+
+    if (socket_fd == kInvalidSocket)
+    {
+        GFXRECON_LOG_ERROR("Failed to accept connection on socket %s (errno = %d)", socket_path.c_str(), errno);
+        return nullptr;
+    }
+
+    FILE* stream = fdopen(socket_fd, "rb");
+    if (stream == nullptr)
+    {
+        close(socket_fd);
+    }
+
+    return stream;
+}
+
+bool Send(int socket, const void* data, size_t size)
+{
+#if defined(MSG_NOSIGNAL)
+    const int kFlags = MSG_NOSIGNAL;
+#else
+    const int kFlags = 0;
+#endif
+
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
+
+    while (size > 0)
+    {
+        ssize_t sent = send(socket, bytes, size, kFlags);
+
+        if (sent < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            return false;
+        }
+
+        bytes += sent;
+        size -= static_cast<size_t>(sent);
+    }
+
+    return true;
+}
+
+int OpenPipe(const std::string& pipe_path)
+{
+    int pipe_fd = kInvalidSocket;
+    do
+    {
+        pipe_fd = open(pipe_path.c_str(), O_WRONLY);
+    } while ((pipe_fd == kInvalidSocket) && (errno == EINTR));
+
+    if (pipe_fd == kInvalidSocket)
+    {
+        GFXRECON_LOG_ERROR("Failed to open named pipe %s (errno = %d)", pipe_path.c_str(), errno);
+        return kInvalidSocket;
+    }
+
+#if defined(__APPLE__)
+    // Report a closed pipe as an error from write(), instead of raising SIGPIPE in the application.
+    fcntl(pipe_fd, F_SETNOSIGPIPE, 1);
+#endif
+
+    return pipe_fd;
+}
+
+bool WritePipe(int pipe, const void* data, size_t size)
+{
+    const uint8_t* bytes   = reinterpret_cast<const uint8_t*>(data);
+    bool           success = true;
+
+#if !defined(__APPLE__)
+    sigset_t sigpipe_set;
+    sigset_t previous_set;
+    sigset_t pending_set;
+
+    sigemptyset(&sigpipe_set);
+    sigaddset(&sigpipe_set, SIGPIPE);
+    pthread_sigmask(SIG_BLOCK, &sigpipe_set, &previous_set);
+
+    // A SIGPIPE that was already pending for the thread belongs to the application and must not be consumed.
+    sigpending(&pending_set);
+    bool sigpipe_pending = (sigismember(&pending_set, SIGPIPE) == 1);
+#endif
+
+    while (size > 0)
+    {
+        ssize_t written = write(pipe, bytes, size);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+
+            success = false;
+            break;
+        }
+
+        bytes += written;
+        size -= static_cast<size_t>(written);
+    }
+
+#if !defined(__APPLE__)
+    if (!success && (errno == EPIPE) && !sigpipe_pending)
+    {
+        // Consume the SIGPIPE raised by the failed write before restoring the signal mask.
+        const struct timespec kNoWait = { 0, 0 };
+        sigtimedwait(&sigpipe_set, nullptr, &kNoWait);
+    }
+
+    pthread_sigmask(SIG_SETMASK, &previous_set, nullptr);
+#endif
+
+    return success;
+}
+
+void Close(int socket)
+{
+    if (socket != kInvalidSocket)
+    {
+        close(socket);
+    }
+}
+
+#endif
+
+GFXRECON_END_NAMESPACE(localsocket)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,72 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_LOCAL_SOCKET_H
+#define GFXRECON_UTIL_LOCAL_SOCKET_H
+
+#include "util/defines.h"
+
+#include <cstdio>
+#include <string>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(localsocket)
+
+// Capture file names with this prefix specify the path of a Unix domain socket, which is used to stream the capture to
+// another process instead of writing it to a file.
+const char kPathPrefix[] = "unix:";
+
+const int kInvalidSocket = -1;
+
+bool IsSocketPath(const std::string& path);
+
+// Returns the socket path with the "unix:" prefix removed.
+std::string GetSocketPath(const std::string& path);
+
+// Connects to a stream socket that is listening at the specified path.  Returns kInvalidSocket on failure.
+int Connect(const std::string& socket_path);
+
+// Creates a stream socket at the specified path and waits for a single connection.  The socket file is removed once
+// the connection has been accepted.  Returns a read-only FILE stream for the connection, or nullptr on failure.
+FILE* AcceptStream(const std::string& socket_path);
+
+// Sends all of the data, blocking while the receiver is not consuming data fast enough to make room in the socket
+// buffer.  Returns false if the connection has been closed by the receiver or an error occurred.
+bool Send(int socket, const void* data, size_t size);
+
+// Opens a named pipe for writing, blocking until another process opens the pipe for reading.  Returns kInvalidSocket
+// on failure.
+int OpenPipe(const std::string& pipe_path);
+
+// Writes all of the data to a named pipe, blocking while the pipe is full.  Writing to a pipe that has no reader raises
+// SIGPIPE, which would terminate the application, so the signal is blocked for the calling thread during the write and
+// a closed pipe is reported as a failure.  Returns false if the reader has closed the pipe or an error occurred.
+bool WritePipe(int pipe, const void* data, size_t size);
+
+void Close(int socket);
+
+GFXRECON_END_NAMESPACE(localsocket)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_LOCAL_SOCKET_H
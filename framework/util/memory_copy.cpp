@@ -0,0 +1,87 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/memory_copy.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define GFXRECON_MEMORY_COPY_SSE2
+#endif
+
+#include <cstdint>
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+GFXRECON_BEGIN_NAMESPACE(memorycopy)
+
+#if defined(GFXRECON_MEMORY_COPY_SSE2)
+// Copies smaller than this are left to memcpy, as the fence that completes the streaming stores costs more than the
+// cache pollution it avoids.
+const size_t kMinNonTemporalCopySize = 4096;
+#endif
+
+void NonTemporalCopy(void* destination, const void* source, size_t size)
+{
+#if defined(GFXRECON_MEMORY_COPY_SSE2)
+    if (size >= kMinNonTemporalCopySize)
+    {
+        auto dst = static_cast<uint8_t*>(destination);
+        auto src = static_cast<const uint8_t*>(source);
+
+        // Streaming stores require a 16-byte aligned destination.
+        size_t head_size = (16 - (reinterpret_cast<uintptr_t>(dst) & 15)) & 15;
+        if (head_size > 0)
+        {
+            std::memcpy(dst, src, head_size);
+            dst += head_size;
+            src += head_size;
+            size -= head_size;
+        }
+
+        // Write a full cache line per iteration, so that each line is combined into a single write.
+        for (; size >= 64; size -= 64, dst += 64, src += 64)
+        {
+            __m128i data0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+            __m128i data1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+            __m128i data2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+            __m128i data3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst), data0);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16), data1);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32), data2);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48), data3);
+        }
+
+        // Order the streaming stores before any following stores, such as a flush of the mapped range.
+        _mm_sfence();
+
+        destination = dst;
+        source      = src;
+    }
+#endif
+
+    std::memcpy(destination, source, size);
+}
+
+GFXRECON_END_NAMESPACE(memorycopy)
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
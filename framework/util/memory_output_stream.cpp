@@ -25,33 +25,27 @@
 
 #include "util/platform.h"
 
+#include <algorithm>
+
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-MemoryOutputStream::MemoryOutputStream()
-{
-    buffer_.reserve(kDefaultBufferSize);
-}
+MemoryOutputStream::MemoryOutputStream() : buffer_(kDefaultBufferSize), size_(0) {}
 
-MemoryOutputStream::MemoryOutputStream(size_t initial_size)
-{
-    buffer_.reserve(initial_size);
-}
+MemoryOutputStream::MemoryOutputStream(size_t initial_size) : buffer_(initial_size), size_(0) {}
 
-MemoryOutputStream::MemoryOutputStream(const void* initial_data, size_t initial_data_size)
+MemoryOutputStream::MemoryOutputStream(const void* initial_data, size_t initial_data_size) : size_(initial_data_size)
 {
     const uint8_t* bytes = reinterpret_cast<const uint8_t*>(initial_data);
-    buffer_.insert(buffer_.end(), bytes, bytes + initial_data_size);
+    buffer_.assign(bytes, bytes + initial_data_size);
 }
 
 MemoryOutputStream::~MemoryOutputStream() {}
 
-size_t MemoryOutputStream::Write(const void* data, size_t len)
+void MemoryOutputStream::Grow(size_t required_size)
 {
-    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(data);
-    buffer_.insert(buffer_.end(), bytes, bytes + len);
-
-    return len;
+    // Grow geometrically, so that the cost of growth is amortized over the calls that reuse the buffer.
+    buffer_.resize(std::max(required_size, buffer_.size() * 2));
 }
 
 GFXRECON_END_NAMESPACE(util)
@@ -28,12 +28,15 @@
 #include "util/output_stream.h"
 
 #include <cstdint>
+#include <cstring>
 #include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
 
-class MemoryOutputStream : public OutputStream
+// Bump-pointer output buffer for API call parameter encoding.  The class is final and the write path is defined inline,
+// so that writes made through a MemoryOutputStream pointer are devirtualized and reduce to a capacity check and a copy.
+class MemoryOutputStream final : public OutputStream
 {
   public:
     const size_t kDefaultBufferSize = 512;
@@ -49,16 +52,36 @@ class MemoryOutputStream : public OutputStream
 
     virtual bool IsValid() override { return true; }
 
-    virtual void Reset() override { buffer_.clear(); };
+    virtual void Reset() override { size_ = 0; };
 
-    virtual size_t Write(const void* data, size_t len) override;
+    virtual size_t Write(const void* data, size_t len) override
+    {
+        Reserve(len);
+        std::memcpy(buffer_.data() + size_, data, len);
+        size_ += len;
+
+        return len;
+    }
+
+    // Ensures that len bytes can be written without reallocating the buffer.
+    void Reserve(size_t len)
+    {
+        if ((size_ + len) > buffer_.size())
+        {
+            Grow(size_ + len);
+        }
+    }
 
     const uint8_t* GetData() const { return buffer_.data(); }
 
-    size_t GetDataSize() const { return buffer_.size(); }
+    size_t GetDataSize() const { return size_; }
+
+  private:
+    void Grow(size_t required_size);
 
   private:
-    std::vector<uint8_t> buffer_;
+    std::vector<uint8_t> buffer_; // Buffer storage; the vector's size is the buffer capacity.
+    size_t               size_;   // Number of bytes written to the buffer.
 };
 
 GFXRECON_END_NAMESPACE(util)
@@ -27,6 +27,7 @@
 #include "util/defines.h"
 
 #include <cstddef>
+#include <cstdint>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 GFXRECON_BEGIN_NAMESPACE(util)
@@ -43,6 +44,9 @@ class OutputStream
     virtual size_t Write(const void* data, size_t len) = 0;
 
     virtual void Flush() {}
+
+    // Total number of bytes written to the stream, for streams that track it.
+    virtual uint64_t GetBytesWritten() { return 0; }
 };
 
 GFXRECON_END_NAMESPACE(util)
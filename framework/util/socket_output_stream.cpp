@@ -0,0 +1,101 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/socket_output_stream.h"
+
+#include "util/logging.h"
+
+#include <cstring>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+SocketOutputStream::SocketOutputStream(const std::string& socket_path, bool named_pipe, size_t buffer_size) :
+    socket_path_(socket_path), named_pipe_(named_pipe),
+    socket_(named_pipe ? localsocket::OpenPipe(socket_path) : localsocket::Connect(socket_path)), buffer_(buffer_size),
+    buffer_size_(0), bytes_written_(0)
+{}
+
+SocketOutputStream::~SocketOutputStream()
+{
+    Flush();
+    localsocket::Close(socket_);
+}
+
+size_t SocketOutputStream::Write(const void* data, size_t len)
+{
+    if (socket_ == localsocket::kInvalidSocket)
+    {
+        return 0;
+    }
+
+    if ((buffer_size_ + len) > buffer_.size())
+    {
+        Flush();
+    }
+
+    if (len >= buffer_.size())
+    {
+        // Send large writes directly, instead of copying them through the buffer.
+        if (!Send(data, len))
+        {
+            return 0;
+        }
+    }
+    else
+    {
+        memcpy(buffer_.data() + buffer_size_, data, len);
+        buffer_size_ += len;
+    }
+
+    bytes_written_ += len;
+
+    return len;
+}
+
+void SocketOutputStream::Flush()
+{
+    if ((socket_ != localsocket::kInvalidSocket) && (buffer_size_ > 0))
+    {
+        Send(buffer_.data(), buffer_size_);
+        buffer_size_ = 0;
+    }
+}
+
+bool SocketOutputStream::Send(const void* data, size_t len)
+{
+    bool success = named_pipe_ ? localsocket::WritePipe(socket_, data, len) : localsocket::Send(socket_, data, len);
+
+    if (!success)
+    {
+        GFXRECON_LOG_ERROR("Capture stream connection to %s was closed; no further data will be streamed",
+                           socket_path_.c_str());
+        localsocket::Close(socket_);
+        socket_ = localsocket::kInvalidSocket;
+        return false;
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,77 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_SOCKET_OUTPUT_STREAM_H
+#define GFXRECON_UTIL_SOCKET_OUTPUT_STREAM_H
+
+#include "util/defines.h"
+#include "util/local_socket.h"
+#include "util/output_stream.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Output stream that sends data to another process through a Unix domain socket or a named pipe, so that the capture
+// can be processed while it is being recorded.  Small writes are accumulated in a buffer that is sent when full or on
+// Flush().  Sends block while the receiving process is not keeping up, which limits the amount of unconsumed data to
+// the socket or pipe buffer size.  The stream becomes invalid if the receiving process closes the connection.
+class SocketOutputStream : public OutputStream
+{
+  public:
+    static const size_t kDefaultBufferSize = 256 * 1024;
+
+  public:
+    // When named_pipe is true, the path specifies a named pipe instead of a socket.
+    SocketOutputStream(const std::string& socket_path,
+                       bool               named_pipe  = false,
+                       size_t             buffer_size = kDefaultBufferSize);
+
+    virtual ~SocketOutputStream() override;
+
+    virtual bool IsValid() override { return (socket_ != localsocket::kInvalidSocket); }
+
+    virtual size_t Write(const void* data, size_t len) override;
+
+    virtual void Flush() override;
+
+    virtual uint64_t GetBytesWritten() override { return bytes_written_; }
+
+  private:
+    bool Send(const void* data, size_t len);
+
+  private:
+    std::string          socket_path_;
+    bool                 named_pipe_;
+    int                  socket_;
+    std::vector<uint8_t> buffer_;
+    size_t               buffer_size_; // Size of the data currently held by the buffer.
+    uint64_t             bytes_written_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_SOCKET_OUTPUT_STREAM_H
@@ -0,0 +1,112 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "util/thread_pool.h"
+
+#include <algorithm>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+ThreadPool::ThreadPool(size_t thread_count) : active_count_(0), exit_(false)
+{
+    if (thread_count == 0)
+    {
+        // hardware_concurrency() may return 0 when the value is not computable.
+        size_t hardware_threads = static_cast<size_t>(std::thread::hardware_concurrency());
+        thread_count            = std::max<size_t>(hardware_threads, 2) - 1;
+    }
+
+    threads_.reserve(thread_count);
+
+    for (size_t i = 0; i < thread_count; ++i)
+    {
+        threads_.emplace_back(&ThreadPool::ProcessTasks, this);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        exit_ = true;
+    }
+
+    task_condition_.notify_all();
+
+    for (auto& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void ThreadPool::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+    idle_condition_.wait(lock, [this]() { return tasks_.empty() && (active_count_ == 0); });
+}
+
+void ThreadPool::Post(std::function<void()> task)
+{
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        tasks_.emplace_back(std::move(task));
+    }
+
+    task_condition_.notify_one();
+}
+
+void ThreadPool::ProcessTasks()
+{
+    std::unique_lock<std::mutex> lock(lock_);
+
+    for (;;)
+    {
+        task_condition_.wait(lock, [this]() { return !tasks_.empty() || exit_; });
+
+        if (tasks_.empty())
+        {
+            // Exit was requested and all queued tasks have been processed.
+            break;
+        }
+
+        std::function<void()> task = std::move(tasks_.front());
+        tasks_.pop_front();
+        ++active_count_;
+
+        lock.unlock();
+
+        // Tasks are expected to be wrapped by std::packaged_task, which captures exceptions in the task's future.
+        task();
+
+        lock.lock();
+        --active_count_;
+
+        if (tasks_.empty() && (active_count_ == 0))
+        {
+            idle_condition_.notify_all();
+        }
+    }
+}
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,88 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_UTIL_THREAD_POOL_H
+#define GFXRECON_UTIL_THREAD_POOL_H
+
+#include "util/defines.h"
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+GFXRECON_BEGIN_NAMESPACE(util)
+
+// Fixed size pool of worker threads that process tasks in submission order.
+class ThreadPool
+{
+  public:
+    // A thread count of zero creates one thread for each hardware thread, minus one for the calling thread.
+    ThreadPool(size_t thread_count = 0);
+
+    // Completes all submitted tasks before stopping the worker threads.
+    ~ThreadPool();
+
+    size_t GetThreadCount() const { return threads_.size(); }
+
+    // Queues a task for execution, returning a future that will hold the task's result or any exception thrown by the
+    // task.
+    template <typename Func>
+    std::future<typename std::result_of<Func()>::type> Submit(Func&& func)
+    {
+        typedef typename std::result_of<Func()>::type ResultType;
+
+        auto task   = std::make_shared<std::packaged_task<ResultType()>>(std::forward<Func>(func));
+        auto result = task->get_future();
+
+        Post([task]() { (*task)(); });
+
+        return result;
+    }
+
+    // Waits for all submitted tasks to complete.
+    void WaitIdle();
+
+  private:
+    void Post(std::function<void()> task);
+
+    void ProcessTasks();
+
+  private:
+    std::vector<std::thread>          threads_;
+    std::mutex                        lock_;
+    std::condition_variable           task_condition_;
+    std::condition_variable           idle_condition_;
+    std::deque<std::function<void()>> tasks_;
+    size_t                            active_count_;
+    bool                              exit_;
+};
+
+GFXRECON_END_NAMESPACE(util)
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_UTIL_THREAD_POOL_H
@@ -113,6 +113,13 @@ class VulkanExtractConsumer : public gfxrecon::decode::VulkanConsumer
   public:
     VulkanExtractConsumer(std::string& extract_dir) : extract_dir_(extract_dir) {}
 
+    virtual bool IsApiCallOfInterest(gfxrecon::format::ApiCallId call_id) const override
+    {
+        return (call_id == gfxrecon::format::ApiCallId::ApiCall_vkCreateShaderModule);
+    }
+
+    virtual bool IsMetaDataOfInterest(gfxrecon::format::MetaDataType) const override { return false; }
+
     virtual void Process_vkCreateShaderModule(
         VkResult                                                                                    returnValue,
         gfxrecon::format::HandleId                                                                  shaderModule,
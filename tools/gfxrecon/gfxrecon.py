@@ -24,7 +24,7 @@
 # Utility for invoking gfxrecon commands
 # Usage:
 #
-#     gfxrecon.py [capture|compress|extract|info|optimize|replay] [<args>]
+#     gfxrecon.py [capture|compress|extract|info|optimize|replay|trim] [<args>]
 #
 #         args is a command-specific argument list
 
@@ -44,7 +44,8 @@ valid_commands = [
     'extract',
     'info',
     'optimize',
-    'replay'
+    'replay',
+    'trim'
 ]
 
 def IsWindows():
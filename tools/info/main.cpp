@@ -23,6 +23,7 @@
 #include "project_version.h"
 
 #include "decode/file_processor.h"
+#include "decode/parallel_file_processor.h"
 #include "format/format.h"
 #include "format/format_util.h"
 #include "generated/generated_vulkan_consumer.h"
@@ -32,9 +33,11 @@
 
 #include "vulkan/vulkan.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdlib>
 #include <limits>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -144,6 +147,77 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
         return nullptr;
     }
 
+    // Combines statistics gathered from a later section of the capture file.
+    void Merge(const VulkanStatsConsumer& other)
+    {
+        if (other.trimmed_frame_ != 0)
+        {
+            trimmed_frame_ = other.trimmed_frame_;
+        }
+
+        if (other.has_app_info_)
+        {
+            has_app_info_   = true;
+            app_name_       = other.app_name_;
+            app_version_    = other.app_version_;
+            engine_name_    = other.engine_name_;
+            engine_version_ = other.engine_version_;
+            api_version_    = other.api_version_;
+        }
+
+        used_physical_devices_.insert(other.used_physical_devices_.begin(), other.used_physical_devices_.end());
+
+        for (const auto& entry : other.physical_device_properties_)
+        {
+            physical_device_properties_[entry.first] = entry.second;
+        }
+
+        graphics_pipelines_ += other.graphics_pipelines_;
+        compute_pipelines_ += other.compute_pipelines_;
+        draw_count_ += other.draw_count_;
+        dispatch_count_ += other.dispatch_count_;
+        allocation_count_ += other.allocation_count_;
+        min_allocation_size_ = std::min(min_allocation_size_, other.min_allocation_size_);
+        max_allocation_size_ = std::max(max_allocation_size_, other.max_allocation_size_);
+    }
+
+    // Only the calls processed for the statistics are decoded, and meta-data commands are skipped.
+    virtual bool IsApiCallOfInterest(gfxrecon::format::ApiCallId call_id) const override
+    {
+        switch (call_id)
+        {
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateInstance:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2:
+            case gfxrecon::format::ApiCallId::ApiCall_vkGetPhysicalDeviceProperties2KHR:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateDevice:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateGraphicsPipelines:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCreateComputePipelines:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDraw:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDispatch:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDispatchBase:
+            case gfxrecon::format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+            case gfxrecon::format::ApiCallId::ApiCall_vkAllocateMemory:
+                return true;
+            default:
+                return false;
+        }
+    }
+
+    virtual bool IsMetaDataOfInterest(gfxrecon::format::MetaDataType) const override { return false; }
+
     virtual void ProcessStateBeginMarker(uint64_t frame_number) override
     {
         // Theres should only be one of these in a capture file.
@@ -162,6 +236,8 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
             auto app_info    = create_info->pApplicationInfo;
             if (app_info != nullptr)
             {
+                has_app_info_ = true;
+
                 if (app_info->pApplicationName != nullptr)
                 {
                     app_name_ = app_info->pApplicationName;
@@ -414,6 +490,7 @@ class VulkanStatsConsumer : public gfxrecon::decode::VulkanConsumer
     uint32_t trimmed_frame_{ 0 };
 
     // Application info.
+    bool        has_app_info_{ false };
     std::string app_name_;
     uint32_t    app_version_{ 0 };
     std::string engine_name_;
@@ -468,18 +545,32 @@ int main(int argc, const char** argv)
     const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
     std::string                     input_filename       = positional_arguments[0];
 
-    gfxrecon::decode::FileProcessor file_processor;
+    gfxrecon::decode::ParallelFileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder decoder;
-        VulkanStatsConsumer             stats_consumer;
+        // Statistics are gathered for each chunk of the file with a separate decoder and consumer, on multiple threads,
+        // and are then combined in file order.
+        std::vector<std::unique_ptr<gfxrecon::decode::VulkanDecoder>> chunk_decoders;
+        std::vector<std::unique_ptr<VulkanStatsConsumer>>             chunk_consumers;
+        std::vector<gfxrecon::decode::ApiDecoder*>                    decoders;
+
+        for (size_t i = 0; i < file_processor.GetChunkCount(); ++i)
+        {
+            chunk_decoders.emplace_back(std::make_unique<gfxrecon::decode::VulkanDecoder>());
+            chunk_consumers.emplace_back(std::make_unique<VulkanStatsConsumer>());
+            chunk_decoders.back()->AddConsumer(chunk_consumers.back().get());
+            decoders.push_back(chunk_decoders.back().get());
+        }
 
-        decoder.AddConsumer(&stats_consumer);
+        file_processor.ProcessChunks(decoders);
 
-        file_processor.AddDecoder(&decoder);
-        file_processor.ProcessAllFrames();
+        VulkanStatsConsumer stats_consumer;
+        for (const auto& chunk_consumer : chunk_consumers)
+        {
+            stats_consumer.Merge(*chunk_consumer);
+        }
 
-        if ((file_processor.GetCurrentFrameNumber() > 0) &&
+        if ((file_processor.GetFrameCount() > 0) &&
             (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
         {
             GFXRECON_WRITE_CONSOLE("File info:");
@@ -509,7 +600,7 @@ int main(int argc, const char** argv)
 
             // Frame counts.
             uint32_t trim_start_frame = stats_consumer.GetTrimmedStartFrame();
-            uint32_t frame_count      = file_processor.GetCurrentFrameNumber();
+            uint32_t frame_count      = file_processor.GetFrameCount();
 
             if (trim_start_frame == 0)
             {
@@ -22,145 +22,220 @@
 
 #include "file_optimizer.h"
 
-#include "format/format_util.h"
+#include "format/format.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
 #include <cassert>
+#include <cinttypes>
+
+// The copy_file_range system call performs the copy in the kernel, and can share the data blocks between the files on
+// file systems that support reflinks.
+#if defined(__linux__) && !defined(__ANDROID__) && defined(__GLIBC__) && \
+    ((__GLIBC__ > 2) || ((__GLIBC__ == 2) && (__GLIBC_MINOR__ >= 27)))
+#define GFXRECON_OPTIMIZE_KERNEL_COPY
+#include <unistd.h>
+#endif
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
-FileOptimizer::FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids) :
-    unreferenced_ids_(unreferenced_ids)
-{}
+const size_t kCopyBufferSize    = 16 * 1024 * 1024;
+const size_t kMaxKernelCopySize = 1024 * 1024 * 1024;
 
-FileOptimizer::FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids) :
-    unreferenced_ids_(std::move(unreferenced_ids))
+FileOptimizer::FileOptimizer() :
+    input_file_(nullptr), output_file_(nullptr), input_file_size_(0), bytes_read_(0), bytes_written_(0),
+#if defined(GFXRECON_OPTIMIZE_KERNEL_COPY)
+    use_kernel_copy_(true)
+#else
+    use_kernel_copy_(false)
+#endif
 {}
 
-bool FileOptimizer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+FileOptimizer::~FileOptimizer()
 {
-    if (meta_type == format::MetaDataType::kInitBufferCommand)
+    if (input_file_ != nullptr)
     {
-        return FilterInitBufferMetaData(block_header, meta_type);
+        util::platform::FileClose(input_file_);
     }
-    else if (meta_type == format::MetaDataType::kInitImageCommand)
+
+    if (output_file_ != nullptr)
     {
-        return FilterInitImageMetaData(block_header, meta_type);
+        util::platform::FileClose(output_file_);
     }
-    else
+}
+
+bool FileOptimizer::Initialize(const std::string& input_filename, const std::string& output_filename)
+{
+    int32_t result = util::platform::FileOpen(&input_file_, input_filename.c_str(), "rb");
+
+    if ((result != 0) || (input_file_ == nullptr))
     {
-        // Copy the meta data block, if it was not filtered.
-        return FileTransformer::ProcessMetaData(block_header, meta_type);
+        GFXRECON_LOG_ERROR("Failed to open file %s", input_filename.c_str());
+        return false;
     }
+
+    if (!util::platform::FileSeek(input_file_, 0, util::platform::FileSeekEnd))
+    {
+        GFXRECON_LOG_ERROR("Failed to determine the size of file %s", input_filename.c_str());
+        return false;
+    }
+
+    input_file_size_ = static_cast<uint64_t>(util::platform::FileTell(input_file_));
+
+    result = util::platform::FileOpen(&output_file_, output_filename.c_str(), "wb");
+
+    if ((result != 0) || (output_file_ == nullptr))
+    {
+        GFXRECON_LOG_ERROR("Failed to open file %s", output_filename.c_str());
+        return false;
+    }
+
+    return true;
 }
 
-bool FileOptimizer::FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+bool FileOptimizer::Process(const std::vector<uint64_t>& omitted_block_offsets)
 {
-    assert(meta_type == format::MetaDataType::kInitBufferCommand);
+    assert((input_file_ != nullptr) && (output_file_ != nullptr));
 
-    format::InitBufferCommandHeader header;
+    for (uint64_t block_offset : omitted_block_offsets)
+    {
+        assert(block_offset >= bytes_read_);
 
-    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
-    success      = success && ReadBytes(&header.device_id, sizeof(header.device_id));
-    success      = success && ReadBytes(&header.buffer_id, sizeof(header.buffer_id));
-    success      = success && ReadBytes(&header.data_size, sizeof(header.data_size));
+        // Copy all blocks preceding the omitted block, then skip the omitted block.
+        if (!CopyBytes(block_offset - bytes_read_) || !SkipBlock(block_offset))
+        {
+            return false;
+        }
+    }
+
+    if (!CopyBytes(input_file_size_ - bytes_read_))
+    {
+        return false;
+    }
+
+    if (util::platform::FileFlush(output_file_) != 0)
+    {
+        GFXRECON_LOG_ERROR("Failed to flush the output file");
+        return false;
+    }
 
-    if (success)
+    return true;
+}
+
+bool FileOptimizer::CopyBytes(uint64_t copy_size)
+{
+#if defined(GFXRECON_OPTIMIZE_KERNEL_COPY)
+    if (use_kernel_copy_)
     {
-        // Total number of bytes remaining to be read for the current block.
-        uint64_t unread_bytes = block_header.size - (sizeof(header) - sizeof(block_header));
+        int    input_fd      = fileno(input_file_);
+        int    output_fd     = fileno(output_file_);
+        loff_t input_offset  = static_cast<loff_t>(bytes_read_);
+        loff_t output_offset = static_cast<loff_t>(bytes_written_);
 
-        // If the buffer is in the unused list, omit its initialization data from the file.
-        if (unreferenced_ids_.find(header.buffer_id) != unreferenced_ids_.end())
+        while (copy_size > 0)
         {
-            if (!SkipBytes(unread_bytes))
+            size_t request_size =
+                (copy_size < kMaxKernelCopySize) ? static_cast<size_t>(copy_size) : kMaxKernelCopySize;
+            ssize_t result = copy_file_range(input_fd, &input_offset, output_fd, &output_offset, request_size, 0);
+
+            if (result > 0)
             {
-                HandleBlockReadError(kErrorSeekingFile, "Failed to skip init buffer data meta-data block data");
-                return false;
+                copy_size -= static_cast<uint64_t>(result);
+                bytes_read_ += static_cast<uint64_t>(result);
+                bytes_written_ += static_cast<uint64_t>(result);
             }
-        }
-        else
-        {
-            // Copy the block from the input file to the output file.
-            header.meta_header.block_header   = block_header;
-            header.meta_header.meta_data_type = meta_type;
-
-            if (!WriteBytes(&header, sizeof(header)))
+            else if (result == 0)
             {
-                HandleBlockWriteError(kErrorReadingBlockHeader,
-                                      "Failed to write init buffer data meta-data block header");
+                GFXRECON_LOG_ERROR("Unexpected end of file while copying block data");
                 return false;
             }
-
-            if (!CopyBytes(unread_bytes))
+            else
             {
-                HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy init buffer data meta-data block data");
-                return false;
+                // The file systems do not support in-kernel copies between the files.  Switch to buffered copies for
+                // the remainder of the file, starting from the current output position.
+                GFXRECON_LOG_DEBUG("In-kernel file copy is not supported, using buffered copies");
+
+                use_kernel_copy_ = false;
+
+                if (!util::platform::FileSeek(
+                        output_file_, static_cast<int64_t>(bytes_written_), util::platform::FileSeekSet))
+                {
+                    GFXRECON_LOG_ERROR("Failed to seek the output file");
+                    return false;
+                }
+
+                break;
             }
         }
+
+        if (copy_size == 0)
+        {
+            return true;
+        }
     }
-    else
-    {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init buffer data meta-data block header");
-        return false;
-    }
+#endif
 
-    return true;
+    return CopyBytesBuffered(copy_size);
 }
 
-bool FileOptimizer::FilterInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+bool FileOptimizer::CopyBytesBuffered(uint64_t copy_size)
 {
-    assert(meta_type == format::MetaDataType::kInitImageCommand);
+    if (copy_size == 0)
+    {
+        return true;
+    }
 
-    format::InitImageCommandHeader header;
-    std::vector<uint64_t>          level_sizes;
+    if (!util::platform::FileSeek(input_file_, static_cast<int64_t>(bytes_read_), util::platform::FileSeekSet))
+    {
+        GFXRECON_LOG_ERROR("Failed to seek the input file");
+        return false;
+    }
 
-    bool success = ReadBytes(&header.thread_id, sizeof(header.thread_id));
-    success      = success && ReadBytes(&header.device_id, sizeof(header.device_id));
-    success      = success && ReadBytes(&header.image_id, sizeof(header.image_id));
-    success      = success && ReadBytes(&header.data_size, sizeof(header.data_size));
-    success      = success && ReadBytes(&header.aspect, sizeof(header.aspect));
-    success      = success && ReadBytes(&header.layout, sizeof(header.layout));
-    success      = success && ReadBytes(&header.level_count, sizeof(header.level_count));
+    if (copy_buffer_.empty())
+    {
+        copy_buffer_.resize(kCopyBufferSize);
+    }
 
-    if (success)
+    while (copy_size > 0)
     {
-        // Total number of bytes remaining to be read for the current block.
-        uint64_t unread_bytes = block_header.size - (sizeof(header) - sizeof(block_header));
+        size_t chunk_size = (copy_size < copy_buffer_.size()) ? static_cast<size_t>(copy_size) : copy_buffer_.size();
 
-        // If the image is in the unused list, omit its initialization data from the file.
-        if (unreferenced_ids_.find(header.image_id) != unreferenced_ids_.end())
+        if (util::platform::FileRead(copy_buffer_.data(), 1, chunk_size, input_file_) != chunk_size)
         {
-            if (!SkipBytes(unread_bytes))
-            {
-                HandleBlockReadError(kErrorSeekingFile, "Failed to skip init image data meta-data block data");
-                return false;
-            }
+            GFXRECON_LOG_ERROR("Failed to read block data");
+            return false;
         }
-        else
+
+        if (util::platform::FileWrite(copy_buffer_.data(), 1, chunk_size, output_file_) != chunk_size)
         {
-            // Copy the block from the input file to the output file.
-            header.meta_header.block_header   = block_header;
-            header.meta_header.meta_data_type = meta_type;
+            GFXRECON_LOG_ERROR("Failed to write block data");
+            return false;
+        }
 
-            if (!WriteBytes(&header, sizeof(header)))
-            {
-                HandleBlockWriteError(kErrorReadingBlockHeader,
-                                      "Failed to write init image data meta-data block header");
-                return false;
-            }
+        copy_size -= chunk_size;
+        bytes_read_ += chunk_size;
+        bytes_written_ += chunk_size;
+    }
 
-            if (!CopyBytes(unread_bytes))
-            {
-                HandleBlockCopyError(kErrorCopyingBlockData, "Failed to copy init image data meta-data block data");
-                return false;
-            }
-        }
+    return true;
+}
+
+bool FileOptimizer::SkipBlock(uint64_t block_offset)
+{
+    format::BlockHeader block_header;
+
+    if (!util::platform::FileSeek(input_file_, static_cast<int64_t>(block_offset), util::platform::FileSeekSet) ||
+        (util::platform::FileRead(&block_header, sizeof(block_header), 1, input_file_) != 1))
+    {
+        GFXRECON_LOG_ERROR("Failed to read block header at offset %" PRIu64, block_offset);
+        return false;
     }
-    else
+
+    bytes_read_ = block_offset + sizeof(block_header) + block_header.size;
+
+    if (bytes_read_ > input_file_size_)
     {
-        HandleBlockReadError(kErrorReadingBlockHeader, "Failed to read init image data meta-data block header");
+        GFXRECON_LOG_ERROR("Invalid block size at offset %" PRIu64, block_offset);
         return false;
     }
 
@@ -23,30 +23,49 @@
 #ifndef GFXRECON_FILE_OPTIMIZER_H
 #define GFXRECON_FILE_OPTIMIZER_H
 
-#include "decode/file_transformer.h"
 #include "util/defines.h"
 
-#include <unordered_set>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
 
 GFXRECON_BEGIN_NAMESPACE(gfxrecon)
 
-class FileOptimizer : public decode::FileTransformer
+// Writes a copy of a capture file that omits a set of blocks.  The blocks are identified by the file offsets that were
+// recorded by a prior analysis pass, so the file does not need to be decoded again.  The data between omitted blocks
+// is copied in large sequential runs, using in-kernel copies where supported by the platform and file system.
+class FileOptimizer
 {
   public:
-    FileOptimizer(const std::unordered_set<format::HandleId>& unreferenced_ids);
+    FileOptimizer();
 
-    FileOptimizer(std::unordered_set<format::HandleId>&& unreferenced_ids);
+    ~FileOptimizer();
 
-  protected:
-    virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type) override;
+    bool Initialize(const std::string& input_filename, const std::string& output_filename);
+
+    // The offsets must be sorted and must refer to the start of blocks in the input file.
+    bool Process(const std::vector<uint64_t>& omitted_block_offsets);
+
+    uint64_t GetNumBytesRead() const { return bytes_read_; }
+
+    uint64_t GetNumBytesWritten() const { return bytes_written_; }
 
   private:
-    bool FilterInitBufferMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
+    bool CopyBytes(uint64_t copy_size);
+
+    bool CopyBytesBuffered(uint64_t copy_size);
 
-    bool FilterInitImageMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
+    bool SkipBlock(uint64_t block_offset);
 
   private:
-    std::unordered_set<format::HandleId> unreferenced_ids_;
+    FILE*                input_file_;
+    FILE*                output_file_;
+    uint64_t             input_file_size_;
+    uint64_t             bytes_read_;
+    uint64_t             bytes_written_;
+    bool                 use_kernel_copy_;
+    std::vector<uint8_t> copy_buffer_;
 };
 
 GFXRECON_END_NAMESPACE(gfxrecon)
@@ -22,6 +22,8 @@
 
 #include "project_version.h"
 #include "file_optimizer.h"
+#include "vulkan_dead_call_consumer.h"
+#include "vulkan_dead_call_decoder.h"
 
 #include "decode/file_processor.h"
 #include "format/format.h"
@@ -54,13 +56,13 @@ static void PrintUsage(const char* exe_name)
     {
         app_name.replace(0, dir_location + 1, "");
     }
-    GFXRECON_WRITE_CONSOLE(
-        "\n%s - Remove unused resource initialization data from trimmed GFXReconstruct capture files.\n",
-        app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\n%s - Remove unused resource initialization data and redundant API calls from "
+                           "GFXReconstruct capture files.\n",
+                           app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
     GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <input-file> <output-file>\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
-    GFXRECON_WRITE_CONSOLE("  <input-file>\t\tThe trimmed GFXReconstruct capture file to be processed.");
+    GFXRECON_WRITE_CONSOLE("  <input-file>\t\tThe GFXReconstruct capture file to be processed.");
     GFXRECON_WRITE_CONSOLE("  <output-file>\t\tThe name of the new GFXReconstruct capture file to be created.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
@@ -116,15 +118,18 @@ static std::string GetVersionString(uint32_t api_version)
     return std::to_string(major) + "." + std::to_string(minor) + "." + std::to_string(patch);
 }
 
-void GetUnreferencedResources(const std::string&                              input_filename,
-                              std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids)
+void AnalyzeFile(const std::string&                              input_filename,
+                 std::unordered_set<gfxrecon::format::HandleId>* unreferenced_ids,
+                 uint64_t*                                       dead_call_count,
+                 std::vector<uint64_t>*                          omitted_block_offsets)
 {
-    assert(unreferenced_ids != nullptr);
+    assert((unreferenced_ids != nullptr) && (dead_call_count != nullptr) && (omitted_block_offsets != nullptr));
 
     gfxrecon::decode::FileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder                    decoder;
+        gfxrecon::VulkanDeadCallConsumer                   dead_call_consumer(&file_processor);
+        gfxrecon::VulkanDeadCallDecoder                    decoder(&dead_call_consumer);
         gfxrecon::decode::VulkanReferencedResourceConsumer resref_consumer;
 
         decoder.AddConsumer(&resref_consumer);
@@ -137,6 +142,11 @@ void GetUnreferencedResources(const std::string&                              in
         {
             // Get the list of resources that were included in a command buffer submission during replay.
             resref_consumer.GetReferencedResourceIds(nullptr, unreferenced_ids);
+
+            // Get the file offsets of the API calls and memory updates that have no effect on replay, and of the
+            // initialization data for the unreferenced resources.
+            *dead_call_count = dead_call_consumer.GetDeadCallCount();
+            dead_call_consumer.GetDeadBlockOffsets(*unreferenced_ids, omitted_block_offsets);
         }
         else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
         {
@@ -153,16 +163,14 @@ void GetUnreferencedResources(const std::string&                              in
     }
 }
 
-void FilterUnreferencedResources(const std::string&                               input_filename,
-                                 const std::string&                               output_filename,
-                                 std::unordered_set<gfxrecon::format::HandleId>&& unreferenced_ids)
+void WriteOptimizedFile(const std::string&           input_filename,
+                        const std::string&           output_filename,
+                        const std::vector<uint64_t>& omitted_block_offsets)
 {
-    gfxrecon::FileOptimizer file_processor(std::move(unreferenced_ids));
-    if (file_processor.Initialize(input_filename, output_filename))
+    gfxrecon::FileOptimizer file_optimizer;
+    if (file_optimizer.Initialize(input_filename, output_filename))
     {
-        file_processor.Process();
-
-        if (file_processor.GetErrorState() != gfxrecon::FileOptimizer::kErrorNone)
+        if (!file_optimizer.Process(omitted_block_offsets))
         {
             GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
             gfxrecon::util::Log::Release();
@@ -170,8 +178,14 @@ void FilterUnreferencedResources(const std::string&
         }
 
         GFXRECON_WRITE_CONSOLE("Resource filtering complete.");
-        GFXRECON_WRITE_CONSOLE("\tOriginal file size: %" PRIu64 " bytes", file_processor.GetNumBytesRead());
-        GFXRECON_WRITE_CONSOLE("\tOptimized file size: %" PRIu64 " bytes", file_processor.GetNumBytesWritten());
+        GFXRECON_WRITE_CONSOLE("\tOriginal file size: %" PRIu64 " bytes", file_optimizer.GetNumBytesRead());
+        GFXRECON_WRITE_CONSOLE("\tOptimized file size: %" PRIu64 " bytes", file_optimizer.GetNumBytesWritten());
+    }
+    else
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+        gfxrecon::util::Log::Release();
+        exit(-1);
     }
 }
 
@@ -208,22 +222,26 @@ int main(int argc, const char** argv)
         std::string                     input_filename       = positional_arguments[0];
         std::string                     output_filename      = positional_arguments[1];
 
-        GFXRECON_WRITE_CONSOLE("Scanning %s for unreferenced resources.", input_filename.c_str());
+        GFXRECON_WRITE_CONSOLE("Scanning %s for unreferenced resources and redundant API calls.",
+                               input_filename.c_str());
         std::unordered_set<gfxrecon::format::HandleId> unreferenced_ids;
-        GetUnreferencedResources(input_filename, &unreferenced_ids);
+        uint64_t                                       dead_call_count = 0;
+        std::vector<uint64_t>                          omitted_block_offsets;
+        AnalyzeFile(input_filename, &unreferenced_ids, &dead_call_count, &omitted_block_offsets);
 
-        if (!unreferenced_ids.empty())
+        if (!omitted_block_offsets.empty())
         {
-            // Filter unreferenced ids.
+            // Filter unreferenced ids and redundant calls.
             GFXRECON_WRITE_CONSOLE("Writing optimized file, removing initialization data for %" PRIu64
-                                   " unused resources.",
-                                   unreferenced_ids.size());
-            FilterUnreferencedResources(input_filename, output_filename, std::move(unreferenced_ids));
+                                   " unused resources and %" PRIu64 " redundant API calls and memory updates.",
+                                   static_cast<uint64_t>(unreferenced_ids.size()),
+                                   dead_call_count);
+            WriteOptimizedFile(input_filename, output_filename, omitted_block_offsets);
         }
         else
         {
-            GFXRECON_WRITE_CONSOLE("No unused resources detected.  A new file will not be created.",
-                                   input_filename.c_str());
+            GFXRECON_WRITE_CONSOLE("No unused resources or redundant API calls detected.  A new file will not be "
+                                   "created.");
         }
     }
     catch (std::runtime_error error)
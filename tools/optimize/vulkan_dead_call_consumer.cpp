@@ -0,0 +1,712 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "vulkan_dead_call_consumer.h"
+
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+VulkanDeadCallConsumer::VulkanDeadCallConsumer(const decode::FileProcessor* file_processor) :
+    file_processor_(file_processor), loading_state_(false),
+    min_unreferenced_id_(std::numeric_limits<format::HandleId>::max()), max_unreferenced_id_(format::kNullHandleId)
+{
+    assert(file_processor_ != nullptr);
+}
+
+VulkanDeadCallConsumer::~VulkanDeadCallConsumer() {}
+
+void VulkanDeadCallConsumer::GetDeadBlockOffsets(const std::unordered_set<format::HandleId>& unreferenced_resource_ids,
+                                                 std::vector<uint64_t>*                      block_offsets) const
+{
+    assert(block_offsets != nullptr);
+
+    std::set<uint64_t> offsets = dead_block_offsets_;
+
+    for (format::HandleId resource_id : unreferenced_resource_ids)
+    {
+        auto entry = init_block_offsets_.find(resource_id);
+        if (entry != init_block_offsets_.end())
+        {
+            offsets.insert(entry->second.begin(), entry->second.end());
+        }
+    }
+
+    block_offsets->assign(offsets.begin(), offsets.end());
+}
+
+bool VulkanDeadCallConsumer::IsObjectDestroyCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkDestroyBuffer:
+        case format::ApiCallId::ApiCall_vkDestroyBufferView:
+        case format::ApiCallId::ApiCall_vkDestroyImage:
+        case format::ApiCallId::ApiCall_vkDestroyImageView:
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+        case format::ApiCallId::ApiCall_vkDestroyFence:
+        case format::ApiCallId::ApiCall_vkDestroySemaphore:
+        case format::ApiCallId::ApiCall_vkDestroyEvent:
+        case format::ApiCallId::ApiCall_vkDestroyQueryPool:
+        case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanDeadCallConsumer::IsMemoryReadCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkQueueSubmit:
+        case format::ApiCallId::ApiCall_vkQueueBindSparse:
+        case format::ApiCallId::ApiCall_vkSetEvent:
+        case format::ApiCallId::ApiCall_vkSignalSemaphore:
+        case format::ApiCallId::ApiCall_vkSignalSemaphoreKHR:
+        case format::ApiCallId::ApiCall_vkBuildAccelerationStructuresKHR:
+        case format::ApiCallId::ApiCall_vkCopyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR:
+        case format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+template <typename T>
+void VulkanDeadCallConsumer::TrackCreatedObject(VkResult result, decode::HandlePointerDecoder<T>* handle)
+{
+    assert(handle != nullptr);
+
+    if (!loading_state_ && (result == VK_SUCCESS) && !handle->IsNull() && (handle->GetPointer() != nullptr))
+    {
+        format::HandleId object_id = *handle->GetPointer();
+
+        if (object_id != format::kNullHandleId)
+        {
+            unreferenced_objects_[object_id] = GetCurrentBlockOffset();
+            min_unreferenced_id_             = std::min(min_unreferenced_id_, object_id);
+            max_unreferenced_id_             = std::max(max_unreferenced_id_, object_id);
+        }
+    }
+}
+
+void VulkanDeadCallConsumer::TrackDestroyedObject(format::HandleId object_id)
+{
+    auto entry = unreferenced_objects_.find(object_id);
+    if (entry != unreferenced_objects_.end())
+    {
+        // The object was never referenced between its creation and destruction, so neither call affects replay.
+        dead_block_offsets_.insert(entry->second);
+        dead_block_offsets_.insert(GetCurrentBlockOffset());
+        unreferenced_objects_.erase(entry);
+    }
+}
+
+void VulkanDeadCallConsumer::TrackReferencedObject(format::HandleId object_id)
+{
+    if ((object_id >= min_unreferenced_id_) && (object_id <= max_unreferenced_id_))
+    {
+        unreferenced_objects_.erase(object_id);
+
+        if (unreferenced_objects_.empty())
+        {
+            min_unreferenced_id_ = std::numeric_limits<format::HandleId>::max();
+            max_unreferenced_id_ = format::kNullHandleId;
+        }
+    }
+}
+
+void VulkanDeadCallConsumer::ProcessParameterData(format::ApiCallId call_id,
+                                                  const uint8_t*    parameter_buffer,
+                                                  size_t            buffer_size)
+{
+    assert((parameter_buffer != nullptr) || (buffer_size == 0));
+
+    if (IsMemoryReadCall(call_id))
+    {
+        pending_fills_.clear();
+    }
+
+    // The destroy calls only reference the device and the object being destroyed, which are processed separately.
+    if (unreferenced_objects_.empty() || IsObjectDestroyCall(call_id))
+    {
+        return;
+    }
+
+    // Handle IDs are not aligned within the parameter data, so every byte offset is checked.
+    for (size_t i = 0; ((i + sizeof(format::HandleId)) <= buffer_size) && !unreferenced_objects_.empty(); ++i)
+    {
+        format::HandleId value;
+        util::platform::MemoryCopy(&value, sizeof(value), &parameter_buffer[i], sizeof(value));
+
+        TrackReferencedObject(value);
+    }
+}
+
+bool VulkanDeadCallConsumer::IsMetaDataOfInterest(format::MetaDataType meta_type) const
+{
+    return ((meta_type == format::MetaDataType::kFillMemoryCommand) ||
+            (meta_type == format::MetaDataType::kResizeWindowCommand) ||
+            (meta_type == format::MetaDataType::kResizeWindowCommand2) ||
+            (meta_type == format::MetaDataType::kCreateHardwareBufferCommand) ||
+            (meta_type == format::MetaDataType::kSetOpaqueAddressCommand) ||
+            (meta_type == format::MetaDataType::kSetSwapchainImageStateCommand) ||
+            (meta_type == format::MetaDataType::kInitBufferCommand) ||
+            (meta_type == format::MetaDataType::kInitImageCommand));
+}
+
+void VulkanDeadCallConsumer::ProcessStateBeginMarker(uint64_t frame_number)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(frame_number);
+
+    loading_state_ = true;
+}
+
+void VulkanDeadCallConsumer::ProcessStateEndMarker(uint64_t frame_number)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(frame_number);
+
+    // Resource initialization performed while loading state may read from memory, so the state snapshot acts as a
+    // barrier for fill memory analysis.
+    loading_state_ = false;
+    pending_fills_.clear();
+}
+
+void VulkanDeadCallConsumer::ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(width);
+    GFXRECON_UNREFERENCED_PARAMETER(height);
+
+    TrackReferencedObject(surface_id);
+}
+
+void VulkanDeadCallConsumer::ProcessResizeWindowCommand2(format::HandleId surface_id,
+                                                         uint32_t         width,
+                                                         uint32_t         height,
+                                                         uint32_t         pre_transform)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(width);
+    GFXRECON_UNREFERENCED_PARAMETER(height);
+    GFXRECON_UNREFERENCED_PARAMETER(pre_transform);
+
+    TrackReferencedObject(surface_id);
+}
+
+void VulkanDeadCallConsumer::ProcessCreateHardwareBufferCommand(
+    format::HandleId                                    memory_id,
+    uint64_t                                            buffer_id,
+    uint32_t                                            format,
+    uint32_t                                            width,
+    uint32_t                                            height,
+    uint32_t                                            stride,
+    uint32_t                                            usage,
+    uint32_t                                            layers,
+    const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(buffer_id);
+    GFXRECON_UNREFERENCED_PARAMETER(format);
+    GFXRECON_UNREFERENCED_PARAMETER(width);
+    GFXRECON_UNREFERENCED_PARAMETER(height);
+    GFXRECON_UNREFERENCED_PARAMETER(stride);
+    GFXRECON_UNREFERENCED_PARAMETER(usage);
+    GFXRECON_UNREFERENCED_PARAMETER(layers);
+    GFXRECON_UNREFERENCED_PARAMETER(plane_info);
+
+    TrackReferencedObject(memory_id);
+}
+
+void VulkanDeadCallConsumer::ProcessSetOpaqueAddressCommand(format::HandleId device_id,
+                                                            format::HandleId object_id,
+                                                            uint64_t         address)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+
+    TrackReferencedObject(device_id);
+    TrackReferencedObject(object_id);
+}
+
+void VulkanDeadCallConsumer::ProcessSetSwapchainImageStateCommand(
+    format::HandleId                                    device_id,
+    format::HandleId                                    swapchain_id,
+    uint32_t                                            last_presented_image,
+    const std::vector<format::SwapchainImageStateInfo>& image_state)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(last_presented_image);
+
+    TrackReferencedObject(device_id);
+    TrackReferencedObject(swapchain_id);
+
+    for (const auto& image_info : image_state)
+    {
+        TrackReferencedObject(image_info.image_id);
+        TrackReferencedObject(image_info.acquire_semaphore_id);
+        TrackReferencedObject(image_info.acquire_fence_id);
+    }
+}
+
+void VulkanDeadCallConsumer::ProcessFillMemoryCommand(uint64_t       memory_id,
+                                                      uint64_t       offset,
+                                                      uint64_t       size,
+                                                      const uint8_t* data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    TrackReferencedObject(memory_id);
+
+    if (!loading_state_)
+    {
+        auto& pending = pending_fills_[memory_id];
+
+        // Earlier writes that are fully covered by the new write have not been read, and will never be read.
+        auto covered = std::remove_if(pending.begin(), pending.end(), [&](const PendingFill& fill) {
+            if ((fill.offset >= offset) && ((fill.offset + fill.size) <= (offset + size)))
+            {
+                dead_block_offsets_.insert(fill.block_offset);
+                return true;
+            }
+            return false;
+        });
+
+        pending.erase(covered, pending.end());
+        pending.push_back({ GetCurrentBlockOffset(), offset, size });
+    }
+}
+
+void VulkanDeadCallConsumer::ProcessInitBufferCommand(format::HandleId device_id,
+                                                      format::HandleId buffer_id,
+                                                      uint64_t         data_size,
+                                                      const uint8_t*   data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(data_size);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    TrackReferencedObject(device_id);
+    TrackReferencedObject(buffer_id);
+
+    init_block_offsets_[buffer_id].push_back(GetCurrentBlockOffset());
+}
+
+void VulkanDeadCallConsumer::ProcessInitImageCommand(format::HandleId             device_id,
+                                                     format::HandleId             image_id,
+                                                     uint64_t                     data_size,
+                                                     uint32_t                     aspect,
+                                                     uint32_t                     layout,
+                                                     const std::vector<uint64_t>& level_sizes,
+                                                     const uint8_t*               data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(data_size);
+    GFXRECON_UNREFERENCED_PARAMETER(aspect);
+    GFXRECON_UNREFERENCED_PARAMETER(layout);
+    GFXRECON_UNREFERENCED_PARAMETER(level_sizes);
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    TrackReferencedObject(device_id);
+    TrackReferencedObject(image_id);
+
+    init_block_offsets_[image_id].push_back(GetCurrentBlockOffset());
+}
+
+void VulkanDeadCallConsumer::Process_vkFreeMemory(
+    format::HandleId                                                     device,
+    format::HandleId                                                     memory,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    // Writes to memory that is released before the next submission are never read.
+    auto entry = pending_fills_.find(memory);
+    if (entry != pending_fills_.end())
+    {
+        for (const auto& fill : entry->second)
+        {
+            dead_block_offsets_.insert(fill.block_offset);
+        }
+
+        pending_fills_.erase(entry);
+    }
+}
+
+void VulkanDeadCallConsumer::Process_vkMapMemory(VkResult                                 returnValue,
+                                                 format::HandleId                         device,
+                                                 format::HandleId                         memory,
+                                                 VkDeviceSize                             offset,
+                                                 VkDeviceSize                             size,
+                                                 VkMemoryMapFlags                         flags,
+                                                 decode::PointerDecoder<uint64_t, void*>* ppData)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(returnValue);
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    GFXRECON_UNREFERENCED_PARAMETER(flags);
+    GFXRECON_UNREFERENCED_PARAMETER(ppData);
+
+    // Fill memory offsets are relative to the mapped range, so writes made through different mappings of the same
+    // memory object are not compared.
+    pending_fills_.erase(memory);
+}
+
+void VulkanDeadCallConsumer::Process_vkGetFenceStatus(VkResult         returnValue,
+                                                      format::HandleId device,
+                                                      format::HandleId fence)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(fence);
+
+    // Replay waits for fences that were signaled at capture, so only the polling calls are redundant.
+    if (returnValue == VK_NOT_READY)
+    {
+        dead_block_offsets_.insert(GetCurrentBlockOffset());
+    }
+}
+
+void VulkanDeadCallConsumer::Process_vkWaitForFences(VkResult                               returnValue,
+                                                     format::HandleId                       device,
+                                                     uint32_t                               fenceCount,
+                                                     decode::HandlePointerDecoder<VkFence>* pFences,
+                                                     VkBool32                               waitAll,
+                                                     uint64_t                               timeout)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(fenceCount);
+    GFXRECON_UNREFERENCED_PARAMETER(pFences);
+    GFXRECON_UNREFERENCED_PARAMETER(waitAll);
+    GFXRECON_UNREFERENCED_PARAMETER(timeout);
+
+    if (returnValue == VK_TIMEOUT)
+    {
+        dead_block_offsets_.insert(GetCurrentBlockOffset());
+    }
+}
+
+void VulkanDeadCallConsumer::Process_vkGetQueryPoolResults(VkResult                         returnValue,
+                                                           format::HandleId                 device,
+                                                           format::HandleId                 queryPool,
+                                                           uint32_t                         firstQuery,
+                                                           uint32_t                         queryCount,
+                                                           size_t                           dataSize,
+                                                           decode::PointerDecoder<uint8_t>* pData,
+                                                           VkDeviceSize                     stride,
+                                                           VkQueryResultFlags               flags)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(queryPool);
+    GFXRECON_UNREFERENCED_PARAMETER(firstQuery);
+    GFXRECON_UNREFERENCED_PARAMETER(queryCount);
+    GFXRECON_UNREFERENCED_PARAMETER(dataSize);
+    GFXRECON_UNREFERENCED_PARAMETER(pData);
+    GFXRECON_UNREFERENCED_PARAMETER(stride);
+    GFXRECON_UNREFERENCED_PARAMETER(flags);
+
+    // Query results are never consumed by replay.  Calls that returned VK_SUCCESS are retained, as they may have been
+    // made with VK_QUERY_RESULT_WAIT_BIT to synchronize with the device.
+    if (returnValue == VK_NOT_READY)
+    {
+        dead_block_offsets_.insert(GetCurrentBlockOffset());
+    }
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateBuffer(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkBufferCreateInfo>*    pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkBuffer>*                              pBuffer)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pBuffer);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyBuffer(
+    format::HandleId                                                     device,
+    format::HandleId                                                     buffer,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(buffer);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateBufferView(
+    VkResult                                                              returnValue,
+    format::HandleId                                                      device,
+    decode::StructPointerDecoder<decode::Decoded_VkBufferViewCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*  pAllocator,
+    decode::HandlePointerDecoder<VkBufferView>*                           pView)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pView);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyBufferView(
+    format::HandleId                                                     device,
+    format::HandleId                                                     bufferView,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(bufferView);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateImage(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkImageCreateInfo>*     pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkImage>*                               pImage)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pImage);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyImage(
+    format::HandleId                                                     device,
+    format::HandleId                                                     image,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(image);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateImageView(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkImageViewCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkImageView>*                           pView)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pView);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyImageView(
+    format::HandleId                                                     device,
+    format::HandleId                                                     imageView,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(imageView);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateSampler(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkSamplerCreateInfo>*   pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkSampler>*                             pSampler)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pSampler);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroySampler(
+    format::HandleId                                                     device,
+    format::HandleId                                                     sampler,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(sampler);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateShaderModule(
+    VkResult                                                                returnValue,
+    format::HandleId                                                        device,
+    decode::StructPointerDecoder<decode::Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*    pAllocator,
+    decode::HandlePointerDecoder<VkShaderModule>*                           pShaderModule)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pShaderModule);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyShaderModule(
+    format::HandleId                                                     device,
+    format::HandleId                                                     shaderModule,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(shaderModule);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateFence(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkFenceCreateInfo>*     pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkFence>*                               pFence)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pFence);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyFence(
+    format::HandleId                                                     device,
+    format::HandleId                                                     fence,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(fence);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateSemaphore(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkSemaphoreCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkSemaphore>*                           pSemaphore)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pSemaphore);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroySemaphore(
+    format::HandleId                                                     device,
+    format::HandleId                                                     semaphore,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(semaphore);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateEvent(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkEventCreateInfo>*     pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkEvent>*                               pEvent)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pEvent);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyEvent(
+    format::HandleId                                                     device,
+    format::HandleId                                                     event,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(event);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateQueryPool(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkQueryPoolCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkQueryPool>*                           pQueryPool)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pQueryPool);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyQueryPool(
+    format::HandleId                                                     device,
+    format::HandleId                                                     queryPool,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(queryPool);
+}
+
+void VulkanDeadCallConsumer::Process_vkCreateFramebuffer(
+    VkResult                                                               returnValue,
+    format::HandleId                                                       device,
+    decode::StructPointerDecoder<decode::Decoded_VkFramebufferCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*   pAllocator,
+    decode::HandlePointerDecoder<VkFramebuffer>*                           pFramebuffer)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pFramebuffer);
+}
+
+void VulkanDeadCallConsumer::Process_vkDestroyFramebuffer(
+    format::HandleId                                                     device,
+    format::HandleId                                                     framebuffer,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(framebuffer);
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
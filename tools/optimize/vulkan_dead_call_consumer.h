@@ -0,0 +1,331 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_VULKAN_DEAD_CALL_CONSUMER_H
+#define GFXRECON_VULKAN_DEAD_CALL_CONSUMER_H
+
+#include "decode/file_processor.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Data-flow analysis of a capture file, identifying API calls and meta-data commands that have no effect on replay:
+//  - Objects that are created and destroyed without being referenced by any other API call.
+//  - Fill memory commands that are fully overwritten by another fill memory command before any submission could read
+//    the memory contents, or that precede the release of the memory object.  Host-side event and timeline semaphore
+//    signals release previously submitted work that may read the memory, so they are treated as submissions.
+//  - Fence and query polling calls that reported results as not ready.  Replay does not consume query results, and a
+//    failed poll performs no synchronization.
+// Objects created while loading trimmed state are excluded from the analysis.  Objects are referenced by the raw
+// parameter data of API calls, and by the handle IDs of meta-data commands.
+// Blocks are identified by their file offsets, which are retrieved from the FileProcessor as each block is processed,
+// so that the optimized file can be written without decoding the capture file a second time.
+class VulkanDeadCallConsumer : public decode::VulkanConsumer
+{
+  public:
+    VulkanDeadCallConsumer(const decode::FileProcessor* file_processor);
+
+    virtual ~VulkanDeadCallConsumer() override;
+
+    // Retrieves the sorted file offsets of the blocks that can be omitted from the file, including the initialization
+    // data blocks for the specified resources.
+    void GetDeadBlockOffsets(const std::unordered_set<format::HandleId>& unreferenced_resource_ids,
+                             std::vector<uint64_t>*                      block_offsets) const;
+
+    uint64_t GetDeadCallCount() const { return dead_block_offsets_.size(); }
+
+    // Processes the raw parameter data for an API call, before the call is decoded.  Objects with IDs that appear in
+    // the parameter data are considered to be referenced by the call.  The scan is conservative: any parameter value
+    // that matches an object ID will prevent the object from being removed.
+    void ProcessParameterData(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    virtual bool IsMetaDataOfInterest(format::MetaDataType meta_type) const override;
+
+    virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
+
+    virtual void ProcessStateEndMarker(uint64_t frame_number) override;
+
+    virtual void ProcessResizeWindowCommand(format::HandleId surface_id, uint32_t width, uint32_t height) override;
+
+    virtual void ProcessResizeWindowCommand2(format::HandleId surface_id,
+                                             uint32_t         width,
+                                             uint32_t         height,
+                                             uint32_t         pre_transform) override;
+
+    virtual void
+    ProcessCreateHardwareBufferCommand(format::HandleId                                    memory_id,
+                                       uint64_t                                            buffer_id,
+                                       uint32_t                                            format,
+                                       uint32_t                                            width,
+                                       uint32_t                                            height,
+                                       uint32_t                                            stride,
+                                       uint32_t                                            usage,
+                                       uint32_t                                            layers,
+                                       const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override;
+
+    virtual void
+    ProcessSetOpaqueAddressCommand(format::HandleId device_id, format::HandleId object_id, uint64_t address) override;
+
+    virtual void
+    ProcessSetSwapchainImageStateCommand(format::HandleId                                    device_id,
+                                         format::HandleId                                    swapchain_id,
+                                         uint32_t                                            last_presented_image,
+                                         const std::vector<format::SwapchainImageStateInfo>& image_state) override;
+
+    virtual void ProcessFillMemoryCommand(uint64_t       memory_id,
+                                          uint64_t       offset,
+                                          uint64_t       size,
+                                          const uint8_t* data) override;
+
+    virtual void ProcessInitBufferCommand(format::HandleId device_id,
+                                          format::HandleId buffer_id,
+                                          uint64_t         data_size,
+                                          const uint8_t*   data) override;
+
+    virtual void ProcessInitImageCommand(format::HandleId             device_id,
+                                         format::HandleId             image_id,
+                                         uint64_t                     data_size,
+                                         uint32_t                     aspect,
+                                         uint32_t                     layout,
+                                         const std::vector<uint64_t>& level_sizes,
+                                         const uint8_t*               data) override;
+
+    virtual void Process_vkFreeMemory(
+        format::HandleId                                                     device,
+        format::HandleId                                                     memory,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkMapMemory(VkResult                                 returnValue,
+                                     format::HandleId                         device,
+                                     format::HandleId                         memory,
+                                     VkDeviceSize                             offset,
+                                     VkDeviceSize                             size,
+                                     VkMemoryMapFlags                         flags,
+                                     decode::PointerDecoder<uint64_t, void*>* ppData) override;
+
+    virtual void Process_vkGetFenceStatus(VkResult         returnValue,
+                                          format::HandleId device,
+                                          format::HandleId fence) override;
+
+    virtual void Process_vkWaitForFences(VkResult                               returnValue,
+                                         format::HandleId                       device,
+                                         uint32_t                               fenceCount,
+                                         decode::HandlePointerDecoder<VkFence>* pFences,
+                                         VkBool32                               waitAll,
+                                         uint64_t                               timeout) override;
+
+    virtual void Process_vkGetQueryPoolResults(VkResult                         returnValue,
+                                               format::HandleId                 device,
+                                               format::HandleId                 queryPool,
+                                               uint32_t                         firstQuery,
+                                               uint32_t                         queryCount,
+                                               size_t                           dataSize,
+                                               decode::PointerDecoder<uint8_t>* pData,
+                                               VkDeviceSize                     stride,
+                                               VkQueryResultFlags               flags) override;
+
+    virtual void Process_vkCreateBuffer(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkBufferCreateInfo>*    pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkBuffer>*                              pBuffer) override;
+
+    virtual void Process_vkDestroyBuffer(
+        format::HandleId                                                     device,
+        format::HandleId                                                     buffer,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateBufferView(
+        VkResult                                                              returnValue,
+        format::HandleId                                                      device,
+        decode::StructPointerDecoder<decode::Decoded_VkBufferViewCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*  pAllocator,
+        decode::HandlePointerDecoder<VkBufferView>*                           pView) override;
+
+    virtual void Process_vkDestroyBufferView(
+        format::HandleId                                                     device,
+        format::HandleId                                                     bufferView,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateImage(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkImageCreateInfo>*     pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkImage>*                               pImage) override;
+
+    virtual void Process_vkDestroyImage(
+        format::HandleId                                                     device,
+        format::HandleId                                                     image,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateImageView(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkImageViewCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkImageView>*                           pView) override;
+
+    virtual void Process_vkDestroyImageView(
+        format::HandleId                                                     device,
+        format::HandleId                                                     imageView,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateSampler(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkSamplerCreateInfo>*   pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkSampler>*                             pSampler) override;
+
+    virtual void Process_vkDestroySampler(
+        format::HandleId                                                     device,
+        format::HandleId                                                     sampler,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateShaderModule(
+        VkResult                                                                returnValue,
+        format::HandleId                                                        device,
+        decode::StructPointerDecoder<decode::Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*    pAllocator,
+        decode::HandlePointerDecoder<VkShaderModule>*                           pShaderModule) override;
+
+    virtual void Process_vkDestroyShaderModule(
+        format::HandleId                                                     device,
+        format::HandleId                                                     shaderModule,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateFence(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkFenceCreateInfo>*     pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkFence>*                               pFence) override;
+
+    virtual void Process_vkDestroyFence(
+        format::HandleId                                                     device,
+        format::HandleId                                                     fence,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateSemaphore(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkSemaphoreCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkSemaphore>*                           pSemaphore) override;
+
+    virtual void Process_vkDestroySemaphore(
+        format::HandleId                                                     device,
+        format::HandleId                                                     semaphore,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateEvent(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkEventCreateInfo>*     pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkEvent>*                               pEvent) override;
+
+    virtual void Process_vkDestroyEvent(
+        format::HandleId                                                     device,
+        format::HandleId                                                     event,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateQueryPool(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkQueryPoolCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkQueryPool>*                           pQueryPool) override;
+
+    virtual void Process_vkDestroyQueryPool(
+        format::HandleId                                                     device,
+        format::HandleId                                                     queryPool,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateFramebuffer(
+        VkResult                                                               returnValue,
+        format::HandleId                                                       device,
+        decode::StructPointerDecoder<decode::Decoded_VkFramebufferCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*   pAllocator,
+        decode::HandlePointerDecoder<VkFramebuffer>*                           pFramebuffer) override;
+
+    virtual void Process_vkDestroyFramebuffer(
+        format::HandleId                                                     device,
+        format::HandleId                                                     framebuffer,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+  private:
+    struct PendingFill
+    {
+        uint64_t block_offset;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    // Maps object IDs to the file offsets of the blocks that created the objects.
+    typedef std::unordered_map<format::HandleId, uint64_t>                 ObjectMap;
+    typedef std::unordered_map<format::HandleId, std::vector<PendingFill>> PendingFillMap;
+    typedef std::unordered_map<format::HandleId, std::vector<uint64_t>>    InitBlockMap;
+
+  private:
+    static bool IsObjectDestroyCall(format::ApiCallId call_id);
+
+    // Calls that read from mapped memory, or that release submitted work that reads from it, invalidating all pending
+    // fill memory commands.
+    static bool IsMemoryReadCall(format::ApiCallId call_id);
+
+    uint64_t GetCurrentBlockOffset() const { return file_processor_->GetCurrentBlockOffset(); }
+
+    template <typename T>
+    void TrackCreatedObject(VkResult result, decode::HandlePointerDecoder<T>* handle);
+
+    void TrackDestroyedObject(format::HandleId object_id);
+
+    void TrackReferencedObject(format::HandleId object_id);
+
+  private:
+    const decode::FileProcessor* file_processor_;
+    bool                         loading_state_;
+    ObjectMap                    unreferenced_objects_;
+    format::HandleId             min_unreferenced_id_;
+    format::HandleId             max_unreferenced_id_;
+    PendingFillMap               pending_fills_;
+    InitBlockMap                 init_block_offsets_;
+    std::set<uint64_t>           dead_block_offsets_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_VULKAN_DEAD_CALL_CONSUMER_H
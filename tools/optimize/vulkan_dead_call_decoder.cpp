@@ -0,0 +1,55 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "vulkan_dead_call_decoder.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+VulkanDeadCallDecoder::VulkanDeadCallDecoder(VulkanDeadCallConsumer* dead_call_consumer) :
+    dead_call_consumer_(dead_call_consumer)
+{
+    assert(dead_call_consumer_ != nullptr);
+
+    AddConsumer(dead_call_consumer_);
+}
+
+VulkanDeadCallDecoder::~VulkanDeadCallDecoder() {}
+
+bool VulkanDeadCallDecoder::SupportsApiCall(format::ApiCallId call_id)
+{
+    return ((call_id >= format::ApiCallId::ApiCall_vkCreateInstance) &&
+            (call_id < format::ApiCallId::ApiCall_VulkanLast));
+}
+
+void VulkanDeadCallDecoder::DecodeFunctionCall(format::ApiCallId          call_id,
+                                               const decode::ApiCallInfo& call_info,
+                                               const uint8_t*             parameter_buffer,
+                                               size_t                     buffer_size)
+{
+    dead_call_consumer_->ProcessParameterData(call_id, parameter_buffer, buffer_size);
+
+    decode::VulkanDecoder::DecodeFunctionCall(call_id, call_info, parameter_buffer, buffer_size);
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
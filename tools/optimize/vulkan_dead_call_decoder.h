@@ -0,0 +1,56 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_VULKAN_DEAD_CALL_DECODER_H
+#define GFXRECON_VULKAN_DEAD_CALL_DECODER_H
+
+#include "vulkan_dead_call_consumer.h"
+
+#include "generated/generated_vulkan_decoder.h"
+#include "util/defines.h"
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Vulkan decoder that provides the raw parameter data for every API call to a VulkanDeadCallConsumer, for detection
+// of object references, before decoding the call for all registered consumers.
+class VulkanDeadCallDecoder : public decode::VulkanDecoder
+{
+  public:
+    VulkanDeadCallDecoder(VulkanDeadCallConsumer* dead_call_consumer);
+
+    virtual ~VulkanDeadCallDecoder() override;
+
+    // All Vulkan API calls must be processed to detect object references.
+    virtual bool SupportsApiCall(format::ApiCallId call_id) override;
+
+    virtual void DecodeFunctionCall(format::ApiCallId          call_id,
+                                    const decode::ApiCallInfo& call_info,
+                                    const uint8_t*             parameter_buffer,
+                                    size_t                     buffer_size) override;
+
+  private:
+    VulkanDeadCallConsumer* dead_call_consumer_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_VULKAN_DEAD_CALL_DECODER_H
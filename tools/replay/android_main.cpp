@@ -27,6 +27,7 @@
 #include "application/android_window.h"
 #include "decode/file_processor.h"
 #include "decode/vulkan_replay_options.h"
+#include "decode/vulkan_threaded_recording_decoder.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_decoder.h"
@@ -116,15 +117,34 @@ void android_main(struct android_app* app)
                 else
                 {
                     gfxrecon::decode::VulkanTrackedObjectInfoTable tracked_object_info_table;
-                    gfxrecon::decode::VulkanReplayConsumer         replay_consumer(
-                        window_factory.get(), GetReplayOptions(arg_parser, filename, &tracked_object_info_table));
-                    gfxrecon::decode::VulkanDecoder decoder;
+                    gfxrecon::decode::ReplayOptions                replay_options =
+                        GetReplayOptions(arg_parser, filename, &tracked_object_info_table);
+
+                    if (arg_parser.IsOptionSet(kPrecreatePipelinesOption))
+                    {
+                        PrecreatePipelines(filename, window_factory.get(), replay_options);
+                    }
+
+                    gfxrecon::decode::VulkanReplayConsumer replay_consumer(window_factory.get(), replay_options);
+                    gfxrecon::decode::VulkanDecoder        decoder;
 
                     replay_consumer.SetFatalErrorHandler(
                         [](const char* message) { throw std::runtime_error(message); });
 
                     decoder.AddConsumer(&replay_consumer);
-                    file_processor.AddDecoder(&decoder);
+
+                    std::unique_ptr<gfxrecon::decode::VulkanThreadedRecordingDecoder> threaded_decoder;
+                    if (arg_parser.IsOptionSet(kThreadedRecordingOption))
+                    {
+                        threaded_decoder = std::make_unique<gfxrecon::decode::VulkanThreadedRecordingDecoder>(
+                            &decoder, replay_consumer.GetReplayObjectInfoTable());
+                        file_processor.AddDecoder(threaded_decoder.get());
+                    }
+                    else
+                    {
+                        file_processor.AddDecoder(&decoder);
+                    }
+
                     application->SetPauseFrame(GetPauseFrame(arg_parser));
 
                     // Warn if the capture layer is active.
@@ -136,6 +156,12 @@ void android_main(struct android_app* app)
 
                     app->userData = application.get();
                     application->Run();
+
+                    if (threaded_decoder)
+                    {
+                        // Finish any recording calls that are still queued to the worker threads.
+                        threaded_decoder->Synchronize();
+                    }
                 }
             }
         }
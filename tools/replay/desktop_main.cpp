@@ -24,8 +24,12 @@
 #include "replay_settings.h"
 
 #include "application/application.h"
+#include "application/headless_application.h"
+#include "application/headless_window.h"
 #include "decode/file_processor.h"
+#include "decode/frame_timing_stats.h"
 #include "decode/vulkan_replay_options.h"
+#include "decode/vulkan_threaded_recording_decoder.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "generated/generated_vulkan_replay_consumer.h"
@@ -133,6 +137,17 @@ int main(int argc, const char** argv)
             auto wsi_platform = GetWsiPlatform(arg_parser);
 
             // Setup platform specific application and window factory.
+            if (wsi_platform == WsiPlatform::kHeadless)
+            {
+                auto headless_application =
+                    std::make_unique<gfxrecon::application::HeadlessApplication>(kApplicationName);
+                if (headless_application->Initialize(&file_processor))
+                {
+                    window_factory =
+                        std::make_unique<gfxrecon::application::HeadlessWindowFactory>(headless_application.get());
+                    application = std::move(headless_application);
+                }
+            }
 #if defined(WIN32)
 #if defined(VK_USE_PLATFORM_WIN32_KHR)
             if (wsi_platform == WsiPlatform::kWin32 || (wsi_platform == WsiPlatform::kAuto && !application))
@@ -194,42 +209,135 @@ int main(int argc, const char** argv)
             else
             {
                 gfxrecon::decode::VulkanTrackedObjectInfoTable tracked_object_info_table;
-                gfxrecon::decode::VulkanReplayConsumer         replay_consumer(
-                    window_factory.get(), GetReplayOptions(arg_parser, filename, &tracked_object_info_table));
-                gfxrecon::decode::VulkanDecoder decoder;
+                gfxrecon::decode::ReplayOptions                replay_options =
+                    GetReplayOptions(arg_parser, filename, &tracked_object_info_table);
+
+                if (arg_parser.IsOptionSet(kPrecreatePipelinesOption))
+                {
+                    PrecreatePipelines(filename, window_factory.get(), replay_options);
+                }
 
-                replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
+                uint32_t measurement_start = 1;
+                uint32_t measurement_end   = 0;
+                uint32_t measurement_loops = GetMeasurementLoops(arg_parser);
+                GetMeasurementFrameRange(arg_parser, &measurement_start, &measurement_end);
+
+                const std::string& measurement_file = arg_parser.GetArgumentValue(kMeasurementFileArgument);
+
+                gfxrecon::decode::FrameTimingStats frame_stats(measurement_start, measurement_end);
 
-                decoder.AddConsumer(&replay_consumer);
-                file_processor.AddDecoder(&decoder);
                 application->SetPauseFrame(GetPauseFrame(arg_parser));
+                application->SetFrameTimingStats(&frame_stats);
+
+                if (measurement_loops > 1)
+                {
+                    // Each loop stops after the last measured frame, instead of replaying the remainder of the file.
+                    application->SetQuitFrame(measurement_end);
+                }
 
                 // Warn if the capture layer is active.
                 CheckActiveLayers(gfxrecon::util::platform::GetEnv(kLayerEnvVar));
 
-                // Grab the start frame/time information for the FPS result.
-                uint32_t start_frame = 1;
-                int64_t  start_time  = gfxrecon::util::datetime::GetTimestamp();
+                uint32_t loop_end_frame = 0;
+
+                for (uint32_t loop = 0; loop < measurement_loops; ++loop)
+                {
+                    // Later loops replay the file from the start, which includes the state setup blocks of a trimmed
+                    // capture file, so that every loop begins from the captured state.
+                    if ((loop > 0) && !file_processor.Rewind())
+                    {
+                        break;
+                    }
 
-                application->Run();
+                    frame_stats.BeginLoop();
 
-                if ((file_processor.GetCurrentFrameNumber() > 0) &&
+                    // Each loop creates a new consumer, which appends its screenshot hashes to the hash file written
+                    // by the first loop.
+                    replay_options.screenshot_hash_loop_index = loop;
+
+                    gfxrecon::decode::VulkanReplayConsumer replay_consumer(window_factory.get(), replay_options);
+                    gfxrecon::decode::VulkanDecoder        decoder;
+
+                    replay_consumer.SetFatalErrorHandler(
+                        [](const char* message) { throw std::runtime_error(message); });
+
+                    if (!measurement_file.empty())
+                    {
+                        replay_consumer.EnableGpuFrameTiming(&frame_stats);
+                    }
+
+                    decoder.AddConsumer(&replay_consumer);
+
+                    std::unique_ptr<gfxrecon::decode::VulkanThreadedRecordingDecoder> threaded_decoder;
+                    if (arg_parser.IsOptionSet(kThreadedRecordingOption))
+                    {
+                        threaded_decoder = std::make_unique<gfxrecon::decode::VulkanThreadedRecordingDecoder>(
+                            &decoder, replay_consumer.GetReplayObjectInfoTable());
+                        file_processor.AddDecoder(threaded_decoder.get());
+                    }
+                    else
+                    {
+                        file_processor.AddDecoder(&decoder);
+                    }
+
+                    application->Run();
+
+                    if (threaded_decoder)
+                    {
+                        // Finish any recording calls that are still queued to the worker threads.
+                        threaded_decoder->Synchronize();
+                        file_processor.RemoveDecoder(threaded_decoder.get());
+                    }
+                    else
+                    {
+                        file_processor.RemoveDecoder(&decoder);
+                    }
+
+                    // Stop looping on error, or when a loop ends early because replay was stopped by the user.
+                    uint32_t current_frame = file_processor.GetCurrentFrameNumber();
+                    if ((file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone) ||
+                        (current_frame < loop_end_frame) ||
+                        ((measurement_end != 0) && (current_frame < measurement_end)))
+                    {
+                        break;
+                    }
+
+                    loop_end_frame = current_frame;
+                }
+
+                if ((frame_stats.GetMeasuredFrameCount() > 0) &&
                     (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
                 {
-                    // Grab the end frame/time information and calculate FPS.
-                    int64_t end_time      = gfxrecon::util::datetime::GetTimestamp();
-                    double  diff_time_sec = gfxrecon::util::datetime::ConvertTimestampToSeconds(
-                        gfxrecon::util::datetime::DiffTimestamps(start_time, end_time));
-                    uint32_t end_frame    = file_processor.GetCurrentFrameNumber();
-                    uint32_t total_frames = (end_frame - start_frame) + 1;
+                    // Calculate FPS from the time spent replaying the measured frames.
+                    double diff_time_sec =
+                        gfxrecon::util::datetime::ConvertTimestampToSeconds(frame_stats.GetTotalFrameTime());
+                    uint32_t loop_count   = frame_stats.GetLoopCount();
+                    uint32_t total_frames = frame_stats.GetMeasuredFrameCount();
                     double   fps          = static_cast<double>(total_frames) / diff_time_sec;
-                    GFXRECON_WRITE_CONSOLE("%f fps, %f seconds, %u frame%s, 1 loop, framerange %u-%u",
+                    GFXRECON_WRITE_CONSOLE("%f fps, %f seconds, %u frame%s, %u loop%s, framerange %u-%u",
                                            fps,
                                            diff_time_sec,
                                            total_frames,
                                            total_frames > 1 ? "s" : "",
-                                           start_frame,
-                                           end_frame);
+                                           loop_count,
+                                           loop_count > 1 ? "s" : "",
+                                           frame_stats.GetStartFrame(),
+                                           frame_stats.GetLastMeasuredFrame());
+
+                    if (!measurement_file.empty())
+                    {
+                        frame_stats.PrintSummary();
+                        frame_stats.WriteReport(measurement_file);
+                    }
+                }
+                else if ((file_processor.GetCurrentFrameNumber() > 0) &&
+                         (file_processor.GetErrorState() == gfxrecon::decode::FileProcessor::kErrorNone))
+                {
+                    GFXRECON_WRITE_CONSOLE("No frames were measured; the measurement range starts at frame %u and the "
+                                           "file contains %u frame%s",
+                                           measurement_start,
+                                           file_processor.GetCurrentFrameNumber(),
+                                           file_processor.GetCurrentFrameNumber() > 1 ? "s" : "");
                 }
                 else if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
                 {
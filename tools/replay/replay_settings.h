@@ -24,6 +24,7 @@
 
 #include "decode/file_processor.h"
 #include "decode/vulkan_default_allocator.h"
+#include "decode/vulkan_pipeline_precreation_decoder.h"
 #include "decode/vulkan_realign_allocator.h"
 #include "decode/vulkan_rebind_allocator.h"
 #include "decode/vulkan_remap_allocator.h"
@@ -31,7 +32,11 @@
 #include "decode/vulkan_resource_tracking_consumer.h"
 #include "decode/vulkan_tracked_object_info_table.h"
 #include "generated/generated_vulkan_decoder.h"
+#include "generated/generated_vulkan_replay_consumer.h"
 #include "util/argument_parser.h"
+#include "util/file_path.h"
+#include "util/hash.h"
+#include "util/local_socket.h"
 #include "util/logging.h"
 #include "util/platform.h"
 
@@ -40,6 +45,7 @@
 #include <cstdlib>
 #include <limits>
 #include <sstream>
+#include <stdexcept>
 #include <string>
 #include <vector>
 
@@ -75,11 +81,23 @@ const char kScreenshotRangeArgument[]          = "--screenshots";
 const char kScreenshotFormatArgument[]         = "--screenshot-format";
 const char kScreenshotDirArgument[]            = "--screenshot-dir";
 const char kScreenshotFilePrefixArgument[]     = "--screenshot-prefix";
+const char kScreenshotHashFileArgument[]       = "--screenshot-hash-file";
+const char kScreenshotHashTileSizeArgument[]   = "--screenshot-hash-tile-size";
+const char kThreadedRecordingOption[]          = "--threaded-recording";
+const char kAsyncPipelineCreationOption[]      = "--async-pipeline-creation";
+const char kPipelineCacheDirArgument[]         = "--pipeline-cache-dir";
+const char kPrecreatePipelinesOption[]         = "--precreate-pipelines";
+const char kMeasurementRangeArgument[]         = "--measurement-frame-range";
+const char kMeasurementFileArgument[]          = "--measurement-file";
+const char kMeasurementLoopsArgument[]         = "--measurement-loops";
 
 const char kOptions[] = "-h|--help,--version,--log-debugview,--no-debug-popup,--paused,--sync,--sfa|--skip-failed-"
-                        "allocations,--opcd|--omit-pipeline-cache-data,--remove-unsupported,--screenshot-all";
+                        "allocations,--opcd|--omit-pipeline-cache-data,--remove-unsupported,--screenshot-all,--"
+                        "threaded-recording,--async-pipeline-creation,--precreate-pipelines";
 const char kArguments[] = "--log-level,--log-file,--gpu,--pause-frame,--wsi,--surface-index,-m|--memory-translation,--"
-                          "replace-shaders,--screenshots,--screenshot-format,--screenshot-dir,--screenshot-prefix";
+                          "replace-shaders,--screenshots,--screenshot-format,--screenshot-dir,--screenshot-prefix,--"
+                          "pipeline-cache-dir,--measurement-frame-range,--measurement-file,--measurement-loops,--"
+                          "screenshot-hash-file,--screenshot-hash-tile-size";
 
 enum class WsiPlatform
 {
@@ -87,14 +105,16 @@ enum class WsiPlatform
     kWin32,
     kXlib,
     kXcb,
-    kWayland
+    kWayland,
+    kHeadless
 };
 
-const char kWsiPlatformAuto[]    = "auto";
-const char kWsiPlatformWin32[]   = "win32";
-const char kWsiPlatformXlib[]    = "xlib";
-const char kWsiPlatformXcb[]     = "xcb";
-const char kWsiPlatformWayland[] = "wayland";
+const char kWsiPlatformAuto[]     = "auto";
+const char kWsiPlatformWin32[]    = "win32";
+const char kWsiPlatformXlib[]     = "xlib";
+const char kWsiPlatformXcb[]      = "xcb";
+const char kWsiPlatformWayland[]  = "wayland";
+const char kWsiPlatformHeadless[] = "headless";
 
 const char kMemoryTranslationNone[]    = "none";
 const char kMemoryTranslationRemap[]   = "remap";
@@ -102,6 +122,8 @@ const char kMemoryTranslationRealign[] = "realign";
 const char kMemoryTranslationRebind[]  = "rebind";
 
 const char kScreenshotFormatBmp[] = "bmp";
+const char kScreenshotFormatPng[] = "png";
+const char kScreenshotFormatQoi[] = "qoi";
 
 #if defined(__ANDROID__)
 const char kDefaultScreenshotDir[] = "/sdcard";
@@ -226,6 +248,100 @@ static uint32_t GetPauseFrame(const gfxrecon::util::ArgumentParser& arg_parser)
     return pause_frame;
 }
 
+// Parses a measurement frame range of the form N1[-N2].  When only N1 is specified, measurement continues to the end
+// of the capture file, which is indicated by a last frame value of 0.
+static bool GetMeasurementFrameRange(const gfxrecon::util::ArgumentParser& arg_parser,
+                                     uint32_t*                             first_frame,
+                                     uint32_t*                             last_frame)
+{
+    const auto& value = arg_parser.GetArgumentValue(kMeasurementRangeArgument);
+
+    (*first_frame) = 1;
+    (*last_frame)  = 0;
+
+    if (value.empty())
+    {
+        return true;
+    }
+
+    std::vector<std::string> values;
+    std::istringstream       value_input(value);
+    std::string              token;
+
+    while (std::getline(value_input, token, '-'))
+    {
+        values.push_back(token);
+    }
+
+    if (values.empty() || (values.size() > 2) ||
+        std::any_of(values.begin(), values.end(), [](const std::string& entry) {
+            return entry.empty() ||
+                   (static_cast<size_t>(std::count_if(entry.begin(), entry.end(), ::isdigit)) != entry.length());
+        }))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid measurement frame range \"%s\"", value.c_str());
+        return false;
+    }
+
+    uint32_t first = std::stoul(values[0]);
+    uint32_t last  = (values.size() == 2) ? static_cast<uint32_t>(std::stoul(values[1])) : 0;
+
+    if ((first == 0) || ((last != 0) && (last < first)))
+    {
+        GFXRECON_LOG_WARNING("Ignoring invalid measurement frame range \"%s\", where frame numbering is 1-based and "
+                             "the last frame may not precede the first frame",
+                             value.c_str());
+        return false;
+    }
+
+    (*first_frame) = first;
+    (*last_frame)  = last;
+
+    return true;
+}
+
+static uint32_t GetScreenshotHashTileSize(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    tile_size = 0;
+    const auto& value     = arg_parser.GetArgumentValue(kScreenshotHashTileSizeArgument);
+
+    if (!value.empty())
+    {
+        size_t count = std::count_if(value.begin(), value.end(), ::isdigit);
+        if (count == value.length())
+        {
+            tile_size = std::stoul(value);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid screenshot hash tile size \"%s\"", value.c_str());
+        }
+    }
+
+    return tile_size;
+}
+
+static uint32_t GetMeasurementLoops(const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    uint32_t    loops = 1;
+    const auto& value = arg_parser.GetArgumentValue(kMeasurementLoopsArgument);
+
+    if (!value.empty())
+    {
+        size_t count = std::count_if(value.begin(), value.end(), ::isdigit);
+        if ((count == value.length()) && (std::stoul(value) > 0))
+        {
+            loops = std::stoul(value);
+        }
+        else
+        {
+            GFXRECON_LOG_WARNING("Ignoring invalid measurement loop count \"%s\"", value.c_str());
+        }
+    }
+
+    return loops;
+}
+
 static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_parser)
 {
     WsiPlatform wsi_platform = WsiPlatform::kAuto;
@@ -269,6 +385,10 @@ static WsiPlatform GetWsiPlatform(const gfxrecon::util::ArgumentParser& arg_pars
             GFXRECON_LOG_WARNING("Ignoring wsi option \"%s\", which is not enabled on this system", value.c_str());
 #endif
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kWsiPlatformHeadless, value.c_str()) == 0)
+        {
+            wsi_platform = WsiPlatform::kHeadless;
+        }
         else
         {
             GFXRECON_LOG_WARNING("Ignoring unrecognized wsi option \"%s\"", value.c_str());
@@ -297,6 +417,8 @@ static std::string GetWsiArgString()
     wsi_args += ',';
     wsi_args += kWsiPlatformWayland;
 #endif
+    wsi_args += ',';
+    wsi_args += kWsiPlatformHeadless;
     return wsi_args;
 }
 
@@ -333,6 +455,19 @@ static gfxrecon::decode::ScreenshotFormat GetScreenshotFormat(const gfxrecon::ut
         {
             format = gfxrecon::decode::ScreenshotFormat::kBmp;
         }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatPng, value.c_str()) == 0)
+        {
+#if defined(ENABLE_ZLIB_COMPRESSION)
+            format = gfxrecon::decode::ScreenshotFormat::kPng;
+#else
+            GFXRECON_LOG_WARNING("Ignoring screenshot format option \"%s\", which requires zlib support",
+                                 value.c_str());
+#endif
+        }
+        else if (gfxrecon::util::platform::StringCompareNoCase(kScreenshotFormatQoi, value.c_str()) == 0)
+        {
+            format = gfxrecon::decode::ScreenshotFormat::kQoi;
+        }
         else
         {
             GFXRECON_LOG_WARNING("Ignoring unrecognized screenshot format option \"%s\"", value.c_str());
@@ -488,6 +623,39 @@ GetScreenshotRanges(const gfxrecon::util::ArgumentParser& arg_parser)
     return ranges;
 }
 
+// Identifies a capture file for the replay pipeline cache by file size and a checksum of the start of the file, which
+// contains the file header and the device creation calls, to avoid reading the entire file.
+static std::string GetCaptureFileId(const std::string& filename)
+{
+    const size_t kIdBlockSize = 1024 * 1024;
+
+    std::string id;
+    FILE*       file   = nullptr;
+    int32_t     result = gfxrecon::util::platform::FileOpen(&file, filename.c_str(), "rb");
+
+    if ((result == 0) && (file != nullptr))
+    {
+        gfxrecon::util::platform::FileSeek(file, 0, gfxrecon::util::platform::FileSeekEnd);
+        int64_t file_size = gfxrecon::util::platform::FileTell(file);
+        gfxrecon::util::platform::FileSeek(file, 0, gfxrecon::util::platform::FileSeekSet);
+
+        std::vector<uint32_t> block(kIdBlockSize / sizeof(uint32_t), 0);
+        size_t                read_size = gfxrecon::util::platform::FileRead(block.data(), 1, kIdBlockSize, file);
+
+        gfxrecon::util::platform::FileClose(file);
+
+        std::stringstream stream;
+        stream << std::hex << gfxrecon::util::hash::CheckSum(block.data(), read_size) << "_" << std::dec << file_size;
+        id = stream.str();
+    }
+    else
+    {
+        GFXRECON_LOG_WARNING("Failed to open capture file %s to compute the pipeline cache key", filename.c_str());
+    }
+
+    return id;
+}
+
 static gfxrecon::decode::CreateResourceAllocator
 GetCreateResourceAllocatorFunc(const gfxrecon::util::ArgumentParser&           arg_parser,
                                const std::string&                              filename,
@@ -543,6 +711,11 @@ GetReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parser,
         replay_options.remove_unsupported_features = true;
     }
 
+    if (arg_parser.IsOptionSet(kAsyncPipelineCreationOption))
+    {
+        replay_options.async_pipeline_creation = true;
+    }
+
     if (arg_parser.IsOptionSet(kSkipFailedAllocationLongOption) ||
         arg_parser.IsOptionSet(kSkipFailedAllocationShortOption))
     {
@@ -556,6 +729,13 @@ GetReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parser,
     }
 
     replay_options.replace_dir = arg_parser.GetArgumentValue(kShaderReplaceArgument);
+
+    replay_options.pipeline_cache_dir = arg_parser.GetArgumentValue(kPipelineCacheDirArgument);
+    if (!replay_options.pipeline_cache_dir.empty())
+    {
+        replay_options.capture_file_id = GetCaptureFileId(filename);
+    }
+
     replay_options.create_resource_allocator =
         GetCreateResourceAllocatorFunc(arg_parser, filename, replay_options, tracked_object_info_table);
 
@@ -564,15 +744,94 @@ GetReplayOptions(const gfxrecon::util::ArgumentParser&           arg_parser,
     replay_options.screenshot_dir         = GetScreenshotDir(arg_parser);
     replay_options.screenshot_file_prefix = arg_parser.GetArgumentValue(kScreenshotFilePrefixArgument);
 
+    replay_options.screenshot_hash_file = arg_parser.GetArgumentValue(kScreenshotHashFileArgument);
+    if (!replay_options.screenshot_hash_file.empty())
+    {
+        replay_options.screenshot_hash_tile_size = GetScreenshotHashTileSize(arg_parser);
+
+        // Hash every frame when no frames were selected for screenshots.
+        if (replay_options.screenshot_ranges.empty())
+        {
+            gfxrecon::decode::ScreenshotRange screenshot_range;
+            screenshot_range.first = 1;
+            screenshot_range.last  = std::numeric_limits<uint32_t>::max();
+            replay_options.screenshot_ranges.emplace_back(std::move(screenshot_range));
+        }
+    }
+
     std::string surface_index = arg_parser.GetArgumentValue(kSurfaceIndexArgument);
     if (!surface_index.empty())
     {
         replay_options.surface_index = std::stoi(surface_index);
     }
 
+    const auto& wsi_platform = arg_parser.GetArgumentValue(kWsiArgument);
+    if (!wsi_platform.empty() &&
+        (gfxrecon::util::platform::StringCompareNoCase(kWsiPlatformHeadless, wsi_platform.c_str()) == 0))
+    {
+        replay_options.headless = true;
+    }
+
     return replay_options;
 }
 
+// Processes the capture file's shader module and pipeline creation calls before replay, creating the pipelines in
+// parallel to populate the replay pipeline cache, so that pipeline creation during replay does not require compilation.
+static void PrecreatePipelines(const std::string&                     filename,
+                               gfxrecon::decode::WindowFactory*       window_factory,
+                               const gfxrecon::decode::ReplayOptions& replay_options)
+{
+    if (replay_options.pipeline_cache_dir.empty())
+    {
+        GFXRECON_LOG_WARNING("Pipeline pre-creation requires a pipeline cache directory to be specified with the %s "
+                             "option; pipelines will not be pre-created",
+                             kPipelineCacheDirArgument);
+        return;
+    }
+
+    // The pre-creation pass reads the capture before replay, which would consume the data from a streamed capture.
+    if (gfxrecon::util::localsocket::IsSocketPath(filename) || gfxrecon::util::filepath::IsNamedPipe(filename))
+    {
+        GFXRECON_LOG_WARNING("Pipeline pre-creation is not supported for streamed captures; pipelines will not be "
+                             "pre-created");
+        return;
+    }
+
+    GFXRECON_WRITE_CONSOLE("Pre-creating pipelines. This may take some time. Please wait...");
+
+    gfxrecon::decode::ReplayOptions precreation_options = replay_options;
+    precreation_options.async_pipeline_creation         = true;
+    precreation_options.screenshot_ranges.clear();
+    precreation_options.screenshot_hash_file.clear();
+
+    gfxrecon::decode::FileProcessor file_processor;
+
+    if (file_processor.Initialize(filename))
+    {
+        try
+        {
+            // The replay pipeline cache is written when the consumer is destroyed.
+            gfxrecon::decode::VulkanReplayConsumer             replay_consumer(window_factory, precreation_options);
+            gfxrecon::decode::VulkanDecoder                    decoder;
+            gfxrecon::decode::VulkanPipelinePrecreationDecoder precreation_decoder(&decoder);
+
+            replay_consumer.SetFatalErrorHandler([](const char* message) { throw std::runtime_error(message); });
+
+            decoder.AddConsumer(&replay_consumer);
+            file_processor.AddDecoder(&precreation_decoder);
+            file_processor.ProcessAllFrames();
+            file_processor.RemoveDecoder(&precreation_decoder);
+            decoder.RemoveConsumer(&replay_consumer);
+        }
+        catch (std::runtime_error error)
+        {
+            GFXRECON_LOG_WARNING("Pipeline pre-creation failed: %s", error.what());
+        }
+    }
+
+    GFXRECON_WRITE_CONSOLE("Pipeline pre-creation done.");
+}
+
 static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
 {
     if (arg_parser.IsOptionSet(kVersionOption))
@@ -614,9 +873,13 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--pause-frame <N>] [--paused] [--sync] [--screenshot-all]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshots <N1(-N2),...>] [--screenshot-format <format>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-dir <dir>] [--screenshot-prefix <file-prefix>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--screenshot-hash-file <file>] [--screenshot-hash-tile-size <N>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--sfa | --skip-failed-allocations] [--replace-shaders <dir>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[--opcd | --omit-pipeline-cache-data] [--wsi <platform>]");
-    GFXRECON_WRITE_CONSOLE("\t\t\t[--surface-index <N>] [--remove-unsupported]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--surface-index <N>] [--remove-unsupported] [--threaded-recording]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--async-pipeline-creation] [--pipeline-cache-dir <dir>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--precreate-pipelines] [--measurement-frame-range <N1[-N2]>]");
+    GFXRECON_WRITE_CONSOLE("\t\t\t[--measurement-file <file>] [--measurement-loops <N>]");
     GFXRECON_WRITE_CONSOLE("\t\t\t[-m <mode> | --memory-translation <mode>]");
 #if defined(WIN32)
     GFXRECON_WRITE_CONSOLE("\t\t\t[--log-level <level>] [--log-file <file>] [--log-debugview]");
@@ -666,6 +929,12 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tAvailable formats are:");
     GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tBitmap file format.  This is the default format.",
                            kScreenshotFormatBmp);
+#if defined(ENABLE_ZLIB_COMPRESSION)
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tPNG file format, with fast compression.", kScreenshotFormatPng);
+#endif
+    GFXRECON_WRITE_CONSOLE("          \t\t    %s\t\tQOI file format, with faster compression and",
+                           kScreenshotFormatQoi);
+    GFXRECON_WRITE_CONSOLE("          \t\t    \t\tlarger files than PNG.");
     GFXRECON_WRITE_CONSOLE("  --screenshot-dir <dir>");
     GFXRECON_WRITE_CONSOLE("          \t\tDirectory to write screenshots.  Default is the current");
     GFXRECON_WRITE_CONSOLE("          \t\tworking directory.");
@@ -673,6 +942,20 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("          \t\tPrefix to apply to the screenshot file name.  Default is ");
     GFXRECON_WRITE_CONSOLE("          \t\t\"screenshot\", producing file names similar to");
     GFXRECON_WRITE_CONSOLE("          \t\t\"screenshot_frame_8049.bmp\".");
+    GFXRECON_WRITE_CONSOLE("  --screenshot-hash-file <file>");
+    GFXRECON_WRITE_CONSOLE("          \t\tWrite a hash of each screenshot image to the specified");
+    GFXRECON_WRITE_CONSOLE("          \t\ttext file instead of writing image files, for fast");
+    GFXRECON_WRITE_CONSOLE("          \t\tcomparison of replay output.  Each line contains the");
+    GFXRECON_WRITE_CONSOLE("          \t\tloop index, frame number, swapchain index, width,");
+    GFXRECON_WRITE_CONSOLE("          \t\theight, and hash.  The loop index is 0 unless");
+    GFXRECON_WRITE_CONSOLE("          \t\t--measurement-loops is specified, in which case the");
+    GFXRECON_WRITE_CONSOLE("          \t\thashes of every loop are written to the file.");
+    GFXRECON_WRITE_CONSOLE("          \t\tAll frames are hashed if --screenshots and");
+    GFXRECON_WRITE_CONSOLE("          \t\t--screenshot-all are not specified.");
+    GFXRECON_WRITE_CONSOLE("  --screenshot-hash-tile-size <N>");
+    GFXRECON_WRITE_CONSOLE("          \t\tAlso write a hash for each NxN pixel tile of the image,");
+    GFXRECON_WRITE_CONSOLE("          \t\tin row-major order, to locate differences between");
+    GFXRECON_WRITE_CONSOLE("          \t\treplays.  Default is 0 (tile hashes disabled).");
     GFXRECON_WRITE_CONSOLE("  --sfa\t\t\tSkip vkAllocateMemory, vkAllocateCommandBuffers, and");
     GFXRECON_WRITE_CONSOLE("       \t\t\tvkAllocateDescriptorSets calls that failed during");
     GFXRECON_WRITE_CONSOLE("       \t\t\tcapture (same as --skip-failed-allocations).");
@@ -686,12 +969,50 @@ static void PrintUsage(const char* exe_name)
     GFXRECON_WRITE_CONSOLE("        \t\t--omit-pipeline-cache-data).");
     GFXRECON_WRITE_CONSOLE("  --wsi <platform>\tForce replay to use the specified wsi platform.");
     GFXRECON_WRITE_CONSOLE("                  \tAvailable platforms are: %s", GetWsiArgString().c_str());
+    GFXRECON_WRITE_CONSOLE("                  \tThe headless platform replays without a window system,");
+    GFXRECON_WRITE_CONSOLE("                  \tbacking swapchains with images that are never presented.");
     GFXRECON_WRITE_CONSOLE("  --surface-index <N>\tRestrict rendering to the Nth surface object created.");
     GFXRECON_WRITE_CONSOLE("                  \tUsed with captures that include multiple surfaces.  Default");
     GFXRECON_WRITE_CONSOLE("                  \tis -1 (render to all surfaces).");
     GFXRECON_WRITE_CONSOLE("  --sync\t\tSynchronize after each queue submission with vkQueueWaitIdle.");
     GFXRECON_WRITE_CONSOLE("  --remove-unsupported\tRemove unsupported extensions and features from instance");
     GFXRECON_WRITE_CONSOLE("                      \tand device creation parameters.");
+    GFXRECON_WRITE_CONSOLE("  --threaded-recording\tReplay command buffer recording calls on worker");
+    GFXRECON_WRITE_CONSOLE("                      \tthreads, with one worker for each thread that");
+    GFXRECON_WRITE_CONSOLE("                      \trecorded command buffers during capture.  Workers");
+    GFXRECON_WRITE_CONSOLE("                      \tare synchronized before all other API calls.");
+    GFXRECON_WRITE_CONSOLE("  --async-pipeline-creation");
+    GFXRECON_WRITE_CONSOLE("                      \tCreate graphics and compute pipelines on worker");
+    GFXRECON_WRITE_CONSOLE("                      \tthreads.  Replay waits for a pipeline to be");
+    GFXRECON_WRITE_CONSOLE("                      \tcreated when the pipeline is first used.");
+    GFXRECON_WRITE_CONSOLE("  --pipeline-cache-dir <dir>");
+    GFXRECON_WRITE_CONSOLE("                      \tStore a pipeline cache for each capture file and");
+    GFXRECON_WRITE_CONSOLE("                      \treplay device in the specified directory.  The");
+    GFXRECON_WRITE_CONSOLE("                      \tcache is used for all pipeline creation and is");
+    GFXRECON_WRITE_CONSOLE("                      \tupdated when replay completes.");
+    GFXRECON_WRITE_CONSOLE("  --precreate-pipelines\tCreate all shader modules and pipelines from the");
+    GFXRECON_WRITE_CONSOLE("                      \tcapture file in parallel before replay starts, to");
+    GFXRECON_WRITE_CONSOLE("                      \tpopulate the pipeline cache specified with");
+    GFXRECON_WRITE_CONSOLE("                      \t--pipeline-cache-dir.  Replay timing excludes the");
+    GFXRECON_WRITE_CONSOLE("                      \tpre-creation pass.  Not supported for streamed");
+    GFXRECON_WRITE_CONSOLE("                      \tcaptures.");
+    GFXRECON_WRITE_CONSOLE("  --measurement-frame-range <N1[-N2]>");
+    GFXRECON_WRITE_CONSOLE("                      \tRestrict frame time measurement to the frames from");
+    GFXRECON_WRITE_CONSOLE("                      \tN1 to N2, inclusive.  When N2 is omitted, frames are");
+    GFXRECON_WRITE_CONSOLE("                      \tmeasured to the end of the capture file.  Default");
+    GFXRECON_WRITE_CONSOLE("                      \tis 1 (measure all frames).");
+    GFXRECON_WRITE_CONSOLE("  --measurement-file <file>");
+    GFXRECON_WRITE_CONSOLE("                      \tWrite per-frame CPU and GPU times for the measured");
+    GFXRECON_WRITE_CONSOLE("                      \tframes to the specified file, as CSV when the file");
+    GFXRECON_WRITE_CONSOLE("                      \textension is .csv and as JSON otherwise.  Enables");
+    GFXRECON_WRITE_CONSOLE("                      \tGPU timestamp queries on the presentation queue.");
+    GFXRECON_WRITE_CONSOLE("  --measurement-loops <N>");
+    GFXRECON_WRITE_CONSOLE("                      \tReplay the capture file N times, stopping each loop");
+    GFXRECON_WRITE_CONSOLE("                      \tafter the last frame of the measurement range.  Each");
+    GFXRECON_WRITE_CONSOLE("                      \tloop replays the file from the start, restoring the");
+    GFXRECON_WRITE_CONSOLE("                      \tcaptured state.  Screenshot hashes from all loops");
+    GFXRECON_WRITE_CONSOLE("                      \tare written to the --screenshot-hash-file, tagged");
+    GFXRECON_WRITE_CONSOLE("                      \twith the loop index.  Default is 1.");
     GFXRECON_WRITE_CONSOLE("  -m <mode>\t\tEnable memory translation for replay on GPUs with memory");
     GFXRECON_WRITE_CONSOLE("          \t\ttypes that are not compatible with the capture GPU's");
     GFXRECON_WRITE_CONSOLE("          \t\tmemory types.  Available modes are:");
@@ -23,16 +23,21 @@
 
 #include "project_version.h"
 
-#include "decode/file_processor.h"
+#include "decode/parallel_file_processor.h"
 #include "format/format.h"
 #include "generated/generated_vulkan_ascii_consumer.h"
 #include "generated/generated_vulkan_decoder.h"
 #include "util/argument_parser.h"
 #include "util/logging.h"
+#include "util/platform.h"
 
 #include "vulkan/vulkan_core.h"
 
+#include <cstdio>
 #include <cstdlib>
+#include <memory>
+#include <string>
+#include <vector>
 
 const char kHelpShortOption[] = "-h";
 const char kHelpLongOption[]  = "--help";
@@ -41,6 +46,8 @@ const char kNoDebugPopup[]    = "--no-debug-popup";
 
 const char kOptions[] = "-h|--help,--version,--no-debug-popup";
 
+const size_t kCopyBufferSize = 1024 * 1024;
+
 static void PrintUsage(const char* exe_name)
 {
     std::string app_name     = exe_name;
@@ -49,12 +56,13 @@ static void PrintUsage(const char* exe_name)
     {
         app_name.replace(0, dir_location + 1, "");
     }
-    GFXRECON_WRITE_CONSOLE("\n%s - A tool to convert GFXReconstruct capture files to text.\n", app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("\n%s - A tool to convert GFXReconstruct capture files to JSON-lines text.\n",
+                           app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Usage:");
     GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] <file>\n", app_name.c_str());
     GFXRECON_WRITE_CONSOLE("Required arguments:");
     GFXRECON_WRITE_CONSOLE("  <file>\t\tPath to the GFXReconstruct capture file to be converted");
-    GFXRECON_WRITE_CONSOLE("        \t\tto text.");
+    GFXRECON_WRITE_CONSOLE("        \t\tto JSON-lines text.");
     GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
     GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
     GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
@@ -136,21 +144,113 @@ int main(int argc, const char** argv)
         output_filename = output_filename.substr(0, suffix_pos);
     }
 
-    output_filename += ".txt";
+    output_filename += ".jsonl";
 
-    gfxrecon::decode::FileProcessor file_processor;
+    int                                     return_code = 0;
+    gfxrecon::decode::ParallelFileProcessor file_processor;
     if (file_processor.Initialize(input_filename))
     {
-        gfxrecon::decode::VulkanDecoder       decoder;
-        gfxrecon::decode::VulkanAsciiConsumer ascii_consumer;
+        // Each chunk of the file is converted on a worker thread with a separate decoder and consumer, which write to
+        // separate files that are then concatenated in file order.
+        size_t chunk_count = file_processor.GetChunkCount();
+
+        std::vector<std::string>                                            chunk_filenames;
+        std::vector<std::unique_ptr<gfxrecon::decode::VulkanDecoder>>       chunk_decoders;
+        std::vector<std::unique_ptr<gfxrecon::decode::VulkanAsciiConsumer>> chunk_consumers;
+        std::vector<gfxrecon::decode::ApiDecoder*>                          decoders;
+
+        for (size_t i = 0; i < chunk_count; ++i)
+        {
+            chunk_filenames.push_back((chunk_count == 1) ? output_filename
+                                                         : output_filename + "." + std::to_string(i) + ".tmp");
+            chunk_decoders.emplace_back(std::make_unique<gfxrecon::decode::VulkanDecoder>());
+            chunk_consumers.emplace_back(std::make_unique<gfxrecon::decode::VulkanAsciiConsumer>());
+            chunk_decoders.back()->AddConsumer(chunk_consumers.back().get());
+            decoders.push_back(chunk_decoders.back().get());
+
+            if (!chunk_consumers.back()->Initialize(chunk_filenames.back()))
+            {
+                GFXRECON_LOG_ERROR("Failed to open output file %s", chunk_filenames.back().c_str());
+                return_code = -1;
+            }
+        }
+
+        if ((return_code == 0) && !file_processor.ProcessChunks(decoders))
+        {
+            return_code = -1;
+        }
+
+        // Flush and close the chunk files, then check for output that was lost to a failed write.
+        for (const auto& chunk_consumer : chunk_consumers)
+        {
+            chunk_consumer->Destroy();
+
+            if (chunk_consumer->HasWriteError())
+            {
+                GFXRECON_LOG_ERROR("Failed to write to output file %s", chunk_consumer->GetFilename().c_str());
+                return_code = -1;
+            }
+        }
 
-        ascii_consumer.Initialize(output_filename);
-        decoder.AddConsumer(&ascii_consumer);
+        chunk_consumers.clear();
 
-        file_processor.AddDecoder(&decoder);
-        file_processor.ProcessAllFrames();
+        if (chunk_count > 1)
+        {
+            FILE*   output_file = nullptr;
+            int32_t result      = gfxrecon::util::platform::FileOpen(&output_file, output_filename.c_str(), "wb");
+
+            if ((result != 0) || (output_file == nullptr))
+            {
+                GFXRECON_LOG_ERROR("Failed to open output file %s", output_filename.c_str());
+                return_code = -1;
+            }
+
+            std::vector<uint8_t> buffer(kCopyBufferSize);
+
+            for (const auto& chunk_filename : chunk_filenames)
+            {
+                FILE* chunk_file = nullptr;
+                result           = gfxrecon::util::platform::FileOpen(&chunk_file, chunk_filename.c_str(), "rb");
+
+                if ((result == 0) && (chunk_file != nullptr))
+                {
+                    size_t read_size = 0;
+                    do
+                    {
+                        read_size = gfxrecon::util::platform::FileRead(buffer.data(), 1, buffer.size(), chunk_file);
+                        if ((read_size > 0) && (output_file != nullptr) &&
+                            (gfxrecon::util::platform::FileWrite(buffer.data(), 1, read_size, output_file) !=
+                             read_size))
+                        {
+                            GFXRECON_LOG_ERROR("Failed to write to output file %s", output_filename.c_str());
+                            gfxrecon::util::platform::FileClose(output_file);
+                            output_file = nullptr;
+                            return_code = -1;
+                        }
+                    } while (read_size == buffer.size());
+
+                    gfxrecon::util::platform::FileClose(chunk_file);
+                }
+                else
+                {
+                    GFXRECON_LOG_ERROR("Failed to open temporary file %s", chunk_filename.c_str());
+                    return_code = -1;
+                }
+
+                std::remove(chunk_filename.c_str());
+            }
+
+            if (output_file != nullptr)
+            {
+                gfxrecon::util::platform::FileClose(output_file);
+            }
+        }
+    }
+    else
+    {
+        return_code = -1;
     }
 
     gfxrecon::util::Log::Release();
-    return 0;
+    return return_code;
 }
@@ -0,0 +1,367 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "file_trimmer.h"
+
+#include "generated/generated_vulkan_struct_encoders.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cassert>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+FileTrimmer::FileTrimmer(uint32_t first_frame, uint32_t last_frame, VulkanTrimState&& trim_state) :
+    first_frame_(first_frame), last_frame_(last_frame), current_frame_(1), snapshot_frame_(first_frame),
+    snapshot_begin_written_(false), trim_state_(std::move(trim_state)), encoder_(&parameter_stream_)
+{
+    assert((first_frame_ > 0) && (first_frame_ <= last_frame_));
+}
+
+bool FileTrimmer::ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
+{
+    if (IsPastLastFrame())
+    {
+        // Returning false without setting an error state ends processing, omitting the rest of the file.
+        return false;
+    }
+
+    bool success = true;
+
+    if (IsSnapshotFrame())
+    {
+        success = WriteSnapshotBegin(1);
+
+        if (success)
+        {
+            auto submissions = trim_state_.transfer_submissions.find(GetCurrentBlockOffset());
+
+            if (submissions != trim_state_.transfer_submissions.end())
+            {
+                success = SkipFunctionCall(block_header, call_id) && WriteTransferSubmissions(submissions->second);
+            }
+            else if (IsOmittedBlock())
+            {
+                success = SkipFunctionCall(block_header, call_id);
+            }
+            else
+            {
+                success = FileTransformer::ProcessFunctionCall(block_header, call_id);
+            }
+        }
+    }
+    else
+    {
+        success = FileTransformer::ProcessFunctionCall(block_header, call_id);
+    }
+
+    if (success && (call_id == format::ApiCallId::ApiCall_vkQueuePresentKHR))
+    {
+        ++current_frame_;
+
+        if (current_frame_ == first_frame_)
+        {
+            success = WriteSnapshotEnd();
+        }
+    }
+
+    return success;
+}
+
+bool FileTrimmer::ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+{
+    if (IsPastLastFrame())
+    {
+        return false;
+    }
+
+    if (IsSnapshotFrame())
+    {
+        if (!WriteSnapshotBegin(1))
+        {
+            return false;
+        }
+
+        if (IsOmittedBlock())
+        {
+            return SkipMetaData(block_header, meta_type);
+        }
+    }
+
+    return FileTransformer::ProcessMetaData(block_header, meta_type);
+}
+
+bool FileTrimmer::ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type)
+{
+    if (!IsSnapshotFrame())
+    {
+        return FileTransformer::ProcessStateMarker(block_header, marker_type);
+    }
+
+    // The state markers from an input file that was already trimmed are replaced by the markers for the new snapshot,
+    // which includes the original snapshot.
+    uint64_t frame_number = 0;
+
+    if (!ReadBytes(&frame_number, sizeof(frame_number)))
+    {
+        HandleBlockReadError(kErrorReadingBlockData, "Failed to read state marker data");
+        return false;
+    }
+
+    if (marker_type == format::kBeginMarker)
+    {
+        return WriteSnapshotBegin(frame_number);
+    }
+
+    return true;
+}
+
+bool FileTrimmer::IsOmittedBlock() const
+{
+    return (trim_state_.omitted_block_offsets.count(GetCurrentBlockOffset()) > 0);
+}
+
+bool FileTrimmer::SkipFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id)
+{
+    if (!SkipBytes(block_header.size - sizeof(call_id)))
+    {
+        HandleBlockReadError(kErrorSeekingFile, "Failed to skip function call block data");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileTrimmer::SkipMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type)
+{
+    if (!SkipBytes(block_header.size - sizeof(meta_type)))
+    {
+        HandleBlockReadError(kErrorSeekingFile, "Failed to skip meta-data block data");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileTrimmer::WriteStateMarker(format::MarkerType marker_type, uint64_t frame_number)
+{
+    format::Marker marker;
+    marker.header.size  = sizeof(marker.marker_type) + sizeof(marker.frame_number);
+    marker.header.type  = format::kStateMarkerBlock;
+    marker.marker_type  = marker_type;
+    marker.frame_number = frame_number;
+
+    if (!WriteBytes(&marker, sizeof(marker)))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write state marker");
+        return false;
+    }
+
+    return true;
+}
+
+bool FileTrimmer::WriteSnapshotBegin(uint64_t first_captured_frame)
+{
+    if (snapshot_begin_written_)
+    {
+        return true;
+    }
+
+    snapshot_begin_written_ = true;
+    snapshot_frame_         = first_captured_frame + first_frame_ - 1;
+
+    return WriteStateMarker(format::kBeginMarker, snapshot_frame_);
+}
+
+bool FileTrimmer::WriteSnapshotEnd()
+{
+    const std::vector<format::HandleId> no_handles;
+
+    bool success = WriteSnapshotBegin(1);
+
+    // Restore the semaphores that were signaled or waited on by omitted calls, with one submission per queue.
+    for (const auto& entry : trim_state_.signaled_semaphores)
+    {
+        auto wait_entry = trim_state_.unsignaled_semaphores.find(entry.first);
+
+        const std::vector<format::HandleId>& wait_semaphore_ids =
+            (wait_entry != trim_state_.unsignaled_semaphores.end()) ? wait_entry->second : no_handles;
+
+        success = success &&
+                  WriteQueueSubmit(entry.first, no_handles, entry.second, wait_semaphore_ids, format::kNullHandleId);
+    }
+
+    for (const auto& entry : trim_state_.unsignaled_semaphores)
+    {
+        if (trim_state_.signaled_semaphores.count(entry.first) == 0)
+        {
+            success = success &&
+                      WriteQueueSubmit(entry.first, no_handles, no_handles, entry.second, format::kNullHandleId);
+        }
+    }
+
+    // Signal the fences that were signaled by omitted calls.
+    for (const auto& entry : trim_state_.signaled_fences)
+    {
+        success = success && WriteQueueSubmit(entry.second, no_handles, no_handles, no_handles, entry.first);
+    }
+
+    return success && WriteStateMarker(format::kEndMarker, snapshot_frame_);
+}
+
+bool FileTrimmer::WriteTransferSubmissions(const std::vector<VulkanTrimState::QueueSubmission>& submissions)
+{
+    const std::vector<format::HandleId> no_handles;
+
+    bool success = true;
+
+    // The transfer command buffers are submitted without semaphores, and the queue wait ensures that the transfers
+    // have completed before any later call accesses the resources.
+    for (const auto& submission : submissions)
+    {
+        success = success && WriteQueueSubmit(submission.queue_id,
+                                              submission.command_buffer_ids,
+                                              no_handles,
+                                              no_handles,
+                                              submission.fence_id);
+        success = success && WriteQueueWaitIdle(submission.queue_id);
+    }
+
+    return success;
+}
+
+bool FileTrimmer::WriteQueueSubmit(format::HandleId                     queue_id,
+                                   const std::vector<format::HandleId>& command_buffer_ids,
+                                   const std::vector<format::HandleId>& signal_semaphore_ids,
+                                   const std::vector<format::HandleId>& wait_semaphore_ids,
+                                   format::HandleId                     fence_id)
+{
+    const VkResult result = VK_SUCCESS;
+
+    std::vector<VkPipelineStageFlags> wait_dst_stage_mask(wait_semaphore_ids.size(),
+                                                          VK_PIPELINE_STAGE_ALL_COMMANDS_BIT);
+
+    uint32_t command_buffer_count   = static_cast<uint32_t>(command_buffer_ids.size());
+    uint32_t signal_semaphore_count = static_cast<uint32_t>(signal_semaphore_ids.size());
+    uint32_t wait_semaphore_count   = static_cast<uint32_t>(wait_semaphore_ids.size());
+
+    encoder_.EncodeHandleIdValue(queue_id);
+    encoder_.EncodeUInt32Value(1);
+
+    // VkSubmitInfo encoding, as a single element array to match the format of the pSubmits parameter.
+    VkSubmitInfo info = { VK_STRUCTURE_TYPE_SUBMIT_INFO };
+    encoder_.EncodeStructArrayPreamble(&info, 1);
+    encoder_.EncodeEnumValue(info.sType);
+    encode::EncodePNextStruct(&encoder_, nullptr);
+    encoder_.EncodeUInt32Value(wait_semaphore_count);
+    encoder_.EncodeHandleIdArray(wait_semaphore_ids.data(), wait_semaphore_count);
+    encoder_.EncodeFlagsArray(wait_dst_stage_mask.data(), wait_semaphore_count);
+    encoder_.EncodeUInt32Value(command_buffer_count);
+    encoder_.EncodeHandleIdArray(command_buffer_ids.data(), command_buffer_count);
+    encoder_.EncodeUInt32Value(signal_semaphore_count);
+    encoder_.EncodeHandleIdArray(signal_semaphore_ids.data(), signal_semaphore_count);
+
+    encoder_.EncodeHandleIdValue(fence_id);
+    encoder_.EncodeEnumValue(result);
+
+    bool success = WriteFunctionCall(format::ApiCallId::ApiCall_vkQueueSubmit, &parameter_stream_);
+    parameter_stream_.Reset();
+
+    return success;
+}
+
+bool FileTrimmer::WriteQueueWaitIdle(format::HandleId queue_id)
+{
+    const VkResult result = VK_SUCCESS;
+
+    encoder_.EncodeHandleIdValue(queue_id);
+    encoder_.EncodeEnumValue(result);
+
+    bool success = WriteFunctionCall(format::ApiCallId::ApiCall_vkQueueWaitIdle, &parameter_stream_);
+    parameter_stream_.Reset();
+
+    return success;
+}
+
+bool FileTrimmer::WriteFunctionCall(format::ApiCallId call_id, util::MemoryOutputStream* parameter_buffer)
+{
+    assert(parameter_buffer != nullptr);
+
+    bool                                 not_compressed      = true;
+    format::CompressedFunctionCallHeader compressed_header   = {};
+    format::FunctionCallHeader           uncompressed_header = {};
+    size_t                               uncompressed_size   = parameter_buffer->GetDataSize();
+    size_t                               header_size         = 0;
+    const void*                          header_pointer      = nullptr;
+    size_t                               data_size           = 0;
+    const void*                          data_pointer        = nullptr;
+    util::Compressor*                    compressor          = GetCompressor();
+
+    if (compressor != nullptr)
+    {
+        std::vector<uint8_t>& compressed_buffer = GetCompressedParameterBuffer();
+        size_t                compressed_size =
+            compressor->Compress(uncompressed_size, parameter_buffer->GetData(), &compressed_buffer);
+
+        if ((0 < compressed_size) && (compressed_size < uncompressed_size))
+        {
+            data_pointer   = reinterpret_cast<const void*>(compressed_buffer.data());
+            data_size      = compressed_size;
+            header_pointer = reinterpret_cast<const void*>(&compressed_header);
+            header_size    = sizeof(format::CompressedFunctionCallHeader);
+
+            compressed_header.block_header.type = format::BlockType::kCompressedFunctionCallBlock;
+            compressed_header.block_header.size = sizeof(compressed_header.api_call_id) +
+                                                  sizeof(compressed_header.uncompressed_size) +
+                                                  sizeof(compressed_header.thread_id) + compressed_size;
+            compressed_header.api_call_id       = call_id;
+            compressed_header.thread_id         = 0;
+            compressed_header.uncompressed_size = uncompressed_size;
+
+            not_compressed = false;
+        }
+    }
+
+    if (not_compressed)
+    {
+        data_pointer   = reinterpret_cast<const void*>(parameter_buffer->GetData());
+        data_size      = uncompressed_size;
+        header_pointer = reinterpret_cast<const void*>(&uncompressed_header);
+        header_size    = sizeof(format::FunctionCallHeader);
+
+        uncompressed_header.block_header.type = format::BlockType::kFunctionCallBlock;
+        uncompressed_header.block_header.size =
+            sizeof(uncompressed_header.api_call_id) + sizeof(uncompressed_header.thread_id) + data_size;
+        uncompressed_header.api_call_id = call_id;
+        uncompressed_header.thread_id   = 0;
+    }
+
+    if (!WriteBytes(header_pointer, header_size) || !WriteBytes(data_pointer, data_size))
+    {
+        HandleBlockWriteError(kErrorWritingBlockData, "Failed to write function call block");
+        return false;
+    }
+
+    return true;
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,103 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_FILE_TRIMMER_H
+#define GFXRECON_FILE_TRIMMER_H
+
+#include "vulkan_trim_state_tracker.h"
+
+#include "decode/file_transformer.h"
+#include "encode/parameter_encoder.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "util/defines.h"
+#include "util/memory_output_stream.h"
+
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// Writes a frame range from a capture file to a new capture file, preceded by a state snapshot that is synthesized
+// from the calls for the frames before the range.  The snapshot copies the blocks from the preceding frames, omitting
+// and replacing the blocks identified by a VulkanTrimStateTracker: queue submissions are replaced by submissions of
+// their transfer command buffers, and the calls that only perform per-frame work or that are superseded by later calls
+// are omitted.  Fences and semaphores are restored with empty queue submissions at the end of the snapshot.  All calls
+// after the frame range are omitted.
+//
+// Resource content that was produced by the GPU with rendering or compute work during the omitted frames is not
+// restored.
+class FileTrimmer : public decode::FileTransformer
+{
+  public:
+    FileTrimmer(uint32_t first_frame, uint32_t last_frame, VulkanTrimState&& trim_state);
+
+  protected:
+    virtual bool ProcessFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id) override;
+
+    virtual bool ProcessMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type) override;
+
+    virtual bool ProcessStateMarker(const format::BlockHeader& block_header, format::MarkerType marker_type) override;
+
+  private:
+    bool IsSnapshotFrame() const { return (current_frame_ < first_frame_); }
+
+    bool IsPastLastFrame() const { return (current_frame_ > last_frame_); }
+
+    bool IsOmittedBlock() const;
+
+    bool SkipFunctionCall(const format::BlockHeader& block_header, format::ApiCallId call_id);
+
+    bool SkipMetaData(const format::BlockHeader& block_header, format::MetaDataType meta_type);
+
+    bool WriteStateMarker(format::MarkerType marker_type, uint64_t frame_number);
+
+    // The first captured frame is the frame number from the state marker of an input file that was already trimmed.
+    bool WriteSnapshotBegin(uint64_t first_captured_frame);
+
+    bool WriteSnapshotEnd();
+
+    bool WriteTransferSubmissions(const std::vector<VulkanTrimState::QueueSubmission>& submissions);
+
+    bool WriteQueueSubmit(format::HandleId                     queue_id,
+                          const std::vector<format::HandleId>& command_buffer_ids,
+                          const std::vector<format::HandleId>& signal_semaphore_ids,
+                          const std::vector<format::HandleId>& wait_semaphore_ids,
+                          format::HandleId                     fence_id);
+
+    bool WriteQueueWaitIdle(format::HandleId queue_id);
+
+    bool WriteFunctionCall(format::ApiCallId call_id, util::MemoryOutputStream* parameter_buffer);
+
+  private:
+    uint32_t                 first_frame_;
+    uint32_t                 last_frame_;
+    uint32_t                 current_frame_;
+    uint64_t                 snapshot_frame_;
+    bool                     snapshot_begin_written_;
+    VulkanTrimState          trim_state_;
+    util::MemoryOutputStream parameter_stream_;
+    encode::ParameterEncoder encoder_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_FILE_TRIMMER_H
@@ -0,0 +1,282 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "project_version.h"
+#include "file_trimmer.h"
+#include "vulkan_trim_state_decoder.h"
+#include "vulkan_trim_state_tracker.h"
+
+#include "decode/file_processor.h"
+#include "format/format.h"
+#include "util/argument_parser.h"
+#include "util/logging.h"
+
+#include "vulkan/vulkan.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <stdexcept>
+#include <string>
+
+const char kHelpShortOption[] = "-h";
+const char kHelpLongOption[]  = "--help";
+const char kVersionOption[]   = "--version";
+const char kNoDebugPopup[]    = "--no-debug-popup";
+const char kFramesArgument[]  = "--frames";
+
+const char kOptions[]   = "-h|--help,--version,--no-debug-popup";
+const char kArguments[] = "--frames";
+
+static void PrintUsage(const char* exe_name)
+{
+    std::string app_name     = exe_name;
+    size_t      dir_location = app_name.find_last_of("/\\");
+    if (dir_location >= 0)
+    {
+        app_name.replace(0, dir_location + 1, "");
+    }
+    GFXRECON_WRITE_CONSOLE(
+        "\n%s - Create a trimmed GFXReconstruct capture file from a frame range of a capture file.\n",
+        app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Usage:");
+    GFXRECON_WRITE_CONSOLE("  %s [-h | --help] [--version] --frames <first>-<last> <input-file> <output-file>\n",
+                           app_name.c_str());
+    GFXRECON_WRITE_CONSOLE("Required arguments:");
+    GFXRECON_WRITE_CONSOLE("  --frames <first>-<last>");
+    GFXRECON_WRITE_CONSOLE("          \t\tThe range of frames to write to the new capture file, where");
+    GFXRECON_WRITE_CONSOLE("          \t\tframe numbering starts at 1.  A single frame number may be");
+    GFXRECON_WRITE_CONSOLE("          \t\tspecified to write one frame.");
+    GFXRECON_WRITE_CONSOLE("  <input-file>\t\tThe GFXReconstruct capture file to be processed.");
+    GFXRECON_WRITE_CONSOLE("  <output-file>\t\tThe name of the new GFXReconstruct capture file to be created.");
+    GFXRECON_WRITE_CONSOLE("\nOptional arguments:");
+    GFXRECON_WRITE_CONSOLE("  -h\t\t\tPrint usage information and exit (same as --help).");
+    GFXRECON_WRITE_CONSOLE("  --version\t\tPrint version information and exit.");
+#if defined(WIN32) && defined(_DEBUG)
+    GFXRECON_WRITE_CONSOLE("  --no-debug-popup\tDisable the 'Abort, Retry, Ignore' message box");
+    GFXRECON_WRITE_CONSOLE("        \t\tdisplayed when abort() is called (Windows debug only).");
+#endif
+}
+
+static bool CheckOptionPrintUsage(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kHelpShortOption) || arg_parser.IsOptionSet(kHelpLongOption))
+    {
+        PrintUsage(exe_name);
+        return true;
+    }
+
+    return false;
+}
+
+static bool CheckOptionPrintVersion(const char* exe_name, const gfxrecon::util::ArgumentParser& arg_parser)
+{
+    if (arg_parser.IsOptionSet(kVersionOption))
+    {
+        std::string app_name     = exe_name;
+        size_t      dir_location = app_name.find_last_of("/\\");
+
+        if (dir_location >= 0)
+        {
+            app_name.replace(0, dir_location + 1, "");
+        }
+
+        GFXRECON_WRITE_CONSOLE("%s version info:", app_name.c_str());
+        GFXRECON_WRITE_CONSOLE("  GFXReconstruct Version %s", GFXRECON_PROJECT_VERSION_STRING);
+        GFXRECON_WRITE_CONSOLE("  Vulkan Header Version %u.%u.%u",
+                               VK_VERSION_MAJOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_MINOR(VK_HEADER_VERSION_COMPLETE),
+                               VK_VERSION_PATCH(VK_HEADER_VERSION_COMPLETE));
+
+        return true;
+    }
+
+    return false;
+}
+
+static bool IsNumber(const std::string& value)
+{
+    size_t digit_count = static_cast<size_t>(std::count_if(value.begin(), value.end(), ::isdigit));
+    return !value.empty() && (digit_count == value.length());
+}
+
+static bool GetFrameRange(const gfxrecon::util::ArgumentParser& arg_parser, uint32_t* first_frame, uint32_t* last_frame)
+{
+    assert((first_frame != nullptr) && (last_frame != nullptr));
+
+    std::string value = arg_parser.GetArgumentValue(kFramesArgument);
+
+    // Remove whitespace.
+    value.erase(std::remove_if(value.begin(), value.end(), ::isspace), value.end());
+
+    size_t      delimiter = value.find('-');
+    std::string first     = value.substr(0, delimiter);
+    std::string last      = (delimiter != std::string::npos) ? value.substr(delimiter + 1) : first;
+
+    if (!IsNumber(first) || !IsNumber(last))
+    {
+        GFXRECON_LOG_ERROR("Invalid frame range \"%s\"", value.c_str());
+        return false;
+    }
+
+    (*first_frame) = static_cast<uint32_t>(std::stoul(first));
+    (*last_frame)  = static_cast<uint32_t>(std::stoul(last));
+
+    if (((*first_frame) == 0) || ((*first_frame) > (*last_frame)))
+    {
+        GFXRECON_LOG_ERROR("Invalid frame range \"%s\", where frame numbering starts at 1 and the first frame must not "
+                           "be greater than the last frame",
+                           value.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+static bool GetTrimState(const std::string& input_filename, uint32_t first_frame, gfxrecon::VulkanTrimState* trim_state)
+{
+    assert(trim_state != nullptr);
+
+    gfxrecon::decode::FileProcessor file_processor;
+    if (!file_processor.Initialize(input_filename))
+    {
+        return false;
+    }
+
+    gfxrecon::VulkanTrimStateTracker state_tracker(&file_processor);
+    gfxrecon::VulkanTrimStateDecoder decoder(&state_tracker);
+
+    file_processor.AddDecoder(&decoder);
+
+    // Only the frames before the frame range are processed.
+    while (((file_processor.GetCurrentFrameNumber() + 1) < first_frame) && file_processor.ProcessNextFrame())
+    {
+    }
+
+    if (file_processor.GetErrorState() != gfxrecon::decode::FileProcessor::kErrorNone)
+    {
+        GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+        return false;
+    }
+
+    if ((file_processor.GetCurrentFrameNumber() + 1) < first_frame)
+    {
+        GFXRECON_WRITE_CONSOLE("The capture file contains %u frames, which is less than the first frame of the range",
+                               file_processor.GetCurrentFrameNumber());
+        return false;
+    }
+
+    state_tracker.GetTrimState(trim_state);
+
+    return true;
+}
+
+int main(int argc, const char** argv)
+{
+    gfxrecon::util::Log::Init();
+
+    gfxrecon::util::ArgumentParser arg_parser(argc, argv, kOptions, kArguments);
+
+    if (CheckOptionPrintUsage(argv[0], arg_parser) || CheckOptionPrintVersion(argv[0], arg_parser))
+    {
+        gfxrecon::util::Log::Release();
+        exit(0);
+    }
+    else if (arg_parser.IsInvalid() || (arg_parser.GetPositionalArgumentsCount() != 2) ||
+             arg_parser.GetArgumentValue(kFramesArgument).empty())
+    {
+        PrintUsage(argv[0]);
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+    else
+    {
+#if defined(WIN32) && defined(_DEBUG)
+        if (arg_parser.IsOptionSet(kNoDebugPopup))
+        {
+            _set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+        }
+#endif
+    }
+
+    uint32_t first_frame = 0;
+    uint32_t last_frame  = 0;
+
+    if (!GetFrameRange(arg_parser, &first_frame, &last_frame))
+    {
+        gfxrecon::util::Log::Release();
+        exit(-1);
+    }
+
+    try
+    {
+        const std::vector<std::string>& positional_arguments = arg_parser.GetPositionalArguments();
+        std::string                     input_filename       = positional_arguments[0];
+        std::string                     output_filename      = positional_arguments[1];
+
+        gfxrecon::VulkanTrimState trim_state;
+
+        GFXRECON_WRITE_CONSOLE(
+            "Scanning %s for the state at the start of frame %u.", input_filename.c_str(), first_frame);
+
+        if (!GetTrimState(input_filename, first_frame, &trim_state))
+        {
+            gfxrecon::util::Log::Release();
+            exit(-1);
+        }
+
+        GFXRECON_WRITE_CONSOLE("\tOmitted blocks: %" PRIu64 ", replaced queue submissions: %" PRIu64,
+                               static_cast<uint64_t>(trim_state.omitted_block_offsets.size()),
+                               static_cast<uint64_t>(trim_state.transfer_submissions.size()));
+        GFXRECON_WRITE_CONSOLE("Writing frames %u-%u to %s.", first_frame, last_frame, output_filename.c_str());
+
+        gfxrecon::FileTrimmer file_trimmer(first_frame, last_frame, std::move(trim_state));
+
+        if (file_trimmer.Initialize(input_filename, output_filename))
+        {
+            file_trimmer.Process();
+
+            if (file_trimmer.GetErrorState() != gfxrecon::FileTrimmer::kErrorNone)
+            {
+                GFXRECON_WRITE_CONSOLE("A failure has occurred during file processing");
+                gfxrecon::util::Log::Release();
+                exit(-1);
+            }
+
+            GFXRECON_WRITE_CONSOLE("Frame range extraction complete.");
+            GFXRECON_WRITE_CONSOLE("\tTrimmed file size: %" PRIu64 " bytes", file_trimmer.GetNumBytesWritten());
+        }
+    }
+    catch (std::runtime_error error)
+    {
+        GFXRECON_WRITE_CONSOLE("File processing has encountered a fatal error and cannot continue: %s", error.what());
+        return -1;
+    }
+    catch (...)
+    {
+        GFXRECON_WRITE_CONSOLE("File processing failed due to an unhandled exception");
+        return -1;
+    }
+
+    gfxrecon::util::Log::Release();
+    return 0;
+}
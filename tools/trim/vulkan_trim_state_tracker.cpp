@@ -0,0 +1,1673 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#include "vulkan_trim_state_tracker.h"
+
+#include "decode/value_decoder.h"
+#include "util/logging.h"
+#include "util/platform.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cinttypes>
+#include <limits>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+VulkanTrimStateTracker::VulkanTrimStateTracker(const decode::FileProcessor* file_processor) :
+    file_processor_(file_processor), loading_state_(false),
+    min_created_id_(std::numeric_limits<format::HandleId>::max()), max_created_id_(format::kNullHandleId)
+{
+    assert(file_processor_ != nullptr);
+}
+
+VulkanTrimStateTracker::~VulkanTrimStateTracker() {}
+
+void VulkanTrimStateTracker::GetTrimState(VulkanTrimState* trim_state)
+{
+    assert(trim_state != nullptr);
+
+    // The current recordings of all command buffers are retained, as they may be submitted by the frames in the range.
+    // Objects that were destroyed before the range are omitted once all other omitted blocks are known.
+    OmitDestroyedObjects();
+
+    for (const auto& entry : fences_)
+    {
+        const SyncObjectInfo& info = entry.second;
+
+        if (info.signaled && !info.replay_signaled)
+        {
+            format::HandleId queue_id = GetSyncObjectQueue(info);
+
+            if (queue_id != format::kNullHandleId)
+            {
+                trim_state->signaled_fences[entry.first] = queue_id;
+            }
+            else
+            {
+                GFXRECON_LOG_WARNING("Fence %" PRIu64 " will not be signaled, as no queue was retrieved for its device",
+                                     entry.first);
+            }
+        }
+    }
+
+    for (const auto& entry : semaphores_)
+    {
+        const SyncObjectInfo& info = entry.second;
+
+        if (info.signaled != info.replay_signaled)
+        {
+            format::HandleId queue_id = GetSyncObjectQueue(info);
+
+            if (queue_id == format::kNullHandleId)
+            {
+                GFXRECON_LOG_WARNING("Semaphore %" PRIu64 " will not be restored, as no queue was retrieved for its "
+                                     "device",
+                                     entry.first);
+            }
+            else if (info.signaled)
+            {
+                trim_state->signaled_semaphores[queue_id].push_back(entry.first);
+            }
+            else
+            {
+                trim_state->unsignaled_semaphores[queue_id].push_back(entry.first);
+            }
+        }
+    }
+
+    // Sort the semaphores for consistent output.
+    for (auto& entry : trim_state->signaled_semaphores)
+    {
+        std::sort(entry.second.begin(), entry.second.end());
+    }
+
+    for (auto& entry : trim_state->unsignaled_semaphores)
+    {
+        std::sort(entry.second.begin(), entry.second.end());
+    }
+
+    trim_state->omitted_block_offsets = std::move(omitted_block_offsets_);
+    trim_state->transfer_submissions  = std::move(transfer_submissions_);
+}
+
+bool VulkanTrimStateTracker::IsRecordingCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkResetCommandPool:
+        case format::ApiCallId::ApiCall_vkResetCommandBuffer:
+        case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+        case format::ApiCallId::ApiCall_vkEndCommandBuffer:
+        case format::ApiCallId::ApiCall_vkCmdBindPipeline:
+        case format::ApiCallId::ApiCall_vkCmdSetViewport:
+        case format::ApiCallId::ApiCall_vkCmdSetScissor:
+        case format::ApiCallId::ApiCall_vkCmdSetLineWidth:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBias:
+        case format::ApiCallId::ApiCall_vkCmdSetBlendConstants:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBounds:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilCompareMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilWriteMask:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilReference:
+        case format::ApiCallId::ApiCall_vkCmdBindDescriptorSets:
+        case format::ApiCallId::ApiCall_vkCmdBindIndexBuffer:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers:
+        case format::ApiCallId::ApiCall_vkCmdDraw:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexed:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirect:
+        case format::ApiCallId::ApiCall_vkCmdDispatch:
+        case format::ApiCallId::ApiCall_vkCmdDispatchIndirect:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+        case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
+        case format::ApiCallId::ApiCall_vkCmdFillBuffer:
+        case format::ApiCallId::ApiCall_vkCmdClearColorImage:
+        case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+        case format::ApiCallId::ApiCall_vkCmdClearAttachments:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage:
+        case format::ApiCallId::ApiCall_vkCmdSetEvent:
+        case format::ApiCallId::ApiCall_vkCmdResetEvent:
+        case format::ApiCallId::ApiCall_vkCmdWaitEvents:
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
+        case format::ApiCallId::ApiCall_vkCmdBeginQuery:
+        case format::ApiCallId::ApiCall_vkCmdEndQuery:
+        case format::ApiCallId::ApiCall_vkCmdResetQueryPool:
+        case format::ApiCallId::ApiCall_vkCmdWriteTimestamp:
+        case format::ApiCallId::ApiCall_vkCmdCopyQueryPoolResults:
+        case format::ApiCallId::ApiCall_vkCmdPushConstants:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass:
+        case format::ApiCallId::ApiCall_vkCmdExecuteCommands:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMask:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBase:
+        case format::ApiCallId::ApiCall_vkCmdSetDeviceMaskKHR:
+        case format::ApiCallId::ApiCall_vkCmdDispatchBaseKHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetKHR:
+        case format::ApiCallId::ApiCall_vkCmdPushDescriptorSetWithTemplateKHR:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2KHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountKHR:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCountAMD:
+        case format::ApiCallId::ApiCall_vkCmdBeginConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndConditionalRenderingEXT:
+        case format::ApiCallId::ApiCall_vkCmdProcessCommandsNVX:
+        case format::ApiCallId::ApiCall_vkCmdReserveSpaceForCommandsNVX:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWScalingNV:
+        case format::ApiCallId::ApiCall_vkCmdSetDiscardRectangleEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetSampleLocationsEXT:
+        case format::ApiCallId::ApiCall_vkCmdWriteBufferMarkerAMD:
+        case format::ApiCallId::ApiCall_vkCmdBindShadingRateImageNV:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportShadingRatePaletteNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCoarseSampleOrderNV:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureNV:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysNV:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectNV:
+        case format::ApiCallId::ApiCall_vkCmdDrawMeshTasksIndirectCountNV:
+        case format::ApiCallId::ApiCall_vkCmdSetExclusiveScissorNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCheckpointNV:
+        case format::ApiCallId::ApiCall_vkCmdBindTransformFeedbackBuffersEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndTransformFeedbackEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndQueryIndexedEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectByteCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceStreamMarkerINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetPerformanceOverrideINTEL:
+        case format::ApiCallId::ApiCall_vkCmdSetLineStippleEXT:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdDrawIndexedIndirectCount:
+        case format::ApiCallId::ApiCall_vkCmdBeginRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdNextSubpass2:
+        case format::ApiCallId::ApiCall_vkCmdEndRenderPass2:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresKHR:
+        case format::ApiCallId::ApiCall_vkCmdBuildAccelerationStructuresIndirectKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyAccelerationStructureToMemoryKHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyMemoryToAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysKHR:
+        case format::ApiCallId::ApiCall_vkCmdWriteAccelerationStructuresPropertiesKHR:
+        case format::ApiCallId::ApiCall_vkCmdTraceRaysIndirectKHR:
+        case format::ApiCallId::ApiCall_vkCmdPreprocessGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdExecuteGeneratedCommandsNV:
+        case format::ApiCallId::ApiCall_vkCmdBindPipelineShaderGroupNV:
+        case format::ApiCallId::ApiCall_vkCmdSetCullModeEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetFrontFaceEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetPrimitiveTopologyEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetViewportWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetScissorWithCountEXT:
+        case format::ApiCallId::ApiCall_vkCmdBindVertexBuffers2EXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthWriteEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthCompareOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetDepthBoundsTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilTestEnableEXT:
+        case format::ApiCallId::ApiCall_vkCmdSetStencilOpEXT:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdSetRayTracingPipelineStackSizeKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateKHR:
+        case format::ApiCallId::ApiCall_vkCmdSetFragmentShadingRateEnumNV:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanTrimStateTracker::IsFrameWorkCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkQueueSubmit:
+        case format::ApiCallId::ApiCall_vkQueuePresentKHR:
+        case format::ApiCallId::ApiCall_vkAcquireNextImageKHR:
+        case format::ApiCallId::ApiCall_vkAcquireNextImage2KHR:
+        case format::ApiCallId::ApiCall_vkQueueWaitIdle:
+        case format::ApiCallId::ApiCall_vkDeviceWaitIdle:
+        case format::ApiCallId::ApiCall_vkWaitForFences:
+        case format::ApiCallId::ApiCall_vkGetFenceStatus:
+        case format::ApiCallId::ApiCall_vkWaitSemaphores:
+        case format::ApiCallId::ApiCall_vkWaitSemaphoresKHR:
+        case format::ApiCallId::ApiCall_vkGetEventStatus:
+        case format::ApiCallId::ApiCall_vkGetQueryPoolResults:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanTrimStateTracker::IsTransferCommand(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkBeginCommandBuffer:
+        case format::ApiCallId::ApiCall_vkEndCommandBuffer:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer:
+        case format::ApiCallId::ApiCall_vkCmdUpdateBuffer:
+        case format::ApiCallId::ApiCall_vkCmdFillBuffer:
+        case format::ApiCallId::ApiCall_vkCmdClearColorImage:
+        case format::ApiCallId::ApiCall_vkCmdClearDepthStencilImage:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage:
+        case format::ApiCallId::ApiCall_vkCmdPipelineBarrier:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerBeginEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerEndEXT:
+        case format::ApiCallId::ApiCall_vkCmdDebugMarkerInsertEXT:
+        case format::ApiCallId::ApiCall_vkCmdBeginDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdEndDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdInsertDebugUtilsLabelEXT:
+        case format::ApiCallId::ApiCall_vkCmdCopyBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyBufferToImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdCopyImageToBuffer2KHR:
+        case format::ApiCallId::ApiCall_vkCmdBlitImage2KHR:
+        case format::ApiCallId::ApiCall_vkCmdResolveImage2KHR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanTrimStateTracker::IsObjectDestroyCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkFreeMemory:
+        case format::ApiCallId::ApiCall_vkDestroyBuffer:
+        case format::ApiCallId::ApiCall_vkDestroyBufferView:
+        case format::ApiCallId::ApiCall_vkDestroyImage:
+        case format::ApiCallId::ApiCall_vkDestroyImageView:
+        case format::ApiCallId::ApiCall_vkDestroySampler:
+        case format::ApiCallId::ApiCall_vkDestroyShaderModule:
+        case format::ApiCallId::ApiCall_vkDestroyFence:
+        case format::ApiCallId::ApiCall_vkDestroySemaphore:
+        case format::ApiCallId::ApiCall_vkDestroyEvent:
+        case format::ApiCallId::ApiCall_vkDestroyQueryPool:
+        case format::ApiCallId::ApiCall_vkDestroyFramebuffer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanTrimStateTracker::IsObjectOwnedCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkMapMemory:
+        case format::ApiCallId::ApiCall_vkUnmapMemory:
+        case format::ApiCallId::ApiCall_vkGetDeviceMemoryCommitment:
+        case format::ApiCallId::ApiCall_vkBindBufferMemory:
+        case format::ApiCallId::ApiCall_vkBindImageMemory:
+        case format::ApiCallId::ApiCall_vkGetBufferMemoryRequirements:
+        case format::ApiCallId::ApiCall_vkGetImageMemoryRequirements:
+        case format::ApiCallId::ApiCall_vkGetImageSparseMemoryRequirements:
+        case format::ApiCallId::ApiCall_vkGetImageSubresourceLayout:
+        case format::ApiCallId::ApiCall_vkGetFenceStatus:
+        case format::ApiCallId::ApiCall_vkGetEventStatus:
+        case format::ApiCallId::ApiCall_vkSetEvent:
+        case format::ApiCallId::ApiCall_vkResetEvent:
+        case format::ApiCallId::ApiCall_vkGetQueryPoolResults:
+        case format::ApiCallId::ApiCall_vkResetQueryPool:
+        case format::ApiCallId::ApiCall_vkResetQueryPoolEXT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanTrimStateTracker::IsOmittableCall(format::ApiCallId call_id)
+{
+    if (IsRecordingCall(call_id) || IsFrameWorkCall(call_id) || IsObjectOwnedCall(call_id))
+    {
+        return true;
+    }
+
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkUpdateDescriptorSets:
+        case format::ApiCallId::ApiCall_vkAllocateMemory:
+        case format::ApiCallId::ApiCall_vkCreateBuffer:
+        case format::ApiCallId::ApiCall_vkCreateBufferView:
+        case format::ApiCallId::ApiCall_vkCreateImage:
+        case format::ApiCallId::ApiCall_vkCreateImageView:
+        case format::ApiCallId::ApiCall_vkCreateSampler:
+        case format::ApiCallId::ApiCall_vkCreateShaderModule:
+        case format::ApiCallId::ApiCall_vkCreateFence:
+        case format::ApiCallId::ApiCall_vkCreateSemaphore:
+        case format::ApiCallId::ApiCall_vkCreateEvent:
+        case format::ApiCallId::ApiCall_vkCreateQueryPool:
+        case format::ApiCallId::ApiCall_vkCreateFramebuffer:
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool VulkanTrimStateTracker::IsMemoryReadCall(format::ApiCallId call_id)
+{
+    switch (call_id)
+    {
+        case format::ApiCallId::ApiCall_vkQueueBindSparse:
+        case format::ApiCallId::ApiCall_vkBuildAccelerationStructuresKHR:
+        case format::ApiCallId::ApiCall_vkCopyAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkCopyAccelerationStructureToMemoryKHR:
+        case format::ApiCallId::ApiCall_vkCopyMemoryToAccelerationStructureKHR:
+        case format::ApiCallId::ApiCall_vkWriteAccelerationStructuresPropertiesKHR:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void VulkanTrimStateTracker::OmitBlock(uint64_t block_offset)
+{
+    // Blocks from a loaded state snapshot are always retained.
+    if (!loading_state_)
+    {
+        omitted_block_offsets_.insert(block_offset);
+    }
+}
+
+void VulkanTrimStateTracker::TrackRecordingCall(format::ApiCallId call_id,
+                                                const uint8_t*    parameter_buffer,
+                                                size_t            buffer_size)
+{
+    format::HandleId handle_id  = format::kNullHandleId;
+    size_t           bytes_read = decode::ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &handle_id);
+
+    if (call_id == format::ApiCallId::ApiCall_vkResetCommandPool)
+    {
+        // The device is followed by the command pool.
+        format::HandleId pool_id = format::kNullHandleId;
+        decode::ValueDecoder::DecodeHandleIdValue(parameter_buffer + bytes_read, buffer_size - bytes_read, &pool_id);
+
+        EndPoolRecordings(pool_id);
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkResetCommandBuffer)
+    {
+        EndRecording(handle_id);
+    }
+    else if (call_id == format::ApiCallId::ApiCall_vkBeginCommandBuffer)
+    {
+        EndRecording(handle_id);
+        BeginRecording(handle_id);
+    }
+    else
+    {
+        auto entry = command_buffers_.find(handle_id);
+        if ((entry != command_buffers_.end()) && !entry->second.recording_block_offsets.empty())
+        {
+            entry->second.recording_block_offsets.push_back(GetCurrentBlockOffset());
+
+            if (!IsTransferCommand(call_id))
+            {
+                entry->second.transfer_only = false;
+            }
+        }
+    }
+}
+
+void VulkanTrimStateTracker::BeginRecording(format::HandleId command_buffer_id)
+{
+    CommandBufferInfo& info = command_buffers_[command_buffer_id];
+
+    info.recording_block_offsets.assign(1, GetCurrentBlockOffset());
+    info.transfer_only = true;
+    info.retained      = loading_state_;
+}
+
+void VulkanTrimStateTracker::EndRecording(format::HandleId command_buffer_id)
+{
+    auto entry = command_buffers_.find(command_buffer_id);
+    if (entry != command_buffers_.end())
+    {
+        CommandBufferInfo& info = entry->second;
+
+        if (!info.retained)
+        {
+            // The recording was superseded without being executed by a retained submission.
+            for (uint64_t block_offset : info.recording_block_offsets)
+            {
+                OmitBlock(block_offset);
+            }
+        }
+
+        info.recording_block_offsets.clear();
+        info.transfer_only = true;
+        info.retained      = false;
+    }
+}
+
+void VulkanTrimStateTracker::EndPoolRecordings(format::HandleId pool_id)
+{
+    auto entry = command_pools_.find(pool_id);
+    if (entry != command_pools_.end())
+    {
+        for (format::HandleId command_buffer_id : entry->second)
+        {
+            EndRecording(command_buffer_id);
+        }
+    }
+}
+
+void VulkanTrimStateTracker::SignalSyncObject(SyncObjectMap*   sync_objects,
+                                              format::HandleId object_id,
+                                              format::HandleId queue_id,
+                                              bool             retained)
+{
+    assert(sync_objects != nullptr);
+
+    auto entry = sync_objects->find(object_id);
+    if (entry != sync_objects->end())
+    {
+        SyncObjectInfo& info = entry->second;
+
+        info.signaled        = true;
+        info.replay_signaled = info.replay_signaled || retained;
+
+        if (queue_id != format::kNullHandleId)
+        {
+            info.queue_id = queue_id;
+        }
+    }
+}
+
+void VulkanTrimStateTracker::UnsignalSemaphore(format::HandleId semaphore_id, bool retained)
+{
+    auto entry = semaphores_.find(semaphore_id);
+    if (entry != semaphores_.end())
+    {
+        entry->second.signaled        = false;
+        entry->second.replay_signaled = entry->second.replay_signaled && !retained;
+    }
+}
+
+format::HandleId VulkanTrimStateTracker::GetSyncObjectQueue(const SyncObjectInfo& info) const
+{
+    if (info.queue_id != format::kNullHandleId)
+    {
+        return info.queue_id;
+    }
+
+    // Objects signaled by image acquisition are signaled with the first queue that was retrieved for the device.
+    auto entry = device_queues_.find(info.device_id);
+    if (entry != device_queues_.end())
+    {
+        return entry->second;
+    }
+
+    return format::kNullHandleId;
+}
+
+void VulkanTrimStateTracker::ReleaseDescriptorWrite(uint64_t block_offset)
+{
+    auto entry = descriptor_write_counts_.find(block_offset);
+    if (entry != descriptor_write_counts_.end())
+    {
+        assert(entry->second > 0);
+
+        if (--entry->second == 0)
+        {
+            // None of the descriptors that were written by the update have their values at the start of the range.
+            OmitBlock(block_offset);
+            descriptor_write_counts_.erase(entry);
+        }
+    }
+}
+
+void VulkanTrimStateTracker::ReleaseDescriptorSet(format::HandleId set_id)
+{
+    auto entry = descriptor_writes_.find(set_id);
+    if (entry != descriptor_writes_.end())
+    {
+        for (const auto& write : entry->second)
+        {
+            ReleaseDescriptorWrite(write.second);
+        }
+
+        descriptor_writes_.erase(entry);
+    }
+}
+
+void VulkanTrimStateTracker::RetainDescriptorSet(format::HandleId set_id)
+{
+    auto entry = descriptor_writes_.find(set_id);
+    if (entry != descriptor_writes_.end())
+    {
+        // Removing the write counts for the updates excludes them from further analysis.
+        for (const auto& write : entry->second)
+        {
+            descriptor_write_counts_.erase(write.second);
+        }
+
+        descriptor_writes_.erase(entry);
+    }
+}
+
+void VulkanTrimStateTracker::ReleaseDescriptorPool(format::HandleId pool_id)
+{
+    auto entry = descriptor_pools_.find(pool_id);
+    if (entry != descriptor_pools_.end())
+    {
+        for (format::HandleId set_id : entry->second)
+        {
+            ReleaseDescriptorSet(set_id);
+        }
+
+        descriptor_pools_.erase(entry);
+    }
+}
+
+template <typename T>
+void VulkanTrimStateTracker::TrackCreatedObject(VkResult result, decode::HandlePointerDecoder<T>* handle)
+{
+    assert(handle != nullptr);
+
+    if (!loading_state_ && (result == VK_SUCCESS) && !handle->IsNull() && (handle->GetPointer() != nullptr))
+    {
+        format::HandleId object_id = *handle->GetPointer();
+
+        if (object_id != format::kNullHandleId)
+        {
+            created_objects_[object_id].create_block_offset = GetCurrentBlockOffset();
+            min_created_id_                                 = std::min(min_created_id_, object_id);
+            max_created_id_                                 = std::max(max_created_id_, object_id);
+        }
+    }
+}
+
+void VulkanTrimStateTracker::TrackDestroyedObject(format::HandleId object_id)
+{
+    auto entry = created_objects_.find(object_id);
+    if (entry != created_objects_.end())
+    {
+        entry->second.destroy_block_offset = GetCurrentBlockOffset();
+        destroyed_objects_.emplace(object_id, std::move(entry->second));
+        created_objects_.erase(entry);
+    }
+}
+
+void VulkanTrimStateTracker::TrackReferencedObject(format::HandleId object_id,
+                                                   format::HandleId owner_id,
+                                                   bool             omittable)
+{
+    if ((object_id >= min_created_id_) && (object_id <= max_created_id_))
+    {
+        auto entry = created_objects_.find(object_id);
+        if (entry != created_objects_.end())
+        {
+            uint64_t               block_offset = GetCurrentBlockOffset();
+            std::vector<uint64_t>* block_offsets =
+                (object_id == owner_id) ? &entry->second.owned_block_offsets : &entry->second.referencing_block_offsets;
+
+            if (!omittable)
+            {
+                // The object is referenced by a block that is always retained, so it must also be retained.
+                created_objects_.erase(entry);
+            }
+            else if (block_offsets->empty() || (block_offsets->back() != block_offset))
+            {
+                block_offsets->push_back(block_offset);
+            }
+
+            if (created_objects_.empty())
+            {
+                min_created_id_ = std::numeric_limits<format::HandleId>::max();
+                max_created_id_ = format::kNullHandleId;
+            }
+        }
+    }
+}
+
+void VulkanTrimStateTracker::OmitDestroyedObjects()
+{
+    // Omitting an object omits its creation call, which may be the last remaining reference to another object, so the
+    // objects are processed until no more can be omitted.
+    bool omitted = true;
+
+    while (omitted)
+    {
+        omitted = false;
+
+        for (auto entry = destroyed_objects_.begin(); entry != destroyed_objects_.end();)
+        {
+            const ObjectInfo& info = entry->second;
+
+            bool referenced = std::any_of(info.referencing_block_offsets.begin(),
+                                          info.referencing_block_offsets.end(),
+                                          [this](uint64_t block_offset) {
+                                              return (omitted_block_offsets_.count(block_offset) == 0);
+                                          });
+
+            if (!referenced)
+            {
+                omitted_block_offsets_.insert(info.create_block_offset);
+                omitted_block_offsets_.insert(info.destroy_block_offset);
+                omitted_block_offsets_.insert(info.owned_block_offsets.begin(), info.owned_block_offsets.end());
+
+                entry   = destroyed_objects_.erase(entry);
+                omitted = true;
+            }
+            else
+            {
+                ++entry;
+            }
+        }
+    }
+}
+
+void VulkanTrimStateTracker::ProcessParameterData(format::ApiCallId call_id,
+                                                  const uint8_t*    parameter_buffer,
+                                                  size_t            buffer_size)
+{
+    assert((parameter_buffer != nullptr) || (buffer_size == 0));
+
+    if (IsRecordingCall(call_id))
+    {
+        TrackRecordingCall(call_id, parameter_buffer, buffer_size);
+    }
+    else if (IsFrameWorkCall(call_id) && (call_id != format::ApiCallId::ApiCall_vkQueueSubmit))
+    {
+        // Queue submissions are omitted or replaced after their command buffers have been decoded.
+        OmitBlock(GetCurrentBlockOffset());
+    }
+
+    if (IsMemoryReadCall(call_id))
+    {
+        pending_fills_.clear();
+    }
+
+    // The destroy calls only reference the device and the object being destroyed, which are processed separately.
+    // The references from queue submissions are processed for the submissions that are retained.
+    if (created_objects_.empty() || IsObjectDestroyCall(call_id) ||
+        (call_id == format::ApiCallId::ApiCall_vkQueueSubmit))
+    {
+        return;
+    }
+
+    format::HandleId owner_id  = format::kNullHandleId;
+    bool             omittable = IsOmittableCall(call_id);
+
+    if (IsObjectOwnedCall(call_id))
+    {
+        // The device is followed by the object.
+        size_t bytes_read = decode::ValueDecoder::DecodeHandleIdValue(parameter_buffer, buffer_size, &owner_id);
+        decode::ValueDecoder::DecodeHandleIdValue(parameter_buffer + bytes_read, buffer_size - bytes_read, &owner_id);
+    }
+
+    // Handle IDs are not aligned within the parameter data, so every byte offset is checked.
+    for (size_t i = 0; ((i + sizeof(format::HandleId)) <= buffer_size) && !created_objects_.empty(); ++i)
+    {
+        format::HandleId value;
+        util::platform::MemoryCopy(&value, sizeof(value), &parameter_buffer[i], sizeof(value));
+
+        TrackReferencedObject(value, owner_id, omittable);
+    }
+}
+
+bool VulkanTrimStateTracker::IsMetaDataOfInterest(format::MetaDataType meta_type) const
+{
+    return ((meta_type == format::MetaDataType::kFillMemoryCommand) ||
+            (meta_type == format::MetaDataType::kCreateHardwareBufferCommand) ||
+            (meta_type == format::MetaDataType::kSetOpaqueAddressCommand));
+}
+
+void VulkanTrimStateTracker::ProcessStateBeginMarker(uint64_t frame_number)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(frame_number);
+
+    loading_state_ = true;
+}
+
+void VulkanTrimStateTracker::ProcessStateEndMarker(uint64_t frame_number)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(frame_number);
+
+    // Resource initialization performed while loading state may read from memory, so the state snapshot acts as a
+    // barrier for fill memory analysis.
+    loading_state_ = false;
+    pending_fills_.clear();
+}
+
+void VulkanTrimStateTracker::ProcessCreateHardwareBufferCommand(
+    format::HandleId                                    memory_id,
+    uint64_t                                            buffer_id,
+    uint32_t                                            format,
+    uint32_t                                            width,
+    uint32_t                                            height,
+    uint32_t                                            stride,
+    uint32_t                                            usage,
+    uint32_t                                            layers,
+    const std::vector<format::HardwareBufferPlaneInfo>& plane_info)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(buffer_id);
+    GFXRECON_UNREFERENCED_PARAMETER(format);
+    GFXRECON_UNREFERENCED_PARAMETER(width);
+    GFXRECON_UNREFERENCED_PARAMETER(height);
+    GFXRECON_UNREFERENCED_PARAMETER(stride);
+    GFXRECON_UNREFERENCED_PARAMETER(usage);
+    GFXRECON_UNREFERENCED_PARAMETER(layers);
+    GFXRECON_UNREFERENCED_PARAMETER(plane_info);
+
+    TrackReferencedObject(memory_id, format::kNullHandleId, false);
+}
+
+void VulkanTrimStateTracker::ProcessSetOpaqueAddressCommand(format::HandleId device_id,
+                                                            format::HandleId object_id,
+                                                            uint64_t         address)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device_id);
+    GFXRECON_UNREFERENCED_PARAMETER(address);
+
+    TrackReferencedObject(object_id, format::kNullHandleId, false);
+}
+
+void VulkanTrimStateTracker::ProcessFillMemoryCommand(uint64_t       memory_id,
+                                                      uint64_t       offset,
+                                                      uint64_t       size,
+                                                      const uint8_t* data)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(data);
+
+    TrackReferencedObject(memory_id, memory_id, true);
+
+    if (!loading_state_)
+    {
+        auto& pending = pending_fills_[memory_id];
+
+        // Earlier writes that are fully covered by the new write have not been read by a retained submission, and the
+        // frames in the range will only read the new data.
+        auto covered = std::remove_if(pending.begin(), pending.end(), [&](const PendingFill& fill) {
+            if ((fill.offset >= offset) && ((fill.offset + fill.size) <= (offset + size)))
+            {
+                OmitBlock(fill.block_offset);
+                return true;
+            }
+            return false;
+        });
+
+        pending.erase(covered, pending.end());
+        pending.push_back({ GetCurrentBlockOffset(), offset, size });
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkGetDeviceQueue(format::HandleId                       device,
+                                                      uint32_t                               queueFamilyIndex,
+                                                      uint32_t                               queueIndex,
+                                                      decode::HandlePointerDecoder<VkQueue>* pQueue)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(queueFamilyIndex);
+    GFXRECON_UNREFERENCED_PARAMETER(queueIndex);
+
+    assert(pQueue != nullptr);
+
+    if (!pQueue->IsNull() && (pQueue->GetPointer() != nullptr))
+    {
+        device_queues_.emplace(device, *pQueue->GetPointer());
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkGetDeviceQueue2(
+    format::HandleId                                                  device,
+    decode::StructPointerDecoder<decode::Decoded_VkDeviceQueueInfo2>* pQueueInfo,
+    decode::HandlePointerDecoder<VkQueue>*                            pQueue)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pQueueInfo);
+
+    assert(pQueue != nullptr);
+
+    if (!pQueue->IsNull() && (pQueue->GetPointer() != nullptr))
+    {
+        device_queues_.emplace(device, *pQueue->GetPointer());
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkQueueSubmit(
+    VkResult                                                    returnValue,
+    format::HandleId                                            queue,
+    uint32_t                                                    submitCount,
+    decode::StructPointerDecoder<decode::Decoded_VkSubmitInfo>* pSubmits,
+    format::HandleId                                            fence)
+{
+    assert(pSubmits != nullptr);
+
+    uint64_t                                      block_offset = GetCurrentBlockOffset();
+    std::vector<VulkanTrimState::QueueSubmission> submissions;
+
+    if (returnValue != VK_SUCCESS)
+    {
+        OmitBlock(block_offset);
+        return;
+    }
+
+    const VkSubmitInfo*                 submit_infos = pSubmits->GetPointer();
+    const decode::Decoded_VkSubmitInfo* submit_metas = pSubmits->GetMetaStructPointer();
+
+    if ((submit_infos != nullptr) && (submit_metas != nullptr))
+    {
+        for (uint32_t i = 0; i < submitCount; ++i)
+        {
+            const format::HandleId* wait_ids   = submit_metas[i].pWaitSemaphores.GetPointer();
+            const format::HandleId* buffer_ids = submit_metas[i].pCommandBuffers.GetPointer();
+            const format::HandleId* signal_ids = submit_metas[i].pSignalSemaphores.GetPointer();
+
+            VulkanTrimState::QueueSubmission submission;
+            submission.queue_id = queue;
+
+            for (uint32_t j = 0; (wait_ids != nullptr) && (j < submit_infos[i].waitSemaphoreCount); ++j)
+            {
+                UnsignalSemaphore(wait_ids[j], loading_state_);
+            }
+
+            for (uint32_t j = 0; (buffer_ids != nullptr) && (j < submit_infos[i].commandBufferCount); ++j)
+            {
+                auto entry = command_buffers_.find(buffer_ids[j]);
+                if (!loading_state_ && (entry != command_buffers_.end()) && entry->second.transfer_only &&
+                    !entry->second.recording_block_offsets.empty())
+                {
+                    entry->second.retained = true;
+                    submission.command_buffer_ids.push_back(buffer_ids[j]);
+                }
+            }
+
+            for (uint32_t j = 0; (signal_ids != nullptr) && (j < submit_infos[i].signalSemaphoreCount); ++j)
+            {
+                SignalSyncObject(&semaphores_, signal_ids[j], queue, loading_state_);
+            }
+
+            if (!submission.command_buffer_ids.empty())
+            {
+                submissions.emplace_back(std::move(submission));
+            }
+        }
+    }
+
+    bool retained = loading_state_ || !submissions.empty();
+
+    if (retained)
+    {
+        // The retained submissions may read memory that was written by fill memory commands.
+        pending_fills_.clear();
+    }
+
+    if (fence != format::kNullHandleId)
+    {
+        SignalSyncObject(&fences_, fence, queue, retained);
+    }
+
+    if (!submissions.empty())
+    {
+        // The last of the replacement submissions signals the fence.
+        submissions.back().fence_id = fence;
+        transfer_submissions_.emplace(block_offset, std::move(submissions));
+
+        TrackReferencedObject(fence, format::kNullHandleId, true);
+    }
+    else
+    {
+        OmitBlock(block_offset);
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkQueueBindSparse(
+    VkResult                                                        returnValue,
+    format::HandleId                                                queue,
+    uint32_t                                                        bindInfoCount,
+    decode::StructPointerDecoder<decode::Decoded_VkBindSparseInfo>* pBindInfo,
+    format::HandleId                                                fence)
+{
+    assert(pBindInfo != nullptr);
+
+    if (returnValue != VK_SUCCESS)
+    {
+        return;
+    }
+
+    // Sparse binding operations are retained, along with their semaphore and fence operations.
+    const VkBindSparseInfo*                 bind_infos = pBindInfo->GetPointer();
+    const decode::Decoded_VkBindSparseInfo* bind_metas = pBindInfo->GetMetaStructPointer();
+
+    if ((bind_infos != nullptr) && (bind_metas != nullptr))
+    {
+        for (uint32_t i = 0; i < bindInfoCount; ++i)
+        {
+            const format::HandleId* wait_ids   = bind_metas[i].pWaitSemaphores.GetPointer();
+            const format::HandleId* signal_ids = bind_metas[i].pSignalSemaphores.GetPointer();
+
+            for (uint32_t j = 0; (wait_ids != nullptr) && (j < bind_infos[i].waitSemaphoreCount); ++j)
+            {
+                UnsignalSemaphore(wait_ids[j], true);
+            }
+
+            for (uint32_t j = 0; (signal_ids != nullptr) && (j < bind_infos[i].signalSemaphoreCount); ++j)
+            {
+                SignalSyncObject(&semaphores_, signal_ids[j], queue, true);
+            }
+        }
+    }
+
+    if (fence != format::kNullHandleId)
+    {
+        SignalSyncObject(&fences_, fence, queue, true);
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkQueuePresentKHR(
+    VkResult                                                        returnValue,
+    format::HandleId                                                queue,
+    decode::StructPointerDecoder<decode::Decoded_VkPresentInfoKHR>* pPresentInfo)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(returnValue);
+    GFXRECON_UNREFERENCED_PARAMETER(queue);
+
+    assert(pPresentInfo != nullptr);
+
+    const VkPresentInfoKHR*                 present_info = pPresentInfo->GetPointer();
+    const decode::Decoded_VkPresentInfoKHR* present_meta = pPresentInfo->GetMetaStructPointer();
+
+    if ((present_info != nullptr) && (present_meta != nullptr))
+    {
+        const format::HandleId* wait_ids = present_meta->pWaitSemaphores.GetPointer();
+
+        for (uint32_t i = 0; (wait_ids != nullptr) && (i < present_info->waitSemaphoreCount); ++i)
+        {
+            UnsignalSemaphore(wait_ids[i], loading_state_);
+        }
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkAcquireNextImageKHR(VkResult                          returnValue,
+                                                           format::HandleId                  device,
+                                                           format::HandleId                  swapchain,
+                                                           uint64_t                          timeout,
+                                                           format::HandleId                  semaphore,
+                                                           format::HandleId                  fence,
+                                                           decode::PointerDecoder<uint32_t>* pImageIndex)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(swapchain);
+    GFXRECON_UNREFERENCED_PARAMETER(timeout);
+    GFXRECON_UNREFERENCED_PARAMETER(pImageIndex);
+
+    if ((returnValue == VK_SUCCESS) || (returnValue == VK_SUBOPTIMAL_KHR))
+    {
+        SignalSyncObject(&semaphores_, semaphore, format::kNullHandleId, loading_state_);
+        SignalSyncObject(&fences_, fence, format::kNullHandleId, loading_state_);
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkAcquireNextImage2KHR(
+    VkResult                                                                 returnValue,
+    format::HandleId                                                         device,
+    decode::StructPointerDecoder<decode::Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
+    decode::PointerDecoder<uint32_t>*                                        pImageIndex)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pImageIndex);
+
+    assert(pAcquireInfo != nullptr);
+
+    const decode::Decoded_VkAcquireNextImageInfoKHR* acquire_meta = pAcquireInfo->GetMetaStructPointer();
+
+    if (((returnValue == VK_SUCCESS) || (returnValue == VK_SUBOPTIMAL_KHR)) && (acquire_meta != nullptr))
+    {
+        SignalSyncObject(&semaphores_, acquire_meta->semaphore, format::kNullHandleId, loading_state_);
+        SignalSyncObject(&fences_, acquire_meta->fence, format::kNullHandleId, loading_state_);
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkCreateFence(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkFenceCreateInfo>*     pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkFence>*                               pFence)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    assert((pCreateInfo != nullptr) && (pFence != nullptr));
+
+    const VkFenceCreateInfo* create_info = pCreateInfo->GetPointer();
+
+    if ((returnValue == VK_SUCCESS) && (create_info != nullptr) && (pFence->GetPointer() != nullptr))
+    {
+        SyncObjectInfo& info = fences_[*pFence->GetPointer()];
+
+        info.device_id       = device;
+        info.signaled        = ((create_info->flags & VK_FENCE_CREATE_SIGNALED_BIT) == VK_FENCE_CREATE_SIGNALED_BIT);
+        info.replay_signaled = info.signaled;
+    }
+
+    TrackCreatedObject(returnValue, pFence);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyFence(
+    format::HandleId                                                     device,
+    format::HandleId                                                     fence,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    fences_.erase(fence);
+    TrackDestroyedObject(fence);
+}
+
+void VulkanTrimStateTracker::Process_vkResetFences(VkResult                               returnValue,
+                                                   format::HandleId                       device,
+                                                   uint32_t                               fenceCount,
+                                                   decode::HandlePointerDecoder<VkFence>* pFences)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+
+    assert(pFences != nullptr);
+
+    const format::HandleId* fence_ids = pFences->GetPointer();
+
+    if ((returnValue == VK_SUCCESS) && (fence_ids != nullptr))
+    {
+        // Fence resets are retained, so they apply to both the captured and replayed fence states.
+        for (uint32_t i = 0; i < fenceCount; ++i)
+        {
+            auto entry = fences_.find(fence_ids[i]);
+            if (entry != fences_.end())
+            {
+                entry->second.signaled        = false;
+                entry->second.replay_signaled = false;
+            }
+        }
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkCreateSemaphore(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkSemaphoreCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkSemaphore>*                           pSemaphore)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    assert((pCreateInfo != nullptr) && (pSemaphore != nullptr));
+
+    const VkSemaphoreCreateInfo* create_info = pCreateInfo->GetPointer();
+
+    if ((returnValue == VK_SUCCESS) && (create_info != nullptr) && (pSemaphore->GetPointer() != nullptr))
+    {
+        bool timeline = false;
+        auto pnext    = reinterpret_cast<const VkBaseInStructure*>(create_info->pNext);
+
+        while (pnext != nullptr)
+        {
+            if (pnext->sType == VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO)
+            {
+                auto type_info = reinterpret_cast<const VkSemaphoreTypeCreateInfo*>(pnext);
+                timeline       = (type_info->semaphoreType == VK_SEMAPHORE_TYPE_TIMELINE);
+                break;
+            }
+
+            pnext = pnext->pNext;
+        }
+
+        // Timeline semaphore values are not restored.
+        if (!timeline)
+        {
+            semaphores_[*pSemaphore->GetPointer()].device_id = device;
+        }
+    }
+
+    TrackCreatedObject(returnValue, pSemaphore);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroySemaphore(
+    format::HandleId                                                     device,
+    format::HandleId                                                     semaphore,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    semaphores_.erase(semaphore);
+    TrackDestroyedObject(semaphore);
+}
+
+void VulkanTrimStateTracker::Process_vkAllocateCommandBuffers(
+    VkResult                                                                   returnValue,
+    format::HandleId                                                           device,
+    decode::StructPointerDecoder<decode::Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
+    decode::HandlePointerDecoder<VkCommandBuffer>*                             pCommandBuffers)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+
+    assert((pAllocateInfo != nullptr) && (pCommandBuffers != nullptr));
+
+    const VkCommandBufferAllocateInfo*                 allocate_info = pAllocateInfo->GetPointer();
+    const decode::Decoded_VkCommandBufferAllocateInfo* allocate_meta = pAllocateInfo->GetMetaStructPointer();
+    const format::HandleId*                            buffer_ids    = pCommandBuffers->GetPointer();
+
+    if ((returnValue == VK_SUCCESS) && (allocate_info != nullptr) && (allocate_meta != nullptr) &&
+        (buffer_ids != nullptr))
+    {
+        auto& pool_buffers = command_pools_[allocate_meta->commandPool];
+
+        for (uint32_t i = 0; i < allocate_info->commandBufferCount; ++i)
+        {
+            command_buffers_[buffer_ids[i]].pool_id = allocate_meta->commandPool;
+            pool_buffers.insert(buffer_ids[i]);
+        }
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkFreeCommandBuffers(
+    format::HandleId                               device,
+    format::HandleId                               commandPool,
+    uint32_t                                       commandBufferCount,
+    decode::HandlePointerDecoder<VkCommandBuffer>* pCommandBuffers)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+
+    assert(pCommandBuffers != nullptr);
+
+    const format::HandleId* buffer_ids = pCommandBuffers->GetPointer();
+
+    if (buffer_ids != nullptr)
+    {
+        auto pool_entry = command_pools_.find(commandPool);
+
+        for (uint32_t i = 0; i < commandBufferCount; ++i)
+        {
+            EndRecording(buffer_ids[i]);
+            command_buffers_.erase(buffer_ids[i]);
+
+            if (pool_entry != command_pools_.end())
+            {
+                pool_entry->second.erase(buffer_ids[i]);
+            }
+        }
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyCommandPool(
+    format::HandleId                                                     device,
+    format::HandleId                                                     commandPool,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    auto entry = command_pools_.find(commandPool);
+    if (entry != command_pools_.end())
+    {
+        for (format::HandleId command_buffer_id : entry->second)
+        {
+            EndRecording(command_buffer_id);
+            command_buffers_.erase(command_buffer_id);
+        }
+
+        command_pools_.erase(entry);
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkAllocateDescriptorSets(
+    VkResult                                                                   returnValue,
+    format::HandleId                                                           device,
+    decode::StructPointerDecoder<decode::Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
+    decode::HandlePointerDecoder<VkDescriptorSet>*                             pDescriptorSets)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+
+    assert((pAllocateInfo != nullptr) && (pDescriptorSets != nullptr));
+
+    const VkDescriptorSetAllocateInfo*                 allocate_info = pAllocateInfo->GetPointer();
+    const decode::Decoded_VkDescriptorSetAllocateInfo* allocate_meta = pAllocateInfo->GetMetaStructPointer();
+    const format::HandleId*                            set_ids       = pDescriptorSets->GetPointer();
+
+    if ((returnValue == VK_SUCCESS) && (allocate_info != nullptr) && (allocate_meta != nullptr) && (set_ids != nullptr))
+    {
+        auto& pool_sets = descriptor_pools_[allocate_meta->descriptorPool];
+
+        for (uint32_t i = 0; i < allocate_info->descriptorSetCount; ++i)
+        {
+            pool_sets.insert(set_ids[i]);
+        }
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkFreeDescriptorSets(
+    VkResult                                       returnValue,
+    format::HandleId                               device,
+    format::HandleId                               descriptorPool,
+    uint32_t                                       descriptorSetCount,
+    decode::HandlePointerDecoder<VkDescriptorSet>* pDescriptorSets)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(returnValue);
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+
+    assert(pDescriptorSets != nullptr);
+
+    const format::HandleId* set_ids = pDescriptorSets->GetPointer();
+
+    if (set_ids != nullptr)
+    {
+        auto pool_entry = descriptor_pools_.find(descriptorPool);
+
+        for (uint32_t i = 0; i < descriptorSetCount; ++i)
+        {
+            ReleaseDescriptorSet(set_ids[i]);
+
+            if (pool_entry != descriptor_pools_.end())
+            {
+                pool_entry->second.erase(set_ids[i]);
+            }
+        }
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkResetDescriptorPool(VkResult                   returnValue,
+                                                           format::HandleId           device,
+                                                           format::HandleId           descriptorPool,
+                                                           VkDescriptorPoolResetFlags flags)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(returnValue);
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(flags);
+
+    ReleaseDescriptorPool(descriptorPool);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyDescriptorPool(
+    format::HandleId                                                     device,
+    format::HandleId                                                     descriptorPool,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    ReleaseDescriptorPool(descriptorPool);
+}
+
+void VulkanTrimStateTracker::Process_vkUpdateDescriptorSets(
+    format::HandleId                                                    device,
+    uint32_t                                                            descriptorWriteCount,
+    decode::StructPointerDecoder<decode::Decoded_VkWriteDescriptorSet>* pDescriptorWrites,
+    uint32_t                                                            descriptorCopyCount,
+    decode::StructPointerDecoder<decode::Decoded_VkCopyDescriptorSet>*  pDescriptorCopies)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+
+    assert((pDescriptorWrites != nullptr) && (pDescriptorCopies != nullptr));
+
+    // Updates from a loaded state snapshot are retained, and are not compared with later updates.
+    if (loading_state_)
+    {
+        return;
+    }
+
+    uint64_t                                    block_offset = GetCurrentBlockOffset();
+    const decode::Decoded_VkCopyDescriptorSet*  copy_metas   = pDescriptorCopies->GetMetaStructPointer();
+    const VkWriteDescriptorSet*                 write_infos  = pDescriptorWrites->GetPointer();
+    const decode::Decoded_VkWriteDescriptorSet* write_metas  = pDescriptorWrites->GetMetaStructPointer();
+
+    // Copies read the current descriptor values of their source sets, so the updates that wrote them are retained.
+    for (uint32_t i = 0; (copy_metas != nullptr) && (i < descriptorCopyCount); ++i)
+    {
+        RetainDescriptorSet(copy_metas[i].srcSet);
+    }
+
+    for (uint32_t i = 0; (write_infos != nullptr) && (write_metas != nullptr) && (i < descriptorWriteCount); ++i)
+    {
+        DescriptorWriteMap& set_writes = descriptor_writes_[write_metas[i].dstSet];
+
+        for (uint32_t j = 0; j < write_infos[i].descriptorCount; ++j)
+        {
+            DescriptorKey key(write_infos[i].dstBinding, write_infos[i].dstArrayElement + j);
+
+            auto entry = set_writes.find(key);
+            if (entry == set_writes.end())
+            {
+                set_writes.emplace(key, block_offset);
+                ++descriptor_write_counts_[block_offset];
+            }
+            else if (entry->second != block_offset)
+            {
+                ReleaseDescriptorWrite(entry->second);
+                entry->second = block_offset;
+                ++descriptor_write_counts_[block_offset];
+            }
+        }
+    }
+
+    if (descriptorCopyCount > 0)
+    {
+        // The descriptor values written by copies are not tracked, so an update with copies is always retained.
+        descriptor_write_counts_.erase(block_offset);
+    }
+}
+
+void VulkanTrimStateTracker::Process_vkAllocateMemory(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkMemoryAllocateInfo>*  pAllocateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkDeviceMemory>*                        pMemory)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pMemory);
+}
+
+void VulkanTrimStateTracker::Process_vkFreeMemory(
+    format::HandleId                                                     device,
+    format::HandleId                                                     memory,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    // Writes to memory that is released before the next retained submission are never read.
+    auto entry = pending_fills_.find(memory);
+    if (entry != pending_fills_.end())
+    {
+        for (const auto& fill : entry->second)
+        {
+            OmitBlock(fill.block_offset);
+        }
+
+        pending_fills_.erase(entry);
+    }
+
+    TrackDestroyedObject(memory);
+}
+
+void VulkanTrimStateTracker::Process_vkMapMemory(VkResult                                 returnValue,
+                                                 format::HandleId                         device,
+                                                 format::HandleId                         memory,
+                                                 VkDeviceSize                             offset,
+                                                 VkDeviceSize                             size,
+                                                 VkMemoryMapFlags                         flags,
+                                                 decode::PointerDecoder<uint64_t, void*>* ppData)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(returnValue);
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(offset);
+    GFXRECON_UNREFERENCED_PARAMETER(size);
+    GFXRECON_UNREFERENCED_PARAMETER(flags);
+    GFXRECON_UNREFERENCED_PARAMETER(ppData);
+
+    // Fill memory offsets are relative to the mapped range, so writes made through different mappings of the same
+    // memory object are not compared.
+    pending_fills_.erase(memory);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateBuffer(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkBufferCreateInfo>*    pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkBuffer>*                              pBuffer)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pBuffer);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyBuffer(
+    format::HandleId                                                     device,
+    format::HandleId                                                     buffer,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(buffer);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateBufferView(
+    VkResult                                                              returnValue,
+    format::HandleId                                                      device,
+    decode::StructPointerDecoder<decode::Decoded_VkBufferViewCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*  pAllocator,
+    decode::HandlePointerDecoder<VkBufferView>*                           pView)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pView);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyBufferView(
+    format::HandleId                                                     device,
+    format::HandleId                                                     bufferView,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(bufferView);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateImage(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkImageCreateInfo>*     pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkImage>*                               pImage)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pImage);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyImage(
+    format::HandleId                                                     device,
+    format::HandleId                                                     image,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(image);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateImageView(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkImageViewCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkImageView>*                           pView)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pView);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyImageView(
+    format::HandleId                                                     device,
+    format::HandleId                                                     imageView,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(imageView);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateSampler(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkSamplerCreateInfo>*   pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkSampler>*                             pSampler)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pSampler);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroySampler(
+    format::HandleId                                                     device,
+    format::HandleId                                                     sampler,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(sampler);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateShaderModule(
+    VkResult                                                                returnValue,
+    format::HandleId                                                        device,
+    decode::StructPointerDecoder<decode::Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*    pAllocator,
+    decode::HandlePointerDecoder<VkShaderModule>*                           pShaderModule)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pShaderModule);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyShaderModule(
+    format::HandleId                                                     device,
+    format::HandleId                                                     shaderModule,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(shaderModule);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateEvent(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkEventCreateInfo>*     pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkEvent>*                               pEvent)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pEvent);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyEvent(
+    format::HandleId                                                     device,
+    format::HandleId                                                     event,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(event);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateQueryPool(
+    VkResult                                                             returnValue,
+    format::HandleId                                                     device,
+    decode::StructPointerDecoder<decode::Decoded_VkQueryPoolCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+    decode::HandlePointerDecoder<VkQueryPool>*                           pQueryPool)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pQueryPool);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyQueryPool(
+    format::HandleId                                                     device,
+    format::HandleId                                                     queryPool,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(queryPool);
+}
+
+void VulkanTrimStateTracker::Process_vkCreateFramebuffer(
+    VkResult                                                               returnValue,
+    format::HandleId                                                       device,
+    decode::StructPointerDecoder<decode::Decoded_VkFramebufferCreateInfo>* pCreateInfo,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*   pAllocator,
+    decode::HandlePointerDecoder<VkFramebuffer>*                           pFramebuffer)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pCreateInfo);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackCreatedObject(returnValue, pFramebuffer);
+}
+
+void VulkanTrimStateTracker::Process_vkDestroyFramebuffer(
+    format::HandleId                                                     device,
+    format::HandleId                                                     framebuffer,
+    decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator)
+{
+    GFXRECON_UNREFERENCED_PARAMETER(device);
+    GFXRECON_UNREFERENCED_PARAMETER(pAllocator);
+
+    TrackDestroyedObject(framebuffer);
+}
+
+GFXRECON_END_NAMESPACE(gfxrecon)
@@ -0,0 +1,502 @@
+/*
+** Copyright (c) 2021 LunarG, Inc.
+**
+** Permission is hereby granted, free of charge, to any person obtaining a
+** copy of this software and associated documentation files (the "Software"),
+** to deal in the Software without restriction, including without limitation
+** the rights to use, copy, modify, merge, publish, distribute, sublicense,
+** and/or sell copies of the Software, and to permit persons to whom the
+** Software is furnished to do so, subject to the following conditions:
+**
+** The above copyright notice and this permission notice shall be included in
+** all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+** IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+** FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+** AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+** LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+** FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+** DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef GFXRECON_VULKAN_TRIM_STATE_TRACKER_H
+#define GFXRECON_VULKAN_TRIM_STATE_TRACKER_H
+
+#include "decode/file_processor.h"
+#include "format/api_call_id.h"
+#include "format/format.h"
+#include "generated/generated_vulkan_consumer.h"
+#include "util/defines.h"
+
+#include "vulkan/vulkan.h"
+
+#include <cstdint>
+#include <map>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+GFXRECON_BEGIN_NAMESPACE(gfxrecon)
+
+// The state at the start of a frame range, described by the blocks from the preceding frames that must be omitted or
+// replaced when writing the state snapshot, and the synchronization object state to be written at the end of the
+// snapshot.  Blocks are identified by their file offsets.
+struct VulkanTrimState
+{
+    // A queue submission with the command buffers that perform transfer operations, without semaphores.
+    struct QueueSubmission
+    {
+        format::HandleId              queue_id{ format::kNullHandleId };
+        std::vector<format::HandleId> command_buffer_ids;
+        format::HandleId              fence_id{ format::kNullHandleId };
+    };
+
+    // Maps queue IDs to the IDs of the semaphores to be signaled or waited on with an empty submission to the queue.
+    typedef std::map<format::HandleId, std::vector<format::HandleId>> SemaphoreMap;
+
+    // Maps fence IDs to the ID of the queue that signals the fence with an empty submission.
+    typedef std::map<format::HandleId, format::HandleId> FenceMap;
+
+    // Maps the file offsets of queue submission blocks to the submissions that replace them.
+    typedef std::unordered_map<uint64_t, std::vector<QueueSubmission>> SubmissionMap;
+
+    std::unordered_set<uint64_t> omitted_block_offsets;
+    SubmissionMap                transfer_submissions;
+    SemaphoreMap                 signaled_semaphores;
+    SemaphoreMap                 unsignaled_semaphores;
+    FenceMap                     signaled_fences;
+};
+
+// Tracks the Vulkan state produced by the frames that precede a frame range, mirroring the capture layer's state
+// tracker on the replay side, to determine which blocks are needed to recreate the state at the start of the range:
+//  - Queue submissions are omitted, except for the command buffers that only perform transfer operations such as
+//    staging uploads, layout transitions, and clears.  Those are submitted again without semaphores, followed by a
+//    queue wait.  Presentation, image acquisition, host waits, and polling calls are omitted.
+//  - Command buffer recordings are omitted when they are superseded by a later recording or by a reset of the command
+//    buffer or its pool, unless a transfer submission executed them.
+//  - Fill memory commands that are fully overwritten by another fill memory command before a transfer submission
+//    could read the memory contents, or that precede the release of the memory object, are omitted.
+//  - Descriptor set updates that are fully overwritten by later updates, or that precede the release of the set, are
+//    omitted.
+//  - Objects that are created and destroyed before the range are omitted when every call that references them is
+//    omitted, along with the calls that only operate on the object, such as memory binding and mapping.
+//  - Fences and binary semaphores are restored to the state that they had at the start of the range, with empty queue
+//    submissions that signal or wait on them.
+// Blocks written while loading a trimmed state snapshot from the input file are retained, and their objects are
+// excluded from the analysis.
+class VulkanTrimStateTracker : public decode::VulkanConsumer
+{
+  public:
+    VulkanTrimStateTracker(const decode::FileProcessor* file_processor);
+
+    virtual ~VulkanTrimStateTracker() override;
+
+    // Completes the analysis at the start of the frame range, and retrieves the resulting state.
+    void GetTrimState(VulkanTrimState* trim_state);
+
+    // Calls that record commands to a command buffer, or that reset command buffer recordings.
+    static bool IsRecordingCall(format::ApiCallId call_id);
+
+    // Calls that only perform per-frame work, which are not needed to recreate object state.
+    static bool IsFrameWorkCall(format::ApiCallId call_id);
+
+    // Processes the raw parameter data for an API call, before the call is decoded.  Command buffer recordings are
+    // tracked from the command buffer ID that is the first parameter of each recording call, and objects with IDs
+    // that appear in the parameter data are considered to be referenced by the call.
+    void ProcessParameterData(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    virtual bool IsMetaDataOfInterest(format::MetaDataType meta_type) const override;
+
+    virtual void ProcessStateBeginMarker(uint64_t frame_number) override;
+
+    virtual void ProcessStateEndMarker(uint64_t frame_number) override;
+
+    virtual void
+    ProcessCreateHardwareBufferCommand(format::HandleId                                    memory_id,
+                                       uint64_t                                            buffer_id,
+                                       uint32_t                                            format,
+                                       uint32_t                                            width,
+                                       uint32_t                                            height,
+                                       uint32_t                                            stride,
+                                       uint32_t                                            usage,
+                                       uint32_t                                            layers,
+                                       const std::vector<format::HardwareBufferPlaneInfo>& plane_info) override;
+
+    virtual void
+    ProcessSetOpaqueAddressCommand(format::HandleId device_id, format::HandleId object_id, uint64_t address) override;
+
+    virtual void ProcessFillMemoryCommand(uint64_t       memory_id,
+                                          uint64_t       offset,
+                                          uint64_t       size,
+                                          const uint8_t* data) override;
+
+    virtual void Process_vkGetDeviceQueue(format::HandleId                       device,
+                                          uint32_t                               queueFamilyIndex,
+                                          uint32_t                               queueIndex,
+                                          decode::HandlePointerDecoder<VkQueue>* pQueue) override;
+
+    virtual void
+    Process_vkGetDeviceQueue2(format::HandleId                                                  device,
+                              decode::StructPointerDecoder<decode::Decoded_VkDeviceQueueInfo2>* pQueueInfo,
+                              decode::HandlePointerDecoder<VkQueue>*                            pQueue) override;
+
+    virtual void Process_vkQueueSubmit(VkResult                                                    returnValue,
+                                       format::HandleId                                            queue,
+                                       uint32_t                                                    submitCount,
+                                       decode::StructPointerDecoder<decode::Decoded_VkSubmitInfo>* pSubmits,
+                                       format::HandleId                                            fence) override;
+
+    virtual void
+    Process_vkQueueBindSparse(VkResult                                                        returnValue,
+                              format::HandleId                                                queue,
+                              uint32_t                                                        bindInfoCount,
+                              decode::StructPointerDecoder<decode::Decoded_VkBindSparseInfo>* pBindInfo,
+                              format::HandleId                                                fence) override;
+
+    virtual void
+    Process_vkQueuePresentKHR(VkResult                                                        returnValue,
+                              format::HandleId                                                queue,
+                              decode::StructPointerDecoder<decode::Decoded_VkPresentInfoKHR>* pPresentInfo) override;
+
+    virtual void Process_vkAcquireNextImageKHR(VkResult                          returnValue,
+                                               format::HandleId                  device,
+                                               format::HandleId                  swapchain,
+                                               uint64_t                          timeout,
+                                               format::HandleId                  semaphore,
+                                               format::HandleId                  fence,
+                                               decode::PointerDecoder<uint32_t>* pImageIndex) override;
+
+    virtual void Process_vkAcquireNextImage2KHR(
+        VkResult                                                                 returnValue,
+        format::HandleId                                                         device,
+        decode::StructPointerDecoder<decode::Decoded_VkAcquireNextImageInfoKHR>* pAcquireInfo,
+        decode::PointerDecoder<uint32_t>*                                        pImageIndex) override;
+
+    virtual void Process_vkCreateFence(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkFenceCreateInfo>*     pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkFence>*                               pFence) override;
+
+    virtual void Process_vkDestroyFence(
+        format::HandleId                                                     device,
+        format::HandleId                                                     fence,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkResetFences(VkResult                               returnValue,
+                                       format::HandleId                       device,
+                                       uint32_t                               fenceCount,
+                                       decode::HandlePointerDecoder<VkFence>* pFences) override;
+
+    virtual void Process_vkCreateSemaphore(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkSemaphoreCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkSemaphore>*                           pSemaphore) override;
+
+    virtual void Process_vkDestroySemaphore(
+        format::HandleId                                                     device,
+        format::HandleId                                                     semaphore,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkAllocateCommandBuffers(
+        VkResult                                                                   returnValue,
+        format::HandleId                                                           device,
+        decode::StructPointerDecoder<decode::Decoded_VkCommandBufferAllocateInfo>* pAllocateInfo,
+        decode::HandlePointerDecoder<VkCommandBuffer>*                             pCommandBuffers) override;
+
+    virtual void Process_vkFreeCommandBuffers(format::HandleId                               device,
+                                              format::HandleId                               commandPool,
+                                              uint32_t                                       commandBufferCount,
+                                              decode::HandlePointerDecoder<VkCommandBuffer>* pCommandBuffers) override;
+
+    virtual void Process_vkDestroyCommandPool(
+        format::HandleId                                                     device,
+        format::HandleId                                                     commandPool,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkAllocateDescriptorSets(
+        VkResult                                                                   returnValue,
+        format::HandleId                                                           device,
+        decode::StructPointerDecoder<decode::Decoded_VkDescriptorSetAllocateInfo>* pAllocateInfo,
+        decode::HandlePointerDecoder<VkDescriptorSet>*                             pDescriptorSets) override;
+
+    virtual void Process_vkFreeDescriptorSets(VkResult                                       returnValue,
+                                              format::HandleId                               device,
+                                              format::HandleId                               descriptorPool,
+                                              uint32_t                                       descriptorSetCount,
+                                              decode::HandlePointerDecoder<VkDescriptorSet>* pDescriptorSets) override;
+
+    virtual void Process_vkResetDescriptorPool(VkResult                   returnValue,
+                                               format::HandleId           device,
+                                               format::HandleId           descriptorPool,
+                                               VkDescriptorPoolResetFlags flags) override;
+
+    virtual void Process_vkDestroyDescriptorPool(
+        format::HandleId                                                     device,
+        format::HandleId                                                     descriptorPool,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkUpdateDescriptorSets(
+        format::HandleId                                                    device,
+        uint32_t                                                            descriptorWriteCount,
+        decode::StructPointerDecoder<decode::Decoded_VkWriteDescriptorSet>* pDescriptorWrites,
+        uint32_t                                                            descriptorCopyCount,
+        decode::StructPointerDecoder<decode::Decoded_VkCopyDescriptorSet>*  pDescriptorCopies) override;
+
+    virtual void Process_vkAllocateMemory(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkMemoryAllocateInfo>*  pAllocateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkDeviceMemory>*                        pMemory) override;
+
+    virtual void Process_vkFreeMemory(
+        format::HandleId                                                     device,
+        format::HandleId                                                     memory,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkMapMemory(VkResult                                 returnValue,
+                                     format::HandleId                         device,
+                                     format::HandleId                         memory,
+                                     VkDeviceSize                             offset,
+                                     VkDeviceSize                             size,
+                                     VkMemoryMapFlags                         flags,
+                                     decode::PointerDecoder<uint64_t, void*>* ppData) override;
+
+    virtual void Process_vkCreateBuffer(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkBufferCreateInfo>*    pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkBuffer>*                              pBuffer) override;
+
+    virtual void Process_vkDestroyBuffer(
+        format::HandleId                                                     device,
+        format::HandleId                                                     buffer,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateBufferView(
+        VkResult                                                              returnValue,
+        format::HandleId                                                      device,
+        decode::StructPointerDecoder<decode::Decoded_VkBufferViewCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*  pAllocator,
+        decode::HandlePointerDecoder<VkBufferView>*                           pView) override;
+
+    virtual void Process_vkDestroyBufferView(
+        format::HandleId                                                     device,
+        format::HandleId                                                     bufferView,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateImage(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkImageCreateInfo>*     pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkImage>*                               pImage) override;
+
+    virtual void Process_vkDestroyImage(
+        format::HandleId                                                     device,
+        format::HandleId                                                     image,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateImageView(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkImageViewCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkImageView>*                           pView) override;
+
+    virtual void Process_vkDestroyImageView(
+        format::HandleId                                                     device,
+        format::HandleId                                                     imageView,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateSampler(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkSamplerCreateInfo>*   pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkSampler>*                             pSampler) override;
+
+    virtual void Process_vkDestroySampler(
+        format::HandleId                                                     device,
+        format::HandleId                                                     sampler,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateShaderModule(
+        VkResult                                                                returnValue,
+        format::HandleId                                                        device,
+        decode::StructPointerDecoder<decode::Decoded_VkShaderModuleCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*    pAllocator,
+        decode::HandlePointerDecoder<VkShaderModule>*                           pShaderModule) override;
+
+    virtual void Process_vkDestroyShaderModule(
+        format::HandleId                                                     device,
+        format::HandleId                                                     shaderModule,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateEvent(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkEventCreateInfo>*     pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkEvent>*                               pEvent) override;
+
+    virtual void Process_vkDestroyEvent(
+        format::HandleId                                                     device,
+        format::HandleId                                                     event,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateQueryPool(
+        VkResult                                                             returnValue,
+        format::HandleId                                                     device,
+        decode::StructPointerDecoder<decode::Decoded_VkQueryPoolCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator,
+        decode::HandlePointerDecoder<VkQueryPool>*                           pQueryPool) override;
+
+    virtual void Process_vkDestroyQueryPool(
+        format::HandleId                                                     device,
+        format::HandleId                                                     queryPool,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+    virtual void Process_vkCreateFramebuffer(
+        VkResult                                                               returnValue,
+        format::HandleId                                                       device,
+        decode::StructPointerDecoder<decode::Decoded_VkFramebufferCreateInfo>* pCreateInfo,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>*   pAllocator,
+        decode::HandlePointerDecoder<VkFramebuffer>*                           pFramebuffer) override;
+
+    virtual void Process_vkDestroyFramebuffer(
+        format::HandleId                                                     device,
+        format::HandleId                                                     framebuffer,
+        decode::StructPointerDecoder<decode::Decoded_VkAllocationCallbacks>* pAllocator) override;
+
+  private:
+    // The most recent recording of a command buffer, which is retained when it is the final recording before the
+    // frame range, or when a transfer submission executed it.
+    struct CommandBufferInfo
+    {
+        format::HandleId      pool_id{ format::kNullHandleId };
+        std::vector<uint64_t> recording_block_offsets;
+        bool                  transfer_only{ true };
+        bool                  retained{ false };
+    };
+
+    // The signal state of a fence or binary semaphore, both for the captured application and for the replay of the
+    // blocks that are retained in the snapshot.
+    struct SyncObjectInfo
+    {
+        format::HandleId device_id{ format::kNullHandleId };
+        format::HandleId queue_id{ format::kNullHandleId };
+        bool             signaled{ false };
+        bool             replay_signaled{ false };
+    };
+
+    // An object that was created before the frame range.  Owned blocks are calls that only operate on the object and
+    // are omitted with it, while referencing blocks must all be omitted for the object to be omitted.
+    struct ObjectInfo
+    {
+        uint64_t              create_block_offset{ 0 };
+        uint64_t              destroy_block_offset{ 0 };
+        std::vector<uint64_t> owned_block_offsets;
+        std::vector<uint64_t> referencing_block_offsets;
+    };
+
+    struct PendingFill
+    {
+        uint64_t block_offset;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    // Descriptors are identified by binding and array element.  Array elements that exceed the size of a binding are
+    // not mapped to the consecutive binding, so only updates that address a descriptor in the same way are compared.
+    typedef std::pair<uint32_t, uint32_t>                                              DescriptorKey;
+    typedef std::map<DescriptorKey, uint64_t>                                          DescriptorWriteMap;
+    typedef std::unordered_map<format::HandleId, CommandBufferInfo>                    CommandBufferMap;
+    typedef std::unordered_map<format::HandleId, SyncObjectInfo>                       SyncObjectMap;
+    typedef std::unordered_map<format::HandleId, ObjectInfo>                           ObjectMap;
+    typedef std::unordered_map<format::HandleId, std::vector<PendingFill>>             PendingFillMap;
+    typedef std::unordered_map<format::HandleId, DescriptorWriteMap>                   DescriptorSetMap;
+    typedef std::unordered_map<format::HandleId, std::unordered_set<format::HandleId>> ChildMap;
+
+  private:
+    static bool IsTransferCommand(format::ApiCallId call_id);
+
+    static bool IsObjectDestroyCall(format::ApiCallId call_id);
+
+    // Calls that only operate on the object specified by their second parameter, following the device.
+    static bool IsObjectOwnedCall(format::ApiCallId call_id);
+
+    // Calls that may be omitted by the analysis, so that their object references do not prevent object removal.
+    static bool IsOmittableCall(format::ApiCallId call_id);
+
+    // Calls that read from memory, invalidating all pending fill memory commands.
+    static bool IsMemoryReadCall(format::ApiCallId call_id);
+
+    uint64_t GetCurrentBlockOffset() const { return file_processor_->GetCurrentBlockOffset(); }
+
+    void OmitBlock(uint64_t block_offset);
+
+    void TrackRecordingCall(format::ApiCallId call_id, const uint8_t* parameter_buffer, size_t buffer_size);
+
+    void BeginRecording(format::HandleId command_buffer_id);
+
+    void EndRecording(format::HandleId command_buffer_id);
+
+    void EndPoolRecordings(format::HandleId pool_id);
+
+    void SignalSyncObject(SyncObjectMap*   sync_objects,
+                          format::HandleId object_id,
+                          format::HandleId queue_id,
+                          bool             retained);
+
+    void UnsignalSemaphore(format::HandleId semaphore_id, bool retained);
+
+    format::HandleId GetSyncObjectQueue(const SyncObjectInfo& info) const;
+
+    void ReleaseDescriptorWrite(uint64_t block_offset);
+
+    void ReleaseDescriptorSet(format::HandleId set_id);
+
+    void RetainDescriptorSet(format::HandleId set_id);
+
+    void ReleaseDescriptorPool(format::HandleId pool_id);
+
+    template <typename T>
+    void TrackCreatedObject(VkResult result, decode::HandlePointerDecoder<T>* handle);
+
+    void TrackDestroyedObject(format::HandleId object_id);
+
+    void TrackReferencedObject(format::HandleId object_id, format::HandleId owner_id, bool omittable);
+
+    void OmitDestroyedObjects();
+
+  private:
+    const decode::FileProcessor*                           file_processor_;
+    bool                                                   loading_state_;
+    std::unordered_set<uint64_t>                           omitted_block_offsets_;
+    VulkanTrimState::SubmissionMap                         transfer_submissions_;
+    std::unordered_map<format::HandleId, format::HandleId> device_queues_;
+    CommandBufferMap                                       command_buffers_;
+    ChildMap                                               command_pools_;
+    SyncObjectMap                                          fences_;
+    SyncObjectMap                                          semaphores_;
+    ObjectMap                                              created_objects_;
+    ObjectMap                                              destroyed_objects_;
+    format::HandleId                                       min_created_id_;
+    format::HandleId                                       max_created_id_;
+    PendingFillMap                                         pending_fills_;
+    DescriptorSetMap                                       descriptor_writes_;
+    std::unordered_map<uint64_t, uint32_t>                 descriptor_write_counts_;
+    ChildMap                                               descriptor_pools_;
+};
+
+GFXRECON_END_NAMESPACE(gfxrecon)
+
+#endif // GFXRECON_VULKAN_TRIM_STATE_TRACKER_H